@@ -43,7 +43,9 @@
 #include <blaze/math/Accuracy.h>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/BandMatrix.h>
 #include <blaze/math/BLAS.h>
+#include <blaze/math/CompactMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constants.h>
@@ -63,11 +65,16 @@
 #include <blaze/math/HybridVector.h>
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/PackedMatrix.h>
+#include <blaze/math/PackedStructure.h>
 #include <blaze/math/PaddingFlag.h>
+#include <blaze/math/ReductionFlag.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
 #include <blaze/math/SMP.h>
+#include <blaze/math/Solvers.h>
 #include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticMatrixBatch.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/StrictlyLowerMatrix.h>
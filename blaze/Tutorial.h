@@ -84,6 +84,7 @@
 //          <li> \ref views_submatrices </li>
 //          <li> \ref views_rows </li>
 //          <li> \ref views_columns </li>
+//          <li> \ref views_bands </li>
 //       </ul>
 //    </li>
 //    <li> \ref arithmetic_operations
@@ -101,7 +102,12 @@
 //          </li>
 //          <li> \ref vector_vector_division </li>
 //          <li> \ref matrix_vector_multiplication </li>
-//          <li> \ref matrix_matrix_multiplication </li>
+//          <li> \ref matrix_matrix_multiplication
+//             <ul>
+//                <li> \ref matrix_chain_multiplication </li>
+//                <li> \ref schur_product </li>
+//             </ul>
+//          </li>
 //       </ul>
 //    </li>
 //    <li> \ref custom_operations </li>
@@ -156,10 +162,14 @@
 // in functionality, but performance may be limited. Thus it is strongly recommended to install a
 // BLAS library.
 //
-// Furthermore, for computing the determinant of a dense matrix and for the dense matrix inversion
-// \b Blaze requires <a href="https://en.wikipedia.org/wiki/LAPACK">LAPACK</a>. When either of
-// these features is used it is necessary to link the LAPACK library to the final executable. If
-// no LAPACK library is available the use of these features will result in a linker error.
+// Furthermore, in case the BLAS mode is enabled (see the \c BLAZE_BLAS_MODE switch in the
+// <tt>./blaze/config/BLAS.h</tt> configuration file), for computing the determinant of a dense
+// matrix, for the dense matrix inversion, and for the dense matrix decompositions \b Blaze
+// requires <a href="https://en.wikipedia.org/wiki/LAPACK">LAPACK</a>. When either of these
+// features is used it is necessary to link the LAPACK library to the final executable. If no
+// LAPACK library is available the use of these features will result in a linker error. In case
+// the BLAS mode is disabled, \b Blaze computes the determinant, the inversion, and the LU, the
+// Cholesky, and the QR decomposition by means of its own blocked kernels.
 //
 //
 // \n \section step_1_installation Step 1: Installation
@@ -1758,6 +1768,46 @@
 // \ref custom_operations for a detailed overview of the possibilities of custom operations.
 //
 //
+// \n \subsection vector_operations_reduce reduce() / sum() / prod()
+//
+// The \c reduce() function reduces the elements of the given dense vector by means of the given
+// binary reduction operation. The \c sum() and \c prod() functions are shortcuts for the
+// reduction by means of addition and multiplication, respectively:
+
+   \code
+   blaze::DynamicVector<double> a{ 1.0, 2.0, 3.0, 4.0 };
+
+   const double totalsum1 = reduce( a, blaze::Add() );  // Results in 10
+   const double totalsum2 = sum( a );                 // Results in 10
+   const double totalprod = prod( a );                // Results in 24
+
+   // Custom reduction operation via a lambda
+   const double maximum = reduce( a, []( double x, double y ){ return std::max( x, y ); } );  // Results in 4
+   \endcode
+
+// The reduction operations provided by Blaze (\c blaze::Add, \c blaze::Mult, \c blaze::Minimum,
+// and \c blaze::Maximum) are vectorized, custom operations are vectorized in case they provide
+// a SIMD evaluation (see \ref custom_operations). Large vectors are reduced in parallel (see
+// \ref shared_memory_parallelization). Note that the evaluation order of the reduction is
+// unspecified and that \c sum() and \c prod() are also available for sparse vectors. In case
+// the vector currently has a size of 0, all functions return 0.
+//
+//
+// \n \subsection vector_operations_norms norm() / sqrNorm() / l1Norm() / maxNorm()
+//
+// The \c norm() function computes the Euclidean norm (L2 norm) of the given dense or sparse
+// vector, \c sqrNorm() the squared Euclidean norm, \c l1Norm() the sum of the absolute values
+// of all elements, and \c maxNorm() the largest absolute value of all elements:
+
+   \code
+   blaze::DynamicVector<double> a{ 3.0, -4.0 };
+
+   const double l2  = norm( a );     // Results in 5
+   const double sl2 = sqrNorm( a );  // Results in 25
+   const double l1  = l1Norm( a );   // Results in 7
+   const double inf = maxNorm( a );  // Results in 4
+   \endcode
+
 // \n \subsection vector_operations_length length() / sqrLength()
 //
 // In order to calculate the length of a vector, both the \c length() and \c sqrLength() function
@@ -2349,6 +2399,124 @@
    blaze::CompressedMatrix<double,blaze::columnMajor> C;
    \endcode
 
+// \n \section matrix_types_band_matrix BandMatrix
+// <hr>
+//
+// The blaze::BandMatrix class template is the representation of an arbitrary sized dense matrix
+// that only stores the elements within a given number of sub- and superdiagonals. It can be
+// included via the header file
+
+   \code
+   #include <blaze/math/BandMatrix.h>
+   \endcode
+
+// The type of the elements and the storage order of the matrix can be specified via the two
+// template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class BandMatrix;
+   \endcode
+
+//  - \c Type: specifies the type of the matrix elements. BandMatrix can be used with any
+//             non-cv-qualified, non-reference, non-pointer element type.
+//  - \c SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//             The default value is blaze::rowMajor.
+//
+// The number of subdiagonals (the lower bandwidth) and the number of superdiagonals (the upper
+// bandwidth) are specified at construction time. Each diagonal is stored contiguously, i.e.
+// a \f$ N \times N \f$ band matrix only requires \f$ (kl+ku+1) \cdot N \f$ elements. All
+// elements outside of the band are zero: reading them yields 0, assigning 0 to them has no
+// effect and assigning any other value results in a \c std::invalid_argument exception. The
+// blaze::BandMatrix is the right choice for the tridiagonal and pentadiagonal matrices of 1D
+// and 2D finite difference discretizations:
+
+   \code
+   // Definition of a 1000x1000 tridiagonal matrix
+   blaze::BandMatrix<double> A( 1000UL, 1000UL, 1UL, 1UL );
+
+   // Definition of a 1000x1000 pentadiagonal column-major matrix
+   blaze::BandMatrix<double,blaze::columnMajor> B( 1000UL, 1000UL, 2UL, 2UL );
+
+   band( A, 0L ) =  2.0;  // Setting the main diagonal
+   band( A, 1L ) = -1.0;  // Setting the first superdiagonal
+   band( A,-1L ) = -1.0;  // Setting the first subdiagonal
+   \endcode
+
+// Matrix/vector and matrix/matrix multiplications with a band matrix are performed diagonal by
+// diagonal and only touch the stored band. The product, sum and difference of two band matrices
+// is again a band matrix with the according bandwidth. Additionally, systems of linear equations
+// with a band matrix can be solved via the LU decomposition (gbtrf() and gbtrs()) and, in case
+// of a symmetric positive definite band matrix, via the Cholesky decomposition (pbtrf() and
+// pbtrs()):
+
+   \code
+   blaze::DynamicVector<double> x( 1000UL, 1.0 ), y;
+
+   y = A * x;                // Band matrix/vector multiplication
+   blaze::BandMatrix<double> C( A * A );  // Pentadiagonal band matrix
+
+   std::unique_ptr<int[]> ipiv( new int[1000UL] );
+   blaze::BandMatrix<double> LU( A );
+   gbtrf( LU, ipiv.get() );  // LU decomposition of A
+   gbtrs( LU, ipiv.get(), y );  // Solving A*x=y; y is overwritten by the solution x
+
+   blaze::BandMatrix<double> L( A );
+   pbtrf( L );               // Cholesky decomposition of the symmetric positive definite A
+   pbtrs( L, y );            // Solving A*x=y via the Cholesky factor
+   \endcode
+
+// \n \section matrix_types_static_matrix_batch StaticMatrixBatch
+// <hr>
+//
+// The blaze::StaticMatrixBatch class template represents a batch of an arbitrary number of small
+// matrices of the same, fixed size (as for instance the Jacobians of all elements of a finite
+// element mesh). It can be included via the header file
+
+   \code
+   #include <blaze/math/StaticMatrixBatch.h>
+   \endcode
+
+// The type of the elements and the number of rows and columns of the matrices can be specified
+// via the three template parameters:
+
+   \code
+   template< typename Type, size_t M, size_t N >
+   class StaticMatrixBatch;
+   \endcode
+
+//  - \c Type: specifies the type of the matrix elements. StaticMatrixBatch can only be used with
+//             floating point element types.
+//  - \c M   : specifies the number of rows of each matrix.
+//  - \c N   : specifies the number of columns of each matrix.
+//
+// In contrast to a \c std::vector of blaze::StaticMatrix, the matrices of a batch are stored
+// interleaved such that every lane of a SIMD register holds the element of a different matrix.
+// Therefore the batched operations process several matrices at once without any shuffling of
+// elements. Additionally, batches with at least \c SMP_BATCH_THRESHOLD matrices are processed
+// in parallel. The blaze::StaticVectorBatch class template represents the according batch of
+// small vectors:
+
+   \code
+   blaze::StaticMatrixBatch<double,3UL,3UL> A( 100000UL ), B( 100000UL ), C, L;
+   blaze::StaticVectorBatch<double,3UL> x( 100000UL ), y;
+
+   A(0UL,1UL,2UL) = 2.0;                           // Setting the element (1,2) of matrix 0
+   B.set( 1UL, blaze::StaticMatrix<double,3UL,3UL>( 1.0 ) );  // Setting matrix 1
+   blaze::StaticMatrix<double,3UL,3UL> B1( B.get( 1UL ) );   // Extracting matrix 1
+
+   C = A * B;                                      // Batched matrix multiplication
+   y = A * x;                                      // Batched matrix/vector multiplication
+   blaze::DynamicVector<double> d( det( A ) );     // Batched determinants
+   invert( A );                                    // Batched inversion
+   llh( B, L );                                    // Batched Cholesky decomposition of B
+   \endcode
+
+// The batched determinant and inversion are available for matrices of size \f$ 2 \times 2 \f$ up
+// to \f$ 6 \times 6 \f$ and use the same closed form formulas as the according functions for a
+// single matrix. In case any matrix of a batch is singular (or not positive definite in case of
+// the Cholesky decomposition) a \c std::runtime_error exception is thrown.
+//
 // \n Previous: \ref matrices &nbsp; &nbsp; Next: \ref matrix_operations
 */
 //*************************************************************************************************
@@ -3457,6 +3625,71 @@
 // \ref custom_operations for a detailed overview of the possibilities of custom operations.
 //
 //
+// \n \subsection matrix_operations_reduce reduce() / sum() / prod()
+//
+// The \c reduce() function reduces all elements of the given dense matrix by means of the given
+// binary reduction operation. The \c sum() and \c prod() functions are shortcuts for the
+// reduction by means of addition and multiplication, respectively:
+
+   \code
+   blaze::DynamicMatrix<double> A{ { 1.0, 2.0 }, { 3.0, 4.0 } };
+
+   const double totalsum1 = reduce( A, blaze::Add() );  // Results in 10
+   const double totalsum2 = sum( A );                 // Results in 10
+   const double totalprod = prod( A );                // Results in 24
+
+   // Custom reduction operation via a lambda
+   const double maximum = reduce( A, []( double x, double y ){ return std::max( x, y ); } );  // Results in 4
+   \endcode
+
+// As for vectors, the evaluation order of the reduction is unspecified, large matrices are
+// reduced in parallel, and \c sum() and \c prod() are also available for sparse matrices.
+//
+//
+// \n \subsection matrix_operations_norms norm() / sqrNorm() / l1Norm() / maxNorm()
+//
+// The \c norm(), \c sqrNorm(), \c l1Norm(), and \c maxNorm() functions compute the element-wise
+// norms of the given dense or sparse matrix, i.e. \c norm() computes the Frobenius norm, \c l1Norm()
+// the sum of the absolute values of all elements, and \c maxNorm() the largest absolute value of
+// all elements:
+
+   \code
+   blaze::DynamicMatrix<double> A{ { 1.0, -2.0 }, { 2.0, 4.0 } };
+
+   const double fro = norm( A );     // Results in 5
+   const double sfr = sqrNorm( A );  // Results in 25
+   const double l1  = l1Norm( A );   // Results in 9
+   const double inf = maxNorm( A );  // Results in 4
+   \endcode
+
+// \n \subsection matrix_operations_partial_reduce Row-wise and Column-wise Reductions
+//
+// All reduction and norm functions can also be applied to the individual rows or columns of
+// a dense or sparse matrix. The reduction flag \c blaze::rowwise reduces each row of the matrix
+// and results in a column vector, the flag \c blaze::columnwise reduces each column and results
+// in a row vector:
+
+   \code
+   blaze::DynamicMatrix<double> A{ { 1.0, -2.0 }, { 3.0, 4.0 } };
+
+   blaze::DynamicVector<double,columnVector> rowsum;
+   blaze::DynamicVector<double,rowVector> colmax;
+
+   rowsum = sum<rowwise>( A );                      // Results in ( -1 7 )
+   colmax = max<columnwise>( A );                   // Results in ( 3 4 )
+   colmax = reduce<columnwise>( A, blaze::Add() );  // Results in ( 4 2 )
+
+   // Row-wise L2 norms, e.g. for the normalization of the rows of the matrix
+   blaze::DynamicVector<double,columnVector> rownorm( norm<rowwise>( A ) );
+   \endcode
+
+// The row-wise and column-wise reductions are lazily evaluated expressions. The matrix is
+// always traversed in the order that best suits its storage order, i.e. a column-wise reduction
+// of a row-major matrix accumulates complete (vectorized) rows of the matrix instead of
+// traversing the columns one by one. Large matrices are reduced in parallel (see
+// \ref shared_memory_parallelization).
+//
+//
 // \n \subsection matrix_operations_matrix_transpose trans()
 //
 // Matrices can be transposed via the \c trans() function. Row-major matrices are transposed into
@@ -3542,9 +3775,10 @@
 // \c complex<float> or \c complex<double> element type. The attempt to call the function with
 // matrices of any other element type or with a sparse matrix results in a compile time error!
 //
-// \note The function is depending on LAPACK kernels. Thus the function can only be used if the
-// fitting LAPACK library is available and linked to the executable. Otherwise a linker error
-// will be created.
+// \note In case the BLAS mode is enabled (see the \c BLAZE_BLAS_MODE switch), the function is
+// depending on LAPACK kernels. Thus the function can only be used if the fitting LAPACK library
+// is available and linked to the executable. Otherwise a linker error will be created. In case
+// the BLAS mode is disabled, the determinant is computed by a native blocked LU decomposition.
 //
 //
 // \n \subsection matrix_operations_swap swap()
@@ -3653,9 +3887,11 @@
 // \c complex<float> or \c complex<double> element type. The attempt to call the function with
 // matrices of any other element type or with a sparse matrix results in a compile time error!
 //
-// \note The functions invert the dense matrix by means of LAPACK kernels. Thus the functions can
-// only be used if the fitting LAPACK library is available and linked to the executable. Otherwise
-// a linker error will be created.
+// \note In case the BLAS mode is enabled (see the \c BLAZE_BLAS_MODE switch), the functions
+// invert the dense matrix by means of LAPACK kernels. Thus the functions can only be used if the
+// fitting LAPACK library is available and linked to the executable. Otherwise a linker error will
+// be created. In case the BLAS mode is disabled, the inversion is computed by native blocked LU
+// and Cholesky kernels.
 //
 // \note It is not possible to use any kind of view on the expression object returned by the
 // \c inv() function. Also, it is not possible to access individual elements via the function call
@@ -3679,7 +3915,9 @@
 //
 // \note The functions decompose a dense matrix by means of LAPACK kernels. Thus the functions can
 // only be used if the fitting LAPACK library is available and linked to the executable. Otherwise
-// a linker error will be created.
+// a linker error will be created. The only exception are the LU, the Cholesky, and the QR
+// decomposition, which are computed by native blocked kernels in case the BLAS mode is disabled
+// (see the \c BLAZE_BLAS_MODE switch).
 //
 // \subsection matrix_operations_decomposition_lu LU Decomposition
 //
@@ -3888,6 +4126,62 @@
    lq( A, L, Q );  // LQ decomposition of A
    \endcode
 
+// \n \section matrix_operations_iterative_solvers Iterative Solvers
+// <hr>
+//
+// Large, sparse systems of linear equations can be solved by means of the iterative solvers
+// \c cg() (conjugate gradient method for symmetric/Hermitian positive definite systems),
+// \c bicgstab() (stabilized bi-conjugate gradient method) and \c gmres() (restarted generalized
+// minimal residual method). The solvers can be included via the header file
+
+   \code
+   #include <blaze/math/Solvers.h>
+   \endcode
+
+// All solvers take the system matrix, the solution vector (containing the initial guess) and
+// the right-hand side vector, optionally a preconditioner, and a blaze::SolverControl object
+// specifying the relative tolerance, the maximum number of iterations and (for \c gmres()) the
+// restart length. They return a blaze::SolverResult containing the number of iterations, the
+// final relative residual and whether the solver converged:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   const blaze::SolverControl control( 1E-10, 1000UL );  // Tolerance and maximum iterations
+
+   blaze::SolverResult res1 = cg( A, x, b, control );
+   blaze::SolverResult res2 = bicgstab( A, x, b, blaze::JacobiPreconditioner<double>( A ), control );
+   blaze::SolverResult res3 = gmres( A, x, b, blaze::SolverControl( 1E-10, 1000UL, 30UL ) );
+
+   if( !res1.converged ) { ... }
+   \endcode
+
+// Instead of a matrix, any function object that computes \f$ y = A \cdot x \f$ via a call
+// \c op(x,y) with two \c DynamicVector arguments can be used as system operator (matrix-free
+// solution). In the same way, any function object that computes \f$ z = M^{-1} \cdot r \f$ via a
+// call \c M(r,z) can be used as preconditioner. Apart from that \b Blaze provides the
+// blaze::IdentityPreconditioner and the diagonal blaze::JacobiPreconditioner.
+//
+// The vector updates, dot products and norms of each iteration are fused into a few parallel
+// passes over the vectors, and for row-major sparse matrices the matrix/vector multiplication is
+// fused with the subsequent dot product. Therefore the solvers are mostly limited by the memory
+// bandwidth required to stream the system matrix.
+//
+// Bi-orthogonal methods as for instance BiCG, QMR or the Lanczos bidiagonalization require both
+// \f$ A \cdot x \f$ and \f$ A^T \cdot w \f$ in every iteration. For DynamicMatrix and
+// CompressedMatrix the \c multiplyBoth() function computes both products in a single traversal
+// of the matrix:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, w, y, z;
+   // ... Resizing and initialization
+
+   multiplyBoth( A, x, w, y, z );  // Equivalent to y = A * x; z = trans( A ) * w;
+   \endcode
+
 // \n Previous: \ref matrix_types &nbsp; &nbsp; Next: \ref adaptors
 */
 //*************************************************************************************************
@@ -4478,6 +4772,31 @@
 // this also works for column views on row-major matrices, where \b Blaze can use the according
 // row instead of a column in order to provide maximum performance.
 //
+// \n \subsection adaptors_symmetric_matrices_packed_storage Positive Impact: Packed Storage
+//
+// A symmetric matrix based on a DynamicMatrix stores both triangles of the matrix. For large
+// matrices this can be avoided by means of the PackedMatrix class template, which only stores
+// the \f$ N \cdot (N+1) / 2 \f$ elements of a single triangle:
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::SymmetricMatrix;
+   using blaze::LowerMatrix;
+   using blaze::rowMajor;
+   using blaze::packedSymmetric;
+   using blaze::packedLower;
+
+   SymmetricMatrix< PackedMatrix<double,rowMajor,packedSymmetric> > A( 30000UL );  // 3.6 GB instead of 7.2 GB
+   LowerMatrix< PackedMatrix<double,rowMajor,packedLower> > L( 1000UL );
+   \endcode
+
+// The element access works exactly as for any other symmetric matrix, i.e. an access to an
+// element of the non-stored triangle refers to the according element of the stored triangle.
+// Matrix/vector and matrix/matrix multiplications with a packed matrix only read the stored
+// triangle, which in case of symmetric and Hermitian matrices halves the memory traffic. The
+// same packed storage is available for HermitianMatrix (\c blaze::packedHermitian) and for
+// UpperMatrix (\c blaze::packedUpper).
+//
 // \n \subsection adaptors_symmetric_matrices_assignment Negative Impact: Assignment of a General Matrix
 //
 // In contrast to using a symmetric matrix on the right-hand side of an assignment (i.e. for read
@@ -6081,6 +6400,7 @@
 //  - \ref views_submatrices
 //  - \ref views_rows
 //  - \ref views_columns
+//  - \ref views_bands
 //
 //
 // \n \section views_examples Examples
@@ -7556,7 +7876,76 @@
 // Although \b Blaze performs the resulting matrix/vector multiplication as efficiently as possible
 // using a column-major storage order for matrix B would result in a more efficient evaluation.
 //
-// \n Previous: \ref views_rows &nbsp; &nbsp; Next: \ref arithmetic_operations
+// \n Previous: \ref views_rows &nbsp; &nbsp; Next: \ref views_bands
+*/
+//*************************************************************************************************
+
+
+//**Bands******************************************************************************************
+/*!\page views_bands Bands
+//
+// \tableofcontents
+//
+//
+// Bands provide views on a specific diagonal of a dense matrix. The band index \f$ k \f$ selects
+// the main diagonal (\f$ k = 0 \f$), the \f$ k \f$-th superdiagonal (\f$ k > 0 \f$) or the
+// \f$ |k| \f$-th subdiagonal (\f$ k < 0 \f$). A band acts as a reference to the elements
+// \f$ a_{i,i+k} \f$ of the matrix and can be used as any other dense column vector, i.e. it can
+// be assigned to, it can be copied from, and it can be used in arithmetic operations.
+//
+//
+// \n \section views_bands_class The Band Class Template
+// <hr>
+//
+// The blaze::Band class template represents a reference to a specific band of a dense matrix
+// primitive. It can be included via the header file
+
+   \code
+   #include <blaze/math/Band.h>
+   \endcode
+
+// The type of the matrix is specified via template parameter:
+
+   \code
+   template< typename MT >
+   class Band;
+   \endcode
+
+// \c MT specifies the type of the dense matrix primitive. Band can be used with every dense
+// matrix primitive, but does not work with any matrix expression type.
+//
+//
+// \n \section views_bands_setup Setup of Bands
+// <hr>
+//
+// A reference to a band of a dense matrix can be created very conveniently via the \c band()
+// function. In case the band does not exist in the given matrix, a \c std::invalid_argument
+// exception is thrown:
+
+   \code
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>  DenseMatrixType;
+
+   DenseMatrixType A( 6UL, 4UL );
+   blaze::DynamicVector<double,blaze::columnVector> x( 4UL );
+   // ... Resizing and initialization
+
+   // Setting the main diagonal of A to x
+   blaze::Band<DenseMatrixType> diag = band( A, 0L );
+   diag = x;
+
+   // Adding the main diagonal of A to the second subdiagonal of A
+   band( A, -2L ) += diag;
+
+   // Scaling the first superdiagonal of A
+   band( A, 1L ) *= 2.0;
+   \endcode
+
+// Since the elements of a band are not adjacent in memory, all band operations are performed
+// element by element. In case of a blaze::BandMatrix, assigning non-zero values to a band
+// outside of the stored bandwidth results in a \c std::invalid_argument exception. The same
+// holds for bands on the zero triangle of lower and upper triangular matrices.
+//
+// \n Previous: \ref views_columns &nbsp; &nbsp; Next: \ref arithmetic_operations
 */
 //*************************************************************************************************
 
@@ -7586,7 +7975,7 @@
 //    <li> \ref matrix_matrix_multiplication </li>
 // </ul>
 //
-// \n Previous: \ref views_columns &nbsp; &nbsp; Next: \ref addition
+// \n Previous: \ref views_bands &nbsp; &nbsp; Next: \ref addition
 */
 //*************************************************************************************************
 
@@ -7988,6 +8377,63 @@
 // are possible. Note however that the highest performance for a multiplication between two dense
 // matrices can be expected for two matrices with the same scalar element type.
 //
+// \n \section matrix_chain_multiplication Multiplication Chains
+// <hr>
+//
+// The cost of a product of three or more matrices strongly depends on the order in which the
+// individual multiplications are performed. For that reason \b Blaze does not evaluate a chain
+// of matrix multiplications strictly from left to right, but determines the cheapest evaluation
+// order at the time of the evaluation, based on the actual sizes of the matrices and the number
+// of non-zero elements of sparse matrices:
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+
+   DynamicMatrix<double> A( 10UL, 2000UL ), B( 2000UL, 5UL ), C( 5UL, 3000UL );
+   DynamicVector<double> x( 3000UL );
+
+   // ... Initialization of the matrices and the vector
+
+   DynamicMatrix<double> D = A * B * C;      // Evaluated as (A*B)*C
+   DynamicVector<double> y = A * B * C * x;  // Evaluated as A*(B*(C*x))
+   \endcode
+
+// Products with a vector are always evaluated as a sequence of matrix/vector multiplications.
+// The temporary matrices required for the intermediate results of a multiplication chain are
+// reused between subsequent evaluations within the same thread.
+//
+// \n \section schur_product Schur Product
+// <hr>
+//
+// Two matrices of the same size can be multiplied elementwise via the Schur product (also known
+// as Hadamard product). The Schur product between two matrices \f$ A \f$ and \f$ B \f$ is
+// defined as \f$ (A \circ B)_{ij} = a_{ij} b_{ij} \f$. Since the multiplication operator is
+// already used for the matrix/matrix multiplication, the Schur product is realized via the
+// \c schur() function. Alternatively, the modulo operator (i.e. \c operator%) can be used in
+// case infix notation is required:
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::CompressedMatrix;
+
+   DynamicMatrix<double,rowMajor>       M1( 28UL, 35UL );
+   DynamicMatrix<double,columnMajor>    M2( 28UL, 35UL );
+   CompressedMatrix<double,columnMajor> M3( 28UL, 35UL );
+
+   // ... Initialization of the matrices
+
+   DynamicMatrix<double>    M4 = schur( M1, M2 );  // Schur product of two dense matrices
+   CompressedMatrix<double> M5 = M1 % M3;          // Schur product of a dense and a sparse matrix
+   \endcode
+
+// Again, all combinations of dense and sparse matrices and storage orders are possible. The
+// Schur product of two dense matrices is vectorized and parallelized. In case at least one of
+// the two operands is a sparse matrix, the result is a sparse matrix: only the positions of the
+// non-zero elements of the sparse operand(s) are evaluated, i.e. for two sparse matrices only the
+// intersection of the two sparsity patterns is computed. Note that the matrix sizes must match,
+// else a \a std::invalid_argument exception is thrown.
+//
 // \n Previous: \ref matrix_vector_multiplication &nbsp; &nbsp; Next: \ref custom_operations
 */
 //*************************************************************************************************
@@ -8179,6 +8625,11 @@
 //
 //  - \ref serial_execution
 //
+// Note that in case of sparse matrix targets only plain assignments (as for instance \c C = A * B)
+// are executed in parallel. Addition and subtraction assignments to sparse matrices (as for
+// instance \c C += A * B) are always executed serially, since they change the number of non-zero
+// elements of the rows/columns of the target matrix.
+//
 // \n Previous: \ref custom_operations &nbsp; &nbsp; Next: \ref openmp_parallelization
 */
 //*************************************************************************************************
@@ -8313,6 +8764,23 @@
 // order to achieve the maximum possible performance, it is imperative to initialize the memory
 // according to the later use of the data structures.
 //
+// Alternatively, \b Blaze can perform the parallel initialization of large dense vectors and
+// matrices automatically. In case the environment variable \c BLAZE_NUMA_POLICY is set to
+// \c first-touch (or in case the policy is selected via the \c setNumaPolicy() function), the
+// elements of every newly constructed \c DynamicVector and \c DynamicMatrix that is large
+// enough for a parallel assignment are initialized by the same threads and with the same
+// partitioning as a later parallel assignment:
+
+   \code
+   blaze::setNumaPolicy( blaze::NumaPolicy::firstTouch );
+
+   blaze::DynamicVector<double,columnVector> a( N ), b( N ), c( N ), d( N );
+   \endcode
+
+// The policy \c interleave distributes the pages of all large allocations round-robin across
+// all memory nodes instead (Linux only), \c none (the default) leaves the placement to the
+// operating system.
+//
 //
 // \n \section openmp_limitations Limitations of the OpenMP Parallelization
 // <hr>
@@ -8505,6 +8973,26 @@
 // the C++11 thread parallelization.
 //
 //
+// \n \section cpp_threads_affinity Thread Affinity
+// <hr>
+//
+// By default, the C++11 threads of \b Blaze are not bound to specific cores. On Linux systems,
+// the placement of the threads can be specified via the environment variable
+// \c BLAZE_THREAD_AFFINITY, which is evaluated once when the threads are created:
+
+   \code
+   export BLAZE_THREAD_AFFINITY=compact  // Fill the cores of one NUMA node after another
+   export BLAZE_THREAD_AFFINITY=scatter  // Distribute the threads round-robin across all nodes
+   export BLAZE_THREAD_AFFINITY=0,2,4-7  // Bind the threads to the given list of CPUs
+   \endcode
+
+// In both the \c compact and the \c scatter mode physical cores are used before their SMT
+// siblings. In combination with the \c first-touch NUMA policy (see \ref openmp_first_touch)
+// the memory of large dense vectors and matrices is distributed across the NUMA nodes of all
+// threads. The blazemark benchmark suite provides the \c -first-touch, \c -interleave, and
+// \c -no-numa command line options to compare the different placement policies.
+//
+//
 // \n \section cpp_threads_known_issues Known Issues
 // <hr>
 //
@@ -8890,6 +9378,77 @@
 // In case an error is encountered during (de-)serialization, a \c std::runtime_exception is
 // thrown.
 //
+// \n \section matrix_serialization_mmap Memory-Mapped Matrices
+//
+// For large matrices that are repeatedly loaded, the \c saveMappedMatrix() function stores a
+// matrix in a format that can be memory mapped instead of being deserialized. The elements of
+// a dense matrix are stored aligned and padded exactly like the elements of a \c DynamicMatrix,
+// which allows \c mmapMatrix() to return an aligned and padded \c CustomMatrix that directly
+// refers to the mapped file. Sparse matrices are stored in CSR format and can be mapped via
+// \c mmapCSRMatrix() as read-only \c MappedCSRMatrix:
+
+   \code
+   blaze::DynamicMatrix<double> D( 10000UL, 10000UL );
+   blaze::CompressedMatrix<double> S( 10000UL, 10000UL );
+   // ... Initialization
+
+   blaze::saveMappedMatrix( "dense.bmap", D );
+   blaze::saveMappedMatrix( "sparse.bmap", S );
+
+   // Mapping of both matrices without copying the elements
+   blaze::CustomMatrix<double,blaze::aligned,blaze::padded> A( blaze::mmapMatrix<double>( "dense.bmap" ) );
+   blaze::MappedCSRMatrix<double> B( blaze::mmapCSRMatrix<double>( "sparse.bmap" ) );
+
+   blaze::DynamicVector<double> x( 10000UL, 1.0 ), y;
+   y = A * x + B * x;
+   \endcode
+
+// The mapping stays valid as long as any copy of the returned matrix exists. Since the file is
+// mapped privately, modifications of a mapped dense matrix are not written back to the file.
+// \c mmapCSRMatrix() verifies the row offsets and column indices of the mapped matrix and
+// throws a \c std::invalid_argument exception in case they don't form a valid CSR matrix. For
+// trusted files this verification, which touches all mapped offsets and indices, can be
+// skipped via <tt>mmapCSRMatrix<double>( "sparse.bmap", false )</tt>.
+// Note that in contrast to archives, mapped files are stored in the native byte order of the
+// machine and are therefore not portable between platforms of different endianness.
+//
+// \n \section matrix_serialization_row_blocks Streaming Sparse Matrices in Row Blocks
+//
+// The matrix serialization requires the complete matrix to be held in memory. Sparse matrices
+// that are too large for this can be written in row blocks via the \c RowBlockWriter, which
+// only requires a single block of rows at a time. The \c RowBlockReader reads the stream
+// block by block, skips blocks that are not needed, and provides each block as read-only
+// \c MappedCSRMatrix:
+
+   \code
+   using ArchiveType = blaze::Archive<std::fstream>;
+
+   // Writing a large sparse matrix in blocks of 10000 rows
+   {
+      ArchiveType archive( "matrix.blaze", std::ios::out | std::ios::binary );
+      blaze::RowBlockWriter<ArchiveType,double> writer( archive, 1000000UL, 1000000UL );
+
+      for( size_t i=0UL; i<1000000UL; i+=10000UL ) {
+         blaze::CompressedMatrix<double> block( 10000UL, 1000000UL );
+         // ... Initialization of the rows i to i+9999
+         writer.write( block );
+      }
+   }
+
+   // Computing y = A * x block by block directly from the file
+   {
+      ArchiveType archive( "matrix.blaze", std::ios::in | std::ios::binary );
+      blaze::RowBlockReader<ArchiveType,double> reader( archive );
+
+      blaze::DynamicVector<double> x( reader.columns(), 1.0 ), y;
+      blaze::multiplyRowBlocks( reader, x, y );
+   }
+   \endcode
+
+// Alternatively, a complete in-memory matrix can be written via \c serializeRowBlocks() and a
+// range of rows can be reconstituted via \c deserializeRows(). Note that row block streams can
+// only be read via a \c RowBlockReader, not via the \c >> operator of an archive.
+//
 // \n Previous: \ref vector_serialization &nbsp; &nbsp; Next: \ref blas_functions \n
 */
 //*************************************************************************************************
@@ -10367,14 +10926,33 @@
    constexpr size_t cacheSize = 3145728UL;
    \endcode
 
+// By default, the sizes of the L1, L2, and L3 caches are additionally detected at runtime and
+// the block sizes of the blocked kernels as well as the size limit for the use of non-temporal
+// stores are derived from the detected cache hierarchy. The \c cacheSize value is only used in
+// case the cache hierarchy cannot be determined. The detected cache hierarchy can be queried
+// via the \c cacheHierarchy() function:
+
+   \code
+   const blaze::CacheHierarchy& caches( blaze::cacheHierarchy() );
+   std::cout << "L2 cache size: " << caches.l2Size << " Byte\n";
+   \endcode
+
+// In order to use the compile time settings only (for instance to achieve reproducible timings
+// on different machines), the runtime detection can be disabled via the compilation switch in
+// the <tt>./blaze/config/CacheSize.h</tt> configuration file:
+
+   \code
+   #define BLAZE_USE_CACHE_DETECTION 0
+   \endcode
+
 // \n \section vectorization Vectorization
 // <hr>
 //
 // In order to achieve maximum performance and to exploit the compute power of a target platform
-// the \b Blaze library attempts to vectorize all linear algebra operations by SSE, AVX, and/or
-// MIC intrinsics, depending on which instruction set is available. However, it is possible to
-// disable the vectorization entirely by the compile time switch in the configuration file
-// <tt>./blaze/config/Vectorization.h</tt>:
+// the \b Blaze library attempts to vectorize all linear algebra operations by SSE, AVX, AVX-512,
+// and/or MIC intrinsics, depending on which instruction set is available. However, it is
+// possible to disable the vectorization entirely by the compile time switch in the configuration
+// file <tt>./blaze/config/Vectorization.h</tt>:
 
    \code
    #define BLAZE_USE_VECTORIZATION 1
@@ -10386,6 +10964,36 @@
 // the operations. Note that deactivating the vectorization may pose a severe performance
 // limitation for a large number of operations!
 //
+// The instruction set of all vectorized operations is chosen at compile time (e.g. via the
+// \c -march flag). Additionally, the runtime dispatch of the most performance critical kernels
+// is enabled by default, such that binaries that are built for a conservative baseline (as for
+// instance SSE2 on x86-64) can still take advantage of more powerful instruction sets. The
+// runtime dispatch is controlled by the following compile time switch:
+
+   \code
+   #define BLAZE_USE_RUNTIME_DISPATCH 1
+   \endcode
+
+// In case the switch is set to 1 (the default) and the compiler supports function multiversioning (GCC 5 and
+// later or Clang), the most performance critical kernels (i.e. the dense matrix multiplication
+// micro-kernel, the row-major dense matrix/dense vector multiplication, the reductions of dense
+// vectors and the sparse matrix/dense vector multiplication of a \c CompactMatrix) are compiled
+// additionally for AVX2 and AVX-512 and the fastest version is selected based on the CPU the
+// program is running on. The detected instruction set can be queried via the \c activeISA()
+// function and can be restricted via the \c BLAZE_ISA environment variable (for instance
+// \c BLAZE_ISA=avx2 or \c BLAZE_ISA=sse2):
+
+   \code
+   std::cout << "Active instruction set: " << blaze::activeISA() << "\n";
+   \endcode
+
+// Valid values of \c BLAZE_ISA are \c generic, \c sse2, \c sse3, \c ssse3, \c sse4, \c avx,
+// \c avx2, and \c avx512f. For any other value a warning is printed to the standard error stream
+// and the most powerful instruction set supported by the CPU is used. In case the switch is set
+// to 0, the instruction set is exclusively determined at compile time. Note that the runtime
+// dispatch only affects the listed kernels; all other operations are vectorized according to the
+// compile time instruction set.
+//
 //
 // \n \section thresholds Thresholds
 // <hr>
@@ -10404,6 +11012,41 @@
 // thread-based parallelization, are contained within the configuration file
 // <tt>./blaze/config/Thresholds.h</tt>.
 //
+// By default, all thresholds are compile time constants. Since the optimal values strongly depend
+// on the target machine, \b Blaze optionally allows to configure the thresholds at runtime. For
+// that purpose the runtime thresholds have to be activated in <tt>./blaze/config/Thresholds.h</tt>:
+
+   \code
+   #define BLAZE_USE_RUNTIME_THRESHOLDS 1
+   \endcode
+
+// In this case the values in the configuration file merely serve as defaults. Individual thresholds
+// can be overridden via environment variables, where the name of the variable corresponds to the
+// name of the threshold without the \c _THRESHOLD suffix and with a \c BLAZE_THRESHOLD_ prefix:
+
+   \code
+   export BLAZE_THRESHOLD_SMP_DVECASSIGN=50000
+   export BLAZE_THRESHOLD_SMP_DMATDVECMULT=600
+   \endcode
+
+// Alternatively, all thresholds can be specified in a threshold profile, i.e. a text file with one
+// <tt>NAME = VALUE</tt> setting per line, which is selected via the \c BLAZE_THRESHOLD_PROFILE
+// environment variable or loaded via the blaze::loadThresholdProfile() function. The \c autotune
+// binary of the \b Blaze benchmark suite determines the crossover points of the most important
+// thresholds on the current machine and writes them to such a profile:
+
+   \code
+   ./bin/autotune -o machine.prf
+   export BLAZE_THRESHOLD_PROFILE=machine.prf
+   \endcode
+
+// Additionally, single thresholds can be changed programmatically via the blaze::setThreshold()
+// and blaze::resetThreshold() functions:
+
+   \code
+   blaze::setThreshold( blaze::ThresholdID::SMP_DVECASSIGN, 50000UL );
+   \endcode
+
 //
 // \n \section padding Padding
 // <hr>
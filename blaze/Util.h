@@ -61,11 +61,14 @@
 #include <blaze/util/Limits.h>
 #include <blaze/util/Logging.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/MemoryMap.h>
 #include <blaze/util/MemoryPool.h>
 #include <blaze/util/MPL.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/NonCreatable.h>
 #include <blaze/util/NullType.h>
+#include <blaze/util/NUMA.h>
+#include <blaze/util/NumaPolicy.h>
 #include <blaze/util/PointerCast.h>
 #include <blaze/util/Policies.h>
 #include <blaze/util/PtrIterator.h>
@@ -86,5 +89,6 @@
 #include <blaze/util/TypeTraits.h>
 #include <blaze/util/UnsignedValue.h>
 #include <blaze/util/ValueTraits.h>
+#include <blaze/util/WorkStealingPool.h>
 
 #endif
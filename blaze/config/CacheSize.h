@@ -48,4 +48,34 @@ namespace blaze {
 constexpr size_t cacheSize = 3145728UL;
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime detection of the cache hierarchy.
+// \ingroup config
+//
+// This compilation switch enables/disables the detection of the cache hierarchy of the CPU at
+// runtime. In case the switch is set to 1, the sizes of the L1, L2, and L3 caches and the size
+// of a cache line are queried on first use (via the Linux sysfs interface or the \c cpuid
+// instruction) and the block sizes of the blocked kernels as well as the size limit for the
+// use of non-temporal stores are derived from the detected cache sizes. In case the switch is
+// set to 0 or in case the cache hierarchy cannot be determined, the compile time settings of
+// the \a cacheSize value and of the <tt>./blaze/system/Blocking.h</tt> header file are used.
+
+   \code
+   #define BLAZE_USE_CACHE_DETECTION 1
+   \endcode
+
+// Note that it is possible to (de-)activate the cache detection via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_CACHE_DETECTION 0
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_CACHE_DETECTION
+#define BLAZE_USE_CACHE_DETECTION 1
+#endif
+//*************************************************************************************************
+
 } // namespace blaze
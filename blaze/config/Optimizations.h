@@ -84,4 +84,19 @@ constexpr bool useStreaming = true;
 constexpr bool useOptimizedKernels = true;
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Configuration switch for the packed dense matrix multiplication kernels.
+// \ingroup config
+//
+// This configuration switch enables/disables the packed dense matrix/dense matrix multiplication
+// kernels. In case the switch is set to \a true, large dense matrix multiplications that are not
+// relayed to a BLAS library are computed by copying cache-sized blocks of both operands into
+// contiguous, SIMD-friendly panels and by updating the target matrix by means of a register
+// blocked micro-kernel. In case the switch is set to \a false, the blocked default kernels are
+// used instead.
+*/
+constexpr bool usePackedKernels = true;
+//*************************************************************************************************
+
 } // namespace blaze
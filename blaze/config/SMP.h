@@ -51,4 +51,23 @@ namespace blaze {
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the selection of the thread pool of the thread-based backends
+// \ingroup config
+//
+// This compilation switch selects the thread pool used by the C++11 and Boost thread-based
+// parallelization. In case the switch is set to 0, the Blaze library uses the default ThreadPool,
+// which manages all tasks in a single, mutex protected queue. In case the switch is set to 1,
+// the Blaze library uses the WorkStealingPool, which manages the tasks in lock-free per-thread
+// deques and reduces the overhead of scheduling and synchronization for short parallel
+// operations. The switch has no effect on the OpenMP-based parallelization.
+//
+// Possible settings for the thread pool switch:
+//  - ThreadPool      : \b 0 (default)
+//  - WorkStealingPool: \b 1
+*/
+#define BLAZE_USE_WORK_STEALING_THREADPOOL 0
+//*************************************************************************************************
+
 } // namespace blaze
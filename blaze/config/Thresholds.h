@@ -35,6 +35,42 @@
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the (de-)activation of the runtime configurable thresholds.
+// \ingroup config
+//
+// This compilation switch enables/disables the runtime configuration of the thresholds. In case
+// the switch is set to 0 (i.e. the runtime thresholds are disabled), all thresholds are compile
+// time constants with the values specified in this file. In case the switch is set to 1 (i.e.
+// the runtime thresholds are enabled), the values specified in this file only serve as defaults
+// that can be overridden at runtime:
+//
+//  - via a threshold profile specified by the \c BLAZE_THRESHOLD_PROFILE environment variable
+//    (as for instance created by the \c autotune binary of the Blaze benchmark suite),
+//  - via individual \c BLAZE_THRESHOLD_* environment variables (as for instance
+//    \c BLAZE_THRESHOLD_SMP_DVECASSIGN=50000), which take precedence over the profile, or
+//  - via the blaze::loadThresholdProfile() and blaze::setThreshold() functions.
+//
+// Note that the runtime thresholds introduce a small overhead for every threshold check.
+//
+// Possible settings for the runtime threshold switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+*/
+#ifndef BLAZE_USE_RUNTIME_THRESHOLDS
+#define BLAZE_USE_RUNTIME_THRESHOLDS 0
+#endif
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  BLAS THRESHOLDS
@@ -897,6 +933,57 @@ constexpr size_t SMP_DMATTDMATSUB_USER_THRESHOLD = 30625UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP row-major dense matrix/row-major dense matrix Schur product threshold.
+// \ingroup config
+//
+// This threshold specifies when a row-major dense matrix/row-major dense matrix Schur product
+// can be executed in parallel. This threshold affects both Schur products between two row-major
+// matrices or two column-major dense matrices. In case the number of elements of the target
+// matrix is larger or equal to this threshold, the operation is executed in parallel. If the
+// number of elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 36100 (which corresponds to a matrix size of
+// \f$ 190 \times 190 \f$). In case the threshold is set to 0, the operation is unconditionally
+// executed in parallel.
+*/
+constexpr size_t SMP_DMATDMATSCHUR_USER_THRESHOLD = 36100UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP row-major dense matrix/column-major dense matrix Schur product threshold.
+// \ingroup config
+//
+// This threshold specifies when a row-major dense matrix/column-major dense matrix Schur product
+// can be executed in parallel. This threshold affects both Schur products between a row-major
+// matrix and a column-major matrix and a column-major matrix and a row-major matrix. In case
+// the number of elements of the target matrix is larger or equal to this threshold, the
+// operation is executed in parallel. If the number of elements is below this threshold the
+// operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 30625 (which corresponds to a matrix size of
+// \f$ 175 \times 175 \f$). In case the threshold is set to 0, the operation is unconditionally
+// executed in parallel.
+*/
+constexpr size_t SMP_DMATTDMATSCHUR_USER_THRESHOLD = 30625UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP dense matrix/scalar multiplication/division threshold.
 // \ingroup config
@@ -1305,6 +1392,117 @@ constexpr size_t SMP_TSMATTSMATMULT_USER_THRESHOLD = 22500UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/sparse matrix addition threshold.
+// \ingroup config
+//
+// This threshold specifies when a sparse matrix/sparse matrix addition can be executed in
+// parallel. In contrast to the dense matrix thresholds, this threshold refers to the number of
+// non-zero elements of the sparse matrix operands: In case the number of non-zero elements is
+// larger or equal to this threshold, the operation is executed in parallel. If the number of
+// non-zero elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 40000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+constexpr size_t SMP_SMATSMATADD_USER_THRESHOLD = 40000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/sparse matrix subtraction threshold.
+// \ingroup config
+//
+// This threshold specifies when a sparse matrix/sparse matrix subtraction can be executed in
+// parallel. In contrast to the dense matrix thresholds, this threshold refers to the number of
+// non-zero elements of the sparse matrix operands: In case the number of non-zero elements is
+// larger or equal to this threshold, the operation is executed in parallel. If the number of
+// non-zero elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 40000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+constexpr size_t SMP_SMATSMATSUB_USER_THRESHOLD = 40000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix Schur product threshold.
+// \ingroup config
+//
+// This threshold specifies when a Schur product with a sparse result (i.e. a dense matrix/sparse
+// matrix or a sparse matrix/sparse matrix Schur product) can be executed in parallel. In contrast
+// to the dense matrix thresholds, this threshold refers to the number of non-zero elements of the
+// sparse matrix operands: In case the number of non-zero elements is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of non-zero elements is below
+// this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 40000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+constexpr size_t SMP_SMATSMATSCHUR_USER_THRESHOLD = 40000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/scalar multiplication threshold.
+// \ingroup config
+//
+// This threshold specifies when a sparse matrix/scalar multiplication can be executed in
+// parallel. In contrast to the dense matrix thresholds, this threshold refers to the number of
+// non-zero elements of the sparse matrix operands: In case the number of non-zero elements is
+// larger or equal to this threshold, the operation is executed in parallel. If the number of
+// non-zero elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 60000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+constexpr size_t SMP_SMATSCALARMULT_USER_THRESHOLD = 60000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix transposition threshold.
+// \ingroup config
+//
+// This threshold specifies when the transposition of a sparse matrix can be executed in
+// parallel. In contrast to the dense matrix thresholds, this threshold refers to the number of
+// non-zero elements of the sparse matrix operands: In case the number of non-zero elements is
+// larger or equal to this threshold, the operation is executed in parallel. If the number of
+// non-zero elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 40000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+constexpr size_t SMP_SMATTRANS_USER_THRESHOLD = 40000UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP dense vector/dense vector outer product threshold.
 // \ingroup config
@@ -1328,4 +1526,73 @@ constexpr size_t SMP_TSMATTSMATMULT_USER_THRESHOLD = 22500UL;
 constexpr size_t SMP_DVECTDVECMULT_USER_THRESHOLD = 84100UL;
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the reduction of a dense vector (as for instance via the sum(),
+// min(), max(), or norm() functions) can be executed in parallel. In case the number of elements
+// of the dense vector is larger or equal to this threshold, the operation is executed in parallel.
+// If the number of elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+constexpr size_t SMP_DVECREDUCE_USER_THRESHOLD = 38000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the reduction of a dense matrix (as for instance via the sum(),
+// min(), max(), or norm() functions) can be executed in parallel. In case the number of elements
+// of the dense matrix is larger or equal to this threshold, the operation is executed in parallel.
+// If the number of elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 48400 (which corresponds to a matrix size of
+// \f$ 220 \times 220 \f$). In case the threshold is set to 0, the operation is unconditionally
+// executed in parallel.
+*/
+constexpr size_t SMP_DMATREDUCE_USER_THRESHOLD = 48400UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP small matrix batch threshold.
+// \ingroup config
+//
+// This threshold specifies when an operation on a batch of small matrices (as for instance the
+// batched multiplication, inversion, or decomposition of a StaticMatrixBatch) can be executed in
+// parallel. In case the number of matrices in the batch is larger or equal to this threshold, the
+// operation is executed in parallel. If the number of matrices is below this threshold the
+// operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 4096. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+constexpr size_t SMP_BATCH_USER_THRESHOLD = 4096UL;
+//*************************************************************************************************
+
 } // namespace blaze
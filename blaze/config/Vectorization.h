@@ -52,3 +52,26 @@
 */
 #define BLAZE_USE_VECTORIZATION 1
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for (de-)activation of the runtime dispatch of SIMD kernels.
+// \ingroup config
+//
+// This compilation switch enables/disables the runtime selection of the SIMD kernels for the
+// most performance critical operations. In case the switch is set to 1 (i.e. in case the
+// runtime dispatch is enabled), the Blaze library additionally compiles AVX2 and AVX-512F
+// versions of selected kernels (as for instance the micro-kernel of the dense matrix/dense
+// matrix multiplication) and picks the best version supported by the CPU at runtime. This
+// allows to ship a single binary, compiled for instance for SSE2, that still takes advantage
+// of the wider SIMD units of newer CPUs. In case the switch is set to 0 (i.e. the runtime
+// dispatch is disabled), the instruction set is exclusively determined at compile time. Note
+// that the runtime dispatch is only available for GCC and Clang on x86 platforms and has no
+// effect in case the code is already compiled for the AVX-512F instruction set.
+//
+// Possible settings for the runtime dispatch switch:
+//  - Deactivated: \b 0
+//  - Activated  : \b 1 (default)
+*/
+#define BLAZE_USE_RUNTIME_DISPATCH 1
+//*************************************************************************************************
@@ -0,0 +1,210 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/BandMatrix.h
+//  \brief Header file for the complete BandMatrix implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_BANDMATRIX_H_
+#define _BLAZE_MATH_BANDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/BandFactorization.h>
+#include <blaze/math/dense/BandMatrix.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RAND SPECIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Rand class template for BandMatrix.
+// \ingroup random
+//
+// This specialization of the Rand class creates random instances of BandMatrix. Only the
+// elements of the stored band are randomized.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+class Rand< BandMatrix<Type,SO> >
+{
+ public:
+   //**Generate functions**************************************************************************
+   /*!\name Generate functions */
+   //@{
+   inline const BandMatrix<Type,SO> generate( size_t m, size_t n, size_t kl, size_t ku ) const;
+
+   template< typename Arg >
+   inline const BandMatrix<Type,SO>
+      generate( size_t m, size_t n, size_t kl, size_t ku, const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Randomize functions*************************************************************************
+   /*!\name Randomize functions */
+   //@{
+   inline void randomize( BandMatrix<Type,SO>& matrix ) const;
+
+   template< typename Arg >
+   inline void randomize( BandMatrix<Type,SO>& matrix, const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random BandMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \param kl The lower bandwidth of the random matrix.
+// \param ku The upper bandwidth of the random matrix.
+// \return The generated random matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline const BandMatrix<Type,SO>
+   Rand< BandMatrix<Type,SO> >::generate( size_t m, size_t n, size_t kl, size_t ku ) const
+{
+   BandMatrix<Type,SO> matrix( m, n, kl, ku );
+   randomize( matrix );
+   return matrix;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random BandMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \param kl The lower bandwidth of the random matrix.
+// \param ku The upper bandwidth of the random matrix.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return The generated random matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename Arg >  // Min/max argument type
+inline const BandMatrix<Type,SO>
+   Rand< BandMatrix<Type,SO> >::generate( size_t m, size_t n, size_t kl, size_t ku,
+                                          const Arg& min, const Arg& max ) const
+{
+   BandMatrix<Type,SO> matrix( m, n, kl, ku );
+   randomize( matrix, min, max );
+   return matrix;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a BandMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void Rand< BandMatrix<Type,SO> >::randomize( BandMatrix<Type,SO>& matrix ) const
+{
+   const size_t m ( matrix.rows() );
+   const size_t n ( matrix.columns() );
+   const size_t kl( matrix.lowerBandwidth() );
+   const size_t ku( matrix.upperBandwidth() );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      const size_t jbegin( ( i > kl )?( i-kl ):( 0UL ) );
+      const size_t jend  ( ( i+ku+1UL < n )?( i+ku+1UL ):( n ) );
+      for( size_t j=jbegin; j<jend; ++j ) {
+         matrix(i,j) = rand<Type>();
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a BandMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename Arg >  // Min/max argument type
+inline void Rand< BandMatrix<Type,SO> >::randomize( BandMatrix<Type,SO>& matrix,
+                                                    const Arg& min, const Arg& max ) const
+{
+   const size_t m ( matrix.rows() );
+   const size_t n ( matrix.columns() );
+   const size_t kl( matrix.lowerBandwidth() );
+   const size_t ku( matrix.upperBandwidth() );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      const size_t jbegin( ( i > kl )?( i-kl ):( 0UL ) );
+      const size_t jend  ( ( i+ku+1UL < n )?( i+ku+1UL ):( n ) );
+      for( size_t j=jbegin; j<jend; ++j ) {
+         matrix(i,j) = rand<Type>( min, max );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
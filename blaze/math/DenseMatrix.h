@@ -49,14 +49,18 @@
 #include <blaze/math/dense/QR.h>
 #include <blaze/math/dense/RQ.h>
 #include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatChainMultExpr.h>
 #include <blaze/math/expressions/DMatDetExpr.h>
 #include <blaze/math/expressions/DMatDMatAddExpr.h>
 #include <blaze/math/expressions/DMatDMatMultExpr.h>
+#include <blaze/math/expressions/DMatDMatSchurExpr.h>
 #include <blaze/math/expressions/DMatDMatSubExpr.h>
 #include <blaze/math/expressions/DMatDVecMultExpr.h>
 #include <blaze/math/expressions/DMatEvalExpr.h>
 #include <blaze/math/expressions/DMatForEachExpr.h>
 #include <blaze/math/expressions/DMatInvExpr.h>
+#include <blaze/math/expressions/DMatNormExpr.h>
+#include <blaze/math/expressions/DMatReduceExpr.h>
 #include <blaze/math/expressions/DMatScalarDivExpr.h>
 #include <blaze/math/expressions/DMatScalarMultExpr.h>
 #include <blaze/math/expressions/DMatSerialExpr.h>
@@ -66,6 +70,7 @@
 #include <blaze/math/expressions/DMatSVecMultExpr.h>
 #include <blaze/math/expressions/DMatTDMatAddExpr.h>
 #include <blaze/math/expressions/DMatTDMatMultExpr.h>
+#include <blaze/math/expressions/DMatTDMatSchurExpr.h>
 #include <blaze/math/expressions/DMatTDMatSubExpr.h>
 #include <blaze/math/expressions/DMatTransExpr.h>
 #include <blaze/math/expressions/DMatTransposer.h>
@@ -96,6 +101,7 @@
 #include <blaze/math/Matrix.h>
 #include <blaze/math/smp/DenseMatrix.h>
 #include <blaze/math/smp/SparseMatrix.h>
+#include <blaze/math/views/Band.h>
 #include <blaze/math/views/Column.h>
 #include <blaze/math/views/Row.h>
 #include <blaze/math/views/Submatrix.h>
@@ -0,0 +1,217 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/PackedMatrix.h
+//  \brief Header file for the complete PackedMatrix implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_PACKEDMATRIX_H_
+#define _BLAZE_MATH_PACKEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/PackedMatrix.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/PackedStructure.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RAND SPECIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Rand class template for PackedMatrix.
+// \ingroup random
+//
+// This specialization of the Rand class creates random instances of PackedMatrix. Only the
+// elements of the stored triangle are randomized. The diagonal elements of a Hermitian matrix
+// are real.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+class Rand< PackedMatrix<Type,SO,PS> >
+{
+ public:
+   //**Generate functions**************************************************************************
+   /*!\name Generate functions */
+   //@{
+   inline const PackedMatrix<Type,SO,PS> generate( size_t n ) const;
+
+   template< typename Arg >
+   inline const PackedMatrix<Type,SO,PS> generate( size_t n, const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Randomize functions*************************************************************************
+   /*!\name Randomize functions */
+   //@{
+   inline void randomize( PackedMatrix<Type,SO,PS>& matrix ) const;
+
+   template< typename Arg >
+   inline void randomize( PackedMatrix<Type,SO,PS>& matrix, const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random PackedMatrix.
+//
+// \param n The number of rows and columns of the random matrix.
+// \return The generated random matrix.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline const PackedMatrix<Type,SO,PS>
+   Rand< PackedMatrix<Type,SO,PS> >::generate( size_t n ) const
+{
+   PackedMatrix<Type,SO,PS> matrix( n );
+   randomize( matrix );
+   return matrix;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random PackedMatrix.
+//
+// \param n The number of rows and columns of the random matrix.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return The generated random matrix.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename Arg >       // Min/max argument type
+inline const PackedMatrix<Type,SO,PS>
+   Rand< PackedMatrix<Type,SO,PS> >::generate( size_t n, const Arg& min, const Arg& max ) const
+{
+   PackedMatrix<Type,SO,PS> matrix( n );
+   randomize( matrix, min, max );
+   return matrix;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a PackedMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \return void
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline void Rand< PackedMatrix<Type,SO,PS> >::randomize( PackedMatrix<Type,SO,PS>& matrix ) const
+{
+   typedef UnderlyingBuiltin_<Type>  BT;
+
+   const size_t n( matrix.rows() );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         if( PS == packedUpper )
+            matrix(j,i) = rand<Type>();
+         else
+            matrix(i,j) = rand<Type>();
+      }
+      if( PS == packedHermitian )
+         matrix(i,i) = rand<BT>();
+      else
+         matrix(i,i) = rand<Type>();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a PackedMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return void
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename Arg >       // Min/max argument type
+inline void Rand< PackedMatrix<Type,SO,PS> >::randomize( PackedMatrix<Type,SO,PS>& matrix,
+                                                         const Arg& min, const Arg& max ) const
+{
+   typedef UnderlyingBuiltin_<Type>  BT;
+
+   const size_t n( matrix.rows() );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         if( PS == packedUpper )
+            matrix(j,i) = rand<Type>( min, max );
+         else
+            matrix(i,j) = rand<Type>( min, max );
+      }
+      if( PS == packedHermitian )
+         matrix(i,i) = rand<BT>( real( min ), real( max ) );
+      else
+         matrix(i,i) = rand<Type>( min, max );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
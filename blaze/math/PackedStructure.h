@@ -0,0 +1,77 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/PackedStructure.h
+//  \brief Header file for the packed storage structures
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_PACKEDSTRUCTURE_H_
+#define _BLAZE_MATH_PACKEDSTRUCTURE_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PACKED STORAGE STRUCTURES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Structure of a matrix in packed storage.
+// \ingroup math
+//
+// The PackedStructure enumeration specifies which structure a square matrix in packed storage
+// (see PackedMatrix) represents and thereby which \f$ N \cdot (N+1) / 2 \f$ elements are stored:
+
+//  - \a packedSymmetric: a symmetric matrix, of which only one triangle is stored
+//  - \a packedHermitian: a Hermitian matrix, of which only one triangle is stored
+//  - \a packedLower    : a lower triangular matrix, of which only the lower part is stored
+//  - \a packedUpper    : an upper triangular matrix, of which only the upper part is stored
+
+   \code
+   using blaze::rowMajor;
+   using blaze::packedLower;
+
+   blaze::PackedMatrix<double,rowMajor,packedLower> L( 100UL );
+   \endcode
+*/
+enum PackedStructure
+{
+   packedSymmetric = 0,  //!< Symmetric matrix in packed storage.
+   packedHermitian = 1,  //!< Hermitian matrix in packed storage.
+   packedLower     = 2,  //!< Lower triangular matrix in packed storage.
+   packedUpper     = 3   //!< Upper triangular matrix in packed storage.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
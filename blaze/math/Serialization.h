@@ -40,7 +40,9 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/serialization/MatrixMapping.h>
 #include <blaze/math/serialization/MatrixSerializer.h>
+#include <blaze/math/serialization/RowBlockSerializer.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
 #include <blaze/math/serialization/VectorSerializer.h>
 
@@ -41,20 +41,26 @@
 //*************************************************************************************************
 
 #include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatSMatSchurExpr.h>
 #include <blaze/math/expressions/DVecTSVecMultExpr.h>
+#include <blaze/math/expressions/SMatChainMultExpr.h>
 #include <blaze/math/expressions/SMatDVecMultExpr.h>
 #include <blaze/math/expressions/SMatEvalExpr.h>
 #include <blaze/math/expressions/SMatForEachExpr.h>
+#include <blaze/math/expressions/SMatNormExpr.h>
+#include <blaze/math/expressions/SMatReduceExpr.h>
 #include <blaze/math/expressions/SMatScalarDivExpr.h>
 #include <blaze/math/expressions/SMatScalarMultExpr.h>
 #include <blaze/math/expressions/SMatSerialExpr.h>
 #include <blaze/math/expressions/SMatSMatAddExpr.h>
 #include <blaze/math/expressions/SMatSMatMultExpr.h>
+#include <blaze/math/expressions/SMatSMatSchurExpr.h>
 #include <blaze/math/expressions/SMatSMatSubExpr.h>
 #include <blaze/math/expressions/SMatSVecMultExpr.h>
 #include <blaze/math/expressions/SMatTransExpr.h>
 #include <blaze/math/expressions/SMatTSMatAddExpr.h>
 #include <blaze/math/expressions/SMatTSMatMultExpr.h>
+#include <blaze/math/expressions/SMatTSMatSchurExpr.h>
 #include <blaze/math/expressions/SMatTSMatSubExpr.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/expressions/SVecTDVecMultExpr.h>
@@ -47,6 +47,8 @@
 #include <blaze/math/expressions/SVecDVecMultExpr.h>
 #include <blaze/math/expressions/SVecEvalExpr.h>
 #include <blaze/math/expressions/SVecForEachExpr.h>
+#include <blaze/math/expressions/SVecNormExpr.h>
+#include <blaze/math/expressions/SVecReduceExpr.h>
 #include <blaze/math/expressions/SVecScalarDivExpr.h>
 #include <blaze/math/expressions/SVecScalarMultExpr.h>
 #include <blaze/math/expressions/SVecSerialExpr.h>
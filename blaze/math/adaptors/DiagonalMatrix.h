@@ -1061,7 +1061,7 @@ struct IsRestricted< DiagonalMatrix<MT,SO,DF> > : public TrueType
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename MT, bool SO >
-struct HasConstDataAccess< DiagonalMatrix<MT,SO,true> > : public TrueType
+struct HasConstDataAccess< DiagonalMatrix<MT,SO,true> > : public BoolConstant< HasConstDataAccess<MT>::value >
 {};
 /*! \endcond */
 //*************************************************************************************************
@@ -761,7 +761,7 @@ struct IsRestricted< HermitianMatrix<MT,SO,DF> > : public TrueType
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename MT, bool SO >
-struct HasConstDataAccess< HermitianMatrix<MT,SO,true> > : public TrueType
+struct HasConstDataAccess< HermitianMatrix<MT,SO,true> > : public BoolConstant< HasConstDataAccess<MT>::value >
 {};
 /*! \endcond */
 //*************************************************************************************************
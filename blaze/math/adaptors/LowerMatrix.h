@@ -1043,7 +1043,7 @@ struct IsRestricted< LowerMatrix<MT,SO,DF> > : public TrueType
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename MT, bool SO >
-struct HasConstDataAccess< LowerMatrix<MT,SO,true> > : public TrueType
+struct HasConstDataAccess< LowerMatrix<MT,SO,true> > : public BoolConstant< HasConstDataAccess<MT>::value >
 {};
 /*! \endcond */
 //*************************************************************************************************
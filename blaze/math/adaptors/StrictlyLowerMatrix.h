@@ -980,7 +980,7 @@ struct IsRestricted< StrictlyLowerMatrix<MT,SO,DF> > : public TrueType
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename MT, bool SO >
-struct HasConstDataAccess< StrictlyLowerMatrix<MT,SO,true> > : public TrueType
+struct HasConstDataAccess< StrictlyLowerMatrix<MT,SO,true> > : public BoolConstant< HasConstDataAccess<MT>::value >
 {};
 /*! \endcond */
 //*************************************************************************************************
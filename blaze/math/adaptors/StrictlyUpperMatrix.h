@@ -981,7 +981,7 @@ struct IsRestricted< StrictlyUpperMatrix<MT,SO,DF> > : public TrueType
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename MT, bool SO >
-struct HasConstDataAccess< StrictlyUpperMatrix<MT,SO,true> > : public TrueType
+struct HasConstDataAccess< StrictlyUpperMatrix<MT,SO,true> > : public BoolConstant< HasConstDataAccess<MT>::value >
 {};
 /*! \endcond */
 //*************************************************************************************************
@@ -557,7 +557,7 @@ struct IsRestricted< SymmetricMatrix<MT,SO,DF,NF> > : public TrueType
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename MT, bool SO, bool NF >
-struct HasConstDataAccess< SymmetricMatrix<MT,SO,true,NF> > : public TrueType
+struct HasConstDataAccess< SymmetricMatrix<MT,SO,true,NF> > : public BoolConstant< HasConstDataAccess<MT>::value >
 {};
 /*! \endcond */
 //*************************************************************************************************
@@ -1609,7 +1609,7 @@ struct IsRestricted< UniLowerMatrix<MT,SO,DF> > : public TrueType
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename MT, bool SO >
-struct HasConstDataAccess< UniLowerMatrix<MT,SO,true> > : public TrueType
+struct HasConstDataAccess< UniLowerMatrix<MT,SO,true> > : public BoolConstant< HasConstDataAccess<MT>::value >
 {};
 /*! \endcond */
 //*************************************************************************************************
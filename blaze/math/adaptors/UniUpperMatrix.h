@@ -1610,7 +1610,7 @@ struct IsRestricted< UniUpperMatrix<MT,SO,DF> > : public TrueType
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename MT, bool SO >
-struct HasConstDataAccess< UniUpperMatrix<MT,SO,true> > : public TrueType
+struct HasConstDataAccess< UniUpperMatrix<MT,SO,true> > : public BoolConstant< HasConstDataAccess<MT>::value >
 {};
 /*! \endcond */
 //*************************************************************************************************
@@ -107,7 +107,7 @@ class LowerProxy : public Proxy< LowerProxy<MT>, ElementType_<MT> >
    //**Type definitions****************************************************************************
    typedef ElementType_<MT>              RepresentedType;  //!< Type of the represented matrix element.
    typedef AddReference_<ReferenceType>  RawReference;     //!< Reference-to-non-const to the represented element.
-   typedef const RepresentedType&        ConstReference;   //!< Reference-to-const to the represented element.
+   typedef ConstReference_<MT>           ConstReference;   //!< Reference-to-const to the represented element.
    //**********************************************************************************************
 
    //**Constructors********************************************************************************
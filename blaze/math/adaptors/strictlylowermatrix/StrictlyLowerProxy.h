@@ -109,7 +109,7 @@ class StrictlyLowerProxy : public Proxy< StrictlyLowerProxy<MT>, ElementType_<MT
    //**Type definitions****************************************************************************
    typedef ElementType_<MT>              RepresentedType;  //!< Type of the represented matrix element.
    typedef AddReference_<ReferenceType>  RawReference;     //!< Reference-to-non-const to the represented element.
-   typedef const RepresentedType&        ConstReference;   //!< Reference-to-const to the represented element.
+   typedef ConstReference_<MT>           ConstReference;   //!< Reference-to-const to the represented element.
    //**********************************************************************************************
 
    //**Constructors********************************************************************************
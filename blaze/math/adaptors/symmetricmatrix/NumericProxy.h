@@ -313,7 +313,7 @@ inline NumericProxy<MT>& NumericProxy<MT>::operator+=( const T& value )
 {
    matrix_(row_,column_) += value;
    if( row_ != column_ )
-      matrix_(column_,row_) += value;
+      matrix_(column_,row_) = matrix_(row_,column_);
 
    return *this;
 }
@@ -332,7 +332,7 @@ inline NumericProxy<MT>& NumericProxy<MT>::operator-=( const T& value )
 {
    matrix_(row_,column_) -= value;
    if( row_ != column_ )
-      matrix_(column_,row_) -= value;
+      matrix_(column_,row_) = matrix_(row_,column_);
 
    return *this;
 }
@@ -351,7 +351,7 @@ inline NumericProxy<MT>& NumericProxy<MT>::operator*=( const T& value )
 {
    matrix_(row_,column_) *= value;
    if( row_ != column_ )
-      matrix_(column_,row_) *= value;
+      matrix_(column_,row_) = matrix_(row_,column_);
 
    return *this;
 }
@@ -370,7 +370,7 @@ inline NumericProxy<MT>& NumericProxy<MT>::operator/=( const T& value )
 {
    matrix_(row_,column_) /= value;
    if( row_ != column_ )
-      matrix_(column_,row_) /= value;
+      matrix_(column_,row_) = matrix_(row_,column_);
 
    return *this;
 }
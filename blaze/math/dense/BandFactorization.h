@@ -0,0 +1,399 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BandFactorization.h
+//  \brief Header file for the native factorizations of band matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_BANDFACTORIZATION_H_
+#define _BLAZE_MATH_DENSE_BANDFACTORIZATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <boost/cast.hpp>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/BandMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE BAND MATRIX FACTORIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Native band matrix factorization functions */
+//@{
+template< typename Type, bool SO >
+void gbtrf( BandMatrix<Type,SO>& A, int* ipiv );
+
+template< typename Type, bool SO, typename VT >
+void gbtrs( const BandMatrix<Type,SO>& A, const int* ipiv, DenseVector<VT,false>& b );
+
+template< typename Type, bool SO >
+void pbtrf( BandMatrix<Type,SO>& A );
+
+template< typename Type, bool SO, typename VT >
+void pbtrs( const BandMatrix<Type,SO>& L, DenseVector<VT,false>& b );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Direct access to a stored element of a band matrix.
+// \ingroup band_matrix
+//
+// \param A The band matrix.
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return Reference to the stored element \f$ a_{ij} \f$.
+//
+// This function bypasses the access proxy of the band matrix. The element \f$ a_{ij} \f$ is
+// required to be part of the stored band.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline Type& bandElement( BandMatrix<Type,SO>& A, size_t i, size_t j ) noexcept
+{
+   return A.diagonal( ptrdiff_t( j ) - ptrdiff_t( i ) )[ SO ? j : i ];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Direct access to a stored element of a constant band matrix.
+// \ingroup band_matrix
+//
+// \param A The band matrix.
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return Reference-to-const to the stored element \f$ a_{ij} \f$.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline const Type& bandElement( const BandMatrix<Type,SO>& A, size_t i, size_t j ) noexcept
+{
+   return A.diagonal( ptrdiff_t( j ) - ptrdiff_t( i ) )[ SO ? j : i ];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native LU decomposition of the given band matrix.
+// \ingroup band_matrix
+//
+// \param A The band matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+//
+// This function computes the LU decomposition \f$ A = P \cdot L \cdot U \f$ of the given
+// \a m-by-\a n band matrix with \f$ k_l \f$ subdiagonals and \f$ k_u \f$ superdiagonals by
+// means of partial pivoting with row interchanges. As in the LAPACK gbtrf() functions, the
+// row interchanges can introduce \f$ k_l \f$ additional superdiagonals into \c U. Therefore
+// the upper bandwidth of \a A is extended to \f$ k_l+k_u \f$ before the decomposition. On
+// exit, \c U is stored in the upper part of the band and the multipliers of the unit lower
+// triangular matrix \c L are stored in the \f$ k_l \f$ subdiagonals. Row interchanges are
+// only applied to the columns of the active band, i.e. the multipliers are stored in the
+// order in which the interchanges took place. The pivot indices are stored 1-based and the
+// resulting factorization is intended to be used by the gbtrs() function. The function does
+// not fail for singular matrices, but the following solve results in a division by zero.
+
+   \code
+   blaze::BandMatrix<double,blaze::columnMajor> A( 100UL, 100UL, 2UL, 1UL );
+   blaze::DynamicVector<double> b( 100UL );
+   std::unique_ptr<int[]> ipiv( new int[100UL] );
+   // ... Initialization of A and b
+
+   gbtrf( A, ipiv.get() );       // A is overwritten by its LU decomposition
+   gbtrs( A, ipiv.get(), b );    // b is overwritten by the solution of A*x=b
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void gbtrf( BandMatrix<Type,SO>& A, int* ipiv )
+{
+   using boost::numeric_cast;
+   using std::swap;
+
+   typedef UnderlyingBuiltin_<Type>  BT;
+
+   const size_t m ( A.rows() );
+   const size_t n ( A.columns() );
+   const size_t kl( A.lowerBandwidth() );
+
+   A.resize( m, n, kl, kl+A.upperBandwidth() );
+
+   const size_t ku( A.upperBandwidth() );
+   const size_t mindim( min( m, n ) );
+
+   for( size_t j=0UL; j<mindim; ++j )
+   {
+      const size_t iend( min( m, j+kl+1UL ) );
+      const size_t lend( min( n, j+ku+1UL ) );
+
+      size_t pivot( j );
+      BT maximum( abs( bandElement( A, j, j ) ) );
+
+      for( size_t i=j+1UL; i<iend; ++i ) {
+         const BT tmp( abs( bandElement( A, i, j ) ) );
+         if( tmp > maximum ) {
+            maximum = tmp;
+            pivot   = i;
+         }
+      }
+
+      ipiv[j] = numeric_cast<int>( pivot+1UL );
+
+      if( pivot != j ) {
+         for( size_t l=j; l<lend; ++l ) {
+            swap( bandElement( A, j, l ), bandElement( A, pivot, l ) );
+         }
+      }
+
+      const Type diagonal( bandElement( A, j, j ) );
+
+      if( isDefault( diagonal ) )
+         continue;
+
+      for( size_t i=j+1UL; i<iend; ++i )
+      {
+         Type& lij( bandElement( A, i, j ) );
+         lij /= diagonal;
+
+         for( size_t l=j+1UL; l<lend; ++l ) {
+            bandElement( A, i, l ) -= lij * bandElement( A, j, l );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solution of a linear system based on the LU decomposition of a band matrix.
+// \ingroup band_matrix
+//
+// \param A The LU decomposition of the square band matrix as computed by gbtrf().
+// \param ipiv The pivot indices as computed by gbtrf().
+// \param b The right-hand side vector, which is overwritten by the solution.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+//
+// This function solves the linear system of equations \f$ A \cdot x = b \f$ based on the LU
+// decomposition of the band matrix \a A computed by the gbtrf() function. The forward and the
+// backward substitution only touch the elements of the band, i.e. the solution requires
+// \f$ O(n \cdot (2 k_l + k_u)) \f$ operations.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename VT >  // Type of the right-hand side vector
+void gbtrs( const BandMatrix<Type,SO>& A, const int* ipiv, DenseVector<VT,false>& b )
+{
+   using std::swap;
+
+   if( !isSquare( A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~b).size() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   const size_t n ( A.rows() );
+   const size_t kl( A.lowerBandwidth() );
+   const size_t ku( A.upperBandwidth() );
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      const size_t pivot( ipiv[j] - 1 );
+
+      if( pivot != j )
+         swap( (~b)[j], (~b)[pivot] );
+
+      const size_t iend( min( n, j+kl+1UL ) );
+
+      for( size_t i=j+1UL; i<iend; ++i ) {
+         (~b)[i] -= bandElement( A, i, j ) * (~b)[j];
+      }
+   }
+
+   for( size_t j=n; j-- > 0UL; )
+   {
+      (~b)[j] /= bandElement( A, j, j );
+
+      const size_t ibegin( ( j > ku )?( j-ku ):( 0UL ) );
+
+      for( size_t i=ibegin; i<j; ++i ) {
+         (~b)[i] -= bandElement( A, i, j ) * (~b)[j];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native Cholesky (LLH) decomposition of the given positive definite band matrix.
+// \ingroup band_matrix
+//
+// \param A The band matrix to be decomposed.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function computes the Cholesky decomposition \f$ A = L \cdot L^{H} \f$ of the given
+// Hermitian positive definite band matrix. Only the diagonal and the \f$ k_l \f$ subdiagonals
+// of \a A are accessed. Since the Cholesky factor does not introduce any fill-in outside of
+// the band, \a A is overwritten by the lower triangular band matrix \c L with \f$ k_l \f$
+// subdiagonals and without superdiagonals. The resulting factorization is intended to be used
+// by the pbtrs() function.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void pbtrf( BandMatrix<Type,SO>& A )
+{
+   typedef UnderlyingBuiltin_<Type>  BT;
+
+   if( !isSquare( A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n ( A.rows() );
+   const size_t kl( A.lowerBandwidth() );
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      const BT diagonal( real( bandElement( A, j, j ) ) );
+
+      if( !( diagonal > BT(0) ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Decomposition of non-positive-definite matrix failed" );
+      }
+
+      const BT ljj( sqrt( diagonal ) );
+      const size_t iend( min( n, j+kl+1UL ) );
+
+      bandElement( A, j, j ) = ljj;
+
+      for( size_t i=j+1UL; i<iend; ++i ) {
+         bandElement( A, i, j ) /= ljj;
+      }
+
+      for( size_t l=j+1UL; l<iend; ++l ) {
+         const Type tmp( conj( bandElement( A, l, j ) ) );
+         for( size_t i=l; i<iend; ++i ) {
+            bandElement( A, i, l ) -= bandElement( A, i, j ) * tmp;
+         }
+      }
+   }
+
+   A.resize( n, n, kl, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solution of a linear system based on the Cholesky decomposition of a band matrix.
+// \ingroup band_matrix
+//
+// \param L The Cholesky factor of the band matrix as computed by pbtrf().
+// \param b The right-hand side vector, which is overwritten by the solution.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+//
+// This function solves the linear system of equations \f$ A \cdot x = b \f$ based on the
+// Cholesky decomposition \f$ A = L \cdot L^{H} \f$ computed by the pbtrf() function by means
+// of a forward substitution with \c L and a backward substitution with \f$ L^{H} \f$. Only the
+// diagonal and the subdiagonals of \a L are accessed.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename VT >  // Type of the right-hand side vector
+void pbtrs( const BandMatrix<Type,SO>& L, DenseVector<VT,false>& b )
+{
+   if( !isSquare( L ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~b).size() != L.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   const size_t n ( L.rows() );
+   const size_t kl( L.lowerBandwidth() );
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      (~b)[j] /= bandElement( L, j, j );
+
+      const size_t iend( min( n, j+kl+1UL ) );
+
+      for( size_t i=j+1UL; i<iend; ++i ) {
+         (~b)[i] -= bandElement( L, i, j ) * (~b)[j];
+      }
+   }
+
+   for( size_t j=n; j-- > 0UL; )
+   {
+      const size_t iend( min( n, j+kl+1UL ) );
+
+      for( size_t i=j+1UL; i<iend; ++i ) {
+         (~b)[j] -= conj( bandElement( L, i, j ) ) * (~b)[i];
+      }
+
+      (~b)[j] /= conj( bandElement( L, j, j ) );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,868 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BandKernels.h
+//  \brief Header file for the band matrix kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BANDKERNELS_H_
+#define _BLAZE_MATH_DENSE_BANDKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsBanded.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LINE KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Helper structure for the selection of the vectorized band matrix line kernels.
+// \ingroup dense_matrix
+//
+// In case the given data type is suited for the vectorized line kernels, the nested \a value
+// is set to 1, otherwise it is 0.
+*/
+template< typename Type >  // Data type of the elements
+struct UseVectorizedBandKernel
+{
+   enum : bool { value = useOptimizedKernels &&
+                         IsVectorizable<Type>::value &&
+                         HasSIMDAdd<Type,Type>::value &&
+                         HasSIMDMult<Type,Type>::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default scaled addition of a section of a diagonal to a dense vector.
+// \ingroup dense_matrix
+//
+// \param y Pointer to the first element of the target section.
+// \param a Pointer to the first element of the diagonal section.
+// \param s The scaling factor.
+// \param n The number of elements of the section.
+// \return void
+//
+// This function computes \f$ y_i += a_i s \f$.
+*/
+template< typename Type >  // Data type of the elements
+inline DisableIf_< UseVectorizedBandKernel<Type> >
+   bandAxpy( Type* y, const Type* a, const Type& s, size_t n )
+{
+   for( size_t i=0UL; i<n; ++i ) {
+      y[i] += a[i] * s;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized scaled addition of a section of a diagonal to a dense vector.
+// \ingroup dense_matrix
+//
+// \param y Pointer to the first element of the target section.
+// \param a Pointer to the first element of the diagonal section.
+// \param s The scaling factor.
+// \param n The number of elements of the section.
+// \return void
+//
+// This function computes \f$ y_i += a_i s \f$. Since the diagonals of a band matrix are in
+// general not aligned relative to the target section, both sections are accessed via
+// unaligned loads and stores.
+*/
+template< typename Type >  // Data type of the elements
+inline EnableIf_< UseVectorizedBandKernel<Type> >
+   bandAxpy( Type* y, const Type* a, const Type& s, size_t n )
+{
+   typedef SIMDTrait_<Type>  SIMDType;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t ipos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ipos <= n, "Invalid end calculation" );
+
+   const SIMDType factor( set( s ) );
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE) < ipos; i+=2UL*SIMDSIZE ) {
+      storeu( y+i         , loadu( y+i          ) + loadu( a+i          ) * factor );
+      storeu( y+i+SIMDSIZE, loadu( y+i+SIMDSIZE ) + loadu( a+i+SIMDSIZE ) * factor );
+   }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      storeu( y+i, loadu( y+i ) + loadu( a+i ) * factor );
+   }
+   for( ; i<n; ++i ) {
+      y[i] += a[i] * s;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default scaled element-wise product of a diagonal section and a vector section.
+// \ingroup dense_matrix
+//
+// \param y Pointer to the first element of the target section.
+// \param a Pointer to the first element of the diagonal section.
+// \param b Pointer to the first element of the second section.
+// \param s The scaling factor.
+// \param n The number of elements of the sections.
+// \return void
+//
+// This function computes \f$ y_i += a_i b_i s \f$.
+*/
+template< typename Type >  // Data type of the elements
+inline DisableIf_< UseVectorizedBandKernel<Type> >
+   bandFma( Type* y, const Type* a, const Type* b, const Type& s, size_t n )
+{
+   for( size_t i=0UL; i<n; ++i ) {
+      y[i] += a[i] * b[i] * s;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized scaled element-wise product of a diagonal section and a vector section.
+// \ingroup dense_matrix
+//
+// \param y Pointer to the first element of the target section.
+// \param a Pointer to the first element of the diagonal section.
+// \param b Pointer to the first element of the second section.
+// \param s The scaling factor.
+// \param n The number of elements of the sections.
+// \return void
+//
+// This function computes \f$ y_i += a_i b_i s \f$ via unaligned loads and stores.
+*/
+template< typename Type >  // Data type of the elements
+inline EnableIf_< UseVectorizedBandKernel<Type> >
+   bandFma( Type* y, const Type* a, const Type* b, const Type& s, size_t n )
+{
+   typedef SIMDTrait_<Type>  SIMDType;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t ipos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ipos <= n, "Invalid end calculation" );
+
+   const SIMDType factor( set( s ) );
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE) < ipos; i+=2UL*SIMDSIZE ) {
+      storeu( y+i         , loadu( y+i          ) + loadu( a+i          ) * loadu( b+i          ) * factor );
+      storeu( y+i+SIMDSIZE, loadu( y+i+SIMDSIZE ) + loadu( a+i+SIMDSIZE ) * loadu( b+i+SIMDSIZE ) * factor );
+   }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      storeu( y+i, loadu( y+i ) + loadu( a+i ) * loadu( b+i ) * factor );
+   }
+   for( ; i<n; ++i ) {
+      y[i] += a[i] * b[i] * s;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIAGONAL KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Diagonal-wise multiplication of a band matrix with a dense vector.
+// \ingroup dense_matrix
+//
+// \param A The band matrix.
+// \param x Pointer to the first element of the right-hand side (or left-hand side) vector.
+// \param y Pointer to the first element of the target vector.
+// \param alpha The scaling factor.
+// \return void
+//
+// This function computes \f$ \vec{y}+=\alpha*A*\vec{x} \f$ (or \f$ \vec{y}^T+=\alpha*\vec{x}^T*A
+// \f$ in case \a Trans is \a true). Each diagonal \a k of \a A contributes the element-wise
+// product of the diagonal and a contiguous section of \a x, i.e. \f$ y_i += a_{i,i+k} x_{i+k}
+// \f$ (or \f$ y_{i+k} += a_{i,i+k} x_i \f$), which vectorizes independently of the storage
+// order of \a A.
+*/
+template< bool Trans         // Transposition flag
+        , bool SO            // Storage order of the band matrix
+        , typename MT        // Type of the band matrix
+        , typename Type >    // Data type of the elements
+void bmvDiagonals( const MT& A, const Type* x, Type* y, const Type& alpha )
+{
+   const ptrdiff_t m ( A.rows() );
+   const ptrdiff_t n ( A.columns() );
+   const ptrdiff_t kl( A.lowerBandwidth() );
+   const ptrdiff_t ku( A.upperBandwidth() );
+
+   for( ptrdiff_t k=-kl; k<=ku; ++k )
+   {
+      const ptrdiff_t ibegin( k < 0 ? -k : 0 );
+      const ptrdiff_t iend  ( m < n-k ? m : n-k );
+
+      if( ibegin >= iend ) continue;
+
+      const Type* a( A.diagonal( k ) + ( SO ? ibegin+k : ibegin ) );
+
+      if( Trans )
+         bandFma( y+ibegin+k, a, x+ibegin, alpha, iend-ibegin );
+      else
+         bandFma( y+ibegin, a, x+ibegin+k, alpha, iend-ibegin );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BAND MATRIX/DENSE VECTOR MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Diagonal-wise band matrix/vector multiplication for a contiguous vector operand.
+// \ingroup dense_matrix
+//
+// \param A The band matrix operand.
+// \param x The dense vector operand.
+// \param y Pointer to the first element of the target vector.
+// \param alpha The scaling factor for the multiplication.
+// \return void
+*/
+template< bool Trans     // Transposition flag
+        , typename MT1   // Type of the band matrix operand
+        , bool SO        // Storage order of the band matrix operand
+        , typename VT2   // Type of the dense vector operand
+        , bool TF        // Transpose flag of the dense vector operand
+        , typename ET >  // Element type
+inline void bmvOperand( const DenseMatrix<MT1,SO>& A, const DenseVector<VT2,TF>& x,
+                        ET* y, const ET& alpha, TrueType )
+{
+   bmvDiagonals<Trans,SO>( ~A, (~x).data(), y, alpha );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Diagonal-wise band matrix/vector multiplication for a non-contiguous vector operand.
+// \ingroup dense_matrix
+//
+// \param A The band matrix operand.
+// \param x The dense vector operand.
+// \param y Pointer to the first element of the target vector.
+// \param alpha The scaling factor for the multiplication.
+// \return void
+//
+// This overload handles vector operands without direct access to contiguous elements (as for
+// instance a transpose expression or a row of a column-major matrix). The operand is copied
+// into a temporary first, which requires \f$ O(N) \f$ additional operations only.
+*/
+template< bool Trans     // Transposition flag
+        , typename MT1   // Type of the band matrix operand
+        , bool SO        // Storage order of the band matrix operand
+        , typename VT2   // Type of the dense vector operand
+        , bool TF        // Transpose flag of the dense vector operand
+        , typename ET >  // Element type
+inline void bmvOperand( const DenseMatrix<MT1,SO>& A, const DenseVector<VT2,TF>& x,
+                        ET* y, const ET& alpha, FalseType )
+{
+   const DynamicVector<ET,TF> tmp( ~x );
+   bmvDiagonals<Trans,SO>( ~A, tmp.data(), y, alpha );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Band storage kernel for a dense matrix/dense vector multiplication
+//        (\f$ \vec{y}+=\alpha*A*\vec{x} \f$).
+// \ingroup dense_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side band matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \return void
+//
+// This function performs the multiplication of a band matrix (see BandMatrix) diagonal by
+// diagonal, such that only the \f$ (k_l+k_u+1) \cdot N \f$ stored elements are touched. Note
+// that the function expects \a y to be disjoint from both \a A and \a x.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename MT1   // Type of the left-hand side matrix operand
+        , bool SO        // Storage order of the left-hand side matrix operand
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scaling factor
+inline void bmv( DenseVector<VT1,false>& y, const DenseMatrix<MT1,SO>& A,
+                 const DenseVector<VT2,false>& x, ST alpha )
+{
+   typedef ElementType_<VT1>  ET;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT2 );
+
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT1 );
+
+   BLAZE_STATIC_ASSERT( IsBanded<MT1>::value );
+
+   BLAZE_INTERNAL_ASSERT( (~A).rows()    == (~y).size(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~x).size(), "Invalid vector size" );
+
+   bmvOperand<false>( ~A, ~x, (~y).data(), ET( alpha ),
+                      BoolConstant< HasConstDataAccess<VT2>::value && VT2::simdEnabled >() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Band storage kernel for a transpose dense vector/dense matrix multiplication
+//        (\f$ \vec{y}^T+=\alpha*\vec{x}^T*A \f$).
+// \ingroup dense_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param x The left-hand side dense vector operand.
+// \param A The right-hand side band matrix operand.
+// \param alpha The scaling factor for \f$ \vec{x}^T*A \f$.
+// \return void
+//
+// This function performs the multiplication diagonal by diagonal on the band storage of \a A.
+// Note that the function expects \a y to be disjoint from both \a A and \a x.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename VT2   // Type of the left-hand side vector operand
+        , typename MT1   // Type of the right-hand side matrix operand
+        , bool SO        // Storage order of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factor
+inline void bmv( DenseVector<VT1,true>& y, const DenseVector<VT2,true>& x,
+                 const DenseMatrix<MT1,SO>& A, ST alpha )
+{
+   typedef ElementType_<VT1>  ET;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT2 );
+
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT1 );
+
+   BLAZE_STATIC_ASSERT( IsBanded<MT1>::value );
+
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~y).size(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~A).rows()    == (~x).size(), "Invalid vector size" );
+
+   bmvOperand<true>( ~A, ~x, (~y).data(), ET( alpha ),
+                     BoolConstant< HasConstDataAccess<VT2>::value && VT2::simdEnabled >() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BAND MATRIX/DENSE MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Band storage kernel for the multiplication of two band matrices into a band matrix.
+// \ingroup dense_matrix
+//
+// \param C The target band matrix.
+// \param A The left-hand side band matrix operand.
+// \param B The right-hand side band matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// Each pair of diagonals \f$ d_a \f$ of \a A and \f$ d_b \f$ of \a B contributes the element-wise
+// product \f$ c_{i,i+d_a+d_b} += a_{i,i+d_a} b_{i+d_a,i+d_a+d_b} \f$ to the diagonal
+// \f$ d_a+d_b \f$ of \a C. All three sections are contiguous in the band storage, independent
+// of the storage orders of the three matrices.
+*/
+template< typename MT1   // Type of the target band matrix
+        , bool SO1       // Storage order of the target band matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ET >  // Type of the scaling factor
+void bmmBand( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+              const DenseMatrix<MT3,SO3>& B, const ET& alpha, TrueType )
+{
+   const ptrdiff_t m  ( (~A).rows() );
+   const ptrdiff_t l  ( (~A).columns() );
+   const ptrdiff_t n  ( (~B).columns() );
+   const ptrdiff_t kla( (~A).lowerBandwidth() );
+   const ptrdiff_t kua( (~A).upperBandwidth() );
+   const ptrdiff_t klb( (~B).lowerBandwidth() );
+   const ptrdiff_t kub( (~B).upperBandwidth() );
+
+   for( ptrdiff_t da=-kla; da<=kua; ++da ) {
+      for( ptrdiff_t db=-klb; db<=kub; ++db )
+      {
+         const ptrdiff_t d( da + db );
+
+         if( d < -ptrdiff_t( (~C).lowerBandwidth() ) || d > ptrdiff_t( (~C).upperBandwidth() ) )
+            continue;
+
+         ptrdiff_t ibegin( 0 );
+         if( -da > ibegin ) ibegin = -da;
+         if( -d  > ibegin ) ibegin = -d;
+
+         ptrdiff_t iend( m );
+         if( l-da < iend ) iend = l-da;
+         if( n-d  < iend ) iend = n-d;
+
+         if( ibegin >= iend ) continue;
+
+         bandFma( (~C).diagonal( d  ) + ( SO1 ? ibegin+d : ibegin    ),
+                  (~A).diagonal( da ) + ( SO2 ? ibegin+da : ibegin   ),
+                  (~B).diagonal( db ) + ( SO3 ? ibegin+d  : ibegin+da ),
+                  alpha, iend-ibegin );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Band storage kernel for the multiplication of two band matrices into a dense matrix.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side band matrix operand.
+// \param B The right-hand side band matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This overload handles targets in full storage. The diagonal products are accumulated along
+// the diagonals of \a C, i.e. with a stride of one row plus one column.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ET >  // Type of the scaling factor
+void bmmBand( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+              const DenseMatrix<MT3,SO3>& B, const ET& alpha, FalseType )
+{
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT1 );
+
+   const ptrdiff_t m  ( (~A).rows() );
+   const ptrdiff_t l  ( (~A).columns() );
+   const ptrdiff_t n  ( (~B).columns() );
+   const ptrdiff_t kla( (~A).lowerBandwidth() );
+   const ptrdiff_t kua( (~A).upperBandwidth() );
+   const ptrdiff_t klb( (~B).lowerBandwidth() );
+   const ptrdiff_t kub( (~B).upperBandwidth() );
+   const ptrdiff_t ldc( (~C).spacing() );
+
+   for( ptrdiff_t da=-kla; da<=kua; ++da ) {
+      for( ptrdiff_t db=-klb; db<=kub; ++db )
+      {
+         const ptrdiff_t d( da + db );
+
+         ptrdiff_t ibegin( 0 );
+         if( -da > ibegin ) ibegin = -da;
+         if( -d  > ibegin ) ibegin = -d;
+
+         ptrdiff_t iend( m );
+         if( l-da < iend ) iend = l-da;
+         if( n-d  < iend ) iend = n-d;
+
+         if( ibegin >= iend ) continue;
+
+         const ET* a( (~A).diagonal( da ) + ( SO2 ? ibegin+da : ibegin    ) );
+         const ET* b( (~B).diagonal( db ) + ( SO3 ? ibegin+d  : ibegin+da ) );
+         ET* c( (~C).data() + ( SO1 ? (ibegin+d)*ldc + ibegin : ibegin*ldc + ibegin+d ) );
+
+         for( ptrdiff_t i=0; i<iend-ibegin; ++i, c+=ldc+1 ) {
+            *c += a[i] * b[i] * alpha;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Band storage kernel for a multiplication with a left-hand side band matrix.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side band matrix operand.
+// \param B The right-hand side dense matrix operand with the storage order of \a C.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// For a column-major target matrix each column of \a C is computed by a band matrix/vector
+// multiplication, for a row-major target matrix each stored element \f$ a_{ij} \f$ adds the
+// scaled row \a j of \a B to row \a i of \a C.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , typename ET >  // Type of the scaling factor
+void bmmLeft( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+              const DenseMatrix<MT3,SO1>& B, const ET& alpha, TrueType )
+{
+   const ptrdiff_t m ( (~A).rows() );
+   const ptrdiff_t l ( (~A).columns() );
+   const ptrdiff_t kl( (~A).lowerBandwidth() );
+   const ptrdiff_t ku( (~A).upperBandwidth() );
+
+   if( SO1 ) {
+      for( size_t j=0UL; j<(~C).columns(); ++j ) {
+         bmvDiagonals<false,SO2>( ~A, (~B).data()+j*(~B).spacing(),
+                                  (~C).data()+j*(~C).spacing(), alpha );
+      }
+   }
+   else {
+      for( ptrdiff_t i=0; i<m; ++i ) {
+         const ptrdiff_t kbegin( i < kl ? -i : -kl );
+         const ptrdiff_t kend  ( l-i <= ku ? l-i : ku+1 );
+         for( ptrdiff_t k=kbegin; k<kend; ++k ) {
+            bandAxpy( (~C).data()+i*(~C).spacing(), (~B).data()+(i+k)*(~B).spacing(),
+                      alpha * (~A).diagonal( k )[ SO2 ? i+k : i ], (~C).columns() );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Band storage kernel for a multiplication with a left-hand side band matrix.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side band matrix operand.
+// \param B The right-hand side dense matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This overload handles right-hand side operands without direct data access or with a storage
+// order different from \a C. The operand is copied into a temporary of the storage order of
+// \a C first.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ET >  // Type of the scaling factor
+inline void bmmLeft( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                     const DenseMatrix<MT3,SO3>& B, const ET& alpha, FalseType )
+{
+   const DynamicMatrix<ET,SO1> tmp( ~B );
+   bmmLeft( C, A, tmp, alpha, TrueType() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Band storage kernel for a multiplication with a right-hand side band matrix.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side dense matrix operand with the storage order of \a C.
+// \param B The right-hand side band matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// For a row-major target matrix each row of \a C is computed by a transpose vector/band matrix
+// multiplication, for a column-major target matrix each stored element \f$ b_{ij} \f$ adds the
+// scaled column \a i of \a A to column \a j of \a C.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ET >  // Type of the scaling factor
+void bmmRight( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO1>& A,
+               const DenseMatrix<MT3,SO3>& B, const ET& alpha, TrueType )
+{
+   const ptrdiff_t l ( (~B).rows() );
+   const ptrdiff_t n ( (~B).columns() );
+   const ptrdiff_t kl( (~B).lowerBandwidth() );
+   const ptrdiff_t ku( (~B).upperBandwidth() );
+
+   if( SO1 ) {
+      for( ptrdiff_t j=0; j<n; ++j ) {
+         const ptrdiff_t kbegin( j < ku ? j : ku );
+         const ptrdiff_t kend  ( l-j <= kl ? j-l : -kl-1 );
+         for( ptrdiff_t k=kbegin; k>kend; --k ) {
+            bandAxpy( (~C).data()+j*(~C).spacing(), (~A).data()+(j-k)*(~A).spacing(),
+                      alpha * (~B).diagonal( k )[ SO3 ? j : j-k ], (~C).rows() );
+         }
+      }
+   }
+   else {
+      for( size_t i=0UL; i<(~C).rows(); ++i ) {
+         bmvDiagonals<true,SO3>( ~B, (~A).data()+i*(~A).spacing(),
+                                 (~C).data()+i*(~C).spacing(), alpha );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Band storage kernel for a multiplication with a right-hand side band matrix.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side dense matrix operand.
+// \param B The right-hand side band matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This overload handles left-hand side operands without direct data access or with a storage
+// order different from \a C. The operand is copied into a temporary of the storage order of
+// \a C first.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ET >  // Type of the scaling factor
+inline void bmmRight( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                      const DenseMatrix<MT3,SO3>& B, const ET& alpha, FalseType )
+{
+   const DynamicMatrix<ET,SO1> tmp( ~A );
+   bmmRight( C, tmp, B, alpha, TrueType() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Band storage kernel for a multiplication of two band matrices (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side band matrix operand.
+// \param B The right-hand side band matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This function multiplies two band matrices (see BandMatrix) diagonal by diagonal. The cost
+// of the multiplication is \f$ O(N \cdot (k_l^A+k_u^A+1) \cdot (k_l^B+k_u^B+1)) \f$. In case
+// \a C is a band matrix, its band must be wide enough to hold the product. Note that \a C must
+// not be aliased with either \a A or \a B.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factor
+inline EnableIf_< And< IsBanded<MT2>, IsBanded<MT3> > >
+   bmm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+        const DenseMatrix<MT3,SO3>& B, ST alpha )
+{
+   typedef ElementType_<MT1>  ET;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == (~A).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~B).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~B).rows()   , "Invalid matrix sizes"      );
+
+   bmmBand( C, A, B, ET( alpha ), typename IsBanded<MT1>::Type() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Band storage kernel for a multiplication with a left-hand side band matrix
+//        (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side band matrix operand.
+// \param B The right-hand side dense matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// The dense operand is used in place in case it provides direct data access and has the storage
+// order of \a C, otherwise it is copied into a temporary matrix. The kernels vectorize along the
+// rows of a row-major and the columns of a column-major target matrix. Note that \a C must not
+// be aliased with either \a A or \a B.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factor
+inline EnableIf_< And< IsBanded<MT2>, Not< IsBanded<MT3> > > >
+   bmm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+        const DenseMatrix<MT3,SO3>& B, ST alpha )
+{
+   typedef ElementType_<MT1>  ET;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT1 );
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == (~A).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~B).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~B).rows()   , "Invalid matrix sizes"      );
+
+   bmmLeft( ~C, ~A, ~B, ET( alpha ),
+            BoolConstant< HasConstDataAccess<MT3>::value && SO1 == SO3 &&
+                          IsSame< ElementType_<MT3>, ET >::value >() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Band storage kernel for a multiplication with a right-hand side band matrix
+//        (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side dense matrix operand.
+// \param B The right-hand side band matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This overload handles a right-hand side band matrix in combination with a left-hand side
+// matrix in full storage. Note that \a C must not be aliased with either \a A or \a B.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factor
+inline EnableIf_< And< Not< IsBanded<MT2> >, IsBanded<MT3> > >
+   bmm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+        const DenseMatrix<MT3,SO3>& B, ST alpha )
+{
+   typedef ElementType_<MT1>  ET;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT1 );
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == (~A).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~B).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~B).rows()   , "Invalid matrix sizes"      );
+
+   bmmRight( ~C, ~A, ~B, ET( alpha ),
+             BoolConstant< HasConstDataAccess<MT2>::value && SO1 == SO2 &&
+                           IsSame< ElementType_<MT2>, ET >::value >() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
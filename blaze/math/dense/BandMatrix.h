@@ -0,0 +1,4200 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BandMatrix.h
+//  \brief Implementation of a dense matrix in LAPACK-style band storage
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BANDMATRIX_H_
+#define _BLAZE_MATH_DENSE_BANDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/BandKernels.h>
+#include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/PackedProxy.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/IsBanded.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BANDWIDTH FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Bandwidth functions */
+//@{
+template< typename MT, bool SO >
+size_t lowerBandwidth( const DenseMatrix<MT,SO>& m );
+
+template< typename MT, bool SO >
+size_t lowerBandwidth( const SparseMatrix<MT,SO>& m );
+
+template< typename Type, bool SO >
+size_t lowerBandwidth( const BandMatrix<Type,SO>& m );
+
+template< typename MT1, typename MT2, bool SO >
+size_t lowerBandwidth( const DMatDMatAddExpr<MT1,MT2,SO>& m );
+
+template< typename MT1, typename MT2 >
+size_t lowerBandwidth( const DMatTDMatAddExpr<MT1,MT2>& m );
+
+template< typename MT1, typename MT2, bool SO >
+size_t lowerBandwidth( const DMatDMatSubExpr<MT1,MT2,SO>& m );
+
+template< typename MT1, typename MT2 >
+size_t lowerBandwidth( const DMatTDMatSubExpr<MT1,MT2>& m );
+
+template< typename MT1, typename MT2 >
+size_t lowerBandwidth( const DMatDMatMultExpr<MT1,MT2>& m );
+
+template< typename MT1, typename MT2 >
+size_t lowerBandwidth( const DMatTDMatMultExpr<MT1,MT2>& m );
+
+template< typename MT1, typename MT2 >
+size_t lowerBandwidth( const TDMatDMatMultExpr<MT1,MT2>& m );
+
+template< typename MT1, typename MT2 >
+size_t lowerBandwidth( const TDMatTDMatMultExpr<MT1,MT2>& m );
+
+template< typename MT, typename ST, bool SO >
+size_t lowerBandwidth( const DMatScalarMultExpr<MT,ST,SO>& m );
+
+template< typename MT, typename ST, bool SO >
+size_t lowerBandwidth( const DMatScalarDivExpr<MT,ST,SO>& m );
+
+template< typename MT, bool SO >
+size_t lowerBandwidth( const DMatTransExpr<MT,SO>& m );
+
+template< typename MT, bool SO >
+size_t lowerBandwidth( const DMatSerialExpr<MT,SO>& m );
+
+template< typename MT, bool SO >
+size_t lowerBandwidth( const DMatEvalExpr<MT,SO>& m );
+
+template< typename MT, typename OP, bool SO >
+size_t lowerBandwidth( const DMatForEachExpr<MT,OP,SO>& m );
+
+template< typename MT, bool SO >
+size_t upperBandwidth( const DenseMatrix<MT,SO>& m );
+
+template< typename MT, bool SO >
+size_t upperBandwidth( const SparseMatrix<MT,SO>& m );
+
+template< typename Type, bool SO >
+size_t upperBandwidth( const BandMatrix<Type,SO>& m );
+
+template< typename MT1, typename MT2, bool SO >
+size_t upperBandwidth( const DMatDMatAddExpr<MT1,MT2,SO>& m );
+
+template< typename MT1, typename MT2 >
+size_t upperBandwidth( const DMatTDMatAddExpr<MT1,MT2>& m );
+
+template< typename MT1, typename MT2, bool SO >
+size_t upperBandwidth( const DMatDMatSubExpr<MT1,MT2,SO>& m );
+
+template< typename MT1, typename MT2 >
+size_t upperBandwidth( const DMatTDMatSubExpr<MT1,MT2>& m );
+
+template< typename MT1, typename MT2 >
+size_t upperBandwidth( const DMatDMatMultExpr<MT1,MT2>& m );
+
+template< typename MT1, typename MT2 >
+size_t upperBandwidth( const DMatTDMatMultExpr<MT1,MT2>& m );
+
+template< typename MT1, typename MT2 >
+size_t upperBandwidth( const TDMatDMatMultExpr<MT1,MT2>& m );
+
+template< typename MT1, typename MT2 >
+size_t upperBandwidth( const TDMatTDMatMultExpr<MT1,MT2>& m );
+
+template< typename MT, typename ST, bool SO >
+size_t upperBandwidth( const DMatScalarMultExpr<MT,ST,SO>& m );
+
+template< typename MT, typename ST, bool SO >
+size_t upperBandwidth( const DMatScalarDivExpr<MT,ST,SO>& m );
+
+template< typename MT, bool SO >
+size_t upperBandwidth( const DMatTransExpr<MT,SO>& m );
+
+template< typename MT, bool SO >
+size_t upperBandwidth( const DMatSerialExpr<MT,SO>& m );
+
+template< typename MT, bool SO >
+size_t upperBandwidth( const DMatEvalExpr<MT,SO>& m );
+
+template< typename MT, typename OP, bool SO >
+size_t upperBandwidth( const DMatForEachExpr<MT,OP,SO>& m );
+//@}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup band_matrix BandMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a \f$ M \times N \f$ band matrix.
+// \ingroup band_matrix
+//
+// The BandMatrix class template is the representation of a dense \f$ M \times N \f$ matrix
+// whose non-zero elements are restricted to the main diagonal, the \f$ k_l \f$ diagonals below
+// and the \f$ k_u \f$ diagonals above the main diagonal. Only the \f$ k_l+k_u+1 \f$ diagonals
+// of the band are stored. The type of the elements and the storage order of the matrix can be
+// specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class BandMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BandMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer numeric element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::defaultStorageOrder.
+//
+// The storage follows the band storage format of LAPACK: The element \f$ a_{ij} \f$ is stored
+// in line \f$ k_u+i-j \f$ of the band, i.e. every diagonal of the band occupies a contiguous line
+// of the internal storage, starting with the uppermost superdiagonal. In case of a row-major
+// matrix the element is stored at position \a i within its line, in case of a column-major matrix
+// at position \a j (which corresponds to the LAPACK layout). For instance, the storage of a
+// row-major tridiagonal \f$ 4 \times 4 \f$ matrix looks like this:
+
+                          \f[\left(\begin{array}{*{4}{c}}
+                          a_{01} & a_{12} & a_{23} & *      \\
+                          a_{00} & a_{11} & a_{22} & a_{33} \\
+                          *      & a_{10} & a_{21} & a_{32} \\
+                          \end{array}\right)\f]
+
+// Since each diagonal is contiguous in memory, products with a band matrix can be computed
+// diagonal by diagonal via SIMD operations independent of the storage order. Access to elements
+// outside the band is gained via a PackedProxy, which only permits the assignment of zero:
+
+   \code
+   using blaze::BandMatrix;
+   using blaze::rowMajor;
+
+   BandMatrix<double,rowMajor> A( 1000UL, 1000UL, 1UL, 1UL );  // Tridiagonal matrix
+   blaze::DynamicVector<double> x( 1000UL ), y;
+
+   for( size_t i=0UL; i<1000UL; ++i ) {
+      if( i > 0UL ) A(i,i-1UL) = -1.0;
+      A(i,i) = 2.0;
+      if( i < 999UL ) A(i,i+1UL) = -1.0;
+   }
+
+   y = A * x;  // Diagonal-wise band matrix/vector multiplication
+
+   BandMatrix<double,rowMajor> B( A * A );  // Pentadiagonal result in band storage
+   \endcode
+
+// Any assignment to a BandMatrix adapts the bandwidths of the matrix to the bandwidths of the
+// assigned matrix, which are either deduced from the structure of the assigned expression or,
+// in case of a plain matrix, determined from its non-zero elements.
+*/
+template< typename Type                   // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class BandMatrix : public DenseMatrix< BandMatrix<Type,SO>, SO >
+{
+ private:
+   //**BandIterator class definition***************************************************************
+   /*!\brief Iterator over the elements of a single row/column of a band matrix.
+   */
+   template< typename MatrixType      // Type of the band matrix
+           , typename ReferenceType >  // Type of the element reference
+   class BandIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Type                             ValueType;         //!< Type of the underlying elements.
+      typedef ReferenceType                    PointerType;       //!< Pointer return type.
+      typedef ReferenceType                    ReferenceType_;    //!< Reference return type.
+      typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor of the BandIterator class.
+      */
+      inline BandIterator() noexcept
+         : matrix_( nullptr )  // Pointer to the band matrix
+         , line_  ( 0UL )      // The current row/column of the iterator
+         , pos_   ( 0UL )      // The current position within the row/column
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor of the BandIterator class.
+      //
+      // \param matrix Reference to the band matrix.
+      // \param line The row/column of the iterator.
+      // \param pos The initial position within the row/column.
+      */
+      inline BandIterator( MatrixType& matrix, size_t line, size_t pos ) noexcept
+         : matrix_( &matrix )  // Pointer to the band matrix
+         , line_  ( line    )  // The current row/column of the iterator
+         , pos_   ( pos     )  // The current position within the row/column
+      {}
+      //*******************************************************************************************
+
+      //**Conversion constructor*******************************************************************
+      /*!\brief Conversion constructor from different BandIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename MatrixType2, typename ReferenceType2 >
+      inline BandIterator( const BandIterator<MatrixType2,ReferenceType2>& it ) noexcept
+         : matrix_( it.matrix_ )  // Pointer to the band matrix
+         , line_  ( it.line_   )  // The current row/column of the iterator
+         , pos_   ( it.pos_    )  // The current position within the row/column
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline BandIterator& operator+=( size_t inc ) noexcept {
+         pos_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline BandIterator& operator-=( size_t dec ) noexcept {
+         pos_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline BandIterator& operator++() noexcept {
+         ++pos_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const BandIterator operator++( int ) noexcept {
+         const BandIterator tmp( *this );
+         ++pos_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline BandIterator& operator--() noexcept {
+         --pos_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const BandIterator operator--( int ) noexcept {
+         const BandIterator tmp( *this );
+         --pos_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The current value of the iterator.
+      */
+      inline ReferenceType operator*() const {
+         return ( SO )?( (*matrix_)(pos_,line_) ):( (*matrix_)(line_,pos_) );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two BandIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const BandIterator& rhs ) const noexcept {
+         return pos_ == rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two BandIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const BandIterator& rhs ) const noexcept {
+         return pos_ != rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two BandIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const BandIterator& rhs ) const noexcept {
+         return pos_ < rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two BandIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      inline bool operator>( const BandIterator& rhs ) const noexcept {
+         return pos_ > rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two BandIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      inline bool operator<=( const BandIterator& rhs ) const noexcept {
+         return pos_ <= rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two BandIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      inline bool operator>=( const BandIterator& rhs ) const noexcept {
+         return pos_ >= rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const BandIterator& rhs ) const noexcept {
+         return pos_ - rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a BandIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const BandIterator operator+( const BandIterator& it, size_t inc ) noexcept {
+         return BandIterator( *it.matrix_, it.line_, it.pos_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a BandIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const BandIterator operator+( size_t inc, const BandIterator& it ) noexcept {
+         return BandIterator( *it.matrix_, it.line_, it.pos_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a BandIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const BandIterator operator-( const BandIterator& it, size_t dec ) noexcept {
+         return BandIterator( *it.matrix_, it.line_, it.pos_ - dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      MatrixType* matrix_;  //!< Pointer to the band matrix.
+      size_t      line_;    //!< The current row/column of the iterator.
+      size_t      pos_;     //!< The current position within the row/column.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename MatrixType2, typename ReferenceType2 > friend class BandIterator;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef BandMatrix<Type,SO>   This;           //!< Type of this BandMatrix instance.
+   typedef DenseMatrix<This,SO>  BaseType;       //!< Base type of this BandMatrix instance.
+   typedef This                  ResultType;     //!< Result type for expression template evaluations.
+   typedef BandMatrix<Type,!SO>  OppositeType;   //!< Result type with opposite storage order for expression template evaluations.
+   typedef BandMatrix<Type,!SO>  TransposeType;  //!< Transpose type for expression template evaluations.
+
+   typedef Type                     ElementType;    //!< Type of the matrix elements.
+   typedef SIMDTrait_<ElementType>  SIMDType;       //!< SIMD type of the matrix elements.
+   typedef const Type               ReturnType;     //!< Return type for expression template evaluations.
+   typedef const This&              CompositeType;  //!< Data type for composite expression templates.
+
+   typedef PackedProxy<This>  Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type         ConstReference;  //!< Reference to a constant matrix value.
+   typedef Type*              Pointer;         //!< Pointer to a non-constant matrix value.
+   typedef const Type*        ConstPointer;    //!< Pointer to a constant matrix value.
+
+   typedef BandIterator<This,Reference>             Iterator;       //!< Iterator over non-constant elements.
+   typedef BandIterator<const This,ConstReference>  ConstIterator;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a BandMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef BandMatrix<ET,SO>  Other;  //!< The type of the other BandMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via SIMD operations. Since the rows (or columns) of a band matrix are
+       not contiguous in memory, the \a simdEnabled compilation flag is always set to \a false.
+       SIMD operations are applied along the diagonals by the band kernels instead. */
+   enum : bool { simdEnabled = false };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since the band of the target matrix is adapted during an assignment, the
+       \a smpAssignable compilation flag is always set to \a false. */
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BandMatrix() noexcept;
+   explicit inline BandMatrix( size_t m, size_t n, size_t kl, size_t ku );
+   explicit inline BandMatrix( size_t m, size_t n, size_t kl, size_t ku, const Type& init );
+   explicit inline BandMatrix( initializer_list< initializer_list<Type> > list );
+
+   template< typename Other >
+   explicit inline BandMatrix( size_t m, size_t n, const Other* array );
+
+   template< typename Other, size_t M, size_t N >
+   explicit inline BandMatrix( const Other (&array)[M][N] );
+
+                                     inline BandMatrix( const BandMatrix& m );
+                                     inline BandMatrix( BandMatrix&& m ) noexcept;
+   template< typename MT, bool SO2 > inline BandMatrix( const Matrix<MT,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~BandMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Pointer        data    () noexcept;
+   inline ConstPointer   data    () const noexcept;
+   inline Pointer        data    ( size_t i ) noexcept;
+   inline ConstPointer   data    ( size_t i ) const noexcept;
+   inline Pointer        diagonal( ptrdiff_t k ) noexcept;
+   inline ConstPointer   diagonal( ptrdiff_t k ) const noexcept;
+   inline Iterator       begin   ( size_t i ) noexcept;
+   inline ConstIterator  begin   ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin  ( size_t i ) const noexcept;
+   inline Iterator       end     ( size_t i ) noexcept;
+   inline ConstIterator  end     ( size_t i ) const noexcept;
+   inline ConstIterator  cend    ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline BandMatrix& operator=( const Type& rhs );
+   inline BandMatrix& operator=( initializer_list< initializer_list<Type> > list );
+
+   template< typename Other, size_t M, size_t N >
+   inline BandMatrix& operator=( const Other (&array)[M][N] );
+
+   inline BandMatrix& operator=( const BandMatrix& rhs );
+   inline BandMatrix& operator=( BandMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline BandMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline BandMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline BandMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline BandMatrix& operator*=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline EnableIf_<IsNumeric<Other>, BandMatrix >& operator*=( Other rhs );
+
+   template< typename Other >
+   inline EnableIf_<IsNumeric<Other>, BandMatrix >& operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t      rows() const noexcept;
+                              inline size_t      columns() const noexcept;
+                              inline size_t      lowerBandwidth() const noexcept;
+                              inline size_t      upperBandwidth() const noexcept;
+                              inline size_t      capacity() const noexcept;
+                              inline size_t      capacity( size_t i ) const noexcept;
+                              inline size_t      nonZeros() const;
+                              inline size_t      nonZeros( size_t i ) const;
+                              inline void        reset();
+                              inline void        reset( size_t i );
+                              inline void        clear();
+                              inline void        resize ( size_t m, size_t n, bool preserve=true );
+                                     void        resize ( size_t m, size_t n, size_t kl, size_t ku, bool preserve=true );
+                              inline void        extend ( size_t m, size_t n, bool preserve=true );
+                              inline void        reserve( size_t elements );
+                              inline BandMatrix& transpose();
+                              inline BandMatrix& ctranspose();
+   template< typename Other > inline BandMatrix& scale( const Other& scalar );
+                              inline void        swap( BandMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Debugging functions*************************************************************************
+   /*!\name Debugging functions */
+   //@{
+   inline bool isIntact() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO2 > inline void assign   ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void assign   ( const SparseMatrix<MT,SO2>& rhs );
+   template< bool SO2 >              inline void assign   ( const BandMatrix<Type,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const SparseMatrix<MT,SO2>& rhs );
+   template< bool SO2 >              inline void addAssign( const BandMatrix<Type,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const SparseMatrix<MT,SO2>& rhs );
+   template< bool SO2 >              inline void subAssign( const BandMatrix<Type,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool   isStored( size_t i, size_t j ) const noexcept;
+   inline size_t index   ( size_t i, size_t j ) const noexcept;
+   inline size_t lineSize() const noexcept;
+   inline size_t dbegin  ( ptrdiff_t k ) const noexcept;
+   inline size_t dend    ( ptrdiff_t k ) const noexcept;
+
+   static inline size_t clampBandwidth( size_t k, size_t n ) noexcept;
+
+   template< bool SO2 >
+   inline void addDiagonals( const BandMatrix<Type,SO2>& rhs, const Type& factor );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                //!< The current number of rows of the matrix.
+   size_t n_;                //!< The current number of columns of the matrix.
+   size_t kl_;               //!< The current lower bandwidth of the matrix.
+   size_t ku_;               //!< The current upper bandwidth of the matrix.
+   size_t capacity_;         //!< The maximum capacity of the matrix.
+   Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated matrix elements.
+                             /*!< The diagonal \f$ k \f$ of the band starts at offset
+                                  \f$ (k_u-k) \cdot M \f$ in case of a row-major matrix
+                                  and at offset \f$ (k_u-k) \cdot N \f$ in case of a
+                                  column-major matrix. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BandMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix() noexcept
+   : m_       ( 0UL )      // The current number of rows of the matrix
+   , n_       ( 0UL )      // The current number of columns of the matrix
+   , kl_      ( 0UL )      // The current lower bandwidth of the matrix
+   , ku_      ( 0UL )      // The current upper bandwidth of the matrix
+   , capacity_( 0UL )      // The maximum capacity of the matrix
+   , v_       ( nullptr )  // The matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a band matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param kl The number of subdiagonals of the band.
+// \param ku The number of superdiagonals of the band.
+//
+// All elements of the band are initialized to their default value. Bandwidths exceeding the
+// size of the matrix are reduced to \f$ m-1 \f$ and \f$ n-1 \f$, respectively.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix( size_t m, size_t n, size_t kl, size_t ku )
+   : m_       ( m )                                          // The current number of rows of the matrix
+   , n_       ( n )                                          // The current number of columns of the matrix
+   , kl_      ( clampBandwidth( kl, m ) )                    // The current lower bandwidth of the matrix
+   , ku_      ( clampBandwidth( ku, n ) )                    // The current upper bandwidth of the matrix
+   , capacity_( ( kl_+ku_+1UL ) * lineSize() )               // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )                // The matrix elements
+{
+   std::fill( v_, v_+capacity_, Type() );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogenous initialization of all elements of the band.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param kl The number of subdiagonals of the band.
+// \param ku The number of superdiagonals of the band.
+// \param init The initial value of the elements of the band.
+//
+// All elements of the band are initialized with the specified value, all elements outside of
+// the band remain 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix( size_t m, size_t n, size_t kl, size_t ku, const Type& init )
+   : m_       ( m )                                          // The current number of rows of the matrix
+   , n_       ( n )                                          // The current number of columns of the matrix
+   , kl_      ( clampBandwidth( kl, m ) )                    // The current lower bandwidth of the matrix
+   , ku_      ( clampBandwidth( ku, n ) )                    // The current upper bandwidth of the matrix
+   , capacity_( ( kl_+ku_+1UL ) * lineSize() )               // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )                // The matrix elements
+{
+   std::fill( v_, v_+capacity_, init );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of all matrix elements.
+//
+// \param list The initializer list.
+//
+// This constructor provides the option to explicitly initialize the elements of the matrix by
+// means of an initializer list:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::BandMatrix<int,rowMajor> A{ { 2, 1, 0 },
+                                      { 1, 2, 1 },
+                                      { 0, 1, 2 } };
+   \endcode
+
+// The matrix is sized according to the size of the initializer list and its bandwidths are
+// determined from the non-zero elements of the list. Missing values are initialized as default.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix( initializer_list< initializer_list<Type> > list )
+   : BandMatrix( DynamicMatrix<Type,SO>( list ) )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Array initialization of all matrix elements.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param array Dynamic array for the initialization.
+//
+// This constructor offers the option to directly initialize the elements of the matrix with a
+// dynamic array in the same layout as used for a DynamicMatrix with the same storage order.
+// The bandwidths of the matrix are determined from the non-zero elements of the array. Note
+// that it is expected that the given \a array has at least \a m by \a n elements. Providing
+// an array with less elements results in undefined behavior!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename Other >  // Data type of the initialization array
+inline BandMatrix<Type,SO>::BandMatrix( size_t m, size_t n, const Other* array )
+   : BandMatrix( DynamicMatrix<Type,SO>( m, n, array ) )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Array initialization of all matrix elements.
+//
+// \param array \f$ M \times N \f$ dimensional array for the initialization.
+//
+// This constructor offers the option to directly initialize the elements of the matrix with a
+// static array. Missing values are initialized with default values. The bandwidths of the
+// matrix are determined from the non-zero elements of the array.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename Other  // Data type of the initialization array
+        , size_t M        // Number of rows of the initialization array
+        , size_t N >      // Number of columns of the initialization array
+inline BandMatrix<Type,SO>::BandMatrix( const Other (&array)[M][N] )
+   : BandMatrix( DynamicMatrix<Type,SO>( array ) )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BandMatrix.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix( const BandMatrix& m )
+   : m_       ( m.m_  )                                      // The current number of rows of the matrix
+   , n_       ( m.n_  )                                      // The current number of columns of the matrix
+   , kl_      ( m.kl_ )                                      // The current lower bandwidth of the matrix
+   , ku_      ( m.ku_ )                                      // The current upper bandwidth of the matrix
+   , capacity_( ( kl_+ku_+1UL ) * lineSize() )               // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )                // The matrix elements
+{
+   BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
+
+   std::copy( m.v_, m.v_+capacity_, v_ );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for BandMatrix.
+//
+// \param m The matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix( BandMatrix&& m ) noexcept
+   : m_       ( m.m_        )  // The current number of rows of the matrix
+   , n_       ( m.n_        )  // The current number of columns of the matrix
+   , kl_      ( m.kl_       )  // The current lower bandwidth of the matrix
+   , ku_      ( m.ku_       )  // The current upper bandwidth of the matrix
+   , capacity_( m.capacity_ )  // The maximum capacity of the matrix
+   , v_       ( m.v_        )  // The matrix elements
+{
+   m.m_        = 0UL;
+   m.n_        = 0UL;
+   m.kl_       = 0UL;
+   m.ku_       = 0UL;
+   m.capacity_ = 0UL;
+   m.v_        = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+//
+// The bandwidths of the matrix are deduced from the given matrix (see lowerBandwidth() and
+// upperBandwidth()).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign matrix
+        , bool SO2 >     // Storage order of the foreign matrix
+inline BandMatrix<Type,SO>::BandMatrix( const Matrix<MT,SO2>& m )
+   : m_       ( 0UL )      // The current number of rows of the matrix
+   , n_       ( 0UL )      // The current number of columns of the matrix
+   , kl_      ( 0UL )      // The current lower bandwidth of the matrix
+   , ku_      ( 0UL )      // The current upper bandwidth of the matrix
+   , capacity_( 0UL )      // The maximum capacity of the matrix
+   , v_       ( nullptr )  // The matrix elements
+{
+   *this = ~m;
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for BandMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::~BandMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Proxy to the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Reference
+   BandMatrix<Type,SO>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   if( isStored( i, j ) )
+      return Reference( v_+index( i, j ), Reference::direct );
+   else
+      return Reference( nullptr, Reference::restricted );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstReference
+   BandMatrix<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   if( isStored( i, j ) )
+      return v_[index( i, j )];
+   else
+      return Type();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Proxy to the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Reference
+   BandMatrix<Type,SO>::at( size_t i, size_t j )
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstReference
+   BandMatrix<Type,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the band matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal band storage of the matrix. Note that the
+// storage only contains the \f$ k_l+k_u+1 \f$ diagonals of the band (see the BandMatrix class
+// description for the memory layout).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Pointer
+   BandMatrix<Type,SO>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the band matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal band storage of the matrix. Note that the
+// storage only contains the \f$ k_l+k_u+1 \f$ diagonals of the band (see the BandMatrix class
+// description for the memory layout).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstPointer
+   BandMatrix<Type,SO>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the storage position of the first stored element of
+// row/column \a i. Note that in band storage the elements of a row/column do NOT lie adjacent
+// to each other, since every element belongs to a different diagonal (see the BandMatrix class
+// description for the memory layout).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Pointer
+   BandMatrix<Type,SO>::data( size_t i ) noexcept
+{
+   if( SO ) {
+      BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix column access index" );
+      return v_ + index( ( i > ku_ )?( i-ku_ ):( 0UL ), i );
+   }
+   else {
+      BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+      return v_ + index( i, ( i > kl_ )?( i-kl_ ):( 0UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the storage position of the first stored element of
+// row/column \a i. Note that in band storage the elements of a row/column do NOT lie adjacent
+// to each other, since every element belongs to a different diagonal (see the BandMatrix class
+// description for the memory layout).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstPointer
+   BandMatrix<Type,SO>::data( size_t i ) const noexcept
+{
+   if( SO ) {
+      BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix column access index" );
+      return v_ + index( ( i > ku_ )?( i-ku_ ):( 0UL ), i );
+   }
+   else {
+      BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+      return v_ + index( i, ( i > kl_ )?( i-kl_ ):( 0UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of the diagonal \a k.
+//
+// \param k The index of the diagonal in the range \f$[-k_l..k_u]\f$.
+// \return Pointer to the storage line of the diagonal.
+//
+// This function returns a pointer to the storage line of the diagonal \a k (with \a k < 0 for
+// subdiagonals and \a k > 0 for superdiagonals). The element \f$ a_{i,i+k} \f$ is stored at
+// position \a i of the line in case of a row-major matrix and at position \a i+k in case of a
+// column-major matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Pointer
+   BandMatrix<Type,SO>::diagonal( ptrdiff_t k ) noexcept
+{
+   BLAZE_USER_ASSERT( -k <= ptrdiff_t( kl_ ) && k <= ptrdiff_t( ku_ ), "Invalid diagonal access index" );
+   return v_ + ( ptrdiff_t( ku_ ) - k ) * ptrdiff_t( lineSize() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of the diagonal \a k.
+//
+// \param k The index of the diagonal in the range \f$[-k_l..k_u]\f$.
+// \return Pointer to the storage line of the diagonal.
+//
+// This function returns a pointer to the storage line of the diagonal \a k (with \a k < 0 for
+// subdiagonals and \a k > 0 for superdiagonals). The element \f$ a_{i,i+k} \f$ is stored at
+// position \a i of the line in case of a row-major matrix and at position \a i+k in case of a
+// column-major matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstPointer
+   BandMatrix<Type,SO>::diagonal( ptrdiff_t k ) const noexcept
+{
+   BLAZE_USER_ASSERT( -k <= ptrdiff_t( kl_ ) && k <= ptrdiff_t( ku_ ), "Invalid diagonal access index" );
+   return v_ + ( ptrdiff_t( ku_ ) - k ) * ptrdiff_t( lineSize() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// element of row \a i, in case the storage flag is set to \a columnMajor the function returns an
+// iterator to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Iterator
+   BandMatrix<Type,SO>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid dense matrix row/column access index" );
+   return Iterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// element of row \a i, in case the storage flag is set to \a columnMajor the function returns an
+// iterator to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstIterator
+   BandMatrix<Type,SO>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// element of row \a i, in case the storage flag is set to \a columnMajor the function returns an
+// iterator to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstIterator
+   BandMatrix<Type,SO>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Iterator
+   BandMatrix<Type,SO>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid dense matrix row/column access index" );
+   return Iterator( *this, i, SO ? m_ : n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstIterator
+   BandMatrix<Type,SO>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, SO ? m_ : n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstIterator
+   BandMatrix<Type,SO>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, SO ? m_ : n_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all elements of the band.
+//
+// \param rhs Scalar value to be assigned to all elements of the band.
+// \return Reference to the assigned matrix.
+//
+// The elements outside of the band remain 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator=( const Type& rhs )
+{
+   std::fill( v_, v_+( kl_+ku_+1UL )*lineSize(), rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List assignment to all matrix elements.
+//
+// \param list The initializer list.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given initializer list and all its elements are
+// assigned the values from the given initializer list. Missing values are initialized as
+// default. The bandwidths of the matrix are determined from the non-zero elements of the list.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>&
+   BandMatrix<Type,SO>::operator=( initializer_list< initializer_list<Type> > list )
+{
+   return *this = DynamicMatrix<Type,SO>( list );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Array assignment to all matrix elements.
+//
+// \param array \f$ M \times N \f$ dimensional array for the assignment.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ array and initialized with
+// the values from the given array. Missing values are initialized with default values. The
+// bandwidths of the matrix are determined from the non-zero elements of the array.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename Other  // Data type of the initialization array
+        , size_t M        // Number of rows of the initialization array
+        , size_t N >      // Number of columns of the initialization array
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator=( const Other (&array)[M][N] )
+{
+   return *this = DynamicMatrix<Type,SO>( array );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BandMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given matrix, adopts its bandwidths and is initialized
+// as a copy of this matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator=( const BandMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.m_, rhs.n_, rhs.kl_, rhs.ku_, false );
+   std::copy( rhs.v_, rhs.v_+( kl_+ku_+1UL )*lineSize(), v_ );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for BandMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator=( BandMatrix&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   m_        = rhs.m_;
+   n_        = rhs.n_;
+   kl_       = rhs.kl_;
+   ku_       = rhs.ku_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.m_        = 0UL;
+   rhs.n_        = 0UL;
+   rhs.kl_       = 0UL;
+   rhs.ku_       = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given matrix and initialized as a copy of this matrix.
+// The bandwidths of the matrix are deduced from the given matrix: In case of an expression that
+// results in a band matrix (as for instance the sum or the product of two band matrices), the
+// bandwidths are deduced from the bandwidths of its operands and the expression is evaluated via
+// the band kernels. Otherwise the bandwidths are determined from the non-zero elements of the
+// (evaluated) matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::lowerBandwidth;
+   using blaze::upperBandwidth;
+
+   if( (~rhs).canAlias( this ) ) {
+      BandMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else if( IsComputation<MT>::value && !IsBanded< ResultType_<MT> >::value ) {
+      const ResultType_<MT> tmp( ~rhs );
+      resize( tmp.rows(), tmp.columns(), lowerBandwidth( tmp ), upperBandwidth( tmp ), false );
+      assign( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), lowerBandwidth( ~rhs ), upperBandwidth( ~rhs ), false );
+      smpAssign( *this, ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown. The band of the matrix is widened as necessary to hold the result.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::lowerBandwidth;
+   using blaze::upperBandwidth;
+   using blaze::max;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ||
+       ( IsComputation<MT>::value && !IsSame<ResultType_<MT>,This>::value ) ) {
+      const ResultType_<MT> tmp( ~rhs );
+      resize( m_, n_, max( kl_, lowerBandwidth( tmp ) ), max( ku_, upperBandwidth( tmp ) ) );
+      addAssign( tmp );
+   }
+   else {
+      resize( m_, n_, max( kl_, lowerBandwidth( ~rhs ) ), max( ku_, upperBandwidth( ~rhs ) ) );
+      smpAddAssign( *this, ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown. The band of the matrix is widened as necessary to hold the result.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::lowerBandwidth;
+   using blaze::upperBandwidth;
+   using blaze::max;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ||
+       ( IsComputation<MT>::value && !IsSame<ResultType_<MT>,This>::value ) ) {
+      const ResultType_<MT> tmp( ~rhs );
+      resize( m_, n_, max( kl_, lowerBandwidth( tmp ) ), max( ku_, upperBandwidth( tmp ) ) );
+      subAssign( tmp );
+   }
+   else {
+      resize( m_, n_, max( kl_, lowerBandwidth( ~rhs ) ), max( ku_, upperBandwidth( ~rhs ) ) );
+      smpSubAssign( *this, ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator*=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   return *this = (*this) * (~rhs);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_<IsNumeric<Other>, BandMatrix<Type,SO> >&
+   BandMatrix<Type,SO>::operator*=( Other rhs )
+{
+   return scale( rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_<IsNumeric<Other>, BandMatrix<Type,SO> >&
+   BandMatrix<Type,SO>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   const size_t size( ( kl_+ku_+1UL ) * lineSize() );
+   for( size_t i=0UL; i<size; ++i )
+      v_[i] /= rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current lower bandwidth of the matrix.
+//
+// \return The number of subdiagonals of the band.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::lowerBandwidth() const noexcept
+{
+   return kl_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current upper bandwidth of the matrix.
+//
+// \return The number of superdiagonals of the band.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::upperBandwidth() const noexcept
+{
+   return ku_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+//
+// Note that the capacity refers to the number of stored elements, i.e. a band matrix of size
+// \f$ M \times N \f$ requires a capacity of at least \f$ (k_l+k_u+1) \cdot M \f$ (row-major)
+// or \f$ (k_l+k_u+1) \cdot N \f$ (column-major).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::capacity() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// Since each row/column can be accessed in full via the PackedProxy class, the function returns
+// the number of columns (in case of a row-major matrix) or rows (in case of a column-major
+// matrix).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::capacity( size_t i ) const noexcept
+{
+   UNUSED_PARAMETER( i );
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid row/column access index" );
+   return ( SO )?( m_ ):( n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( ptrdiff_t k=-ptrdiff_t( kl_ ); k<=ptrdiff_t( ku_ ); ++k ) {
+      const size_t first( dbegin( k ) );
+      const size_t last ( dend( k ) );
+      const Type* d( diagonal( k ) + ( SO ? first+k : first ) );
+      for( size_t i=0UL; i<last-first; ++i ) {
+         if( !isDefault( d[i] ) )
+            ++nonzeros;
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid row/column access index" );
+
+   const size_t jbegin( SO ? ( i > ku_ ? i-ku_ : 0UL ) : ( i > kl_ ? i-kl_ : 0UL ) );
+   const size_t jend  ( SO ? min( m_, i+kl_+1UL ) : min( n_, i+ku_+1UL ) );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t j=jbegin; j<jend; ++j ) {
+      if( !isDefault( v_[ SO ? index( j, i ) : index( i, j ) ] ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all elements of the band to their default value. Note that the
+// bandwidths of the matrix remain unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::reset()
+{
+   using blaze::clear;
+
+   const size_t size( ( kl_+ku_+1UL ) * lineSize() );
+   for( size_t i=0UL; i<size; ++i )
+      clear( v_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::reset( size_t i )
+{
+   using blaze::clear;
+
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid row/column access index" );
+
+   const size_t jbegin( SO ? ( i > ku_ ? i-ku_ : 0UL ) : ( i > kl_ ? i-kl_ : 0UL ) );
+   const size_t jend  ( SO ? min( m_, i+kl_+1UL ) : min( n_, i+ku_+1UL ) );
+
+   for( size_t j=jbegin; j<jend; ++j )
+      clear( v_[ SO ? index( j, i ) : index( i, j ) ] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ M \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size and the bandwidths of the matrix are 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::clear()
+{
+   m_  = 0UL;
+   n_  = 0UL;
+   kl_ = 0UL;
+   ku_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. The bandwidths
+// of the matrix remain unchanged (unless they exceed the new size of the matrix). See the
+// resize() function with explicit bandwidths for further details.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+{
+   resize( m, n, kl_, ku_, preserve );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size and the bandwidths of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param kl The new number of subdiagonals of the band.
+// \param ku The new number of superdiagonals of the band.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$ and the given
+// bandwidths. During this operation, new dynamic memory may be allocated in case the capacity
+// of the matrix is too small. Note that this function may invalidate all existing views on the
+// matrix. In case the \a preserve flag is set to \a true, the old values within the new band
+// are preserved and all new elements of the band are initialized to their default value. In
+// case \a preserve is \a false, the elements of the band are not initialized!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void BandMatrix<Type,SO>::resize( size_t m, size_t n, size_t kl, size_t ku, bool preserve )
+{
+   using blaze::min;
+
+   kl = clampBandwidth( kl, m );
+   ku = clampBandwidth( ku, n );
+
+   if( m == m_ && n == n_ && kl == kl_ && ku == ku_ ) return;
+
+   const size_t ld  ( SO ? n : m );
+   const size_t size( ( kl+ku+1UL ) * ld );
+
+   if( preserve )
+   {
+      Type* BLAZE_RESTRICT v = allocate<Type>( size );
+      std::fill( v, v+size, Type() );
+
+      const ptrdiff_t mmin( min( m, m_ ) );
+      const ptrdiff_t nmin( min( n, n_ ) );
+
+      for( ptrdiff_t k=-ptrdiff_t( min( kl, kl_ ) ); k<=ptrdiff_t( min( ku, ku_ ) ); ++k )
+      {
+         const ptrdiff_t first( k < 0 ? -k : 0 );
+         const ptrdiff_t last ( mmin < nmin-k ? mmin : nmin-k );
+
+         if( first >= last ) continue;
+
+         const ptrdiff_t offset( SO ? first+k : first );
+         transfer( diagonal( k ) + offset, diagonal( k ) + offset + ( last - first ),
+                   v + ( ptrdiff_t( ku ) - k ) * ptrdiff_t( ld ) + offset );
+      }
+
+      std::swap( v_, v );
+      deallocate( v );
+      capacity_ = size;
+   }
+   else if( size > capacity_ ) {
+      Type* BLAZE_RESTRICT v = allocate<Type>( size );
+      std::swap( v_, v );
+      deallocate( v );
+      capacity_ = size;
+   }
+
+   m_  = m;
+   n_  = n;
+   kl_ = kl;
+   ku_ = ku;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extending the size of the matrix.
+//
+// \param m Number of additional rows.
+// \param n Number of additional columns.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function increases the matrix size by \a m rows and \a n columns. The bandwidths of the
+// matrix remain unchanged. During this operation, new dynamic memory may be allocated in case
+// the capacity of the matrix is too small. Therefore this function potentially changes all
+// matrix elements. In order to preserve the old matrix values, the \a preserve flag can be set
+// to \a true.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::extend( size_t m, size_t n, bool preserve )
+{
+   resize( m_+m, n_+n, kl_, ku_, preserve );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the matrix.
+//
+// \param elements The new minimum capacity of the band matrix.
+// \return void
+//
+// This function increases the capacity of the band matrix to at least \a elements elements.
+// The current values of the matrix elements are preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::reserve( size_t elements )
+{
+   if( elements > capacity_ )
+   {
+      // Allocating a new array
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+
+      // Initializing the new array
+      transfer( v_, v_+capacity_, tmp );
+
+      // Replacing the old array
+      std::swap( tmp, v_ );
+      deallocate( tmp );
+      capacity_ = elements;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Transposing the matrix.
+//
+// \return Reference to the transposed matrix.
+//
+// The transpose of a band matrix is a band matrix with swapped bandwidths. Since the diagonals
+// change their position within the band storage, the transpose is computed out-of-place.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::transpose()
+{
+   BandMatrix tmp( n_, m_, ku_, kl_ );
+
+   for( ptrdiff_t k=-ptrdiff_t( kl_ ); k<=ptrdiff_t( ku_ ); ++k ) {
+      const size_t first( dbegin( k ) );
+      const size_t last ( dend( k ) );
+      const Type* d( diagonal( k ) + ( SO ? first+k : first ) );
+      std::copy( d, d+( last-first ), tmp.diagonal( -k ) + ( SO ? first : first+k ) );
+   }
+
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::ctranspose()
+{
+   transpose();
+
+   const size_t size( ( kl_+ku_+1UL ) * lineSize() );
+   for( size_t i=0UL; i<size; ++i )
+      conjugate( v_[i] );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename Other >  // Data type of the scalar value
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::scale( const Other& scalar )
+{
+   const size_t size( ( kl_+ku_+1UL ) * lineSize() );
+   for( size_t i=0UL; i<size; ++i )
+      v_[i] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::swap( BandMatrix& m ) noexcept
+{
+   std::swap( m_       , m.m_        );
+   std::swap( n_       , m.n_        );
+   std::swap( kl_      , m.kl_       );
+   std::swap( ku_      , m.ku_       );
+   std::swap( capacity_, m.capacity_ );
+   std::swap( v_       , m.v_        );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the element \f$ (i,j) \f$ is part of the band.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return \a true in case the element is stored, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool BandMatrix<Type,SO>::isStored( size_t i, size_t j ) const noexcept
+{
+   return ( j <= i+ku_ ) && ( i <= j+kl_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the storage offset of the stored element \f$ (i,j) \f$.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The offset of the element within the band storage.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::index( size_t i, size_t j ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( isStored( i, j ), "Invalid access to non-stored element" );
+
+   return ( ku_+i-j )*lineSize() + ( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the length of the storage lines of the diagonals.
+//
+// \return The number of rows (row-major) or columns (column-major) of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::lineSize() const noexcept
+{
+   return ( SO )?( n_ ):( m_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the first row of the diagonal \a k.
+//
+// \param k The index of the diagonal.
+// \return The row index of the first element of the diagonal.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::dbegin( ptrdiff_t k ) const noexcept
+{
+   return ( k < 0 )?( size_t( -k ) ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index one past the last row of the diagonal \a k.
+//
+// \param k The index of the diagonal.
+// \return The row index one past the last element of the diagonal.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::dend( ptrdiff_t k ) const noexcept
+{
+   const ptrdiff_t last( ptrdiff_t( n_ ) - k );
+   return ( last < ptrdiff_t( m_ ) )?( size_t( last ) ):( m_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Restricts the given bandwidth to the size of the matrix.
+//
+// \param k The requested bandwidth.
+// \param n The number of rows (lower bandwidth) or columns (upper bandwidth) of the matrix.
+// \return The bandwidth restricted to the range \f$[0..n-1]\f$.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::clampBandwidth( size_t k, size_t n ) noexcept
+{
+   return ( k < n )?( k ):( n > 0UL ? n-1UL : 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition of the scaled diagonals of the given band matrix.
+//
+// \param rhs The right-hand side band matrix.
+// \param factor The scaling factor for the diagonals of \a rhs.
+// \return void
+//
+// The diagonals of \a rhs are added diagonal by diagonal via the vectorized band kernels. The
+// band of \a rhs is expected to be contained in the band of this matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< bool SO2 >     // Storage order of the right-hand side band matrix
+inline void BandMatrix<Type,SO>::addDiagonals( const BandMatrix<Type,SO2>& rhs, const Type& factor )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == rhs.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rhs.lowerBandwidth() <= kl_, "Invalid lower bandwidth" );
+   BLAZE_INTERNAL_ASSERT( rhs.upperBandwidth() <= ku_, "Invalid upper bandwidth" );
+
+   for( ptrdiff_t k=-ptrdiff_t( rhs.lowerBandwidth() ); k<=ptrdiff_t( rhs.upperBandwidth() ); ++k ) {
+      const size_t first( dbegin( k ) );
+      const size_t last ( dend( k ) );
+      bandAxpy( diagonal( k ) + ( SO ? first+k : first ),
+                rhs.diagonal( k ) + ( SO2 ? first+k : first ), factor, last-first );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEBUGGING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the band matrix are intact.
+//
+// \return \a true in case the band matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the band matrix are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool BandMatrix<Type,SO>::isIntact() const noexcept
+{
+   if( ( kl_+ku_+1UL ) * lineSize() > capacity_ )
+      return false;
+
+   if( kl_ != clampBandwidth( kl_, m_ ) || ku_ != clampBandwidth( ku_, n_ ) )
+      return false;
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool BandMatrix<Type,SO>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool BandMatrix<Type,SO>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a false since the diagonals of a band matrix are not aligned in general.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool BandMatrix<Type,SO>::isAligned() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a false since band matrices are always assigned serially.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool BandMatrix<Type,SO>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Only the elements of the band are read from \a rhs.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void BandMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   if( SO ) {
+      for( size_t j=0UL; j<n_; ++j ) {
+         const size_t ibegin( j > ku_ ? j-ku_ : 0UL );
+         const size_t iend  ( min( m_, j+kl_+1UL ) );
+         for( size_t i=ibegin; i<iend; ++i )
+            v_[index( i, j )] = (~rhs)(i,j);
+      }
+   }
+   else {
+      for( size_t i=0UL; i<m_; ++i ) {
+         const size_t jbegin( i > kl_ ? i-kl_ : 0UL );
+         const size_t jend  ( min( n_, i+ku_+1UL ) );
+         for( size_t j=jbegin; j<jend; ++j )
+            v_[index( i, j )] = (~rhs)(i,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. The band is expected to contain all non-zero elements of \a rhs.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void BandMatrix<Type,SO>::assign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   reset();
+
+   const size_t n( SO2 ? n_ : m_ );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      for( ConstIterator_<MT> element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         const size_t i( SO2 ? element->index() : k );
+         const size_t j( SO2 ? k : element->index() );
+         BLAZE_INTERNAL_ASSERT( isStored( i, j ), "Invalid non-zero element outside of the band" );
+         v_[index( i, j )] = element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Optimized implementation of the assignment of a band matrix.
+//
+// \param rhs The right-hand side band matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. The diagonals are copied as a whole, diagonals of
+// the band that are not stored in \a rhs are reset.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< bool SO2 >     // Storage order of the right-hand side band matrix
+inline void BandMatrix<Type,SO>::assign( const BandMatrix<Type,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == rhs.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rhs.lowerBandwidth() <= kl_, "Invalid lower bandwidth" );
+   BLAZE_INTERNAL_ASSERT( rhs.upperBandwidth() <= ku_, "Invalid upper bandwidth" );
+
+   const ptrdiff_t kl( rhs.lowerBandwidth() );
+   const ptrdiff_t ku( rhs.upperBandwidth() );
+
+   for( ptrdiff_t k=-ptrdiff_t( kl_ ); k<=ptrdiff_t( ku_ ); ++k )
+   {
+      const size_t first( dbegin( k ) );
+      const size_t last ( dend( k ) );
+      Type* d( diagonal( k ) + ( SO ? first+k : first ) );
+
+      if( -k <= kl && k <= ku ) {
+         const Type* r( rhs.diagonal( k ) + ( SO2 ? first+k : first ) );
+         std::copy( r, r+( last-first ), d );
+      }
+      else {
+         std::fill( d, d+( last-first ), Type() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Only the elements of the band are read from \a rhs.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void BandMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   if( SO ) {
+      for( size_t j=0UL; j<n_; ++j ) {
+         const size_t ibegin( j > ku_ ? j-ku_ : 0UL );
+         const size_t iend  ( min( m_, j+kl_+1UL ) );
+         for( size_t i=ibegin; i<iend; ++i )
+            v_[index( i, j )] += (~rhs)(i,j);
+      }
+   }
+   else {
+      for( size_t i=0UL; i<m_; ++i ) {
+         const size_t jbegin( i > kl_ ? i-kl_ : 0UL );
+         const size_t jend  ( min( n_, i+ku_+1UL ) );
+         for( size_t j=jbegin; j<jend; ++j )
+            v_[index( i, j )] += (~rhs)(i,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. The band is expected to contain all non-zero elements of \a rhs.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void BandMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t n( SO2 ? n_ : m_ );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      for( ConstIterator_<MT> element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         const size_t i( SO2 ? element->index() : k );
+         const size_t j( SO2 ? k : element->index() );
+         BLAZE_INTERNAL_ASSERT( isStored( i, j ), "Invalid non-zero element outside of the band" );
+         v_[index( i, j )] += element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Optimized implementation of the addition assignment of a band matrix.
+//
+// \param rhs The right-hand side band matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. The diagonals are added via the vectorized band
+// kernels (see bandAxpy()).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< bool SO2 >     // Storage order of the right-hand side band matrix
+inline void BandMatrix<Type,SO>::addAssign( const BandMatrix<Type,SO2>& rhs )
+{
+   addDiagonals( rhs, Type( 1 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Only the elements of the band are read from \a rhs.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void BandMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   if( SO ) {
+      for( size_t j=0UL; j<n_; ++j ) {
+         const size_t ibegin( j > ku_ ? j-ku_ : 0UL );
+         const size_t iend  ( min( m_, j+kl_+1UL ) );
+         for( size_t i=ibegin; i<iend; ++i )
+            v_[index( i, j )] -= (~rhs)(i,j);
+      }
+   }
+   else {
+      for( size_t i=0UL; i<m_; ++i ) {
+         const size_t jbegin( i > kl_ ? i-kl_ : 0UL );
+         const size_t jend  ( min( n_, i+ku_+1UL ) );
+         for( size_t j=jbegin; j<jend; ++j )
+            v_[index( i, j )] -= (~rhs)(i,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. The band is expected to contain all non-zero elements of \a rhs.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void BandMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t n( SO2 ? n_ : m_ );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      for( ConstIterator_<MT> element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         const size_t i( SO2 ? element->index() : k );
+         const size_t j( SO2 ? k : element->index() );
+         BLAZE_INTERNAL_ASSERT( isStored( i, j ), "Invalid non-zero element outside of the band" );
+         v_[index( i, j )] -= element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Optimized implementation of the subtraction assignment of a band matrix.
+//
+// \param rhs The right-hand side band matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. The diagonals are subtracted via the vectorized band
+// kernels (see bandAxpy()).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< bool SO2 >     // Storage order of the right-hand side band matrix
+inline void BandMatrix<Type,SO>::subAssign( const BandMatrix<Type,SO2>& rhs )
+{
+   addDiagonals( rhs, Type( -1 ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BANDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BandMatrix operators */
+//@{
+template< typename Type, bool SO >
+inline void reset( BandMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void reset( BandMatrix<Type,SO>& m, size_t i );
+
+template< typename Type, bool SO >
+inline void clear( BandMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline bool isDefault( const BandMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline bool isIntact( const BandMatrix<Type,SO>& m ) noexcept;
+
+template< typename Type, bool SO >
+inline void swap( BandMatrix<Type,SO>& a, BandMatrix<Type,SO>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given band matrix.
+// \ingroup band_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( BandMatrix<Type,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given band matrix.
+// \ingroup band_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column of the given band matrix to
+// their default value. In case the given matrix is a \a rowMajor matrix the function resets the
+// values in row \a i, if it is a \a columnMajor matrix the function resets the values in column
+// \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( BandMatrix<Type,SO>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given band matrix.
+// \ingroup band_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void clear( BandMatrix<Type,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given band matrix is in default state.
+// \ingroup band_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isDefault( const BandMatrix<Type,SO>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given band matrix are intact.
+// \ingroup band_matrix
+//
+// \param m The band matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isIntact( const BandMatrix<Type,SO>& m ) noexcept
+{
+   return m.isIntact();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two band matrices.
+// \ingroup band_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void swap( BandMatrix<Type,SO>& a, BandMatrix<Type,SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BANDWIDTH FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the lower bandwidth of the given dense matrix.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix.
+// \return The number of non-zero diagonals below the main diagonal.
+//
+// This function determines the lower bandwidth of the given dense matrix, i.e. the distance
+// of the outermost non-default element below the main diagonal. In case the given matrix is
+// a computation, the bandwidth is not determined element-wise and the function conservatively
+// returns the maximum possible bandwidth.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t lowerBandwidth( const DenseMatrix<MT,SO>& m )
+{
+   if( IsUpper<MT>::value || (~m).rows() < 2UL )
+      return 0UL;
+
+   if( IsComputation<MT>::value )
+      return (~m).rows() - 1UL;
+
+   const size_t M( (~m).rows()    );
+   const size_t N( (~m).columns() );
+
+   size_t kl( 0UL );
+
+   for( size_t i=1UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N && j+kl<i; ++j ) {
+         if( !isDefault( (~m)(i,j) ) ) {
+            kl = i - j;
+            break;
+         }
+      }
+   }
+
+   return kl;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the lower bandwidth of the given sparse matrix.
+// \ingroup band_matrix
+//
+// \param m The given sparse matrix.
+// \return The number of non-zero diagonals below the main diagonal.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline size_t lowerBandwidth( const SparseMatrix<MT,SO>& m )
+{
+   if( IsUpper<MT>::value || (~m).rows() < 2UL )
+      return 0UL;
+
+   if( IsComputation<MT>::value )
+      return (~m).rows() - 1UL;
+
+   size_t kl( 0UL );
+
+   for( size_t i=0UL; i<( SO ? (~m).columns() : (~m).rows() ); ++i ) {
+      for( auto element=(~m).begin(i); element!=(~m).end(i); ++element ) {
+         const size_t row   ( SO ? element->index() : i );
+         const size_t column( SO ? i : element->index() );
+         if( row > column + kl && !isDefault( element->value() ) )
+            kl = row - column;
+      }
+   }
+
+   return kl;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the lower bandwidth of the given band matrix.
+// \ingroup band_matrix
+//
+// \param m The given band matrix.
+// \return The number of stored diagonals below the main diagonal.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t lowerBandwidth( const BandMatrix<Type,SO>& m )
+{
+   return m.lowerBandwidth();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the lower bandwidth of the given dense matrix addition.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix addition expression.
+// \return The lower bandwidth of the addition result.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO >     // Storage order
+inline size_t lowerBandwidth( const DMatDMatAddExpr<MT1,MT2,SO>& m )
+{
+   using blaze::max;
+
+   return max( lowerBandwidth( m.leftOperand() ), lowerBandwidth( m.rightOperand() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the lower bandwidth of the given dense matrix addition.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix addition expression.
+// \return The lower bandwidth of the addition result.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline size_t lowerBandwidth( const DMatTDMatAddExpr<MT1,MT2>& m )
+{
+   using blaze::max;
+
+   return max( lowerBandwidth( m.leftOperand() ), lowerBandwidth( m.rightOperand() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the lower bandwidth of the given dense matrix subtraction.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix subtraction expression.
+// \return The lower bandwidth of the subtraction result.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO >     // Storage order
+inline size_t lowerBandwidth( const DMatDMatSubExpr<MT1,MT2,SO>& m )
+{
+   using blaze::max;
+
+   return max( lowerBandwidth( m.leftOperand() ), lowerBandwidth( m.rightOperand() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the lower bandwidth of the given dense matrix subtraction.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix subtraction expression.
+// \return The lower bandwidth of the subtraction result.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline size_t lowerBandwidth( const DMatTDMatSubExpr<MT1,MT2>& m )
+{
+   using blaze::max;
+
+   return max( lowerBandwidth( m.leftOperand() ), lowerBandwidth( m.rightOperand() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the lower bandwidth of the given dense matrix multiplication.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix multiplication expression.
+// \return The lower bandwidth of the multiplication result.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline size_t lowerBandwidth( const DMatDMatMultExpr<MT1,MT2>& m )
+{
+   if( m.rows() < 2UL )
+      return 0UL;
+
+   const size_t k( lowerBandwidth( m.leftOperand() ) + lowerBandwidth( m.rightOperand() ) );
+
+   return ( k < m.rows() )?( k ):( m.rows() - 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the lower bandwidth of the given dense matrix multiplication.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix multiplication expression.
+// \return The lower bandwidth of the multiplication result.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline size_t lowerBandwidth( const DMatTDMatMultExpr<MT1,MT2>& m )
+{
+   if( m.rows() < 2UL )
+      return 0UL;
+
+   const size_t k( lowerBandwidth( m.leftOperand() ) + lowerBandwidth( m.rightOperand() ) );
+
+   return ( k < m.rows() )?( k ):( m.rows() - 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the lower bandwidth of the given dense matrix multiplication.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix multiplication expression.
+// \return The lower bandwidth of the multiplication result.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline size_t lowerBandwidth( const TDMatDMatMultExpr<MT1,MT2>& m )
+{
+   if( m.rows() < 2UL )
+      return 0UL;
+
+   const size_t k( lowerBandwidth( m.leftOperand() ) + lowerBandwidth( m.rightOperand() ) );
+
+   return ( k < m.rows() )?( k ):( m.rows() - 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the lower bandwidth of the given dense matrix multiplication.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix multiplication expression.
+// \return The lower bandwidth of the multiplication result.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline size_t lowerBandwidth( const TDMatTDMatMultExpr<MT1,MT2>& m )
+{
+   if( m.rows() < 2UL )
+      return 0UL;
+
+   const size_t k( lowerBandwidth( m.leftOperand() ) + lowerBandwidth( m.rightOperand() ) );
+
+   return ( k < m.rows() )?( k ):( m.rows() - 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the lower bandwidth of the given dense matrix/scalar multiplication.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix/scalar multiplication expression.
+// \return The lower bandwidth of the dense matrix operand.
+*/
+template< typename MT  // Type of the left-hand side dense matrix
+        , typename ST  // Type of the right-hand side scalar value
+        , bool SO >    // Storage order
+inline size_t lowerBandwidth( const DMatScalarMultExpr<MT,ST,SO>& m )
+{
+   return lowerBandwidth( m.leftOperand() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the lower bandwidth of the given dense matrix/scalar division.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix/scalar division expression.
+// \return The lower bandwidth of the dense matrix operand.
+*/
+template< typename MT  // Type of the left-hand side dense matrix
+        , typename ST  // Type of the right-hand side scalar value
+        , bool SO >    // Storage order
+inline size_t lowerBandwidth( const DMatScalarDivExpr<MT,ST,SO>& m )
+{
+   return lowerBandwidth( m.leftOperand() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the lower bandwidth of the given dense matrix transposition.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix transposition expression.
+// \return The upper bandwidth of the dense matrix operand.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t lowerBandwidth( const DMatTransExpr<MT,SO>& m )
+{
+   return upperBandwidth( m.operand() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the lower bandwidth of the given dense matrix serialization.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix serialization expression.
+// \return The lower bandwidth of the dense matrix operand.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t lowerBandwidth( const DMatSerialExpr<MT,SO>& m )
+{
+   return lowerBandwidth( m.operand() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the lower bandwidth of the given dense matrix evaluation.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix evaluation expression.
+// \return The lower bandwidth of the dense matrix operand.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t lowerBandwidth( const DMatEvalExpr<MT,SO>& m )
+{
+   return lowerBandwidth( m.operand() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the lower bandwidth of the given dense matrix for-each operation.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix for-each expression.
+// \return The lower bandwidth of the for-each result.
+//
+// In case the custom operation maps a default element to a default element, the bandwidth of
+// the dense matrix operand is preserved. Otherwise the maximum possible bandwidth is returned.
+*/
+template< typename MT  // Type of the dense matrix
+        , typename OP  // Type of the custom operation
+        , bool SO >    // Storage order
+inline size_t lowerBandwidth( const DMatForEachExpr<MT,OP,SO>& m )
+{
+   if( m.rows() < 2UL )
+      return 0UL;
+
+   if( isDefault( m.operation()( ElementType_<MT>() ) ) )
+      return lowerBandwidth( m.operand() );
+
+   return m.rows() - 1UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the upper bandwidth of the given dense matrix.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix.
+// \return The number of non-zero diagonals above the main diagonal.
+//
+// This function determines the upper bandwidth of the given dense matrix, i.e. the distance
+// of the outermost non-default element above the main diagonal. In case the given matrix is
+// a computation, the bandwidth is not determined element-wise and the function conservatively
+// returns the maximum possible bandwidth.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t upperBandwidth( const DenseMatrix<MT,SO>& m )
+{
+   if( IsLower<MT>::value || (~m).columns() < 2UL )
+      return 0UL;
+
+   if( IsComputation<MT>::value )
+      return (~m).columns() - 1UL;
+
+   const size_t M( (~m).rows()    );
+   const size_t N( (~m).columns() );
+
+   size_t ku( 0UL );
+
+   for( size_t j=1UL; j<N; ++j ) {
+      for( size_t i=0UL; i<M && i+ku<j; ++i ) {
+         if( !isDefault( (~m)(i,j) ) ) {
+            ku = j - i;
+            break;
+         }
+      }
+   }
+
+   return ku;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the upper bandwidth of the given sparse matrix.
+// \ingroup band_matrix
+//
+// \param m The given sparse matrix.
+// \return The number of non-zero diagonals above the main diagonal.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline size_t upperBandwidth( const SparseMatrix<MT,SO>& m )
+{
+   if( IsLower<MT>::value || (~m).columns() < 2UL )
+      return 0UL;
+
+   if( IsComputation<MT>::value )
+      return (~m).columns() - 1UL;
+
+   size_t ku( 0UL );
+
+   for( size_t i=0UL; i<( SO ? (~m).columns() : (~m).rows() ); ++i ) {
+      for( auto element=(~m).begin(i); element!=(~m).end(i); ++element ) {
+         const size_t row   ( SO ? element->index() : i );
+         const size_t column( SO ? i : element->index() );
+         if( column > row + ku && !isDefault( element->value() ) )
+            ku = column - row;
+      }
+   }
+
+   return ku;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the upper bandwidth of the given band matrix.
+// \ingroup band_matrix
+//
+// \param m The given band matrix.
+// \return The number of stored diagonals above the main diagonal.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t upperBandwidth( const BandMatrix<Type,SO>& m )
+{
+   return m.upperBandwidth();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the upper bandwidth of the given dense matrix addition.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix addition expression.
+// \return The upper bandwidth of the addition result.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO >     // Storage order
+inline size_t upperBandwidth( const DMatDMatAddExpr<MT1,MT2,SO>& m )
+{
+   using blaze::max;
+
+   return max( upperBandwidth( m.leftOperand() ), upperBandwidth( m.rightOperand() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the upper bandwidth of the given dense matrix addition.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix addition expression.
+// \return The upper bandwidth of the addition result.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline size_t upperBandwidth( const DMatTDMatAddExpr<MT1,MT2>& m )
+{
+   using blaze::max;
+
+   return max( upperBandwidth( m.leftOperand() ), upperBandwidth( m.rightOperand() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the upper bandwidth of the given dense matrix subtraction.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix subtraction expression.
+// \return The upper bandwidth of the subtraction result.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO >     // Storage order
+inline size_t upperBandwidth( const DMatDMatSubExpr<MT1,MT2,SO>& m )
+{
+   using blaze::max;
+
+   return max( upperBandwidth( m.leftOperand() ), upperBandwidth( m.rightOperand() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the upper bandwidth of the given dense matrix subtraction.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix subtraction expression.
+// \return The upper bandwidth of the subtraction result.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline size_t upperBandwidth( const DMatTDMatSubExpr<MT1,MT2>& m )
+{
+   using blaze::max;
+
+   return max( upperBandwidth( m.leftOperand() ), upperBandwidth( m.rightOperand() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the upper bandwidth of the given dense matrix multiplication.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix multiplication expression.
+// \return The upper bandwidth of the multiplication result.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline size_t upperBandwidth( const DMatDMatMultExpr<MT1,MT2>& m )
+{
+   if( m.columns() < 2UL )
+      return 0UL;
+
+   const size_t k( upperBandwidth( m.leftOperand() ) + upperBandwidth( m.rightOperand() ) );
+
+   return ( k < m.columns() )?( k ):( m.columns() - 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the upper bandwidth of the given dense matrix multiplication.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix multiplication expression.
+// \return The upper bandwidth of the multiplication result.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline size_t upperBandwidth( const DMatTDMatMultExpr<MT1,MT2>& m )
+{
+   if( m.columns() < 2UL )
+      return 0UL;
+
+   const size_t k( upperBandwidth( m.leftOperand() ) + upperBandwidth( m.rightOperand() ) );
+
+   return ( k < m.columns() )?( k ):( m.columns() - 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the upper bandwidth of the given dense matrix multiplication.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix multiplication expression.
+// \return The upper bandwidth of the multiplication result.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline size_t upperBandwidth( const TDMatDMatMultExpr<MT1,MT2>& m )
+{
+   if( m.columns() < 2UL )
+      return 0UL;
+
+   const size_t k( upperBandwidth( m.leftOperand() ) + upperBandwidth( m.rightOperand() ) );
+
+   return ( k < m.columns() )?( k ):( m.columns() - 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the upper bandwidth of the given dense matrix multiplication.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix multiplication expression.
+// \return The upper bandwidth of the multiplication result.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline size_t upperBandwidth( const TDMatTDMatMultExpr<MT1,MT2>& m )
+{
+   if( m.columns() < 2UL )
+      return 0UL;
+
+   const size_t k( upperBandwidth( m.leftOperand() ) + upperBandwidth( m.rightOperand() ) );
+
+   return ( k < m.columns() )?( k ):( m.columns() - 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the upper bandwidth of the given dense matrix/scalar multiplication.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix/scalar multiplication expression.
+// \return The upper bandwidth of the dense matrix operand.
+*/
+template< typename MT  // Type of the left-hand side dense matrix
+        , typename ST  // Type of the right-hand side scalar value
+        , bool SO >    // Storage order
+inline size_t upperBandwidth( const DMatScalarMultExpr<MT,ST,SO>& m )
+{
+   return upperBandwidth( m.leftOperand() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the upper bandwidth of the given dense matrix/scalar division.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix/scalar division expression.
+// \return The upper bandwidth of the dense matrix operand.
+*/
+template< typename MT  // Type of the left-hand side dense matrix
+        , typename ST  // Type of the right-hand side scalar value
+        , bool SO >    // Storage order
+inline size_t upperBandwidth( const DMatScalarDivExpr<MT,ST,SO>& m )
+{
+   return upperBandwidth( m.leftOperand() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the upper bandwidth of the given dense matrix transposition.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix transposition expression.
+// \return The lower bandwidth of the dense matrix operand.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t upperBandwidth( const DMatTransExpr<MT,SO>& m )
+{
+   return lowerBandwidth( m.operand() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the upper bandwidth of the given dense matrix serialization.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix serialization expression.
+// \return The upper bandwidth of the dense matrix operand.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t upperBandwidth( const DMatSerialExpr<MT,SO>& m )
+{
+   return upperBandwidth( m.operand() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the upper bandwidth of the given dense matrix evaluation.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix evaluation expression.
+// \return The upper bandwidth of the dense matrix operand.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t upperBandwidth( const DMatEvalExpr<MT,SO>& m )
+{
+   return upperBandwidth( m.operand() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the upper bandwidth of the given dense matrix for-each operation.
+// \ingroup band_matrix
+//
+// \param m The given dense matrix for-each expression.
+// \return The upper bandwidth of the for-each result.
+//
+// In case the custom operation maps a default element to a default element, the bandwidth of
+// the dense matrix operand is preserved. Otherwise the maximum possible bandwidth is returned.
+*/
+template< typename MT  // Type of the dense matrix
+        , typename OP  // Type of the custom operation
+        , bool SO >    // Storage order
+inline size_t upperBandwidth( const DMatForEachExpr<MT,OP,SO>& m )
+{
+   if( m.columns() < 2UL )
+      return 0UL;
+
+   if( isDefault( m.operation()( ElementType_<MT>() ) ) )
+      return upperBandwidth( m.operand() );
+
+   return m.columns() - 1UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISBANDED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsBanded< BandMatrix<T,SO> > : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsResizable< BandMatrix<T,SO> > : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, size_t M, size_t N >
+struct AddTrait< BandMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< BandMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, false >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2 >
+struct AddTrait< StaticMatrix<T1,M,N,SO>, BandMatrix<T2,SO> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct AddTrait< StaticMatrix<T1,M,N,SO1>, BandMatrix<T2,SO2> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, false >;
+};
+
+template< typename T1, bool SO, typename T2, size_t M, size_t N >
+struct AddTrait< BandMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< BandMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, false >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2 >
+struct AddTrait< HybridMatrix<T1,M,N,SO>, BandMatrix<T2,SO> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct AddTrait< HybridMatrix<T1,M,N,SO1>, BandMatrix<T2,SO2> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, false >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct AddTrait< BandMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< BandMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct AddTrait< DynamicMatrix<T1,SO>, BandMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< DynamicMatrix<T1,SO1>, BandMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct AddTrait< BandMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< BandMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct AddTrait< CompressedMatrix<T1,SO>, BandMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< CompressedMatrix<T1,SO1>, BandMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2, bool AF, bool PF >
+struct AddTrait< BandMatrix<T1,SO>, CustomMatrix<T2,AF,PF,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool AF, bool PF, bool SO2 >
+struct AddTrait< BandMatrix<T1,SO1>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO, typename T2 >
+struct AddTrait< CustomMatrix<T1,AF,PF,SO>, BandMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, bool SO2 >
+struct AddTrait< CustomMatrix<T1,AF,PF,SO1>, BandMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct AddTrait< BandMatrix<T1,SO>, BandMatrix<T2,SO> >
+{
+   using Type = BandMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< BandMatrix<T1,SO1>, BandMatrix<T2,SO2> >
+{
+   using Type = BandMatrix< AddTrait_<T1,T2>, false >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, size_t M, size_t N >
+struct SubTrait< BandMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< BandMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, false >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2 >
+struct SubTrait< StaticMatrix<T1,M,N,SO>, BandMatrix<T2,SO> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct SubTrait< StaticMatrix<T1,M,N,SO1>, BandMatrix<T2,SO2> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, false >;
+};
+
+template< typename T1, bool SO, typename T2, size_t M, size_t N >
+struct SubTrait< BandMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< BandMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, false >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2 >
+struct SubTrait< HybridMatrix<T1,M,N,SO>, BandMatrix<T2,SO> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct SubTrait< HybridMatrix<T1,M,N,SO1>, BandMatrix<T2,SO2> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, false >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct SubTrait< BandMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< BandMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct SubTrait< DynamicMatrix<T1,SO>, BandMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< DynamicMatrix<T1,SO1>, BandMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct SubTrait< BandMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< BandMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct SubTrait< CompressedMatrix<T1,SO>, BandMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< CompressedMatrix<T1,SO1>, BandMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2, bool AF, bool PF >
+struct SubTrait< BandMatrix<T1,SO>, CustomMatrix<T2,AF,PF,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool AF, bool PF, bool SO2 >
+struct SubTrait< BandMatrix<T1,SO1>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO, typename T2 >
+struct SubTrait< CustomMatrix<T1,AF,PF,SO>, BandMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, bool SO2 >
+struct SubTrait< CustomMatrix<T1,AF,PF,SO1>, BandMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct SubTrait< BandMatrix<T1,SO>, BandMatrix<T2,SO> >
+{
+   using Type = BandMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< BandMatrix<T1,SO1>, BandMatrix<T2,SO2> >
+{
+   using Type = BandMatrix< SubTrait_<T1,T2>, false >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2 >
+struct MultTrait< BandMatrix<T1,SO>, T2, EnableIf_< IsNumeric<T2> > >
+{
+   using Type = BandMatrix< MultTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, typename T2, bool SO >
+struct MultTrait< T1, BandMatrix<T2,SO>, EnableIf_< IsNumeric<T1> > >
+{
+   using Type = BandMatrix< MultTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO, typename T2, size_t N >
+struct MultTrait< BandMatrix<T1,SO>, StaticVector<T2,N,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, size_t N, typename T2, bool SO >
+struct MultTrait< StaticVector<T1,N,true>, BandMatrix<T2,SO> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO, typename T2, size_t N >
+struct MultTrait< BandMatrix<T1,SO>, HybridVector<T2,N,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, size_t N, typename T2, bool SO >
+struct MultTrait< HybridVector<T1,N,true>, BandMatrix<T2,SO> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct MultTrait< BandMatrix<T1,SO>, DynamicVector<T2,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, typename T2, bool SO >
+struct MultTrait< DynamicVector<T1,true>, BandMatrix<T2,SO> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO, typename T2, bool AF, bool PF >
+struct MultTrait< BandMatrix<T1,SO>, CustomVector<T2,AF,PF,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool AF, bool PF, typename T2, bool SO >
+struct MultTrait< CustomVector<T1,AF,PF,true>, BandMatrix<T2,SO> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct MultTrait< BandMatrix<T1,SO>, CompressedVector<T2,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, typename T2, bool SO >
+struct MultTrait< CompressedVector<T1,true>, BandMatrix<T2,SO> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< BandMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, BandMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< BandMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, BandMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< BandMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< DynamicMatrix<T1,SO1>, BandMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool AF, bool PF, bool SO2 >
+struct MultTrait< BandMatrix<T1,SO1>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, bool SO2 >
+struct MultTrait< CustomMatrix<T1,AF,PF,SO1>, BandMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< BandMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< CompressedMatrix<T1,SO1>, BandMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< BandMatrix<T1,SO1>, BandMatrix<T2,SO2> >
+{
+   using Type = BandMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2 >
+struct DivTrait< BandMatrix<T1,SO>, T2, EnableIf_< IsNumeric<T2> > >
+{
+   using Type = BandMatrix< DivTrait_<T1,T2>, SO >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2 >
+struct MathTrait< BandMatrix<T1,SO>, BandMatrix<T2,SO> >
+{
+   using HighType = BandMatrix< typename MathTrait<T1,T2>::HighType, SO >;
+   using LowType  = BandMatrix< typename MathTrait<T1,T2>::LowType , SO >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct SubmatrixTrait< BandMatrix<T1,SO> >
+{
+   using Type = DynamicMatrix<T1,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct RowTrait< BandMatrix<T1,SO> >
+{
+   using Type = DynamicVector<T1,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct ColumnTrait< BandMatrix<T1,SO> >
+{
+   using Type = DynamicVector<T1,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
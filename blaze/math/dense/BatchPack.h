@@ -0,0 +1,446 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BatchPack.h
+//  \brief Header file for the BatchPack class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BATCHPACK_H_
+#define _BLAZE_MATH_DENSE_BATCHPACK_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDDiv.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSqrt.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pack of the elements of several interleaved small matrices.
+// \ingroup dense_matrix
+//
+// The BatchPack class template represents one element of several small matrices or vectors at
+// once, i.e. lane \a k of a BatchPack holds the according element of matrix \a k. It is the
+// element type of the batched kernels of the StaticMatrixBatch and StaticVectorBatch classes.
+// In contrast to the SIMD types, all arithmetic operators are evaluated immediately and the
+// unary minus operator is available. This enables the reuse of the closed form formulas of the
+// small matrix inversion and determinant functions for the batched kernels, which are written
+// in terms of the element type and the function call operator only.
+//
+// In case the required SIMD operations are not available for the given data type (as for
+// instance in case no SIMD instruction set is enabled), a BatchPack contains a single value of
+// the given data type and the batched kernels fall back to a scalar evaluation. The fused
+// vector kernels of the iterative solvers use the BatchPack class template in the same way for
+// consecutive elements of a single vector.
+*/
+template< typename Type >  // Data type of the elements
+struct BatchPack
+{
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for the SIMD evaluation of the batched kernels.
+   enum : bool { vectorizable = HasSIMDAdd <Type,Type>::value &&
+                                HasSIMDSub <Type,Type>::value &&
+                                HasSIMDMult<Type,Type>::value &&
+                                HasSIMDDiv <Type,Type>::value &&
+                                HasSIMDSqrt<Type>::value };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   //! Type of the packed value.
+   using ValueType = If_< BoolConstant<vectorizable>, SIMDTrait_<Type>, Type >;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! The number of elements packed within a single BatchPack.
+   enum : size_t { size = ( vectorizable )?( SIMDTrait<Type>::size ):( 1UL ) };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\brief The default constructor for BatchPack.
+   */
+   BLAZE_ALWAYS_INLINE BatchPack() noexcept
+      : value()  // The packed value
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Constructor for the given packed value.
+   //
+   // \param v The packed value.
+   */
+   BLAZE_ALWAYS_INLINE BatchPack( const ValueType& v ) noexcept
+      : value( v )  // The packed value
+   {}
+   //**********************************************************************************************
+
+   //**Load, store and set functions***************************************************************
+   /*!\brief Aligned load of a pack of elements.
+   //
+   // \param address The first element of the pack.
+   // \return The loaded pack.
+   */
+   static BLAZE_ALWAYS_INLINE const BatchPack load( const Type* address ) noexcept
+   {
+      return load( address, BoolConstant<vectorizable>() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Aligned store of a pack of elements.
+   //
+   // \param address The target address of the first element of the pack.
+   // \param pack The pack to be stored.
+   // \return void
+   */
+   static BLAZE_ALWAYS_INLINE void store( Type* address, const BatchPack& pack ) noexcept
+   {
+      store( address, pack, BoolConstant<vectorizable>() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Setting all elements of a pack to the given value.
+   //
+   // \param v The given value.
+   // \return The resulting pack.
+   */
+   static BLAZE_ALWAYS_INLINE const BatchPack set( Type v ) noexcept
+   {
+      return set( v, BoolConstant<vectorizable>() );
+   }
+   //**********************************************************************************************
+
+   //**Arithmetic assignment operators*************************************************************
+   /*!\brief Addition assignment of a pack.
+   //
+   // \param rhs The right-hand side pack.
+   // \return Reference to the pack.
+   */
+   BLAZE_ALWAYS_INLINE BatchPack& operator+=( const BatchPack& rhs ) noexcept
+   {
+      value = ValueType( value + rhs.value );
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Subtraction assignment of a pack.
+   //
+   // \param rhs The right-hand side pack.
+   // \return Reference to the pack.
+   */
+   BLAZE_ALWAYS_INLINE BatchPack& operator-=( const BatchPack& rhs ) noexcept
+   {
+      value = ValueType( value - rhs.value );
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Multiplication assignment of a pack.
+   //
+   // \param rhs The right-hand side pack.
+   // \return Reference to the pack.
+   */
+   BLAZE_ALWAYS_INLINE BatchPack& operator*=( const BatchPack& rhs ) noexcept
+   {
+      value = ValueType( value * rhs.value );
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Division assignment of a pack.
+   //
+   // \param rhs The right-hand side pack.
+   // \return Reference to the pack.
+   */
+   BLAZE_ALWAYS_INLINE BatchPack& operator/=( const BatchPack& rhs ) noexcept
+   {
+      value = ValueType( value / rhs.value );
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   ValueType value;  //!< The packed value.
+   //**********************************************************************************************
+
+ private:
+   //**Load, store and set backends****************************************************************
+   /*!\brief SIMD load of a pack of elements.
+   */
+   static BLAZE_ALWAYS_INLINE const BatchPack load( const Type* address, TrueType ) noexcept
+   {
+      return loada( address );
+   }
+
+   /*!\brief Scalar load of a pack of elements.
+   */
+   static BLAZE_ALWAYS_INLINE const BatchPack load( const Type* address, FalseType ) noexcept
+   {
+      return *address;
+   }
+
+   /*!\brief SIMD store of a pack of elements.
+   */
+   static BLAZE_ALWAYS_INLINE void store( Type* address, const BatchPack& pack, TrueType ) noexcept
+   {
+      storea( address, pack.value );
+   }
+
+   /*!\brief Scalar store of a pack of elements.
+   */
+   static BLAZE_ALWAYS_INLINE void store( Type* address, const BatchPack& pack, FalseType ) noexcept
+   {
+      *address = pack.value;
+   }
+
+   /*!\brief SIMD broadcast of a value.
+   */
+   static BLAZE_ALWAYS_INLINE const BatchPack set( Type v, TrueType ) noexcept
+   {
+      return blaze::set( v );
+   }
+
+   /*!\brief Scalar broadcast of a value.
+   */
+   static BLAZE_ALWAYS_INLINE const BatchPack set( Type v, FalseType ) noexcept
+   {
+      return v;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition of two packs.
+// \ingroup dense_matrix
+//
+// \param a The left-hand side pack.
+// \param b The right-hand side pack.
+// \return The result of the addition.
+*/
+template< typename Type >  // Data type of the elements
+BLAZE_ALWAYS_INLINE const BatchPack<Type>
+   operator+( const BatchPack<Type>& a, const BatchPack<Type>& b ) noexcept
+{
+   using ValueType = typename BatchPack<Type>::ValueType;
+   return ValueType( a.value + b.value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction of two packs.
+// \ingroup dense_matrix
+//
+// \param a The left-hand side pack.
+// \param b The right-hand side pack.
+// \return The result of the subtraction.
+*/
+template< typename Type >  // Data type of the elements
+BLAZE_ALWAYS_INLINE const BatchPack<Type>
+   operator-( const BatchPack<Type>& a, const BatchPack<Type>& b ) noexcept
+{
+   using ValueType = typename BatchPack<Type>::ValueType;
+   return ValueType( a.value - b.value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Negation of a pack.
+// \ingroup dense_matrix
+//
+// \param a The pack to be negated.
+// \return The negated pack.
+*/
+template< typename Type >  // Data type of the elements
+BLAZE_ALWAYS_INLINE const BatchPack<Type> operator-( const BatchPack<Type>& a ) noexcept
+{
+   using ValueType = typename BatchPack<Type>::ValueType;
+   return ValueType( ValueType() - a.value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of two packs.
+// \ingroup dense_matrix
+//
+// \param a The left-hand side pack.
+// \param b The right-hand side pack.
+// \return The result of the multiplication.
+*/
+template< typename Type >  // Data type of the elements
+BLAZE_ALWAYS_INLINE const BatchPack<Type>
+   operator*( const BatchPack<Type>& a, const BatchPack<Type>& b ) noexcept
+{
+   using ValueType = typename BatchPack<Type>::ValueType;
+   return ValueType( a.value * b.value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Division of two packs.
+// \ingroup dense_matrix
+//
+// \param a The left-hand side pack.
+// \param b The right-hand side pack.
+// \return The result of the division.
+*/
+template< typename Type >  // Data type of the elements
+BLAZE_ALWAYS_INLINE const BatchPack<Type>
+   operator/( const BatchPack<Type>& a, const BatchPack<Type>& b ) noexcept
+{
+   using ValueType = typename BatchPack<Type>::ValueType;
+   return ValueType( a.value / b.value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the square root of each element of a pack.
+// \ingroup dense_matrix
+//
+// \param a The given pack.
+// \return The resulting pack.
+*/
+template< typename Type >  // Data type of the elements
+BLAZE_ALWAYS_INLINE const BatchPack<Type> sqrt( const BatchPack<Type>& a ) noexcept
+{
+   using ValueType = typename BatchPack<Type>::ValueType;
+   return ValueType( sqrt( a.value ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the complex conjugate of each element of a pack.
+// \ingroup dense_matrix
+//
+// \param a The given pack.
+// \return The resulting pack.
+*/
+template< typename Type >  // Data type of the elements
+BLAZE_ALWAYS_INLINE const BatchPack<Type> conj( const BatchPack<Type>& a ) noexcept
+{
+   using ValueType = typename BatchPack<Type>::ValueType;
+   return ValueType( conj( a.value ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the sum of all elements of a SIMD pack.
+// \ingroup dense_matrix
+//
+// \param a The given pack.
+// \return The sum of all elements of the pack.
+*/
+template< typename Type >  // Data type of the elements
+BLAZE_ALWAYS_INLINE EnableIf_< BoolConstant< BatchPack<Type>::vectorizable >, Type >
+   sum( const BatchPack<Type>& a ) noexcept
+{
+   return sum( a.value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the sum of all elements of a scalar pack.
+// \ingroup dense_matrix
+//
+// \param a The given pack.
+// \return The single element of the pack.
+*/
+template< typename Type >  // Data type of the elements
+BLAZE_ALWAYS_INLINE DisableIf_< BoolConstant< BatchPack<Type>::vectorizable >, Type >
+   sum( const BatchPack<Type>& a ) noexcept
+{
+   return a.value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
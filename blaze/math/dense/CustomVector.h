@@ -2245,7 +2245,7 @@ inline EnableIf_<typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE Vectorized
    const size_t ipos( size_ & size_t(-SIMDSIZE) );
    BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
 
-   if( AF && useStreaming && size_ > ( cacheSize/( sizeof(Type) * 3UL ) ) && !(~rhs).isAliased( this ) )
+   if( AF && useStreaming && size_ > streamingThreshold( sizeof(Type) ) && !(~rhs).isAliased( this ) )
    {
       size_t i( 0UL );
 
@@ -4493,7 +4493,7 @@ inline EnableIf_<typename CustomVector<Type,AF,padded,TF>::BLAZE_TEMPLATE Vector
    const size_t ipos( ( remainder )?( size_ & size_t(-SIMDSIZE) ):( size_ ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( size_ - ( size_ % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
 
-   if( AF && useStreaming && size_ > ( cacheSize/( sizeof(Type) * 3UL ) ) && !(~rhs).isAliased( this ) )
+   if( AF && useStreaming && size_ > streamingThreshold( sizeof(Type) ) && !(~rhs).isAliased( this ) )
    {
       size_t i( 0UL );
 
@@ -102,6 +102,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/NumaPolicy.h>
 #include <blaze/util/Template.h>
 #include <blaze/util/TrueType.h>
 #include <blaze/util/Types.h>
@@ -528,6 +529,9 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
    if( IsVectorizable<Type>::value ) {
+      if( numaPolicy() == NumaPolicy::firstTouch )
+         smpFill( *this, Type() );
+
       for( size_t i=0UL; i<m_; ++i ) {
          for( size_t j=n_; j<nn_; ++j ) {
             v_[i*nn_+j] = Type();
@@ -558,14 +562,19 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& in
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t i=0UL; i<m; ++i ) {
-      for( size_t j=0UL; j<n_; ++j )
-         v_[i*nn_+j] = init;
+   if( numaPolicy() == NumaPolicy::firstTouch ) {
+      smpFill( *this, init );
+   }
+   else {
+      for( size_t i=0UL; i<m_; ++i )
+         for( size_t j=0UL; j<n_; ++j )
+            v_[i*nn_+j] = init;
+   }
 
-      if( IsVectorizable<Type>::value ) {
+   if( IsVectorizable<Type>::value ) {
+      for( size_t i=0UL; i<m_; ++i )
          for( size_t j=n_; j<nn_; ++j )
             v_[i*nn_+j] = Type();
-      }
    }
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
@@ -2367,7 +2376,7 @@ inline EnableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAssig
    BLAZE_INTERNAL_ASSERT( !remainder || ( n_ - ( n_ % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
 
    if( usePadding && useStreaming &&
-       ( m_*n_ > ( cacheSize / ( sizeof(Type) * 3UL ) ) ) && !(~rhs).isAliased( this ) )
+       ( m_*n_ > streamingThreshold( sizeof(Type) ) ) && !(~rhs).isAliased( this ) )
    {
       for( size_t i=0UL; i<m_; ++i )
       {
@@ -3264,6 +3273,9 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
    if( IsVectorizable<Type>::value ) {
+      if( numaPolicy() == NumaPolicy::firstTouch )
+         smpFill( *this, Type() );
+
       for( size_t j=0UL; j<n_; ++j ) {
          for( size_t i=m_; i<mm_; ++i ) {
             v_[i+j*mm_] = Type();
@@ -3295,14 +3307,19 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type&
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=0UL; i<m_; ++i )
-         v_[i+j*mm_] = init;
+   if( numaPolicy() == NumaPolicy::firstTouch ) {
+      smpFill( *this, init );
+   }
+   else {
+      for( size_t j=0UL; j<n_; ++j )
+         for( size_t i=0UL; i<m_; ++i )
+            v_[i+j*mm_] = init;
+   }
 
-      if( IsVectorizable<Type>::value ) {
+   if( IsVectorizable<Type>::value ) {
+      for( size_t j=0UL; j<n_; ++j )
          for( size_t i=m_; i<mm_; ++i )
             v_[i+j*mm_] = Type();
-      }
    }
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
@@ -5141,7 +5158,7 @@ inline EnableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAss
    BLAZE_INTERNAL_ASSERT( !remainder || ( m_ - ( m_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
 
    if( usePadding && useStreaming &&
-       ( m_*n_ > ( cacheSize / ( sizeof(Type) * 3UL ) ) ) && !(~rhs).isAliased( this ) )
+       ( m_*n_ > streamingThreshold( sizeof(Type) ) ) && !(~rhs).isAliased( this ) )
    {
       for( size_t j=0UL; j<n_; ++j )
       {
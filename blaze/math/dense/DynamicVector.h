@@ -92,6 +92,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/NumaPolicy.h>
 #include <blaze/util/Template.h>
 #include <blaze/util/TrueType.h>
 #include <blaze/util/Types.h>
@@ -513,6 +514,9 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
    if( IsVectorizable<Type>::value ) {
+      if( numaPolicy() == NumaPolicy::firstTouch )
+         smpFill( *this, Type() );
+
       for( size_t i=size_; i<capacity_; ++i )
          v_[i] = Type();
    }
@@ -537,8 +541,13 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
    , capacity_( adjustCapacity( n ) )          // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
-   for( size_t i=0UL; i<size_; ++i )
-      v_[i] = init;
+   if( numaPolicy() == NumaPolicy::firstTouch ) {
+      smpFill( *this, init );
+   }
+   else {
+      for( size_t i=0UL; i<size_; ++i )
+         v_[i] = init;
+   }
 
    if( IsVectorizable<Type>::value ) {
       for( size_t i=size_; i<capacity_; ++i )
@@ -1963,7 +1972,7 @@ inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAssig
    Iterator left( begin() );
    ConstIterator_<VT> right( (~rhs).begin() );
 
-   if( useStreaming && size_ > ( cacheSize/( sizeof(Type) * 3UL ) ) && !(~rhs).isAliased( this ) )
+   if( useStreaming && size_ > streamingThreshold( sizeof(Type) ) && !(~rhs).isAliased( this ) )
    {
       for( ; i<ipos; i+=SIMDSIZE ) {
          left.stream( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
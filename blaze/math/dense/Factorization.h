@@ -0,0 +1,1189 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Factorization.h
+//  \brief Header file for the native blocked dense matrix factorization kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_FACTORIZATION_H_
+#define _BLAZE_MATH_DENSE_FACTORIZATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <boost/cast.hpp>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE DENSE MATRIX FACTORIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Native dense matrix factorization functions */
+//@{
+template< typename MT, bool SO >
+void blockedGetrf( DenseMatrix<MT,SO>& A, int* ipiv );
+
+template< typename MT, bool SO >
+void blockedGetri( DenseMatrix<MT,SO>& A, const int* ipiv );
+
+template< typename MT, bool SO >
+void blockedPotrf( DenseMatrix<MT,SO>& A, char uplo );
+
+template< typename MT, bool SO >
+void blockedPotri( DenseMatrix<MT,SO>& A, char uplo );
+
+template< typename MT, bool SO >
+void blockedTrtri( DenseMatrix<MT,SO>& A, char uplo, char diag );
+
+template< typename MT, bool SO >
+void blockedGeqrf( DenseMatrix<MT,SO>& A, ElementType_<MT>* tau );
+
+template< typename MT, bool SO >
+void blockedOrgqr( DenseMatrix<MT,SO>& A, const ElementType_<MT>* tau );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the blocked LU decomposition with partial pivoting by row interchanges.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+//
+// This function computes the right-looking blocked LU decomposition \f$ A = P \cdot L \cdot U \f$
+// of the given matrix. Each panel of DECOMPOSITION_BLOCK_SIZE columns is factorized by rank-1
+// updates, the corresponding block row of \c U is computed by a forward substitution, and the
+// trailing matrix is updated by a single dense matrix multiplication, which is handled by the
+// vectorized (and if enabled parallel) multiplication kernels of Blaze. The pivot indices are
+// stored 1-based, as by the LAPACK getrf() functions.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void getrfBackend( DenseMatrix<MT,SO>& A, int* ipiv )
+{
+   using boost::numeric_cast;
+   using std::swap;
+
+   typedef ElementType_<MT>         ET;
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   const size_t m( (~A).rows()    );
+   const size_t n( (~A).columns() );
+   const size_t mindim( min( m, n ) );
+
+   for( size_t k=0UL; k<mindim; k+=DECOMPOSITION_BLOCK_SIZE )
+   {
+      const size_t kend( min( k+DECOMPOSITION_BLOCK_SIZE, mindim ) );
+
+      for( size_t j=k; j<kend; ++j )
+      {
+         size_t pivot( j );
+         BT maximum( abs( (~A)(j,j) ) );
+
+         for( size_t i=j+1UL; i<m; ++i ) {
+            const BT tmp( abs( (~A)(i,j) ) );
+            if( tmp > maximum ) {
+               maximum = tmp;
+               pivot   = i;
+            }
+         }
+
+         ipiv[j] = numeric_cast<int>( pivot+1UL );
+
+         if( pivot != j ) {
+            for( size_t l=0UL; l<n; ++l ) {
+               swap( (~A)(j,l), (~A)(pivot,l) );
+            }
+         }
+
+         const ET diagonal( (~A)(j,j) );
+
+         if( !isDefault( diagonal ) ) {
+            for( size_t i=j+1UL; i<m; ++i ) {
+               (~A)(i,j) /= diagonal;
+            }
+         }
+
+         for( size_t l=j+1UL; l<kend; ++l ) {
+            const ET tmp( (~A)(j,l) );
+            for( size_t i=j+1UL; i<m; ++i ) {
+               (~A)(i,l) -= (~A)(i,j) * tmp;
+            }
+         }
+      }
+
+      if( kend < n )
+      {
+         for( size_t l=kend; l<n; ++l ) {
+            for( size_t j=k; j<kend; ++j ) {
+               const ET tmp( (~A)(j,l) );
+               for( size_t i=j+1UL; i<kend; ++i ) {
+                  (~A)(i,l) -= (~A)(i,j) * tmp;
+               }
+            }
+         }
+
+         if( kend < m ) {
+            auto A22( submatrix( ~A, kend, kend, m-kend, n-kend ) );
+            A22 -= submatrix( ~A, kend, k, m-kend, kend-k ) * submatrix( ~A, k, kend, kend-k, n-kend );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the in-place inversion of a lower triangular matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix containing the lower triangular matrix.
+// \param k The index of the first row/column of the triangular matrix.
+// \param n The number of rows/columns of the triangular matrix.
+// \param unit \a true in case of a unitriangular matrix, \a false if not.
+// \return void
+//
+// This function recursively inverts the lower triangular \a n-by-\a n diagonal block of \a A
+// starting at row/column \a k. Only the lower part of the diagonal block is accessed. The
+// off-diagonal block of each recursion level is computed by two dense matrix multiplications
+// with copies of the inverted diagonal blocks. The function expects all diagonal elements of
+// a non-unitriangular matrix to be invertible.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void trtriLowerBackend( DenseMatrix<MT,SO>& A, size_t k, size_t n, bool unit )
+{
+   typedef ElementType_<MT>  ET;
+
+   if( n <= DECOMPOSITION_BLOCK_SIZE )
+   {
+      for( size_t j=k+n; j-- > k; )
+      {
+         ET ajj( -1 );
+
+         if( !unit ) {
+            (~A)(j,j) = ET(1) / (~A)(j,j);
+            ajj = -(~A)(j,j);
+         }
+
+         for( size_t i=k+n; --i > j; ) {
+            ET tmp( unit ? (~A)(i,j) : (~A)(i,i) * (~A)(i,j) );
+            for( size_t l=j+1UL; l<i; ++l ) {
+               tmp += (~A)(i,l) * (~A)(l,j);
+            }
+            (~A)(i,j) = tmp * ajj;
+         }
+      }
+
+      return;
+   }
+
+   const size_t n1( n / 2UL );
+   const size_t n2( n - n1 );
+
+   trtriLowerBackend( ~A, k, n1, unit );
+   trtriLowerBackend( ~A, k+n1, n2, unit );
+
+   DynamicMatrix<ET,SO> L11( n1, n1, ET(0) );
+   DynamicMatrix<ET,SO> L22( n2, n2, ET(0) );
+
+   for( size_t i=0UL; i<n1; ++i ) {
+      for( size_t j=0UL; j<i; ++j )
+         L11(i,j) = (~A)(k+i,k+j);
+      L11(i,i) = unit ? ET(1) : (~A)(k+i,k+i);
+   }
+
+   for( size_t i=0UL; i<n2; ++i ) {
+      for( size_t j=0UL; j<i; ++j )
+         L22(i,j) = (~A)(k+n1+i,k+n1+j);
+      L22(i,i) = unit ? ET(1) : (~A)(k+n1+i,k+n1+i);
+   }
+
+   auto A21( submatrix( ~A, k+n1, k, n2, n1 ) );
+   A21 = -( L22 * ( A21 * L11 ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the in-place inversion of an upper triangular matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix containing the upper triangular matrix.
+// \param k The index of the first row/column of the triangular matrix.
+// \param n The number of rows/columns of the triangular matrix.
+// \param unit \a true in case of a unitriangular matrix, \a false if not.
+// \return void
+//
+// This function recursively inverts the upper triangular \a n-by-\a n diagonal block of \a A
+// starting at row/column \a k. Only the upper part of the diagonal block is accessed. The
+// function expects all diagonal elements of a non-unitriangular matrix to be invertible.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void trtriUpperBackend( DenseMatrix<MT,SO>& A, size_t k, size_t n, bool unit )
+{
+   typedef ElementType_<MT>  ET;
+
+   if( n <= DECOMPOSITION_BLOCK_SIZE )
+   {
+      for( size_t j=k; j<k+n; ++j )
+      {
+         ET ajj( -1 );
+
+         if( !unit ) {
+            (~A)(j,j) = ET(1) / (~A)(j,j);
+            ajj = -(~A)(j,j);
+         }
+
+         for( size_t i=k; i<j; ++i ) {
+            ET tmp( unit ? (~A)(i,j) : (~A)(i,i) * (~A)(i,j) );
+            for( size_t l=i+1UL; l<j; ++l ) {
+               tmp += (~A)(i,l) * (~A)(l,j);
+            }
+            (~A)(i,j) = tmp * ajj;
+         }
+      }
+
+      return;
+   }
+
+   const size_t n1( n / 2UL );
+   const size_t n2( n - n1 );
+
+   trtriUpperBackend( ~A, k, n1, unit );
+   trtriUpperBackend( ~A, k+n1, n2, unit );
+
+   DynamicMatrix<ET,SO> U11( n1, n1, ET(0) );
+   DynamicMatrix<ET,SO> U22( n2, n2, ET(0) );
+
+   for( size_t i=0UL; i<n1; ++i ) {
+      U11(i,i) = unit ? ET(1) : (~A)(k+i,k+i);
+      for( size_t j=i+1UL; j<n1; ++j )
+         U11(i,j) = (~A)(k+i,k+j);
+   }
+
+   for( size_t i=0UL; i<n2; ++i ) {
+      U22(i,i) = unit ? ET(1) : (~A)(k+n1+i,k+n1+i);
+      for( size_t j=i+1UL; j<n2; ++j )
+         U22(i,j) = (~A)(k+n1+i,k+n1+j);
+   }
+
+   auto A12( submatrix( ~A, k, k+n1, n1, n2 ) );
+   A12 = -( U11 * ( A12 * U22 ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the in-place inversion of an LU decomposed matrix.
+// \ingroup dense_matrix
+//
+// \param A The LU decomposed square matrix.
+// \param ipiv The pivot indices of the LU decomposition computed by getrfBackend().
+// \return void
+//
+// This function computes the inverse \f$ A^{-1} = U^{-1} \cdot L^{-1} \cdot P^{T} \f$ of the LU
+// decomposed matrix \a A. First \c U is inverted in place, then the block columns of the inverse
+// are computed from right to left by solving \f$ X \cdot L = U^{-1} \f$, and finally the column
+// interchanges are applied in reverse order. The function expects all diagonal elements of \c U
+// to be invertible.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void getriBackend( DenseMatrix<MT,SO>& A, const int* ipiv )
+{
+   using std::swap;
+
+   typedef ElementType_<MT>  ET;
+
+   const size_t n( (~A).columns() );
+
+   trtriUpperBackend( ~A, 0UL, n, false );
+
+   const size_t jpos( ( ( n - 1UL ) / DECOMPOSITION_BLOCK_SIZE ) * DECOMPOSITION_BLOCK_SIZE );
+
+   for( size_t j=jpos+DECOMPOSITION_BLOCK_SIZE; j>0UL; )
+   {
+      j -= DECOMPOSITION_BLOCK_SIZE;
+
+      const size_t jend( min( j+DECOMPOSITION_BLOCK_SIZE, n ) );
+      const size_t jb( jend - j );
+
+      DynamicMatrix<ET,SO> W( n-j, jb, ET(0) );
+
+      for( size_t l=j; l<jend; ++l ) {
+         for( size_t i=l+1UL; i<n; ++i ) {
+            W(i-j,l-j) = (~A)(i,l);
+            reset( (~A)(i,l) );
+         }
+      }
+
+      auto X( submatrix( ~A, 0UL, j, n, jb ) );
+
+      if( jend < n ) {
+         X -= submatrix( ~A, 0UL, jend, n, n-jend ) * submatrix( W, jb, 0UL, n-jend, jb );
+      }
+
+      for( size_t l=jb; l-- > 0UL; ) {
+         for( size_t q=l+1UL; q<jb; ++q ) {
+            const ET tmp( W(q,l) );
+            for( size_t i=0UL; i<n; ++i ) {
+               X(i,l) -= X(i,q) * tmp;
+            }
+         }
+      }
+   }
+
+   for( size_t j=n; j-- > 0UL; ) {
+      const size_t jp( ipiv[j] - 1 );
+      if( jp != j ) {
+         for( size_t i=0UL; i<n; ++i ) {
+            swap( (~A)(i,j), (~A)(i,jp) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the blocked Cholesky decomposition of a positive definite matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \return void
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function computes the right-looking blocked Cholesky decomposition \f$ A = L \cdot L^{H}
+// \f$, where only the lower part of \a A is accessed and overwritten by \c L. Each panel of
+// DECOMPOSITION_BLOCK_SIZE columns is factorized by rank-1 updates and the lower part of the
+// trailing matrix is updated block column by block column, where all off-diagonal blocks are
+// updated by dense matrix multiplications.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void potrfBackend( DenseMatrix<MT,SO>& A )
+{
+   typedef ElementType_<MT>         ET;
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   const size_t n( (~A).rows() );
+
+   for( size_t k=0UL; k<n; k+=DECOMPOSITION_BLOCK_SIZE )
+   {
+      const size_t kend( min( k+DECOMPOSITION_BLOCK_SIZE, n ) );
+
+      for( size_t j=k; j<kend; ++j )
+      {
+         const BT diagonal( real( (~A)(j,j) ) );
+
+         if( !( diagonal > BT(0) ) ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Decomposition of non-positive-definite matrix failed" );
+         }
+
+         const BT ljj( sqrt( diagonal ) );
+
+         (~A)(j,j) = ljj;
+
+         for( size_t i=j+1UL; i<n; ++i ) {
+            (~A)(i,j) /= ljj;
+         }
+
+         if( SO ) {
+            for( size_t l=j+1UL; l<kend; ++l ) {
+               const ET tmp( conj( (~A)(l,j) ) );
+               for( size_t i=l; i<n; ++i ) {
+                  (~A)(i,l) -= (~A)(i,j) * tmp;
+               }
+            }
+         }
+         else {
+            for( size_t i=j+1UL; i<n; ++i ) {
+               const ET tmp( (~A)(i,j) );
+               const size_t lend( min( i+1UL, kend ) );
+               for( size_t l=j+1UL; l<lend; ++l ) {
+                  (~A)(i,l) -= tmp * conj( (~A)(l,j) );
+               }
+            }
+         }
+      }
+
+      for( size_t jj=kend; jj<n; jj+=DECOMPOSITION_BLOCK_SIZE )
+      {
+         const size_t jend( min( jj+DECOMPOSITION_BLOCK_SIZE, n ) );
+
+         for( size_t l=jj; l<jend; ++l ) {
+            for( size_t p=k; p<kend; ++p ) {
+               const ET tmp( conj( (~A)(l,p) ) );
+               for( size_t i=l; i<jend; ++i ) {
+                  (~A)(i,l) -= (~A)(i,p) * tmp;
+               }
+            }
+         }
+
+         if( jend < n ) {
+            auto A21( submatrix( ~A, jend, jj, n-jend, jend-jj ) );
+            A21 -= submatrix( ~A, jend, k, n-jend, kend-k ) * ctrans( submatrix( ~A, jj, k, jend-jj, kend-k ) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the in-place inversion of a Cholesky decomposed matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix containing the lower Cholesky factor \c L.
+// \return void
+//
+// This function computes the lower part of the inverse \f$ A^{-1} = L^{-H} \cdot L^{-1} \f$
+// from the lower Cholesky factor \c L. The function expects all diagonal elements of \c L
+// to be invertible.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void potriBackend( DenseMatrix<MT,SO>& A )
+{
+   typedef ElementType_<MT>  ET;
+
+   const size_t n( (~A).rows() );
+
+   trtriLowerBackend( ~A, 0UL, n, false );
+
+   DynamicMatrix<ET,SO> L( n, n, ET(0) );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<=i; ++j ) {
+         L(i,j) = (~A)(i,j);
+      }
+   }
+
+   const DynamicMatrix<ET,SO> B( ctrans( L ) * L );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<=i; ++j ) {
+         (~A)(i,j) = B(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of an elementary Householder reflector.
+// \ingroup dense_matrix
+//
+// \param A The matrix containing the column to be reflected.
+// \param j The index of the diagonal element of the column.
+// \return The scalar factor \c tau of the reflector.
+//
+// This function computes the elementary reflector \f$ H = I - \tau \cdot v \cdot v^{H} \f$
+// such that \f$ H^{H} \f$ annihilates all elements below the diagonal of the \a j-th column of
+// \a A. On exit the diagonal element contains \f$ \beta \f$ and the elements below the diagonal
+// contain the vector \c v (whose first element 1 is not stored), as by the LAPACK larfg()
+// functions.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+ElementType_<MT> householder( DenseMatrix<MT,SO>& A, size_t j )
+{
+   typedef ElementType_<MT>         ET;
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   const size_t m( (~A).rows() );
+
+   BT xnorm( 0 );
+   for( size_t i=j+1UL; i<m; ++i ) {
+      xnorm += real( conj( (~A)(i,j) ) * (~A)(i,j) );
+   }
+
+   const ET alpha( (~A)(j,j) );
+
+   if( isDefault( xnorm ) && isDefault( imag( alpha ) ) ) {
+      return ET(0);
+   }
+
+   const BT norm( sqrt( real( conj( alpha ) * alpha ) + xnorm ) );
+   const BT beta( ( real( alpha ) < BT(0) )?( norm ):( -norm ) );
+   const ET scale( ET(1) / ( alpha - beta ) );
+
+   for( size_t i=j+1UL; i<m; ++i ) {
+      (~A)(i,j) *= scale;
+   }
+
+   (~A)(j,j) = beta;
+
+   return ( beta - alpha ) / beta;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Application of an elementary Householder reflector to a range of columns.
+// \ingroup dense_matrix
+//
+// \param A The matrix containing the reflector and the columns to be updated.
+// \param j The index of the column containing the reflector \c v.
+// \param first The index of the first column to be updated.
+// \param last The index one past the last column to be updated.
+// \param tau The scalar factor to be applied.
+// \return void
+//
+// This function computes \f$ A = ( I - \tau \cdot v \cdot v^{H} ) \cdot A \f$ for the rows
+// [\a j..\a m) of the columns [\a first..\a last), where \c v is stored below the diagonal
+// element of the \a j-th column of \a A.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void applyHouseholder( DenseMatrix<MT,SO>& A, size_t j, size_t first, size_t last,
+                       const ElementType_<MT>& tau )
+{
+   typedef ElementType_<MT>  ET;
+
+   const size_t m( (~A).rows() );
+
+   for( size_t l=first; l<last; ++l )
+   {
+      ET tmp( (~A)(j,l) );
+      for( size_t i=j+1UL; i<m; ++i ) {
+         tmp += conj( (~A)(i,j) ) * (~A)(i,l);
+      }
+
+      tmp *= tau;
+
+      (~A)(j,l) -= tmp;
+      for( size_t i=j+1UL; i<m; ++i ) {
+         (~A)(i,l) -= (~A)(i,j) * tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setup of the compact WY representation of a block of Householder reflectors.
+// \ingroup dense_matrix
+//
+// \param A The matrix containing the Householder reflectors.
+// \param k The index of the first reflector.
+// \param kend The index one past the last reflector.
+// \param tau The scalar factors of the reflectors.
+// \param V The resulting matrix of reflector vectors.
+// \param T The resulting upper triangular factor.
+// \return void
+//
+// This function sets up the compact WY representation \f$ H_k \cdots H_{kend-1} = I - V \cdot
+// T \cdot V^{H} \f$ of the given block of Householder reflectors, as by the LAPACK larft()
+// functions (forward direction, columnwise storage).
+*/
+template< typename MT   // Type of the dense matrix
+        , bool SO       // Storage order of the dense matrix
+        , typename VT   // Type of the reflector matrix
+        , typename TT > // Type of the triangular factor
+void setupBlockReflector( const DenseMatrix<MT,SO>& A, size_t k, size_t kend,
+                          const ElementType_<MT>* tau, VT& V, TT& T )
+{
+   typedef ElementType_<MT>  ET;
+
+   const size_t m ( (~A).rows() );
+   const size_t kb( kend - k );
+
+   V.resize( m-k, kb, false );
+   reset( V );
+
+   for( size_t j=0UL; j<kb; ++j ) {
+      V(j,j) = ET(1);
+      for( size_t i=j+1UL; i<m-k; ++i ) {
+         V(i,j) = (~A)(k+i,k+j);
+      }
+   }
+
+   T.resize( kb, kb, false );
+   reset( T );
+
+   DynamicVector<ET,columnVector> w( kb );
+
+   for( size_t j=0UL; j<kb; ++j )
+   {
+      for( size_t l=0UL; l<j; ++l ) {
+         ET tmp( conj( V(j,l) ) );
+         for( size_t i=j+1UL; i<m-k; ++i ) {
+            tmp += conj( V(i,l) ) * V(i,j);
+         }
+         w[l] = -tau[k+j] * tmp;
+      }
+
+      for( size_t l=0UL; l<j; ++l ) {
+         ET tmp( 0 );
+         for( size_t q=l; q<j; ++q ) {
+            tmp += T(l,q) * w[q];
+         }
+         T(l,j) = tmp;
+      }
+
+      T(j,j) = tau[k+j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the blocked Householder QR decomposition.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return void
+//
+// This function computes the blocked Householder QR decomposition of the given matrix. Each panel
+// of DECOMPOSITION_BLOCK_SIZE columns is factorized by elementary reflectors, which are then
+// applied to the trailing matrix in their compact WY representation by means of three dense
+// matrix multiplications. The resulting storage format corresponds to the LAPACK geqrf()
+// functions.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void geqrfBackend( DenseMatrix<MT,SO>& A, ElementType_<MT>* tau )
+{
+   typedef ElementType_<MT>  ET;
+
+   const size_t m( (~A).rows()    );
+   const size_t n( (~A).columns() );
+   const size_t mindim( min( m, n ) );
+
+   DynamicMatrix<ET,SO> V, T, W;
+
+   for( size_t k=0UL; k<mindim; k+=DECOMPOSITION_BLOCK_SIZE )
+   {
+      const size_t kend( min( k+DECOMPOSITION_BLOCK_SIZE, mindim ) );
+
+      for( size_t j=k; j<kend; ++j ) {
+         tau[j] = householder( ~A, j );
+         applyHouseholder( ~A, j, j+1UL, kend, conj( tau[j] ) );
+      }
+
+      if( kend < n ) {
+         setupBlockReflector( ~A, k, kend, tau, V, T );
+         auto A2( submatrix( ~A, k, kend, m-k, n-kend ) );
+         W = ctrans( T ) * ( ctrans( V ) * A2 );
+         A2 -= V * W;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the blocked reconstruction of the \c Q matrix of a QR decomposition.
+// \ingroup dense_matrix
+//
+// \param A The matrix containing the Householder reflectors computed by geqrfBackend().
+// \param tau The scalar factors of the elementary reflectors; size >= \a n.
+// \return void
+//
+// This function overwrites the \a m-by-\a n matrix \a A (\a m >= \a n) with the first \a n
+// columns of \f$ Q = H_0 \cdots H_{n-1} \f$. The blocks of reflectors are applied from right to
+// left, where each block is applied to the already computed columns of \c Q in its compact WY
+// representation by means of three dense matrix multiplications.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void orgqrBackend( DenseMatrix<MT,SO>& A, const ElementType_<MT>* tau )
+{
+   typedef ElementType_<MT>  ET;
+
+   const size_t m( (~A).rows()    );
+   const size_t n( (~A).columns() );
+
+   DynamicMatrix<ET,SO> V, T, W;
+
+   const size_t kpos( ( ( n - 1UL ) / DECOMPOSITION_BLOCK_SIZE ) * DECOMPOSITION_BLOCK_SIZE );
+
+   for( size_t k=kpos+DECOMPOSITION_BLOCK_SIZE; k>0UL; )
+   {
+      k -= DECOMPOSITION_BLOCK_SIZE;
+
+      const size_t kend( min( k+DECOMPOSITION_BLOCK_SIZE, n ) );
+
+      if( kend < n ) {
+         setupBlockReflector( ~A, k, kend, tau, V, T );
+         auto A2( submatrix( ~A, k, kend, m-k, n-kend ) );
+         W = T * ( ctrans( V ) * A2 );
+         A2 -= V * W;
+      }
+
+      for( size_t j=kend; j-- > k; )
+      {
+         applyHouseholder( ~A, j, j+1UL, kend, tau[j] );
+
+         for( size_t i=j+1UL; i<m; ++i ) {
+            (~A)(i,j) *= -tau[j];
+         }
+
+         (~A)(j,j) = ET(1) - tau[j];
+
+         for( size_t i=0UL; i<j; ++i ) {
+            reset( (~A)(i,j) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native blocked LU decomposition of the given dense general matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+//
+// This function performs the dense matrix LU decomposition of a general \a m-by-\a n matrix
+// with partial pivoting. It is a native replacement for the LAPACK getrf() functions (see
+// blaze::getrf()) and produces a decomposition in the same format: In case of a column-major
+// matrix the decomposition has the form \f$ A = P \cdot L \cdot U \f$, in case of a row-major
+// matrix it has the form \f$ A = L \cdot U \cdot P \f$ with column interchanges and the unit
+// diagonal stored implicitly in \c U. The pivot indices are stored 1-based.
+//
+// The decomposition is computed blockwise, such that most of the work is performed by the
+// dense matrix multiplication kernels of Blaze. Therefore the function benefits from both
+// vectorization and (if enabled) shared memory parallelization. Row-major matrices are
+// decomposed via a transposed temporary column-major copy.
+//
+// \note This function only works for general, non-adapted matrices with \c float, \c double,
+// \c complex<float>, or \c complex<double> element type. The attempt to call the function with
+// adaptors or matrices of any other element type results in a compile time error!
+//
+// \note The LU decomposition will never fail, even for singular matrices. However, in case of a
+// singular matrix the resulting decomposition cannot be used for a matrix inversion or solving
+// a linear system of equations.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedGetrf( DenseMatrix<MT,SO>& A, int* ipiv )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( (~A).rows() == 0UL || (~A).columns() == 0UL ) {
+      return;
+   }
+
+   if( SO ) {
+      getrfBackend( ~A, ipiv );
+   }
+   else {
+      DynamicMatrix<ElementType_<MT>,columnMajor> B( trans( ~A ) );
+      getrfBackend( B, ipiv );
+      (~A) = trans( B );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native inversion of the given LU decomposed dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The LU decomposed matrix to be inverted.
+// \param ipiv The pivot indices of the LU decomposition computed by blockedGetrf().
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function computes the inverse of a dense general matrix from its LU decomposition as
+// computed by the blockedGetrf() function. It is a native replacement for the LAPACK getri()
+// functions (see blaze::getri()).
+//
+// \note This function only works for general, non-adapted matrices with \c float, \c double,
+// \c complex<float>, or \c complex<double> element type. The attempt to call the function with
+// adaptors or matrices of any other element type results in a compile time error!
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedGetri( DenseMatrix<MT,SO>& A, const int* ipiv )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   for( size_t i=0UL; i<(~A).rows(); ++i ) {
+      if( !isDivisor( (~A)(i,i) ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+      }
+   }
+
+   if( (~A).rows() == 0UL ) {
+      return;
+   }
+
+   if( SO ) {
+      getriBackend( ~A, ipiv );
+   }
+   else {
+      DynamicMatrix<ElementType_<MT>,columnMajor> B( trans( ~A ) );
+      getriBackend( B, ipiv );
+      (~A) = trans( B );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native blocked Cholesky decomposition of the given dense positive definite matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function performs the dense matrix Cholesky decomposition \f$ A = L \cdot L^{H} \f$
+// (if \a uplo is \c 'L') or \f$ A = U^{H} \cdot U \f$ (if \a uplo is \c 'U') of a symmetric
+// positive definite matrix. It is a native replacement for the LAPACK potrf() functions (see
+// blaze::potrf()): Only the selected part of \a A is accessed and overwritten by the resulting
+// triangular factor. The decomposition is computed blockwise, such that most of the work is
+// performed by the dense matrix multiplication kernels of Blaze.
+//
+// \note This function only works for general, non-adapted matrices with \c float, \c double,
+// \c complex<float>, or \c complex<double> element type. The attempt to call the function with
+// adaptors or matrices of any other element type results in a compile time error!
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedPotrf( DenseMatrix<MT,SO>& A, char uplo )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   if( uplo == 'L' ) {
+      potrfBackend( ~A );
+   }
+   else {
+      DynamicMatrix<ElementType_<MT>,!SO> B( trans( ~A ) );
+      potrfBackend( B );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=i; j<n; ++j ) {
+            (~A)(i,j) = B(j,i);
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native inversion of the given Cholesky decomposed dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The Cholesky decomposed matrix to be inverted.
+// \param uplo \c 'L' in case of a lower Cholesky factor, \c 'U' in case of an upper factor.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function computes the inverse of a dense positive definite matrix from its Cholesky
+// decomposition as computed by the blockedPotrf() function. It is a native replacement for the
+// LAPACK potri() functions (see blaze::potri()): Only the selected part of \a A is accessed and
+// overwritten by the according part of the inverse.
+//
+// \note This function only works for general, non-adapted matrices with \c float, \c double,
+// \c complex<float>, or \c complex<double> element type. The attempt to call the function with
+// adaptors or matrices of any other element type results in a compile time error!
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedPotri( DenseMatrix<MT,SO>& A, char uplo )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( !isDivisor( (~A)(i,i) ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+      }
+   }
+
+   if( uplo == 'L' ) {
+      potriBackend( ~A );
+   }
+   else {
+      DynamicMatrix<ElementType_<MT>,!SO> B( trans( ~A ) );
+      potriBackend( B );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=i; j<n; ++j ) {
+            (~A)(i,j) = B(j,i);
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native inversion of the given dense triangular matrix.
+// \ingroup dense_matrix
+//
+// \param A The triangular matrix to be inverted.
+// \param uplo \c 'L' in case of a lower matrix, \c 'U' in case of an upper matrix.
+// \param diag \c 'U' in case of a unitriangular matrix, \c 'N' otherwise.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::invalid_argument Invalid diag argument provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts the given triangular matrix in place. It is a native replacement for
+// the LAPACK trtri() functions (see blaze::trtri()): Only the selected part of \a A is accessed
+// and overwritten by the inverse. The inversion is computed recursively, such that most of the
+// work is performed by the dense matrix multiplication kernels of Blaze.
+//
+// \note This function only works for general, non-adapted matrices with \c float, \c double,
+// \c complex<float>, or \c complex<double> element type. The attempt to call the function with
+// adaptors or matrices of any other element type results in a compile time error!
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedTrtri( DenseMatrix<MT,SO>& A, char uplo, char diag )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   if( diag != 'U' && diag != 'N' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid diag argument provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   if( diag == 'N' ) {
+      for( size_t i=0UL; i<n; ++i ) {
+         if( !isDivisor( (~A)(i,i) ) ) {
+            BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+         }
+      }
+   }
+
+   if( uplo == 'L' ) {
+      trtriLowerBackend( ~A, 0UL, n, diag == 'U' );
+   }
+   else {
+      trtriUpperBackend( ~A, 0UL, n, diag == 'U' );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native blocked QR decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return void
+//
+// This function performs the Householder QR decomposition of a general \a m-by-\a n matrix.
+// It is a native replacement for the LAPACK geqrf() functions (see blaze::geqrf()): On exit
+// the elements on and above the diagonal of \a A contain the upper trapezoidal matrix \c R and
+// the elements below the diagonal, together with the array \a tau, represent the matrix \c Q as
+// a product of min(\a m,\a n) elementary reflectors. In contrast to the LAPACK wrapper this
+// representation refers to the logical layout of the matrix for both storage orders. The
+// decomposition is computed blockwise, such that most of the work is performed by the dense
+// matrix multiplication kernels of Blaze.
+//
+// \note This function only works for general, non-adapted matrices with \c float, \c double,
+// \c complex<float>, or \c complex<double> element type. The attempt to call the function with
+// adaptors or matrices of any other element type results in a compile time error!
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedGeqrf( DenseMatrix<MT,SO>& A, ElementType_<MT>* tau )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( (~A).rows() == 0UL || (~A).columns() == 0UL ) {
+      return;
+   }
+
+   geqrfBackend( ~A, tau );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native reconstruction of the \c Q matrix from a QR decomposition.
+// \ingroup dense_matrix
+//
+// \param A The matrix containing the Householder reflectors computed by blockedGeqrf().
+// \param tau The scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return void
+// \exception std::invalid_argument Invalid size of Q matrix provided.
+//
+// This function reconstructs the \a m-by-\a n matrix \c Q (\a m >= \a n) from the QR
+// decomposition computed by the blockedGeqrf() function. It is a native replacement for the
+// LAPACK orgqr() and ungqr() functions (see blaze::orgqr() and blaze::ungqr()).
+//
+// \note This function only works for general, non-adapted matrices with \c float, \c double,
+// \c complex<float>, or \c complex<double> element type. The attempt to call the function with
+// adaptors or matrices of any other element type results in a compile time error!
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedOrgqr( DenseMatrix<MT,SO>& A, const ElementType_<MT>* tau )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( (~A).rows() < (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size of Q matrix provided" );
+   }
+
+   if( (~A).columns() == 0UL ) {
+      return;
+   }
+
+   orgqrBackend( ~A, tau );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
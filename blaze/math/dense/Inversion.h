@@ -45,6 +45,7 @@
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
 #include <blaze/math/constraints/StrictlyTriangular.h>
+#include <blaze/math/dense/Factorization.h>
 #include <blaze/math/dense/StaticMatrix.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -63,6 +64,7 @@
 #include <blaze/math/shims/IsDivisor.h>
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/Real.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Types.h>
@@ -78,6 +80,37 @@ namespace blaze {
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the adjugate of the given general \f$ 2 \times 2 \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general \f$ 2 \times 2 \f$ matrix.
+// \param B The resulting adjugate matrix.
+// \return The determinant of the given matrix.
+//
+// This function computes the adjugate of the given general \f$ 2 \times 2 \f$ matrix via the
+// rule of Sarrus and returns the determinant of the matrix. Dividing the adjugate by the
+// determinant results in the inverse matrix. Since the function only relies on the function call
+// operator of both matrices and on the arithmetic operators of the element type \a ET, it is also
+// used to compute the adjugates of several matrices at once (see the StaticMatrixBatch class).
+*/
+template< typename ET     // Element type of the matrices
+        , typename MT1    // Type of the given matrix
+        , typename MT2 >  // Type of the adjugate matrix
+inline ET invertGeneral2x2_backend( const MT1& A, MT2& B )
+{
+   B(0,0) =  A(1,1);
+   B(1,0) = -A(1,0);
+   B(0,1) = -A(0,1);
+   B(1,1) =  A(0,0);
+
+   return A(0,0)*A(1,1) - A(0,1)*A(1,0);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief In-place inversion of the given general dense \f$ 2 \times 2 \f$ matrix.
@@ -107,21 +140,16 @@ inline void invertGeneral2x2( DenseMatrix<MT,SO>& dm )
 
    typedef ElementType_<MT>  ET;
 
-   MT& A( ~dm );
+   const StaticMatrix<ET,2UL,2UL,SO> A( ~dm );
+   MT& B( ~dm );
 
-   const ET det( A(0,0)*A(1,1) - A(0,1)*A(1,0) );
+   const ET det( invertGeneral2x2_backend<ET>( A, B ) );
 
    if( !isDivisor( det ) ) {
       BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
    }
 
-   const ET idet( ET(1) / det );
-   const ET a11( A(0,0) * idet );
-
-   A(0,0) =  A(1,1) * idet;
-   A(1,0) = -A(1,0) * idet;
-   A(0,1) = -A(0,1) * idet;
-   A(1,1) =  a11;
+   B /= det;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -486,6 +514,42 @@ inline void invert2x2( DenseMatrix<MT,SO>& dm )
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the adjugate of the given general \f$ 3 \times 3 \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general \f$ 3 \times 3 \f$ matrix.
+// \param B The resulting adjugate matrix.
+// \return The determinant of the given matrix.
+//
+// This function computes the adjugate of the given general \f$ 3 \times 3 \f$ matrix via the
+// rule of Sarrus and returns the determinant of the matrix. Dividing the adjugate by the
+// determinant results in the inverse matrix. Since the function only relies on the function call
+// operator of both matrices and on the arithmetic operators of the element type \a ET, it is also
+// used to compute the adjugates of several matrices at once (see the StaticMatrixBatch class).
+*/
+template< typename ET     // Element type of the matrices
+        , typename MT1    // Type of the given matrix
+        , typename MT2 >  // Type of the adjugate matrix
+inline ET invertGeneral3x3_backend( const MT1& A, MT2& B )
+{
+   B(0,0) = A(1,1)*A(2,2) - A(1,2)*A(2,1);
+   B(1,0) = A(1,2)*A(2,0) - A(1,0)*A(2,2);
+   B(2,0) = A(1,0)*A(2,1) - A(1,1)*A(2,0);
+   B(0,1) = A(0,2)*A(2,1) - A(0,1)*A(2,2);
+   B(1,1) = A(0,0)*A(2,2) - A(0,2)*A(2,0);
+   B(2,1) = A(0,1)*A(2,0) - A(0,0)*A(2,1);
+   B(0,2) = A(0,1)*A(1,2) - A(0,2)*A(1,1);
+   B(1,2) = A(0,2)*A(1,0) - A(0,0)*A(1,2);
+   B(2,2) = A(0,0)*A(1,1) - A(0,1)*A(1,0);
+
+   return A(0,0)*B(0,0) + A(0,1)*B(1,0) + A(0,2)*B(2,0);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief In-place inversion of the given general dense \f$ 3 \times 3 \f$ matrix.
@@ -518,23 +582,12 @@ inline void invertGeneral3x3( DenseMatrix<MT,SO>& dm )
    const StaticMatrix<ET,3UL,3UL,SO> A( ~dm );
    MT& B( ~dm );
 
-   B(0,0) = A(1,1)*A(2,2) - A(1,2)*A(2,1);
-   B(1,0) = A(1,2)*A(2,0) - A(1,0)*A(2,2);
-   B(2,0) = A(1,0)*A(2,1) - A(1,1)*A(2,0);
-
-   const ET det( A(0,0)*B(0,0) + A(0,1)*B(1,0) + A(0,2)*B(2,0) );
+   const ET det( invertGeneral3x3_backend<ET>( A, B ) );
 
    if( !isDivisor( det ) ) {
       BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
    }
 
-   B(0,1) = A(0,2)*A(2,1) - A(0,1)*A(2,2);
-   B(1,1) = A(0,0)*A(2,2) - A(0,2)*A(2,0);
-   B(2,1) = A(0,1)*A(2,0) - A(0,0)*A(2,1);
-   B(0,2) = A(0,1)*A(1,2) - A(0,2)*A(1,1);
-   B(1,2) = A(0,2)*A(1,0) - A(0,0)*A(1,2);
-   B(2,2) = A(0,0)*A(1,1) - A(0,1)*A(1,0);
-
    B /= det;
 }
 /*! \endcond */
@@ -933,36 +986,24 @@ inline void invert3x3( DenseMatrix<MT,SO>& dm )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief In-place inversion of the given general dense \f$ 4 \times 4 \f$ matrix.
+/*!\brief Computation of the adjugate of the given general \f$ 4 \times 4 \f$ matrix.
 // \ingroup dense_matrix
 //
-// \param dm The general dense matrix to be inverted.
-// \return void
-// \exception std::runtime_error Inversion of singular matrix failed.
-//
-// This function inverts the given general dense \f$ 4 \times 4 \f$ matrix via the rule of Sarrus.
-// The matrix inversion fails if the given matrix is singular and not invertible. In this case a
-// \a std::runtime_error exception is thrown.
+// \param A The given general \f$ 4 \times 4 \f$ matrix.
+// \param B The resulting adjugate matrix.
+// \return The determinant of the given matrix.
 //
-// \note The matrix inversion can only be used for dense matrices with \c float, \c double,
-// \c complex<float> or \c complex<double> element type. The attempt to call the function with
-// matrices of any other element type results in a compile time error!
+// This function computes the adjugate of the given general \f$ 4 \times 4 \f$ matrix via the
+// rule of Sarrus and returns the determinant of the matrix. Dividing the adjugate by the
+// determinant results in the inverse matrix. Since the function only relies on the function call
+// operator of both matrices and on the arithmetic operators of the element type \a ET, it is also
+// used to compute the adjugates of several matrices at once (see the StaticMatrixBatch class).
 */
-template< typename MT  // Type of the dense matrix
-        , bool SO >    // Storage order of the dense matrix
-inline void invertGeneral4x4( DenseMatrix<MT,SO>& dm )
+template< typename ET     // Element type of the matrices
+        , typename MT1    // Type of the given matrix
+        , typename MT2 >  // Type of the adjugate matrix
+inline ET invertGeneral4x4_backend( const MT1& A, MT2& B )
 {
-   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
-   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
-
-   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == 4UL, "Invalid number of rows detected"    );
-   BLAZE_INTERNAL_ASSERT( (~dm).columns() == 4UL, "Invalid number of columns detected" );
-
-   typedef ElementType_<MT>  ET;
-
-   const StaticMatrix<ET,4UL,4UL,SO> A( ~dm );
-   MT& B( ~dm );
-
    ET tmp1( A(2,2)*A(3,3) - A(2,3)*A(3,2) );
    ET tmp2( A(2,1)*A(3,3) - A(2,3)*A(3,1) );
    ET tmp3( A(2,1)*A(3,2) - A(2,2)*A(3,1) );
@@ -1003,7 +1044,45 @@ inline void invertGeneral4x4( DenseMatrix<MT,SO>& dm )
    B(3,2) = A(3,1)*tmp5 - A(3,0)*tmp3 - A(3,2)*tmp1;
    B(3,3) = A(2,0)*tmp3 - A(2,1)*tmp5 + A(2,2)*tmp1;
 
-   const ET det( A(0,0)*B(0,0) + A(0,1)*B(1,0) + A(0,2)*B(2,0) + A(0,3)*B(3,0) );
+   return A(0,0)*B(0,0) + A(0,1)*B(1,0) + A(0,2)*B(2,0) + A(0,3)*B(3,0);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given general dense \f$ 4 \times 4 \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param dm The general dense matrix to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts the given general dense \f$ 4 \times 4 \f$ matrix via the rule of Sarrus.
+// The matrix inversion fails if the given matrix is singular and not invertible. In this case a
+// \a std::runtime_error exception is thrown.
+//
+// \note The matrix inversion can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void invertGeneral4x4( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == 4UL, "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() == 4UL, "Invalid number of columns detected" );
+
+   typedef ElementType_<MT>  ET;
+
+   const StaticMatrix<ET,4UL,4UL,SO> A( ~dm );
+   MT& B( ~dm );
+
+   const ET det( invertGeneral4x4_backend<ET>( A, B ) );
 
    if( !isDivisor( det ) ) {
       BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
@@ -1486,36 +1565,24 @@ inline void invert4x4( DenseMatrix<MT,SO>& dm )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief In-place inversion of the given general dense \f$ 5 \times 5 \f$ matrix.
+/*!\brief Computation of the adjugate of the given general \f$ 5 \times 5 \f$ matrix.
 // \ingroup dense_matrix
 //
-// \param dm The general dense matrix to be inverted.
-// \return void
-// \exception std::runtime_error Inversion of singular matrix failed.
-//
-// This function inverts the given general dense \f$ 5 \times 5 \f$ matrix via the rule of Sarrus.
-// The matrix inversion fails if the given matrix is singular and not invertible. In this case a
-// \a std::runtime_error exception is thrown.
+// \param A The given general \f$ 5 \times 5 \f$ matrix.
+// \param B The resulting adjugate matrix.
+// \return The determinant of the given matrix.
 //
-// \note The matrix inversion can only be used for dense matrices with \c float, \c double,
-// \c complex<float> or \c complex<double> element type. The attempt to call the function with
-// matrices of any other element type results in a compile time error!
+// This function computes the adjugate of the given general \f$ 5 \times 5 \f$ matrix via the
+// rule of Sarrus and returns the determinant of the matrix. Dividing the adjugate by the
+// determinant results in the inverse matrix. Since the function only relies on the function call
+// operator of both matrices and on the arithmetic operators of the element type \a ET, it is also
+// used to compute the adjugates of several matrices at once (see the StaticMatrixBatch class).
 */
-template< typename MT  // Type of the dense matrix
-        , bool SO >    // Storage order of the dense matrix
-inline void invertGeneral5x5( DenseMatrix<MT,SO>& dm )
+template< typename ET     // Element type of the matrices
+        , typename MT1    // Type of the given matrix
+        , typename MT2 >  // Type of the adjugate matrix
+inline ET invertGeneral5x5_backend( const MT1& A, MT2& B )
 {
-   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
-   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
-
-   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == 5UL, "Invalid number of rows detected"    );
-   BLAZE_INTERNAL_ASSERT( (~dm).columns() == 5UL, "Invalid number of columns detected" );
-
-   typedef ElementType_<MT>  ET;
-
-   const StaticMatrix<ET,5UL,5UL,SO> A( ~dm );
-   MT& B( ~dm );
-
    ET tmp1 ( A(3,3)*A(4,4) - A(3,4)*A(4,3) );
    ET tmp2 ( A(3,2)*A(4,4) - A(3,4)*A(4,2) );
    ET tmp3 ( A(3,2)*A(4,3) - A(3,3)*A(4,2) );
@@ -1612,7 +1679,45 @@ inline void invertGeneral5x5( DenseMatrix<MT,SO>& dm )
    B(3,2) =   A(4,0)*tmp11 - A(4,1)*tmp12 + A(4,2)*tmp13 - A(4,4)*tmp14;
    B(4,2) = - A(4,0)*tmp15 + A(4,1)*tmp16 - A(4,2)*tmp17 + A(4,3)*tmp14;
 
-   const ET det( A(0,0)*B(0,0) + A(0,1)*B(1,0) + A(0,2)*B(2,0) + A(0,3)*B(3,0) + A(0,4)*B(4,0) );
+   return A(0,0)*B(0,0) + A(0,1)*B(1,0) + A(0,2)*B(2,0) + A(0,3)*B(3,0) + A(0,4)*B(4,0);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given general dense \f$ 5 \times 5 \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param dm The general dense matrix to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts the given general dense \f$ 5 \times 5 \f$ matrix via the rule of Sarrus.
+// The matrix inversion fails if the given matrix is singular and not invertible. In this case a
+// \a std::runtime_error exception is thrown.
+//
+// \note The matrix inversion can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void invertGeneral5x5( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == 5UL, "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() == 5UL, "Invalid number of columns detected" );
+
+   typedef ElementType_<MT>  ET;
+
+   const StaticMatrix<ET,5UL,5UL,SO> A( ~dm );
+   MT& B( ~dm );
+
+   const ET det( invertGeneral5x5_backend<ET>( A, B ) );
 
    if( !isDivisor( det ) ) {
       BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
@@ -2222,36 +2327,24 @@ inline void invert5x5( DenseMatrix<MT,SO>& dm )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief In-place inversion of the given general dense \f$ 6 \times 6 \f$ matrix.
+/*!\brief Computation of the adjugate of the given general \f$ 6 \times 6 \f$ matrix.
 // \ingroup dense_matrix
 //
-// \param dm The general dense matrix to be inverted.
-// \return void
-// \exception std::runtime_error Inversion of singular matrix failed.
-//
-// This function inverts the given general dense \f$ 6 \times 6 \f$ matrix via the rule of Sarrus.
-// The matrix inversion fails if the given matrix is singular and not invertible. In this case a
-// \a std::runtime_error exception is thrown.
+// \param A The given general \f$ 6 \times 6 \f$ matrix.
+// \param B The resulting adjugate matrix.
+// \return The determinant of the given matrix.
 //
-// \note The matrix inversion can only be used for dense matrices with \c float, \c double,
-// \c complex<float> or \c complex<double> element type. The attempt to call the function with
-// matrices of any other element type results in a compile time error!
+// This function computes the adjugate of the given general \f$ 6 \times 6 \f$ matrix via the
+// rule of Sarrus and returns the determinant of the matrix. Dividing the adjugate by the
+// determinant results in the inverse matrix. Since the function only relies on the function call
+// operator of both matrices and on the arithmetic operators of the element type \a ET, it is also
+// used to compute the adjugates of several matrices at once (see the StaticMatrixBatch class).
 */
-template< typename MT  // Type of the dense matrix
-        , bool SO >    // Storage order of the dense matrix
-inline void invertGeneral6x6( DenseMatrix<MT,SO>& dm )
+template< typename ET     // Element type of the matrices
+        , typename MT1    // Type of the given matrix
+        , typename MT2 >  // Type of the adjugate matrix
+inline ET invertGeneral6x6_backend( const MT1& A, MT2& B )
 {
-   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
-   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
-
-   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == 6UL, "Invalid number of rows detected"    );
-   BLAZE_INTERNAL_ASSERT( (~dm).columns() == 6UL, "Invalid number of columns detected" );
-
-   typedef ElementType_<MT>  ET;
-
-   const StaticMatrix<ET,6UL,6UL,SO> A( ~dm );
-   MT& B( ~dm );
-
    ET tmp1 ( A(4,4)*A(5,5) - A(4,5)*A(5,4) );
    ET tmp2 ( A(4,3)*A(5,5) - A(4,5)*A(5,3) );
    ET tmp3 ( A(4,3)*A(5,4) - A(4,4)*A(5,3) );
@@ -2438,8 +2531,46 @@ inline void invertGeneral6x6( DenseMatrix<MT,SO>& dm )
    B(4,3) =   A(5,0)*tmp39 - A(5,1)*tmp43 + A(5,2)*tmp46 - A(5,3)*tmp48 + A(5,5)*tmp50;
    B(5,3) = - A(5,0)*tmp40 + A(5,1)*tmp44 - A(5,2)*tmp47 + A(5,3)*tmp49 - A(5,4)*tmp50;
 
-   const ET det( A(0,0)*B(0,0) + A(0,1)*B(1,0) + A(0,2)*B(2,0) +
-                 A(0,3)*B(3,0) + A(0,4)*B(4,0) + A(0,5)*B(5,0) );
+   return A(0,0)*B(0,0) + A(0,1)*B(1,0) + A(0,2)*B(2,0) +
+          A(0,3)*B(3,0) + A(0,4)*B(4,0) + A(0,5)*B(5,0);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given general dense \f$ 6 \times 6 \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param dm The general dense matrix to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts the given general dense \f$ 6 \times 6 \f$ matrix via the rule of Sarrus.
+// The matrix inversion fails if the given matrix is singular and not invertible. In this case a
+// \a std::runtime_error exception is thrown.
+//
+// \note The matrix inversion can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void invertGeneral6x6( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == 6UL, "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() == 6UL, "Invalid number of columns detected" );
+
+   typedef ElementType_<MT>  ET;
+
+   const StaticMatrix<ET,6UL,6UL,SO> A( ~dm );
+   MT& B( ~dm );
+
+   const ET det( invertGeneral6x6_backend<ET>( A, B ) );
 
    if( !isDivisor( det ) ) {
       BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
@@ -3306,8 +3437,13 @@ inline void invertByLU( DenseMatrix<MT,SO>& dm )
    const size_t n( min( (~dm).rows(), (~dm).columns() ) );
    const std::unique_ptr<int[]> ipiv( new int[n] );
 
+#if BLAZE_BLAS_MODE
    getrf( ~dm, ipiv.get() );
    getri( ~dm, ipiv.get() );
+#else
+   blockedGetrf( ~dm, ipiv.get() );
+   blockedGetri( ~dm, ipiv.get() );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3350,11 +3486,17 @@ inline void invertByLDLT( DenseMatrix<MT,SO>& dm )
 
    BLAZE_USER_ASSERT( isSymmetric( ~dm ), "Invalid non-symmetric matrix detected" );
 
-   const char uplo( ( SO )?( 'L' ):( 'U' ) );
    const std::unique_ptr<int[]> ipiv( new int[(~dm).rows()] );
 
+#if BLAZE_BLAS_MODE
+   const char uplo( ( SO )?( 'L' ):( 'U' ) );
+
    sytrf( ~dm, uplo, ipiv.get() );
    sytri( ~dm, uplo, ipiv.get() );
+#else
+   blockedGetrf( ~dm, ipiv.get() );
+   blockedGetri( ~dm, ipiv.get() );
+#endif
 
    if( SO ) {
       for( size_t i=1UL; i<(~dm).rows(); ++i ) {
@@ -3452,11 +3594,17 @@ inline EnableIf_< IsComplex< ElementType_<MT> > >
 
    BLAZE_USER_ASSERT( isHermitian( ~dm ), "Invalid non-Hermitian matrix detected" );
 
-   const char uplo( ( SO )?( 'L' ):( 'U' ) );
    const std::unique_ptr<int[]> ipiv( new int[(~dm).rows()] );
 
+#if BLAZE_BLAS_MODE
+   const char uplo( ( SO )?( 'L' ):( 'U' ) );
+
    hetrf( ~dm, uplo, ipiv.get() );
    hetri( ~dm, uplo, ipiv.get() );
+#else
+   blockedGetrf( ~dm, ipiv.get() );
+   blockedGetri( ~dm, ipiv.get() );
+#endif
 
    if( SO ) {
       for( size_t i=1UL; i<(~dm).rows(); ++i ) {
@@ -3516,8 +3664,13 @@ inline void invertByLLH( DenseMatrix<MT,SO>& dm )
 
    const char uplo( ( SO )?( 'L' ):( 'U' ) );
 
+#if BLAZE_BLAS_MODE
    potrf( ~dm, uplo );
    potri( ~dm, uplo );
+#else
+   blockedPotrf( ~dm, uplo );
+   blockedPotri( ~dm, uplo );
+#endif
 
    if( SO ) {
       for( size_t i=1UL; i<(~dm).rows(); ++i ) {
@@ -3573,7 +3726,11 @@ inline void invertLowerNxN( DenseMatrix<MT,SO>& dm )
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
 
+#if BLAZE_BLAS_MODE
    trtri( ~dm, 'L', 'N' );
+#else
+   blockedTrtri( ~dm, 'L', 'N' );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3614,7 +3771,11 @@ inline void invertUniLowerNxN( DenseMatrix<MT,SO>& dm )
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
 
+#if BLAZE_BLAS_MODE
    trtri( ~dm, 'L', 'U' );
+#else
+   blockedTrtri( ~dm, 'L', 'U' );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3655,7 +3816,11 @@ inline void invertUpperNxN( DenseMatrix<MT,SO>& dm )
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
 
+#if BLAZE_BLAS_MODE
    trtri( ~dm, 'U', 'N' );
+#else
+   blockedTrtri( ~dm, 'U', 'N' );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3696,7 +3861,11 @@ inline void invertUniUpperNxN( DenseMatrix<MT,SO>& dm )
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
 
+#if BLAZE_BLAS_MODE
    trtri( ~dm, 'U', 'U' );
+#else
+   blockedTrtri( ~dm, 'U', 'U' );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -51,12 +51,15 @@
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/UniTriangular.h>
 #include <blaze/math/constraints/Upper.h>
+#include <blaze/math/dense/Factorization.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/lapack/getrf.h>
+#include <blaze/math/shims/Reset.h>
 #include <blaze/math/traits/DerestrictTrait.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/system/BLAS.h>
 
 
 namespace blaze {
@@ -111,7 +114,11 @@ void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
    int* ipiv  ( helper.get() );
    int* permut( ipiv + mindim );
 
+#if BLAZE_BLAS_MODE
    getrf( ~A, ipiv );
+#else
+   blockedGetrf( ~A, ipiv );
+#endif
 
    for( size_t i=0UL; i<size; ++i ) {
       permut[i] = i;
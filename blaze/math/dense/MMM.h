@@ -0,0 +1,622 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MMM.h
+//  \brief Header file for the packed dense matrix multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MMM_H_
+#define _BLAZE_MATH_DENSE_MMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/dispatch/MMM.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsOne.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Debugging.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PACKED DENSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocking parameters of the packed dense matrix multiplication kernels.
+// \ingroup dense_matrix
+//
+// This auxiliary class template defines the register and cache blocking of the packed dense
+// matrix multiplication for the given data type. The micro-kernel computes an \a MR x \a NR
+// block of the result in registers (for instance 6x8 for \c double and 6x16 for \c float in
+// case AVX is available). In case the micro-kernel is dispatched at runtime (see MMMDispatch),
+// \a NR is chosen according to the widest supported instruction set. A \a KC x \a NR micro-
+// panel of the right-hand side operand is sized to stay in the L1 cache, the packed \a MC x
+// \a KC block of the left-hand side operand in the L2 cache and the packed \a KC x \a NC block
+// of the right-hand side operand in the last level cache. The cache block sizes used by the
+// kernels are returned by the mc(), kc(), and nc() functions, which derive them from the cache
+// hierarchy detected at runtime (see cacheHierarchy()). \a MC, \a KC, and \a NC are the compile
+// time defaults, which are used in case the cache hierarchy cannot be determined.
+//
+// The shape of the register block is dictated by the 16 SIMD registers of SSE and AVX: The
+// 6 x (2*SIMDSIZE) block occupies 12 accumulators, two registers for the current row of the
+// right-hand side micro-panel and one register for the broadcast element of the left-hand
+// side micro-panel. An 8x12 block of \c double values would require 24 accumulators (8 rows
+// of three AVX registers) and would therefore spill to the stack. Also, a multiple of the
+// SIMD width as number of columns keeps all loads of the right-hand side micro-panel aligned.
+*/
+template< typename Type >  // Data type of the matrix elements
+struct MMMBlocking
+{
+   //! Number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<Type>::size;
+
+   //! Number of rows of the register block.
+   static constexpr size_t MR = 6UL;
+
+   //! Number of columns of the register block.
+   static constexpr size_t NR = ( MMMDispatch<Type>::value )?( MMMDispatch<Type>::NR ):( 2UL * SIMDSIZE );
+
+   //! Default number of rows of a packed block of the left-hand side operand.
+   static constexpr size_t MC = MMM_IBLOCK_SIZE;
+
+   //! Default number of columns of a packed block of the left-hand side operand.
+   static constexpr size_t KC = MMM_KBLOCK_SIZE;
+
+   //! Default number of columns of a packed block of the right-hand side operand.
+   static constexpr size_t NC =
+      ( BLAZE_DEBUG_MODE )
+      ?( 4UL * NR )
+      :( ( cacheSize / ( 2UL * KC * sizeof(Type) ) < NR )
+         ?( NR )
+         :( cacheSize / ( 2UL * KC * sizeof(Type) * NR ) * NR ) );
+
+   //**********************************************************************************************
+   /*!\brief Returns the number of columns of a packed block of the left-hand side operand.
+   //
+   // \return The number of columns, chosen such that a micro-panel of the right-hand side
+   //         operand fills half of the L1 cache.
+   */
+   static size_t kc() noexcept
+   {
+      static const size_t value( ( BLAZE_CACHE_BLOCKING_MODE && cacheHierarchy().detected )
+                                 ?( max( min( cacheHierarchy().l1Size / ( 2UL * NR * sizeof(Type) ), 1024UL ) & size_t(-8), 32UL ) )
+                                 :( KC ) );
+      return value;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the number of rows of a packed block of the left-hand side operand.
+   //
+   // \return The number of rows, chosen such that a packed block of the left-hand side operand
+   //         fills three quarters of the L2 cache.
+   */
+   static size_t mc() noexcept
+   {
+      static const size_t value( ( BLAZE_CACHE_BLOCKING_MODE && cacheHierarchy().detected )
+                                 ?( max( min( 3UL * cacheHierarchy().l2Size / ( 4UL * kc() * sizeof(Type) * MR ), 170UL ) * MR, MR ) )
+                                 :( MC ) );
+      return value;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the number of columns of a packed block of the right-hand side operand.
+   //
+   // \return The number of columns, chosen such that a packed block of the right-hand side
+   //         operand fills half of the last level cache.
+   */
+   static size_t nc() noexcept
+   {
+      static const size_t value( ( BLAZE_CACHE_BLOCKING_MODE && cacheHierarchy().detected )
+                                 ?( max( min( cacheHierarchy().l3Size / ( 2UL * kc() * sizeof(Type) * NR ), 4096UL ) * NR, NR ) )
+                                 :( NC ) );
+      return value;
+   }
+   //**********************************************************************************************
+
+   BLAZE_STATIC_ASSERT( MC % MR == 0UL );
+   BLAZE_STATIC_ASSERT( NC % NR == 0UL );
+   BLAZE_STATIC_ASSERT( NR % ( 2UL * SIMDSIZE ) == 0UL );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+// Definitions of the static data members of the MMMBlocking class template (required in case
+// the members are odr-used, as for instance by the min() and max() functions).
+template< typename Type > constexpr size_t MMMBlocking<Type>::SIMDSIZE;
+template< typename Type > constexpr size_t MMMBlocking<Type>::MR;
+template< typename Type > constexpr size_t MMMBlocking<Type>::NR;
+template< typename Type > constexpr size_t MMMBlocking<Type>::MC;
+template< typename Type > constexpr size_t MMMBlocking<Type>::KC;
+template< typename Type > constexpr size_t MMMBlocking<Type>::NC;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packing of a block of the left-hand side operand of a packed matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param buffer The aligned target buffer.
+// \param A The left-hand side operand.
+// \param i The index of the first row of the block.
+// \param m The number of rows of the block.
+// \param k The index of the first column of the block.
+// \param kc The number of columns of the block.
+// \return void
+//
+// This function packs the \a m x \a kc block of \a A starting at \a (i,k) into consecutive
+// micro-panels of \a MR rows each. Each micro-panel is stored column by column, rows beyond
+// \a m are filled with zeros. In case \a Trans is \a true the block is taken from the
+// transpose of \a A.
+*/
+template< size_t MR       // Number of rows of a micro-panel
+        , bool Trans      // Transposition flag
+        , typename Type   // Data type of the buffer elements
+        , typename MT >   // Type of the left-hand side operand
+inline void mmmPackLeft( Type* buffer, const MT& A, size_t i, size_t m, size_t k, size_t kc )
+{
+   for( size_t ii=0UL; ii<m; ii+=MR )
+   {
+      const size_t mr( min( MR, m-ii ) );
+
+      for( size_t p=0UL; p<kc; ++p ) {
+         size_t r( 0UL );
+         for( ; r<mr; ++r ) {
+            buffer[r] = ( Trans )?( A(k+p,i+ii+r) ):( A(i+ii+r,k+p) );
+         }
+         for( ; r<MR; ++r ) {
+            reset( buffer[r] );
+         }
+         buffer += MR;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packing of a block of the right-hand side operand of a packed matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param buffer The aligned target buffer.
+// \param B The right-hand side operand.
+// \param k The index of the first row of the block.
+// \param kc The number of rows of the block.
+// \param j The index of the first column of the block.
+// \param n The number of columns of the block.
+// \return void
+//
+// This function packs the \a kc x \a n block of \a B starting at \a (k,j) into consecutive
+// micro-panels of \a NR columns each. Each micro-panel is stored row by row, columns beyond
+// \a n are filled with zeros. In case \a Trans is \a true the block is taken from the
+// transpose of \a B.
+*/
+template< size_t NR       // Number of columns of a micro-panel
+        , bool Trans      // Transposition flag
+        , typename Type   // Data type of the buffer elements
+        , typename MT >   // Type of the right-hand side operand
+inline void mmmPackRight( Type* buffer, const MT& B, size_t k, size_t kc, size_t j, size_t n )
+{
+   for( size_t jj=0UL; jj<n; jj+=NR )
+   {
+      const size_t nr( min( NR, n-jj ) );
+
+      for( size_t p=0UL; p<kc; ++p ) {
+         size_t c( 0UL );
+         for( ; c<nr; ++c ) {
+            buffer[c] = ( Trans )?( B(j+jj+c,k+p) ):( B(k+p,j+jj+c) );
+         }
+         for( ; c<NR; ++c ) {
+            reset( buffer[c] );
+         }
+         buffer += NR;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Register-blocked micro-kernel of the packed dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param kc The number of rank-1 updates to perform.
+// \param a Pointer to the packed micro-panel of the left-hand side operand.
+// \param b Pointer to the packed micro-panel of the right-hand side operand.
+// \param c Pointer to the aligned \a MR x \a NR result block.
+// \return void
+//
+// This function computes the product of a packed \a MR x \a kc micro-panel and a packed \a kc
+// x \a NR micro-panel entirely in SIMD registers and stores the result row by row in \a c. In
+// case \a NR exceeds two SIMD vectors (see MMMDispatch), the columns of the micro-panel are
+// processed in several passes.
+*/
+template< typename Type >  // Data type of the matrix elements
+BLAZE_ALWAYS_INLINE void mmmMicroKernel( size_t kc, const Type* a, const Type* b, Type* c ) noexcept
+{
+   typedef SIMDTrait_<Type>  SIMDType;
+
+   constexpr size_t MR      ( MMMBlocking<Type>::MR );
+   constexpr size_t NR      ( MMMBlocking<Type>::NR );
+   constexpr size_t SIMDSIZE( MMMBlocking<Type>::SIMDSIZE );
+
+   BLAZE_STATIC_ASSERT( MR == 6UL && NR % ( 2UL*SIMDSIZE ) == 0UL );
+
+   for( size_t jb=0UL; jb<NR; jb+=2UL*SIMDSIZE )
+   {
+      SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10, xmm11, xmm12;
+
+      const Type* ap( a );
+      const Type* bp( b+jb );
+
+      for( size_t p=0UL; p<kc; ++p )
+      {
+         const SIMDType b1( loada( bp            ) );
+         const SIMDType b2( loada( bp + SIMDSIZE ) );
+
+         SIMDType a1( set( ap[0] ) );
+         SIMDType a2( set( ap[1] ) );
+         xmm1  = xmm1  + a1 * b1;
+         xmm2  = xmm2  + a1 * b2;
+         xmm3  = xmm3  + a2 * b1;
+         xmm4  = xmm4  + a2 * b2;
+
+         a1 = set( ap[2] );
+         a2 = set( ap[3] );
+         xmm5  = xmm5  + a1 * b1;
+         xmm6  = xmm6  + a1 * b2;
+         xmm7  = xmm7  + a2 * b1;
+         xmm8  = xmm8  + a2 * b2;
+
+         a1 = set( ap[4] );
+         a2 = set( ap[5] );
+         xmm9  = xmm9  + a1 * b1;
+         xmm10 = xmm10 + a1 * b2;
+         xmm11 = xmm11 + a2 * b1;
+         xmm12 = xmm12 + a2 * b2;
+
+         ap += MR;
+         bp += NR;
+      }
+
+      storea( c+jb                , xmm1  );
+      storea( c+jb+SIMDSIZE       , xmm2  );
+      storea( c+jb+NR             , xmm3  );
+      storea( c+jb+NR+SIMDSIZE    , xmm4  );
+      storea( c+jb+2UL*NR         , xmm5  );
+      storea( c+jb+2UL*NR+SIMDSIZE, xmm6  );
+      storea( c+jb+3UL*NR         , xmm7  );
+      storea( c+jb+3UL*NR+SIMDSIZE, xmm8  );
+      storea( c+jb+4UL*NR         , xmm9  );
+      storea( c+jb+4UL*NR+SIMDSIZE, xmm10 );
+      storea( c+jb+5UL*NR         , xmm11 );
+      storea( c+jb+5UL*NR+SIMDSIZE, xmm12 );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update of a block of the target matrix of a packed dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param i The index of the first row of the block.
+// \param mr The number of rows of the block.
+// \param j The index of the first column of the block.
+// \param nr The number of columns of the block.
+// \param c Pointer to the aligned \a MR x \a NR result block.
+// \param alpha The scaling factor for the result block.
+// \return void
+//
+// This function adds the \a mr x \a nr result block \a c scaled by \a alpha to the block of
+// \a C starting at \a (i,j). In case \a Trans is \a true the block is added to the transpose
+// of \a C. Complete blocks are updated by SIMD operations along the contiguous dimension of
+// the target matrix.
+*/
+template< bool Trans     // Transposition flag
+        , typename MT    // Type of the target dense matrix
+        , bool SO        // Storage order of the target dense matrix
+        , typename Type  // Data type of the result block
+        , typename ST >  // Type of the scaling factor
+inline void mmmUpdate( DenseMatrix<MT,SO>& C, size_t i, size_t mr, size_t j, size_t nr,
+                       const Type* c, ST alpha )
+{
+   typedef SIMDTrait_<Type>  SIMDType;
+
+   constexpr size_t NR      ( MMMBlocking<Type>::NR );
+   constexpr size_t SIMDSIZE( MMMBlocking<Type>::SIMDSIZE );
+
+   if( nr == NR )
+   {
+      const SIMDType factor( set( Type( alpha ) ) );
+
+      for( size_t r=0UL; r<mr; ++r ) {
+         for( size_t jj=0UL; jj<NR; jj+=SIMDSIZE )
+         {
+            const SIMDType xmm1( factor * loada( c + r*NR + jj ) );
+
+            if( Trans )
+               (~C).store( j+jj, i+r, (~C).load(j+jj,i+r) + xmm1 );
+            else
+               (~C).store( i+r, j+jj, (~C).load(i+r,j+jj) + xmm1 );
+         }
+      }
+   }
+   else
+   {
+      for( size_t r=0UL; r<mr; ++r ) {
+         for( size_t jj=0UL; jj<nr; ++jj ) {
+            if( Trans )
+               (~C)(j+jj,i+r) += alpha * c[r*NR+jj];
+            else
+               (~C)(i+r,j+jj) += alpha * c[r*NR+jj];
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the packed dense matrix multiplication (\f$ C=\alpha*L*R+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param L The left-hand side multiplication operand.
+// \param R The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ L*R \f$.
+// \param beta The scaling factor for \f$ C \f$ (either 0 or 1).
+// \return void
+//
+// This function implements a GotoBLAS-style multiplication: The right-hand side operand is
+// packed in blocks of \a KC x \a NC elements, the left-hand side operand in blocks of \a MC x
+// \a KC elements, and each pair of micro-panels is multiplied by a register-blocked micro-kernel.
+// In case \a Trans is \a true, the function computes the transpose of the result, i.e.
+// \f$ C^T=\alpha*L^T*R^T+\beta*C^T \f$, which maps the contiguous dimension of a column-major
+// target matrix onto the SIMD dimension of the micro-kernel.
+//
+// Lower and upper triangular operands are exploited by restricting the range of the inner
+// dimension of every block and micro-panel to the potential non-zero elements.
+*/
+template< bool Trans     // Transposition flag
+        , typename MT1   // Type of the target dense matrix
+        , bool SO        // Storage order of the target dense matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factors
+void mmmBackend( DenseMatrix<MT1,SO>& C, const MT2& L, const MT3& R, ST alpha, ST beta )
+{
+   typedef ElementType_<MT1>  ET;
+
+   constexpr size_t MR( MMMBlocking<ET>::MR );
+   constexpr size_t NR( MMMBlocking<ET>::NR );
+
+   const size_t MC( MMMBlocking<ET>::mc() );
+   const size_t KC( MMMBlocking<ET>::kc() );
+   const size_t NC( MMMBlocking<ET>::nc() );
+
+   constexpr bool upperL( Trans ? IsLower<MT2>::value : IsUpper<MT2>::value );
+   constexpr bool lowerL( Trans ? IsUpper<MT2>::value : IsLower<MT2>::value );
+   constexpr bool upperR( Trans ? IsLower<MT3>::value : IsUpper<MT3>::value );
+   constexpr bool lowerR( Trans ? IsUpper<MT3>::value : IsLower<MT3>::value );
+
+   const size_t M( Trans ? L.columns() : L.rows()    );
+   const size_t N( Trans ? R.rows()    : R.columns() );
+   const size_t K( Trans ? L.rows()    : L.columns() );
+
+   BLAZE_INTERNAL_ASSERT( isDefault( beta ) || isOne( beta ), "Invalid scaling factor for C" );
+
+   if( isDefault( beta ) ) {
+      reset( ~C );
+   }
+
+   if( M == 0UL || N == 0UL || K == 0UL )
+      return;
+
+   const size_t mcmax( min( MC, ( M+MR-1UL ) / MR * MR ) );
+   const size_t kcmax( min( KC, K ) );
+   const size_t ncmax( min( NC, ( N+NR-1UL ) / NR * NR ) );
+
+   const std::unique_ptr<ET[],Deallocate> apack( allocate<ET>( mcmax*kcmax ) );
+   const std::unique_ptr<ET[],Deallocate> bpack( allocate<ET>( kcmax*ncmax ) );
+   const std::unique_ptr<ET[],Deallocate> block( allocate<ET>( MR*NR ) );
+
+   const MMMMicroKernel<ET> kernel( selectMMMMicroKernel( &mmmMicroKernel<ET> ) );
+
+   for( size_t jj=0UL; jj<N; jj+=NC )
+   {
+      const size_t nc( min( NC, N-jj ) );
+
+      const size_t kbegin( ( lowerR )?( min( jj, K ) ):( 0UL ) );
+      const size_t kend  ( ( upperR )?( min( jj+nc, K ) ):( K ) );
+
+      for( size_t kk=kbegin; kk<kend; kk+=KC )
+      {
+         const size_t kc( min( KC, kend-kk ) );
+
+         mmmPackRight<NR,Trans>( bpack.get(), R, kk, kc, jj, nc );
+
+         for( size_t ii=0UL; ii<M; ii+=MC )
+         {
+            const size_t mc( min( MC, M-ii ) );
+
+            if( ( upperL && kk+kc <= ii ) || ( lowerL && ii+mc <= kk ) )
+               continue;
+
+            mmmPackLeft<MR,Trans>( apack.get(), L, ii, mc, kk, kc );
+
+            for( size_t j=0UL; j<nc; j+=NR )
+            {
+               const size_t nr( min( NR, nc-j ) );
+               const ET* b( bpack.get() + j*kc );
+
+               for( size_t i=0UL; i<mc; i+=MR )
+               {
+                  const size_t mr( min( MR, mc-i ) );
+                  const ET* a( apack.get() + i*kc );
+
+                  const size_t kbegin2( max( ( upperL )?( max( ii+i, kk ) ):( kk ),
+                                             ( lowerR )?( max( jj+j, kk ) ):( kk ) ) );
+                  const size_t kend2  ( min( ( lowerL )?( min( ii+i+mr, kk+kc ) ):( kk+kc ),
+                                             ( upperR )?( min( jj+j+nr, kk+kc ) ):( kk+kc ) ) );
+
+                  if( kbegin2 >= kend2 )
+                     continue;
+
+                  const size_t pbegin( kbegin2 - kk );
+
+                  kernel( kend2-kbegin2, a+pbegin*MR, b+pbegin*NR, block.get() );
+                  mmmUpdate<Trans>( C, ii+i, mr, jj+j, nr, block.get(), alpha );
+               }
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed multiplication of two dense matrices (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target row-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$ (either 0 or 1).
+// \return void
+//
+// This function implements a native, cache- and register-blocked dense matrix multiplication
+// for large matrices. Both operands are copied block by block into contiguous, aligned buffers
+// before the blocks are multiplied by a vectorized micro-kernel. The kernel works for all
+// combinations of storage orders and exploits lower and upper triangular operands. Note that
+// \a C must not be aliased with either \a A or \a B and that all three matrices are expected
+// to have the same, vectorizable element type.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factors
+inline void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT3 );
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == B.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( A.columns()    == B.rows()   , "Invalid matrix sizes"      );
+
+   mmmBackend<false>( ~C, A, B, alpha, beta );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed multiplication of two dense matrices (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target column-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$ (either 0 or 1).
+// \return void
+//
+// This function implements a native, cache- and register-blocked dense matrix multiplication
+// for large matrices. In order to vectorize along the columns of the column-major target matrix
+// the transposed product \f$ C^T=\alpha*B^T*A^T+\beta*C^T \f$ is computed. Note that \a C must
+// not be aliased with either \a A or \a B and that all three matrices are expected to have the
+// same, vectorizable element type.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factors
+inline void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT3 );
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == B.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( A.columns()    == B.rows()   , "Invalid matrix sizes"      );
+
+   mmmBackend<true>( ~C, B, A, alpha, beta );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,893 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedKernels.h
+//  \brief Header file for the packed storage matrix multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDKERNELS_H_
+#define _BLAZE_MATH_DENSE_PACKEDKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/ConstDataAccess.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/PackedStructure.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDConj.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsPacked.h>
+#include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PACKED STORAGE LAYOUT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Layout of the packed storage of the given packed matrix type.
+// \ingroup dense_matrix
+//
+// This auxiliary class template describes the memory layout of a packed matrix (see the
+// PackedMatrix class template) of storage order \a SO and packed structure \a PS. The stored
+// triangle is split into lines, which are the rows of a row-major and the columns of a
+// column-major matrix. In case \a leading is \a true, line \a k holds the elements \f$ 0..k \f$
+// (with the diagonal element being the last element of the line), otherwise it holds the
+// elements \f$ k..n-1 \f$ (with the diagonal element being the first element of the line).
+// In case \a mirrored is \a true, each stored off-diagonal element additionally represents
+// its (in case \a conjugated is \a true complex conjugated) mirror element.
+*/
+template< bool SO              // Storage order
+        , PackedStructure PS >  // Packed structure
+struct PackedLayout
+{
+   //! Compilation flag for symmetric and Hermitian matrices.
+   static constexpr bool mirrored = ( PS == packedSymmetric || PS == packedHermitian );
+
+   //! Compilation flag for Hermitian matrices.
+   static constexpr bool conjugated = ( PS == packedHermitian );
+
+   //! Compilation flag for lines ending in the diagonal element.
+   static constexpr bool leading = ( mirrored || ( ( PS == packedLower ) != SO ) );
+
+   //**********************************************************************************************
+   /*!\brief Returns the offset of the given line within the packed storage.
+   //
+   // \param k The index of the line.
+   // \param n The number of rows/columns of the matrix.
+   // \return The offset of the first element of line \a k.
+   */
+   static BLAZE_ALWAYS_INLINE size_t offset( size_t k, size_t n ) noexcept {
+      return ( leading )?( ( k*(k+1UL) ) / 2UL ):( ( k*(2UL*n-k+1UL) ) / 2UL );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< bool SO, PackedStructure PS > constexpr bool PackedLayout<SO,PS>::mirrored;
+template< bool SO, PackedStructure PS > constexpr bool PackedLayout<SO,PS>::conjugated;
+template< bool SO, PackedStructure PS > constexpr bool PackedLayout<SO,PS>::leading;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LINE KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Helper structure for the selection of the vectorized packed storage line kernels.
+// \ingroup dense_matrix
+//
+// In case the given data type is suited for the vectorized line kernels, the nested \a value
+// is set to 1, otherwise it is 0.
+*/
+template< typename Type >  // Data type of the elements
+struct UseVectorizedPackedKernel
+{
+   enum : bool { value = useOptimizedKernels &&
+                         IsVectorizable<Type>::value &&
+                         HasSIMDAdd<Type,Type>::value &&
+                         HasSIMDMult<Type,Type>::value &&
+                         HasSIMDConj<Type>::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conditional complex conjugate of a packed storage element.
+// \ingroup dense_matrix
+//
+// \param a The given scalar or SIMD value.
+// \return The complex conjugate of \a a in case \a Conj is \a true, \a a otherwise.
+*/
+template< bool Conj      // Conjugation flag
+        , typename T >   // Type of the value
+BLAZE_ALWAYS_INLINE EnableIf_< BoolConstant<Conj>, T > packedConj( const T& a )
+{
+   return conj( a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conditional complex conjugate of a packed storage element.
+// \ingroup dense_matrix
+//
+// \param a The given scalar or SIMD value.
+// \return The complex conjugate of \a a in case \a Conj is \a true, \a a otherwise.
+*/
+template< bool Conj      // Conjugation flag
+        , typename T >   // Type of the value
+BLAZE_ALWAYS_INLINE DisableIf_< BoolConstant<Conj>, const T& > packedConj( const T& a )
+{
+   return a;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default dot product of a section of a packed line and a dense vector.
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first element of the line section.
+// \param x Pointer to the first element of the vector section.
+// \param n The number of elements of the section.
+// \return The (in case \a Conj is \a true conjugated) dot product \f$ \sum a_i x_i \f$.
+*/
+template< bool Conj          // Conjugation flag
+        , typename Type >    // Data type of the elements
+inline DisableIf_< UseVectorizedPackedKernel<Type>, Type >
+   packedDot( const Type* a, const Type* x, size_t n )
+{
+   Type value = Type();
+
+   for( size_t i=0UL; i<n; ++i ) {
+      value += packedConj<Conj>( a[i] ) * x[i];
+   }
+
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized dot product of a section of a packed line and a dense vector.
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first element of the line section.
+// \param x Pointer to the first element of the vector section.
+// \param n The number of elements of the section.
+// \return The (in case \a Conj is \a true conjugated) dot product \f$ \sum a_i x_i \f$.
+//
+// Since the lines of a packed matrix are not aligned to SIMD boundaries, both sections are
+// accessed via unaligned loads.
+*/
+template< bool Conj          // Conjugation flag
+        , typename Type >    // Data type of the elements
+inline EnableIf_< UseVectorizedPackedKernel<Type>, Type >
+   packedDot( const Type* a, const Type* x, size_t n )
+{
+   typedef SIMDTrait_<Type>  SIMDType;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t ipos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ipos <= n, "Invalid end calculation" );
+
+   SIMDType xmm1, xmm2;
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE) < ipos; i+=2UL*SIMDSIZE ) {
+      xmm1 = xmm1 + packedConj<Conj>( loadu( a+i          ) ) * loadu( x+i          );
+      xmm2 = xmm2 + packedConj<Conj>( loadu( a+i+SIMDSIZE ) ) * loadu( x+i+SIMDSIZE );
+   }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      xmm1 = xmm1 + packedConj<Conj>( loadu( a+i ) ) * loadu( x+i );
+   }
+
+   Type value( sum( xmm1 + xmm2 ) );
+
+   for( ; i<n; ++i ) {
+      value += packedConj<Conj>( a[i] ) * x[i];
+   }
+
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default scaled addition of a section of a packed line to a dense vector.
+// \ingroup dense_matrix
+//
+// \param y Pointer to the first element of the target vector section.
+// \param a Pointer to the first element of the line section.
+// \param s The scaling factor.
+// \param n The number of elements of the section.
+// \return void
+//
+// This function computes \f$ y_i += a_i s \f$ (or \f$ y_i += \overline{a_i} s \f$ in case
+// \a Conj is \a true).
+*/
+template< bool Conj          // Conjugation flag
+        , typename Type >    // Data type of the elements
+inline DisableIf_< UseVectorizedPackedKernel<Type> >
+   packedAxpy( Type* y, const Type* a, const Type& s, size_t n )
+{
+   for( size_t i=0UL; i<n; ++i ) {
+      y[i] += packedConj<Conj>( a[i] ) * s;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized scaled addition of a section of a packed line to a dense vector.
+// \ingroup dense_matrix
+//
+// \param y Pointer to the first element of the target vector section.
+// \param a Pointer to the first element of the line section.
+// \param s The scaling factor.
+// \param n The number of elements of the section.
+// \return void
+//
+// This function computes \f$ y_i += a_i s \f$ (or \f$ y_i += \overline{a_i} s \f$ in case
+// \a Conj is \a true).
+*/
+template< bool Conj          // Conjugation flag
+        , typename Type >    // Data type of the elements
+inline EnableIf_< UseVectorizedPackedKernel<Type> >
+   packedAxpy( Type* y, const Type* a, const Type& s, size_t n )
+{
+   typedef SIMDTrait_<Type>  SIMDType;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t ipos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ipos <= n, "Invalid end calculation" );
+
+   const SIMDType factor( set( s ) );
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE) < ipos; i+=2UL*SIMDSIZE ) {
+      storeu( y+i         , loadu( y+i          ) + packedConj<Conj>( loadu( a+i          ) ) * factor );
+      storeu( y+i+SIMDSIZE, loadu( y+i+SIMDSIZE ) + packedConj<Conj>( loadu( a+i+SIMDSIZE ) ) * factor );
+   }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      storeu( y+i, loadu( y+i ) + packedConj<Conj>( loadu( a+i ) ) * factor );
+   }
+   for( ; i<n; ++i ) {
+      y[i] += packedConj<Conj>( a[i] ) * s;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a single line of a packed matrix with a dense vector.
+// \ingroup dense_matrix
+//
+// \param v Pointer to the packed storage.
+// \param n The number of rows/columns of the packed matrix.
+// \param k The index of the line.
+// \param x Pointer to the first element of the right-hand side dense vector.
+// \param y Pointer to the first element of the target dense vector.
+// \param alpha The scaling factor.
+// \return void
+//
+// This function adds the contribution of line \a k of the packed matrix (and in case of a
+// symmetric or Hermitian matrix of its mirrored counterpart) to \f$ \vec{y}=\alpha*A*\vec{x}
+// \f$. In case \a Columnwise is \a true the line is treated as column \a k of \a A, otherwise
+// as row \a k. Each line results in one dot product and/or one scaled vector addition.
+*/
+template< typename Layout    // Layout of the packed storage
+        , bool Columnwise    // Line orientation flag
+        , typename Type >    // Data type of the elements
+BLAZE_ALWAYS_INLINE void pmvLine( const Type* v, size_t n, size_t k,
+                                  const Type* x, Type* y, const Type& alpha )
+{
+   const size_t offset( Layout::offset( k, n ) );
+   const size_t lbegin( Layout::leading ? 0UL : k+1UL );
+   const size_t length( Layout::leading ? k : n-k-1UL );
+   const Type*  a     ( v + offset + ( Layout::leading ? 0UL : 1UL ) );
+   const Type&  d     ( v[ Layout::leading ? offset+k : offset ] );
+
+   if( Columnwise ) {
+      const Type s( alpha * x[k] );
+      packedAxpy<false>( y+lbegin, a, s, length );
+      y[k] += d * s;
+      if( Layout::mirrored ) {
+         y[k] += alpha * packedDot<Layout::conjugated>( a, x+lbegin, length );
+      }
+   }
+   else {
+      y[k] += alpha * ( d * x[k] + packedDot<false>( a, x+lbegin, length ) );
+      if( Layout::mirrored ) {
+         packedAxpy<Layout::conjugated>( y+lbegin, a, alpha * x[k], length );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a single line of a packed matrix with the rows of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param v Pointer to the packed storage.
+// \param n The number of rows/columns of the packed matrix.
+// \param k The index of the line.
+// \param B Pointer to the first element of the processed block of the dense operand.
+// \param ldb The spacing between two rows of the dense operand.
+// \param C Pointer to the first element of the processed block of the target matrix.
+// \param ldc The spacing between two rows of the target matrix.
+// \param width The number of elements per row of the processed block.
+// \return void
+//
+// This function adds the contribution of all elements \f$ a_{ij} \f$ of line \a k of the
+// packed matrix to \f$ C=\alpha*A*B \f$ for row-major matrices \a B and \a C. Each element
+// results in one vectorized scaled addition of row \a j of \a B to row \a i of \a C (and in
+// case of a symmetric or Hermitian matrix one addition of row \a i of \a B to row \a j of
+// \a C).
+*/
+template< typename Layout    // Layout of the packed storage
+        , bool Columnwise    // Line orientation flag
+        , typename Type >    // Data type of the elements
+BLAZE_ALWAYS_INLINE void pmmLine( const Type* v, size_t n, size_t k,
+                                  const Type* B, size_t ldb, Type* C, size_t ldc,
+                                  size_t width, const Type& alpha )
+{
+   const size_t lbegin( Layout::leading ? 0UL : k );
+   const size_t lend  ( Layout::leading ? k+1UL : n );
+   const Type*  a     ( v + Layout::offset( k, n ) );
+
+   for( size_t l=lbegin; l<lend; ++l, ++a )
+   {
+      const size_t i( Columnwise ? l : k );
+      const size_t j( Columnwise ? k : l );
+
+      packedAxpy<false>( C+i*ldc, B+j*ldb, alpha * (*a), width );
+
+      if( Layout::mirrored && l != k ) {
+         packedAxpy<false>( C+j*ldc, B+i*ldb, alpha * packedConj<Layout::conjugated>( *a ), width );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCKED KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the block size of the blocked packed storage kernels.
+// \ingroup dense_matrix
+//
+// \param n The number of rows/columns of the packed matrix.
+// \return The number of vectors (or elements per row) processed per sweep over the matrix.
+//
+// The block size is chosen such that the processed sections of the dense operand and of the
+// target matrix fill the L2 cache.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t packedBlockSize( size_t n ) noexcept
+{
+   return max( cacheHierarchy().l2Size / ( 2UL * max( n, 1UL ) * sizeof(Type) ), 16UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked multiplication of a packed matrix with a set of dense vectors.
+// \ingroup dense_matrix
+//
+// \param v Pointer to the packed storage.
+// \param n The number of rows/columns of the packed matrix.
+// \param X Pointer to the first right-hand side vector.
+// \param ldx The spacing between two right-hand side vectors.
+// \param Y Pointer to the first target vector.
+// \param ldy The spacing between two target vectors.
+// \param count The number of vectors.
+// \param alpha The scaling factor.
+// \return void
+//
+// This function computes \f$ \vec{y}_r+=\alpha*A*\vec{x}_r \f$ for \a count pairs of
+// contiguous vectors. The vectors are processed in blocks that fit into the L2 cache, such
+// that the packed matrix is streamed from memory only once per block.
+*/
+template< typename Layout    // Layout of the packed storage
+        , bool Columnwise    // Line orientation flag
+        , typename Type >    // Data type of the elements
+void pmvBlocked( const Type* v, size_t n, const Type* X, size_t ldx,
+                 Type* Y, size_t ldy, size_t count, const Type& alpha )
+{
+   const size_t block( packedBlockSize<Type>( n ) );
+
+   for( size_t rr=0UL; rr<count; rr+=block )
+   {
+      const size_t rend( min( rr+block, count ) );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         for( size_t r=rr; r<rend; ++r ) {
+            pmvLine<Layout,Columnwise>( v, n, k, X+r*ldx, Y+r*ldy, alpha );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked multiplication of a packed matrix with a row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param v Pointer to the packed storage.
+// \param n The number of rows/columns of the packed matrix.
+// \param B Pointer to the first element of the row-major dense operand.
+// \param ldb The spacing between two rows of the dense operand.
+// \param C Pointer to the first element of the row-major target matrix.
+// \param ldc The spacing between two rows of the target matrix.
+// \param width The number of columns of the dense operand and the target matrix.
+// \param alpha The scaling factor.
+// \return void
+//
+// This function computes \f$ C+=\alpha*A*B \f$ for row-major matrices \a B and \a C. The
+// columns of both matrices are processed in blocks that fit into the L2 cache.
+*/
+template< typename Layout    // Layout of the packed storage
+        , bool Columnwise    // Line orientation flag
+        , typename Type >    // Data type of the elements
+void pmmBlocked( const Type* v, size_t n, const Type* B, size_t ldb,
+                 Type* C, size_t ldc, size_t width, const Type& alpha )
+{
+   const size_t block( packedBlockSize<Type>( n ) );
+
+   for( size_t jj=0UL; jj<width; jj+=block )
+   {
+      const size_t jblock( min( block, width-jj ) );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         pmmLine<Layout,Columnwise>( v, n, k, B+jj, ldb, C+jj, ldc, jblock, alpha );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKED MATRIX/DENSE VECTOR MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed storage kernel for a dense matrix/dense vector multiplication
+//        (\f$ \vec{y}+=\alpha*A*\vec{x} \f$).
+// \ingroup dense_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side packed matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \return void
+//
+// This function performs the multiplication of a packed matrix (see PackedMatrix), which may
+// be wrapped in an adaptor, directly on the packed storage. Each stored element is read
+// exactly once, also in case of a symmetric or Hermitian matrix. Note that the function
+// expects \a y to be disjoint from both \a A and \a x.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename MT1   // Type of the left-hand side matrix operand
+        , bool SO        // Storage order of the left-hand side matrix operand
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scaling factor
+inline void pmv( DenseVector<VT1,false>& y, const DenseMatrix<MT1,SO>& A,
+                 const DenseVector<VT2,false>& x, ST alpha )
+{
+   typedef ElementType_<VT1>  ET;
+   typedef PackedLayout< SO, RemoveAdaptor_<MT1>::structure >  Layout;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT2 );
+
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( VT2 );
+
+   BLAZE_STATIC_ASSERT( IsPacked< RemoveAdaptor_<MT1> >::value );
+
+   BLAZE_INTERNAL_ASSERT( (~A).rows()    == (~y).size(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~x).size(), "Invalid vector size" );
+
+   pmvBlocked<Layout,SO>( (~A).data(), (~A).rows(), (~x).data(), 0UL,
+                          (~y).data(), 0UL, 1UL, ET( alpha ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed storage kernel for a transpose dense vector/dense matrix multiplication
+//        (\f$ \vec{y}^T+=\alpha*\vec{x}^T*A \f$).
+// \ingroup dense_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param x The left-hand side dense vector operand.
+// \param A The right-hand side packed matrix operand.
+// \param alpha The scaling factor for \f$ \vec{x}^T*A \f$.
+// \return void
+//
+// This function performs the multiplication directly on the packed storage of \a A by treating
+// the rows of \a A as the columns of \f$ A^T \f$ and vice versa. Note that the function expects
+// \a y to be disjoint from both \a A and \a x.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename VT2   // Type of the left-hand side vector operand
+        , typename MT1   // Type of the right-hand side matrix operand
+        , bool SO        // Storage order of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factor
+inline void pmv( DenseVector<VT1,true>& y, const DenseVector<VT2,true>& x,
+                 const DenseMatrix<MT1,SO>& A, ST alpha )
+{
+   typedef ElementType_<VT1>  ET;
+   typedef PackedLayout< SO, RemoveAdaptor_<MT1>::structure >  Layout;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT2 );
+
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( VT2 );
+
+   BLAZE_STATIC_ASSERT( IsPacked< RemoveAdaptor_<MT1> >::value );
+
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~y).size(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~A).rows()    == (~x).size(), "Invalid vector size" );
+
+   pmvBlocked<Layout,!SO>( (~A).data(), (~A).rows(), (~x).data(), 0UL,
+                           (~y).data(), 0UL, 1UL, ET( alpha ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKED MATRIX/DENSE MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed storage kernel for a multiplication with a left-hand side packed matrix.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side packed matrix operand.
+// \param B The right-hand side dense matrix operand with the storage order of \a C.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// For a column-major target matrix each column of \a C is computed by a packed matrix/vector
+// multiplication, for a row-major target matrix each stored element of \a A updates a complete
+// row of \a C.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , typename ET >  // Type of the scaling factor
+inline void pmmLeft( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                     const DenseMatrix<MT3,SO1>& B, const ET& alpha, TrueType )
+{
+   typedef PackedLayout< SO2, RemoveAdaptor_<MT2>::structure >  Layout;
+
+   if( SO1 ) {
+      pmvBlocked<Layout,SO2>( (~A).data(), (~A).rows(), (~B).data(), (~B).spacing(),
+                              (~C).data(), (~C).spacing(), (~C).columns(), alpha );
+   }
+   else {
+      pmmBlocked<Layout,SO2>( (~A).data(), (~A).rows(), (~B).data(), (~B).spacing(),
+                              (~C).data(), (~C).spacing(), (~C).columns(), alpha );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed storage kernel for a multiplication with a left-hand side packed matrix.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side packed matrix operand.
+// \param B The right-hand side dense matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This overload handles right-hand side operands without direct data access or with a storage
+// order different from \a C. The operand is copied into a temporary of the storage order of
+// \a C first.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ET >  // Type of the scaling factor
+inline void pmmLeft( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                     const DenseMatrix<MT3,SO3>& B, const ET& alpha, FalseType )
+{
+   const DynamicMatrix<ET,SO1> tmp( ~B );
+   pmmLeft( C, A, tmp, alpha, TrueType() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed storage kernel for a multiplication with a right-hand side packed matrix.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side dense matrix operand with the storage order of \a C.
+// \param B The right-hand side packed matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// The product is computed as \f$ C^T=\alpha*B^T*A^T \f$ by treating the rows of \a B as the
+// columns of \f$ B^T \f$ and vice versa.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ET >  // Type of the scaling factor
+inline void pmmRight( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO1>& A,
+                      const DenseMatrix<MT3,SO3>& B, const ET& alpha, TrueType )
+{
+   typedef PackedLayout< SO3, RemoveAdaptor_<MT3>::structure >  Layout;
+
+   if( SO1 ) {
+      pmmBlocked<Layout,!SO3>( (~B).data(), (~B).rows(), (~A).data(), (~A).spacing(),
+                               (~C).data(), (~C).spacing(), (~C).rows(), alpha );
+   }
+   else {
+      pmvBlocked<Layout,!SO3>( (~B).data(), (~B).rows(), (~A).data(), (~A).spacing(),
+                               (~C).data(), (~C).spacing(), (~C).rows(), alpha );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed storage kernel for a multiplication with a right-hand side packed matrix.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side dense matrix operand.
+// \param B The right-hand side packed matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This overload handles left-hand side operands without direct data access or with a storage
+// order different from \a C. The operand is copied into a temporary of the storage order of
+// \a C first.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ET >  // Type of the scaling factor
+inline void pmmRight( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                      const DenseMatrix<MT3,SO3>& B, const ET& alpha, FalseType )
+{
+   const DynamicMatrix<ET,SO1> tmp( ~A );
+   pmmRight( C, tmp, B, alpha, TrueType() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed storage kernel for a dense matrix/dense matrix multiplication
+//        (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This function performs a multiplication with a packed matrix (see PackedMatrix), which may
+// be wrapped in an adaptor, directly on the packed storage. In case the left-hand side operand
+// is packed it is used as packed operand, otherwise the right-hand side operand. The other
+// operand is used in place in case it provides direct data access and has the storage order of
+// \a C, otherwise it is copied into a temporary matrix. The kernels vectorize along the rows of
+// a row-major and the columns of a column-major target matrix and read each stored element of
+// the packed matrix once per cache block, also in case of a symmetric or Hermitian matrix.
+// Note that \a C must not be aliased with either \a A or \a B.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factor
+inline EnableIf_< IsPacked< RemoveAdaptor_<MT2> > >
+   pmm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+        const DenseMatrix<MT3,SO3>& B, ST alpha )
+{
+   typedef ElementType_<MT1>  ET;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT1 );
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == (~A).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~B).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~B).rows()   , "Invalid matrix sizes"      );
+
+   pmmLeft( ~C, ~A, ~B, ET( alpha ),
+            BoolConstant< HasConstDataAccess<MT3>::value && SO1 == SO3 &&
+                          IsSame< ElementType_<MT3>, ET >::value >() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed storage kernel for a dense matrix/dense matrix multiplication
+//        (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side packed multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This overload handles a right-hand side packed matrix in combination with a left-hand side
+// non-packed matrix. Note that \a C must not be aliased with either \a A or \a B.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factor
+inline DisableIf_< IsPacked< RemoveAdaptor_<MT2> > >
+   pmm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+        const DenseMatrix<MT3,SO3>& B, ST alpha )
+{
+   typedef ElementType_<MT1>  ET;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT1 );
+
+   BLAZE_STATIC_ASSERT( IsPacked< RemoveAdaptor_<MT3> >::value );
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == (~A).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~B).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~B).rows()   , "Invalid matrix sizes"      );
+
+   pmmRight( ~C, ~A, ~B, ET( alpha ),
+             BoolConstant< HasConstDataAccess<MT2>::value && SO1 == SO2 &&
+                           IsSame< ElementType_<MT2>, ET >::value >() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
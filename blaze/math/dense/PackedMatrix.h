@@ -0,0 +1,3282 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedMatrix.h
+//  \brief Implementation of a square dense matrix in packed triangular storage
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/PackedProxy.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/PackedStructure.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsReal.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsPacked.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup packed_matrix PackedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a square \f$ N \times N \f$ matrix in packed storage.
+// \ingroup packed_matrix
+//
+// The PackedMatrix class template is the representation of a square symmetric, Hermitian, lower
+// or upper matrix that only stores the \f$ N \cdot (N+1) / 2 \f$ elements of a single triangle
+// in a contiguous array (similar to the packed storage format of LAPACK). The type of the
+// elements, the storage order, and the structure of the matrix can be specified via the three
+// template parameters:
+
+   \code
+   template< typename Type, bool SO, PackedStructure PS >
+   class PackedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. PackedMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer numeric element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::defaultStorageOrder.
+//  - PS  : specifies the structure of the matrix (blaze::packedSymmetric, blaze::packedHermitian,
+//          blaze::packedLower, or blaze::packedUpper). The default value is blaze::packedSymmetric.
+//
+// A symmetric or Hermitian matrix stores the lower triangle in case of a row-major matrix and
+// the upper triangle in case of a column-major matrix. In both cases the elements are stored
+// row by row (or column by column, respectively), i.e. the layout of the first four rows of a
+// row-major symmetric matrix is
+
+                          \f[\left(\begin{array}{*{4}{c}}
+                          0 &   &   &   \\
+                          1 & 2 &   &   \\
+                          3 & 4 & 5 &   \\
+                          6 & 7 & 8 & 9 \\
+                          \end{array}\right)\f]
+
+// A lower or upper matrix stores its non-zero triangle row by row (or column by column). Access
+// to an element of the other triangle is gained via a PackedProxy, which maps the element to its
+// mirrored counterpart (symmetric matrices), to the complex conjugate of its mirrored counterpart
+// (Hermitian matrices), or to an element that can only be 0 (lower and upper matrices).
+//
+// PackedMatrix can be used on its own or as the adapted matrix of the SymmetricMatrix,
+// HermitianMatrix, LowerMatrix, and UpperMatrix adaptors:
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::SymmetricMatrix;
+   using blaze::LowerMatrix;
+   using blaze::rowMajor;
+   using blaze::packedSymmetric;
+   using blaze::packedLower;
+
+   SymmetricMatrix< PackedMatrix<double,rowMajor,packedSymmetric> > S( 100UL );
+   LowerMatrix< PackedMatrix<double,rowMajor,packedLower> > L( 100UL );
+   blaze::DynamicVector<double> x( 100UL ), y;
+
+   y = S * x;  // Packed symmetric matrix/vector multiplication reading each element once
+   y = L * x;  // Packed triangular matrix/vector multiplication
+   \endcode
+
+// Any assignment to a PackedMatrix checks that the assigned matrix is square and has the
+// according structure. Otherwise a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type                       // Data type of the matrix
+        , bool SO = defaultStorageOrder       // Storage order
+        , PackedStructure PS = packedSymmetric >  // Structure of the matrix
+class PackedMatrix : public DenseMatrix< PackedMatrix<Type,SO,PS>, SO >
+{
+ private:
+   //**********************************************************************************************
+   //! Compilation switch for the mirroring of the stored triangle.
+   enum : bool { mirrored = ( PS == packedSymmetric || PS == packedHermitian ) };
+
+   //! Compilation switch for the conjugation of the mirrored triangle.
+   enum : bool { hermitian = ( PS == packedHermitian ) };
+
+   //! Compilation switch for the memory layout.
+   /*! In case \a leading is set to \a true, row (or column) \f$ k \f$ stores the elements
+       \f$ 0..k \f$ (leading layout). Otherwise it stores the elements \f$ k..N-1 \f$ (trailing
+       layout). */
+   enum : bool { leading = mirrored || ( ( PS == packedLower ) != SO ) };
+   //**********************************************************************************************
+
+   //**PackedIterator class definition*************************************************************
+   /*!\brief Iterator over the elements of a single row/column of a packed matrix.
+   */
+   template< typename MatrixType      // Type of the packed matrix
+           , typename ReferenceType >  // Type of the element reference
+   class PackedIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Type                             ValueType;         //!< Type of the underlying elements.
+      typedef ReferenceType                    PointerType;       //!< Pointer return type.
+      typedef ReferenceType                    ReferenceType_;    //!< Reference return type.
+      typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor of the PackedIterator class.
+      */
+      inline PackedIterator() noexcept
+         : matrix_( nullptr )  // Pointer to the packed matrix
+         , line_  ( 0UL )      // The current row/column of the iterator
+         , pos_   ( 0UL )      // The current position within the row/column
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor of the PackedIterator class.
+      //
+      // \param matrix Reference to the packed matrix.
+      // \param line The row/column of the iterator.
+      // \param pos The initial position within the row/column.
+      */
+      inline PackedIterator( MatrixType& matrix, size_t line, size_t pos ) noexcept
+         : matrix_( &matrix )  // Pointer to the packed matrix
+         , line_  ( line    )  // The current row/column of the iterator
+         , pos_   ( pos     )  // The current position within the row/column
+      {}
+      //*******************************************************************************************
+
+      //**Conversion constructor*******************************************************************
+      /*!\brief Conversion constructor from different PackedIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename MatrixType2, typename ReferenceType2 >
+      inline PackedIterator( const PackedIterator<MatrixType2,ReferenceType2>& it ) noexcept
+         : matrix_( it.matrix_ )  // Pointer to the packed matrix
+         , line_  ( it.line_   )  // The current row/column of the iterator
+         , pos_   ( it.pos_    )  // The current position within the row/column
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline PackedIterator& operator+=( size_t inc ) noexcept {
+         pos_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline PackedIterator& operator-=( size_t dec ) noexcept {
+         pos_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline PackedIterator& operator++() noexcept {
+         ++pos_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const PackedIterator operator++( int ) noexcept {
+         const PackedIterator tmp( *this );
+         ++pos_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline PackedIterator& operator--() noexcept {
+         --pos_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const PackedIterator operator--( int ) noexcept {
+         const PackedIterator tmp( *this );
+         --pos_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The current value of the iterator.
+      */
+      inline ReferenceType operator*() const {
+         return ( SO )?( (*matrix_)(pos_,line_) ):( (*matrix_)(line_,pos_) );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const PackedIterator& rhs ) const noexcept {
+         return pos_ == rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const PackedIterator& rhs ) const noexcept {
+         return pos_ != rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const PackedIterator& rhs ) const noexcept {
+         return pos_ < rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      inline bool operator>( const PackedIterator& rhs ) const noexcept {
+         return pos_ > rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      inline bool operator<=( const PackedIterator& rhs ) const noexcept {
+         return pos_ <= rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      inline bool operator>=( const PackedIterator& rhs ) const noexcept {
+         return pos_ >= rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const PackedIterator& rhs ) const noexcept {
+         return pos_ - rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a PackedIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const PackedIterator operator+( const PackedIterator& it, size_t inc ) noexcept {
+         return PackedIterator( *it.matrix_, it.line_, it.pos_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a PackedIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const PackedIterator operator+( size_t inc, const PackedIterator& it ) noexcept {
+         return PackedIterator( *it.matrix_, it.line_, it.pos_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a PackedIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const PackedIterator operator-( const PackedIterator& it, size_t dec ) noexcept {
+         return PackedIterator( *it.matrix_, it.line_, it.pos_ - dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      MatrixType* matrix_;  //!< Pointer to the packed matrix.
+      size_t      line_;    //!< The current row/column of the iterator.
+      size_t      pos_;     //!< The current position within the row/column.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename MatrixType2, typename ReferenceType2 > friend class PackedIterator;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef PackedMatrix<Type,SO,PS>   This;          //!< Type of this PackedMatrix instance.
+   typedef DenseMatrix<This,SO>       BaseType;      //!< Base type of this PackedMatrix instance.
+   typedef This                       ResultType;    //!< Result type for expression template evaluations.
+   typedef PackedMatrix<Type,!SO,PS>  OppositeType;  //!< Result type with opposite storage order for expression template evaluations.
+
+   //! Transpose type for expression template evaluations.
+   typedef PackedMatrix< Type, !SO, ( PS == packedLower )?( packedUpper )
+                                   :( ( PS == packedUpper )?( packedLower ):( PS ) ) >  TransposeType;
+
+   typedef Type                     ElementType;    //!< Type of the matrix elements.
+   typedef SIMDTrait_<ElementType>  SIMDType;       //!< SIMD type of the matrix elements.
+   typedef const Type               ReturnType;     //!< Return type for expression template evaluations.
+   typedef const This&              CompositeType;  //!< Data type for composite expression templates.
+
+   typedef PackedProxy<This>  Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type         ConstReference;  //!< Reference to a constant matrix value.
+   typedef Type*              Pointer;         //!< Pointer to a non-constant matrix value.
+   typedef const Type*        ConstPointer;    //!< Pointer to a constant matrix value.
+
+   typedef PackedIterator<This,Reference>             Iterator;       //!< Iterator over non-constant elements.
+   typedef PackedIterator<const This,ConstReference>  ConstIterator;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a PackedMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef PackedMatrix<ET,SO,PS>  Other;  //!< The type of the other PackedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via SIMD operations. Since the elements of a packed matrix cannot be
+       accessed row-wise (or column-wise) via SIMD operations, the \a simdEnabled compilation
+       flag is always set to \a false. */
+   enum : bool { simdEnabled = false };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since two elements of a packed matrix may refer to the same stored element,
+       the \a smpAssignable compilation flag is always set to \a false. */
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**Structure of the matrix*********************************************************************
+   //! The structure of the packed matrix.
+   static constexpr PackedStructure structure = PS;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PackedMatrix() noexcept;
+   explicit inline PackedMatrix( size_t n );
+   explicit inline PackedMatrix( size_t m, size_t n, const Type& init );
+   explicit inline PackedMatrix( initializer_list< initializer_list<Type> > list );
+
+   template< typename Other >
+   explicit inline PackedMatrix( size_t m, size_t n, const Other* array );
+
+   template< typename Other, size_t M, size_t N >
+   explicit inline PackedMatrix( const Other (&array)[M][N] );
+
+                                     inline PackedMatrix( const PackedMatrix& m );
+                                     inline PackedMatrix( PackedMatrix&& m ) noexcept;
+   template< typename MT, bool SO2 > inline PackedMatrix( const Matrix<MT,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~PackedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Pointer        data  ( size_t i ) noexcept;
+   inline ConstPointer   data  ( size_t i ) const noexcept;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline PackedMatrix& operator=( const Type& rhs );
+   inline PackedMatrix& operator=( initializer_list< initializer_list<Type> > list );
+
+   template< typename Other, size_t M, size_t N >
+   inline PackedMatrix& operator=( const Other (&array)[M][N] );
+
+   inline PackedMatrix& operator=( const PackedMatrix& rhs );
+   inline PackedMatrix& operator=( PackedMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline PackedMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator*=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline EnableIf_<IsNumeric<Other>, PackedMatrix >& operator*=( Other rhs );
+
+   template< typename Other >
+   inline EnableIf_<IsNumeric<Other>, PackedMatrix >& operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t        rows() const noexcept;
+                              inline size_t        columns() const noexcept;
+                              inline size_t        capacity() const noexcept;
+                              inline size_t        capacity( size_t i ) const noexcept;
+                              inline size_t        nonZeros() const;
+                              inline size_t        nonZeros( size_t i ) const;
+                              inline void          reset();
+                              inline void          reset( size_t i );
+                              inline void          clear();
+                                     void          resize ( size_t n, bool preserve=true );
+                              inline void          resize ( size_t m, size_t n, bool preserve=true );
+                              inline void          extend ( size_t n, bool preserve=true );
+                              inline void          extend ( size_t m, size_t n, bool preserve=true );
+                              inline void          reserve( size_t elements );
+                              inline PackedMatrix& transpose();
+                              inline PackedMatrix& ctranspose();
+   template< typename Other > inline PackedMatrix& scale( const Other& scalar );
+                              inline void          swap( PackedMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Debugging functions*************************************************************************
+   /*!\name Debugging functions */
+   //@{
+   inline bool isIntact() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO2 > inline void assign   ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void assign   ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline bool   isStored( size_t k, size_t l ) noexcept;
+   static inline size_t index   ( size_t k, size_t l, size_t n ) noexcept;
+   static inline size_t lbegin  ( size_t k ) noexcept;
+   static inline size_t lend    ( size_t k, size_t n ) noexcept;
+
+   template< typename MT, bool SO2 >
+   static inline bool canRepresent( const Matrix<MT,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                //!< The current number of rows and columns of the matrix.
+   size_t capacity_;         //!< The maximum capacity of the matrix.
+   Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated matrix elements.
+                             /*!< Row (or column) \f$ k \f$ of the stored triangle starts at
+                                  offset \f$ k \cdot (k+1) / 2 \f$ in case of the leading layout
+                                  and at offset \f$ k \cdot (2N-k+1) / 2 \f$ in case of the
+                                  trailing layout. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+/*! \cond BLAZE_INTERNAL */
+template< typename Type, bool SO, PackedStructure PS >
+constexpr PackedStructure PackedMatrix<Type,SO,PS>::structure;
+/*! \endcond */
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for PackedMatrix.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline PackedMatrix<Type,SO,PS>::PackedMatrix() noexcept
+   : n_       ( 0UL )      // The current number of rows and columns of the matrix
+   , capacity_( 0UL )      // The maximum capacity of the matrix
+   , v_       ( nullptr )  // The matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ n \times n \f$.
+//
+// \param n The number of rows and columns of the matrix.
+//
+// All stored matrix elements are initialized to their default value.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline PackedMatrix<Type,SO,PS>::PackedMatrix( size_t n )
+   : n_       ( n )                            // The current number of rows and columns of the matrix
+   , capacity_( n*(n+1UL)/2UL )                // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+{
+   std::fill( v_, v_+capacity_, Type() );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogenous initialization of all \f$ n \times n \f$ matrix elements.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param init The initial value of the stored matrix elements.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// All stored matrix elements are initialized with the specified value. In case of a lower or
+// upper matrix, the elements of the other triangle remain 0. In case \a m and \a n don't match
+// or in case \a init is not a real value for a Hermitian matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline PackedMatrix<Type,SO,PS>::PackedMatrix( size_t m, size_t n, const Type& init )
+   : n_       ( n )              // The current number of rows and columns of the matrix
+   , capacity_( n*(n+1UL)/2UL )  // The maximum capacity of the matrix
+   , v_       ( nullptr )        // The matrix elements
+{
+   if( m != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of non-square packed matrix" );
+   }
+
+   if( hermitian && !isReal( init ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of Hermitian packed matrix" );
+   }
+
+   v_ = allocate<Type>( capacity_ );
+   std::fill( v_, v_+capacity_, init );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of all matrix elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// This constructor provides the option to explicitly initialize the elements of the matrix by
+// means of an initializer list:
+
+   \code
+   using blaze::rowMajor;
+   using blaze::packedSymmetric;
+
+   blaze::PackedMatrix<int,rowMajor,packedSymmetric> A{ { 1, 2, 3 },
+                                                        { 2, 4, 5 },
+                                                        { 3, 5, 6 } };
+   \endcode
+
+// The matrix is sized according to the size of the initializer list. Missing values are
+// initialized as default. In case the resulting matrix is not square or does not have the
+// structure of the packed matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline PackedMatrix<Type,SO,PS>::PackedMatrix( initializer_list< initializer_list<Type> > list )
+   : PackedMatrix( DynamicMatrix<Type,SO>( list ) )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Array initialization of all matrix elements.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param array Dynamic array for the initialization.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// This constructor offers the option to directly initialize the elements of the matrix with a
+// dynamic array in the same layout as used for a DynamicMatrix with the same storage order.
+// Note that it is expected that the given \a array has at least \a m by \a n elements. Providing
+// an array with less elements results in undefined behavior! In case the given array does not
+// represent a square matrix with the structure of the packed matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename Other >     // Data type of the initialization array
+inline PackedMatrix<Type,SO,PS>::PackedMatrix( size_t m, size_t n, const Other* array )
+   : PackedMatrix( DynamicMatrix<Type,SO>( m, n, array ) )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Array initialization of all matrix elements.
+//
+// \param array \f$ M \times N \f$ dimensional array for the initialization.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// This constructor offers the option to directly initialize the elements of the matrix with a
+// static array. Missing values are initialized with default values. In case the given array
+// does not represent a square matrix with the structure of the packed matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename Other       // Data type of the initialization array
+        , size_t M             // Number of rows of the initialization array
+        , size_t N >           // Number of columns of the initialization array
+inline PackedMatrix<Type,SO,PS>::PackedMatrix( const Other (&array)[M][N] )
+   : PackedMatrix( DynamicMatrix<Type,SO>( array ) )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for PackedMatrix.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline PackedMatrix<Type,SO,PS>::PackedMatrix( const PackedMatrix& m )
+   : n_       ( m.n_ )                         // The current number of rows and columns of the matrix
+   , capacity_( n_*(n_+1UL)/2UL )              // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+{
+   BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
+
+   std::copy( m.v_, m.v_+capacity_, v_ );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for PackedMatrix.
+//
+// \param m The matrix to be moved into this instance.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline PackedMatrix<Type,SO,PS>::PackedMatrix( PackedMatrix&& m ) noexcept
+   : n_       ( m.n_        )  // The current number of rows and columns of the matrix
+   , capacity_( m.capacity_ )  // The maximum capacity of the matrix
+   , v_       ( m.v_        )  // The matrix elements
+{
+   m.n_        = 0UL;
+   m.capacity_ = 0UL;
+   m.v_        = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// In case the given matrix is not square or does not have the structure of the packed matrix,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename MT          // Type of the foreign matrix
+        , bool SO2 >           // Storage order of the foreign matrix
+inline PackedMatrix<Type,SO,PS>::PackedMatrix( const Matrix<MT,SO2>& m )
+   : n_       ( 0UL )      // The current number of rows and columns of the matrix
+   , capacity_( 0UL )      // The maximum capacity of the matrix
+   , v_       ( nullptr )  // The matrix elements
+{
+   *this = ~m;
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for PackedMatrix.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline PackedMatrix<Type,SO,PS>::~PackedMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Proxy to the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline typename PackedMatrix<Type,SO,PS>::Reference
+   PackedMatrix<Type,SO,PS>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   if( isStored( k, l ) ) {
+      return Reference( v_+index( k, l, n_ ), ( hermitian && k == l )?( Reference::diagonal )
+                                                                     :( Reference::direct ) );
+   }
+   else if( mirrored ) {
+      return Reference( v_+index( l, k, n_ ), ( hermitian )?( Reference::conjugated )
+                                                           :( Reference::direct ) );
+   }
+   else {
+      return Reference( nullptr, Reference::restricted );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline typename PackedMatrix<Type,SO,PS>::ConstReference
+   PackedMatrix<Type,SO,PS>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   if( isStored( k, l ) )
+      return v_[index( k, l, n_ )];
+   else if( hermitian )
+      return conj( v_[index( l, k, n_ )] );
+   else if( mirrored )
+      return v_[index( l, k, n_ )];
+   else
+      return Type();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Proxy to the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline typename PackedMatrix<Type,SO,PS>::Reference
+   PackedMatrix<Type,SO,PS>::at( size_t i, size_t j )
+{
+   if( i >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline typename PackedMatrix<Type,SO,PS>::ConstReference
+   PackedMatrix<Type,SO,PS>::at( size_t i, size_t j ) const
+{
+   if( i >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the packed matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the packed matrix. Note that the
+// storage only contains the \f$ N \cdot (N+1) / 2 \f$ elements of the stored triangle (see the
+// PackedMatrix class description for the memory layout).
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline typename PackedMatrix<Type,SO,PS>::Pointer
+   PackedMatrix<Type,SO,PS>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the packed matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the packed matrix. Note that the
+// storage only contains the \f$ N \cdot (N+1) / 2 \f$ elements of the stored triangle (see the
+// PackedMatrix class description for the memory layout).
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline typename PackedMatrix<Type,SO,PS>::ConstPointer
+   PackedMatrix<Type,SO,PS>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the first stored element of row/column \a i. Note that
+// only the elements of the stored triangle lie adjacent to each other, i.e. the row/column
+// contains the elements \f$ 0..i \f$ or \f$ i..N-1 \f$ (see the PackedMatrix class
+// description for the memory layout).
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline typename PackedMatrix<Type,SO,PS>::Pointer
+   PackedMatrix<Type,SO,PS>::data( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return v_ + index( i, lbegin( i ), n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the first stored element of row/column \a i. Note that
+// only the elements of the stored triangle lie adjacent to each other, i.e. the row/column
+// contains the elements \f$ 0..i \f$ or \f$ i..N-1 \f$ (see the PackedMatrix class
+// description for the memory layout).
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline typename PackedMatrix<Type,SO,PS>::ConstPointer
+   PackedMatrix<Type,SO,PS>::data( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return v_ + index( i, lbegin( i ), n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// element of row \a i, in case the storage flag is set to \a columnMajor the function returns an
+// iterator to the first element of column \a i.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline typename PackedMatrix<Type,SO,PS>::Iterator
+   PackedMatrix<Type,SO,PS>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return Iterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// element of row \a i, in case the storage flag is set to \a columnMajor the function returns an
+// iterator to the first element of column \a i.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline typename PackedMatrix<Type,SO,PS>::ConstIterator
+   PackedMatrix<Type,SO,PS>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// element of row \a i, in case the storage flag is set to \a columnMajor the function returns an
+// iterator to the first element of column \a i.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline typename PackedMatrix<Type,SO,PS>::ConstIterator
+   PackedMatrix<Type,SO,PS>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline typename PackedMatrix<Type,SO,PS>::Iterator
+   PackedMatrix<Type,SO,PS>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return Iterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline typename PackedMatrix<Type,SO,PS>::ConstIterator
+   PackedMatrix<Type,SO,PS>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline typename PackedMatrix<Type,SO,PS>::ConstIterator
+   PackedMatrix<Type,SO,PS>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all stored matrix elements.
+//
+// \param rhs Scalar value to be assigned to all stored matrix elements.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to Hermitian packed matrix.
+//
+// In case of a lower or upper matrix, the elements of the other triangle remain 0. In case of
+// a Hermitian matrix and a scalar value with non-zero imaginary part, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline PackedMatrix<Type,SO,PS>& PackedMatrix<Type,SO,PS>::operator=( const Type& rhs )
+{
+   if( hermitian && !isReal( rhs ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to Hermitian packed matrix" );
+   }
+
+   std::fill( v_, v_+n_*(n_+1UL)/2UL, rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List assignment to all matrix elements.
+//
+// \param list The initializer list.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// The matrix is resized according to the given initializer list and all its elements are
+// assigned the values from the given initializer list. Missing values are initialized as
+// default. In case the resulting matrix is not square or does not have the structure of the
+// packed matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline PackedMatrix<Type,SO,PS>&
+   PackedMatrix<Type,SO,PS>::operator=( initializer_list< initializer_list<Type> > list )
+{
+   return *this = DynamicMatrix<Type,SO>( list );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Array assignment to all matrix elements.
+//
+// \param array \f$ M \times N \f$ dimensional array for the assignment.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ array and initialized with
+// the values from the given array. Missing values are initialized with default values. In case
+// the given array does not represent a square matrix with the structure of the packed matrix,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename Other       // Data type of the initialization array
+        , size_t M             // Number of rows of the initialization array
+        , size_t N >           // Number of columns of the initialization array
+inline PackedMatrix<Type,SO,PS>& PackedMatrix<Type,SO,PS>::operator=( const Other (&array)[M][N] )
+{
+   return *this = DynamicMatrix<Type,SO>( array );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for PackedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ N \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline PackedMatrix<Type,SO,PS>& PackedMatrix<Type,SO,PS>::operator=( const PackedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.n_, false );
+   std::copy( rhs.v_, rhs.v_+n_*(n_+1UL)/2UL, v_ );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for PackedMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline PackedMatrix<Type,SO,PS>& PackedMatrix<Type,SO,PS>::operator=( PackedMatrix&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   n_        = rhs.n_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.n_        = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// The matrix is resized according to the given \f$ N \times N \f$ matrix and initialized as a
+// copy of this matrix. In case the given matrix is not square or does not have the structure
+// of the packed matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename MT          // Type of the right-hand side matrix
+        , bool SO2 >           // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,SO,PS>& PackedMatrix<Type,SO,PS>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to packed matrix" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      PackedMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else if( IsComputation<MT>::value && !IsSame<ResultType_<MT>,This>::value ) {
+      const ResultType_<MT> tmp( ~rhs );
+      if( !canRepresent( tmp ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to packed matrix" );
+      }
+      resize( tmp.rows(), false );
+      assign( tmp );
+   }
+   else {
+      if( !canRepresent( ~rhs ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to packed matrix" );
+      }
+      resize( (~rhs).rows(), false );
+      assign( ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid addition to packed matrix.
+//
+// In case the current sizes of the two matrices don't match or in case the given matrix does
+// not have the structure of the packed matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename MT          // Type of the right-hand side matrix
+        , bool SO2 >           // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,SO,PS>& PackedMatrix<Type,SO,PS>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ||
+       ( IsComputation<MT>::value && !IsSame<ResultType_<MT>,This>::value ) ) {
+      const ResultType_<MT> tmp( ~rhs );
+      if( !canRepresent( tmp ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid addition to packed matrix" );
+      }
+      addAssign( tmp );
+   }
+   else {
+      if( !canRepresent( ~rhs ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid addition to packed matrix" );
+      }
+      addAssign( ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid subtraction from packed matrix.
+//
+// In case the current sizes of the two matrices don't match or in case the given matrix does
+// not have the structure of the packed matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename MT          // Type of the right-hand side matrix
+        , bool SO2 >           // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,SO,PS>& PackedMatrix<Type,SO,PS>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ||
+       ( IsComputation<MT>::value && !IsSame<ResultType_<MT>,This>::value ) ) {
+      const ResultType_<MT> tmp( ~rhs );
+      if( !canRepresent( tmp ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid subtraction from packed matrix" );
+      }
+      subAssign( tmp );
+   }
+   else {
+      if( !canRepresent( ~rhs ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid subtraction from packed matrix" );
+      }
+      subAssign( ~rhs );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// In case the current sizes of the two matrices don't match or in case the result of the
+// multiplication does not have the structure of the packed matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename MT          // Type of the right-hand side matrix
+        , bool SO2 >           // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,SO,PS>& PackedMatrix<Type,SO,PS>::operator*=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   return *this = (*this) * (~rhs);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Invalid scaling of Hermitian packed matrix.
+//
+// In case of a Hermitian matrix and a scalar value with non-zero imaginary part, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename Other >     // Data type of the right-hand side scalar
+inline EnableIf_<IsNumeric<Other>, PackedMatrix<Type,SO,PS> >&
+   PackedMatrix<Type,SO,PS>::operator*=( Other rhs )
+{
+   if( hermitian && !isReal( rhs ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid scaling of Hermitian packed matrix" );
+   }
+
+   const size_t size( n_*(n_+1UL)/2UL );
+   for( size_t i=0UL; i<size; ++i )
+      v_[i] *= rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Invalid scaling of Hermitian packed matrix.
+//
+// In case of a Hermitian matrix and a scalar value with non-zero imaginary part, a
+// \a std::invalid_argument exception is thrown.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename Other >     // Data type of the right-hand side scalar
+inline EnableIf_<IsNumeric<Other>, PackedMatrix<Type,SO,PS> >&
+   PackedMatrix<Type,SO,PS>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   if( hermitian && !isReal( rhs ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid scaling of Hermitian packed matrix" );
+   }
+
+   const size_t size( n_*(n_+1UL)/2UL );
+   for( size_t i=0UL; i<size; ++i )
+      v_[i] /= rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline size_t PackedMatrix<Type,SO,PS>::rows() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline size_t PackedMatrix<Type,SO,PS>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+//
+// Note that the capacity refers to the number of stored elements, i.e. a packed matrix of size
+// \f$ N \times N \f$ requires a capacity of at least \f$ N \cdot (N+1) / 2 \f$.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline size_t PackedMatrix<Type,SO,PS>::capacity() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// Since each row/column can be accessed in full via the PackedProxy class, the function returns
+// the number of columns (in case of a row-major matrix) or rows (in case of a column-major
+// matrix).
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline size_t PackedMatrix<Type,SO,PS>::capacity( size_t i ) const noexcept
+{
+   UNUSED_PARAMETER( i );
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the matrix.
+//
+// In case of a symmetric or Hermitian matrix, each non-zero element of the stored triangle
+// (except the diagonal elements) counts twice.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline size_t PackedMatrix<Type,SO,PS>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t lend( this->lend( k, n_ ) );
+      for( size_t l=lbegin( k ); l<lend; ++l ) {
+         if( !isDefault( v_[index( k, l, n_ )] ) )
+            nonzeros += ( mirrored && k != l )?( 2UL ):( 1UL );
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline size_t PackedMatrix<Type,SO,PS>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t l=0UL; l<n_; ++l ) {
+      if( isStored( i, l ) ) {
+         if( !isDefault( v_[index( i, l, n_ )] ) )
+            ++nonzeros;
+      }
+      else if( mirrored ) {
+         if( !isDefault( v_[index( l, i, n_ )] ) )
+            ++nonzeros;
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline void PackedMatrix<Type,SO,PS>::reset()
+{
+   using blaze::clear;
+
+   const size_t size( n_*(n_+1UL)/2UL );
+   for( size_t i=0UL; i<size; ++i )
+      clear( v_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+// Note that in case of a symmetric or Hermitian matrix this also resets the corresponding
+// column/row, since these elements share their storage.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline void PackedMatrix<Type,SO,PS>::reset( size_t i )
+{
+   using blaze::clear;
+
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+
+   for( size_t l=0UL; l<n_; ++l ) {
+      if( isStored( i, l ) )
+         clear( v_[index( i, l, n_ )] );
+      else if( mirrored )
+         clear( v_[index( l, i, n_ )] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ N \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline void PackedMatrix<Type,SO,PS>::clear()
+{
+   n_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param n The new number of rows and columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ n \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true. However, new matrix elements are not initialized!
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+void PackedMatrix<Type,SO,PS>::resize( size_t n, bool preserve )
+{
+   using blaze::min;
+
+   if( n == n_ ) return;
+
+   const size_t size( n*(n+1UL)/2UL );
+
+   if( preserve )
+   {
+      Type* BLAZE_RESTRICT v = allocate<Type>( size );
+      const size_t min_n( min( n, n_ ) );
+
+      for( size_t k=0UL; k<min_n; ++k ) {
+         const size_t lbegin( this->lbegin( k ) );
+         const size_t lend  ( leading ? k+1UL : min_n );
+         transfer( v_+index( k, lbegin, n_ ), v_+index( k, lbegin, n_ )+( lend - lbegin ),
+                   v+index( k, lbegin, n ) );
+      }
+
+      std::swap( v_, v );
+      deallocate( v );
+      capacity_ = size;
+   }
+   else if( size > capacity_ ) {
+      Type* BLAZE_RESTRICT v = allocate<Type>( size );
+      std::swap( v_, v );
+      deallocate( v );
+      capacity_ = size;
+   }
+
+   n_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Invalid resize arguments for packed matrix.
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. In case the
+// given sizes don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline void PackedMatrix<Type,SO,PS>::resize( size_t m, size_t n, bool preserve )
+{
+   if( m != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid resize arguments for packed matrix" );
+   }
+
+   resize( n, preserve );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extending the size of the matrix.
+//
+// \param n Number of additional rows and columns.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function increases the matrix size by \a n rows and \a n columns. During this operation,
+// new dynamic memory may be allocated in case the capacity of the matrix is too small. Therefore
+// this function potentially changes all matrix elements. In order to preserve the old matrix
+// values, the \a preserve flag can be set to \a true. However, new matrix elements are not
+// initialized!
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline void PackedMatrix<Type,SO,PS>::extend( size_t n, bool preserve )
+{
+   resize( n_+n, preserve );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extending the size of the matrix.
+//
+// \param m Number of additional rows.
+// \param n Number of additional columns.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Invalid extension arguments for packed matrix.
+//
+// This function increases the matrix size by \a m rows and \a n columns. In case the given
+// sizes don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline void PackedMatrix<Type,SO,PS>::extend( size_t m, size_t n, bool preserve )
+{
+   if( m != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid extension arguments for packed matrix" );
+   }
+
+   resize( n_+n, preserve );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the matrix.
+//
+// \param elements The new minimum capacity of the packed matrix.
+// \return void
+//
+// This function increases the capacity of the packed matrix to at least \a elements elements.
+// The current values of the matrix elements are preserved.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline void PackedMatrix<Type,SO,PS>::reserve( size_t elements )
+{
+   if( elements > capacity_ )
+   {
+      // Allocating a new array
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+
+      // Initializing the new array
+      transfer( v_, v_+capacity_, tmp );
+
+      // Replacing the old array
+      std::swap( tmp, v_ );
+      deallocate( tmp );
+      capacity_ = elements;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+// \exception std::logic_error Invalid transpose of a packed triangular matrix.
+//
+// The transpose of a symmetric matrix is the matrix itself, the transpose of a Hermitian matrix
+// is its complex conjugate. Since a lower or upper matrix cannot be transposed in place, the
+// function throws a \a std::logic_error exception in case the matrix is not diagonal.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline PackedMatrix<Type,SO,PS>& PackedMatrix<Type,SO,PS>::transpose()
+{
+   if( hermitian ) {
+      const size_t size( n_*(n_+1UL)/2UL );
+      for( size_t i=0UL; i<size; ++i )
+         conjugate( v_[i] );
+   }
+   else if( !mirrored && !isDiagonal( *this ) ) {
+      BLAZE_THROW_LOGIC_ERROR( "Invalid transpose of a packed triangular matrix" );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+// \exception std::logic_error Invalid transpose of a packed triangular matrix.
+//
+// The conjugate transpose of a Hermitian matrix is the matrix itself, the conjugate transpose
+// of a symmetric matrix is its complex conjugate. Since a lower or upper matrix cannot be
+// transposed in place, the function throws a \a std::logic_error exception in case the matrix
+// is not diagonal.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline PackedMatrix<Type,SO,PS>& PackedMatrix<Type,SO,PS>::ctranspose()
+{
+   if( !mirrored && !isDiagonal( *this ) ) {
+      BLAZE_THROW_LOGIC_ERROR( "Invalid transpose of a packed triangular matrix" );
+   }
+
+   if( !hermitian ) {
+      const size_t size( n_*(n_+1UL)/2UL );
+      for( size_t i=0UL; i<size; ++i )
+         conjugate( v_[i] );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Invalid scaling of Hermitian packed matrix.
+//
+// In case of a Hermitian matrix and a scalar value with non-zero imaginary part, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename Other >     // Data type of the scalar value
+inline PackedMatrix<Type,SO,PS>& PackedMatrix<Type,SO,PS>::scale( const Other& scalar )
+{
+   if( hermitian && !isReal( scalar ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid scaling of Hermitian packed matrix" );
+   }
+
+   const size_t size( n_*(n_+1UL)/2UL );
+   for( size_t i=0UL; i<size; ++i )
+      v_[i] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline void PackedMatrix<Type,SO,PS>::swap( PackedMatrix& m ) noexcept
+{
+   std::swap( n_       , m.n_        );
+   std::swap( capacity_, m.capacity_ );
+   std::swap( v_       , m.v_        );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the element \f$ (k,l) \f$ is part of the stored triangle.
+//
+// \param k The index of the row (row-major) or column (column-major).
+// \param l The index of the column (row-major) or row (column-major).
+// \return \a true in case the element is stored, \a false if not.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline bool PackedMatrix<Type,SO,PS>::isStored( size_t k, size_t l ) noexcept
+{
+   return ( leading )?( l <= k ):( l >= k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the storage offset of the stored element \f$ (k,l) \f$.
+//
+// \param k The index of the row (row-major) or column (column-major).
+// \param l The index of the column (row-major) or row (column-major).
+// \param n The number of rows and columns of the matrix.
+// \return The offset of the element within the packed storage.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline size_t PackedMatrix<Type,SO,PS>::index( size_t k, size_t l, size_t n ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( isStored( k, l ), "Invalid access to non-stored element" );
+
+   return ( leading )?( k*(k+1UL)/2UL + l )
+                     :( k*(2UL*n-k+1UL)/2UL + ( l - k ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the first stored element of row/column \a k.
+//
+// \param k The index of the row (row-major) or column (column-major).
+// \return The index of the first stored element.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline size_t PackedMatrix<Type,SO,PS>::lbegin( size_t k ) noexcept
+{
+   return ( leading )?( 0UL ):( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index one past the last stored element of row/column \a k.
+//
+// \param k The index of the row (row-major) or column (column-major).
+// \param n The number of rows and columns of the matrix.
+// \return The index one past the last stored element.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline size_t PackedMatrix<Type,SO,PS>::lend( size_t k, size_t n ) noexcept
+{
+   return ( leading )?( k+1UL ):( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the given matrix has the structure of the packed matrix.
+//
+// \param m The matrix to be checked.
+// \return \a true in case the matrix can be represented by the packed matrix, \a false if not.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename MT          // Type of the matrix
+        , bool SO2 >           // Storage order of the matrix
+inline bool PackedMatrix<Type,SO,PS>::canRepresent( const Matrix<MT,SO2>& m )
+{
+   if( IsSame<ResultType_<MT>,This>::value )
+      return true;
+
+   switch( PS ) {
+      case packedSymmetric: return IsSymmetric<MT>::value || isSymmetric( ~m );
+      case packedHermitian: return IsHermitian<MT>::value || isHermitian( ~m );
+      case packedLower    : return IsLower<MT>::value     || isLower( ~m );
+      default             : return IsUpper<MT>::value     || isUpper( ~m );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEBUGGING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the packed matrix are intact.
+//
+// \return \a true in case the packed matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the packed matrix are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline bool PackedMatrix<Type,SO,PS>::isIntact() const noexcept
+{
+   if( n_*(n_+1UL)/2UL > capacity_ )
+      return false;
+
+   if( hermitian ) {
+      for( size_t k=0UL; k<n_; ++k ) {
+         if( !isReal( v_[index( k, k, n_ )] ) )
+            return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename Other >     // Data type of the foreign expression
+inline bool PackedMatrix<Type,SO,PS>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename Other >     // Data type of the foreign expression
+inline bool PackedMatrix<Type,SO,PS>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a false since the rows/columns of a packed matrix are never aligned.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline bool PackedMatrix<Type,SO,PS>::isAligned() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a false since two elements of a packed matrix may share their storage.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline bool PackedMatrix<Type,SO,PS>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Only the elements of the stored triangle are read from \a rhs.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename MT          // Type of the right-hand side dense matrix
+        , bool SO2 >           // Storage order of the right-hand side dense matrix
+inline void PackedMatrix<Type,SO,PS>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   Type* BLAZE_RESTRICT v( v_ );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t lend( this->lend( k, n_ ) );
+      for( size_t l=lbegin( k ); l<lend; ++l, ++v )
+         *v = ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Only the elements of the stored triangle are read from \a rhs.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename MT          // Type of the right-hand side sparse matrix
+        , bool SO2 >           // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,SO,PS>::assign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   reset();
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( ConstIterator_<MT> element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+         const size_t k( SO == SO2 ? i : element->index() );
+         const size_t l( SO == SO2 ? element->index() : i );
+         if( isStored( k, l ) )
+            v_[index( k, l, n_ )] = element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Only the elements of the stored triangle are read from \a rhs.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename MT          // Type of the right-hand side dense matrix
+        , bool SO2 >           // Storage order of the right-hand side dense matrix
+inline void PackedMatrix<Type,SO,PS>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   Type* BLAZE_RESTRICT v( v_ );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t lend( this->lend( k, n_ ) );
+      for( size_t l=lbegin( k ); l<lend; ++l, ++v )
+         *v += ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Only the elements of the stored triangle are read from \a rhs.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename MT          // Type of the right-hand side sparse matrix
+        , bool SO2 >           // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,SO,PS>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( ConstIterator_<MT> element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+         const size_t k( SO == SO2 ? i : element->index() );
+         const size_t l( SO == SO2 ? element->index() : i );
+         if( isStored( k, l ) )
+            v_[index( k, l, n_ )] += element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Only the elements of the stored triangle are read from \a rhs.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename MT          // Type of the right-hand side dense matrix
+        , bool SO2 >           // Storage order of the right-hand side dense matrix
+inline void PackedMatrix<Type,SO,PS>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   Type* BLAZE_RESTRICT v( v_ );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t lend( this->lend( k, n_ ) );
+      for( size_t l=lbegin( k ); l<lend; ++l, ++v )
+         *v -= ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Only the elements of the stored triangle are read from \a rhs.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+template< typename MT          // Type of the right-hand side sparse matrix
+        , bool SO2 >           // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,SO,PS>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( ConstIterator_<MT> element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+         const size_t k( SO == SO2 ? i : element->index() );
+         const size_t l( SO == SO2 ? element->index() : i );
+         if( isStored( k, l ) )
+            v_[index( k, l, n_ )] -= element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedMatrix operators */
+//@{
+template< typename Type, bool SO, PackedStructure PS >
+inline void reset( PackedMatrix<Type,SO,PS>& m );
+
+template< typename Type, bool SO, PackedStructure PS >
+inline void reset( PackedMatrix<Type,SO,PS>& m, size_t i );
+
+template< typename Type, bool SO, PackedStructure PS >
+inline void clear( PackedMatrix<Type,SO,PS>& m );
+
+template< typename Type, bool SO, PackedStructure PS >
+inline bool isDefault( const PackedMatrix<Type,SO,PS>& m );
+
+template< typename Type, bool SO, PackedStructure PS >
+inline bool isIntact( const PackedMatrix<Type,SO,PS>& m ) noexcept;
+
+template< typename Type, bool SO, PackedStructure PS >
+inline void swap( PackedMatrix<Type,SO,PS>& a, PackedMatrix<Type,SO,PS>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline void reset( PackedMatrix<Type,SO,PS>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column of the given packed matrix to
+// their default value. In case the given matrix is a \a rowMajor matrix the function resets the
+// values in row \a i, if it is a \a columnMajor matrix the function resets the values in column
+// \a i.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline void reset( PackedMatrix<Type,SO,PS>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline void clear( PackedMatrix<Type,SO,PS>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given packed matrix is in default state.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline bool isDefault( const PackedMatrix<Type,SO,PS>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given packed matrix are intact.
+// \ingroup packed_matrix
+//
+// \param m The packed matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline bool isIntact( const PackedMatrix<Type,SO,PS>& m ) noexcept
+{
+   return m.isIntact();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two packed matrices.
+// \ingroup packed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , PackedStructure PS >  // Structure of the matrix
+inline void swap( PackedMatrix<Type,SO,PS>& a, PackedMatrix<Type,SO,PS>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISPACKED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, PackedStructure PS >
+struct IsPacked< PackedMatrix<T,SO,PS> > : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, PackedStructure PS >
+struct IsResizable< PackedMatrix<T,SO,PS> > : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, PackedStructure PS, typename T2, size_t M, size_t N >
+struct AddTrait< PackedMatrix<T1,SO,PS>, StaticMatrix<T2,M,N,SO> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< PackedMatrix<T1,SO1,PS>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, false >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, PackedStructure PS >
+struct AddTrait< StaticMatrix<T1,M,N,SO>, PackedMatrix<T2,SO,PS> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, PackedStructure PS >
+struct AddTrait< StaticMatrix<T1,M,N,SO1>, PackedMatrix<T2,SO2,PS> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, false >;
+};
+
+template< typename T1, bool SO, PackedStructure PS, typename T2, size_t M, size_t N >
+struct AddTrait< PackedMatrix<T1,SO,PS>, HybridMatrix<T2,M,N,SO> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< PackedMatrix<T1,SO1,PS>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, false >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, PackedStructure PS >
+struct AddTrait< HybridMatrix<T1,M,N,SO>, PackedMatrix<T2,SO,PS> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, PackedStructure PS >
+struct AddTrait< HybridMatrix<T1,M,N,SO1>, PackedMatrix<T2,SO2,PS> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, false >;
+};
+
+template< typename T1, bool SO, PackedStructure PS, typename T2 >
+struct AddTrait< PackedMatrix<T1,SO,PS>, DynamicMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS, typename T2, bool SO2 >
+struct AddTrait< PackedMatrix<T1,SO1,PS>, DynamicMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2, PackedStructure PS >
+struct AddTrait< DynamicMatrix<T1,SO>, PackedMatrix<T2,SO,PS> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, PackedStructure PS >
+struct AddTrait< DynamicMatrix<T1,SO1>, PackedMatrix<T2,SO2,PS> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, PackedStructure PS, typename T2 >
+struct AddTrait< PackedMatrix<T1,SO,PS>, CompressedMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS, typename T2, bool SO2 >
+struct AddTrait< PackedMatrix<T1,SO1,PS>, CompressedMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2, PackedStructure PS >
+struct AddTrait< CompressedMatrix<T1,SO>, PackedMatrix<T2,SO,PS> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, PackedStructure PS >
+struct AddTrait< CompressedMatrix<T1,SO1>, PackedMatrix<T2,SO2,PS> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, PackedStructure PS, typename T2, bool AF, bool PF >
+struct AddTrait< PackedMatrix<T1,SO,PS>, CustomMatrix<T2,AF,PF,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS, typename T2, bool AF, bool PF, bool SO2 >
+struct AddTrait< PackedMatrix<T1,SO1,PS>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO, typename T2, PackedStructure PS >
+struct AddTrait< CustomMatrix<T1,AF,PF,SO>, PackedMatrix<T2,SO,PS> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, bool SO2, PackedStructure PS >
+struct AddTrait< CustomMatrix<T1,AF,PF,SO1>, PackedMatrix<T2,SO2,PS> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, PackedStructure PS, typename T2 >
+struct AddTrait< PackedMatrix<T1,SO,PS>, PackedMatrix<T2,SO,PS> >
+{
+   using Type = PackedMatrix< AddTrait_<T1,T2>, SO, PS >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS, typename T2, bool SO2 >
+struct AddTrait< PackedMatrix<T1,SO1,PS>, PackedMatrix<T2,SO2,PS> >
+{
+   using Type = PackedMatrix< AddTrait_<T1,T2>, false, PS >;
+};
+
+template< typename T1, bool SO, PackedStructure PS1, typename T2, PackedStructure PS2 >
+struct AddTrait< PackedMatrix<T1,SO,PS1>, PackedMatrix<T2,SO,PS2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS1, typename T2, bool SO2, PackedStructure PS2 >
+struct AddTrait< PackedMatrix<T1,SO1,PS1>, PackedMatrix<T2,SO2,PS2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, false >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, PackedStructure PS, typename T2, size_t M, size_t N >
+struct SubTrait< PackedMatrix<T1,SO,PS>, StaticMatrix<T2,M,N,SO> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< PackedMatrix<T1,SO1,PS>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, false >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, PackedStructure PS >
+struct SubTrait< StaticMatrix<T1,M,N,SO>, PackedMatrix<T2,SO,PS> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, PackedStructure PS >
+struct SubTrait< StaticMatrix<T1,M,N,SO1>, PackedMatrix<T2,SO2,PS> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, false >;
+};
+
+template< typename T1, bool SO, PackedStructure PS, typename T2, size_t M, size_t N >
+struct SubTrait< PackedMatrix<T1,SO,PS>, HybridMatrix<T2,M,N,SO> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< PackedMatrix<T1,SO1,PS>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, false >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, PackedStructure PS >
+struct SubTrait< HybridMatrix<T1,M,N,SO>, PackedMatrix<T2,SO,PS> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, PackedStructure PS >
+struct SubTrait< HybridMatrix<T1,M,N,SO1>, PackedMatrix<T2,SO2,PS> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, false >;
+};
+
+template< typename T1, bool SO, PackedStructure PS, typename T2 >
+struct SubTrait< PackedMatrix<T1,SO,PS>, DynamicMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS, typename T2, bool SO2 >
+struct SubTrait< PackedMatrix<T1,SO1,PS>, DynamicMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2, PackedStructure PS >
+struct SubTrait< DynamicMatrix<T1,SO>, PackedMatrix<T2,SO,PS> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, PackedStructure PS >
+struct SubTrait< DynamicMatrix<T1,SO1>, PackedMatrix<T2,SO2,PS> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, PackedStructure PS, typename T2 >
+struct SubTrait< PackedMatrix<T1,SO,PS>, CompressedMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS, typename T2, bool SO2 >
+struct SubTrait< PackedMatrix<T1,SO1,PS>, CompressedMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2, PackedStructure PS >
+struct SubTrait< CompressedMatrix<T1,SO>, PackedMatrix<T2,SO,PS> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, PackedStructure PS >
+struct SubTrait< CompressedMatrix<T1,SO1>, PackedMatrix<T2,SO2,PS> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, PackedStructure PS, typename T2, bool AF, bool PF >
+struct SubTrait< PackedMatrix<T1,SO,PS>, CustomMatrix<T2,AF,PF,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS, typename T2, bool AF, bool PF, bool SO2 >
+struct SubTrait< PackedMatrix<T1,SO1,PS>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO, typename T2, PackedStructure PS >
+struct SubTrait< CustomMatrix<T1,AF,PF,SO>, PackedMatrix<T2,SO,PS> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, bool SO2, PackedStructure PS >
+struct SubTrait< CustomMatrix<T1,AF,PF,SO1>, PackedMatrix<T2,SO2,PS> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, PackedStructure PS, typename T2 >
+struct SubTrait< PackedMatrix<T1,SO,PS>, PackedMatrix<T2,SO,PS> >
+{
+   using Type = PackedMatrix< SubTrait_<T1,T2>, SO, PS >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS, typename T2, bool SO2 >
+struct SubTrait< PackedMatrix<T1,SO1,PS>, PackedMatrix<T2,SO2,PS> >
+{
+   using Type = PackedMatrix< SubTrait_<T1,T2>, false, PS >;
+};
+
+template< typename T1, bool SO, PackedStructure PS1, typename T2, PackedStructure PS2 >
+struct SubTrait< PackedMatrix<T1,SO,PS1>, PackedMatrix<T2,SO,PS2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS1, typename T2, bool SO2, PackedStructure PS2 >
+struct SubTrait< PackedMatrix<T1,SO1,PS1>, PackedMatrix<T2,SO2,PS2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, false >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, PackedStructure PS, typename T2 >
+struct MultTrait< PackedMatrix<T1,SO,PS>, T2, EnableIf_< IsNumeric<T2> > >
+{
+   using Type = If_< BoolConstant< PS == packedHermitian && IsComplex<T2>::value >
+                  , DynamicMatrix< MultTrait_<T1,T2>, SO >
+                  , PackedMatrix< MultTrait_<T1,T2>, SO, PS > >;
+};
+
+template< typename T1, typename T2, bool SO, PackedStructure PS >
+struct MultTrait< T1, PackedMatrix<T2,SO,PS>, EnableIf_< IsNumeric<T1> > >
+{
+   using Type = If_< BoolConstant< PS == packedHermitian && IsComplex<T1>::value >
+                  , DynamicMatrix< MultTrait_<T1,T2>, SO >
+                  , PackedMatrix< MultTrait_<T1,T2>, SO, PS > >;
+};
+
+template< typename T1, bool SO, PackedStructure PS, typename T2, size_t N >
+struct MultTrait< PackedMatrix<T1,SO,PS>, StaticVector<T2,N,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, size_t N, typename T2, bool SO, PackedStructure PS >
+struct MultTrait< StaticVector<T1,N,true>, PackedMatrix<T2,SO,PS> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO, PackedStructure PS, typename T2, size_t N >
+struct MultTrait< PackedMatrix<T1,SO,PS>, HybridVector<T2,N,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, size_t N, typename T2, bool SO, PackedStructure PS >
+struct MultTrait< HybridVector<T1,N,true>, PackedMatrix<T2,SO,PS> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO, PackedStructure PS, typename T2 >
+struct MultTrait< PackedMatrix<T1,SO,PS>, DynamicVector<T2,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, typename T2, bool SO, PackedStructure PS >
+struct MultTrait< DynamicVector<T1,true>, PackedMatrix<T2,SO,PS> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO, PackedStructure PS, typename T2, bool AF, bool PF >
+struct MultTrait< PackedMatrix<T1,SO,PS>, CustomVector<T2,AF,PF,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool AF, bool PF, typename T2, bool SO, PackedStructure PS >
+struct MultTrait< CustomVector<T1,AF,PF,true>, PackedMatrix<T2,SO,PS> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO, PackedStructure PS, typename T2 >
+struct MultTrait< PackedMatrix<T1,SO,PS>, CompressedVector<T2,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, typename T2, bool SO, PackedStructure PS >
+struct MultTrait< CompressedVector<T1,true>, PackedMatrix<T2,SO,PS> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< PackedMatrix<T1,SO1,PS>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, PackedStructure PS >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, PackedMatrix<T2,SO2,PS> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< PackedMatrix<T1,SO1,PS>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, PackedStructure PS >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, PackedMatrix<T2,SO2,PS> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS, typename T2, bool SO2 >
+struct MultTrait< PackedMatrix<T1,SO1,PS>, DynamicMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, PackedStructure PS >
+struct MultTrait< DynamicMatrix<T1,SO1>, PackedMatrix<T2,SO2,PS> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS, typename T2, bool AF, bool PF, bool SO2 >
+struct MultTrait< PackedMatrix<T1,SO1,PS>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, bool SO2, PackedStructure PS >
+struct MultTrait< CustomMatrix<T1,AF,PF,SO1>, PackedMatrix<T2,SO2,PS> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS, typename T2, bool SO2 >
+struct MultTrait< PackedMatrix<T1,SO1,PS>, CompressedMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, PackedStructure PS >
+struct MultTrait< CompressedMatrix<T1,SO1>, PackedMatrix<T2,SO2,PS> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, PackedStructure PS1, typename T2, bool SO2, PackedStructure PS2 >
+struct MultTrait< PackedMatrix<T1,SO1,PS1>, PackedMatrix<T2,SO2,PS2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, PackedStructure PS, typename T2 >
+struct DivTrait< PackedMatrix<T1,SO,PS>, T2, EnableIf_< IsNumeric<T2> > >
+{
+   using Type = If_< BoolConstant< PS == packedHermitian && IsComplex<T2>::value >
+                  , DynamicMatrix< DivTrait_<T1,T2>, SO >
+                  , PackedMatrix< DivTrait_<T1,T2>, SO, PS > >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, PackedStructure PS, typename T2 >
+struct MathTrait< PackedMatrix<T1,SO,PS>, PackedMatrix<T2,SO,PS> >
+{
+   using HighType = PackedMatrix< typename MathTrait<T1,T2>::HighType, SO, PS >;
+   using LowType  = PackedMatrix< typename MathTrait<T1,T2>::LowType , SO, PS >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, PackedStructure PS >
+struct SubmatrixTrait< PackedMatrix<T1,SO,PS> >
+{
+   using Type = DynamicMatrix<T1,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, PackedStructure PS >
+struct RowTrait< PackedMatrix<T1,SO,PS> >
+{
+   using Type = DynamicVector<T1,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, PackedStructure PS >
+struct ColumnTrait< PackedMatrix<T1,SO,PS> >
+{
+   using Type = DynamicVector<T1,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,923 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedProxy.h
+//  \brief Header file for the PackedProxy class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDPROXY_H_
+#define _BLAZE_MATH_DENSE_PACKEDPROXY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Expression.h>
+#include <blaze/math/constraints/Matrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/proxy/Proxy.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Invert.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsNaN.h>
+#include <blaze/math/shims/IsOne.h>
+#include <blaze/math/shims/IsReal.h>
+#include <blaze/math/shims/IsZero.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/InvalidType.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access proxy for dense matrices in packed storage.
+// \ingroup packed_matrix
+//
+// The PackedProxy provides controlled access to the elements of a non-const matrix in packed
+// storage (see PackedMatrix). Since a packed matrix only stores a single triangle, an element of
+// the other triangle either refers to its mirrored counterpart (in case of a symmetric matrix),
+// to the complex conjugate of its mirrored counterpart (in case of a Hermitian matrix), or to an
+// element that is not stored at all (in case of a lower or upper matrix). The proxy guarantees
+// that a modification is applied to the stored counterpart and that the structure of the matrix
+// is not violated:
+
+   \code
+   using blaze::rowMajor;
+   using blaze::packedSymmetric;
+   using blaze::packedLower;
+
+   blaze::PackedMatrix<int,rowMajor,packedSymmetric> S( 3UL );
+
+   S(0,2) = -2;  //        (  0 0 -2 )
+   S(1,1) =  3;  // => S = (  0 3  5 )
+   S(1,2) =  5;  //        ( -2 5  0 )
+
+   blaze::PackedMatrix<int,rowMajor,packedLower> L( 3UL );
+
+   L(2,0) = 4;  // Assignment to the lower part of the matrix
+   L(0,2) = 0;  // Assigning 0 to the upper part of the matrix has no effect
+   L(0,2) = 7;  // Invalid assignment to restricted matrix element; results in an exception!
+   \endcode
+
+// The same proxy is used for the elements of a BandMatrix. In this case all elements outside
+// of the stored band are restricted.
+//
+// Note that in contrast to a plain reference, assigning one proxy to another assigns the value
+// of the represented element instead of rebinding the proxy.
+*/
+template< typename MT >  // Type of the packed matrix
+class PackedProxy : public Proxy< PackedProxy<MT> >
+{
+ private:
+   //**struct BuiltinType**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Auxiliary struct to determine the value type of the represented complex element.
+   */
+   template< typename T >
+   struct BuiltinType { typedef INVALID_TYPE  Type; };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**struct ComplexType**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Auxiliary struct to determine the value type of the represented complex element.
+   */
+   template< typename T >
+   struct ComplexType { typedef typename T::value_type  Type; };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef ElementType_<MT>        RepresentedType;  //!< Type of the represented matrix element.
+   typedef RepresentedType*        RawPointer;       //!< Pointer to the stored matrix element.
+   typedef const RepresentedType   ConstReference;   //!< Value of the represented element.
+   typedef PackedProxy*            Pointer;          //!< Pointer to the represented element.
+   typedef const PackedProxy*      ConstPointer;     //!< Pointer-to-const to the represented element.
+
+   //! Value type of the represented complex element.
+   typedef typename If_< IsComplex<RepresentedType>
+                       , ComplexType<RepresentedType>
+                       , BuiltinType<RepresentedType> >::Type  ValueType;
+   //**********************************************************************************************
+
+   //**Access modes********************************************************************************
+   /*!\brief Access modes of the proxy.
+   */
+   enum Mode {
+      direct     = 0,  //!< Access to a stored element.
+      diagonal   = 1,  //!< Access to a stored diagonal element of a Hermitian matrix.
+      conjugated = 2,  //!< Access to the complex conjugate of a stored element.
+      restricted = 3   //!< Access to an element that is not stored (always 0).
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PackedProxy( RawPointer value, Mode mode ) noexcept;
+            inline PackedProxy( const PackedProxy& pp ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                          inline const PackedProxy& operator= ( const PackedProxy& pp ) const;
+   template< typename T > inline const PackedProxy& operator= ( const T& value ) const;
+   template< typename T > inline const PackedProxy& operator+=( const T& value ) const;
+   template< typename T > inline const PackedProxy& operator-=( const T& value ) const;
+   template< typename T > inline const PackedProxy& operator*=( const T& value ) const;
+   template< typename T > inline const PackedProxy& operator/=( const T& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Access operators****************************************************************************
+   /*!\name Access operators */
+   //@{
+   inline Pointer      operator->() noexcept;
+   inline ConstPointer operator->() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void reset () const;
+   inline void clear () const;
+   inline void invert() const;
+
+   inline RepresentedType get()          const;
+   inline bool            isRestricted() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator RepresentedType() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Complex data access functions***************************************************************
+   /*!\name Complex data access functions */
+   //@{
+   inline ValueType real() const;
+   inline void      real( ValueType value ) const;
+   inline ValueType imag() const;
+   inline void      imag( ValueType value ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T > inline void checkValue( const T& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   RawPointer value_;  //!< Pointer to the stored matrix element (\a nullptr for restricted elements).
+   Mode       mode_;   //!< The access mode of the proxy.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE        ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE   ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST          ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE       ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_EXPRESSION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE       ( RepresentedType );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization constructor for a PackedProxy.
+//
+// \param value Pointer to the stored matrix element (\a nullptr for restricted elements).
+// \param mode The access mode of the proxy.
+*/
+template< typename MT >  // Type of the packed matrix
+inline PackedProxy<MT>::PackedProxy( RawPointer value, Mode mode ) noexcept
+   : value_( value )  // Pointer to the stored matrix element
+   , mode_ ( mode  )  // The access mode of the proxy
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for PackedProxy.
+//
+// \param pp Packed proxy to be copied.
+*/
+template< typename MT >  // Type of the packed matrix
+inline PackedProxy<MT>::PackedProxy( const PackedProxy& pp ) noexcept
+   : value_( pp.value_ )  // Pointer to the stored matrix element
+   , mode_ ( pp.mode_  )  // The access mode of the proxy
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for PackedProxy.
+//
+// \param pp Packed proxy to be copied.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+//
+// This function assigns the value of the element represented by the given proxy to the element
+// represented by this proxy.
+*/
+template< typename MT >  // Type of the packed matrix
+inline const PackedProxy<MT>& PackedProxy<MT>::operator=( const PackedProxy& pp ) const
+{
+   return ( *this = pp.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment to the accessed matrix element.
+//
+// \param value The new value of the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix element.
+//
+// In case the proxy represents an element that is not stored and \a value is not 0, or in case
+// it represents a diagonal element of a Hermitian matrix and \a value is not a real number, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the packed matrix
+template< typename T >   // Type of the right-hand side value
+inline const PackedProxy<MT>& PackedProxy<MT>::operator=( const T& value ) const
+{
+   checkValue( value );
+
+   if( mode_ == conjugated )
+      *value_ = conj( value );
+   else if( mode_ != restricted )
+      *value_ = value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment to the accessed matrix element.
+//
+// \param value The right-hand side value to be added to the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix element.
+//
+// In case the proxy represents an element that is not stored and \a value is not 0, or in case
+// it represents a diagonal element of a Hermitian matrix and \a value is not a real number, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the packed matrix
+template< typename T >   // Type of the right-hand side value
+inline const PackedProxy<MT>& PackedProxy<MT>::operator+=( const T& value ) const
+{
+   checkValue( value );
+
+   if( mode_ == conjugated )
+      *value_ += conj( value );
+   else if( mode_ != restricted )
+      *value_ += value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment to the accessed matrix element.
+//
+// \param value The right-hand side value to be subtracted from the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix element.
+//
+// In case the proxy represents an element that is not stored and \a value is not 0, or in case
+// it represents a diagonal element of a Hermitian matrix and \a value is not a real number, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the packed matrix
+template< typename T >   // Type of the right-hand side value
+inline const PackedProxy<MT>& PackedProxy<MT>::operator-=( const T& value ) const
+{
+   checkValue( value );
+
+   if( mode_ == conjugated )
+      *value_ -= conj( value );
+   else if( mode_ != restricted )
+      *value_ -= value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment to the accessed matrix element.
+//
+// \param value The right-hand side value for the multiplication.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix element.
+//
+// In case the proxy represents a diagonal element of a Hermitian matrix and \a value is not a
+// real number, a \a std::invalid_argument exception is thrown. Multiplying an element that is
+// not stored has no effect.
+*/
+template< typename MT >  // Type of the packed matrix
+template< typename T >   // Type of the right-hand side value
+inline const PackedProxy<MT>& PackedProxy<MT>::operator*=( const T& value ) const
+{
+   if( mode_ == diagonal && !isReal( value ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to diagonal matrix element" );
+   }
+
+   if( mode_ == conjugated )
+      *value_ *= conj( value );
+   else if( mode_ != restricted )
+      *value_ *= value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment to the accessed matrix element.
+//
+// \param value The right-hand side value for the division.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix element.
+//
+// In case the proxy represents a diagonal element of a Hermitian matrix and \a value is not a
+// real number, a \a std::invalid_argument exception is thrown. Dividing an element that is not
+// stored has no effect.
+*/
+template< typename MT >  // Type of the packed matrix
+template< typename T >   // Type of the right-hand side value
+inline const PackedProxy<MT>& PackedProxy<MT>::operator/=( const T& value ) const
+{
+   if( mode_ == diagonal && !isReal( value ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to diagonal matrix element" );
+   }
+
+   if( mode_ == conjugated )
+      *value_ /= conj( value );
+   else if( mode_ != restricted )
+      *value_ /= value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Direct access to the represented matrix element.
+//
+// \return Pointer to the represented matrix element.
+*/
+template< typename MT >  // Type of the packed matrix
+inline typename PackedProxy<MT>::Pointer PackedProxy<MT>::operator->() noexcept
+{
+   return this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the represented matrix element.
+//
+// \return Pointer to the represented matrix element.
+*/
+template< typename MT >  // Type of the packed matrix
+inline typename PackedProxy<MT>::ConstPointer PackedProxy<MT>::operator->() const noexcept
+{
+   return this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reset the represented element to its default initial value.
+//
+// \return void
+//
+// This function resets the element represented by the proxy to its default initial value.
+// Resetting an element that is not stored has no effect.
+*/
+template< typename MT >  // Type of the packed matrix
+inline void PackedProxy<MT>::reset() const
+{
+   using blaze::reset;
+
+   if( mode_ != restricted )
+      reset( *value_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the represented element.
+//
+// \return void
+//
+// This function clears the element represented by the proxy to its default initial state.
+// Clearing an element that is not stored has no effect.
+*/
+template< typename MT >  // Type of the packed matrix
+inline void PackedProxy<MT>::clear() const
+{
+   using blaze::clear;
+
+   if( mode_ != restricted )
+      clear( *value_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of the represented element
+//
+// \return void
+// \exception std::invalid_argument Invalid inversion of restricted matrix element.
+//
+// In case the proxy represents an element that is not stored, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT >  // Type of the packed matrix
+inline void PackedProxy<MT>::invert() const
+{
+   using blaze::invert;
+
+   if( mode_ == restricted ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid inversion of restricted matrix element" );
+   }
+
+   invert( *value_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returning the value of the accessed matrix element.
+//
+// \return Copy of the accessed matrix element.
+*/
+template< typename MT >  // Type of the packed matrix
+inline typename PackedProxy<MT>::RepresentedType PackedProxy<MT>::get() const
+{
+   if( mode_ == restricted )
+      return RepresentedType();
+   else if( mode_ == conjugated )
+      return conj( *value_ );
+   else
+      return *value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the proxy represents a restricted matrix element..
+//
+// \return \a true in case access to the matrix element is restricted, \a false if not.
+*/
+template< typename MT >  // Type of the packed matrix
+inline bool PackedProxy<MT>::isRestricted() const noexcept
+{
+   return mode_ == restricted;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether the given value can be assigned to the represented element.
+//
+// \param value The value to be checked.
+// \return void
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix element.
+*/
+template< typename MT >  // Type of the packed matrix
+template< typename T >   // Type of the value to be checked
+inline void PackedProxy<MT>::checkValue( const T& value ) const
+{
+   if( mode_ == restricted && !isDefault( value ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to restricted matrix element" );
+   }
+
+   if( mode_ == diagonal && !isReal( value ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to diagonal matrix element" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to the accessed matrix element.
+//
+// \return Copy of the accessed matrix element.
+*/
+template< typename MT >  // Type of the packed matrix
+inline PackedProxy<MT>::operator RepresentedType() const
+{
+   return get();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPLEX DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the real part of the represented complex number.
+//
+// \return The current real part of the represented complex number.
+//
+// In case the proxy represents a complex number, this function returns the current value of its
+// real part.
+*/
+template< typename MT >  // Type of the packed matrix
+inline typename PackedProxy<MT>::ValueType PackedProxy<MT>::real() const
+{
+   return get().real();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the real part of the represented complex number.
+//
+// \param value The new value for the real part.
+// \return void
+// \exception std::invalid_argument Invalid setting for restricted matrix element.
+//
+// In case the proxy represents a complex number, this function sets a new value to its real part.
+// In case the proxy represents an element that is not stored and \a value is not 0, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the packed matrix
+inline void PackedProxy<MT>::real( ValueType value ) const
+{
+   if( mode_ == restricted ) {
+      if( !isDefault( value ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid setting for restricted matrix element" );
+      }
+      return;
+   }
+
+   value_->real( value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the imaginary part of the represented complex number.
+//
+// \return The current imaginary part of the represented complex number.
+//
+// In case the proxy represents a complex number, this function returns the current value of its
+// imaginary part.
+*/
+template< typename MT >  // Type of the packed matrix
+inline typename PackedProxy<MT>::ValueType PackedProxy<MT>::imag() const
+{
+   return get().imag();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the imaginary part of the represented complex number.
+//
+// \param value The new value for the imaginary part.
+// \return void
+// \exception std::invalid_argument Invalid setting for restricted matrix element.
+// \exception std::invalid_argument Invalid setting for diagonal matrix element.
+//
+// In case the proxy represents a complex number, this function sets a new value to its imaginary
+// part. In case the proxy represents an element that is not stored or a diagonal element of a
+// Hermitian matrix and \a value is not 0, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the packed matrix
+inline void PackedProxy<MT>::imag( ValueType value ) const
+{
+   if( mode_ == restricted || mode_ == diagonal ) {
+      if( !isDefault( value ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( mode_ == diagonal
+                                       ? "Invalid setting for diagonal matrix element"
+                                       : "Invalid setting for restricted matrix element" );
+      }
+      if( mode_ == restricted )
+         return;
+   }
+
+   value_->imag( mode_ == conjugated ? -value : value );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedProxy global functions */
+//@{
+template< typename MT >
+inline void reset( const PackedProxy<MT>& proxy );
+
+template< typename MT >
+inline void clear( const PackedProxy<MT>& proxy );
+
+template< typename MT >
+inline void invert( const PackedProxy<MT>& proxy );
+
+template< typename MT >
+inline bool isDefault( const PackedProxy<MT>& proxy );
+
+template< typename MT >
+inline bool isReal( const PackedProxy<MT>& proxy );
+
+template< typename MT >
+inline bool isZero( const PackedProxy<MT>& proxy );
+
+template< typename MT >
+inline bool isOne( const PackedProxy<MT>& proxy );
+
+template< typename MT >
+inline bool isnan( const PackedProxy<MT>& proxy );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the represented element to the default initial values.
+// \ingroup packed_matrix
+//
+// \param proxy The given access proxy.
+// \return void
+//
+// This function resets the element represented by the packed proxy to its default initial
+// value.
+*/
+template< typename MT >
+inline void reset( const PackedProxy<MT>& proxy )
+{
+   proxy.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the represented element.
+// \ingroup packed_matrix
+//
+// \param proxy The given access proxy.
+// \return void
+//
+// This function clears the element represented by the packed proxy to its default initial
+// state.
+*/
+template< typename MT >
+inline void clear( const PackedProxy<MT>& proxy )
+{
+   proxy.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of the represented element.
+// \ingroup packed_matrix
+//
+// \param proxy The given proxy instance.
+// \return void
+// \exception std::invalid_argument Invalid inversion of restricted matrix element.
+*/
+template< typename MT >
+inline void invert( const PackedProxy<MT>& proxy )
+{
+   proxy.invert();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is in default state.
+// \ingroup packed_matrix
+//
+// \param proxy The given access proxy
+// \return \a true in case the represented element is in default state, \a false otherwise.
+//
+// This function checks whether the element represented by the access proxy is in default state.
+// In case it is in default state, the function returns \a true, otherwise it returns \a false.
+*/
+template< typename MT >
+inline bool isDefault( const PackedProxy<MT>& proxy )
+{
+   using blaze::isDefault;
+
+   return isDefault( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix element represents a real number.
+// \ingroup packed_matrix
+//
+// \param proxy The given access proxy.
+// \return \a true in case the matrix element represents a real number, \a false otherwise.
+//
+// This function checks whether the element represented by the access proxy represents the a
+// real number. In case the element is of built-in type, the function returns \a true. In case
+// the element is of complex type, the function returns \a true if the imaginary part is equal
+// to 0. Otherwise it returns \a false.
+*/
+template< typename MT >
+inline bool isReal( const PackedProxy<MT>& proxy )
+{
+   using blaze::isReal;
+
+   return isReal( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is 0.
+// \ingroup packed_matrix
+//
+// \param proxy The given access proxy.
+// \return \a true in case the represented element is 0, \a false otherwise.
+//
+// This function checks whether the element represented by the access proxy represents the numeric
+// value 0. In case it is 0, the function returns \a true, otherwise it returns \a false.
+*/
+template< typename MT >
+inline bool isZero( const PackedProxy<MT>& proxy )
+{
+   using blaze::isZero;
+
+   return isZero( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is 1.
+// \ingroup packed_matrix
+//
+// \param proxy The given access proxy.
+// \return \a true in case the represented element is 1, \a false otherwise.
+//
+// This function checks whether the element represented by the access proxy represents the numeric
+// value 1. In case it is 1, the function returns \a true, otherwise it returns \a false.
+*/
+template< typename MT >
+inline bool isOne( const PackedProxy<MT>& proxy )
+{
+   using blaze::isOne;
+
+   return isOne( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is not a number.
+// \ingroup packed_matrix
+//
+// \param proxy The given access proxy.
+// \return \a true in case the represented element is in not a number, \a false otherwise.
+//
+// This function checks whether the element represented by the access proxy is not a number (NaN).
+// In case it is not a number, the function returns \a true, otherwise it returns \a false.
+*/
+template< typename MT >
+inline bool isnan( const PackedProxy<MT>& proxy )
+{
+   using blaze::isnan;
+
+   return isnan( proxy.get() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
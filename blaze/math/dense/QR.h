@@ -49,16 +49,19 @@
 #include <blaze/math/constraints/StrictlyTriangular.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/UniTriangular.h>
+#include <blaze/math/dense/Factorization.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/lapack/geqrf.h>
 #include <blaze/math/lapack/orgqr.h>
 #include <blaze/math/lapack/ungqr.h>
+#include <blaze/math/shims/Reset.h>
 #include <blaze/math/traits/DerestrictTrait.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSquare.h>
 #include <blaze/math/views/Submatrix.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/EnableIf.h>
 
 
@@ -95,7 +98,11 @@ template< typename MT1 >  // Type of matrix A
 inline EnableIf_<IsBuiltin< ElementType_<MT1> > >
    qr_backend( MT1& A, const ElementType_<MT1>* tau )
 {
+#if BLAZE_BLAS_MODE
    orgqr( A, tau );
+#else
+   blockedOrgqr( A, tau );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -117,7 +124,11 @@ template< typename MT1 >  // Type of matrix A
 inline EnableIf_<IsComplex< ElementType_<MT1> > >
    qr_backend( MT1& A, const ElementType_<MT1>* tau )
 {
+#if BLAZE_BLAS_MODE
    ungqr( A, tau );
+#else
+   blockedOrgqr( A, tau );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -212,7 +223,11 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
    if( m < n )
    {
       r = A;
+#if BLAZE_BLAS_MODE
       geqrf( r, tau.get() );
+#else
+      blockedGeqrf( r, tau.get() );
+#endif
       (~Q) = submatrix( r, 0UL, 0UL, m, m );
       qr_backend( ~Q, tau.get() );
 
@@ -225,7 +240,11 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
    else
    {
       (~Q) = A;
+#if BLAZE_BLAS_MODE
       geqrf( ~Q, tau.get() );
+#else
+      blockedGeqrf( ~Q, tau.get() );
+#endif
 
       resize( ~R, n, n );
       reset( r );
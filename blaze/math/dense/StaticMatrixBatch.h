@@ -0,0 +1,1750 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/StaticMatrixBatch.h
+//  \brief Header file for the implementation of a batch of fixed-size matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_STATICMATRIXBATCH_H_
+#define _BLAZE_MATH_DENSE_STATICMATRIXBATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <blaze/math/dense/BatchPack.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/Inversion.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/dense/StaticVectorBatch.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DMatDetExpr.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/smp/Batch.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Efficient implementation of a batch of fixed-size matrices.
+// \ingroup dense_matrix
+//
+// The StaticMatrixBatch class template represents an arbitrary number of row-major matrices of
+// the same, fixed size. The type of the elements and the number of rows and columns of the
+// matrices can be specified via the three template parameters:
+
+   \code
+   template< typename Type, size_t M, size_t N >
+   class StaticMatrixBatch;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. StaticMatrixBatch can only be used with
+//          floating point types. For \c float and \c double the elements of several
+//          matrices are processed at once via SIMD operations.
+//  - M   : specifies the number of rows of each matrix.
+//  - N   : specifies the number of columns of each matrix.
+//
+// In contrast to a plain array of StaticMatrix instances, the matrices of a StaticMatrixBatch
+// are stored interleaved: The elements \f$ (i,j) \f$ of a group of consecutive matrices (a so
+// called chunk) are stored contiguously, such that a single SIMD register holds the element
+// \f$ (i,j) \f$ of several matrices at once, i.e. lane \a k of the register belongs to the
+// \a k-th matrix of the chunk. Thus the batched kernels (multiplication, determinant,
+// inversion, and Cholesky decomposition) process as many matrices at once as there are SIMD
+// lanes, without any horizontal operation or shuffle, and execute exactly the same formulas as
+// the according kernels for a single StaticMatrix. Batches with at least
+// blaze::SMP_BATCH_THRESHOLD matrices are additionally processed in parallel.
+
+   \code
+   using blaze::StaticMatrix;
+   using blaze::StaticMatrixBatch;
+   using blaze::StaticVectorBatch;
+
+   StaticMatrixBatch<double,3UL,3UL> A( 100000UL ), B( 100000UL ), C;
+   StaticVectorBatch<double,3UL> x( 100000UL ), y;
+
+   A(0UL,1UL,2UL) = 2.0;                             // Setting the element (1,2) of matrix 0
+   A.set( 1UL, StaticMatrix<double,3UL,3UL>{ { 2.0, 0.0, 0.0 },
+                                             { 0.0, 3.0, 0.0 },
+                                             { 0.0, 0.0, 4.0 } } );
+   StaticMatrix<double,3UL,3UL> A1( A.get( 1UL ) );  // Extracting matrix 1
+
+   C = A * B;          // Batched matrix multiplication
+   y = A * x;          // Batched matrix/vector multiplication
+   invert( A );        // Batched in-place inversion
+   llh( B, C );        // Batched Cholesky decomposition
+   blaze::DynamicVector<double> d( det( A ) );  // Batched determinant computation
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+class StaticMatrixBatch
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef StaticMatrixBatch<Type,M,N>      This;            //!< Type of this StaticMatrixBatch instance.
+   typedef Type                             ElementType;     //!< Type of the matrix elements.
+   typedef StaticMatrix<Type,M,N,rowMajor>  MatrixType;      //!< Type of a single matrix of the batch.
+   typedef Type&                            Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type&                      ConstReference;  //!< Reference to a constant matrix value.
+   typedef Type*                            Pointer;         //!< Pointer to a non-constant matrix value.
+   typedef const Type*                      ConstPointer;    //!< Pointer to a constant matrix value.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! The number of matrices stored interleaved within a single chunk.
+   enum : size_t { lanes = BatchPack<Type>::size };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline StaticMatrixBatch() noexcept;
+   explicit inline StaticMatrixBatch( size_t n );
+
+   inline StaticMatrixBatch( const StaticMatrixBatch& b );
+   inline StaticMatrixBatch( StaticMatrixBatch&& b ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~StaticMatrixBatch();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t k, size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t k, size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t k, size_t i, size_t j );
+   inline ConstReference at( size_t k, size_t i, size_t j ) const;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Pointer        data  ( size_t c ) noexcept;
+   inline ConstPointer   data  ( size_t c ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline StaticMatrixBatch& operator=( const StaticMatrixBatch& rhs );
+   inline StaticMatrixBatch& operator=( StaticMatrixBatch&& rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t           size() const noexcept;
+   inline size_t           chunks() const noexcept;
+   inline const MatrixType get( size_t k ) const;
+   inline void             set( size_t k, const MatrixType& A );
+   inline void             reset();
+   inline void             clear();
+   inline void             resize( size_t n, bool preserve=true );
+   inline void             swap( StaticMatrixBatch& b ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;             //!< The current number of matrices in the batch.
+   size_t capacity_;         //!< The maximum number of chunks of the batch.
+   Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated, interleaved matrix elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   BLAZE_STATIC_ASSERT( M > 0UL && N > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for StaticMatrixBatch.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline StaticMatrixBatch<Type,M,N>::StaticMatrixBatch() noexcept
+   : size_    ( 0UL )      // The current number of matrices in the batch
+   , capacity_( 0UL )      // The maximum number of chunks of the batch
+   , v_       ( nullptr )  // The interleaved matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of \a n matrices.
+//
+// \param n The number of matrices of the batch.
+//
+// All elements of all matrices are initialized to 0.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline StaticMatrixBatch<Type,M,N>::StaticMatrixBatch( size_t n )
+   : size_    ( n )                                    // The current number of matrices in the batch
+   , capacity_( ( n + lanes - 1UL ) / lanes )          // The maximum number of chunks of the batch
+   , v_       ( allocate<Type>( capacity_*M*N*lanes ) )  // The interleaved matrix elements
+{
+   std::fill( v_, v_+capacity_*M*N*lanes, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for StaticMatrixBatch.
+//
+// \param b Batch to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline StaticMatrixBatch<Type,M,N>::StaticMatrixBatch( const StaticMatrixBatch& b )
+   : StaticMatrixBatch( b.size_ )
+{
+   std::copy( b.v_, b.v_+b.chunks()*M*N*lanes, v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for StaticMatrixBatch.
+//
+// \param b The batch to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline StaticMatrixBatch<Type,M,N>::StaticMatrixBatch( StaticMatrixBatch&& b ) noexcept
+   : size_    ( b.size_     )  // The current number of matrices in the batch
+   , capacity_( b.capacity_ )  // The maximum number of chunks of the batch
+   , v_       ( b.v_        )  // The interleaved matrix elements
+{
+   b.size_     = 0UL;
+   b.capacity_ = 0UL;
+   b.v_        = nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for StaticMatrixBatch.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline StaticMatrixBatch<Type,M,N>::~StaticMatrixBatch()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 3D-access to the matrix elements.
+//
+// \param k Index of the accessed matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename StaticMatrixBatch<Type,M,N>::Reference
+   StaticMatrixBatch<Type,M,N>::operator()( size_t k, size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid matrix access index" );
+   BLAZE_USER_ASSERT( i < M    , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < N    , "Invalid column access index" );
+   return v_[( (k/lanes)*M*N + i*N + j )*lanes + k%lanes];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 3D-access to the matrix elements.
+//
+// \param k Index of the accessed matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference-to-const to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename StaticMatrixBatch<Type,M,N>::ConstReference
+   StaticMatrixBatch<Type,M,N>::operator()( size_t k, size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid matrix access index" );
+   BLAZE_USER_ASSERT( i < M    , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < N    , "Invalid column access index" );
+   return v_[( (k/lanes)*M*N + i*N + j )*lanes + k%lanes];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param k Index of the accessed matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename StaticMatrixBatch<Type,M,N>::Reference
+   StaticMatrixBatch<Type,M,N>::at( size_t k, size_t i, size_t j )
+{
+   if( k >= size_ || i >= M || j >= N ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid matrix access index" );
+   }
+   return (*this)(k,i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param k Index of the accessed matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference-to-const to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename StaticMatrixBatch<Type,M,N>::ConstReference
+   StaticMatrixBatch<Type,M,N>::at( size_t k, size_t i, size_t j ) const
+{
+   if( k >= size_ || i >= M || j >= N ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid matrix access index" );
+   }
+   return (*this)(k,i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved matrix elements.
+//
+// \return Pointer to the internal element storage.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename StaticMatrixBatch<Type,M,N>::Pointer StaticMatrixBatch<Type,M,N>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved matrix elements.
+//
+// \return Pointer to the internal element storage.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename StaticMatrixBatch<Type,M,N>::ConstPointer
+   StaticMatrixBatch<Type,M,N>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved elements of the given chunk.
+//
+// \param c The index of the chunk.
+// \return Pointer to the first element of the given chunk.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename StaticMatrixBatch<Type,M,N>::Pointer
+   StaticMatrixBatch<Type,M,N>::data( size_t c ) noexcept
+{
+   BLAZE_USER_ASSERT( c < chunks(), "Invalid chunk access index" );
+   return v_ + c*M*N*lanes;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved elements of the given chunk.
+//
+// \param c The index of the chunk.
+// \return Pointer to the first element of the given chunk.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename StaticMatrixBatch<Type,M,N>::ConstPointer
+   StaticMatrixBatch<Type,M,N>::data( size_t c ) const noexcept
+{
+   BLAZE_USER_ASSERT( c < chunks(), "Invalid chunk access index" );
+   return v_ + c*M*N*lanes;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for StaticMatrixBatch.
+//
+// \param rhs Batch to be copied.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline StaticMatrixBatch<Type,M,N>& StaticMatrixBatch<Type,M,N>::operator=( const StaticMatrixBatch& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.size_, false );
+   std::copy( rhs.v_, rhs.v_+rhs.chunks()*M*N*lanes, v_ );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for StaticMatrixBatch.
+//
+// \param rhs The batch to be moved into this instance.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline StaticMatrixBatch<Type,M,N>& StaticMatrixBatch<Type,M,N>::operator=( StaticMatrixBatch&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   size_     = rhs.size_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.size_     = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of matrices of the batch.
+//
+// \return The number of matrices of the batch.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline size_t StaticMatrixBatch<Type,M,N>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of chunks of the batch.
+//
+// \return The number of chunks of the batch.
+//
+// Each chunk contains as many interleaved matrices as there are SIMD lanes for the element type
+// of the batch. The last chunk may be partially filled.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline size_t StaticMatrixBatch<Type,M,N>::chunks() const noexcept
+{
+   return ( size_ + lanes - 1UL ) / lanes;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of the matrix with the given index.
+//
+// \param k Index of the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \return Copy of the matrix with the given index.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline const typename StaticMatrixBatch<Type,M,N>::MatrixType
+   StaticMatrixBatch<Type,M,N>::get( size_t k ) const
+{
+   if( k >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid matrix access index" );
+   }
+
+   MatrixType A;
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         A(i,j) = (*this)(k,i,j);
+      }
+   }
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the matrix with the given index.
+//
+// \param k Index of the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param A The new value of the matrix.
+// \return void
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void StaticMatrixBatch<Type,M,N>::set( size_t k, const MatrixType& A )
+{
+   if( k >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid matrix access index" );
+   }
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         (*this)(k,i,j) = A(i,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all elements of all matrices to 0. The size of the batch is preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void StaticMatrixBatch<Type,M,N>::reset()
+{
+   std::fill( v_, v_+chunks()*M*N*lanes, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the batch.
+//
+// \return void
+//
+// After the clear() function, the size of the batch is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void StaticMatrixBatch<Type,M,N>::clear()
+{
+   size_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the number of matrices of the batch.
+//
+// \param n The new number of matrices of the batch.
+// \param preserve \a true if the old values of the batch should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the batch using the given number of matrices. During this operation,
+// new dynamic memory may be allocated in case the capacity of the batch is too small. Note
+// that this function may invalidate all existing references and pointers to the elements of
+// the batch! Newly added matrices are NOT initialized!
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void StaticMatrixBatch<Type,M,N>::resize( size_t n, bool preserve )
+{
+   const size_t newChunks( ( n + lanes - 1UL ) / lanes );
+
+   if( newChunks > capacity_ )
+   {
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( newChunks*M*N*lanes );
+
+      if( preserve ) {
+         std::copy( v_, v_+chunks()*M*N*lanes, tmp );
+         std::fill( tmp+chunks()*M*N*lanes, tmp+newChunks*M*N*lanes, Type() );
+      }
+      else {
+         std::fill( tmp, tmp+newChunks*M*N*lanes, Type() );
+      }
+
+      std::swap( v_, tmp );
+      deallocate( tmp );
+      capacity_ = newChunks;
+   }
+
+   size_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+//
+// \param b The batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void StaticMatrixBatch<Type,M,N>::swap( StaticMatrixBatch& b ) noexcept
+{
+   using std::swap;
+
+   swap( size_, b.size_ );
+   swap( capacity_, b.capacity_ );
+   swap( v_, b.v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the batch can be used in SMP assignments.
+//
+// \return \a true in case the batch can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the batched kernels operating on the batch can be executed in
+// parallel. This is the case if the number of matrices of the batch is larger or equal to the
+// blaze::SMP_BATCH_THRESHOLD.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline bool StaticMatrixBatch<Type,M,N>::canSMPAssign() const noexcept
+{
+   return ( size_ >= SMP_BATCH_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STATICMATRIXBATCH OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name StaticMatrixBatch operators */
+//@{
+template< typename Type, size_t M, size_t N >
+inline void reset( StaticMatrixBatch<Type,M,N>& b );
+
+template< typename Type, size_t M, size_t N >
+inline void clear( StaticMatrixBatch<Type,M,N>& b );
+
+template< typename Type, size_t M, size_t N >
+inline void swap( StaticMatrixBatch<Type,M,N>& a, StaticMatrixBatch<Type,M,N>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given batch of matrices.
+// \ingroup dense_matrix
+//
+// \param b The batch to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void reset( StaticMatrixBatch<Type,M,N>& b )
+{
+   b.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given batch of matrices.
+// \ingroup dense_matrix
+//
+// \param b The batch to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void clear( StaticMatrixBatch<Type,M,N>& b )
+{
+   b.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches of matrices.
+// \ingroup dense_matrix
+//
+// \param a The first batch to be swapped.
+// \param b The second batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void swap( StaticMatrixBatch<Type,M,N>& a, StaticMatrixBatch<Type,M,N>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCH KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Register block of a single chunk of a batch of small matrices.
+// \ingroup dense_matrix
+//
+// The BatchBlock class template holds the \f$ M \times N \f$ packed elements of a single chunk
+// of a StaticMatrixBatch or StaticVectorBatch. Since it provides the same function call operator
+// as a matrix, the closed form formulas of the small matrix determinant and inversion kernels
+// can be applied to it without modification.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows of the block
+        , size_t N >     // Number of columns of the block
+struct BatchBlock
+{
+   //**********************************************************************************************
+   //! The number of matrices per chunk.
+   enum : size_t { lanes = BatchPack<Type>::size };
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\brief 2D-access to the packed elements of the block.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return Reference to the accessed pack.
+   */
+   BLAZE_ALWAYS_INLINE BatchPack<Type>& operator()( size_t i, size_t j ) noexcept
+   {
+      BLAZE_INTERNAL_ASSERT( i < M, "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < N, "Invalid column access index" );
+      return v_[i*N+j];
+   }
+
+   /*!\brief 2D-access to the packed elements of the block.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return Reference-to-const to the accessed pack.
+   */
+   BLAZE_ALWAYS_INLINE const BatchPack<Type>& operator()( size_t i, size_t j ) const noexcept
+   {
+      BLAZE_INTERNAL_ASSERT( i < M, "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < N, "Invalid column access index" );
+      return v_[i*N+j];
+   }
+   //**********************************************************************************************
+
+   //**Load and store functions********************************************************************
+   /*!\brief Loading the block from the given chunk.
+   //
+   // \param address The first element of the chunk.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void load( const Type* address ) noexcept
+   {
+      for( size_t i=0UL; i<M*N; ++i ) {
+         v_[i] = BatchPack<Type>::load( address + i*lanes );
+      }
+   }
+
+   /*!\brief Storing the block to the given chunk.
+   //
+   // \param address The first element of the chunk.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void store( Type* address ) const noexcept
+   {
+      for( size_t i=0UL; i<M*N; ++i ) {
+         BatchPack<Type>::store( address + i*lanes, v_[i] );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   BatchPack<Type> v_[M*N];  //!< The packed elements of the block.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the packed pivots of a chunk of matrices.
+// \ingroup dense_matrix
+//
+// \param pivot The packed pivots of the chunk.
+// \param first The index of the first matrix of the chunk.
+// \param size The total number of matrices of the batch.
+// \param check The check to be applied to each pivot.
+// \return \a true in case all pivots pass the check, \a false if not.
+//
+// This function applies the given check to the pivots of all matrices of the chunk. The pivots
+// of the padding lanes beyond the last matrix of the batch are set to 1 in order to avoid any
+// floating point exception in the following computations.
+*/
+template< typename Type    // Data type of the elements
+        , typename Check >  // Type of the pivot check
+inline bool checkBatchPivots( BatchPack<Type>& pivot, size_t first, size_t size, Check check )
+{
+   enum : size_t { lanes = BatchPack<Type>::size };
+
+   AlignedArray<Type,lanes> tmp;
+   BatchPack<Type>::store( tmp.data(), pivot );
+
+   bool valid( true );
+
+   for( size_t l=0UL; l<lanes; ++l ) {
+      if( first+l >= size )
+         tmp[l] = Type(1);
+      else if( !check( tmp[l] ) )
+         valid = false;
+   }
+
+   pivot = BatchPack<Type>::load( tmp.data() );
+
+   return valid;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pivot check for the batched inversion.
+// \ingroup dense_matrix
+*/
+struct BatchDivisorCheck
+{
+   template< typename Type >
+   inline bool operator()( const Type& pivot ) const { return isDivisor( pivot ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pivot check for the batched Cholesky decomposition.
+// \ingroup dense_matrix
+*/
+struct BatchPositiveCheck
+{
+   template< typename Type >
+   inline bool operator()( const Type& pivot ) const { return pivot > Type(0); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\name Batched determinant and inversion backends */
+//@{
+template< typename Type >
+BLAZE_ALWAYS_INLINE const BatchPack<Type> detBatch_backend( const BatchBlock<Type,2UL,2UL>& A )
+{
+   return det2x2_backend< BatchPack<Type> >( A );
+}
+
+template< typename Type >
+BLAZE_ALWAYS_INLINE const BatchPack<Type> detBatch_backend( const BatchBlock<Type,3UL,3UL>& A )
+{
+   return det3x3_backend< BatchPack<Type> >( A );
+}
+
+template< typename Type >
+BLAZE_ALWAYS_INLINE const BatchPack<Type> detBatch_backend( const BatchBlock<Type,4UL,4UL>& A )
+{
+   return det4x4_backend< BatchPack<Type> >( A );
+}
+
+template< typename Type >
+BLAZE_ALWAYS_INLINE const BatchPack<Type> detBatch_backend( const BatchBlock<Type,5UL,5UL>& A )
+{
+   return det5x5_backend< BatchPack<Type> >( A );
+}
+
+template< typename Type >
+BLAZE_ALWAYS_INLINE const BatchPack<Type> detBatch_backend( const BatchBlock<Type,6UL,6UL>& A )
+{
+   return det6x6_backend< BatchPack<Type> >( A );
+}
+
+template< typename Type >
+BLAZE_ALWAYS_INLINE const BatchPack<Type>
+   invertBatch_backend( const BatchBlock<Type,2UL,2UL>& A, BatchBlock<Type,2UL,2UL>& B )
+{
+   return invertGeneral2x2_backend< BatchPack<Type> >( A, B );
+}
+
+template< typename Type >
+BLAZE_ALWAYS_INLINE const BatchPack<Type>
+   invertBatch_backend( const BatchBlock<Type,3UL,3UL>& A, BatchBlock<Type,3UL,3UL>& B )
+{
+   return invertGeneral3x3_backend< BatchPack<Type> >( A, B );
+}
+
+template< typename Type >
+BLAZE_ALWAYS_INLINE const BatchPack<Type>
+   invertBatch_backend( const BatchBlock<Type,4UL,4UL>& A, BatchBlock<Type,4UL,4UL>& B )
+{
+   return invertGeneral4x4_backend< BatchPack<Type> >( A, B );
+}
+
+template< typename Type >
+BLAZE_ALWAYS_INLINE const BatchPack<Type>
+   invertBatch_backend( const BatchBlock<Type,5UL,5UL>& A, BatchBlock<Type,5UL,5UL>& B )
+{
+   return invertGeneral5x5_backend< BatchPack<Type> >( A, B );
+}
+
+template< typename Type >
+BLAZE_ALWAYS_INLINE const BatchPack<Type>
+   invertBatch_backend( const BatchBlock<Type,6UL,6UL>& A, BatchBlock<Type,6UL,6UL>& B )
+{
+   return invertGeneral6x6_backend< BatchPack<Type> >( A, B );
+}
+//@}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the batched multiplication of two batches of matrices.
+// \ingroup dense_matrix
+//
+// The BatchMultKernel class template computes \f$ C_k = A_k B_k \f$ for all matrices of the
+// given range of chunks. The result batch must not alias any of the operands.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N >     // Number of columns of the right-hand side matrices
+struct BatchMultKernel
+{
+   //**********************************************************************************************
+   enum : size_t { lanes = BatchPack<Type>::size };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BatchMultKernel class template.
+   //
+   // \param C The elements of the result batch.
+   // \param A The elements of the left-hand side batch.
+   // \param B The elements of the right-hand side batch.
+   */
+   explicit inline BatchMultKernel( Type* C, const Type* A, const Type* B ) noexcept
+      : C_( C )  // The elements of the result batch
+      , A_( A )  // The elements of the left-hand side batch
+      , B_( B )  // The elements of the right-hand side batch
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the multiplication for the given range of chunks.
+   //
+   // \param begin The index of the first chunk.
+   // \param end The index one past the last chunk.
+   // \return void
+   */
+   inline void operator()( size_t begin, size_t end ) const noexcept
+   {
+      for( size_t c=begin; c<end; ++c )
+      {
+         const Type* a( A_ + c*M*K*lanes );
+         const Type* b( B_ + c*K*N*lanes );
+         Type*       r( C_ + c*M*N*lanes );
+
+         BatchBlock<Type,K,N> rhs;
+         rhs.load( b );
+
+         for( size_t i=0UL; i<M; ++i ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               BatchPack<Type> sum;
+               for( size_t k=0UL; k<K; ++k ) {
+                  sum += BatchPack<Type>::load( a + (i*K+k)*lanes ) * rhs(k,j);
+               }
+               BatchPack<Type>::store( r + (i*N+j)*lanes, sum );
+            }
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Type*       C_;  //!< The elements of the result batch.
+   const Type* A_;  //!< The elements of the left-hand side batch.
+   const Type* B_;  //!< The elements of the right-hand side batch.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the batched multiplication of a batch of matrices and a batch of vectors.
+// \ingroup dense_matrix
+//
+// The BatchMatVecKernel class template computes \f$ y_k = A_k x_k \f$ for all matrices and
+// vectors of the given range of chunks. The result batch must not alias the vector operand.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows of the matrices
+        , size_t N >     // Number of columns of the matrices
+struct BatchMatVecKernel
+{
+   //**********************************************************************************************
+   enum : size_t { lanes = BatchPack<Type>::size };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BatchMatVecKernel class template.
+   //
+   // \param y The elements of the result batch.
+   // \param A The elements of the matrix batch.
+   // \param x The elements of the vector batch.
+   */
+   explicit inline BatchMatVecKernel( Type* y, const Type* A, const Type* x ) noexcept
+      : y_( y )  // The elements of the result batch
+      , A_( A )  // The elements of the matrix batch
+      , x_( x )  // The elements of the vector batch
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the multiplication for the given range of chunks.
+   //
+   // \param begin The index of the first chunk.
+   // \param end The index one past the last chunk.
+   // \return void
+   */
+   inline void operator()( size_t begin, size_t end ) const noexcept
+   {
+      for( size_t c=begin; c<end; ++c )
+      {
+         const Type* a( A_ + c*M*N*lanes );
+         Type*       r( y_ + c*M*lanes );
+
+         BatchBlock<Type,N,1UL> x;
+         x.load( x_ + c*N*lanes );
+
+         for( size_t i=0UL; i<M; ++i ) {
+            BatchPack<Type> sum;
+            for( size_t j=0UL; j<N; ++j ) {
+               sum += BatchPack<Type>::load( a + (i*N+j)*lanes ) * x(j,0UL);
+            }
+            BatchPack<Type>::store( r + i*lanes, sum );
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Type*       y_;  //!< The elements of the result batch.
+   const Type* A_;  //!< The elements of the matrix batch.
+   const Type* x_;  //!< The elements of the vector batch.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the batched computation of the determinants of a batch of matrices.
+// \ingroup dense_matrix
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of rows and columns of the matrices
+struct BatchDetKernel
+{
+   //**********************************************************************************************
+   enum : size_t { lanes = BatchPack<Type>::size };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BatchDetKernel class template.
+   //
+   // \param d The target array for the determinants.
+   // \param A The elements of the matrix batch.
+   // \param size The number of matrices of the batch.
+   */
+   explicit inline BatchDetKernel( Type* d, const Type* A, size_t size ) noexcept
+      : d_   ( d    )  // The target array for the determinants
+      , A_   ( A    )  // The elements of the matrix batch
+      , size_( size )  // The number of matrices of the batch
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the determinants for the given range of chunks.
+   //
+   // \param begin The index of the first chunk.
+   // \param end The index one past the last chunk.
+   // \return void
+   */
+   inline void operator()( size_t begin, size_t end ) const noexcept
+   {
+      AlignedArray<Type,lanes> tmp;
+
+      for( size_t c=begin; c<end; ++c )
+      {
+         BatchBlock<Type,N,N> A;
+         A.load( A_ + c*N*N*lanes );
+
+         BatchPack<Type>::store( tmp.data(), detBatch_backend( A ) );
+
+         for( size_t l=0UL; l<lanes && c*lanes+l<size_; ++l ) {
+            d_[c*lanes+l] = tmp[l];
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Type*       d_;     //!< The target array for the determinants.
+   const Type* A_;     //!< The elements of the matrix batch.
+   size_t      size_;  //!< The number of matrices of the batch.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the batched inversion of a batch of matrices.
+// \ingroup dense_matrix
+//
+// The BatchInvertKernel class template computes the inverses of all matrices of the given range
+// of chunks via the closed form formulas of the according small matrix inversion kernel. In
+// case any of the matrices is singular, the given failure flag is set.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of rows and columns of the matrices
+struct BatchInvertKernel
+{
+   //**********************************************************************************************
+   enum : size_t { lanes = BatchPack<Type>::size };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BatchInvertKernel class template.
+   //
+   // \param B The elements of the result batch.
+   // \param A The elements of the batch to be inverted.
+   // \param size The number of matrices of the batch.
+   // \param failed The failure flag.
+   */
+   explicit inline BatchInvertKernel( Type* B, const Type* A, size_t size,
+                                      std::atomic<bool>& failed ) noexcept
+      : B_     ( B      )  // The elements of the result batch
+      , A_     ( A      )  // The elements of the batch to be inverted
+      , size_  ( size   )  // The number of matrices of the batch
+      , failed_( failed )  // The failure flag
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the inversion for the given range of chunks.
+   //
+   // \param begin The index of the first chunk.
+   // \param end The index one past the last chunk.
+   // \return void
+   */
+   inline void operator()( size_t begin, size_t end ) const
+   {
+      for( size_t c=begin; c<end; ++c )
+      {
+         BatchBlock<Type,N,N> A, B;
+         A.load( A_ + c*N*N*lanes );
+
+         BatchPack<Type> det( invertBatch_backend( A, B ) );
+
+         if( !checkBatchPivots( det, c*lanes, size_, BatchDivisorCheck() ) )
+            failed_ = true;
+
+         for( size_t i=0UL; i<N; ++i ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               B(i,j) /= det;
+            }
+         }
+
+         B.store( B_ + c*N*N*lanes );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Type*              B_;       //!< The elements of the result batch.
+   const Type*        A_;       //!< The elements of the batch to be inverted.
+   size_t             size_;    //!< The number of matrices of the batch.
+   std::atomic<bool>& failed_;  //!< The failure flag.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the batched Cholesky decomposition of a batch of matrices.
+// \ingroup dense_matrix
+//
+// The BatchLLHKernel class template computes the lower Cholesky factors of all matrices of the
+// given range of chunks. Only the lower part of the given matrices is accessed. In case any of
+// the matrices is not positive definite, the given failure flag is set.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of rows and columns of the matrices
+struct BatchLLHKernel
+{
+   //**********************************************************************************************
+   enum : size_t { lanes = BatchPack<Type>::size };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BatchLLHKernel class template.
+   //
+   // \param L The elements of the result batch.
+   // \param A The elements of the batch to be decomposed.
+   // \param size The number of matrices of the batch.
+   // \param failed The failure flag.
+   */
+   explicit inline BatchLLHKernel( Type* L, const Type* A, size_t size,
+                                   std::atomic<bool>& failed ) noexcept
+      : L_     ( L      )  // The elements of the result batch
+      , A_     ( A      )  // The elements of the batch to be decomposed
+      , size_  ( size   )  // The number of matrices of the batch
+      , failed_( failed )  // The failure flag
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the decomposition for the given range of chunks.
+   //
+   // \param begin The index of the first chunk.
+   // \param end The index one past the last chunk.
+   // \return void
+   */
+   inline void operator()( size_t begin, size_t end ) const
+   {
+      for( size_t c=begin; c<end; ++c )
+      {
+         BatchBlock<Type,N,N> A, L;
+         A.load( A_ + c*N*N*lanes );
+
+         for( size_t j=0UL; j<N; ++j )
+         {
+            BatchPack<Type> diag( A(j,j) );
+            for( size_t k=0UL; k<j; ++k ) {
+               diag -= L(j,k) * L(j,k);
+            }
+
+            if( !checkBatchPivots( diag, c*lanes, size_, BatchPositiveCheck() ) )
+               failed_ = true;
+
+            L(j,j) = sqrt( diag );
+
+            for( size_t i=j+1UL; i<N; ++i ) {
+               BatchPack<Type> tmp( A(i,j) );
+               for( size_t k=0UL; k<j; ++k ) {
+                  tmp -= L(i,k) * L(j,k);
+               }
+               L(i,j) = tmp / L(j,j);
+            }
+         }
+
+         L.store( L_ + c*N*N*lanes );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Type*              L_;       //!< The elements of the result batch.
+   const Type*        A_;       //!< The elements of the batch to be decomposed.
+   size_t             size_;    //!< The number of matrices of the batch.
+   std::atomic<bool>& failed_;  //!< The failure flag.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name StaticMatrixBatch arithmetic operators */
+//@{
+template< typename Type, size_t M, size_t K, size_t N >
+inline void multiply( StaticMatrixBatch<Type,M,N>& C, const StaticMatrixBatch<Type,M,K>& A,
+                      const StaticMatrixBatch<Type,K,N>& B );
+
+template< typename Type, size_t M, size_t N >
+inline void multiply( StaticVectorBatch<Type,M>& y, const StaticMatrixBatch<Type,M,N>& A,
+                      const StaticVectorBatch<Type,N>& x );
+
+template< typename Type, size_t M, size_t K, size_t N >
+inline StaticMatrixBatch<Type,M,N>
+   operator*( const StaticMatrixBatch<Type,M,K>& A, const StaticMatrixBatch<Type,K,N>& B );
+
+template< typename Type, size_t M, size_t N >
+inline StaticVectorBatch<Type,M>
+   operator*( const StaticMatrixBatch<Type,M,N>& A, const StaticVectorBatch<Type,N>& x );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched multiplication of two batches of matrices (\f$ C_k=A_k*B_k \f$).
+// \ingroup dense_matrix
+//
+// \param C The resulting batch of \f$ M \times N \f$ matrices.
+// \param A The left-hand side batch of \f$ M \times K \f$ matrices.
+// \param B The right-hand side batch of \f$ K \times N \f$ matrices.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This function multiplies the \a k-th matrix of \a A with the \a k-th matrix of \a B for
+// all matrices of the two batches and stores the result in the \a k-th matrix of \a C. The
+// result batch is resized to the size of the operand batches. In case the sizes of the two
+// operand batches don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N >     // Number of columns of the right-hand side matrices
+inline void multiply( StaticMatrixBatch<Type,M,N>& C, const StaticMatrixBatch<Type,M,K>& A,
+                      const StaticMatrixBatch<Type,K,N>& B )
+{
+   if( A.size() != B.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   if( static_cast<const void*>( &C ) == static_cast<const void*>( &A ) ||
+       static_cast<const void*>( &C ) == static_cast<const void*>( &B ) ) {
+      StaticMatrixBatch<Type,M,N> tmp;
+      multiply( tmp, A, B );
+      C.swap( tmp );
+      return;
+   }
+
+   C.resize( A.size(), false );
+
+   smpBatch( C, BatchMultKernel<Type,M,K,N>( C.data(), A.data(), B.data() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched multiplication of a batch of matrices and a batch of vectors (\f$ y_k=A_k*x_k \f$).
+// \ingroup dense_matrix
+//
+// \param y The resulting batch of vectors with \a M elements.
+// \param A The batch of \f$ M \times N \f$ matrices.
+// \param x The batch of vectors with \a N elements.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This function multiplies the \a k-th matrix of \a A with the \a k-th vector of \a x for all
+// matrices and vectors of the two batches and stores the result in the \a k-th vector of \a y.
+// The result batch is resized to the size of the operand batches. In case the sizes of the two
+// operand batches don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows of the matrices
+        , size_t N >     // Number of columns of the matrices
+inline void multiply( StaticVectorBatch<Type,M>& y, const StaticMatrixBatch<Type,M,N>& A,
+                      const StaticVectorBatch<Type,N>& x )
+{
+   if( A.size() != x.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   if( static_cast<const void*>( &y ) == static_cast<const void*>( &x ) ) {
+      StaticVectorBatch<Type,M> tmp;
+      multiply( tmp, A, x );
+      y.swap( tmp );
+      return;
+   }
+
+   y.resize( A.size(), false );
+
+   smpBatch( y, BatchMatVecKernel<Type,M,N>( y.data(), A.data(), x.data() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the batched multiplication of two batches of matrices.
+// \ingroup dense_matrix
+//
+// \param A The left-hand side batch of \f$ M \times K \f$ matrices.
+// \param B The right-hand side batch of \f$ K \times N \f$ matrices.
+// \return The resulting batch of \f$ M \times N \f$ matrices.
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This operator returns the batch of the products of the according matrices of the two given
+// batches (see the multiply() function).
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N >     // Number of columns of the right-hand side matrices
+inline StaticMatrixBatch<Type,M,N>
+   operator*( const StaticMatrixBatch<Type,M,K>& A, const StaticMatrixBatch<Type,K,N>& B )
+{
+   StaticMatrixBatch<Type,M,N> C;
+   multiply( C, A, B );
+   return C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the batched multiplication of a batch of matrices and a
+//        batch of vectors.
+// \ingroup dense_matrix
+//
+// \param A The batch of \f$ M \times N \f$ matrices.
+// \param x The batch of vectors with \a N elements.
+// \return The resulting batch of vectors with \a M elements.
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This operator returns the batch of the products of the according matrices and vectors of the
+// two given batches (see the multiply() function).
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows of the matrices
+        , size_t N >     // Number of columns of the matrices
+inline StaticVectorBatch<Type,M>
+   operator*( const StaticMatrixBatch<Type,M,N>& A, const StaticVectorBatch<Type,N>& x )
+{
+   StaticVectorBatch<Type,M> y;
+   multiply( y, A, x );
+   return y;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name StaticMatrixBatch functions */
+//@{
+template< typename Type, size_t N >
+inline DynamicVector<Type> det( const StaticMatrixBatch<Type,N,N>& A );
+
+template< typename Type, size_t N >
+inline StaticMatrixBatch<Type,N,N> inv( const StaticMatrixBatch<Type,N,N>& A );
+
+template< typename Type, size_t N >
+inline void invert( StaticMatrixBatch<Type,N,N>& A );
+
+template< typename Type, size_t N >
+inline void llh( const StaticMatrixBatch<Type,N,N>& A, StaticMatrixBatch<Type,N,N>& L );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the determinants of all matrices of a batch.
+// \ingroup dense_matrix
+//
+// \param A The batch of square matrices.
+// \return The determinants of all matrices of the batch.
+//
+// This function computes the determinant of each matrix of the given batch. The \a k-th element
+// of the resulting vector holds the determinant of the \a k-th matrix. The function can only be
+// used for batches of \f$ 2 \times 2 \f$ up to \f$ 6 \times 6 \f$ matrices. The attempt to use
+// it for any other matrix size results in a compilation error.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of rows and columns of the matrices
+inline DynamicVector<Type> det( const StaticMatrixBatch<Type,N,N>& A )
+{
+   BLAZE_STATIC_ASSERT( N >= 2UL && N <= 6UL );
+
+   DynamicVector<Type> d( A.size() );
+
+   smpBatch( A, BatchDetKernel<Type,N>( d.data(), A.data(), A.size() ) );
+
+   return d;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the inverses of all matrices of a batch.
+// \ingroup dense_matrix
+//
+// \param A The batch of square matrices to be inverted.
+// \return The batch of the inverses of the matrices.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function computes the inverse of each matrix of the given batch via the same closed form
+// formulas as the inversion of a single general matrix of the same size. The function can only
+// be used for batches of \f$ 2 \times 2 \f$ up to \f$ 6 \times 6 \f$ matrices. The attempt to
+// use it for any other matrix size results in a compilation error. In case any matrix of the
+// batch is singular, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of rows and columns of the matrices
+inline StaticMatrixBatch<Type,N,N> inv( const StaticMatrixBatch<Type,N,N>& A )
+{
+   BLAZE_STATIC_ASSERT( N >= 2UL && N <= 6UL );
+
+   StaticMatrixBatch<Type,N,N> B( A.size() );
+   std::atomic<bool> failed( false );
+
+   smpBatch( A, BatchInvertKernel<Type,N>( B.data(), A.data(), A.size(), failed ) );
+
+   if( failed ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+   }
+
+   return B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of all matrices of a batch.
+// \ingroup dense_matrix
+//
+// \param A The batch of square matrices to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts each matrix of the given batch (see the inv() function). In case any
+// matrix of the batch is singular, a \a std::runtime_error exception is thrown and the given
+// batch is not modified.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of rows and columns of the matrices
+inline void invert( StaticMatrixBatch<Type,N,N>& A )
+{
+   StaticMatrixBatch<Type,N,N> B( inv( A ) );
+   A.swap( B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Cholesky (LLH) decomposition of all matrices of a batch.
+// \ingroup dense_matrix
+//
+// \param A The batch of symmetric positive definite matrices to be decomposed.
+// \param L The resulting batch of lower triangular matrices.
+// \return void
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function computes the Cholesky decomposition \f$ A_k = L_k L_k^T \f$ of each matrix of
+// the given batch. Only the lower part of the given matrices is accessed. In case any matrix
+// of the batch is not positive definite, a \a std::runtime_error exception is thrown and the
+// content of \a L is unspecified. Note that \a A and \a L may refer to the same batch.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of rows and columns of the matrices
+inline void llh( const StaticMatrixBatch<Type,N,N>& A, StaticMatrixBatch<Type,N,N>& L )
+{
+   std::atomic<bool> failed( false );
+
+   L.resize( A.size(), false );
+
+   smpBatch( A, BatchLLHKernel<Type,N>( L.data(), A.data(), A.size(), failed ) );
+
+   if( failed ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Decomposition of non-positive-definite matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,788 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/StaticVectorBatch.h
+//  \brief Header file for the implementation of a batch of fixed-size vectors
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_STATICVECTORBATCH_H_
+#define _BLAZE_MATH_DENSE_STATICVECTORBATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <blaze/math/dense/BatchPack.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Efficient implementation of a batch of fixed-size vectors.
+// \ingroup dense_vector
+//
+// The StaticVectorBatch class template represents an arbitrary number of column vectors of the
+// same, fixed size. The type of the elements and the size of the vectors can be specified via
+// the two template parameters:
+
+   \code
+   template< typename Type, size_t N >
+   class StaticVectorBatch;
+   \endcode
+
+//  - Type: specifies the type of the vector elements. StaticVectorBatch can only be used with
+//          floating point types. For \c float and \c double the elements of several
+//          vectors are processed at once via SIMD operations.
+//  - N   : specifies the total number of elements of each vector.
+//
+// In contrast to a plain array of StaticVector instances, the vectors of a StaticVectorBatch
+// are stored interleaved: The elements with index \a i of a group of consecutive vectors are
+// stored contiguously, such that a single SIMD register holds the \a i-th element of several
+// vectors at once (one vector per SIMD lane). This layout enables the batched kernels of the
+// StaticMatrixBatch class template to process as many small vectors at once as there are SIMD
+// lanes, without any shuffle operations. The individual vectors can be accessed via the function
+// call operator, the get() and the set() functions:
+
+   \code
+   blaze::StaticVectorBatch<double,3UL> x( 1000UL );  // Batch of 1000 3D vectors
+
+   x(0UL,2UL) = 1.0;                                   // Setting the element 2 of vector 0
+   x.set( 1UL, blaze::StaticVector<double,3UL>{ 1.0, 2.0, 3.0 } );
+   blaze::StaticVector<double,3UL> v( x.get( 1UL ) );  // Extracting vector 1
+   \endcode
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+class StaticVectorBatch
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef StaticVectorBatch<Type,N>          This;            //!< Type of this StaticVectorBatch instance.
+   typedef Type                               ElementType;     //!< Type of the vector elements.
+   typedef StaticVector<Type,N,columnVector>  VectorType;      //!< Type of a single vector of the batch.
+   typedef Type&                              Reference;       //!< Reference to a non-constant vector value.
+   typedef const Type&                        ConstReference;  //!< Reference to a constant vector value.
+   typedef Type*                              Pointer;         //!< Pointer to a non-constant vector value.
+   typedef const Type*                        ConstPointer;    //!< Pointer to a constant vector value.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! The number of vectors stored interleaved within a single chunk.
+   enum : size_t { lanes = BatchPack<Type>::size };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline StaticVectorBatch() noexcept;
+   explicit inline StaticVectorBatch( size_t n );
+
+   inline StaticVectorBatch( const StaticVectorBatch& b );
+   inline StaticVectorBatch( StaticVectorBatch&& b ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~StaticVectorBatch();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t k, size_t i ) noexcept;
+   inline ConstReference operator()( size_t k, size_t i ) const noexcept;
+   inline Reference      at( size_t k, size_t i );
+   inline ConstReference at( size_t k, size_t i ) const;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Pointer        data  ( size_t c ) noexcept;
+   inline ConstPointer   data  ( size_t c ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline StaticVectorBatch& operator=( const StaticVectorBatch& rhs );
+   inline StaticVectorBatch& operator=( StaticVectorBatch&& rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t           size() const noexcept;
+   inline size_t           chunks() const noexcept;
+   inline const VectorType get( size_t k ) const;
+   inline void             set( size_t k, const VectorType& v );
+   inline void             reset();
+   inline void             clear();
+   inline void             resize( size_t n, bool preserve=true );
+   inline void             swap( StaticVectorBatch& b ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;             //!< The current number of vectors in the batch.
+   size_t capacity_;         //!< The maximum number of chunks of the batch.
+   Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated, interleaved vector elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   BLAZE_STATIC_ASSERT( N > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for StaticVectorBatch.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline StaticVectorBatch<Type,N>::StaticVectorBatch() noexcept
+   : size_    ( 0UL )      // The current number of vectors in the batch
+   , capacity_( 0UL )      // The maximum number of chunks of the batch
+   , v_       ( nullptr )  // The interleaved vector elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of \a n vectors.
+//
+// \param n The number of vectors of the batch.
+//
+// All elements of all vectors are initialized to 0.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline StaticVectorBatch<Type,N>::StaticVectorBatch( size_t n )
+   : size_    ( n )                                    // The current number of vectors in the batch
+   , capacity_( ( n + lanes - 1UL ) / lanes )          // The maximum number of chunks of the batch
+   , v_       ( allocate<Type>( capacity_*N*lanes ) )  // The interleaved vector elements
+{
+   std::fill( v_, v_+capacity_*N*lanes, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for StaticVectorBatch.
+//
+// \param b Batch to be copied.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline StaticVectorBatch<Type,N>::StaticVectorBatch( const StaticVectorBatch& b )
+   : StaticVectorBatch( b.size_ )
+{
+   std::copy( b.v_, b.v_+b.chunks()*N*lanes, v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for StaticVectorBatch.
+//
+// \param b The batch to be moved into this instance.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline StaticVectorBatch<Type,N>::StaticVectorBatch( StaticVectorBatch&& b ) noexcept
+   : size_    ( b.size_     )  // The current number of vectors in the batch
+   , capacity_( b.capacity_ )  // The maximum number of chunks of the batch
+   , v_       ( b.v_        )  // The interleaved vector elements
+{
+   b.size_     = 0UL;
+   b.capacity_ = 0UL;
+   b.v_        = nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for StaticVectorBatch.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline StaticVectorBatch<Type,N>::~StaticVectorBatch()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the vector elements.
+//
+// \param k Index of the accessed vector. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Index of the accessed element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline typename StaticVectorBatch<Type,N>::Reference
+   StaticVectorBatch<Type,N>::operator()( size_t k, size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid vector access index" );
+   BLAZE_USER_ASSERT( i < N    , "Invalid element access index" );
+   return v_[( (k/lanes)*N + i )*lanes + k%lanes];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the vector elements.
+//
+// \param k Index of the accessed vector. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Index of the accessed element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference-to-const to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline typename StaticVectorBatch<Type,N>::ConstReference
+   StaticVectorBatch<Type,N>::operator()( size_t k, size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid vector access index" );
+   BLAZE_USER_ASSERT( i < N    , "Invalid element access index" );
+   return v_[( (k/lanes)*N + i )*lanes + k%lanes];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the vector elements.
+//
+// \param k Index of the accessed vector. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Index of the accessed element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid vector access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline typename StaticVectorBatch<Type,N>::Reference
+   StaticVectorBatch<Type,N>::at( size_t k, size_t i )
+{
+   if( k >= size_ || i >= N ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+   }
+   return (*this)(k,i);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the vector elements.
+//
+// \param k Index of the accessed vector. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Index of the accessed element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference-to-const to the accessed value.
+// \exception std::out_of_range Invalid vector access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline typename StaticVectorBatch<Type,N>::ConstReference
+   StaticVectorBatch<Type,N>::at( size_t k, size_t i ) const
+{
+   if( k >= size_ || i >= N ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+   }
+   return (*this)(k,i);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved vector elements.
+//
+// \return Pointer to the internal element storage.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline typename StaticVectorBatch<Type,N>::Pointer StaticVectorBatch<Type,N>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved vector elements.
+//
+// \return Pointer to the internal element storage.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline typename StaticVectorBatch<Type,N>::ConstPointer
+   StaticVectorBatch<Type,N>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved elements of the given chunk.
+//
+// \param c The index of the chunk.
+// \return Pointer to the first element of the given chunk.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline typename StaticVectorBatch<Type,N>::Pointer
+   StaticVectorBatch<Type,N>::data( size_t c ) noexcept
+{
+   BLAZE_USER_ASSERT( c < chunks(), "Invalid chunk access index" );
+   return v_ + c*N*lanes;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved elements of the given chunk.
+//
+// \param c The index of the chunk.
+// \return Pointer to the first element of the given chunk.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline typename StaticVectorBatch<Type,N>::ConstPointer
+   StaticVectorBatch<Type,N>::data( size_t c ) const noexcept
+{
+   BLAZE_USER_ASSERT( c < chunks(), "Invalid chunk access index" );
+   return v_ + c*N*lanes;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for StaticVectorBatch.
+//
+// \param rhs Batch to be copied.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline StaticVectorBatch<Type,N>& StaticVectorBatch<Type,N>::operator=( const StaticVectorBatch& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.size_, false );
+   std::copy( rhs.v_, rhs.v_+rhs.chunks()*N*lanes, v_ );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for StaticVectorBatch.
+//
+// \param rhs The batch to be moved into this instance.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline StaticVectorBatch<Type,N>& StaticVectorBatch<Type,N>::operator=( StaticVectorBatch&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   size_     = rhs.size_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.size_     = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of vectors of the batch.
+//
+// \return The number of vectors of the batch.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline size_t StaticVectorBatch<Type,N>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of chunks of the batch.
+//
+// \return The number of chunks of the batch.
+//
+// Each chunk contains as many interleaved vectors as there are SIMD lanes for the element type
+// of the batch. The last chunk may be partially filled.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline size_t StaticVectorBatch<Type,N>::chunks() const noexcept
+{
+   return ( size_ + lanes - 1UL ) / lanes;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of the vector with the given index.
+//
+// \param k Index of the vector. The index has to be in the range \f$[0..size-1]\f$.
+// \return Copy of the vector with the given index.
+// \exception std::out_of_range Invalid vector access index.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline const typename StaticVectorBatch<Type,N>::VectorType
+   StaticVectorBatch<Type,N>::get( size_t k ) const
+{
+   if( k >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+   }
+
+   VectorType v;
+   for( size_t i=0UL; i<N; ++i ) {
+      v[i] = (*this)(k,i);
+   }
+   return v;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the vector with the given index.
+//
+// \param k Index of the vector. The index has to be in the range \f$[0..size-1]\f$.
+// \param v The new value of the vector.
+// \return void
+// \exception std::out_of_range Invalid vector access index.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline void StaticVectorBatch<Type,N>::set( size_t k, const VectorType& v )
+{
+   if( k >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      (*this)(k,i) = v[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all elements of all vectors to 0. The size of the batch is preserved.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline void StaticVectorBatch<Type,N>::reset()
+{
+   std::fill( v_, v_+chunks()*N*lanes, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the batch.
+//
+// \return void
+//
+// After the clear() function, the size of the batch is 0.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline void StaticVectorBatch<Type,N>::clear()
+{
+   size_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the number of vectors of the batch.
+//
+// \param n The new number of vectors of the batch.
+// \param preserve \a true if the old values of the batch should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the batch using the given number of vectors. During this operation,
+// new dynamic memory may be allocated in case the capacity of the batch is too small. Note
+// that this function may invalidate all existing references and pointers to the elements of
+// the batch! Newly added vectors are NOT initialized!
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline void StaticVectorBatch<Type,N>::resize( size_t n, bool preserve )
+{
+   const size_t newChunks( ( n + lanes - 1UL ) / lanes );
+
+   if( newChunks > capacity_ )
+   {
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( newChunks*N*lanes );
+
+      if( preserve ) {
+         std::copy( v_, v_+chunks()*N*lanes, tmp );
+         std::fill( tmp+chunks()*N*lanes, tmp+newChunks*N*lanes, Type() );
+      }
+      else {
+         std::fill( tmp, tmp+newChunks*N*lanes, Type() );
+      }
+
+      std::swap( v_, tmp );
+      deallocate( tmp );
+      capacity_ = newChunks;
+   }
+
+   size_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+//
+// \param b The batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline void StaticVectorBatch<Type,N>::swap( StaticVectorBatch& b ) noexcept
+{
+   using std::swap;
+
+   swap( size_, b.size_ );
+   swap( capacity_, b.capacity_ );
+   swap( v_, b.v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the batch can be used in SMP assignments.
+//
+// \return \a true in case the batch can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the batched kernels operating on the batch can be executed in
+// parallel. This is the case if the number of vectors of the batch is larger or equal to the
+// blaze::SMP_BATCH_THRESHOLD.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline bool StaticVectorBatch<Type,N>::canSMPAssign() const noexcept
+{
+   return ( size_ >= SMP_BATCH_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STATICVECTORBATCH OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name StaticVectorBatch operators */
+//@{
+template< typename Type, size_t N >
+inline void reset( StaticVectorBatch<Type,N>& b );
+
+template< typename Type, size_t N >
+inline void clear( StaticVectorBatch<Type,N>& b );
+
+template< typename Type, size_t N >
+inline void swap( StaticVectorBatch<Type,N>& a, StaticVectorBatch<Type,N>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given batch of vectors.
+// \ingroup dense_vector
+//
+// \param b The batch to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline void reset( StaticVectorBatch<Type,N>& b )
+{
+   b.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given batch of vectors.
+// \ingroup dense_vector
+//
+// \param b The batch to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline void clear( StaticVectorBatch<Type,N>& b )
+{
+   b.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches of vectors.
+// \ingroup dense_vector
+//
+// \param a The first batch to be swapped.
+// \param b The second batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements of each vector
+inline void swap( StaticVectorBatch<Type,N>& a, StaticVectorBatch<Type,N>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,587 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/SymmetricKernels.h
+//  \brief Header file for the symmetric matrix multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_SYMMETRICKERNELS_H_
+#define _BLAZE_MATH_DENSE_SYMMETRICKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/ConstDataAccess.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/PackedKernels.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatSerialExpr.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/smp/Fused.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Maximum number of columns of the right-hand side operand of the symmetric kernel.
+// \ingroup dense_matrix
+//
+// For a dense matrix operand with more columns the multiplication with a symmetric dense matrix
+// is not limited by the memory bandwidth anymore and the general matrix multiplication kernels
+// outperform the symmetric kernel (see symm()).
+*/
+constexpr size_t symmColumnLimit = 8UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LINE KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default multiplication of a single line of a symmetric matrix with a dense vector.
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first element of the line.
+// \param k The index of the line.
+// \param x Pointer to the first element of the right-hand side dense vector.
+// \param y Pointer to the first element of the target dense vector.
+// \param alpha The scaling factor.
+// \return void
+//
+// This function adds the contribution of the elements \f$ 0..k \f$ of line \a k of a symmetric
+// matrix (and of their mirrored counterparts) to \f$ \vec{y}=\alpha*A*\vec{x} \f$. Due to the
+// symmetry of the matrix, the first \a k elements of both row \a k and column \a k represent
+// the strictly lower part of row \a k, i.e. the function works for both storage orders.
+*/
+template< typename Type >  // Data type of the elements
+inline DisableIf_< UseVectorizedPackedKernel<Type> >
+   symvLine( const Type* a, size_t k, const Type* x, Type* y, const Type& alpha )
+{
+   const Type s( alpha * x[k] );
+
+   Type value = Type();
+
+   for( size_t i=0UL; i<k; ++i ) {
+      value += a[i] * x[i];
+      y[i]  += a[i] * s;
+   }
+
+   y[k] += alpha * value + a[k] * s;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized multiplication of a single line of a symmetric matrix with a dense vector.
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first element of the line.
+// \param k The index of the line.
+// \param x Pointer to the first element of the right-hand side dense vector.
+// \param y Pointer to the first element of the target dense vector.
+// \param alpha The scaling factor.
+// \return void
+//
+// This function adds the contribution of the elements \f$ 0..k \f$ of line \a k of a symmetric
+// matrix (and of their mirrored counterparts) to \f$ \vec{y}=\alpha*A*\vec{x} \f$. Each element
+// is loaded once and is used both for the dot product with \a x and for the update of \a y.
+*/
+template< typename Type >  // Data type of the elements
+inline EnableIf_< UseVectorizedPackedKernel<Type> >
+   symvLine( const Type* a, size_t k, const Type* x, Type* y, const Type& alpha )
+{
+   typedef SIMDTrait_<Type>  SIMDType;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t ipos( k & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ipos <= k, "Invalid end calculation" );
+
+   const Type s( alpha * x[k] );
+   const SIMDType factor( set( s ) );
+
+   SIMDType xmm1;
+   size_t i( 0UL );
+
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      const SIMDType a1( loadu( a+i ) );
+      xmm1 = xmm1 + a1 * loadu( x+i );
+      storeu( y+i, loadu( y+i ) + a1 * factor );
+   }
+
+   Type value( sum( xmm1 ) );
+
+   for( ; i<k; ++i ) {
+      value += a[i] * x[i];
+      y[i]  += a[i] * s;
+   }
+
+   y[k] += alpha * value + a[k] * s;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SYMVKERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused kernel for the multiplication of a symmetric dense matrix with a dense vector.
+// \ingroup dense_matrix
+//
+// The SymvKernel class template computes \f$ \vec{y}=\alpha*A*\vec{x} \f$ for a symmetric
+// dense matrix \a A by reading only the elements \f$ 0..k \f$ of each row/column \a k (see
+// symvLine()). Since every line updates the elements \f$ 0..k \f$ of the result, each range of
+// lines accumulates its contribution in a separate vector, which is returned and combined by
+// the smpFused() function. Unit \a u of the kernel represents the lines \a u and \f$ n-1-u \f$,
+// which balances the triangular workload between the ranges.
+*/
+template< typename Type  // Data type of the elements
+        , bool TF >      // Transpose flag of the result vector
+struct SymvKernel
+{
+   //**Type definitions****************************************************************************
+   using ResultType = DynamicVector<Type,TF>;  //!< Result type of the kernel.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! The granularity of the ranges of pairs of lines.
+   enum : size_t { granularity = 1UL };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SymvKernel class template.
+   //
+   // \param A The first element of the symmetric dense matrix.
+   // \param spacing The spacing between two rows/columns of the dense matrix.
+   // \param n The number of rows/columns of the dense matrix.
+   // \param x The first element of the right-hand side dense vector.
+   // \param alpha The scaling factor.
+   // \param parallel \a true in case the kernel should be evaluated in parallel.
+   */
+   explicit inline SymvKernel( const Type* A, size_t spacing, size_t n,
+                               const Type* x, const Type& alpha, bool parallel ) noexcept
+      : A_       ( A        )  // The first element of the dense matrix
+      , spacing_ ( spacing  )  // The spacing between two rows/columns
+      , n_       ( n        )  // The number of rows/columns
+      , x_       ( x        )  // The first element of the dense vector
+      , alpha_   ( alpha    )  // The scaling factor
+      , parallel_( parallel )  // Flag for the parallel evaluation
+   {}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the number of units processed by the kernel.
+   //
+   // \return The number of pairs of rows/columns of the matrix.
+   */
+   inline size_t size() const noexcept {
+      return ( n_ + 1UL ) / 2UL;
+   }
+
+   /*!\brief Returns whether the kernel can be evaluated in parallel.
+   //
+   // \return \a true in case the kernel can be evaluated in parallel, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return parallel_;
+   }
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the contribution of the given range of pairs of lines.
+   //
+   // \param begin The index of the first unit of the range.
+   // \param end The index one past the last unit of the range.
+   // \return The partial result of the multiplication.
+   */
+   inline ResultType operator()( size_t begin, size_t end ) const
+   {
+      ResultType acc( n_, Type() );
+      Type* y( acc.data() );
+
+      for( size_t u=begin; u<end; ++u )
+      {
+         const size_t k( n_ - 1UL - u );
+
+         symvLine( A_ + u*spacing_, u, x_, y, alpha_ );
+
+         if( k != u ) {
+            symvLine( A_ + k*spacing_, k, x_, y, alpha_ );
+         }
+      }
+
+      return acc;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const Type* A_;         //!< The first element of the dense matrix.
+   size_t      spacing_;   //!< The spacing between two rows/columns of the dense matrix.
+   size_t      n_;         //!< The number of rows/columns of the matrix.
+   const Type* x_;         //!< The first element of the right-hand side dense vector.
+   Type        alpha_;     //!< The scaling factor.
+   bool        parallel_;  //!< Flag for the parallel evaluation.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SYMMKERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused kernel for the multiplication of a symmetric dense matrix with a dense matrix.
+// \ingroup dense_matrix
+//
+// The SymmKernel class template computes \f$ C=\alpha*A*B \f$ for a symmetric dense matrix
+// \a A and a column-major dense matrix \a B by reading only the elements \f$ 0..k \f$ of each
+// row/column \a k of \a A. Each line of \a A is applied to all columns of \a B while it still
+// resides in the cache (see symvLine()). As in case of the SymvKernel class template, each
+// range of pairs of lines accumulates its contribution in a separate matrix, which is returned
+// and combined by the smpFused() function.
+*/
+template< typename Type >  // Data type of the elements
+struct SymmKernel
+{
+   //**Type definitions****************************************************************************
+   using ResultType = DynamicMatrix<Type,columnMajor>;  //!< Result type of the kernel.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! The granularity of the ranges of pairs of lines.
+   enum : size_t { granularity = 1UL };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SymmKernel class template.
+   //
+   // \param A The first element of the symmetric dense matrix.
+   // \param lda The spacing between two rows/columns of the symmetric dense matrix.
+   // \param n The number of rows/columns of the symmetric dense matrix.
+   // \param B The first element of the column-major right-hand side dense matrix.
+   // \param ldb The spacing between two columns of the right-hand side dense matrix.
+   // \param m The number of columns of the right-hand side dense matrix.
+   // \param alpha The scaling factor.
+   // \param parallel \a true in case the kernel should be evaluated in parallel.
+   */
+   explicit inline SymmKernel( const Type* A, size_t lda, size_t n,
+                               const Type* B, size_t ldb, size_t m,
+                               const Type& alpha, bool parallel ) noexcept
+      : A_       ( A        )  // The first element of the symmetric dense matrix
+      , lda_     ( lda      )  // The spacing of the symmetric dense matrix
+      , n_       ( n        )  // The number of rows/columns of the symmetric matrix
+      , B_       ( B        )  // The first element of the right-hand side dense matrix
+      , ldb_     ( ldb      )  // The spacing of the right-hand side dense matrix
+      , m_       ( m        )  // The number of columns of the right-hand side matrix
+      , alpha_   ( alpha    )  // The scaling factor
+      , parallel_( parallel )  // Flag for the parallel evaluation
+   {}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the number of units processed by the kernel.
+   //
+   // \return The number of pairs of rows/columns of the symmetric matrix.
+   */
+   inline size_t size() const noexcept {
+      return ( n_ + 1UL ) / 2UL;
+   }
+
+   /*!\brief Returns whether the kernel can be evaluated in parallel.
+   //
+   // \return \a true in case the kernel can be evaluated in parallel, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return parallel_;
+   }
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the contribution of the given range of pairs of lines.
+   //
+   // \param begin The index of the first unit of the range.
+   // \param end The index one past the last unit of the range.
+   // \return The partial result of the multiplication.
+   */
+   inline ResultType operator()( size_t begin, size_t end ) const
+   {
+      ResultType acc( n_, m_, Type() );
+      Type* c( acc.data() );
+      const size_t ldc( acc.spacing() );
+
+      for( size_t u=begin; u<end; ++u )
+      {
+         const size_t k( n_ - 1UL - u );
+
+         for( size_t j=0UL; j<m_; ++j ) {
+            symvLine( A_ + u*lda_, u, B_ + j*ldb_, c + j*ldc, alpha_ );
+         }
+
+         if( k != u ) {
+            for( size_t j=0UL; j<m_; ++j ) {
+               symvLine( A_ + k*lda_, k, B_ + j*ldb_, c + j*ldc, alpha_ );
+            }
+         }
+      }
+
+      return acc;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const Type* A_;         //!< The first element of the symmetric dense matrix.
+   size_t      lda_;       //!< The spacing of the symmetric dense matrix.
+   size_t      n_;         //!< The number of rows/columns of the symmetric matrix.
+   const Type* B_;         //!< The first element of the right-hand side dense matrix.
+   size_t      ldb_;       //!< The spacing of the right-hand side dense matrix.
+   size_t      m_;         //!< The number of columns of the right-hand side matrix.
+   Type        alpha_;     //!< The scaling factor.
+   bool        parallel_;  //!< Flag for the parallel evaluation.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SYMMETRIC MATRIX/DENSE VECTOR MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Symmetric kernel for a dense matrix/dense vector multiplication
+//        (\f$ \vec{y}+=\alpha*A*\vec{x} \f$).
+// \ingroup dense_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side symmetric dense matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \return void
+//
+// This function performs the multiplication of a symmetric dense matrix with a dense vector
+// by reading only one triangle of \a A (see SymvKernel). In case of a parallel evaluation
+// each thread accumulates its contribution in a separate vector, i.e. the threads never write
+// to the same elements.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename MT1   // Type of the left-hand side matrix operand
+        , bool SO        // Storage order of the left-hand side matrix operand
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scaling factor
+inline void symv( DenseVector<VT1,false>& y, const DenseMatrix<MT1,SO>& A,
+                  const DenseVector<VT2,false>& x, ST alpha )
+{
+   typedef ElementType_<VT1>  ET;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT2 );
+
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS( VT2 );
+
+   BLAZE_STATIC_ASSERT( IsSymmetric<MT1>::value );
+
+   BLAZE_INTERNAL_ASSERT( (~A).rows()    == (~y).size(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~x).size(), "Invalid vector size" );
+
+   const size_t n( (~A).rows() );
+
+   const SymvKernel<ET,false> kernel( (~A).data(), (~A).spacing(), n, (~x).data(), ET( alpha ),
+                                      n > ( SO ? SMP_TDMATDVECMULT_THRESHOLD : SMP_DMATDVECMULT_THRESHOLD ) );
+
+   addAssign( ~y, smpFused( kernel ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Symmetric kernel for a transpose dense vector/dense matrix multiplication
+//        (\f$ \vec{y}^T+=\alpha*\vec{x}^T*A \f$).
+// \ingroup dense_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param x The left-hand side dense vector operand.
+// \param A The right-hand side symmetric dense matrix operand.
+// \param alpha The scaling factor for \f$ \vec{x}^T*A \f$.
+// \return void
+//
+// This function exploits \f$ \vec{x}^T*A = (A*\vec{x})^T \f$ for a symmetric matrix \a A and
+// reads only one triangle of \a A (see SymvKernel).
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename VT2   // Type of the left-hand side vector operand
+        , typename MT1   // Type of the right-hand side matrix operand
+        , bool SO        // Storage order of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factor
+inline void symv( DenseVector<VT1,true>& y, const DenseVector<VT2,true>& x,
+                  const DenseMatrix<MT1,SO>& A, ST alpha )
+{
+   typedef ElementType_<VT1>  ET;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT2 );
+
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS( VT2 );
+
+   BLAZE_STATIC_ASSERT( IsSymmetric<MT1>::value );
+
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~y).size(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~A).rows()    == (~x).size(), "Invalid vector size" );
+
+   const size_t n( (~A).rows() );
+
+   const SymvKernel<ET,true> kernel( (~A).data(), (~A).spacing(), n, (~x).data(), ET( alpha ),
+                                     n > ( SO ? SMP_TDVECTDMATMULT_THRESHOLD : SMP_TDVECDMATMULT_THRESHOLD ) );
+
+   addAssign( ~y, smpFused( kernel ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SYMMETRIC MATRIX/DENSE MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Symmetric kernel for a dense matrix/dense matrix multiplication (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side symmetric dense matrix operand.
+// \param B The right-hand side dense matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This function performs the multiplication of a symmetric dense matrix with a dense matrix
+// by reading only one triangle of \a A (see SymmKernel). A row-major operand \a B is copied
+// into a column-major temporary first. In case of a parallel evaluation each thread accumulates
+// its contribution in a separate matrix, i.e. the threads never write to the same elements.
+// Since the result is accumulated in a temporary matrix, the kernel is meant for right-hand
+// side operands with few columns (see symmColumnLimit), for which the multiplication is
+// limited by the memory bandwidth for \a A.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factor
+inline void symm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                  const DenseMatrix<MT3,SO3>& B, ST alpha )
+{
+   typedef ElementType_<MT1>  ET;
+   typedef If_< IsRowMajorMatrix<MT3>, const DynamicMatrix<ET,columnMajor>, const MT3& >  BT;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
+
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS( MT2 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS( MT3 );
+
+   BLAZE_STATIC_ASSERT( IsSymmetric<MT2>::value );
+
+   BLAZE_INTERNAL_ASSERT( (~A).rows()    == (~C).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~B).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~B).columns() == (~C).columns(), "Invalid number of columns" );
+
+   BT tmp( serial( ~B ) );
+
+   const SymmKernel<ET> kernel( (~A).data(), (~A).spacing(), (~A).rows(),
+                                tmp.data(), tmp.spacing(), tmp.columns(), ET( alpha ),
+                                (~C).rows() * (~C).columns() >=
+                                   ( SO2 ? SMP_TDMATTDMATMULT_THRESHOLD : SMP_DMATDMATMULT_THRESHOLD ) );
+
+   addAssign( ~C, smpFused( kernel ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,589 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/DMV.h
+//  \brief Header file for the runtime dispatched dense matrix/dense vector multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_DMV_H_
+#define _BLAZE_MATH_DISPATCH_DMV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dispatch/Reduction.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/simd/ISA.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the runtime dispatched dense matrix/dense vector products.
+// \ingroup dense_vector
+//
+// In case the runtime dispatch mode is active (see BLAZE_USE_RUNTIME_DISPATCH) and runtime
+// dispatched kernels for the multiplication of a row-major dense matrix and a dense vector with
+// the given element type \a T are available, the nested \a value is set to 1, otherwise it is 0.
+*/
+template< typename T >  // Element type
+struct IsDMVDispatched
+{
+   enum : bool { value = BLAZE_RUNTIME_DISPATCH_MODE && ( IsFloat<T>::value || IsDouble<T>::value ) };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+//=================================================================================================
+//
+//  AVX2 KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2 kernel of the row-major dense matrix/dense vector multiplication for 'double' values.
+// \ingroup dense_vector
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param A Pointer to the first element of the row-major matrix.
+// \param lda The distance between the first elements of two consecutive rows of the matrix.
+// \param x Pointer to the first element of the vector.
+// \param y Pointer to the first element of the target vector.
+// \param alpha The scaling factor for the matrix/vector product.
+// \return void
+//
+// This function computes \f$ \vec{y}+=\alpha*A*\vec{x} \f$. Four rows of the matrix are
+// processed simultaneously, each by means of two independent accumulators.
+*/
+BLAZE_TARGET_AVX2 inline void dmvKernelAVX2( size_t m, size_t n, const double* A, size_t lda,
+                                             const double* x, double* y, double alpha ) noexcept
+{
+   const size_t jpos1( n & size_t(-8) );
+   const size_t jpos2( n & size_t(-4) );
+
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= m; i+=4UL )
+   {
+      const double* a1( A + i*lda );
+      const double* a2( a1 + lda );
+      const double* a3( a2 + lda );
+      const double* a4( a3 + lda );
+
+      __m256d xmm1( _mm256_setzero_pd() ), xmm2( xmm1 ), xmm3( xmm1 ), xmm4( xmm1 );
+      __m256d xmm5( xmm1 ), xmm6( xmm1 ), xmm7( xmm1 ), xmm8( xmm1 );
+
+      size_t j( 0UL );
+
+      for( ; j<jpos1; j+=8UL ) {
+         const __m256d x1( _mm256_loadu_pd( x+j    ) );
+         const __m256d x2( _mm256_loadu_pd( x+j+4UL ) );
+         xmm1 = _mm256_fmadd_pd( _mm256_loadu_pd( a1+j    ), x1, xmm1 );
+         xmm2 = _mm256_fmadd_pd( _mm256_loadu_pd( a1+j+4UL ), x2, xmm2 );
+         xmm3 = _mm256_fmadd_pd( _mm256_loadu_pd( a2+j    ), x1, xmm3 );
+         xmm4 = _mm256_fmadd_pd( _mm256_loadu_pd( a2+j+4UL ), x2, xmm4 );
+         xmm5 = _mm256_fmadd_pd( _mm256_loadu_pd( a3+j    ), x1, xmm5 );
+         xmm6 = _mm256_fmadd_pd( _mm256_loadu_pd( a3+j+4UL ), x2, xmm6 );
+         xmm7 = _mm256_fmadd_pd( _mm256_loadu_pd( a4+j    ), x1, xmm7 );
+         xmm8 = _mm256_fmadd_pd( _mm256_loadu_pd( a4+j+4UL ), x2, xmm8 );
+      }
+
+      for( ; j<jpos2; j+=4UL ) {
+         const __m256d x1( _mm256_loadu_pd( x+j ) );
+         xmm1 = _mm256_fmadd_pd( _mm256_loadu_pd( a1+j ), x1, xmm1 );
+         xmm3 = _mm256_fmadd_pd( _mm256_loadu_pd( a2+j ), x1, xmm3 );
+         xmm5 = _mm256_fmadd_pd( _mm256_loadu_pd( a3+j ), x1, xmm5 );
+         xmm7 = _mm256_fmadd_pd( _mm256_loadu_pd( a4+j ), x1, xmm7 );
+      }
+
+      double y1( reduceAVX2( _mm256_add_pd( xmm1, xmm2 ), Add() ) );
+      double y2( reduceAVX2( _mm256_add_pd( xmm3, xmm4 ), Add() ) );
+      double y3( reduceAVX2( _mm256_add_pd( xmm5, xmm6 ), Add() ) );
+      double y4( reduceAVX2( _mm256_add_pd( xmm7, xmm8 ), Add() ) );
+
+      for( ; j<n; ++j ) {
+         y1 += a1[j] * x[j];
+         y2 += a2[j] * x[j];
+         y3 += a3[j] * x[j];
+         y4 += a4[j] * x[j];
+      }
+
+      y[i    ] += alpha * y1;
+      y[i+1UL] += alpha * y2;
+      y[i+2UL] += alpha * y3;
+      y[i+3UL] += alpha * y4;
+   }
+
+   for( ; i<m; ++i )
+   {
+      const double* a1( A + i*lda );
+
+      __m256d xmm1( _mm256_setzero_pd() ), xmm2( xmm1 );
+
+      size_t j( 0UL );
+
+      for( ; j<jpos1; j+=8UL ) {
+         xmm1 = _mm256_fmadd_pd( _mm256_loadu_pd( a1+j    ), _mm256_loadu_pd( x+j    ), xmm1 );
+         xmm2 = _mm256_fmadd_pd( _mm256_loadu_pd( a1+j+4UL ), _mm256_loadu_pd( x+j+4UL ), xmm2 );
+      }
+
+      for( ; j<jpos2; j+=4UL ) {
+         xmm1 = _mm256_fmadd_pd( _mm256_loadu_pd( a1+j ), _mm256_loadu_pd( x+j ), xmm1 );
+      }
+
+      double y1( reduceAVX2( _mm256_add_pd( xmm1, xmm2 ), Add() ) );
+
+      for( ; j<n; ++j ) {
+         y1 += a1[j] * x[j];
+      }
+
+      y[i] += alpha * y1;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2 kernel of the row-major dense matrix/dense vector multiplication for 'float' values.
+// \ingroup dense_vector
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param A Pointer to the first element of the row-major matrix.
+// \param lda The distance between the first elements of two consecutive rows of the matrix.
+// \param x Pointer to the first element of the vector.
+// \param y Pointer to the first element of the target vector.
+// \param alpha The scaling factor for the matrix/vector product.
+// \return void
+//
+// This function computes \f$ \vec{y}+=\alpha*A*\vec{x} \f$. Four rows of the matrix are
+// processed simultaneously, each by means of two independent accumulators.
+*/
+BLAZE_TARGET_AVX2 inline void dmvKernelAVX2( size_t m, size_t n, const float* A, size_t lda,
+                                             const float* x, float* y, float alpha ) noexcept
+{
+   const size_t jpos1( n & size_t(-16) );
+   const size_t jpos2( n & size_t(-8) );
+
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= m; i+=4UL )
+   {
+      const float* a1( A + i*lda );
+      const float* a2( a1 + lda );
+      const float* a3( a2 + lda );
+      const float* a4( a3 + lda );
+
+      __m256 xmm1( _mm256_setzero_ps() ), xmm2( xmm1 ), xmm3( xmm1 ), xmm4( xmm1 );
+      __m256 xmm5( xmm1 ), xmm6( xmm1 ), xmm7( xmm1 ), xmm8( xmm1 );
+
+      size_t j( 0UL );
+
+      for( ; j<jpos1; j+=16UL ) {
+         const __m256 x1( _mm256_loadu_ps( x+j    ) );
+         const __m256 x2( _mm256_loadu_ps( x+j+8UL ) );
+         xmm1 = _mm256_fmadd_ps( _mm256_loadu_ps( a1+j    ), x1, xmm1 );
+         xmm2 = _mm256_fmadd_ps( _mm256_loadu_ps( a1+j+8UL ), x2, xmm2 );
+         xmm3 = _mm256_fmadd_ps( _mm256_loadu_ps( a2+j    ), x1, xmm3 );
+         xmm4 = _mm256_fmadd_ps( _mm256_loadu_ps( a2+j+8UL ), x2, xmm4 );
+         xmm5 = _mm256_fmadd_ps( _mm256_loadu_ps( a3+j    ), x1, xmm5 );
+         xmm6 = _mm256_fmadd_ps( _mm256_loadu_ps( a3+j+8UL ), x2, xmm6 );
+         xmm7 = _mm256_fmadd_ps( _mm256_loadu_ps( a4+j    ), x1, xmm7 );
+         xmm8 = _mm256_fmadd_ps( _mm256_loadu_ps( a4+j+8UL ), x2, xmm8 );
+      }
+
+      for( ; j<jpos2; j+=8UL ) {
+         const __m256 x1( _mm256_loadu_ps( x+j ) );
+         xmm1 = _mm256_fmadd_ps( _mm256_loadu_ps( a1+j ), x1, xmm1 );
+         xmm3 = _mm256_fmadd_ps( _mm256_loadu_ps( a2+j ), x1, xmm3 );
+         xmm5 = _mm256_fmadd_ps( _mm256_loadu_ps( a3+j ), x1, xmm5 );
+         xmm7 = _mm256_fmadd_ps( _mm256_loadu_ps( a4+j ), x1, xmm7 );
+      }
+
+      float y1( reduceAVX2( _mm256_add_ps( xmm1, xmm2 ), Add() ) );
+      float y2( reduceAVX2( _mm256_add_ps( xmm3, xmm4 ), Add() ) );
+      float y3( reduceAVX2( _mm256_add_ps( xmm5, xmm6 ), Add() ) );
+      float y4( reduceAVX2( _mm256_add_ps( xmm7, xmm8 ), Add() ) );
+
+      for( ; j<n; ++j ) {
+         y1 += a1[j] * x[j];
+         y2 += a2[j] * x[j];
+         y3 += a3[j] * x[j];
+         y4 += a4[j] * x[j];
+      }
+
+      y[i    ] += alpha * y1;
+      y[i+1UL] += alpha * y2;
+      y[i+2UL] += alpha * y3;
+      y[i+3UL] += alpha * y4;
+   }
+
+   for( ; i<m; ++i )
+   {
+      const float* a1( A + i*lda );
+
+      __m256 xmm1( _mm256_setzero_ps() ), xmm2( xmm1 );
+
+      size_t j( 0UL );
+
+      for( ; j<jpos1; j+=16UL ) {
+         xmm1 = _mm256_fmadd_ps( _mm256_loadu_ps( a1+j    ), _mm256_loadu_ps( x+j    ), xmm1 );
+         xmm2 = _mm256_fmadd_ps( _mm256_loadu_ps( a1+j+8UL ), _mm256_loadu_ps( x+j+8UL ), xmm2 );
+      }
+
+      for( ; j<jpos2; j+=8UL ) {
+         xmm1 = _mm256_fmadd_ps( _mm256_loadu_ps( a1+j ), _mm256_loadu_ps( x+j ), xmm1 );
+      }
+
+      float y1( reduceAVX2( _mm256_add_ps( xmm1, xmm2 ), Add() ) );
+
+      for( ; j<n; ++j ) {
+         y1 += a1[j] * x[j];
+      }
+
+      y[i] += alpha * y1;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AVX-512F KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512F kernel of the row-major dense matrix/dense vector multiplication for 'double' values.
+// \ingroup dense_vector
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param A Pointer to the first element of the row-major matrix.
+// \param lda The distance between the first elements of two consecutive rows of the matrix.
+// \param x Pointer to the first element of the vector.
+// \param y Pointer to the first element of the target vector.
+// \param alpha The scaling factor for the matrix/vector product.
+// \return void
+//
+// This function computes \f$ \vec{y}+=\alpha*A*\vec{x} \f$. Four rows of the matrix are
+// processed simultaneously, each by means of two independent accumulators.
+*/
+BLAZE_TARGET_AVX512F inline void dmvKernelAVX512( size_t m, size_t n, const double* A, size_t lda,
+                                                  const double* x, double* y, double alpha ) noexcept
+{
+   const size_t jpos1( n & size_t(-16) );
+   const size_t jpos2( n & size_t(-8) );
+
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= m; i+=4UL )
+   {
+      const double* a1( A + i*lda );
+      const double* a2( a1 + lda );
+      const double* a3( a2 + lda );
+      const double* a4( a3 + lda );
+
+      __m512d xmm1( _mm512_setzero_pd() ), xmm2( xmm1 ), xmm3( xmm1 ), xmm4( xmm1 );
+      __m512d xmm5( xmm1 ), xmm6( xmm1 ), xmm7( xmm1 ), xmm8( xmm1 );
+
+      size_t j( 0UL );
+
+      for( ; j<jpos1; j+=16UL ) {
+         const __m512d x1( _mm512_loadu_pd( x+j    ) );
+         const __m512d x2( _mm512_loadu_pd( x+j+8UL ) );
+         xmm1 = _mm512_fmadd_pd( _mm512_loadu_pd( a1+j    ), x1, xmm1 );
+         xmm2 = _mm512_fmadd_pd( _mm512_loadu_pd( a1+j+8UL ), x2, xmm2 );
+         xmm3 = _mm512_fmadd_pd( _mm512_loadu_pd( a2+j    ), x1, xmm3 );
+         xmm4 = _mm512_fmadd_pd( _mm512_loadu_pd( a2+j+8UL ), x2, xmm4 );
+         xmm5 = _mm512_fmadd_pd( _mm512_loadu_pd( a3+j    ), x1, xmm5 );
+         xmm6 = _mm512_fmadd_pd( _mm512_loadu_pd( a3+j+8UL ), x2, xmm6 );
+         xmm7 = _mm512_fmadd_pd( _mm512_loadu_pd( a4+j    ), x1, xmm7 );
+         xmm8 = _mm512_fmadd_pd( _mm512_loadu_pd( a4+j+8UL ), x2, xmm8 );
+      }
+
+      for( ; j<jpos2; j+=8UL ) {
+         const __m512d x1( _mm512_loadu_pd( x+j ) );
+         xmm1 = _mm512_fmadd_pd( _mm512_loadu_pd( a1+j ), x1, xmm1 );
+         xmm3 = _mm512_fmadd_pd( _mm512_loadu_pd( a2+j ), x1, xmm3 );
+         xmm5 = _mm512_fmadd_pd( _mm512_loadu_pd( a3+j ), x1, xmm5 );
+         xmm7 = _mm512_fmadd_pd( _mm512_loadu_pd( a4+j ), x1, xmm7 );
+      }
+
+      double y1( reduceAVX512( _mm512_add_pd( xmm1, xmm2 ), Add() ) );
+      double y2( reduceAVX512( _mm512_add_pd( xmm3, xmm4 ), Add() ) );
+      double y3( reduceAVX512( _mm512_add_pd( xmm5, xmm6 ), Add() ) );
+      double y4( reduceAVX512( _mm512_add_pd( xmm7, xmm8 ), Add() ) );
+
+      for( ; j<n; ++j ) {
+         y1 += a1[j] * x[j];
+         y2 += a2[j] * x[j];
+         y3 += a3[j] * x[j];
+         y4 += a4[j] * x[j];
+      }
+
+      y[i    ] += alpha * y1;
+      y[i+1UL] += alpha * y2;
+      y[i+2UL] += alpha * y3;
+      y[i+3UL] += alpha * y4;
+   }
+
+   for( ; i<m; ++i )
+   {
+      const double* a1( A + i*lda );
+
+      __m512d xmm1( _mm512_setzero_pd() ), xmm2( xmm1 );
+
+      size_t j( 0UL );
+
+      for( ; j<jpos1; j+=16UL ) {
+         xmm1 = _mm512_fmadd_pd( _mm512_loadu_pd( a1+j    ), _mm512_loadu_pd( x+j    ), xmm1 );
+         xmm2 = _mm512_fmadd_pd( _mm512_loadu_pd( a1+j+8UL ), _mm512_loadu_pd( x+j+8UL ), xmm2 );
+      }
+
+      for( ; j<jpos2; j+=8UL ) {
+         xmm1 = _mm512_fmadd_pd( _mm512_loadu_pd( a1+j ), _mm512_loadu_pd( x+j ), xmm1 );
+      }
+
+      double y1( reduceAVX512( _mm512_add_pd( xmm1, xmm2 ), Add() ) );
+
+      for( ; j<n; ++j ) {
+         y1 += a1[j] * x[j];
+      }
+
+      y[i] += alpha * y1;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512F kernel of the row-major dense matrix/dense vector multiplication for 'float' values.
+// \ingroup dense_vector
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param A Pointer to the first element of the row-major matrix.
+// \param lda The distance between the first elements of two consecutive rows of the matrix.
+// \param x Pointer to the first element of the vector.
+// \param y Pointer to the first element of the target vector.
+// \param alpha The scaling factor for the matrix/vector product.
+// \return void
+//
+// This function computes \f$ \vec{y}+=\alpha*A*\vec{x} \f$. Four rows of the matrix are
+// processed simultaneously, each by means of two independent accumulators.
+*/
+BLAZE_TARGET_AVX512F inline void dmvKernelAVX512( size_t m, size_t n, const float* A, size_t lda,
+                                                  const float* x, float* y, float alpha ) noexcept
+{
+   const size_t jpos1( n & size_t(-32) );
+   const size_t jpos2( n & size_t(-16) );
+
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= m; i+=4UL )
+   {
+      const float* a1( A + i*lda );
+      const float* a2( a1 + lda );
+      const float* a3( a2 + lda );
+      const float* a4( a3 + lda );
+
+      __m512 xmm1( _mm512_setzero_ps() ), xmm2( xmm1 ), xmm3( xmm1 ), xmm4( xmm1 );
+      __m512 xmm5( xmm1 ), xmm6( xmm1 ), xmm7( xmm1 ), xmm8( xmm1 );
+
+      size_t j( 0UL );
+
+      for( ; j<jpos1; j+=32UL ) {
+         const __m512 x1( _mm512_loadu_ps( x+j     ) );
+         const __m512 x2( _mm512_loadu_ps( x+j+16UL ) );
+         xmm1 = _mm512_fmadd_ps( _mm512_loadu_ps( a1+j     ), x1, xmm1 );
+         xmm2 = _mm512_fmadd_ps( _mm512_loadu_ps( a1+j+16UL ), x2, xmm2 );
+         xmm3 = _mm512_fmadd_ps( _mm512_loadu_ps( a2+j     ), x1, xmm3 );
+         xmm4 = _mm512_fmadd_ps( _mm512_loadu_ps( a2+j+16UL ), x2, xmm4 );
+         xmm5 = _mm512_fmadd_ps( _mm512_loadu_ps( a3+j     ), x1, xmm5 );
+         xmm6 = _mm512_fmadd_ps( _mm512_loadu_ps( a3+j+16UL ), x2, xmm6 );
+         xmm7 = _mm512_fmadd_ps( _mm512_loadu_ps( a4+j     ), x1, xmm7 );
+         xmm8 = _mm512_fmadd_ps( _mm512_loadu_ps( a4+j+16UL ), x2, xmm8 );
+      }
+
+      for( ; j<jpos2; j+=16UL ) {
+         const __m512 x1( _mm512_loadu_ps( x+j ) );
+         xmm1 = _mm512_fmadd_ps( _mm512_loadu_ps( a1+j ), x1, xmm1 );
+         xmm3 = _mm512_fmadd_ps( _mm512_loadu_ps( a2+j ), x1, xmm3 );
+         xmm5 = _mm512_fmadd_ps( _mm512_loadu_ps( a3+j ), x1, xmm5 );
+         xmm7 = _mm512_fmadd_ps( _mm512_loadu_ps( a4+j ), x1, xmm7 );
+      }
+
+      float y1( reduceAVX512( _mm512_add_ps( xmm1, xmm2 ), Add() ) );
+      float y2( reduceAVX512( _mm512_add_ps( xmm3, xmm4 ), Add() ) );
+      float y3( reduceAVX512( _mm512_add_ps( xmm5, xmm6 ), Add() ) );
+      float y4( reduceAVX512( _mm512_add_ps( xmm7, xmm8 ), Add() ) );
+
+      for( ; j<n; ++j ) {
+         y1 += a1[j] * x[j];
+         y2 += a2[j] * x[j];
+         y3 += a3[j] * x[j];
+         y4 += a4[j] * x[j];
+      }
+
+      y[i    ] += alpha * y1;
+      y[i+1UL] += alpha * y2;
+      y[i+2UL] += alpha * y3;
+      y[i+3UL] += alpha * y4;
+   }
+
+   for( ; i<m; ++i )
+   {
+      const float* a1( A + i*lda );
+
+      __m512 xmm1( _mm512_setzero_ps() ), xmm2( xmm1 );
+
+      size_t j( 0UL );
+
+      for( ; j<jpos1; j+=32UL ) {
+         xmm1 = _mm512_fmadd_ps( _mm512_loadu_ps( a1+j     ), _mm512_loadu_ps( x+j     ), xmm1 );
+         xmm2 = _mm512_fmadd_ps( _mm512_loadu_ps( a1+j+16UL ), _mm512_loadu_ps( x+j+16UL ), xmm2 );
+      }
+
+      for( ; j<jpos2; j+=16UL ) {
+         xmm1 = _mm512_fmadd_ps( _mm512_loadu_ps( a1+j ), _mm512_loadu_ps( x+j ), xmm1 );
+      }
+
+      float y1( reduceAVX512( _mm512_add_ps( xmm1, xmm2 ), Add() ) );
+
+      for( ; j<n; ++j ) {
+         y1 += a1[j] * x[j];
+      }
+
+      y[i] += alpha * y1;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL SELECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default fallback for the runtime dispatched dense matrix/dense vector multiplication.
+// \ingroup dense_vector
+//
+// \return \a false.
+//
+// This function is selected for all element types without runtime dispatched kernel.
+*/
+template< typename T >  // Element type
+inline DisableIf_< IsDMVDispatched<T>, bool >
+   dispatchDMV( size_t /*m*/, size_t /*n*/, const T* /*A*/, size_t /*lda*/,
+                const T* /*x*/, T* /*y*/, T /*alpha*/ ) noexcept
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched row-major dense matrix/dense vector multiplication.
+// \ingroup dense_vector
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param A Pointer to the first element of the row-major matrix.
+// \param lda The distance between the first elements of two consecutive rows of the matrix.
+// \param x Pointer to the first element of the vector.
+// \param y Pointer to the first element of the target vector.
+// \param alpha The scaling factor for the matrix/vector product.
+// \return \a true in case the multiplication has been performed, \a false if not.
+//
+// This function computes \f$ \vec{y}+=\alpha*A*\vec{x} \f$ by the AVX-512F or AVX2 kernel in
+// case the according instruction set is active and more powerful than the compile time
+// instruction set (see isDispatched()). In case the function returns \a false, the product
+// has to be computed by the default kernel.
+*/
+template< typename T >  // Element type
+inline EnableIf_< IsDMVDispatched<T>, bool >
+   dispatchDMV( size_t m, size_t n, const T* A, size_t lda, const T* x, T* y, T alpha ) noexcept
+{
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   if( isDispatched( ISA::avx512f ) ) {
+      dmvKernelAVX512( m, n, A, lda, x, y, alpha );
+      return true;
+   }
+   if( isDispatched( ISA::avx2 ) ) {
+      dmvKernelAVX2( m, n, A, lda, x, y, alpha );
+      return true;
+   }
+#endif
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
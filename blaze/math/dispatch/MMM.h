@@ -0,0 +1,505 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/MMM.h
+//  \brief Header file for the runtime dispatched dense matrix multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_MMM_H_
+#define _BLAZE_MATH_DISPATCH_MMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/ISA.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Properties of the runtime dispatched micro-kernels of the packed matrix multiplication.
+// \ingroup dense_matrix
+//
+// In case the runtime dispatch mode is active (see BLAZE_USE_RUNTIME_DISPATCH), the packed dense
+// matrix multiplication for \c float and \c double values is able to switch to AVX2 and AVX-512F
+// micro-kernels at runtime. Since the layout of the packed operands must be independent of the
+// selected micro-kernel, the number of columns of a micro-panel (\a NR) is chosen according to
+// the widest possible instruction set, i.e. two AVX-512 registers. In this case the nested
+// \a value is set to 1, otherwise it is 0.
+*/
+template< typename Type >  // Data type of the matrix elements
+struct MMMDispatch
+{
+   //! Flag for the availability of runtime dispatched micro-kernels.
+   static constexpr bool value = BLAZE_RUNTIME_DISPATCH_MODE &&
+                                 ( IsFloat<Type>::value || IsDouble<Type>::value );
+
+   //! Number of columns of the register block of the runtime dispatched micro-kernels.
+   static constexpr size_t NR = 128UL / sizeof( Type );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Function pointer type of a micro-kernel of the packed dense matrix multiplication.
+// \ingroup dense_matrix
+*/
+template< typename Type >  // Data type of the matrix elements
+using MMMMicroKernel = void (*)( size_t, const Type*, const Type*, Type* );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+//=================================================================================================
+//
+//  AVX2 MICRO-KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2 micro-kernel of the packed dense matrix multiplication for 'double' values.
+// \ingroup dense_matrix
+//
+// \param kc The number of rank-1 updates to perform.
+// \param a Pointer to the packed 6 x \a kc micro-panel of the left-hand side operand.
+// \param b Pointer to the packed \a kc x 16 micro-panel of the right-hand side operand.
+// \param c Pointer to the 6 x 16 result block.
+// \return void
+//
+// The 16 columns of the micro-panel are processed in 2 passes of 8 columns each in order to
+// keep all accumulators in the 16 available SIMD registers.
+*/
+BLAZE_TARGET_AVX2 inline void mmmMicroKernelAVX2( size_t kc, const double* a, const double* b, double* c ) noexcept
+{
+   for( size_t jb=0UL; jb<16UL; jb+=8UL )
+   {
+      __m256d xmm1 ( _mm256_setzero_pd() );
+      __m256d xmm2 ( _mm256_setzero_pd() );
+      __m256d xmm3 ( _mm256_setzero_pd() );
+      __m256d xmm4 ( _mm256_setzero_pd() );
+      __m256d xmm5 ( _mm256_setzero_pd() );
+      __m256d xmm6 ( _mm256_setzero_pd() );
+      __m256d xmm7 ( _mm256_setzero_pd() );
+      __m256d xmm8 ( _mm256_setzero_pd() );
+      __m256d xmm9 ( _mm256_setzero_pd() );
+      __m256d xmm10( _mm256_setzero_pd() );
+      __m256d xmm11( _mm256_setzero_pd() );
+      __m256d xmm12( _mm256_setzero_pd() );
+
+      const double* ap( a );
+      const double* bp( b+jb );
+
+      for( size_t p=0UL; p<kc; ++p )
+      {
+         const __m256d b1( _mm256_loadu_pd( bp    ) );
+         const __m256d b2( _mm256_loadu_pd( bp+4UL ) );
+
+         __m256d a1( _mm256_broadcast_sd( ap     ) );
+         __m256d a2( _mm256_broadcast_sd( ap+1UL ) );
+         xmm1  = _mm256_fmadd_pd( a1, b1, xmm1  );
+         xmm2  = _mm256_fmadd_pd( a1, b2, xmm2  );
+         xmm3  = _mm256_fmadd_pd( a2, b1, xmm3  );
+         xmm4  = _mm256_fmadd_pd( a2, b2, xmm4  );
+
+         a1 = _mm256_broadcast_sd( ap+2UL );
+         a2 = _mm256_broadcast_sd( ap+3UL );
+         xmm5  = _mm256_fmadd_pd( a1, b1, xmm5  );
+         xmm6  = _mm256_fmadd_pd( a1, b2, xmm6  );
+         xmm7  = _mm256_fmadd_pd( a2, b1, xmm7  );
+         xmm8  = _mm256_fmadd_pd( a2, b2, xmm8  );
+
+         a1 = _mm256_broadcast_sd( ap+4UL );
+         a2 = _mm256_broadcast_sd( ap+5UL );
+         xmm9  = _mm256_fmadd_pd( a1, b1, xmm9  );
+         xmm10 = _mm256_fmadd_pd( a1, b2, xmm10 );
+         xmm11 = _mm256_fmadd_pd( a2, b1, xmm11 );
+         xmm12 = _mm256_fmadd_pd( a2, b2, xmm12 );
+
+         ap += 6UL;
+         bp += 16UL;
+      }
+
+      _mm256_storeu_pd( c+jb     , xmm1  );
+      _mm256_storeu_pd( c+jb+4UL , xmm2  );
+      _mm256_storeu_pd( c+jb+16UL, xmm3  );
+      _mm256_storeu_pd( c+jb+20UL, xmm4  );
+      _mm256_storeu_pd( c+jb+32UL, xmm5  );
+      _mm256_storeu_pd( c+jb+36UL, xmm6  );
+      _mm256_storeu_pd( c+jb+48UL, xmm7  );
+      _mm256_storeu_pd( c+jb+52UL, xmm8  );
+      _mm256_storeu_pd( c+jb+64UL, xmm9  );
+      _mm256_storeu_pd( c+jb+68UL, xmm10 );
+      _mm256_storeu_pd( c+jb+80UL, xmm11 );
+      _mm256_storeu_pd( c+jb+84UL, xmm12 );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2 micro-kernel of the packed dense matrix multiplication for 'float' values.
+// \ingroup dense_matrix
+//
+// \param kc The number of rank-1 updates to perform.
+// \param a Pointer to the packed 6 x \a kc micro-panel of the left-hand side operand.
+// \param b Pointer to the packed \a kc x 32 micro-panel of the right-hand side operand.
+// \param c Pointer to the 6 x 32 result block.
+// \return void
+//
+// The 32 columns of the micro-panel are processed in 2 passes of 16 columns each in order to
+// keep all accumulators in the 16 available SIMD registers.
+*/
+BLAZE_TARGET_AVX2 inline void mmmMicroKernelAVX2( size_t kc, const float* a, const float* b, float* c ) noexcept
+{
+   for( size_t jb=0UL; jb<32UL; jb+=16UL )
+   {
+      __m256 xmm1 ( _mm256_setzero_ps() );
+      __m256 xmm2 ( _mm256_setzero_ps() );
+      __m256 xmm3 ( _mm256_setzero_ps() );
+      __m256 xmm4 ( _mm256_setzero_ps() );
+      __m256 xmm5 ( _mm256_setzero_ps() );
+      __m256 xmm6 ( _mm256_setzero_ps() );
+      __m256 xmm7 ( _mm256_setzero_ps() );
+      __m256 xmm8 ( _mm256_setzero_ps() );
+      __m256 xmm9 ( _mm256_setzero_ps() );
+      __m256 xmm10( _mm256_setzero_ps() );
+      __m256 xmm11( _mm256_setzero_ps() );
+      __m256 xmm12( _mm256_setzero_ps() );
+
+      const float* ap( a );
+      const float* bp( b+jb );
+
+      for( size_t p=0UL; p<kc; ++p )
+      {
+         const __m256 b1( _mm256_loadu_ps( bp    ) );
+         const __m256 b2( _mm256_loadu_ps( bp+8UL ) );
+
+         __m256 a1( _mm256_broadcast_ss( ap     ) );
+         __m256 a2( _mm256_broadcast_ss( ap+1UL ) );
+         xmm1  = _mm256_fmadd_ps( a1, b1, xmm1  );
+         xmm2  = _mm256_fmadd_ps( a1, b2, xmm2  );
+         xmm3  = _mm256_fmadd_ps( a2, b1, xmm3  );
+         xmm4  = _mm256_fmadd_ps( a2, b2, xmm4  );
+
+         a1 = _mm256_broadcast_ss( ap+2UL );
+         a2 = _mm256_broadcast_ss( ap+3UL );
+         xmm5  = _mm256_fmadd_ps( a1, b1, xmm5  );
+         xmm6  = _mm256_fmadd_ps( a1, b2, xmm6  );
+         xmm7  = _mm256_fmadd_ps( a2, b1, xmm7  );
+         xmm8  = _mm256_fmadd_ps( a2, b2, xmm8  );
+
+         a1 = _mm256_broadcast_ss( ap+4UL );
+         a2 = _mm256_broadcast_ss( ap+5UL );
+         xmm9  = _mm256_fmadd_ps( a1, b1, xmm9  );
+         xmm10 = _mm256_fmadd_ps( a1, b2, xmm10 );
+         xmm11 = _mm256_fmadd_ps( a2, b1, xmm11 );
+         xmm12 = _mm256_fmadd_ps( a2, b2, xmm12 );
+
+         ap += 6UL;
+         bp += 32UL;
+      }
+
+      _mm256_storeu_ps( c+jb      , xmm1  );
+      _mm256_storeu_ps( c+jb+8UL  , xmm2  );
+      _mm256_storeu_ps( c+jb+32UL , xmm3  );
+      _mm256_storeu_ps( c+jb+40UL , xmm4  );
+      _mm256_storeu_ps( c+jb+64UL , xmm5  );
+      _mm256_storeu_ps( c+jb+72UL , xmm6  );
+      _mm256_storeu_ps( c+jb+96UL , xmm7  );
+      _mm256_storeu_ps( c+jb+104UL, xmm8  );
+      _mm256_storeu_ps( c+jb+128UL, xmm9  );
+      _mm256_storeu_ps( c+jb+136UL, xmm10 );
+      _mm256_storeu_ps( c+jb+160UL, xmm11 );
+      _mm256_storeu_ps( c+jb+168UL, xmm12 );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AVX-512F MICRO-KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512F micro-kernel of the packed dense matrix multiplication for 'double' values.
+// \ingroup dense_matrix
+//
+// \param kc The number of rank-1 updates to perform.
+// \param a Pointer to the packed 6 x \a kc micro-panel of the left-hand side operand.
+// \param b Pointer to the packed \a kc x 16 micro-panel of the right-hand side operand.
+// \param c Pointer to the 6 x 16 result block.
+// \return void
+*/
+BLAZE_TARGET_AVX512F inline void mmmMicroKernelAVX512( size_t kc, const double* a, const double* b, double* c ) noexcept
+{
+   __m512d xmm1 ( _mm512_setzero_pd() );
+   __m512d xmm2 ( _mm512_setzero_pd() );
+   __m512d xmm3 ( _mm512_setzero_pd() );
+   __m512d xmm4 ( _mm512_setzero_pd() );
+   __m512d xmm5 ( _mm512_setzero_pd() );
+   __m512d xmm6 ( _mm512_setzero_pd() );
+   __m512d xmm7 ( _mm512_setzero_pd() );
+   __m512d xmm8 ( _mm512_setzero_pd() );
+   __m512d xmm9 ( _mm512_setzero_pd() );
+   __m512d xmm10( _mm512_setzero_pd() );
+   __m512d xmm11( _mm512_setzero_pd() );
+   __m512d xmm12( _mm512_setzero_pd() );
+
+   const double* ap( a );
+   const double* bp( b );
+
+   for( size_t p=0UL; p<kc; ++p )
+   {
+      const __m512d b1( _mm512_loadu_pd( bp    ) );
+      const __m512d b2( _mm512_loadu_pd( bp+8UL ) );
+
+      __m512d a1( _mm512_set1_pd( ap[0] ) );
+      __m512d a2( _mm512_set1_pd( ap[1] ) );
+      xmm1  = _mm512_fmadd_pd( a1, b1, xmm1  );
+      xmm2  = _mm512_fmadd_pd( a1, b2, xmm2  );
+      xmm3  = _mm512_fmadd_pd( a2, b1, xmm3  );
+      xmm4  = _mm512_fmadd_pd( a2, b2, xmm4  );
+
+      a1 = _mm512_set1_pd( ap[2] );
+      a2 = _mm512_set1_pd( ap[3] );
+      xmm5  = _mm512_fmadd_pd( a1, b1, xmm5  );
+      xmm6  = _mm512_fmadd_pd( a1, b2, xmm6  );
+      xmm7  = _mm512_fmadd_pd( a2, b1, xmm7  );
+      xmm8  = _mm512_fmadd_pd( a2, b2, xmm8  );
+
+      a1 = _mm512_set1_pd( ap[4] );
+      a2 = _mm512_set1_pd( ap[5] );
+      xmm9  = _mm512_fmadd_pd( a1, b1, xmm9  );
+      xmm10 = _mm512_fmadd_pd( a1, b2, xmm10 );
+      xmm11 = _mm512_fmadd_pd( a2, b1, xmm11 );
+      xmm12 = _mm512_fmadd_pd( a2, b2, xmm12 );
+
+      ap += 6UL;
+      bp += 16UL;
+   }
+
+   _mm512_storeu_pd( c     , xmm1  );
+   _mm512_storeu_pd( c+8UL , xmm2  );
+   _mm512_storeu_pd( c+16UL, xmm3  );
+   _mm512_storeu_pd( c+24UL, xmm4  );
+   _mm512_storeu_pd( c+32UL, xmm5  );
+   _mm512_storeu_pd( c+40UL, xmm6  );
+   _mm512_storeu_pd( c+48UL, xmm7  );
+   _mm512_storeu_pd( c+56UL, xmm8  );
+   _mm512_storeu_pd( c+64UL, xmm9  );
+   _mm512_storeu_pd( c+72UL, xmm10 );
+   _mm512_storeu_pd( c+80UL, xmm11 );
+   _mm512_storeu_pd( c+88UL, xmm12 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512F micro-kernel of the packed dense matrix multiplication for 'float' values.
+// \ingroup dense_matrix
+//
+// \param kc The number of rank-1 updates to perform.
+// \param a Pointer to the packed 6 x \a kc micro-panel of the left-hand side operand.
+// \param b Pointer to the packed \a kc x 32 micro-panel of the right-hand side operand.
+// \param c Pointer to the 6 x 32 result block.
+// \return void
+*/
+BLAZE_TARGET_AVX512F inline void mmmMicroKernelAVX512( size_t kc, const float* a, const float* b, float* c ) noexcept
+{
+   __m512 xmm1 ( _mm512_setzero_ps() );
+   __m512 xmm2 ( _mm512_setzero_ps() );
+   __m512 xmm3 ( _mm512_setzero_ps() );
+   __m512 xmm4 ( _mm512_setzero_ps() );
+   __m512 xmm5 ( _mm512_setzero_ps() );
+   __m512 xmm6 ( _mm512_setzero_ps() );
+   __m512 xmm7 ( _mm512_setzero_ps() );
+   __m512 xmm8 ( _mm512_setzero_ps() );
+   __m512 xmm9 ( _mm512_setzero_ps() );
+   __m512 xmm10( _mm512_setzero_ps() );
+   __m512 xmm11( _mm512_setzero_ps() );
+   __m512 xmm12( _mm512_setzero_ps() );
+
+   const float* ap( a );
+   const float* bp( b );
+
+   for( size_t p=0UL; p<kc; ++p )
+   {
+      const __m512 b1( _mm512_loadu_ps( bp    ) );
+      const __m512 b2( _mm512_loadu_ps( bp+16UL ) );
+
+      __m512 a1( _mm512_set1_ps( ap[0] ) );
+      __m512 a2( _mm512_set1_ps( ap[1] ) );
+      xmm1  = _mm512_fmadd_ps( a1, b1, xmm1  );
+      xmm2  = _mm512_fmadd_ps( a1, b2, xmm2  );
+      xmm3  = _mm512_fmadd_ps( a2, b1, xmm3  );
+      xmm4  = _mm512_fmadd_ps( a2, b2, xmm4  );
+
+      a1 = _mm512_set1_ps( ap[2] );
+      a2 = _mm512_set1_ps( ap[3] );
+      xmm5  = _mm512_fmadd_ps( a1, b1, xmm5  );
+      xmm6  = _mm512_fmadd_ps( a1, b2, xmm6  );
+      xmm7  = _mm512_fmadd_ps( a2, b1, xmm7  );
+      xmm8  = _mm512_fmadd_ps( a2, b2, xmm8  );
+
+      a1 = _mm512_set1_ps( ap[4] );
+      a2 = _mm512_set1_ps( ap[5] );
+      xmm9  = _mm512_fmadd_ps( a1, b1, xmm9  );
+      xmm10 = _mm512_fmadd_ps( a1, b2, xmm10 );
+      xmm11 = _mm512_fmadd_ps( a2, b1, xmm11 );
+      xmm12 = _mm512_fmadd_ps( a2, b2, xmm12 );
+
+      ap += 6UL;
+      bp += 32UL;
+   }
+
+   _mm512_storeu_ps( c      , xmm1  );
+   _mm512_storeu_ps( c+16UL , xmm2  );
+   _mm512_storeu_ps( c+32UL , xmm3  );
+   _mm512_storeu_ps( c+48UL , xmm4  );
+   _mm512_storeu_ps( c+64UL , xmm5  );
+   _mm512_storeu_ps( c+80UL , xmm6  );
+   _mm512_storeu_ps( c+96UL , xmm7  );
+   _mm512_storeu_ps( c+112UL, xmm8  );
+   _mm512_storeu_ps( c+128UL, xmm9  );
+   _mm512_storeu_ps( c+144UL, xmm10 );
+   _mm512_storeu_ps( c+160UL, xmm11 );
+   _mm512_storeu_ps( c+176UL, xmm12 );
+}
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL SELECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the micro-kernel of the packed dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param kernel The default micro-kernel, compiled for the compile time instruction set.
+// \return The given default micro-kernel.
+//
+// This function is selected for all data types without runtime dispatched micro-kernels.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline MMMMicroKernel<Type> selectMMMMicroKernel( MMMMicroKernel<Type> kernel ) noexcept
+{
+   return kernel;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the micro-kernel of the packed dense matrix multiplication for 'double'.
+// \ingroup dense_matrix
+//
+// \param kernel The default micro-kernel, compiled for the compile time instruction set.
+// \return The micro-kernel for the active instruction set.
+//
+// This function returns the AVX-512F or AVX2 micro-kernel in case the according instruction set
+// is active and more powerful than the compile time instruction set (see isDispatched()). Else
+// the given default micro-kernel is returned.
+*/
+inline MMMMicroKernel<double> selectMMMMicroKernel( MMMMicroKernel<double> kernel ) noexcept
+{
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   if( isDispatched( ISA::avx512f ) ) return &mmmMicroKernelAVX512;
+   if( isDispatched( ISA::avx2    ) ) return &mmmMicroKernelAVX2;
+#endif
+   return kernel;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the micro-kernel of the packed dense matrix multiplication for 'float'.
+// \ingroup dense_matrix
+//
+// \param kernel The default micro-kernel, compiled for the compile time instruction set.
+// \return The micro-kernel for the active instruction set.
+//
+// This function returns the AVX-512F or AVX2 micro-kernel in case the according instruction set
+// is active and more powerful than the compile time instruction set (see isDispatched()). Else
+// the given default micro-kernel is returned.
+*/
+inline MMMMicroKernel<float> selectMMMMicroKernel( MMMMicroKernel<float> kernel ) noexcept
+{
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   if( isDispatched( ISA::avx512f ) ) return &mmmMicroKernelAVX512;
+   if( isDispatched( ISA::avx2    ) ) return &mmmMicroKernelAVX2;
+#endif
+   return kernel;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,520 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/Reduction.h
+//  \brief Header file for the runtime dispatched dense reduction kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_REDUCTION_H_
+#define _BLAZE_MATH_DISPATCH_REDUCTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Maximum.h>
+#include <blaze/math/functors/Minimum.h>
+#include <blaze/math/simd/ISA.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the runtime dispatched dense reductions.
+// \ingroup dense_vector
+//
+// In case the runtime dispatch mode is active (see BLAZE_USE_RUNTIME_DISPATCH) and a contiguous
+// array of the given element type \a T can be reduced by the given operation \a OP by means of
+// a runtime dispatched kernel, the nested \a value is set to 1, otherwise it is 0. Currently
+// runtime dispatched kernels are available for the summation (Add), the minimum (Minimum) and
+// the maximum (Maximum) of \c float and \c double values.
+*/
+template< typename T     // Element type
+        , typename OP >  // Type of the reduction operation
+struct IsReductionDispatched
+{
+   enum : bool { value = BLAZE_RUNTIME_DISPATCH_MODE &&
+                         ( IsFloat<T>::value || IsDouble<T>::value ) &&
+                         ( IsSame<OP,Add>::value || IsSame<OP,Minimum>::value || IsSame<OP,Maximum>::value ) };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+//=================================================================================================
+//
+//  AVX2 REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\name AVX2 reduction operations */
+//@{
+BLAZE_TARGET_AVX2 inline __m256d reduceAVX2( __m256d a, __m256d b, Add     ) noexcept { return _mm256_add_pd( a, b ); }
+BLAZE_TARGET_AVX2 inline __m256d reduceAVX2( __m256d a, __m256d b, Minimum ) noexcept { return _mm256_min_pd( a, b ); }
+BLAZE_TARGET_AVX2 inline __m256d reduceAVX2( __m256d a, __m256d b, Maximum ) noexcept { return _mm256_max_pd( a, b ); }
+BLAZE_TARGET_AVX2 inline __m256  reduceAVX2( __m256  a, __m256  b, Add     ) noexcept { return _mm256_add_ps( a, b ); }
+BLAZE_TARGET_AVX2 inline __m256  reduceAVX2( __m256  a, __m256  b, Minimum ) noexcept { return _mm256_min_ps( a, b ); }
+BLAZE_TARGET_AVX2 inline __m256  reduceAVX2( __m256  a, __m256  b, Maximum ) noexcept { return _mm256_max_ps( a, b ); }
+//@}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Horizontal reduction of the four 'double' values of an AVX2 vector.
+// \ingroup dense_vector
+//
+// \param a The AVX2 vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the horizontal reduction.
+*/
+template< typename OP >  // Type of the reduction operation
+BLAZE_TARGET_AVX2 inline double reduceAVX2( __m256d a, OP op ) noexcept
+{
+   alignas( 32 ) double v[4];
+   _mm256_store_pd( v, a );
+   return op( op( v[0], v[1] ), op( v[2], v[3] ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Horizontal reduction of the eight 'float' values of an AVX2 vector.
+// \ingroup dense_vector
+//
+// \param a The AVX2 vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the horizontal reduction.
+*/
+template< typename OP >  // Type of the reduction operation
+BLAZE_TARGET_AVX2 inline float reduceAVX2( __m256 a, OP op ) noexcept
+{
+   alignas( 32 ) float v[8];
+   _mm256_store_ps( v, a );
+   return op( op( op( v[0], v[1] ), op( v[2], v[3] ) ), op( op( v[4], v[5] ), op( v[6], v[7] ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2 reduction of a contiguous array of 'double' values.
+// \ingroup dense_vector
+//
+// \param data Pointer to the first element of the array.
+// \param n The number of elements of the array (must be larger than 0).
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// The reduction is performed by means of four independent accumulators, which are initialized
+// with the first four SIMD vectors of the array. Therefore no neutral element is required.
+*/
+template< typename OP >  // Type of the reduction operation
+BLAZE_TARGET_AVX2 inline double reduceAVX2( const double* data, size_t n, OP op ) noexcept
+{
+   const size_t ipos( n & size_t(-4) );
+
+   double redux( data[0] );
+   size_t i( 1UL );
+
+   if( ipos != 0UL )
+   {
+      __m256d xmm1( _mm256_loadu_pd( data ) );
+      i = 4UL;
+
+      if( ipos >= 16UL )
+      {
+         __m256d xmm2( _mm256_loadu_pd( data+ 4UL ) );
+         __m256d xmm3( _mm256_loadu_pd( data+ 8UL ) );
+         __m256d xmm4( _mm256_loadu_pd( data+12UL ) );
+
+         for( i=16UL; (i+16UL) <= ipos; i+=16UL ) {
+            xmm1 = reduceAVX2( xmm1, _mm256_loadu_pd( data+i      ), op );
+            xmm2 = reduceAVX2( xmm2, _mm256_loadu_pd( data+i+ 4UL ), op );
+            xmm3 = reduceAVX2( xmm3, _mm256_loadu_pd( data+i+ 8UL ), op );
+            xmm4 = reduceAVX2( xmm4, _mm256_loadu_pd( data+i+12UL ), op );
+         }
+
+         xmm1 = reduceAVX2( reduceAVX2( xmm1, xmm2, op ), reduceAVX2( xmm3, xmm4, op ), op );
+      }
+
+      for( ; i<ipos; i+=4UL ) {
+         xmm1 = reduceAVX2( xmm1, _mm256_loadu_pd( data+i ), op );
+      }
+
+      redux = reduceAVX2( xmm1, op );
+   }
+
+   for( ; i<n; ++i ) {
+      redux = op( redux, data[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2 reduction of a contiguous array of 'float' values.
+// \ingroup dense_vector
+//
+// \param data Pointer to the first element of the array.
+// \param n The number of elements of the array (must be larger than 0).
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// The reduction is performed by means of four independent accumulators, which are initialized
+// with the first four SIMD vectors of the array. Therefore no neutral element is required.
+*/
+template< typename OP >  // Type of the reduction operation
+BLAZE_TARGET_AVX2 inline float reduceAVX2( const float* data, size_t n, OP op ) noexcept
+{
+   const size_t ipos( n & size_t(-8) );
+
+   float redux( data[0] );
+   size_t i( 1UL );
+
+   if( ipos != 0UL )
+   {
+      __m256 xmm1( _mm256_loadu_ps( data ) );
+      i = 8UL;
+
+      if( ipos >= 32UL )
+      {
+         __m256 xmm2( _mm256_loadu_ps( data+ 8UL ) );
+         __m256 xmm3( _mm256_loadu_ps( data+16UL ) );
+         __m256 xmm4( _mm256_loadu_ps( data+24UL ) );
+
+         for( i=32UL; (i+32UL) <= ipos; i+=32UL ) {
+            xmm1 = reduceAVX2( xmm1, _mm256_loadu_ps( data+i      ), op );
+            xmm2 = reduceAVX2( xmm2, _mm256_loadu_ps( data+i+ 8UL ), op );
+            xmm3 = reduceAVX2( xmm3, _mm256_loadu_ps( data+i+16UL ), op );
+            xmm4 = reduceAVX2( xmm4, _mm256_loadu_ps( data+i+24UL ), op );
+         }
+
+         xmm1 = reduceAVX2( reduceAVX2( xmm1, xmm2, op ), reduceAVX2( xmm3, xmm4, op ), op );
+      }
+
+      for( ; i<ipos; i+=8UL ) {
+         xmm1 = reduceAVX2( xmm1, _mm256_loadu_ps( data+i ), op );
+      }
+
+      redux = reduceAVX2( xmm1, op );
+   }
+
+   for( ; i<n; ++i ) {
+      redux = op( redux, data[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AVX-512F REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\name AVX-512F reduction operations */
+// The masked versions of the minimum and maximum intrinsics are used since several compilers
+// warn about the undefined source operand of the unmasked versions.
+//@{
+BLAZE_TARGET_AVX512F inline __m512d reduceAVX512( __m512d a, __m512d b, Add     ) noexcept { return _mm512_add_pd( a, b ); }
+BLAZE_TARGET_AVX512F inline __m512d reduceAVX512( __m512d a, __m512d b, Minimum ) noexcept { return _mm512_mask_min_pd( a, 0xFF, a, b ); }
+BLAZE_TARGET_AVX512F inline __m512d reduceAVX512( __m512d a, __m512d b, Maximum ) noexcept { return _mm512_mask_max_pd( a, 0xFF, a, b ); }
+BLAZE_TARGET_AVX512F inline __m512  reduceAVX512( __m512  a, __m512  b, Add     ) noexcept { return _mm512_add_ps( a, b ); }
+BLAZE_TARGET_AVX512F inline __m512  reduceAVX512( __m512  a, __m512  b, Minimum ) noexcept { return _mm512_mask_min_ps( a, 0xFFFF, a, b ); }
+BLAZE_TARGET_AVX512F inline __m512  reduceAVX512( __m512  a, __m512  b, Maximum ) noexcept { return _mm512_mask_max_ps( a, 0xFFFF, a, b ); }
+//@}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Horizontal reduction of the eight 'double' values of an AVX-512 vector.
+// \ingroup dense_vector
+//
+// \param a The AVX-512 vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the horizontal reduction.
+*/
+template< typename OP >  // Type of the reduction operation
+BLAZE_TARGET_AVX512F inline double reduceAVX512( __m512d a, OP op ) noexcept
+{
+   alignas( 64 ) double v[8];
+   _mm512_store_pd( v, a );
+   return op( op( op( v[0], v[1] ), op( v[2], v[3] ) ), op( op( v[4], v[5] ), op( v[6], v[7] ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Horizontal reduction of the sixteen 'float' values of an AVX-512 vector.
+// \ingroup dense_vector
+//
+// \param a The AVX-512 vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the horizontal reduction.
+*/
+template< typename OP >  // Type of the reduction operation
+BLAZE_TARGET_AVX512F inline float reduceAVX512( __m512 a, OP op ) noexcept
+{
+   alignas( 64 ) float v[16];
+   _mm512_store_ps( v, a );
+   return op( op( op( op( v[ 0], v[ 1] ), op( v[ 2], v[ 3] ) ), op( op( v[ 4], v[ 5] ), op( v[ 6], v[ 7] ) ) ),
+              op( op( op( v[ 8], v[ 9] ), op( v[10], v[11] ) ), op( op( v[12], v[13] ), op( v[14], v[15] ) ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512F reduction of a contiguous array of 'double' values.
+// \ingroup dense_vector
+//
+// \param data Pointer to the first element of the array.
+// \param n The number of elements of the array (must be larger than 0).
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// The reduction is performed by means of four independent accumulators, which are initialized
+// with the first four SIMD vectors of the array. Therefore no neutral element is required.
+*/
+template< typename OP >  // Type of the reduction operation
+BLAZE_TARGET_AVX512F inline double reduceAVX512( const double* data, size_t n, OP op ) noexcept
+{
+   const size_t ipos( n & size_t(-8) );
+
+   double redux( data[0] );
+   size_t i( 1UL );
+
+   if( ipos != 0UL )
+   {
+      __m512d xmm1( _mm512_loadu_pd( data ) );
+      i = 8UL;
+
+      if( ipos >= 32UL )
+      {
+         __m512d xmm2( _mm512_loadu_pd( data+ 8UL ) );
+         __m512d xmm3( _mm512_loadu_pd( data+16UL ) );
+         __m512d xmm4( _mm512_loadu_pd( data+24UL ) );
+
+         for( i=32UL; (i+32UL) <= ipos; i+=32UL ) {
+            xmm1 = reduceAVX512( xmm1, _mm512_loadu_pd( data+i      ), op );
+            xmm2 = reduceAVX512( xmm2, _mm512_loadu_pd( data+i+ 8UL ), op );
+            xmm3 = reduceAVX512( xmm3, _mm512_loadu_pd( data+i+16UL ), op );
+            xmm4 = reduceAVX512( xmm4, _mm512_loadu_pd( data+i+24UL ), op );
+         }
+
+         xmm1 = reduceAVX512( reduceAVX512( xmm1, xmm2, op ), reduceAVX512( xmm3, xmm4, op ), op );
+      }
+
+      for( ; i<ipos; i+=8UL ) {
+         xmm1 = reduceAVX512( xmm1, _mm512_loadu_pd( data+i ), op );
+      }
+
+      redux = reduceAVX512( xmm1, op );
+   }
+
+   for( ; i<n; ++i ) {
+      redux = op( redux, data[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512F reduction of a contiguous array of 'float' values.
+// \ingroup dense_vector
+//
+// \param data Pointer to the first element of the array.
+// \param n The number of elements of the array (must be larger than 0).
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// The reduction is performed by means of four independent accumulators, which are initialized
+// with the first four SIMD vectors of the array. Therefore no neutral element is required.
+*/
+template< typename OP >  // Type of the reduction operation
+BLAZE_TARGET_AVX512F inline float reduceAVX512( const float* data, size_t n, OP op ) noexcept
+{
+   const size_t ipos( n & size_t(-16) );
+
+   float redux( data[0] );
+   size_t i( 1UL );
+
+   if( ipos != 0UL )
+   {
+      __m512 xmm1( _mm512_loadu_ps( data ) );
+      i = 16UL;
+
+      if( ipos >= 64UL )
+      {
+         __m512 xmm2( _mm512_loadu_ps( data+16UL ) );
+         __m512 xmm3( _mm512_loadu_ps( data+32UL ) );
+         __m512 xmm4( _mm512_loadu_ps( data+48UL ) );
+
+         for( i=64UL; (i+64UL) <= ipos; i+=64UL ) {
+            xmm1 = reduceAVX512( xmm1, _mm512_loadu_ps( data+i      ), op );
+            xmm2 = reduceAVX512( xmm2, _mm512_loadu_ps( data+i+16UL ), op );
+            xmm3 = reduceAVX512( xmm3, _mm512_loadu_ps( data+i+32UL ), op );
+            xmm4 = reduceAVX512( xmm4, _mm512_loadu_ps( data+i+48UL ), op );
+         }
+
+         xmm1 = reduceAVX512( reduceAVX512( xmm1, xmm2, op ), reduceAVX512( xmm3, xmm4, op ), op );
+      }
+
+      for( ; i<ipos; i+=16UL ) {
+         xmm1 = reduceAVX512( xmm1, _mm512_loadu_ps( data+i ), op );
+      }
+
+      redux = reduceAVX512( xmm1, op );
+   }
+
+   for( ; i<n; ++i ) {
+      redux = op( redux, data[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL SELECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default fallback for the runtime dispatched reduction of a contiguous array.
+// \ingroup dense_vector
+//
+// \return \a false.
+//
+// This function is selected for all combinations of element types and reduction operations
+// without runtime dispatched kernel.
+*/
+template< typename T     // Element type
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< IsReductionDispatched<T,OP>, bool >
+   dispatchReduce( const T* /*data*/, size_t /*n*/, OP /*op*/, T& /*redux*/ ) noexcept
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched reduction of a contiguous array.
+// \ingroup dense_vector
+//
+// \param data Pointer to the first element of the array.
+// \param n The number of elements of the array (must be larger than 0).
+// \param op The reduction operation.
+// \param redux The result of the reduction.
+// \return \a true in case the reduction has been performed, \a false if not.
+//
+// This function reduces the given array by the AVX-512F or AVX2 kernel in case the according
+// instruction set is active and more powerful than the compile time instruction set (see
+// isDispatched()). In case the function returns \a false, the reduction has to be performed
+// by the default kernel.
+*/
+template< typename T     // Element type
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< IsReductionDispatched<T,OP>, bool >
+   dispatchReduce( const T* data, size_t n, OP op, T& redux ) noexcept
+{
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   if( isDispatched( ISA::avx512f ) ) {
+      redux = reduceAVX512( data, n, op );
+      return true;
+   }
+   if( isDispatched( ISA::avx2 ) ) {
+      redux = reduceAVX2( data, n, op );
+      return true;
+   }
+#endif
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
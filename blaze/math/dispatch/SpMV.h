@@ -0,0 +1,395 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/SpMV.h
+//  \brief Header file for the runtime dispatched sparse matrix/dense vector multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_SPMV_H_
+#define _BLAZE_MATH_DISPATCH_SPMV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dispatch/Reduction.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/simd/ISA.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the runtime dispatched sparse matrix/dense vector products.
+// \ingroup dense_vector
+//
+// In case the runtime dispatch mode is active (see BLAZE_USE_RUNTIME_DISPATCH) and runtime
+// dispatched gather kernels for the given element type \a T and index type \a IT are available,
+// the nested \a value is set to 1, otherwise it is 0.
+*/
+template< typename T     // Element type
+        , typename IT >  // Index type
+struct IsSpMVDispatched
+{
+   enum : bool { value = BLAZE_RUNTIME_DISPATCH_MODE &&
+                         ( IsFloat<T>::value || IsDouble<T>::value ) &&
+                         IsIntegral<IT>::value && sizeof( IT ) == 4UL };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+//=================================================================================================
+//
+//  AVX2 KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\name AVX2 gather operations */
+//@{
+template< typename IT >  // Type of the 4-byte integral indices
+BLAZE_TARGET_AVX2 inline __m256d gatherAVX2( const double* x, const IT* indices ) noexcept
+{
+   const __m256d zero( _mm256_setzero_pd() );
+   const __m128i idx ( _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices ) ) );
+   return _mm256_mask_i32gather_pd( zero, x, idx, _mm256_cmp_pd( zero, zero, _CMP_EQ_OQ ), 8 );
+}
+
+template< typename IT >  // Type of the 4-byte integral indices
+BLAZE_TARGET_AVX2 inline __m256 gatherAVX2( const float* x, const IT* indices ) noexcept
+{
+   const __m256  zero( _mm256_setzero_ps() );
+   const __m256i idx ( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ) );
+   return _mm256_mask_i32gather_ps( zero, x, idx, _mm256_cmp_ps( zero, zero, _CMP_EQ_OQ ), 4 );
+}
+//@}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2 gather kernel of the sparse matrix/dense vector multiplication for 'double' values.
+// \ingroup dense_vector
+//
+// \param values Pointer to the first non-zero value of a row of the sparse matrix.
+// \param indices Pointer to the first column index of a row of the sparse matrix.
+// \param n The number of non-zero elements of the row.
+// \param x Pointer to the first element of the dense vector.
+// \return The inner product of the row and the dense vector.
+//
+// The elements of the dense vector are collected via gather operations. Since the gather
+// operations interpret the indices as signed 32-bit integers, all indices have to be in the
+// range \f$[0..2^{31}-1]\f$.
+*/
+template< typename IT >  // Type of the 4-byte integral indices
+BLAZE_TARGET_AVX2 inline double spmvKernelAVX2( const double* values, const IT* indices,
+                                                size_t n, const double* x ) noexcept
+{
+   __m256d xmm1( _mm256_setzero_pd() ), xmm2( xmm1 );
+
+   size_t k( 0UL );
+
+   for( ; (k+8UL) <= n; k+=8UL ) {
+      xmm1 = _mm256_fmadd_pd( _mm256_loadu_pd( values+k    ), gatherAVX2( x, indices+k     ), xmm1 );
+      xmm2 = _mm256_fmadd_pd( _mm256_loadu_pd( values+k+4UL ), gatherAVX2( x, indices+k+4UL ), xmm2 );
+   }
+
+   if( k+4UL <= n ) {
+      xmm1 = _mm256_fmadd_pd( _mm256_loadu_pd( values+k ), gatherAVX2( x, indices+k ), xmm1 );
+      k += 4UL;
+   }
+
+   double value( reduceAVX2( _mm256_add_pd( xmm1, xmm2 ), Add() ) );
+
+   for( ; k<n; ++k ) {
+      value += values[k] * x[indices[k]];
+   }
+
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2 gather kernel of the sparse matrix/dense vector multiplication for 'float' values.
+// \ingroup dense_vector
+//
+// \param values Pointer to the first non-zero value of a row of the sparse matrix.
+// \param indices Pointer to the first column index of a row of the sparse matrix.
+// \param n The number of non-zero elements of the row.
+// \param x Pointer to the first element of the dense vector.
+// \return The inner product of the row and the dense vector.
+//
+// The elements of the dense vector are collected via gather operations. Since the gather
+// operations interpret the indices as signed 32-bit integers, all indices have to be in the
+// range \f$[0..2^{31}-1]\f$.
+*/
+template< typename IT >  // Type of the 4-byte integral indices
+BLAZE_TARGET_AVX2 inline float spmvKernelAVX2( const float* values, const IT* indices,
+                                               size_t n, const float* x ) noexcept
+{
+   __m256 xmm1( _mm256_setzero_ps() ), xmm2( xmm1 );
+
+   size_t k( 0UL );
+
+   for( ; (k+16UL) <= n; k+=16UL ) {
+      xmm1 = _mm256_fmadd_ps( _mm256_loadu_ps( values+k    ), gatherAVX2( x, indices+k     ), xmm1 );
+      xmm2 = _mm256_fmadd_ps( _mm256_loadu_ps( values+k+8UL ), gatherAVX2( x, indices+k+8UL ), xmm2 );
+   }
+
+   if( k+8UL <= n ) {
+      xmm1 = _mm256_fmadd_ps( _mm256_loadu_ps( values+k ), gatherAVX2( x, indices+k ), xmm1 );
+      k += 8UL;
+   }
+
+   float value( reduceAVX2( _mm256_add_ps( xmm1, xmm2 ), Add() ) );
+
+   for( ; k<n; ++k ) {
+      value += values[k] * x[indices[k]];
+   }
+
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AVX-512F KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\name AVX-512F gather operations */
+//@{
+template< typename IT >  // Type of the 4-byte integral indices
+BLAZE_TARGET_AVX512F inline __m512d gatherAVX512( const double* x, const IT* indices ) noexcept
+{
+   const __m256i idx( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ) );
+   return _mm512_mask_i32gather_pd( _mm512_setzero_pd(), 0xFF, idx, x, 8 );
+}
+
+template< typename IT >  // Type of the 4-byte integral indices
+BLAZE_TARGET_AVX512F inline __m512 gatherAVX512( const float* x, const IT* indices ) noexcept
+{
+   return _mm512_mask_i32gather_ps( _mm512_setzero_ps(), 0xFFFF, _mm512_loadu_si512( indices ), x, 4 );
+}
+//@}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512F gather kernel of the sparse matrix/dense vector multiplication for 'double' values.
+// \ingroup dense_vector
+//
+// \param values Pointer to the first non-zero value of a row of the sparse matrix.
+// \param indices Pointer to the first column index of a row of the sparse matrix.
+// \param n The number of non-zero elements of the row.
+// \param x Pointer to the first element of the dense vector.
+// \return The inner product of the row and the dense vector.
+//
+// The elements of the dense vector are collected via gather operations. Since the gather
+// operations interpret the indices as signed 32-bit integers, all indices have to be in the
+// range \f$[0..2^{31}-1]\f$.
+*/
+template< typename IT >  // Type of the 4-byte integral indices
+BLAZE_TARGET_AVX512F inline double spmvKernelAVX512( const double* values, const IT* indices,
+                                                     size_t n, const double* x ) noexcept
+{
+   __m512d xmm1( _mm512_setzero_pd() ), xmm2( xmm1 );
+
+   size_t k( 0UL );
+
+   for( ; (k+16UL) <= n; k+=16UL ) {
+      xmm1 = _mm512_fmadd_pd( _mm512_loadu_pd( values+k    ), gatherAVX512( x, indices+k     ), xmm1 );
+      xmm2 = _mm512_fmadd_pd( _mm512_loadu_pd( values+k+8UL ), gatherAVX512( x, indices+k+8UL ), xmm2 );
+   }
+
+   if( k+8UL <= n ) {
+      xmm1 = _mm512_fmadd_pd( _mm512_loadu_pd( values+k ), gatherAVX512( x, indices+k ), xmm1 );
+      k += 8UL;
+   }
+
+   double value( reduceAVX512( _mm512_add_pd( xmm1, xmm2 ), Add() ) );
+
+   for( ; k<n; ++k ) {
+      value += values[k] * x[indices[k]];
+   }
+
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512F gather kernel of the sparse matrix/dense vector multiplication for 'float' values.
+// \ingroup dense_vector
+//
+// \param values Pointer to the first non-zero value of a row of the sparse matrix.
+// \param indices Pointer to the first column index of a row of the sparse matrix.
+// \param n The number of non-zero elements of the row.
+// \param x Pointer to the first element of the dense vector.
+// \return The inner product of the row and the dense vector.
+//
+// The elements of the dense vector are collected via gather operations. Since the gather
+// operations interpret the indices as signed 32-bit integers, all indices have to be in the
+// range \f$[0..2^{31}-1]\f$.
+*/
+template< typename IT >  // Type of the 4-byte integral indices
+BLAZE_TARGET_AVX512F inline float spmvKernelAVX512( const float* values, const IT* indices,
+                                                    size_t n, const float* x ) noexcept
+{
+   __m512 xmm1( _mm512_setzero_ps() ), xmm2( xmm1 );
+
+   size_t k( 0UL );
+
+   for( ; (k+32UL) <= n; k+=32UL ) {
+      xmm1 = _mm512_fmadd_ps( _mm512_loadu_ps( values+k     ), gatherAVX512( x, indices+k      ), xmm1 );
+      xmm2 = _mm512_fmadd_ps( _mm512_loadu_ps( values+k+16UL ), gatherAVX512( x, indices+k+16UL ), xmm2 );
+   }
+
+   if( k+16UL <= n ) {
+      xmm1 = _mm512_fmadd_ps( _mm512_loadu_ps( values+k ), gatherAVX512( x, indices+k ), xmm1 );
+      k += 16UL;
+   }
+
+   float value( reduceAVX512( _mm512_add_ps( xmm1, xmm2 ), Add() ) );
+
+   for( ; k<n; ++k ) {
+      value += values[k] * x[indices[k]];
+   }
+
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL SELECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default fallback for the runtime dispatched sparse matrix/dense vector multiplication.
+// \ingroup dense_vector
+//
+// \return \a false.
+//
+// This function is selected for all element and index types without runtime dispatched kernel.
+*/
+template< typename T     // Element type
+        , typename IT >  // Index type
+inline DisableIf_< IsSpMVDispatched<T,IT>, bool >
+   dispatchSpMV( const T* /*values*/, const IT* /*indices*/, size_t /*n*/,
+                 const T* /*x*/, T& /*value*/ ) noexcept
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched inner product of a sparse matrix row and a dense vector.
+// \ingroup dense_vector
+//
+// \param values Pointer to the first non-zero value of a row of the sparse matrix.
+// \param indices Pointer to the first column index of a row of the sparse matrix.
+// \param n The number of non-zero elements of the row.
+// \param x Pointer to the first element of the dense vector.
+// \param value The resulting inner product.
+// \return \a true in case the inner product has been computed, \a false if not.
+//
+// This function computes the inner product by the AVX-512F or AVX2 gather kernel in case the
+// according instruction set is active and more powerful than the compile time instruction set
+// (see isDispatched()). In case the function returns \a false, the inner product has to be
+// computed by the default kernel. Note that all indices have to be in the range
+// \f$[0..2^{31}-1]\f$.
+*/
+template< typename T     // Element type
+        , typename IT >  // Index type
+inline EnableIf_< IsSpMVDispatched<T,IT>, bool >
+   dispatchSpMV( const T* values, const IT* indices, size_t n, const T* x, T& value ) noexcept
+{
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   if( isDispatched( ISA::avx512f ) ) {
+      value = spmvKernelAVX512( values, indices, n, x );
+      return true;
+   }
+   if( isDispatched( ISA::avx2 ) ) {
+      value = spmvKernelAVX2( values, indices, n, x );
+      return true;
+   }
+#endif
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,864 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DMatChainMultExpr.h
+//  \brief Header file for the dense matrix multiplication chain expression
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DMATCHAINMULTEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DMATCHAINMULTEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/MatMatMultExpr.h>
+#include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatChain.h>
+#include <blaze/math/expressions/MatMatMultExpr.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/traits/ColumnExprTrait.h>
+#include <blaze/math/traits/DMatDVecMultExprTrait.h>
+#include <blaze/math/traits/DMatSVecMultExprTrait.h>
+#include <blaze/math/traits/MultExprTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowExprTrait.h>
+#include <blaze/math/traits/SubmatrixExprTrait.h>
+#include <blaze/math/traits/TDMatDVecMultExprTrait.h>
+#include <blaze/math/traits/TDMatSVecMultExprTrait.h>
+#include <blaze/math/traits/TDVecDMatMultExprTrait.h>
+#include <blaze/math/traits/TDVecTDMatMultExprTrait.h>
+#include <blaze/math/traits/TSVecDMatMultExprTrait.h>
+#include <blaze/math/traits/TSVecTDMatMultExprTrait.h>
+#include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/IsColumnVector.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsRowVector.h>
+#include <blaze/math/typetraits/IsSparseVector.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/InvalidType.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DMATCHAINMULTEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for dense matrix multiplication chains.
+// \ingroup dense_matrix_expression
+//
+// The DMatChainMultExpr class represents the compile time expression for multiplications between
+// two matrices, at least one of which is a matrix/matrix multiplication itself (as for instance
+// \f$ A*B*C \f$), and at least one of which is a dense matrix. Instead of evaluating the chain
+// strictly from left to right, the order of the multiplications is determined at evaluation
+// time based on the dimensions and the number of non-zero elements of all factors (see the
+// MatChain class template). All intermediate results are stored in dense matrices taken from
+// a reusable, thread-local buffer.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO >     // Storage order of the left-hand side matrix
+class DMatChainMultExpr : public DenseMatrix< DMatChainMultExpr<MT1,MT2,SO>, SO >
+                        , private MatMatMultExpr
+                        , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef ResultType_<MT1>  RT1;  //!< Result type of the left-hand side matrix expression.
+   typedef ResultType_<MT2>  RT2;  //!< Result type of the right-hand side matrix expression.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef DMatChainMultExpr<MT1,MT2,SO>  This;           //!< Type of this DMatChainMultExpr instance.
+   typedef MultTrait_<RT1,RT2>            ResultType;     //!< Result type for expression template evaluations.
+   typedef OppositeType_<ResultType>      OppositeType;   //!< Result type with opposite storage order for expression template evaluations.
+   typedef TransposeType_<ResultType>     TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef ElementType_<ResultType>       ElementType;    //!< Resulting element type.
+   typedef const ElementType              ReturnType;     //!< Return type for expression template evaluations.
+   typedef const ResultType               CompositeType;  //!< Data type for composite expression templates.
+
+   //! Composite type of the left-hand side matrix expression.
+   typedef If_< IsExpression<MT1>, const MT1, const MT1& >  LeftOperand;
+
+   //! Composite type of the right-hand side matrix expression.
+   typedef If_< IsExpression<MT2>, const MT2, const MT2& >  RightOperand;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = false };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   //! Type of the intermediate results of the multiplication chain.
+   typedef DynamicMatrix<ElementType,SO>  TmpType;
+
+   //! Evaluator of the multiplication chain.
+   typedef MatChain<This,TmpType>  Chain;
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DMatChainMultExpr class.
+   //
+   // \param lhs The left-hand side operand of the multiplication expression.
+   // \param rhs The right-hand side operand of the multiplication expression.
+   */
+   explicit inline DMatChainMultExpr( const MT1& lhs, const MT2& rhs ) noexcept
+      : lhs_( lhs )  // Left-hand side matrix of the multiplication expression
+      , rhs_( rhs )  // Right-hand side matrix of the multiplication expression
+   {
+      BLAZE_INTERNAL_ASSERT( lhs.columns() == rhs.rows(), "Invalid matrix sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 2D-access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( i < lhs_.rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < rhs_.columns(), "Invalid column access index" );
+
+      return row( lhs_, i ) * column( rhs_, j );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid matrix access index.
+   */
+   inline ReturnType at( size_t i, size_t j ) const {
+      if( i >= lhs_.rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+      }
+      if( j >= rhs_.columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+      }
+      return (*this)(i,j);
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the matrix.
+   //
+   // \return The number of rows of the matrix.
+   */
+   inline size_t rows() const noexcept {
+      return lhs_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the matrix.
+   //
+   // \return The number of columns of the matrix.
+   */
+   inline size_t columns() const noexcept {
+      return rhs_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side matrix operand.
+   //
+   // \return The left-hand side matrix operand.
+   */
+   inline LeftOperand leftOperand() const noexcept {
+      return lhs_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side matrix operand.
+   //
+   // \return The right-hand side matrix operand.
+   */
+   inline RightOperand rightOperand() const noexcept {
+      return rhs_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( lhs_.canAlias( alias ) || rhs_.canAlias( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( lhs_.isAliased( alias ) || rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return ( rows() * columns() >= SMP_DMATDMATMULT_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LeftOperand  lhs_;  //!< Left-hand side matrix of the multiplication expression.
+   RightOperand rhs_;  //!< Right-hand side matrix of the multiplication expression.
+   //**********************************************************************************************
+
+   //**Assignment to dense matrices****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix multiplication chain to a dense matrix
+   //        (\f$ C=A*B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication chain to be assigned.
+   // \return void
+   //
+   // This function implements the assignment of a dense matrix multiplication chain to a dense
+   // matrix. All multiplications are performed in the order of the least estimated costs.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void assign( DenseMatrix<MT,SO2>& lhs, const DMatChainMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ) {
+         return;
+      }
+
+      const Chain chain( rhs );
+      chain.template evaluate<false>( ~lhs, MatChainAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse matrices***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix multiplication chain to a sparse matrix
+   //        (\f$ C=A*B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication chain to be assigned.
+   // \return void
+   //
+   // This function implements the assignment of a dense matrix multiplication chain to a sparse
+   // matrix.
+   */
+   template< typename MT  // Type of the target sparse matrix
+           , bool SO2 >   // Storage order of the target sparse matrix
+   friend inline void assign( SparseMatrix<MT,SO2>& lhs, const DMatChainMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      typedef IfTrue_< SO == SO2, ResultType, OppositeType >  TmpType;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( TmpType );
+      BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT, TmpType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const TmpType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense matrix multiplication chain to a dense matrix
+   //        (\f$ C+=A*B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication chain to be added.
+   // \return void
+   //
+   // This function implements the addition assignment of a dense matrix multiplication chain
+   // to a dense matrix. All multiplications are performed in the order of the least estimated
+   // costs.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void addAssign( DenseMatrix<MT,SO2>& lhs, const DMatChainMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ) {
+         return;
+      }
+
+      const Chain chain( rhs );
+      chain.template evaluate<false>( ~lhs, MatChainAddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse matrices******************************************************
+   // No special implementation for the addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense matrices****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense matrix multiplication chain to a dense matrix
+   //        (\f$ C-=A*B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication chain to be subtracted.
+   // \return void
+   //
+   // This function implements the subtraction assignment of a dense matrix multiplication chain
+   // to a dense matrix. All multiplications are performed in the order of the least estimated
+   // costs.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void subAssign( DenseMatrix<MT,SO2>& lhs, const DMatChainMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ) {
+         return;
+      }
+
+      const Chain chain( rhs );
+      chain.template evaluate<false>( ~lhs, MatChainSubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse matrices***************************************************
+   // No special implementation for the subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense matrices*************************************************
+   // No special implementation for the multiplication assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse matrices************************************************
+   // No special implementation for the multiplication assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense matrices************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense matrix multiplication chain to a dense matrix
+   //        (\f$ C=A*B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication chain to be assigned.
+   // \return void
+   //
+   // This function implements the SMP assignment of a dense matrix multiplication chain to a
+   // dense matrix. All multiplications, including the computation of the intermediate results,
+   // are performed by means of SMP assignments.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void smpAssign( DenseMatrix<MT,SO2>& lhs, const DMatChainMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ) {
+         return;
+      }
+
+      const Chain chain( rhs );
+      chain.template evaluate<true>( ~lhs, MatChainSMPAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse matrices***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense matrix multiplication chain to a sparse matrix
+   //        (\f$ C=A*B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication chain to be assigned.
+   // \return void
+   //
+   // This function implements the SMP assignment of a dense matrix multiplication chain to a
+   // sparse matrix.
+   */
+   template< typename MT  // Type of the target sparse matrix
+           , bool SO2 >   // Storage order of the target sparse matrix
+   friend inline void smpAssign( SparseMatrix<MT,SO2>& lhs, const DMatChainMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      typedef IfTrue_< SO == SO2, ResultType, OppositeType >  TmpType;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( TmpType );
+      BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT, TmpType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const TmpType tmp( rhs );
+      smpAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense matrices***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a dense matrix multiplication chain to a dense matrix
+   //        (\f$ C+=A*B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication chain to be added.
+   // \return void
+   //
+   // This function implements the SMP addition assignment of a dense matrix multiplication
+   // chain to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void smpAddAssign( DenseMatrix<MT,SO2>& lhs, const DMatChainMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ) {
+         return;
+      }
+
+      const Chain chain( rhs );
+      chain.template evaluate<true>( ~lhs, MatChainSMPAddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse matrices**************************************************
+   // No special implementation for the SMP addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense matrices************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a dense matrix multiplication chain to a dense matrix
+   //        (\f$ C-=A*B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication chain to be subtracted.
+   // \return void
+   //
+   // This function implements the SMP subtraction assignment of a dense matrix multiplication
+   // chain to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void smpSubAssign( DenseMatrix<MT,SO2>& lhs, const DMatChainMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ) {
+         return;
+      }
+
+      const Chain chain( rhs );
+      chain.template evaluate<true>( ~lhs, MatChainSMPSubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse matrices***********************************************
+   // No special implementation for the SMP subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to dense matrices*********************************************
+   // No special implementation for the SMP multiplication assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to sparse matrices********************************************
+   // No special implementation for the SMP multiplication assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_FORM_VALID_MATMATMULTEXPR( MT1, MT2 );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for dense matrix multiplication chains (\f$ A=B*C*D \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side matrix for the multiplication.
+// \param rhs The right-hand side matrix for the multiplication.
+// \return The resulting matrix.
+//
+// This operator represents the multiplication of two matrices, at least one of which is a
+// matrix/matrix multiplication and at least one of which is a dense matrix:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C, D;
+   // ... Resizing and initialization
+   D = A * B * C;
+   \endcode
+
+// The operator returns an expression representing a dense matrix of the higher-order element
+// type of the two involved matrix element types \a T1::ElementType and \a T2::ElementType.
+// The order of the multiplications within the chain is not determined by the order of the
+// operators, but at the time of the evaluation based on the dimensions and the number of
+// non-zero elements of all factors.\n
+// In case the current number of columns of \a lhs and the current number of rows of \a rhs
+// don't match, a \a std::invalid_argument is thrown.
+*/
+template< typename T1  // Type of the left-hand side matrix
+        , bool SO1     // Storage order of the left-hand side matrix
+        , typename T2  // Type of the right-hand side matrix
+        , bool SO2 >   // Storage order of the right-hand side matrix
+inline const EnableIf_< And< Or< IsMatMatMultExpr<T1>, IsMatMatMultExpr<T2> >
+                           , Or< IsDenseMatrix<T1>, IsDenseMatrix<T2> > >
+                      , DMatChainMultExpr<T1,T2,SO1> >
+   operator*( const Matrix<T1,SO1>& lhs, const Matrix<T2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   return DMatChainMultExpr<T1,T2,SO1>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct Rows< DMatChainMultExpr<MT1,MT2,SO> > : public Rows<MT1>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct Columns< DMatChainMultExpr<MT1,MT2,SO> > : public Columns<MT2>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, typename VT >
+struct DMatDVecMultExprTrait< DMatChainMultExpr<MT1,MT2,false>, VT >
+{
+ public:
+   //**********************************************************************************************
+   using Type = If_< And< IsDenseVector<VT>, IsColumnVector<VT> >
+                   , MultExprTrait_< MT1, MultExprTrait_<MT2,VT> >
+                   , INVALID_TYPE >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, typename VT >
+struct DMatSVecMultExprTrait< DMatChainMultExpr<MT1,MT2,false>, VT >
+{
+ public:
+   //**********************************************************************************************
+   using Type = If_< And< IsSparseVector<VT>, IsColumnVector<VT> >
+                   , MultExprTrait_< MT1, MultExprTrait_<MT2,VT> >
+                   , INVALID_TYPE >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, typename VT >
+struct TDMatDVecMultExprTrait< DMatChainMultExpr<MT1,MT2,true>, VT >
+{
+ public:
+   //**********************************************************************************************
+   using Type = If_< And< IsDenseVector<VT>, IsColumnVector<VT> >
+                   , MultExprTrait_< MT1, MultExprTrait_<MT2,VT> >
+                   , INVALID_TYPE >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, typename VT >
+struct TDMatSVecMultExprTrait< DMatChainMultExpr<MT1,MT2,true>, VT >
+{
+ public:
+   //**********************************************************************************************
+   using Type = If_< And< IsSparseVector<VT>, IsColumnVector<VT> >
+                   , MultExprTrait_< MT1, MultExprTrait_<MT2,VT> >
+                   , INVALID_TYPE >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, typename MT1, typename MT2 >
+struct TDVecDMatMultExprTrait< VT, DMatChainMultExpr<MT1,MT2,false> >
+{
+ public:
+   //**********************************************************************************************
+   using Type = If_< And< IsDenseVector<VT>, IsRowVector<VT> >
+                   , MultExprTrait_< MultExprTrait_<VT,MT1>, MT2 >
+                   , INVALID_TYPE >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, typename MT1, typename MT2 >
+struct TSVecDMatMultExprTrait< VT, DMatChainMultExpr<MT1,MT2,false> >
+{
+ public:
+   //**********************************************************************************************
+   using Type = If_< And< IsSparseVector<VT>, IsRowVector<VT> >
+                   , MultExprTrait_< MultExprTrait_<VT,MT1>, MT2 >
+                   , INVALID_TYPE >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, typename MT1, typename MT2 >
+struct TDVecTDMatMultExprTrait< VT, DMatChainMultExpr<MT1,MT2,true> >
+{
+ public:
+   //**********************************************************************************************
+   using Type = If_< And< IsDenseVector<VT>, IsRowVector<VT> >
+                   , MultExprTrait_< MultExprTrait_<VT,MT1>, MT2 >
+                   , INVALID_TYPE >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, typename MT1, typename MT2 >
+struct TSVecTDMatMultExprTrait< VT, DMatChainMultExpr<MT1,MT2,true> >
+{
+ public:
+   //**********************************************************************************************
+   using Type = If_< And< IsSparseVector<VT>, IsRowVector<VT> >
+                   , MultExprTrait_< MultExprTrait_<VT,MT1>, MT2 >
+                   , INVALID_TYPE >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO, bool AF >
+struct SubmatrixExprTrait< DMatChainMultExpr<MT1,MT2,SO>, AF >
+{
+ public:
+   //**********************************************************************************************
+   using Type = MultExprTrait_< SubmatrixExprTrait_<const MT1,AF>
+                              , SubmatrixExprTrait_<const MT2,AF> >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct RowExprTrait< DMatChainMultExpr<MT1,MT2,SO> >
+{
+ public:
+   //**********************************************************************************************
+   using Type = MultExprTrait_< RowExprTrait_<const MT1>, MT2 >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct ColumnExprTrait< DMatChainMultExpr<MT1,MT2,SO> >
+{
+ public:
+   //**********************************************************************************************
+   using Type = MultExprTrait_< MT1, ColumnExprTrait_<const MT2> >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
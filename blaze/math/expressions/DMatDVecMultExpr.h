@@ -49,6 +49,10 @@
 #include <blaze/math/constraints/MatVecMultExpr.h>
 #include <blaze/math/constraints/RowMajorMatrix.h>
 #include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/dense/BandKernels.h>
+#include <blaze/math/dense/PackedKernels.h>
+#include <blaze/math/dense/SymmetricKernels.h>
+#include <blaze/math/dispatch/DMV.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -68,16 +72,20 @@
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsBanded.h>
 #include <blaze/math/typetraits/IsBLASCompatible.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsPacked.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
 #include <blaze/math/typetraits/IsTriangular.h>
 #include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/typetraits/RemoveAdaptor.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/math/typetraits/Size.h>
@@ -103,6 +111,7 @@
 #include <blaze/util/typetraits/IsFloat.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
 
 
 namespace blaze {
@@ -202,6 +211,97 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix type and the two involved vector types are suited for a runtime
+       dispatched kernel (see IsDMVDispatched), the nested \a value will be set to 1, otherwise
+       it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseDispatchedKernel {
+      enum : bool { value = useOptimizedKernels &&
+                            HasMutableDataAccess<T1>::value &&
+                            HasConstDataAccess<T2>::value &&
+                            HasConstDataAccess<T3>::value &&
+                            !IsLower<T2>::value && !IsUpper<T2>::value &&
+                            T1::simdEnabled && T2::simdEnabled && T3::simdEnabled &&
+                            IsDMVDispatched< ElementType_<T1> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix operand is stored in packed format (see PackedMatrix) and the two
+       involved vector types are suited for the packed storage kernel, the nested \a value
+       will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UsePackedStorageKernel {
+      enum : bool { value = IsPacked< RemoveAdaptor_<T2> >::value &&
+                            HasMutableDataAccess<T1>::value &&
+                            HasConstDataAccess<T3>::value &&
+                            !IsDiagonal<T2>::value &&
+                            T1::simdEnabled && T3::simdEnabled &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix operand is stored in band format (see BandMatrix) and the target
+       vector provides direct access to its contiguous elements, the nested \a value will be
+       set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseBandKernel {
+      enum : bool { value = IsBanded<T2>::value &&
+                            HasMutableDataAccess<T1>::value &&
+                            T1::simdEnabled &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix operand is a symmetric dense matrix with direct data access (but not
+       stored in packed format) and the two involved vector types are suited for the symmetric
+       kernel (see symv()), the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseSymmetricKernel {
+      enum : bool { value = useOptimizedKernels &&
+                            IsSymmetric<T2>::value &&
+                            !IsPacked< RemoveAdaptor_<T2> >::value &&
+                            !IsDiagonal<T2>::value &&
+                            HasConstDataAccess<T2>::value &&
+                            HasConstDataAccess<T3>::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSymmetricSMPAssign struct is a helper struct for the selection of the parallel
+       evaluation strategy. In case no intermediate evaluation is required and the symmetric
+       kernel can be used, the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseSymmetricSMPAssign {
+      enum : bool { value = !UseSMPAssign<T1>::value &&
+                            UseSymmetricKernel<T1,T2,T3>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DMatDVecMultExpr<MT,VT>     This;           //!< Type of this DMatDVecMultExpr instance.
@@ -442,16 +542,163 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      if( ( IsDiagonal<MT1>::value ) ||
-          ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<VT1,MT1,VT2>::value ) {
+         reset( y );
+         selectPackedStorageKernel( y, A, x, ElementType_<VT1>( 1 ) );
+      }
+      else if( UseBandKernel<VT1,MT1,VT2>::value ) {
+         reset( y );
+         selectBandKernel( y, A, x, ElementType_<VT1>( 1 ) );
+      }
+      else if( ( IsDiagonal<MT1>::value ) ||
+               ( IsComputation<MT>::value && !evaluateMatrix ) ||
+               ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
          selectSmallAssignKernel( y, A, x );
+      else if( UseSymmetricKernel<VT1,MT1,VT2>::value ) {
+         reset( y );
+         selectSymmetricKernel( y, A, x, ElementType_<VT1>( 1 ) );
+      }
       else
          selectBlasAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Default packed storage kernel***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default fallback for the packed storage kernel of the dense matrix-dense vector
+   //        multiplication.
+   // \ingroup dense_vector
+   //
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UsePackedStorageKernel<VT1,MT1,VT2> >
+      selectPackedStorageKernel( VT1& /*y*/, const MT1& /*A*/, const VT2& /*x*/, ST2 /*alpha*/ )
+   {}
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed storage kernel***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed storage kernel for a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=\alpha*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the packed storage kernel (see pmv()), which reads
+   // each stored element of \a A only once, also in case of a symmetric or Hermitian matrix.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UsePackedStorageKernel<VT1,MT1,VT2> >
+      selectPackedStorageKernel( VT1& y, const MT1& A, const VT2& x, ST2 alpha )
+   {
+      pmv( y, A, x, alpha );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default band kernel*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default fallback for the band kernel of the dense matrix-dense vector
+   //        multiplication.
+   // \ingroup dense_vector
+   //
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UseBandKernel<VT1,MT1,VT2> >
+      selectBandKernel( VT1& /*y*/, const MT1& /*A*/, const VT2& /*x*/, ST2 /*alpha*/ )
+   {}
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band kernel*********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Band kernel for a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=\alpha*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side band matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the band kernel (see bmv()), which traverses
+   // the band of the matrix operand diagonal by diagonal by means of SIMD operations.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UseBandKernel<VT1,MT1,VT2> >
+      selectBandKernel( VT1& y, const MT1& A, const VT2& x, ST2 alpha )
+   {
+      bmv( y, A, x, alpha );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default symmetric kernel********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default fallback for the symmetric kernel of the dense matrix-dense vector
+   //        multiplication.
+   // \ingroup dense_vector
+   //
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UseSymmetricKernel<VT1,MT1,VT2> >
+      selectSymmetricKernel( VT1& /*y*/, const MT1& /*A*/, const VT2& /*x*/, ST2 /*alpha*/ )
+   {}
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Symmetric kernel****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Symmetric kernel for a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=\alpha*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side symmetric dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the symmetric kernel (see symv()), which reads
+   // only one triangle of \a A.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UseSymmetricKernel<VT1,MT1,VT2> >
+      selectSymmetricKernel( VT1& y, const MT1& A, const VT2& x, ST2 alpha )
+   {
+      symv( y, A, x, alpha );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors*********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a dense matrix-dense vector multiplication
@@ -734,6 +981,50 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Default dispatch to the runtime dispatched kernels*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default fallback for the runtime dispatched dense matrix-dense vector multiplication.
+   // \ingroup dense_vector
+   //
+   // \return \a false.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< UseDispatchedKernel<VT1,MT1,VT2>, bool >
+      selectDispatchedKernel( VT1& /*y*/, const MT1& /*A*/, const VT2& /*x*/, ElementType_<VT1> /*alpha*/ )
+   {
+      return false;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Dispatch to the runtime dispatched kernels**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=\alpha*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return \a true in case the multiplication has been performed, \a false if not.
+   //
+   // This function relays the dense matrix-dense vector multiplication to the AVX2 or AVX-512F
+   // kernels in case the according instruction set is available at runtime (see dispatchDMV()).
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseDispatchedKernel<VT1,MT1,VT2>, bool >
+      selectDispatchedKernel( VT1& y, const MT1& A, const VT2& x, ElementType_<VT1> alpha )
+   {
+      return dispatchDMV( A.rows(), A.columns(), A.data(), A.spacing(), x.data(), y.data(), alpha );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Vectorized default assignment to dense vectors (large matrices)*****************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Vectorized default assignment of a large dense matrix-dense vector multiplication
@@ -761,6 +1052,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
       reset( y );
 
+      if( selectDispatchedKernel( y, A, x, ElementType_<VT1>( 1 ) ) )
+         return;
+
       size_t i( 0UL );
 
       for( ; (i+8UL) <= M; i+=8UL )
@@ -1125,10 +1419,19 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      if( ( IsDiagonal<MT1>::value ) ||
-          ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<VT1,MT1,VT2>::value ) {
+         selectPackedStorageKernel( y, A, x, ElementType_<VT1>( 1 ) );
+      }
+      else if( UseBandKernel<VT1,MT1,VT2>::value ) {
+         selectBandKernel( y, A, x, ElementType_<VT1>( 1 ) );
+      }
+      else if( ( IsDiagonal<MT1>::value ) ||
+               ( IsComputation<MT>::value && !evaluateMatrix ) ||
+               ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
          selectSmallAddAssignKernel( y, A, x );
+      else if( UseSymmetricKernel<VT1,MT1,VT2>::value ) {
+         selectSymmetricKernel( y, A, x, ElementType_<VT1>( 1 ) );
+      }
       else
          selectBlasAddAssignKernel( y, A, x );
    }
@@ -1442,6 +1745,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
       const bool remainder( !IsPadded<MT1>::value || !IsPadded<VT2>::value );
 
+      if( selectDispatchedKernel( y, A, x, ElementType_<VT1>( 1 ) ) )
+         return;
+
       size_t i( 0UL );
 
       for( ; (i+8UL) <= M; i+=8UL )
@@ -1781,10 +2087,19 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      if( ( IsDiagonal<MT1>::value ) ||
-          ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<VT1,MT1,VT2>::value ) {
+         selectPackedStorageKernel( y, A, x, ElementType_<VT1>( -1 ) );
+      }
+      else if( UseBandKernel<VT1,MT1,VT2>::value ) {
+         selectBandKernel( y, A, x, ElementType_<VT1>( -1 ) );
+      }
+      else if( ( IsDiagonal<MT1>::value ) ||
+               ( IsComputation<MT>::value && !evaluateMatrix ) ||
+               ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
          selectSmallSubAssignKernel( y, A, x );
+      else if( UseSymmetricKernel<VT1,MT1,VT2>::value ) {
+         selectSymmetricKernel( y, A, x, ElementType_<VT1>( -1 ) );
+      }
       else
          selectBlasSubAssignKernel( y, A, x );
    }
@@ -2098,6 +2413,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
       const bool remainder( !IsPadded<MT1>::value || !IsPadded<VT2>::value );
 
+      if( selectDispatchedKernel( y, A, x, ElementType_<VT1>( -1 ) ) )
+         return;
+
       size_t i( 0UL );
 
       for( ; (i+8UL) <= M; i+=8UL )
@@ -2496,6 +2814,39 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to dense vectors (symmetric kernel)******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense matrix-dense vector multiplication with symmetric matrix
+   //        operand to a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // In case the symmetric kernel is selected for the operation, the assignment is not wrapped in a
+   // parallel section since the symmetric kernel distributes the work among the available threads
+   // itself (see smpFused()). Due to the explicit application of the SFINAE principle, this
+   // function can only be selected by the compiler in case the symmetric kernel is applicable.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSymmetricSMPAssign< VT1, RemoveReference_<LT>, RemoveReference_<RT> > >
+      smpAssign( DenseVector<VT1,false>& lhs, const DMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.size() * rhs.size() < DMATDVECMULT_THRESHOLD ) {
+         smpAssign( ~lhs, static_cast<const DenseVector<DMatDVecMultExpr,false>&>( rhs ) );
+      }
+      else {
+         assign( ~lhs, rhs );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse vectors************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a dense matrix-dense vector multiplication to a sparse vector
@@ -2569,6 +2920,40 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP addition assignment to dense vectors (symmetric kernel)*********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a dense matrix-dense vector multiplication with symmetric
+   //        matrix operand to a dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // In case the symmetric kernel is selected for the operation, the addition assignment is not
+   // wrapped in a parallel section since the symmetric kernel distributes the work among the
+   // available threads itself (see smpFused()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the symmetric kernel is
+   // applicable.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSymmetricSMPAssign< VT1, RemoveReference_<LT>, RemoveReference_<RT> > >
+      smpAddAssign( DenseVector<VT1,false>& lhs, const DMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.size() * rhs.size() < DMATDVECMULT_THRESHOLD ) {
+         smpAddAssign( ~lhs, static_cast<const DenseVector<DMatDVecMultExpr,false>&>( rhs ) );
+      }
+      else {
+         addAssign( ~lhs, rhs );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse vectors***************************************************
    // No special implementation for the SMP addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -2613,6 +2998,40 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP subtraction assignment to dense vectors (symmetric kernel)******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a dense matrix-dense vector multiplication with
+   //        symmetric matrix operand from a dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // In case the symmetric kernel is selected for the operation, the subtraction assignment is not
+   // wrapped in a parallel section since the symmetric kernel distributes the work among the
+   // available threads itself (see smpFused()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the symmetric kernel is
+   // applicable.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSymmetricSMPAssign< VT1, RemoveReference_<LT>, RemoveReference_<RT> > >
+      smpSubAssign( DenseVector<VT1,false>& lhs, const DMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.size() * rhs.size() < DMATDVECMULT_THRESHOLD ) {
+         smpSubAssign( ~lhs, static_cast<const DenseVector<DMatDVecMultExpr,false>&>( rhs ) );
+      }
+      else {
+         subAssign( ~lhs, rhs );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to sparse vectors************************************************
    // No special implementation for the SMP subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -2802,6 +3221,71 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix operand is stored in packed format (see PackedMatrix) and the two
+       involved vector types are suited for the packed storage kernel, the nested \a value
+       will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UsePackedStorageKernel {
+      enum : bool { value = IsPacked< RemoveAdaptor_<T2> >::value &&
+                            HasMutableDataAccess<T1>::value &&
+                            HasConstDataAccess<T3>::value &&
+                            !IsDiagonal<T2>::value &&
+                            T1::simdEnabled && T3::simdEnabled &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value &&
+                            !( IsBuiltin< ElementType_<T1> >::value && IsComplex<T4>::value ) };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix operand is stored in band format (see BandMatrix) and the target
+       vector provides direct access to its contiguous elements, the nested \a value will be
+       set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseBandKernel {
+      enum : bool { value = IsBanded<T2>::value &&
+                            HasMutableDataAccess<T1>::value &&
+                            T1::simdEnabled &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value &&
+                            !( IsBuiltin< ElementType_<T1> >::value && IsComplex<T4>::value ) };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix operand is a symmetric dense matrix with direct data access (but not
+       stored in packed format) and the two involved vector types are suited for the symmetric
+       kernel (see symv()), the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseSymmetricKernel {
+      enum : bool { value = useOptimizedKernels &&
+                            IsSymmetric<T2>::value &&
+                            !IsPacked< RemoveAdaptor_<T2> >::value &&
+                            !IsDiagonal<T2>::value &&
+                            HasConstDataAccess<T2>::value &&
+                            HasConstDataAccess<T3>::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value &&
+                            !( IsBuiltin< ElementType_<T1> >::value && IsComplex<T4>::value ) };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSymmetricSMPAssign struct is a helper struct for the selection of the parallel
+       evaluation strategy. In case no intermediate evaluation is required and the symmetric
+       kernel can be used, the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseSymmetricSMPAssign {
+      enum : bool { value = !UseSMPAssign<T1>::value &&
+                            UseSymmetricKernel<T1,T2,T3,T4>::value };
+   };
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DVecScalarMultExpr<MVM,ST,false>  This;           //!< Type of this DVecScalarMultExpr instance.
@@ -3025,15 +3509,150 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      if( ( IsDiagonal<MT1>::value ) ||
-          ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<VT1,MT1,VT2,ST2>::value ) {
+         reset( y );
+         selectPackedStorageKernel( y, A, x, scalar );
+      }
+      else if( UseBandKernel<VT1,MT1,VT2,ST2>::value ) {
+         reset( y );
+         selectBandKernel( y, A, x, scalar );
+      }
+      else if( ( IsDiagonal<MT1>::value ) ||
+               ( IsComputation<MT>::value && !evaluateMatrix ) ||
+               ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
          selectSmallAssignKernel( y, A, x, scalar );
+      else if( UseSymmetricKernel<VT1,MT1,VT2,ST2>::value ) {
+         reset( y );
+         selectSymmetricKernel( y, A, x, scalar );
+      }
       else
          selectBlasAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
 
+   //**Default packed storage kernel***************************************************************
+   /*!\brief Default fallback for the packed storage kernel of the scaled dense matrix-dense vector
+   //        multiplication.
+   // \ingroup dense_vector
+   //
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UsePackedStorageKernel<VT1,MT1,VT2,ST2> >
+      selectPackedStorageKernel( VT1& /*y*/, const MT1& /*A*/, const VT2& /*x*/, ST2 /*alpha*/ )
+   {}
+   //**********************************************************************************************
+
+   //**Packed storage kernel***********************************************************************
+   /*!\brief Packed storage kernel for a scaled dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=\alpha*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the packed storage kernel (see pmv()), which reads
+   // each stored element of \a A only once, also in case of a symmetric or Hermitian matrix.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UsePackedStorageKernel<VT1,MT1,VT2,ST2> >
+      selectPackedStorageKernel( VT1& y, const MT1& A, const VT2& x, ST2 alpha )
+   {
+      pmv( y, A, x, alpha );
+   }
+   //**********************************************************************************************
+
+   //**Default band kernel*************************************************************************
+   /*!\brief Default fallback for the band kernel of the scaled dense matrix-dense vector
+   //        multiplication.
+   // \ingroup dense_vector
+   //
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UseBandKernel<VT1,MT1,VT2,ST2> >
+      selectBandKernel( VT1& /*y*/, const MT1& /*A*/, const VT2& /*x*/, ST2 /*alpha*/ )
+   {}
+   //**********************************************************************************************
+
+   //**Band kernel*********************************************************************************
+   /*!\brief Band kernel for a scaled dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=\alpha*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side band matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the band kernel (see bmv()), which traverses
+   // the band of the matrix operand diagonal by diagonal by means of SIMD operations.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UseBandKernel<VT1,MT1,VT2,ST2> >
+      selectBandKernel( VT1& y, const MT1& A, const VT2& x, ST2 alpha )
+   {
+      bmv( y, A, x, alpha );
+   }
+   //**********************************************************************************************
+
+   //**Default symmetric kernel********************************************************************
+   /*!\brief Default fallback for the symmetric kernel of the scaled dense matrix-dense vector
+   //        multiplication.
+   // \ingroup dense_vector
+   //
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UseSymmetricKernel<VT1,MT1,VT2,ST2> >
+      selectSymmetricKernel( VT1& /*y*/, const MT1& /*A*/, const VT2& /*x*/, ST2 /*alpha*/ )
+   {}
+   //**********************************************************************************************
+
+   //**Symmetric kernel****************************************************************************
+   /*!\brief Symmetric kernel for a scaled dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=\alpha*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side symmetric dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the symmetric kernel (see symv()), which reads
+   // only one triangle of \a A.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UseSymmetricKernel<VT1,MT1,VT2,ST2> >
+      selectSymmetricKernel( VT1& y, const MT1& A, const VT2& x, ST2 alpha )
+   {
+      symv( y, A, x, alpha );
+   }
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors*********************************************************
    /*!\brief Default assignment of a scaled dense matrix-dense vector multiplication
    //        (\f$ \vec{y}=s*A*\vec{x} \f$).
@@ -3727,10 +4346,19 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      if( ( IsDiagonal<MT1>::value ) ||
-          ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<VT1,MT1,VT2,ST2>::value ) {
+         selectPackedStorageKernel( y, A, x, scalar );
+      }
+      else if( UseBandKernel<VT1,MT1,VT2,ST2>::value ) {
+         selectBandKernel( y, A, x, scalar );
+      }
+      else if( ( IsDiagonal<MT1>::value ) ||
+               ( IsComputation<MT>::value && !evaluateMatrix ) ||
+               ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
          selectSmallAddAssignKernel( y, A, x, scalar );
+      else if( UseSymmetricKernel<VT1,MT1,VT2,ST2>::value ) {
+         selectSymmetricKernel( y, A, x, scalar );
+      }
       else
          selectBlasAddAssignKernel( y, A, x, scalar );
    }
@@ -4384,10 +5012,19 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      if( ( IsDiagonal<MT1>::value ) ||
-          ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<VT1,MT1,VT2,ST2>::value ) {
+         selectPackedStorageKernel( y, A, x, -scalar );
+      }
+      else if( UseBandKernel<VT1,MT1,VT2,ST2>::value ) {
+         selectBandKernel( y, A, x, -scalar );
+      }
+      else if( ( IsDiagonal<MT1>::value ) ||
+               ( IsComputation<MT>::value && !evaluateMatrix ) ||
+               ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
          selectSmallSubAssignKernel( y, A, x, scalar );
+      else if( UseSymmetricKernel<VT1,MT1,VT2,ST2>::value ) {
+         selectSymmetricKernel( y, A, x, -scalar );
+      }
       else
          selectBlasSubAssignKernel( y, A, x, scalar );
    }
@@ -5095,6 +5732,37 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    }
    //**********************************************************************************************
 
+   //**SMP assignment to dense vectors (symmetric kernel)******************************************
+   /*!\brief SMP assignment of a scaled dense matrix-dense vector multiplication with symmetric
+   //        matrix operand to a dense vector (\f$ \vec{y}=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side scaled multiplication expression to be assigned.
+   // \return void
+   //
+   // In case the symmetric kernel is selected for the operation, the assignment is not wrapped in a
+   // parallel section since the symmetric kernel distributes the work among the available threads
+   // itself (see smpFused()). Due to the explicit application of the SFINAE principle, this
+   // function can only be selected by the compiler in case the symmetric kernel is applicable.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSymmetricSMPAssign< VT1, RemoveReference_<LT>, RemoveReference_<RT>, ST > >
+      smpAssign( DenseVector<VT1,false>& lhs, const DVecScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.size() * rhs.size() < DMATDVECMULT_THRESHOLD ) {
+         smpAssign( ~lhs, static_cast<const DenseVector<DVecScalarMultExpr,false>&>( rhs ) );
+      }
+      else {
+         assign( ~lhs, rhs );
+      }
+   }
+   //**********************************************************************************************
+
    //**SMP assignment to sparse vectors************************************************************
    /*!\brief SMP assignment of a scaled dense matrix-dense vector multiplication to a sparse vector
    //        (\f$ \vec{y}=s*A*\vec{x} \f$).
@@ -5167,6 +5835,38 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    }
    //**********************************************************************************************
 
+   //**SMP addition assignment to dense vectors (symmetric kernel)*********************************
+   /*!\brief SMP addition assignment of a scaled dense matrix-dense vector multiplication with
+   //        symmetric matrix operand to a dense vector (\f$ \vec{y}+=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side scaled multiplication expression to be added.
+   // \return void
+   //
+   // In case the symmetric kernel is selected for the operation, the addition assignment is not
+   // wrapped in a parallel section since the symmetric kernel distributes the work among the
+   // available threads itself (see smpFused()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the symmetric kernel is
+   // applicable.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSymmetricSMPAssign< VT1, RemoveReference_<LT>, RemoveReference_<RT>, ST > >
+      smpAddAssign( DenseVector<VT1,false>& lhs, const DVecScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.size() * rhs.size() < DMATDVECMULT_THRESHOLD ) {
+         smpAddAssign( ~lhs, static_cast<const DenseVector<DVecScalarMultExpr,false>&>( rhs ) );
+      }
+      else {
+         addAssign( ~lhs, rhs );
+      }
+   }
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse vectors***************************************************
    // No special implementation for the SMP addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -5212,6 +5912,38 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    }
    //**********************************************************************************************
 
+   //**SMP subtraction assignment to dense vectors (symmetric kernel)******************************
+   /*!\brief SMP subtraction assignment of a scaled dense matrix-dense vector multiplication with
+   //        symmetric matrix operand from a dense vector (\f$ \vec{y}-=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side scaled multiplication expression to be subtracted.
+   // \return void
+   //
+   // In case the symmetric kernel is selected for the operation, the subtraction assignment is not
+   // wrapped in a parallel section since the symmetric kernel distributes the work among the
+   // available threads itself (see smpFused()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the symmetric kernel is
+   // applicable.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSymmetricSMPAssign< VT1, RemoveReference_<LT>, RemoveReference_<RT>, ST > >
+      smpSubAssign( DenseVector<VT1,false>& lhs, const DVecScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.size() * rhs.size() < DMATDVECMULT_THRESHOLD ) {
+         smpSubAssign( ~lhs, static_cast<const DenseVector<DVecScalarMultExpr,false>&>( rhs ) );
+      }
+      else {
+         subAssign( ~lhs, rhs );
+      }
+   }
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to sparse vectors************************************************
    // No special implementation for the SMP subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -47,6 +47,7 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/MutableDataAccess.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/dense/Factorization.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/getrf.h>
@@ -55,6 +56,7 @@
 #include <blaze/math/typetraits/IsTriangular.h>
 #include <blaze/math/typetraits/IsUniTriangular.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Types.h>
 
@@ -76,6 +78,29 @@ inline ElementType_<MT> det( const DenseMatrix<MT,SO>& dm );
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the computation of the determinant of a \f$ 2 \times 2 \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param A The given \f$ 2 \times 2 \f$ matrix.
+// \return The determinant of the given matrix.
+//
+// This function computes the determinant of the given \f$ 2 \times 2 \f$ matrix via the rule
+// of Sarrus. Since the function only relies on the function call operator of the matrix and on
+// the arithmetic operators of the element type \a ET, it is also used to compute the determinants
+// of several matrices at once (see the StaticMatrixBatch class).
+*/
+template< typename ET    // Element type of the matrix
+        , typename MT >  // Type of the matrix
+inline ET det2x2_backend( const MT& A )
+{
+   return A(0,0)*A(1,1) - A(0,1)*A(1,0);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Computation of the determinant of the given dense \f$ 2 \times 2 \f$ matrix.
@@ -96,7 +121,32 @@ inline ElementType_<MT> det2x2( const DenseMatrix<MT,SO>& dm )
 
    CompositeType_<MT> A( ~dm );
 
-   return A(0,0)*A(1,1) - A(0,1)*A(1,0);
+   return det2x2_backend< ElementType_<MT> >( A );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the computation of the determinant of a \f$ 3 \times 3 \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param A The given \f$ 3 \times 3 \f$ matrix.
+// \return The determinant of the given matrix.
+//
+// This function computes the determinant of the given \f$ 3 \times 3 \f$ matrix via the rule
+// of Sarrus. Since the function only relies on the function call operator of the matrix and on
+// the arithmetic operators of the element type \a ET, it is also used to compute the determinants
+// of several matrices at once (see the StaticMatrixBatch class).
+*/
+template< typename ET    // Element type of the matrix
+        , typename MT >  // Type of the matrix
+inline ET det3x3_backend( const MT& A )
+{
+   return A(0,0) * ( A(1,1)*A(2,2) - A(1,2)*A(2,1) ) +
+          A(0,1) * ( A(1,2)*A(2,0) - A(1,0)*A(2,2) ) +
+          A(0,2) * ( A(1,0)*A(2,1) - A(1,1)*A(2,0) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -122,9 +172,7 @@ inline ElementType_<MT> det3x3( const DenseMatrix<MT,SO>& dm )
 
    CompositeType_<MT> A( ~dm );
 
-   return A(0,0) * ( A(1,1)*A(2,2) - A(1,2)*A(2,1) ) +
-          A(0,1) * ( A(1,2)*A(2,0) - A(1,0)*A(2,2) ) +
-          A(0,2) * ( A(1,0)*A(2,1) - A(1,1)*A(2,0) );
+   return det3x3_backend< ElementType_<MT> >( A );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -132,26 +180,21 @@ inline ElementType_<MT> det3x3( const DenseMatrix<MT,SO>& dm )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Computation of the determinant of the given dense \f$ 4 \times 4 \f$ matrix.
+/*!\brief Backend of the computation of the determinant of a \f$ 4 \times 4 \f$ matrix.
 // \ingroup dense_matrix
 //
-// \param dm The given dense matrix.
+// \param A The given \f$ 4 \times 4 \f$ matrix.
 // \return The determinant of the given matrix.
 //
-// This function computes the determinant of the given dense \f$ 4 \times 4 \f$ matrix via the
-// rule of Sarrus.
+// This function computes the determinant of the given \f$ 4 \times 4 \f$ matrix via the rule
+// of Sarrus. Since the function only relies on the function call operator of the matrix and on
+// the arithmetic operators of the element type \a ET, it is also used to compute the determinants
+// of several matrices at once (see the StaticMatrixBatch class).
 */
-template< typename MT  // Type of the dense matrix
-        , bool SO >    // Storage order of the dense matrix
-inline ElementType_<MT> det4x4( const DenseMatrix<MT,SO>& dm )
+template< typename ET    // Element type of the matrix
+        , typename MT >  // Type of the matrix
+inline ET det4x4_backend( const MT& A )
 {
-   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == 4UL, "Invalid number of rows detected"    );
-   BLAZE_INTERNAL_ASSERT( (~dm).columns() == 4UL, "Invalid number of columns detected" );
-
-   typedef ElementType_<MT>  ET;
-
-   CompositeType_<MT> A( ~dm );
-
    const ET tmp1( A(2,2)*A(3,3) - A(2,3)*A(3,2) );
    const ET tmp2( A(2,1)*A(3,3) - A(2,3)*A(3,1) );
    const ET tmp3( A(2,1)*A(3,2) - A(2,2)*A(3,1) );
@@ -170,26 +213,47 @@ inline ElementType_<MT> det4x4( const DenseMatrix<MT,SO>& dm )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Computation of the determinant of the given dense \f$ 5 \times 5 \f$ matrix.
+/*!\brief Computation of the determinant of the given dense \f$ 4 \times 4 \f$ matrix.
 // \ingroup dense_matrix
 //
 // \param dm The given dense matrix.
 // \return The determinant of the given matrix.
 //
-// This function computes the determinant of the given dense \f$ 5 \times 5 \f$ matrix via the
+// This function computes the determinant of the given dense \f$ 4 \times 4 \f$ matrix via the
 // rule of Sarrus.
 */
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order of the dense matrix
-inline ElementType_<MT> det5x5( const DenseMatrix<MT,SO>& dm )
+inline ElementType_<MT> det4x4( const DenseMatrix<MT,SO>& dm )
 {
-   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == 5UL, "Invalid number of rows detected"    );
-   BLAZE_INTERNAL_ASSERT( (~dm).columns() == 5UL, "Invalid number of columns detected" );
-
-   typedef ElementType_<MT>  ET;
+   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == 4UL, "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() == 4UL, "Invalid number of columns detected" );
 
    CompositeType_<MT> A( ~dm );
 
+   return det4x4_backend< ElementType_<MT> >( A );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the computation of the determinant of a \f$ 5 \times 5 \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param A The given \f$ 5 \times 5 \f$ matrix.
+// \return The determinant of the given matrix.
+//
+// This function computes the determinant of the given \f$ 5 \times 5 \f$ matrix via the rule
+// of Sarrus. Since the function only relies on the function call operator of the matrix and on
+// the arithmetic operators of the element type \a ET, it is also used to compute the determinants
+// of several matrices at once (see the StaticMatrixBatch class).
+*/
+template< typename ET    // Element type of the matrix
+        , typename MT >  // Type of the matrix
+inline ET det5x5_backend( const MT& A )
+{
    const ET tmp1 ( A(3,3)*A(4,4) - A(3,4)*A(4,3) );
    const ET tmp2 ( A(3,2)*A(4,4) - A(3,4)*A(4,2) );
    const ET tmp3 ( A(3,2)*A(4,3) - A(3,3)*A(4,2) );
@@ -224,26 +288,47 @@ inline ElementType_<MT> det5x5( const DenseMatrix<MT,SO>& dm )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Computation of the determinant of the given dense \f$ 6 \times 6 \f$ matrix.
+/*!\brief Computation of the determinant of the given dense \f$ 5 \times 5 \f$ matrix.
 // \ingroup dense_matrix
 //
 // \param dm The given dense matrix.
 // \return The determinant of the given matrix.
 //
-// This function computes the determinant of the given dense \f$ 6 \times 6 \f$ matrix via the
+// This function computes the determinant of the given dense \f$ 5 \times 5 \f$ matrix via the
 // rule of Sarrus.
 */
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order of the dense matrix
-inline ElementType_<MT> det6x6( const DenseMatrix<MT,SO>& dm )
+inline ElementType_<MT> det5x5( const DenseMatrix<MT,SO>& dm )
 {
-   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == 6UL, "Invalid number of rows detected"    );
-   BLAZE_INTERNAL_ASSERT( (~dm).columns() == 6UL, "Invalid number of columns detected" );
-
-   typedef ElementType_<MT>  ET;
+   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == 5UL, "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() == 5UL, "Invalid number of columns detected" );
 
    CompositeType_<MT> A( ~dm );
 
+   return det5x5_backend< ElementType_<MT> >( A );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the computation of the determinant of a \f$ 6 \times 6 \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param A The given \f$ 6 \times 6 \f$ matrix.
+// \return The determinant of the given matrix.
+//
+// This function computes the determinant of the given \f$ 6 \times 6 \f$ matrix via the rule
+// of Sarrus. Since the function only relies on the function call operator of the matrix and on
+// the arithmetic operators of the element type \a ET, it is also used to compute the determinants
+// of several matrices at once (see the StaticMatrixBatch class).
+*/
+template< typename ET    // Element type of the matrix
+        , typename MT >  // Type of the matrix
+inline ET det6x6_backend( const MT& A )
+{
    const ET tmp1 ( A(4,4)*A(5,5) - A(4,5)*A(5,4) );
    const ET tmp2 ( A(4,3)*A(5,5) - A(4,5)*A(5,3) );
    const ET tmp3 ( A(4,3)*A(5,4) - A(4,4)*A(5,3) );
@@ -308,6 +393,32 @@ inline ElementType_<MT> det6x6( const DenseMatrix<MT,SO>& dm )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinant of the given dense \f$ 6 \times 6 \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The determinant of the given matrix.
+//
+// This function computes the determinant of the given dense \f$ 6 \times 6 \f$ matrix via the
+// rule of Sarrus.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline ElementType_<MT> det6x6( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_INTERNAL_ASSERT( (~dm).rows()    == 6UL, "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() == 6UL, "Invalid number of columns detected" );
+
+   CompositeType_<MT> A( ~dm );
+
+   return det6x6_backend< ElementType_<MT> >( A );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Computation of the determinant of the given dense square matrix.
@@ -336,17 +447,22 @@ ElementType_<MT> detNxN( const DenseMatrix<MT,SO>& dm )
 
    URT A( ~dm );
 
-   int n   ( boost::numeric_cast<int>( A.rows()      ) );
-   int lda ( boost::numeric_cast<int>( A.spacing() ) );
-   int info( 0 );
+   int n( boost::numeric_cast<int>( A.rows() ) );
 
    const std::unique_ptr<int[]> ipiv( new int[n] );
 
+#if BLAZE_BLAS_MODE
+   int lda ( boost::numeric_cast<int>( A.spacing() ) );
+   int info( 0 );
+
    getrf( n, n, A.data(), lda, ipiv.get(), &info );
 
    if( info > 0 ) {
       return ET(0);
    }
+#else
+   blockedGetrf( A, ipiv.get() );
+#endif
 
    ET determinant = ET(1);
 
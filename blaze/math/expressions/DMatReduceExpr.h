@@ -0,0 +1,2479 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DMatReduceExpr.h
+//  \brief Header file for the dense matrix reduction functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DMATREDUCEEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DMATREDUCEEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/ColumnVector.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/RowVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatReduceExpr.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Maximum.h>
+#include <blaze/math/functors/Minimum.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixExprTrait.h>
+#include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/math/typetraits/Size.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the dense matrix reduction operation.
+// \ingroup dense_matrix
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+struct DMatReduceExprHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the dense matrix expression.
+   typedef RemoveReference_< CompositeType_<MT> >  CT;
+
+   //! Element type of the dense matrix expression.
+   typedef ElementType_<CT>  ET;
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+   //**SIMD support detection**********************************************************************
+   //! Helper structure for the detection of the SIMD type returned by the dense matrix expression.
+   struct UseSIMDLoad {
+      enum : bool { value = IsSame< SIMDTrait_<ET>, Decay_< decltype( std::declval<CT>().load( 0UL, 0UL ) ) > >::value };
+   };
+
+   //! Helper structure for the detection of the SIMD capabilities of the reduction operation.
+   struct UseSIMDEnabledFlag {
+      enum : bool { value = OP::BLAZE_TEMPLATE simdEnabled<ET,ET>() };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum : bool { value = useOptimizedKernels &&
+                         If_< BoolConstant<CT::simdEnabled>, UseSIMDLoad, FalseType >::value &&
+                         IsSame< ET, ElementType_<MT> >::value &&
+                         If_< HasSIMDEnabled<OP>, UseSIMDEnabledFlag, HasLoad<OP> >::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the partial reduction operations of dense matrices.
+// \ingroup dense_matrix
+//
+// This helper struct determines whether the row-wise or column-wise reduction of a dense matrix
+// of type \a MT into a dense vector of type \a VT can be performed by means of SIMD operations.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+struct DMatPartialReduceExprHelper
+{
+   //**********************************************************************************************
+   enum : bool { value = DMatReduceExprHelper<MT,OP>::value &&
+                         VT::simdEnabled &&
+                         IsSame< ElementType_<VT>, ElementType_<MT> >::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE DMATREDUCEEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Base template for row-wise and column-wise reduction operations of dense matrices.
+// \ingroup dense_vector_expression
+//
+// The DMatReduceExpr class template represents the compile time expression for partial
+// reduction operations of dense matrices. The reduction flag \a RF selects between row-wise
+// (blaze::rowwise) and column-wise (blaze::columnwise) reductions. Only these two reduction
+// flags are supported by means of specializations.
+*/
+template< typename MT  // Type of the dense matrix
+        , typename OP  // Type of the reduction operation
+        , size_t RF >  // Reduction flag
+class DMatReduceExpr;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR COLUMN-WISE REDUCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for column-wise dense matrix reduction operations.
+// \ingroup dense_vector_expression
+//
+// This specialization of the DMatReduceExpr class template represents the compile time
+// expression for column-wise reduction operations of dense matrices. The result of the reduction
+// is a row vector of size \a N, which contains the reductions of the \a N columns of
+// the \f$ M \times N \f$ dense matrix.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+class DMatReduceExpr<MT,OP,columnwise>
+   : public DenseVector< DMatReduceExpr<MT,OP,columnwise>, true >
+   , private MatReduceExpr
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef ResultType_<MT>     RT;  //!< Result type of the dense matrix expression.
+   typedef CompositeType_<MT>  CT;  //!< Composite type of the dense matrix expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the dense matrix expression.
+   enum : bool { evaluateMatrix = RequiresEvaluation<MT>::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSMPAssign struct is a helper struct for the selection of the parallel evaluation
+       strategy. In case the dense matrix operand requires an intermediate evaluation, the
+       nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename VT >
+   struct UseSMPAssign {
+      enum : bool { value = evaluateMatrix };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef DMatReduceExpr<MT,OP,columnwise>  This;           //!< Type of this DMatReduceExpr instance.
+   typedef RowTrait_<RT>                     ResultType;     //!< Result type for expression template evaluations.
+   typedef TransposeType_<ResultType>        TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef ElementType_<ResultType>          ElementType;    //!< Resulting element type.
+   typedef const ElementType                 ReturnType;     //!< Return type for expression template evaluations.
+   typedef const ResultType                  CompositeType;  //!< Data type for composite expression templates.
+
+   //! Composite type of the dense matrix expression.
+   typedef If_< IsExpression<MT>, const MT, const MT& >  Operand;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = false };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = !evaluateMatrix && MT::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DMatReduceExpr class.
+   //
+   // \param dm The dense matrix operand of the reduction expression.
+   // \param op The reduction operation.
+   */
+   explicit inline DMatReduceExpr( const MT& dm, OP op ) noexcept
+      : dm_( dm )  // Dense matrix of the reduction expression
+      , op_( op )  // The reduction operation
+   {}
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Subscript operator for the direct access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator[]( size_t index ) const {
+      BLAZE_INTERNAL_ASSERT( index < dm_.columns(), "Invalid vector access index" );
+      return dvecreduce( column( dm_, index ), op_ );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid vector access index.
+   */
+   inline ReturnType at( size_t index ) const {
+      if( index >= dm_.columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+      }
+      return (*this)[index];
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current size/dimension of the vector.
+   //
+   // \return The size of the vector.
+   */
+   inline size_t size() const noexcept {
+      return dm_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the dense matrix operand.
+   //
+   // \return The dense matrix operand.
+   */
+   inline Operand operand() const noexcept {
+      return dm_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the reduction operation.
+   //
+   // \return A copy of the reduction operation.
+   */
+   inline OP operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an aliasing effect is possible, \a false if not.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( dm_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the given alias is contained in this expression, \a false if not.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( dm_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return dm_.isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return dm_.canSMPAssign() ||
+             ( dm_.rows() * dm_.columns() >= SMP_DMATREDUCE_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand dm_;  //!< Dense matrix of the reduction expression.
+   OP      op_;  //!< The reduction operation.
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a column-wise dense matrix reduction operation to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a column-wise dense matrix
+   // reduction expression to a dense vector. The traversal order is chosen based on the storage
+   // order of the dense matrix operand such that the matrix elements are always accessed
+   // contiguously.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void assign( DenseVector<VT1,true>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.dm_.columns() == 0UL ) {
+         return;
+      }
+      else if( rhs.dm_.rows() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      CT A( serial( rhs.dm_ ) );  // Evaluation of the dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.dm_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.dm_.columns(), "Invalid number of columns" );
+
+      dmatcolumnreduce( ~lhs, A, rhs.op_ );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse vectors****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a column-wise dense matrix reduction operation to a sparse vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a column-wise dense matrix
+   // reduction expression to a sparse vector.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline void assign( SparseVector<VT1,true>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a column-wise dense matrix reduction operation to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a column-wise
+   // dense matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void addAssign( DenseVector<VT1,true>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      addAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse vectors*******************************************************
+   // No special implementation for the addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a column-wise dense matrix reduction operation to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a column-wise
+   // dense matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void subAssign( DenseVector<VT1,true>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      subAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse vectors****************************************************
+   // No special implementation for the subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplication assignment of a column-wise dense matrix reduction operation to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized multiplication assignment of a column-wise
+   // dense matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void multAssign( DenseVector<VT1,true>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      multAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse vectors*************************************************
+   // No special implementation for the multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Division assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Division assignment of a column-wise dense matrix reduction operation to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized division assignment of a column-wise
+   // dense matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void divAssign( DenseVector<VT1,true>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      divAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Division assignment to sparse vectors*******************************************************
+   // No special implementation for the division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a column-wise dense matrix reduction operation to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a column-wise dense
+   // matrix reduction expression to a dense vector. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpAssign( DenseVector<VT1,true>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.dm_.columns() == 0UL ) {
+         return;
+      }
+      else if( rhs.dm_.rows() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      const RT tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
+      smpAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse vectors************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a column-wise dense matrix reduction operation to a sparse vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a column-wise dense
+   // matrix reduction expression to a sparse vector. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpAssign( SparseVector<VT1,true>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a column-wise dense matrix reduction operation to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a
+   // column-wise dense matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpAddAssign( DenseVector<VT1,true>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse vectors***************************************************
+   // No special implementation for the SMP addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a column-wise dense matrix reduction operation to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a
+   // column-wise dense matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpSubAssign( DenseVector<VT1,true>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse vectors************************************************
+   // No special implementation for the SMP subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP multiplication assignment of a column-wise dense matrix reduction operation to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized SMP multiplication assignment of a
+   // column-wise dense matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpMultAssign( DenseVector<VT1,true>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpMultAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to sparse vectors*********************************************
+   // No special implementation for the SMP multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP division assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP division assignment of a column-wise dense matrix reduction operation to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized SMP division assignment of a
+   // column-wise dense matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpDivAssign( DenseVector<VT1,true>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpDivAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP division assignment to sparse vectors***************************************************
+   // No special implementation for the SMP division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR ROW-WISE REDUCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for row-wise dense matrix reduction operations.
+// \ingroup dense_vector_expression
+//
+// This specialization of the DMatReduceExpr class template represents the compile time
+// expression for row-wise reduction operations of dense matrices. The result of the reduction
+// is a column vector of size \a M, which contains the reductions of the \a M rows of
+// the \f$ M \times N \f$ dense matrix.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+class DMatReduceExpr<MT,OP,rowwise>
+   : public DenseVector< DMatReduceExpr<MT,OP,rowwise>, false >
+   , private MatReduceExpr
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef ResultType_<MT>     RT;  //!< Result type of the dense matrix expression.
+   typedef CompositeType_<MT>  CT;  //!< Composite type of the dense matrix expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the dense matrix expression.
+   enum : bool { evaluateMatrix = RequiresEvaluation<MT>::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSMPAssign struct is a helper struct for the selection of the parallel evaluation
+       strategy. In case the dense matrix operand requires an intermediate evaluation, the
+       nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename VT >
+   struct UseSMPAssign {
+      enum : bool { value = evaluateMatrix };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef DMatReduceExpr<MT,OP,rowwise>  This;           //!< Type of this DMatReduceExpr instance.
+   typedef ColumnTrait_<RT>               ResultType;     //!< Result type for expression template evaluations.
+   typedef TransposeType_<ResultType>     TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef ElementType_<ResultType>       ElementType;    //!< Resulting element type.
+   typedef const ElementType              ReturnType;     //!< Return type for expression template evaluations.
+   typedef const ResultType               CompositeType;  //!< Data type for composite expression templates.
+
+   //! Composite type of the dense matrix expression.
+   typedef If_< IsExpression<MT>, const MT, const MT& >  Operand;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = false };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = !evaluateMatrix && MT::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DMatReduceExpr class.
+   //
+   // \param dm The dense matrix operand of the reduction expression.
+   // \param op The reduction operation.
+   */
+   explicit inline DMatReduceExpr( const MT& dm, OP op ) noexcept
+      : dm_( dm )  // Dense matrix of the reduction expression
+      , op_( op )  // The reduction operation
+   {}
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Subscript operator for the direct access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..M-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator[]( size_t index ) const {
+      BLAZE_INTERNAL_ASSERT( index < dm_.rows(), "Invalid vector access index" );
+      return dvecreduce( row( dm_, index ), op_ );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..M-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid vector access index.
+   */
+   inline ReturnType at( size_t index ) const {
+      if( index >= dm_.rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+      }
+      return (*this)[index];
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current size/dimension of the vector.
+   //
+   // \return The size of the vector.
+   */
+   inline size_t size() const noexcept {
+      return dm_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the dense matrix operand.
+   //
+   // \return The dense matrix operand.
+   */
+   inline Operand operand() const noexcept {
+      return dm_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the reduction operation.
+   //
+   // \return A copy of the reduction operation.
+   */
+   inline OP operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an aliasing effect is possible, \a false if not.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( dm_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the given alias is contained in this expression, \a false if not.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( dm_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return dm_.isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return dm_.canSMPAssign() ||
+             ( dm_.rows() * dm_.columns() >= SMP_DMATREDUCE_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand dm_;  //!< Dense matrix of the reduction expression.
+   OP      op_;  //!< The reduction operation.
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a row-wise dense matrix reduction operation to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a row-wise dense matrix
+   // reduction expression to a dense vector. The traversal order is chosen based on the storage
+   // order of the dense matrix operand such that the matrix elements are always accessed
+   // contiguously.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void assign( DenseVector<VT1,false>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.dm_.rows() == 0UL ) {
+         return;
+      }
+      else if( rhs.dm_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      CT A( serial( rhs.dm_ ) );  // Evaluation of the dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.dm_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.dm_.columns(), "Invalid number of columns" );
+
+      dmatrowreduce( ~lhs, A, rhs.op_ );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse vectors****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a row-wise dense matrix reduction operation to a sparse vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a row-wise dense matrix
+   // reduction expression to a sparse vector.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline void assign( SparseVector<VT1,false>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a row-wise dense matrix reduction operation to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a row-wise
+   // dense matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void addAssign( DenseVector<VT1,false>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      addAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse vectors*******************************************************
+   // No special implementation for the addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a row-wise dense matrix reduction operation to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a row-wise
+   // dense matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void subAssign( DenseVector<VT1,false>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      subAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse vectors****************************************************
+   // No special implementation for the subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplication assignment of a row-wise dense matrix reduction operation to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized multiplication assignment of a row-wise
+   // dense matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void multAssign( DenseVector<VT1,false>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      multAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse vectors*************************************************
+   // No special implementation for the multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Division assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Division assignment of a row-wise dense matrix reduction operation to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized division assignment of a row-wise
+   // dense matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void divAssign( DenseVector<VT1,false>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      divAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Division assignment to sparse vectors*******************************************************
+   // No special implementation for the division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a row-wise dense matrix reduction operation to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a row-wise dense
+   // matrix reduction expression to a dense vector. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpAssign( DenseVector<VT1,false>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.dm_.rows() == 0UL ) {
+         return;
+      }
+      else if( rhs.dm_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      const RT tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
+      smpAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse vectors************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a row-wise dense matrix reduction operation to a sparse vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a row-wise dense
+   // matrix reduction expression to a sparse vector. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpAssign( SparseVector<VT1,false>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a row-wise dense matrix reduction operation to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a
+   // row-wise dense matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpAddAssign( DenseVector<VT1,false>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse vectors***************************************************
+   // No special implementation for the SMP addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a row-wise dense matrix reduction operation to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a
+   // row-wise dense matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpSubAssign( DenseVector<VT1,false>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse vectors************************************************
+   // No special implementation for the SMP subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP multiplication assignment of a row-wise dense matrix reduction operation to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized SMP multiplication assignment of a
+   // row-wise dense matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpMultAssign( DenseVector<VT1,false>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpMultAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to sparse vectors*********************************************
+   // No special implementation for the SMP multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP division assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP division assignment of a row-wise dense matrix reduction operation to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized SMP division assignment of a
+   // row-wise dense matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpDivAssign( DenseVector<VT1,false>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpDivAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP division assignment to sparse vectors***************************************************
+   // No special implementation for the SMP division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the reduction of a row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given row-major dense matrix.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the serial reduction of the given row-major dense matrix for all
+// element types and reduction operations that do not support a SIMD optimized evaluation. Each
+// row is reduced separately, four elements at a time, before the partial result is combined
+// with the result of the previous rows.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< DMatReduceExprHelper<MT,OP>, ElementType_<MT> >
+   dmatreduce( const DenseMatrix<MT,rowMajor>& dm, OP op )
+{
+   typedef ElementType_<MT>    ET;
+   typedef CompositeType_<MT>  CT;
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return ET();
+
+   CT tmp( ~dm );
+
+   BLAZE_INTERNAL_ASSERT( tmp.rows()    == M, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( tmp.columns() == N, "Invalid number of columns" );
+
+   ET redux{};
+
+   for( size_t i=0UL; i<M; ++i )
+   {
+      ET redux2( tmp(i,0UL) );
+      size_t j( 1UL );
+
+      for( ; (j+4UL) <= N; j+=4UL ) {
+         redux2 = op( redux2, op( op( tmp(i,j    ), tmp(i,j+1UL) ),
+                                  op( tmp(i,j+2UL), tmp(i,j+3UL) ) ) );
+      }
+      for( ; (j+2UL) <= N; j+=2UL ) {
+         redux2 = op( redux2, op( tmp(i,j), tmp(i,j+1UL) ) );
+      }
+      for( ; j<N; ++j ) {
+         redux2 = op( redux2, tmp(i,j) );
+      }
+
+      if( i == 0UL )
+         redux = redux2;
+      else
+         redux = op( redux, redux2 );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the reduction of a row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given row-major dense matrix.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the serial, SIMD optimized reduction of the given row-major dense
+// matrix. Each row is reduced by means of four independent SIMD accumulators, which are
+// initialized with the first SIMD vectors of the row. The resulting SIMD vectors of all rows
+// are combined element-wise and reduced horizontally only once at the very end. The remaining
+// elements of all rows that don't fill an entire SIMD vector are reduced separately.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DMatReduceExprHelper<MT,OP>, ElementType_<MT> >
+   dmatreduce( const DenseMatrix<MT,rowMajor>& dm, OP op )
+{
+   typedef ElementType_<MT>    ET;
+   typedef CompositeType_<MT>  CT;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return ET();
+
+   CT tmp( ~dm );
+
+   BLAZE_INTERNAL_ASSERT( tmp.rows()    == M, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( tmp.columns() == N, "Invalid number of columns" );
+
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   SIMDTrait_<ET> xmm;
+   ET redux{};
+
+   for( size_t i=0UL; i<M; ++i )
+   {
+      size_t j( 0UL );
+
+      if( jpos != 0UL )
+      {
+         SIMDTrait_<ET> xmm1( tmp.load(i,0UL) );
+         j = SIMDSIZE;
+
+         if( jpos >= SIMDSIZE*4UL )
+         {
+            SIMDTrait_<ET> xmm2( tmp.load(i,SIMDSIZE    ) );
+            SIMDTrait_<ET> xmm3( tmp.load(i,SIMDSIZE*2UL) );
+            SIMDTrait_<ET> xmm4( tmp.load(i,SIMDSIZE*3UL) );
+
+            for( j=SIMDSIZE*4UL; (j+SIMDSIZE*4UL) <= jpos; j+=SIMDSIZE*4UL ) {
+               xmm1 = op.load( xmm1, tmp.load(i,j             ) );
+               xmm2 = op.load( xmm2, tmp.load(i,j+SIMDSIZE    ) );
+               xmm3 = op.load( xmm3, tmp.load(i,j+SIMDSIZE*2UL) );
+               xmm4 = op.load( xmm4, tmp.load(i,j+SIMDSIZE*3UL) );
+            }
+
+            xmm1 = op.load( op.load( xmm1, xmm2 ), op.load( xmm3, xmm4 ) );
+         }
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            xmm1 = op.load( xmm1, tmp.load(i,j) );
+         }
+
+         if( i == 0UL )
+            xmm = xmm1;
+         else
+            xmm = op.load( xmm, xmm1 );
+      }
+
+      if( j < N )
+      {
+         ET redux2( tmp(i,j) );
+
+         for( ++j; j<N; ++j ) {
+            redux2 = op( redux2, tmp(i,j) );
+         }
+
+         if( i == 0UL )
+            redux = redux2;
+         else
+            redux = op( redux, redux2 );
+      }
+   }
+
+   if( jpos == 0UL )
+      return redux;
+   else if( jpos == N )
+      return simdReduce( xmm, op );
+   else
+      return op( simdReduce( xmm, op ), redux );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the reduction of a column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given column-major dense matrix.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the serial reduction of the given column-major dense matrix for
+// all element types and reduction operations that do not support a SIMD optimized evaluation.
+// Each column is reduced separately, four elements at a time, before the partial result is
+// combined with the result of the previous columns.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< DMatReduceExprHelper<MT,OP>, ElementType_<MT> >
+   dmatreduce( const DenseMatrix<MT,columnMajor>& dm, OP op )
+{
+   typedef ElementType_<MT>    ET;
+   typedef CompositeType_<MT>  CT;
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return ET();
+
+   CT tmp( ~dm );
+
+   BLAZE_INTERNAL_ASSERT( tmp.rows()    == M, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( tmp.columns() == N, "Invalid number of columns" );
+
+   ET redux{};
+
+   for( size_t j=0UL; j<N; ++j )
+   {
+      ET redux2( tmp(0UL,j) );
+      size_t i( 1UL );
+
+      for( ; (i+4UL) <= M; i+=4UL ) {
+         redux2 = op( redux2, op( op( tmp(i    ,j), tmp(i+1UL,j) ),
+                                  op( tmp(i+2UL,j), tmp(i+3UL,j) ) ) );
+      }
+      for( ; (i+2UL) <= M; i+=2UL ) {
+         redux2 = op( redux2, op( tmp(i,j), tmp(i+1UL,j) ) );
+      }
+      for( ; i<M; ++i ) {
+         redux2 = op( redux2, tmp(i,j) );
+      }
+
+      if( j == 0UL )
+         redux = redux2;
+      else
+         redux = op( redux, redux2 );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the reduction of a column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given column-major dense matrix.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the serial, SIMD optimized reduction of the given column-major dense
+// matrix. Each column is reduced by means of four independent SIMD accumulators, which are
+// initialized with the first SIMD vectors of the column. The resulting SIMD vectors of all
+// columns are combined element-wise and reduced horizontally only once at the very end. The
+// remaining elements of all columns that don't fill an entire SIMD vector are reduced
+// separately.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DMatReduceExprHelper<MT,OP>, ElementType_<MT> >
+   dmatreduce( const DenseMatrix<MT,columnMajor>& dm, OP op )
+{
+   typedef ElementType_<MT>    ET;
+   typedef CompositeType_<MT>  CT;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return ET();
+
+   CT tmp( ~dm );
+
+   BLAZE_INTERNAL_ASSERT( tmp.rows()    == M, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( tmp.columns() == N, "Invalid number of columns" );
+
+   const size_t ipos( M & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( M - ( M % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   SIMDTrait_<ET> xmm;
+   ET redux{};
+
+   for( size_t j=0UL; j<N; ++j )
+   {
+      size_t i( 0UL );
+
+      if( ipos != 0UL )
+      {
+         SIMDTrait_<ET> xmm1( tmp.load(0UL,j) );
+         i = SIMDSIZE;
+
+         if( ipos >= SIMDSIZE*4UL )
+         {
+            SIMDTrait_<ET> xmm2( tmp.load(SIMDSIZE    ,j) );
+            SIMDTrait_<ET> xmm3( tmp.load(SIMDSIZE*2UL,j) );
+            SIMDTrait_<ET> xmm4( tmp.load(SIMDSIZE*3UL,j) );
+
+            for( i=SIMDSIZE*4UL; (i+SIMDSIZE*4UL) <= ipos; i+=SIMDSIZE*4UL ) {
+               xmm1 = op.load( xmm1, tmp.load(i             ,j) );
+               xmm2 = op.load( xmm2, tmp.load(i+SIMDSIZE    ,j) );
+               xmm3 = op.load( xmm3, tmp.load(i+SIMDSIZE*2UL,j) );
+               xmm4 = op.load( xmm4, tmp.load(i+SIMDSIZE*3UL,j) );
+            }
+
+            xmm1 = op.load( op.load( xmm1, xmm2 ), op.load( xmm3, xmm4 ) );
+         }
+
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            xmm1 = op.load( xmm1, tmp.load(i,j) );
+         }
+
+         if( j == 0UL )
+            xmm = xmm1;
+         else
+            xmm = op.load( xmm, xmm1 );
+      }
+
+      if( i < M )
+      {
+         ET redux2( tmp(i,j) );
+
+         for( ++i; i<M; ++i ) {
+            redux2 = op( redux2, tmp(i,j) );
+         }
+
+         if( j == 0UL )
+            redux = redux2;
+         else
+            redux = op( redux, redux2 );
+      }
+   }
+
+   if( ipos == 0UL )
+      return redux;
+   else if( ipos == M )
+      return simdReduce( xmm, op );
+   else
+      return op( simdReduce( xmm, op ), redux );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the column-wise reduction of a row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param lhs The target row vector.
+// \param dm The given row-major dense matrix.
+// \param op The reduction operation.
+// \return void
+//
+// This function implements the serial column-wise reduction of the given row-major dense matrix
+// for all element types and reduction operations that do not support a SIMD optimized
+// evaluation. In order to access the matrix elements contiguously, the target vector is used
+// as accumulator and the rows of the matrix are combined with it one after another. The matrix
+// is required to have at least one row.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< DMatPartialReduceExprHelper<VT,MT,OP> >
+   dmatcolumnreduce( DenseVector<VT,true>& lhs, const DenseMatrix<MT,rowMajor>& dm, OP op )
+{
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   BLAZE_INTERNAL_ASSERT( M > 0UL, "Invalid number of rows" );
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == N, "Invalid vector size" );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      (~lhs)[j] = (~dm)(0UL,j);
+   }
+
+   for( size_t i=1UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         (~lhs)[j] = op( (~lhs)[j], (~dm)(i,j) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the column-wise reduction of a row-major
+//        dense matrix.
+// \ingroup dense_matrix
+//
+// \param lhs The target row vector.
+// \param dm The given row-major dense matrix.
+// \param op The reduction operation.
+// \return void
+//
+// This function implements the serial, SIMD optimized column-wise reduction of the given
+// row-major dense matrix. Instead of traversing the matrix column by column, entire SIMD
+// vectors of four consecutive rows are combined and accumulated into the target vector. In
+// order to keep the accumulated part of the target vector in cache, the columns are processed
+// in blocks. The remaining columns that don't fill an entire SIMD vector are reduced
+// separately. The matrix is required to have at least one row.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DMatPartialReduceExprHelper<VT,MT,OP> >
+   dmatcolumnreduce( DenseVector<VT,true>& lhs, const DenseMatrix<MT,rowMajor>& dm, OP op )
+{
+   typedef ElementType_<MT>  ET;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+   enum : size_t { BLOCKSIZE = SIMDSIZE * 128UL };
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   BLAZE_INTERNAL_ASSERT( M > 0UL, "Invalid number of rows" );
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == N, "Invalid vector size" );
+
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t jj=0UL; jj<jpos; jj+=BLOCKSIZE )
+   {
+      const size_t jend( min( jj+BLOCKSIZE, jpos ) );
+
+      for( size_t j=jj; j<jend; j+=SIMDSIZE ) {
+         (~lhs).store( j, (~dm).load(0UL,j) );
+      }
+
+      size_t i( 1UL );
+
+      for( ; (i+4UL) <= M; i+=4UL ) {
+         for( size_t j=jj; j<jend; j+=SIMDSIZE ) {
+            const SIMDTrait_<ET> xmm1( op.load( (~dm).load(i    ,j), (~dm).load(i+1UL,j) ) );
+            const SIMDTrait_<ET> xmm2( op.load( (~dm).load(i+2UL,j), (~dm).load(i+3UL,j) ) );
+            (~lhs).store( j, op.load( (~lhs).load(j), op.load( xmm1, xmm2 ) ) );
+         }
+      }
+
+      for( ; i<M; ++i ) {
+         for( size_t j=jj; j<jend; j+=SIMDSIZE ) {
+            (~lhs).store( j, op.load( (~lhs).load(j), (~dm).load(i,j) ) );
+         }
+      }
+   }
+
+   if( jpos < N )
+   {
+      for( size_t j=jpos; j<N; ++j ) {
+         (~lhs)[j] = (~dm)(0UL,j);
+      }
+
+      for( size_t i=1UL; i<M; ++i ) {
+         for( size_t j=jpos; j<N; ++j ) {
+            (~lhs)[j] = op( (~lhs)[j], (~dm)(i,j) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the column-wise reduction of a column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param lhs The target row vector.
+// \param dm The given column-major dense matrix.
+// \param op The reduction operation.
+// \return void
+//
+// This function implements the serial column-wise reduction of the given column-major dense
+// matrix. Since the columns of the matrix are stored contiguously, each column is reduced
+// separately by means of the (SIMD optimized) dense vector reduction kernel.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline void dmatcolumnreduce( DenseVector<VT,true>& lhs, const DenseMatrix<MT,columnMajor>& dm, OP op )
+{
+   const size_t N( (~dm).columns() );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == N, "Invalid vector size" );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      (~lhs)[j] = dvecreduce( column( ~dm, j ), op );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the row-wise reduction of a row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param lhs The target column vector.
+// \param dm The given row-major dense matrix.
+// \param op The reduction operation.
+// \return void
+//
+// This function implements the serial row-wise reduction of the given row-major dense matrix.
+// Since the rows of the matrix are stored contiguously, each row is reduced separately by means
+// of the (SIMD optimized) dense vector reduction kernel.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline void dmatrowreduce( DenseVector<VT,false>& lhs, const DenseMatrix<MT,rowMajor>& dm, OP op )
+{
+   const size_t M( (~dm).rows() );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == M, "Invalid vector size" );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      (~lhs)[i] = dvecreduce( row( ~dm, i ), op );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the row-wise reduction of a column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param lhs The target column vector.
+// \param dm The given column-major dense matrix.
+// \param op The reduction operation.
+// \return void
+//
+// This function implements the serial row-wise reduction of the given column-major dense matrix
+// for all element types and reduction operations that do not support a SIMD optimized
+// evaluation. In order to access the matrix elements contiguously, the target vector is used
+// as accumulator and the columns of the matrix are combined with it one after another. The
+// matrix is required to have at least one column.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< DMatPartialReduceExprHelper<VT,MT,OP> >
+   dmatrowreduce( DenseVector<VT,false>& lhs, const DenseMatrix<MT,columnMajor>& dm, OP op )
+{
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   BLAZE_INTERNAL_ASSERT( N > 0UL, "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == M, "Invalid vector size" );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      (~lhs)[i] = (~dm)(i,0UL);
+   }
+
+   for( size_t j=1UL; j<N; ++j ) {
+      for( size_t i=0UL; i<M; ++i ) {
+         (~lhs)[i] = op( (~lhs)[i], (~dm)(i,j) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the row-wise reduction of a column-major
+//        dense matrix.
+// \ingroup dense_matrix
+//
+// \param lhs The target column vector.
+// \param dm The given column-major dense matrix.
+// \param op The reduction operation.
+// \return void
+//
+// This function implements the serial, SIMD optimized row-wise reduction of the given
+// column-major dense matrix. Instead of traversing the matrix row by row, entire SIMD vectors
+// of four consecutive columns are combined and accumulated into the target vector. In order to
+// keep the accumulated part of the target vector in cache, the rows are processed in blocks.
+// The remaining rows that don't fill an entire SIMD vector are reduced separately. The matrix
+// is required to have at least one column.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DMatPartialReduceExprHelper<VT,MT,OP> >
+   dmatrowreduce( DenseVector<VT,false>& lhs, const DenseMatrix<MT,columnMajor>& dm, OP op )
+{
+   typedef ElementType_<MT>  ET;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+   enum : size_t { BLOCKSIZE = SIMDSIZE * 128UL };
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   BLAZE_INTERNAL_ASSERT( N > 0UL, "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == M, "Invalid vector size" );
+
+   const size_t ipos( M & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( M - ( M % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t ii=0UL; ii<ipos; ii+=BLOCKSIZE )
+   {
+      const size_t iend( min( ii+BLOCKSIZE, ipos ) );
+
+      for( size_t i=ii; i<iend; i+=SIMDSIZE ) {
+         (~lhs).store( i, (~dm).load(i,0UL) );
+      }
+
+      size_t j( 1UL );
+
+      for( ; (j+4UL) <= N; j+=4UL ) {
+         for( size_t i=ii; i<iend; i+=SIMDSIZE ) {
+            const SIMDTrait_<ET> xmm1( op.load( (~dm).load(i,j    ), (~dm).load(i,j+1UL) ) );
+            const SIMDTrait_<ET> xmm2( op.load( (~dm).load(i,j+2UL), (~dm).load(i,j+3UL) ) );
+            (~lhs).store( i, op.load( (~lhs).load(i), op.load( xmm1, xmm2 ) ) );
+         }
+      }
+
+      for( ; j<N; ++j ) {
+         for( size_t i=ii; i<iend; i+=SIMDSIZE ) {
+            (~lhs).store( i, op.load( (~lhs).load(i), (~dm).load(i,j) ) );
+         }
+      }
+   }
+
+   if( ipos < M )
+   {
+      for( size_t i=ipos; i<M; ++i ) {
+         (~lhs)[i] = (~dm)(i,0UL);
+      }
+
+      for( size_t j=1UL; j<N; ++j ) {
+         for( size_t i=ipos; i<M; ++i ) {
+            (~lhs)[i] = op( (~lhs)[i], (~dm)(i,j) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a custom reduction operation on the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense matrix \a dm by means of the given reduction operation
+// \a op:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   // ... Resizing and initialization
+
+   const double totalsum1 = reduce( A, blaze::Add() );
+   const double totalsum2 = reduce( A, []( double a, double b ){ return a + b; } );
+   \endcode
+
+// As demonstrated in the example it is possible to pass any binary callable as custom reduction
+// operation. However, for instance in the case of lambdas the vectorization of the reduction
+// operation is compiler dependent and might not perform at peak performance. However, it is
+// also possible to create vectorized custom operations. See \ref custom_operations for a
+// detailed overview of the possibilities of custom operations.
+//
+// Please note that the evaluation order of the reduction operation is unspecified. Thus the
+// behavior is non-deterministic if \a op is not associative or not commutative. Also, the
+// operation is undefined if the given reduction operation modifies the values. In case the
+// given matrix has either 0 rows or 0 columns, the function returns the default value of the
+// element type (e.g. 0 in case of fundamental data types). Dense matrices with a number of
+// elements larger or equal to the blaze::SMP_DMATREDUCE_THRESHOLD are reduced in parallel
+// (see \ref shared_memory_parallelization).
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline ElementType_<MT> reduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return smpReduce( ~dm, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense matrix by means of addition.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \return The sum of all matrix elements.
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, 2 }, { 3, 4 } };
+
+   const int totalsum = sum( A );  // Results in 10
+   \endcode
+
+// In case the given matrix has either 0 rows or 0 columns, the function returns the default
+// value of the element type (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline ElementType_<MT> sum( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense matrix by means of multiplication.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \return The product of all matrix elements.
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, 2 }, { 3, 4 } };
+
+   const int totalprod = prod( A );  // Results in 24
+   \endcode
+
+// In case the given matrix has either 0 rows or 0 columns, the function returns the default
+// value of the element type (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline ElementType_<MT> prod( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the smallest element of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The smallest dense matrix element.
+//
+// This function returns the smallest element of the given dense matrix. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// matrix currently has either 0 rows or 0 columns, the returned value is the default value
+// (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline ElementType_<MT> min( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Minimum() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the largest element of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The largest dense matrix element.
+//
+// This function returns the largest element of the given dense matrix. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// matrix currently has either 0 rows or 0 columns, the returned value is the default value
+// (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline ElementType_<MT> max( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Maximum() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a custom reduction operation on the given dense matrix in the given dimension.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the rows or columns of the given dense matrix \a dm by means of the
+// given reduction operation \a op. In case the reduction flag \a RF is set to blaze::columnwise,
+// the elements of each column are reduced and the result is a row vector:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   blaze::DynamicVector<double,rowVector> colsum;
+   // ... Resizing and initialization
+
+   colsum = reduce<columnwise>( A, blaze::Add() );
+   \endcode
+
+// In case \a RF is set to blaze::rowwise, the elements of each row are reduced and the result
+// is a column vector:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   blaze::DynamicVector<double,columnVector> rowsum;
+   // ... Resizing and initialization
+
+   rowsum = reduce<rowwise>( A, blaze::Add() );
+   \endcode
+
+// The function returns an expression representing the reduction. The matrix is traversed in
+// the order that best suits its storage order: a column-wise reduction of a row-major matrix
+// accumulates entire rows of the matrix into the target vector, a row-wise reduction of a
+// row-major matrix reduces each row separately, and vice versa for column-major matrices.
+// Dense matrices with a number of elements larger or equal to the
+// blaze::SMP_DMATREDUCE_THRESHOLD are reduced in parallel (see \ref shared_memory_parallelization).
+//
+// Please note that the evaluation order of the reduction operation is unspecified. Thus the
+// behavior is non-deterministic if \a op is not associative or not commutative. Also, the
+// operation is undefined if the given reduction operation modifies the values. In case the
+// reduced rows or columns are empty, the corresponding elements of the result are set to the
+// default value of the element type (e.g. 0 in case of fundamental data types).
+*/
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline const DMatReduceExpr<MT,OP,RF> reduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DMatReduceExpr<MT,OP,RF>( ~dm, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense matrix by means of addition in the given dimension.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \return The row-wise or column-wise sums of the matrix elements.
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, 2 }, { 3, 4 } };
+
+   blaze::DynamicVector<int,rowVector> colsum;
+   blaze::DynamicVector<int,columnVector> rowsum;
+
+   colsum = sum<columnwise>( A );  // Results in ( 4, 6 )
+   rowsum = sum<rowwise>( A );     // Results in ( 3, 7 )
+   \endcode
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const DMatReduceExpr<MT,Add,RF> sum( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~dm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense matrix by means of multiplication in the given dimension.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \return The row-wise or column-wise products of the matrix elements.
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, 2 }, { 3, 4 } };
+
+   blaze::DynamicVector<int,rowVector> colprod;
+   blaze::DynamicVector<int,columnVector> rowprod;
+
+   colprod = prod<columnwise>( A );  // Results in ( 3, 8 )
+   rowprod = prod<rowwise>( A );     // Results in ( 2, 12 )
+   \endcode
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const DMatReduceExpr<MT,Mult,RF> prod( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~dm, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the smallest element of each row or column of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The smallest elements of the rows or columns.
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, 4 }, { 3, 2 } };
+
+   blaze::DynamicVector<int,rowVector> colmin;
+   blaze::DynamicVector<int,columnVector> rowmin;
+
+   colmin = min<columnwise>( A );  // Results in ( 1, 2 )
+   rowmin = min<rowwise>( A );     // Results in ( 1, 2 )
+   \endcode
+
+// This function can only be used for element types that support the smaller-than relationship.
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const DMatReduceExpr<MT,Minimum,RF> min( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~dm, Minimum() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the largest element of each row or column of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The largest elements of the rows or columns.
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, 4 }, { 3, 2 } };
+
+   blaze::DynamicVector<int,rowVector> colmax;
+   blaze::DynamicVector<int,columnVector> rowmax;
+
+   colmax = max<columnwise>( A );  // Results in ( 3, 4 )
+   rowmax = max<rowwise>( A );     // Results in ( 4, 3 )
+   \endcode
+
+// This function can only be used for element types that support the smaller-than relationship.
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const DMatReduceExpr<MT,Maximum,RF> max( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~dm, Maximum() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SIZE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, typename OP >
+struct Size< DMatReduceExpr<MT,OP,columnwise> > : public Columns<MT>
+{};
+
+template< typename MT, typename OP >
+struct Size< DMatReduceExpr<MT,OP,rowwise> > : public Rows<MT>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, typename OP, size_t RF, bool AF >
+struct SubvectorExprTrait< DMatReduceExpr<MT,OP,RF>, AF >
+{
+ public:
+   //**********************************************************************************************
+   using Type = DMatReduceExpr< RemoveReference_< SubmatrixExprTrait_<const MT,AF> >, OP, RF >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
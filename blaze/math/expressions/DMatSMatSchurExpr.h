@@ -0,0 +1,1005 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DMatSMatSchurExpr.h
+//  \brief Header file for the dense matrix/sparse matrix Schur product expression
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DMATSMATSCHUREXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DMATSMATSCHUREXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/MatMatSchurExpr.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatMatSchurExpr.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/traits/ColumnExprTrait.h>
+#include <blaze/math/traits/MultExprTrait.h>
+#include <blaze/math/traits/RowExprTrait.h>
+#include <blaze/math/traits/SchurTrait.h>
+#include <blaze/math/traits/SubmatrixExprTrait.h>
+#include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsStrictlyLower.h>
+#include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsTemporary.h>
+#include <blaze/math/typetraits/IsUniLower.h>
+#include <blaze/math/typetraits/IsUniUpper.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Max.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DMATSMATSCHUREXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for dense matrix-sparse matrix Schur products.
+// \ingroup sparse_matrix_expression
+//
+// The DMatSMatSchurExpr class represents the compile time expression for Schur products (i.e.
+// elementwise multiplications) between a dense matrix and a sparse matrix. Since the result
+// can only contain non-zero elements at the positions of the non-zero elements of the sparse
+// operand, the expression is a sparse matrix with the storage order of the sparse operand and
+// the evaluation is restricted to the non-zero elements of the sparse operand. The dense matrix
+// operand is accessed randomly and can therefore be of any storage order.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO >     // Storage order of the right-hand side sparse matrix
+class DMatSMatSchurExpr : public SparseMatrix< DMatSMatSchurExpr<MT1,MT2,SO>, SO >
+                        , private MatMatSchurExpr
+                        , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef ResultType_<MT1>     RT1;  //!< Result type of the left-hand side dense matrix expression.
+   typedef ResultType_<MT2>     RT2;  //!< Result type of the right-hand side sparse matrix expression.
+   typedef ReturnType_<MT1>     RN1;  //!< Return type of the left-hand side dense matrix expression.
+   typedef ReturnType_<MT2>     RN2;  //!< Return type of the right-hand side sparse matrix expression.
+   typedef CompositeType_<MT1>  CT1;  //!< Composite type of the left-hand side dense matrix expression.
+   typedef CompositeType_<MT2>  CT2;  //!< Composite type of the right-hand side sparse matrix expression.
+   //**********************************************************************************************
+
+   //**Return type evaluation**********************************************************************
+   //! Compilation switch for the selection of the subscript operator return type.
+   /*! The \a returnExpr compile time constant expression is a compilation switch for the
+       selection of the \a ReturnType. If either matrix operand returns a temporary vector
+       or matrix, \a returnExpr will be set to \a false and the subscript operator will
+       return it's result by value. Otherwise \a returnExpr will be set to \a true and
+       the subscript operator may return it's result as an expression. */
+   enum : bool { returnExpr = !IsTemporary<RN1>::value && !IsTemporary<RN2>::value };
+
+   //! Expression return type for the subscript operator.
+   typedef MultExprTrait_<RN1,RN2>  ExprReturnType;
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef DMatSMatSchurExpr<MT1,MT2,SO>  This;           //!< Type of this DMatSMatSchurExpr instance.
+   typedef SchurTrait_<RT1,RT2>           ResultType;     //!< Result type for expression template evaluations.
+   typedef OppositeType_<ResultType>      OppositeType;   //!< Result type with opposite storage order for expression template evaluations.
+   typedef TransposeType_<ResultType>     TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef ElementType_<ResultType>       ElementType;    //!< Resulting element type.
+
+   //! Return type for expression template evaluations.
+   typedef const IfTrue_< returnExpr, ExprReturnType, ElementType >  ReturnType;
+
+   //! Data type for composite expression templates.
+   typedef const ResultType  CompositeType;
+
+   //! Composite type of the left-hand side dense matrix expression.
+   typedef If_< IsExpression<MT1>, const MT1, const MT1& >  LeftOperand;
+
+   //! Composite type of the right-hand side sparse matrix expression.
+   typedef If_< IsExpression<MT2>, const MT2, const MT2& >  RightOperand;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = MT1::smpAssignable && MT2::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DMatSMatSchurExpr class.
+   //
+   // \param lhs The left-hand side dense matrix operand of the Schur product expression.
+   // \param rhs The right-hand side sparse matrix operand of the Schur product expression.
+   */
+   explicit inline DMatSMatSchurExpr( const MT1& lhs, const MT2& rhs ) noexcept
+      : lhs_( lhs )  // Left-hand side dense matrix of the Schur product expression
+      , rhs_( rhs )  // Right-hand side sparse matrix of the Schur product expression
+   {
+      BLAZE_INTERNAL_ASSERT( lhs.rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( lhs.columns() == rhs.columns(), "Invalid number of columns" );
+   }
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 2D-access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( i < lhs_.rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < lhs_.columns(), "Invalid column access index" );
+      return lhs_(i,j) * rhs_(i,j);
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid matrix access index.
+   */
+   inline ReturnType at( size_t i, size_t j ) const {
+      if( i >= lhs_.rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+      }
+      if( j >= lhs_.columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+      }
+      return (*this)(i,j);
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the matrix.
+   //
+   // \return The number of rows of the matrix.
+   */
+   inline size_t rows() const noexcept {
+      return lhs_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the matrix.
+   //
+   // \return The number of columns of the matrix.
+   */
+   inline size_t columns() const noexcept {
+      return lhs_.columns();
+   }
+   //**********************************************************************************************
+
+   //**NonZeros function***************************************************************************
+   /*!\brief Returns the number of non-zero elements in the sparse matrix.
+   //
+   // \return The number of non-zero elements in the sparse matrix.
+   */
+   inline size_t nonZeros() const {
+      return rhs_.nonZeros();
+   }
+   //**********************************************************************************************
+
+   //**NonZeros function***************************************************************************
+   /*!\brief Returns the number of non-zero elements in the specified row/column.
+   //
+   // \param i The index of the row/column.
+   // \return The number of non-zero elements of row/column \a i.
+   */
+   inline size_t nonZeros( size_t i ) const {
+      return rhs_.nonZeros(i);
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side dense matrix operand.
+   //
+   // \return The left-hand side dense matrix operand.
+   */
+   inline LeftOperand leftOperand() const noexcept {
+      return lhs_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side sparse matrix operand.
+   //
+   // \return The right-hand side sparse matrix operand.
+   */
+   inline RightOperand rightOperand() const noexcept {
+      return rhs_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( lhs_.canAlias( alias ) || rhs_.canAlias( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( lhs_.isAliased( alias ) || rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return lhs_.canSMPAssign() || rhs_.canSMPAssign() ||
+             ( nonZeros() >= SMP_SMATSMATSCHUR_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LeftOperand  lhs_;  //!< Left-hand side dense matrix of the Schur product expression.
+   RightOperand rhs_;  //!< Right-hand side sparse matrix of the Schur product expression.
+   //**********************************************************************************************
+
+   //**Assignment to dense matrices****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix-sparse matrix Schur product to a dense matrix.
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side Schur product expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix-sparse
+   // matrix Schur product expression to a dense matrix. Only the elements at the positions of
+   // the non-zero elements of the sparse matrix operand are assigned.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void assign( DenseMatrix<MT,SO2>& lhs, const DMatSMatSchurExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typedef ConstIterator_< RemoveReference_<CT2> >  RightIterator;
+
+      CT1 A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
+      CT2 B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+
+      const size_t lines( SO ? B.columns() : B.rows() );
+
+      for( size_t k=0UL; k<lines; ++k ) {
+         const RightIterator end( B.end(k) );
+         for( RightIterator element=B.begin(k); element!=end; ++element ) {
+            const size_t i( SO ? element->index() : k );
+            const size_t j( SO ? k : element->index() );
+            (~lhs)(i,j) = A(i,j) * element->value();
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse matrices***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix-sparse matrix Schur product to a sparse matrix.
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side Schur product expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix-sparse
+   // matrix Schur product expression to a sparse matrix with the storage order of the sparse
+   // matrix operand. The non-zero elements of the sparse matrix operand are traversed exactly
+   // once and the resulting elements are appended to the target matrix.
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   friend inline void assign( SparseMatrix<MT,SO>& lhs, const DMatSMatSchurExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typedef ConstIterator_< RemoveReference_<CT2> >  RightIterator;
+
+      CT1 A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
+      CT2 B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+
+      // Final memory allocation (based on the evaluated sparse operand)
+      (~lhs).reserve( B.nonZeros() );
+
+      const size_t lines( SO ? B.columns() : B.rows() );
+
+      for( size_t k=0UL; k<lines; ++k ) {
+         const RightIterator end( B.end(k) );
+         for( RightIterator element=B.begin(k); element!=end; ++element ) {
+            const size_t i( SO ? element->index() : k );
+            const size_t j( SO ? k : element->index() );
+            (~lhs).append( i, j, A(i,j) * element->value() );
+         }
+         (~lhs).finalize( k );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse matrices***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix-sparse matrix Schur product to a sparse matrix with
+   //        opposite storage order.
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side Schur product expression to be assigned.
+   // \return void
+   //
+   // This function implements the assignment of a dense matrix-sparse matrix Schur product
+   // expression to a sparse matrix whose storage order differs from the storage order of the
+   // sparse matrix operand. The Schur product is evaluated into a temporary with the storage
+   // order of the sparse operand, which is subsequently assigned to the target matrix.
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   friend inline void assign( SparseMatrix<MT,!SO>& lhs, const DMatSMatSchurExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( ResultType, SO );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense matrix-sparse matrix Schur product to a dense matrix.
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side Schur product expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a dense matrix-
+   // sparse matrix Schur product expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void addAssign( DenseMatrix<MT,SO2>& lhs, const DMatSMatSchurExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typedef ConstIterator_< RemoveReference_<CT2> >  RightIterator;
+
+      CT1 A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
+      CT2 B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+
+      const size_t lines( SO ? B.columns() : B.rows() );
+
+      for( size_t k=0UL; k<lines; ++k ) {
+         const RightIterator end( B.end(k) );
+         for( RightIterator element=B.begin(k); element!=end; ++element ) {
+            const size_t i( SO ? element->index() : k );
+            const size_t j( SO ? k : element->index() );
+            (~lhs)(i,j) += A(i,j) * element->value();
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse matrices******************************************************
+   // No special implementation for the addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense matrices****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense matrix-sparse matrix Schur product to a dense matrix.
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side Schur product expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a dense
+   // matrix-sparse matrix Schur product expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void subAssign( DenseMatrix<MT,SO2>& lhs, const DMatSMatSchurExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typedef ConstIterator_< RemoveReference_<CT2> >  RightIterator;
+
+      CT1 A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
+      CT2 B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+
+      const size_t lines( SO ? B.columns() : B.rows() );
+
+      for( size_t k=0UL; k<lines; ++k ) {
+         const RightIterator end( B.end(k) );
+         for( RightIterator element=B.begin(k); element!=end; ++element ) {
+            const size_t i( SO ? element->index() : k );
+            const size_t j( SO ? k : element->index() );
+            (~lhs)(i,j) -= A(i,j) * element->value();
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse matrices***************************************************
+   // No special implementation for the subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense matrices*************************************************
+   // No special implementation for the multiplication assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse matrices************************************************
+   // No special implementation for the multiplication assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense matrices************************************************************
+   // No special implementation for the SMP assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse matrices***********************************************************
+   // No special implementation for the SMP assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense matrices***************************************************
+   // No special implementation for the SMP addition assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse matrices**************************************************
+   // No special implementation for the SMP addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense matrices************************************************
+   // No special implementation for the SMP subtraction assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse matrices***********************************************
+   // No special implementation for the SMP subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to dense matrices*********************************************
+   // No special implementation for the SMP multiplication assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to sparse matrices********************************************
+   // No special implementation for the SMP multiplication assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( MT2, SO );
+   BLAZE_CONSTRAINT_MUST_FORM_VALID_MATMATSCHUREXPR( MT1, MT2 );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Operator for the Schur product of a dense matrix and a sparse matrix
+//        (\f$ A=B \circ C \f$).
+// \ingroup sparse_matrix
+//
+// \param lhs The left-hand side dense matrix for the Schur product.
+// \param rhs The right-hand side sparse matrix for the Schur product.
+// \return The Schur product of the two matrices.
+// \exception std::invalid_argument Matrix sizes do not match
+//
+// This operator represents the Schur product (i.e. the elementwise multiplication) of a dense
+// matrix and a sparse matrix:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   blaze::CompressedMatrix<double> B, C;
+   // ... Resizing and initialization
+   C = A % B;
+   \endcode
+
+// The operator returns an expression representing a sparse matrix of the higher-order element
+// type of the two involved matrix element types \a T1::ElementType and \a T2::ElementType. The
+// resulting sparse matrix has the storage order of the sparse matrix operand. Both matrix types
+// \a T1 and \a T2 as well as the two element types \a T1::ElementType and \a T2::ElementType
+// have to be supported by the SchurTrait and MultTrait class templates.\n
+// In case the current number of rows and columns of the two given matrices don't match, a
+// \a std::invalid_argument is thrown.
+*/
+template< typename T1  // Type of the left-hand side dense matrix
+        , bool SO1     // Storage order of the left-hand side dense matrix
+        , typename T2  // Type of the right-hand side sparse matrix
+        , bool SO2 >   // Storage order of the right-hand side sparse matrix
+inline const DMatSMatSchurExpr<T1,T2,SO2>
+   operator%( const DenseMatrix<T1,SO1>& lhs, const SparseMatrix<T2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).rows() != (~rhs).rows() || (~lhs).columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   return DMatSMatSchurExpr<T1,T2,SO2>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product of a dense matrix and a sparse matrix
+//        (\f$ A=B \circ C \f$).
+// \ingroup sparse_matrix
+//
+// \param lhs The left-hand side dense matrix for the Schur product.
+// \param rhs The right-hand side sparse matrix for the Schur product.
+// \return The Schur product of the two matrices.
+// \exception std::invalid_argument Matrix sizes do not match
+//
+// This function computes the Schur product (i.e. the elementwise multiplication) of a dense
+// matrix and a sparse matrix:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   blaze::CompressedMatrix<double> B, C;
+   // ... Resizing and initialization
+   C = schur( A, B );
+   \endcode
+
+// The function returns an expression representing a sparse matrix of the higher-order element
+// type of the two involved matrix element types \a T1::ElementType and \a T2::ElementType. The
+// resulting sparse matrix has the storage order of the sparse matrix operand. Both matrix types
+// \a T1 and \a T2 as well as the two element types \a T1::ElementType and \a T2::ElementType
+// have to be supported by the SchurTrait and MultTrait class templates.\n
+// In case the current number of rows and columns of the two given matrices don't match, a
+// \a std::invalid_argument is thrown.
+*/
+template< typename T1  // Type of the left-hand side dense matrix
+        , bool SO1     // Storage order of the left-hand side dense matrix
+        , typename T2  // Type of the right-hand side sparse matrix
+        , bool SO2 >   // Storage order of the right-hand side sparse matrix
+inline const DMatSMatSchurExpr<T1,T2,SO2>
+   schur( const DenseMatrix<T1,SO1>& lhs, const SparseMatrix<T2,SO2>& rhs )
+{
+   return lhs % rhs;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Operator for the Schur product of a sparse matrix and a dense matrix
+//        (\f$ A=B \circ C \f$).
+// \ingroup sparse_matrix
+//
+// \param lhs The left-hand side sparse matrix for the Schur product.
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return The Schur product of the two matrices.
+// \exception std::invalid_argument Matrix sizes do not match
+//
+// This operator represents the Schur product (i.e. the elementwise multiplication) of a sparse
+// matrix and a dense matrix:
+
+   \code
+   blaze::CompressedMatrix<double> A, C;
+   blaze::DynamicMatrix<double> B;
+   // ... Resizing and initialization
+   C = A % B;
+   \endcode
+
+// The operator returns an expression representing a sparse matrix of the higher-order element
+// type of the two involved matrix element types \a T1::ElementType and \a T2::ElementType. The
+// resulting sparse matrix has the storage order of the sparse matrix operand. Since the Schur
+// product is commutative, the operands are swapped such that the dense matrix becomes the
+// left-hand side operand of the resulting expression. Both matrix types \a T1 and \a T2 as well
+// as the two element types \a T1::ElementType and \a T2::ElementType have to be supported by the
+// SchurTrait and MultTrait class templates.\n
+// In case the current number of rows and columns of the two given matrices don't match, a
+// \a std::invalid_argument is thrown.
+*/
+template< typename T1  // Type of the left-hand side sparse matrix
+        , bool SO1     // Storage order of the left-hand side sparse matrix
+        , typename T2  // Type of the right-hand side dense matrix
+        , bool SO2 >   // Storage order of the right-hand side dense matrix
+inline const DMatSMatSchurExpr<T2,T1,SO1>
+   operator%( const SparseMatrix<T1,SO1>& lhs, const DenseMatrix<T2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).rows() != (~rhs).rows() || (~lhs).columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   return DMatSMatSchurExpr<T2,T1,SO1>( ~rhs, ~lhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product of a sparse matrix and a dense matrix
+//        (\f$ A=B \circ C \f$).
+// \ingroup sparse_matrix
+//
+// \param lhs The left-hand side sparse matrix for the Schur product.
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return The Schur product of the two matrices.
+// \exception std::invalid_argument Matrix sizes do not match
+//
+// This function computes the Schur product (i.e. the elementwise multiplication) of a sparse
+// matrix and a dense matrix:
+
+   \code
+   blaze::CompressedMatrix<double> A, C;
+   blaze::DynamicMatrix<double> B;
+   // ... Resizing and initialization
+   C = schur( A, B );
+   \endcode
+
+// The function returns an expression representing a sparse matrix of the higher-order element
+// type of the two involved matrix element types \a T1::ElementType and \a T2::ElementType. The
+// resulting sparse matrix has the storage order of the sparse matrix operand. Since the Schur
+// product is commutative, the operands are swapped such that the dense matrix becomes the
+// left-hand side operand of the resulting expression. Both matrix types \a T1 and \a T2 as well
+// as the two element types \a T1::ElementType and \a T2::ElementType have to be supported by the
+// SchurTrait and MultTrait class templates.\n
+// In case the current number of rows and columns of the two given matrices don't match, a
+// \a std::invalid_argument is thrown.
+*/
+template< typename T1  // Type of the left-hand side sparse matrix
+        , bool SO1     // Storage order of the left-hand side sparse matrix
+        , typename T2  // Type of the right-hand side dense matrix
+        , bool SO2 >   // Storage order of the right-hand side dense matrix
+inline const DMatSMatSchurExpr<T2,T1,SO1>
+   schur( const SparseMatrix<T1,SO1>& lhs, const DenseMatrix<T2,SO2>& rhs )
+{
+   return lhs % rhs;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct Rows< DMatSMatSchurExpr<MT1,MT2,SO> >
+   : public Max< Rows<MT1>, Rows<MT2> >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct Columns< DMatSMatSchurExpr<MT1,MT2,SO> >
+   : public Max< Columns<MT1>, Columns<MT2> >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSYMMETRIC SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsSymmetric< DMatSMatSchurExpr<MT1,MT2,SO> >
+   : public BoolConstant< IsSymmetric<MT1>::value && IsSymmetric<MT2>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISHERMITIAN SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsHermitian< DMatSMatSchurExpr<MT1,MT2,SO> >
+   : public BoolConstant< IsHermitian<MT1>::value && IsHermitian<MT2>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISLOWER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsLower< DMatSMatSchurExpr<MT1,MT2,SO> >
+   : public BoolConstant< Or< IsLower<MT1>, IsLower<MT2> >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISUNILOWER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsUniLower< DMatSMatSchurExpr<MT1,MT2,SO> >
+   : public BoolConstant< And< IsUniLower<MT1>, IsUniLower<MT2> >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSTRICTLYLOWER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsStrictlyLower< DMatSMatSchurExpr<MT1,MT2,SO> >
+   : public BoolConstant< Or< IsStrictlyLower<MT1>, IsStrictlyLower<MT2> >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISUPPER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsUpper< DMatSMatSchurExpr<MT1,MT2,SO> >
+   : public BoolConstant< Or< IsUpper<MT1>, IsUpper<MT2> >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISUNIUPPER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsUniUpper< DMatSMatSchurExpr<MT1,MT2,SO> >
+   : public BoolConstant< And< IsUniUpper<MT1>, IsUniUpper<MT2> >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSTRICTLYUPPER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsStrictlyUpper< DMatSMatSchurExpr<MT1,MT2,SO> >
+   : public BoolConstant< Or< IsStrictlyUpper<MT1>, IsStrictlyUpper<MT2> >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO, bool AF >
+struct SubmatrixExprTrait< DMatSMatSchurExpr<MT1,MT2,SO>, AF >
+{
+ public:
+   //**********************************************************************************************
+   using Type = DMatSMatSchurExpr< SubmatrixExprTrait_<const MT1,AF>
+                                 , SubmatrixExprTrait_<const MT2,AF>, SO >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct RowExprTrait< DMatSMatSchurExpr<MT1,MT2,SO> >
+{
+ public:
+   //**********************************************************************************************
+   using Type = MultExprTrait_< RowExprTrait_<const MT1>
+                              , RowExprTrait_<const MT2> >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct ColumnExprTrait< DMatSMatSchurExpr<MT1,MT2,SO> >
+{
+ public:
+   //**********************************************************************************************
+   using Type = MultExprTrait_< ColumnExprTrait_<const MT1>
+                              , ColumnExprTrait_<const MT2> >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,560 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DVecReduceExpr.h
+//  \brief Header file for the dense vector reduction functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DVECREDUCEEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DVECREDUCEEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dispatch/Reduction.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Maximum.h>
+#include <blaze/math/functors/Minimum.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the dense vector reduction operation.
+// \ingroup dense_vector
+*/
+template< typename VT    // Type of the dense vector
+        , typename OP >  // Type of the reduction operation
+struct DVecReduceExprHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the dense vector expression.
+   typedef RemoveReference_< CompositeType_<VT> >  CT;
+
+   //! Element type of the dense vector expression.
+   typedef ElementType_<CT>  ET;
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+   //**SIMD support detection**********************************************************************
+   //! Helper structure for the detection of the SIMD type returned by the dense vector expression.
+   struct UseSIMDLoad {
+      enum : bool { value = IsSame< SIMDTrait_<ET>, Decay_< decltype( std::declval<CT>().load( 0UL ) ) > >::value };
+   };
+
+   //! Helper structure for the detection of the SIMD capabilities of the reduction operation.
+   struct UseSIMDEnabledFlag {
+      enum : bool { value = OP::BLAZE_TEMPLATE simdEnabled<ET,ET>() };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum : bool { value = useOptimizedKernels &&
+                         If_< BoolConstant<CT::simdEnabled>, UseSIMDLoad, FalseType >::value &&
+                         IsSame< ET, ElementType_<VT> >::value &&
+                         If_< HasSIMDEnabled<OP>, UseSIMDEnabledFlag, HasLoad<OP> >::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Horizontal reduction of the elements of a SIMD vector.
+// \ingroup dense_vector
+//
+// \param a The given SIMD vector.
+// \param op The reduction operation.
+// \return The result of the reduction of all elements of the SIMD vector.
+*/
+template< typename T     // Type of the SIMD vector
+        , typename OP >  // Type of the reduction operation
+inline typename T::ValueType simdReduce( const SIMDPack<T>& a, OP op )
+{
+   typename T::ValueType redux( (~a)[0UL] );
+   for( size_t k=1UL; k<T::size; ++k ) {
+      redux = op( redux, (~a)[k] );
+   }
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Horizontal summation of the elements of a SIMD vector.
+// \ingroup dense_vector
+//
+// \param a The given SIMD vector.
+// \return The sum of all elements of the SIMD vector.
+*/
+template< typename T >  // Type of the SIMD vector
+inline typename T::ValueType simdReduce( const SIMDPack<T>& a, Add /*op*/ )
+{
+   return sum( ~a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Horizontal minimum of the elements of a SIMD vector.
+// \ingroup dense_vector
+//
+// \param a The given SIMD vector.
+// \return The smallest element of the SIMD vector.
+*/
+template< typename T >  // Type of the SIMD vector
+inline typename T::ValueType simdReduce( const SIMDPack<T>& a, Minimum /*op*/ )
+{
+   return min( ~a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Horizontal maximum of the elements of a SIMD vector.
+// \ingroup dense_vector
+//
+// \param a The given SIMD vector.
+// \return The largest element of the SIMD vector.
+*/
+template< typename T >  // Type of the SIMD vector
+inline typename T::ValueType simdReduce( const SIMDPack<T>& a, Maximum /*op*/ )
+{
+   return max( ~a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the reduction of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the serial reduction of the given dense vector for all element types
+// and reduction operations that do not support a SIMD optimized evaluation. In order to shorten
+// the dependency chain between the single applications of the reduction operation, four
+// elements are combined pairwise before they are combined with the intermediate result.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< DVecReduceExprHelper<VT,OP>, ElementType_<VT> >
+   dvecreduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   typedef ElementType_<VT>    ET;
+   typedef CompositeType_<VT>  CT;
+
+   const size_t N( (~dv).size() );
+
+   if( N == 0UL ) return ET();
+
+   CT tmp( ~dv );
+
+   BLAZE_INTERNAL_ASSERT( tmp.size() == N, "Invalid vector size" );
+
+   ET redux( tmp[0UL] );
+   size_t i( 1UL );
+
+   for( ; (i+4UL) <= N; i+=4UL ) {
+      redux = op( redux, op( op( tmp[i    ], tmp[i+1UL] ),
+                             op( tmp[i+2UL], tmp[i+3UL] ) ) );
+   }
+   for( ; (i+2UL) <= N; i+=2UL ) {
+      redux = op( redux, op( tmp[i], tmp[i+1UL] ) );
+   }
+   for( ; i<N; ++i ) {
+      redux = op( redux, tmp[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the runtime dispatched reduction of a dense vector.
+// \ingroup dense_vector
+//
+// In case the given dense vector type provides contiguous access to its elements and the
+// element type and the reduction operation are supported by a runtime dispatched kernel (see
+// IsReductionDispatched), the nested \a value will be set to 1, otherwise it will be 0.
+*/
+template< typename VT    // Type of the dense vector
+        , typename OP >  // Type of the reduction operation
+struct DVecReduceExprDispatch
+{
+   enum : bool { value = HasConstDataAccess<VT>::value && VT::simdEnabled &&
+                         IsReductionDispatched< ElementType_<VT>, OP >::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default fallback for the runtime dispatched reduction of a dense vector.
+// \ingroup dense_vector
+//
+// \return \a false.
+*/
+template< typename VT    // Type of the dense vector
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< DVecReduceExprDispatch<VT,OP>, bool >
+   dvecreduceDispatch( const VT& /*dv*/, OP /*op*/, ElementType_<VT>& /*redux*/ )
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched reduction of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given non-empty dense vector.
+// \param op The reduction operation.
+// \param redux The result of the reduction operation.
+// \return \a true in case the reduction has been performed, \a false if not.
+//
+// This function relays the reduction of the contiguous elements of the given dense vector to
+// the runtime dispatched kernels (see dispatchReduce()).
+*/
+template< typename VT    // Type of the dense vector
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DVecReduceExprDispatch<VT,OP>, bool >
+   dvecreduceDispatch( const VT& dv, OP op, ElementType_<VT>& redux )
+{
+   return dispatchReduce( dv.data(), dv.size(), op, redux );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the reduction of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the serial, SIMD optimized reduction of the given dense vector. The
+// reduction is performed by means of four independent SIMD accumulators, which are initialized
+// with the first four SIMD vectors of the dense vector. This avoids the need for a neutral
+// element of the reduction operation and hides the latency of the single SIMD operations. The
+// accumulators are combined via a final horizontal reduction. In case a runtime dispatched kernel
+// for a more powerful instruction set is available (see BLAZE_USE_RUNTIME_DISPATCH), the
+// reduction is relayed to this kernel.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DVecReduceExprHelper<VT,OP>, ElementType_<VT> >
+   dvecreduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   typedef ElementType_<VT>    ET;
+   typedef CompositeType_<VT>  CT;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   const size_t N( (~dv).size() );
+
+   if( N == 0UL ) return ET();
+
+   CT tmp( ~dv );
+
+   BLAZE_INTERNAL_ASSERT( tmp.size() == N, "Invalid vector size" );
+
+   ET redux{};
+
+   if( dvecreduceDispatch( tmp, op, redux ) )
+      return redux;
+
+   const size_t ipos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+
+   if( ipos != 0UL )
+   {
+      SIMDTrait_<ET> xmm1( tmp.load(0UL) );
+      i = SIMDSIZE;
+
+      if( ipos >= SIMDSIZE*4UL )
+      {
+         SIMDTrait_<ET> xmm2( tmp.load(SIMDSIZE    ) );
+         SIMDTrait_<ET> xmm3( tmp.load(SIMDSIZE*2UL) );
+         SIMDTrait_<ET> xmm4( tmp.load(SIMDSIZE*3UL) );
+
+         for( i=SIMDSIZE*4UL; (i+SIMDSIZE*4UL) <= ipos; i+=SIMDSIZE*4UL ) {
+            xmm1 = op.load( xmm1, tmp.load(i             ) );
+            xmm2 = op.load( xmm2, tmp.load(i+SIMDSIZE    ) );
+            xmm3 = op.load( xmm3, tmp.load(i+SIMDSIZE*2UL) );
+            xmm4 = op.load( xmm4, tmp.load(i+SIMDSIZE*3UL) );
+         }
+
+         xmm1 = op.load( op.load( xmm1, xmm2 ), op.load( xmm3, xmm4 ) );
+      }
+
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         xmm1 = op.load( xmm1, tmp.load(i) );
+      }
+
+      redux = simdReduce( xmm1, op );
+   }
+   else
+   {
+      redux = tmp[0UL];
+      i = 1UL;
+   }
+
+   for( ; i<N; ++i ) {
+      redux = op( redux, tmp[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a custom reduction operation on the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense vector \a dv by means of the given reduction operation
+// \a op:
+
+   \code
+   blaze::DynamicVector<double> a;
+   // ... Resizing and initialization
+
+   const double totalsum1 = reduce( a, blaze::Add() );
+   const double totalsum2 = reduce( a, []( double a, double b ){ return a + b; } );
+   \endcode
+
+// As demonstrated in the example it is possible to pass any binary callable as custom reduction
+// operation. However, for instance in the case of lambdas the vectorization of the reduction
+// operation is compiler dependent and might not perform at peak performance. However, it is
+// also possible to create vectorized custom operations. See \ref custom_operations for a
+// detailed overview of the possibilities of custom operations.
+//
+// Please note that the evaluation order of the reduction operation is unspecified. Thus the
+// behavior is non-deterministic if \a op is not associative or not commutative. Also, the
+// operation is undefined if the given reduction operation modifies the values. In case the
+// size of the given vector is 0, the function returns the default value of the element type
+// (e.g. 0 in case of fundamental data types). Dense vectors with a size larger or equal to
+// the blaze::SMP_DVECREDUCE_THRESHOLD are reduced in parallel (see \ref shared_memory_parallelization).
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline ElementType_<VT> reduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return smpReduce( ~dv, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense vector by means of addition.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction computation.
+// \return The sum of all vector elements.
+
+   \code
+   blaze::DynamicVector<int> a{ 1, 2, 3, 4 };
+
+   const int totalsum = sum( a );  // Results in 10
+   \endcode
+
+// In case the size of the given vector is 0, the function returns the default value of the
+// element type (e.g. 0 in case of fundamental data types).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline ElementType_<VT> sum( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dv, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense vector by means of multiplication.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction computation.
+// \return The product of all vector elements.
+
+   \code
+   blaze::DynamicVector<int> a{ 1, 2, 3, 4 };
+
+   const int totalprod = prod( a );  // Results in 24
+   \endcode
+
+// In case the size of the given vector is 0, the function returns the default value of the
+// element type (e.g. 0 in case of fundamental data types).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline ElementType_<VT> prod( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dv, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the smallest element of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The smallest dense vector element.
+//
+// This function returns the smallest element of the given dense vector. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// vector currently has a size of 0, the returned value is the default value (e.g. 0 in case
+// of fundamental data types).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline ElementType_<VT> min( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dv, Minimum() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the largest element of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The largest dense vector element.
+//
+// This function returns the largest element of the given dense vector. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// vector currently has a size of 0, the returned value is the default value (e.g. 0 in case
+// of fundamental data types).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline ElementType_<VT> max( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dv, Maximum() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
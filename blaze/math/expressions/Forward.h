@@ -36,6 +36,13 @@
 #define _BLAZE_MATH_EXPRESSIONS_FORWARD_H_
 
 
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+
 namespace blaze {
 
 //=================================================================================================
@@ -46,22 +53,27 @@ namespace blaze {
 
 template< typename, bool > struct DenseMatrix;
 template< typename, bool > struct DenseVector;
+template< typename, typename, bool > class DMatChainMultExpr;
 template< typename, typename, bool > class DMatDMatAddExpr;
 template< typename, typename > class DMatDMatMultExpr;
+template< typename, typename, bool > class DMatDMatSchurExpr;
 template< typename, typename, bool > class DMatDMatSubExpr;
 template< typename, typename > class DMatDVecMultExpr;
 template< typename, bool > class DMatEvalExpr;
 template< typename, typename, bool > class DMatForEachExpr;
 template< typename, bool > class DMatInvExpr;
+template< typename, typename, size_t > class DMatReduceExpr;
 template< typename, typename, bool > class DMatScalarDivExpr;
 template< typename, typename, bool > class DMatScalarMultExpr;
 template< typename, bool > class DMatSerialExpr;
 template< typename, typename, bool > class DMatSMatAddExpr;
 template< typename, typename > class DMatSMatMultExpr;
+template< typename, typename, bool > class DMatSMatSchurExpr;
 template< typename, typename, bool > class DMatSMatSubExpr;
 template< typename, typename > class DMatSVecMultExpr;
 template< typename, typename > class DMatTDMatAddExpr;
 template< typename, typename > class DMatTDMatMultExpr;
+template< typename, typename > class DMatTDMatSchurExpr;
 template< typename, typename > class DMatTDMatSubExpr;
 template< typename, bool > class DMatTransExpr;
 template< typename, bool > class DMatTransposer;
@@ -87,16 +99,19 @@ template< typename, bool > class DVecTransExpr;
 template< typename, bool > class DVecTransposer;
 template< typename, typename > class DVecTSVecMultExpr;
 template< typename, bool > struct Matrix;
+template< typename, typename, bool > class SMatChainMultExpr;
 template< typename, typename > class SMatDMatMultExpr;
 template< typename, typename, bool > class SMatDMatSubExpr;
 template< typename, typename > class SMatDVecMultExpr;
 template< typename, bool > class SMatEvalExpr;
 template< typename, typename, bool > class SMatForEachExpr;
+template< typename, typename, size_t > class SMatReduceExpr;
 template< typename, typename, bool > class SMatScalarDivExpr;
 template< typename, typename, bool > class SMatScalarMultExpr;
 template< typename, bool > class SMatSerialExpr;
 template< typename, typename > class SMatSMatAddExpr;
 template< typename, typename > class SMatSMatMultExpr;
+template< typename, typename, bool > class SMatSMatSchurExpr;
 template< typename, typename > class SMatSMatSubExpr;
 template< typename, typename > class SMatSVecMultExpr;
 template< typename, typename > class SMatTDMatMultExpr;
@@ -105,6 +120,7 @@ template< typename, bool > class SMatTransExpr;
 template< typename, bool > class SMatTransposer;
 template< typename, typename > class SMatTSMatAddExpr;
 template< typename, typename > class SMatTSMatMultExpr;
+template< typename, typename > class SMatTSMatSchurExpr;
 template< typename, typename > class SMatTSMatSubExpr;
 template< typename, bool > struct SparseMatrix;
 template< typename, bool > struct SparseVector;
@@ -189,6 +205,12 @@ inline const DMatForEachExpr<MT,OP,SO> forEach( const DenseMatrix<MT,SO>&, OP );
 template< typename MT, bool SO, typename OP >
 inline const SMatForEachExpr<MT,OP,SO> forEach( const SparseMatrix<MT,SO>&, OP );
 
+template< size_t RF, typename MT, bool SO, typename OP >
+inline const DMatReduceExpr<MT,OP,RF> reduce( const DenseMatrix<MT,SO>&, OP );
+
+template< size_t RF, typename MT, bool SO, typename OP >
+inline const SMatReduceExpr<MT,OP,RF> reduce( const SparseMatrix<MT,SO>&, OP );
+
 } // namespace blaze
 
 #endif
@@ -0,0 +1,862 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/MatChain.h
+//  \brief Header file for the runtime ordering of matrix multiplication chains
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_MATCHAIN_H_
+#define _BLAZE_MATH_EXPRESSIONS_MATCHAIN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatSerialExpr.h>
+#include <blaze/math/expressions/SMatSerialExpr.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/Decay.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS MATCHAINLENGTH
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of the number of factors of a matrix multiplication chain.
+// \ingroup math
+//
+// The MatChainLength class template evaluates the number of factors of the given matrix type
+// \a MT. In case \a MT is a matrix/matrix multiplication expression, the number of factors is
+// the sum of the number of factors of its two operands. Otherwise the number of factors is 1.
+*/
+template< typename MT                             // Type of the matrix
+        , bool = IsMatMatMultExpr<MT>::value >  // Flag for matrix/matrix multiplications
+struct MatChainLength
+   : public IntegralConstant<size_t,1UL>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the MatChainLength class template for matrix/matrix multiplications.
+// \ingroup math
+*/
+template< typename MT >  // Type of the matrix/matrix multiplication
+struct MatChainLength<MT,true>
+   : public IntegralConstant< size_t, MatChainLength< Decay_< LeftOperand_<MT> > >::value +
+                                      MatChainLength< Decay_< RightOperand_<MT> > >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MATCHAINFACTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Access to a single factor of a matrix multiplication chain.
+// \ingroup math
+//
+// The MatChainFactor class template provides access to the \a I-th factor of the given matrix
+// multiplication chain \a MT. The nested \a Type corresponds to the composite type of the
+// factor, i.e. factors that are expressions are returned by value, all other factors are
+// returned by reference.
+*/
+template< typename MT                             // Type of the matrix
+        , size_t I                                // Index of the factor
+        , bool = IsMatMatMultExpr<MT>::value >  // Flag for matrix/matrix multiplications
+struct MatChainFactor
+{
+ public:
+   //**********************************************************************************************
+   //! Composite type of the factor.
+   typedef If_< IsExpression<MT>, const MT, const MT& >  Type;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the factor.
+   //
+   // \param mat The matrix representing the factor.
+   // \return The factor.
+   */
+   static inline Type get( const MT& mat ) noexcept {
+      return mat;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the MatChainFactor class template for matrix/matrix multiplications.
+// \ingroup math
+*/
+template< typename MT  // Type of the matrix/matrix multiplication
+        , size_t I >   // Index of the factor
+struct MatChainFactor<MT,I,true>
+{
+ private:
+   //**********************************************************************************************
+   typedef Decay_< LeftOperand_<MT> >   LT;  //!< Type of the left-hand side operand.
+   typedef Decay_< RightOperand_<MT> >  RT;  //!< Type of the right-hand side operand.
+
+   //! Compilation switch for the operand containing the factor.
+   enum : bool { left = ( I < MatChainLength<LT>::value ) };
+
+   //! Access to the factor within the according operand.
+   typedef IfTrue_< left
+                  , MatChainFactor<LT,I>
+                  , MatChainFactor<RT,I-MatChainLength<LT>::value> >  Factor;
+   //**********************************************************************************************
+
+ public:
+   //**********************************************************************************************
+   //! Composite type of the factor.
+   typedef typename Factor::Type  Type;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the \a I-th factor of the given matrix multiplication.
+   //
+   // \param mat The matrix/matrix multiplication.
+   // \return The factor.
+   */
+   static inline Type get( const MT& mat ) {
+      return get( mat, BoolConstant<left>() );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*!\brief Returns the factor contained in the left-hand side operand.
+   //
+   // \param mat The matrix/matrix multiplication.
+   // \return The factor.
+   */
+   static inline Type get( const MT& mat, TrueType ) {
+      return Factor::get( mat.leftOperand() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the factor contained in the right-hand side operand.
+   //
+   // \param mat The matrix/matrix multiplication.
+   // \return The factor.
+   */
+   static inline Type get( const MT& mat, FalseType ) {
+      return Factor::get( mat.rightOperand() );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MATCHAINBUFFER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reusable buffer for the intermediate results of matrix multiplication chains.
+// \ingroup math
+//
+// The MatChainBuffer class template represents a single intermediate result of the evaluation
+// of a matrix multiplication chain. The matrices are taken from a thread-local pool and are
+// returned to the pool on destruction. Since the matrices are never destroyed, their memory
+// is reused by all subsequent chain evaluations of the same thread. Buffers have to be
+// released in the reverse order of their acquisition.
+*/
+template< typename TT >  // Type of the buffered matrix
+class MatChainBuffer : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Thread-local pool of buffered matrices.
+   struct Pool {
+      std::vector< std::unique_ptr<TT> > matrices_;  //!< The buffered matrices.
+      size_t used_;                                  //!< The number of matrices in use.
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Acquires a matrix from the pool of the calling thread.
+   */
+   explicit inline MatChainBuffer()
+      : matrix_( nullptr )  // The acquired matrix
+   {
+      Pool& pool( getPool() );
+
+      if( pool.used_ == pool.matrices_.size() ) {
+         std::unique_ptr<TT> matrix( new TT() );
+         pool.matrices_.push_back( std::move( matrix ) );
+      }
+
+      matrix_ = pool.matrices_[pool.used_++].get();
+   }
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\brief Returns the matrix to the pool of the calling thread.
+   */
+   inline ~MatChainBuffer()
+   {
+      Pool& pool( getPool() );
+
+      BLAZE_INTERNAL_ASSERT( pool.used_ > 0UL, "Invalid pool state detected" );
+      BLAZE_INTERNAL_ASSERT( pool.matrices_[pool.used_-1UL].get() == matrix_, "Invalid release order" );
+
+      --pool.used_;
+   }
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief Direct access to the buffered matrix.
+   //
+   // \return Reference to the buffered matrix.
+   */
+   inline TT& operator*() const noexcept {
+      return *matrix_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*!\brief Returns the pool of the calling thread.
+   //
+   // \return Reference to the thread-local pool.
+   */
+   static inline Pool& getPool()
+   {
+      static thread_local Pool pool = { {}, 0UL };
+      return pool;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   TT* matrix_;  //!< The acquired matrix.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Final assignment of a matrix multiplication chain (\f$ C=A*B*C \f$).
+// \ingroup math
+*/
+struct MatChainAssign
+{
+   template< typename MT1, typename MT2 >
+   inline void operator()( MT1& lhs, const MT2& rhs ) const {
+      assign( lhs, rhs );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Final addition assignment of a matrix multiplication chain (\f$ C+=A*B*C \f$).
+// \ingroup math
+*/
+struct MatChainAddAssign
+{
+   template< typename MT1, typename MT2 >
+   inline void operator()( MT1& lhs, const MT2& rhs ) const {
+      addAssign( lhs, rhs );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Final subtraction assignment of a matrix multiplication chain (\f$ C-=A*B*C \f$).
+// \ingroup math
+*/
+struct MatChainSubAssign
+{
+   template< typename MT1, typename MT2 >
+   inline void operator()( MT1& lhs, const MT2& rhs ) const {
+      subAssign( lhs, rhs );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Final SMP assignment of a matrix multiplication chain (\f$ C=A*B*C \f$).
+// \ingroup math
+*/
+struct MatChainSMPAssign
+{
+   template< typename MT1, typename MT2 >
+   inline void operator()( MT1& lhs, const MT2& rhs ) const {
+      smpAssign( lhs, rhs );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Final SMP addition assignment of a matrix multiplication chain (\f$ C+=A*B*C \f$).
+// \ingroup math
+*/
+struct MatChainSMPAddAssign
+{
+   template< typename MT1, typename MT2 >
+   inline void operator()( MT1& lhs, const MT2& rhs ) const {
+      smpAddAssign( lhs, rhs );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Final SMP subtraction assignment of a matrix multiplication chain (\f$ C-=A*B*C \f$).
+// \ingroup math
+*/
+struct MatChainSMPSubAssign
+{
+   template< typename MT1, typename MT2 >
+   inline void operator()( MT1& lhs, const MT2& rhs ) const {
+      smpSubAssign( lhs, rhs );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MATCHAIN
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime ordering and evaluation of matrix multiplication chains.
+// \ingroup math
+//
+// The MatChain class template evaluates a matrix multiplication chain \f$ A_0*A_1*...*A_{N-1} \f$
+// in the order of the least estimated number of operations. On construction, the dimensions
+// and the number of non-zero elements of all factors are determined and the optimal order is
+// computed by the classic dynamic programming approach for the matrix chain ordering problem.
+// The following costs are assumed for the multiplication of an \f$ M \times L \f$ matrix
+// \f$ X \f$ and an \f$ L \times N \f$ matrix \f$ Y \f$:
+//
+//  - dense/dense: \f$ M \cdot L \cdot N \f$
+//  - sparse/dense: \f$ nnz(X) \cdot N \f$
+//  - dense/sparse: \f$ M \cdot nnz(Y) \f$
+//  - sparse/sparse: \f$ nnz(X) \cdot nnz(Y) / L \f$
+//
+// All intermediate results are stored in matrices of type \a TT, which are taken from the
+// thread-local MatChainBuffer pool. In case of equal costs the left-to-right order is kept.
+*/
+template< typename MT    // Type of the matrix multiplication chain
+        , typename TT >  // Type of the intermediate results
+class MatChain
+{
+ public:
+   //**********************************************************************************************
+   //! Number of factors of the matrix multiplication chain.
+   enum : size_t { N = MatChainLength<MT>::value };
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( N > 2UL );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the MatChain class.
+   //
+   // \param chain The matrix multiplication chain to be evaluated.
+   */
+   explicit inline MatChain( const MT& chain )
+      : chain_( chain )  // The matrix multiplication chain
+   {
+      collect( IntegralConstant<size_t,0UL>() );
+      plan();
+   }
+   //**********************************************************************************************
+
+   //**Split function******************************************************************************
+   /*!\brief Returns the optimal split of the given subchain.
+   //
+   // \param i The index of the first factor of the subchain.
+   // \param j The index of the last factor of the subchain.
+   // \return The index of the last factor of the left-hand side part of the subchain.
+   */
+   inline size_t split( size_t i, size_t j ) const noexcept {
+      BLAZE_INTERNAL_ASSERT( i < j && j < N, "Invalid subchain" );
+      return split_[i][j];
+   }
+   //**********************************************************************************************
+
+   //**Evaluate function***************************************************************************
+   /*!\brief Evaluation of the matrix multiplication chain.
+   //
+   // \param target The target of the final multiplication.
+   // \param op The assignment operation for the final multiplication.
+   // \return void
+   //
+   // This function evaluates all intermediate results of the chain and passes the final
+   // multiplication expression to the given assignment operation. In case \a SMP is set to
+   // \a true, the intermediate results are computed by means of SMP assignments.
+   */
+   template< bool SMP         // Compilation switch for SMP assignments
+           , typename MT2     // Type of the target matrix
+           , typename OP >    // Type of the assignment operation
+   inline void evaluate( MT2& target, OP op ) const
+   {
+      const size_t k( split_[0UL][N-1UL] );
+
+      if( k == 0UL ) {
+         MatChainBuffer<TT> rhs;
+         compute<SMP>( 1UL, N-1UL, *rhs );
+         op( target, factor<0UL>() * (*rhs) );
+      }
+      else if( k == N-2UL ) {
+         MatChainBuffer<TT> lhs;
+         compute<SMP>( 0UL, N-2UL, *lhs );
+         op( target, (*lhs) * factor<N-1UL>() );
+      }
+      else {
+         MatChainBuffer<TT> lhs;
+         MatChainBuffer<TT> rhs;
+         compute<SMP>( 0UL, k, *lhs );
+         compute<SMP>( k+1UL, N-1UL, *rhs );
+         op( target, (*lhs) * (*rhs) );
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Factor function*****************************************************************************
+   /*!\brief Returns the \a I-th factor of the matrix multiplication chain.
+   //
+   // \return The \a I-th factor.
+   */
+   template< size_t I >
+   inline typename MatChainFactor<MT,I>::Type factor() const {
+      return MatChainFactor<MT,I>::get( chain_ );
+   }
+   //**********************************************************************************************
+
+   //**Collect functions***************************************************************************
+   /*!\brief Determines the dimensions and the number of non-zero elements of the \a I-th factor.
+   //
+   // \return void
+   */
+   template< size_t I >
+   inline void collect( IntegralConstant<size_t,I> )
+   {
+      typedef typename MatChainFactor<MT,I>::Type  FT;
+
+      FT mat( factor<I>() );
+
+      rows_    [I] = mat.rows();
+      columns_ [I] = mat.columns();
+      nonZeros_[I] = estimate( mat );
+      sparse_  [I] = IsSparseMatrix< Decay_<FT> >::value;
+
+      collect( IntegralConstant<size_t,I+1UL>() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief End of the recursive collection of the factor properties.
+   //
+   // \return void
+   */
+   inline void collect( IntegralConstant<size_t,N> ) noexcept
+   {}
+   //**********************************************************************************************
+
+   //**Estimate functions**************************************************************************
+   /*!\brief Returns the number of elements of a dense factor.
+   //
+   // \param mat The dense factor.
+   // \return The total number of elements.
+   */
+   template< typename MT2  // Type of the dense matrix
+           , bool SO >     // Storage order of the dense matrix
+   static inline double estimate( const DenseMatrix<MT2,SO>& mat ) noexcept {
+      return double( (~mat).rows() ) * double( (~mat).columns() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the number of non-zero elements of a sparse factor.
+   //
+   // \param mat The sparse factor.
+   // \return The number of non-zero elements.
+   */
+   template< typename MT2  // Type of the sparse matrix
+           , bool SO >     // Storage order of the sparse matrix
+   static inline double estimate( const SparseMatrix<MT2,SO>& mat ) {
+      return double( (~mat).nonZeros() );
+   }
+   //**********************************************************************************************
+
+   //**Plan function*******************************************************************************
+   /*!\brief Computes the optimal order of the matrix multiplication chain.
+   //
+   // \return void
+   */
+   inline void plan() noexcept
+   {
+      double costs[N][N];  // Estimated costs of all subchains
+      double nnz  [N][N];  // Estimated number of non-zero elements of all subchains
+
+      for( size_t i=0UL; i<N; ++i ) {
+         costs [i][i] = 0.0;
+         nnz   [i][i] = nonZeros_[i];
+         split_[i][i] = i;
+      }
+
+      for( size_t n=1UL; n<N; ++n ) {
+         for( size_t i=0UL; i+n<N; ++i )
+         {
+            const size_t j( i+n );
+
+            for( size_t k=j; k>i; --k )
+            {
+               const double cost( costs[i][k-1UL] + costs[k][j] +
+                                  multCosts( i, k-1UL, j, nnz[i][k-1UL], nnz[k][j] ) );
+
+               if( k == j || cost < costs[i][j] ) {
+                  costs [i][j] = cost;
+                  split_[i][j] = k-1UL;
+               }
+            }
+
+            const size_t k( split_[i][j] );
+            nnz[i][j] = resultNonZeros( i, k, j, nnz[i][k], nnz[k+1UL][j] );
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Sparsity function***************************************************************************
+   /*!\brief Returns whether the result of the given subchain is a sparse matrix.
+   //
+   // \param i The index of the first factor of the subchain.
+   // \param j The index of the last factor of the subchain.
+   // \return \a true in case the result is sparse, \a false if not.
+   */
+   inline bool isSparse( size_t i, size_t j ) const noexcept {
+      return ( i == j )?( sparse_[i] ):( IsSparseMatrix<TT>::value );
+   }
+   //**********************************************************************************************
+
+   //**Multiplication costs************************************************************************
+   /*!\brief Estimates the costs of the multiplication of two subchains.
+   //
+   // \param i The index of the first factor of the left-hand side subchain.
+   // \param k The index of the last factor of the left-hand side subchain.
+   // \param j The index of the last factor of the right-hand side subchain.
+   // \param lnnz The estimated number of non-zero elements of the left-hand side subchain.
+   // \param rnnz The estimated number of non-zero elements of the right-hand side subchain.
+   // \return The estimated number of multiply-add operations.
+   */
+   inline double multCosts( size_t i, size_t k, size_t j, double lnnz, double rnnz ) const noexcept
+   {
+      const double m( rows_[i] );
+      const double l( columns_[k] );
+      const double n( columns_[j] );
+
+      const bool lsparse( isSparse( i, k ) );
+      const bool rsparse( isSparse( k+1UL, j ) );
+
+      if( lsparse && rsparse )
+         return ( l > 0.0 )?( lnnz * rnnz / l ):( 0.0 );
+      else if( lsparse )
+         return lnnz * n;
+      else if( rsparse )
+         return m * rnnz;
+      else
+         return m * l * n;
+   }
+   //**********************************************************************************************
+
+   //**Result non-zeros****************************************************************************
+   /*!\brief Estimates the number of non-zero elements of the product of two subchains.
+   //
+   // \param i The index of the first factor of the left-hand side subchain.
+   // \param k The index of the last factor of the left-hand side subchain.
+   // \param j The index of the last factor of the right-hand side subchain.
+   // \param lnnz The estimated number of non-zero elements of the left-hand side subchain.
+   // \param rnnz The estimated number of non-zero elements of the right-hand side subchain.
+   // \return The estimated number of non-zero elements of the product.
+   */
+   inline double resultNonZeros( size_t i, size_t k, size_t j, double lnnz, double rnnz ) const noexcept
+   {
+      const double m( rows_[i] );
+      const double l( columns_[k] );
+      const double n( columns_[j] );
+
+      if( !IsSparseMatrix<TT>::value || l == 0.0 )
+         return ( IsSparseMatrix<TT>::value )?( 0.0 ):( m * n );
+
+      const double nnz( lnnz * rnnz / l );
+      return ( nnz < m * n )?( nnz ):( m * n );
+   }
+   //**********************************************************************************************
+
+   //**Compute function****************************************************************************
+   /*!\brief Evaluation of the given subchain into the given intermediate result.
+   //
+   // \param i The index of the first factor of the subchain.
+   // \param j The index of the last factor of the subchain.
+   // \param result The intermediate result.
+   // \return void
+   */
+   template< bool SMP >  // Compilation switch for SMP assignments
+   void compute( size_t i, size_t j, TT& result ) const
+   {
+      BLAZE_INTERNAL_ASSERT( i < j && j < N, "Invalid subchain" );
+
+      const size_t k( split_[i][j] );
+
+      if( k == i && k+1UL == j ) {
+         multiplyFactors<SMP>( i, result, IntegralConstant<size_t,0UL>() );
+      }
+      else if( k == i ) {
+         MatChainBuffer<TT> rhs;
+         compute<SMP>( k+1UL, j, *rhs );
+         multiplyLeft<SMP>( i, *rhs, result, IntegralConstant<size_t,0UL>() );
+      }
+      else if( k+1UL == j ) {
+         MatChainBuffer<TT> lhs;
+         compute<SMP>( i, k, *lhs );
+         multiplyRight<SMP>( *lhs, j, result, IntegralConstant<size_t,0UL>() );
+      }
+      else {
+         MatChainBuffer<TT> lhs;
+         MatChainBuffer<TT> rhs;
+         compute<SMP>( i, k, *lhs );
+         compute<SMP>( k+1UL, j, *rhs );
+         multiply( result, *lhs, *rhs, BoolConstant<SMP>() );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Multiplication of two adjacent factors******************************************************
+   /*!\brief Multiplication of the two adjacent factors \a i and \a i+1.
+   //
+   // \param i The index of the left-hand side factor.
+   // \param result The intermediate result.
+   // \return void
+   */
+   template< bool SMP     // Compilation switch for SMP assignments
+           , size_t I >   // Index of the currently checked factor
+   inline void multiplyFactors( size_t i, TT& result, IntegralConstant<size_t,I> ) const
+   {
+      if( i == I )
+         multiply( result, factor<I>(), factor<I+1UL>(), BoolConstant<SMP>() );
+      else
+         multiplyFactors<SMP>( i, result, IntegralConstant<size_t,I+1UL>() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief End of the recursive multiplication of two adjacent factors.
+   //
+   // \return void
+   */
+   template< bool SMP >  // Compilation switch for SMP assignments
+   inline void multiplyFactors( size_t, TT&, IntegralConstant<size_t,N-1UL> ) const noexcept
+   {}
+   //**********************************************************************************************
+
+   //**Multiplication of a factor and an intermediate result***************************************
+   /*!\brief Multiplication of the factor \a i and an intermediate result.
+   //
+   // \param i The index of the left-hand side factor.
+   // \param rhs The right-hand side intermediate result.
+   // \param result The intermediate result.
+   // \return void
+   */
+   template< bool SMP     // Compilation switch for SMP assignments
+           , size_t I >   // Index of the currently checked factor
+   inline void multiplyLeft( size_t i, const TT& rhs, TT& result, IntegralConstant<size_t,I> ) const
+   {
+      if( i == I )
+         multiply( result, factor<I>(), rhs, BoolConstant<SMP>() );
+      else
+         multiplyLeft<SMP>( i, rhs, result, IntegralConstant<size_t,I+1UL>() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief End of the recursive multiplication of a factor and an intermediate result.
+   //
+   // \return void
+   */
+   template< bool SMP >  // Compilation switch for SMP assignments
+   inline void multiplyLeft( size_t, const TT&, TT&, IntegralConstant<size_t,N> ) const noexcept
+   {}
+   //**********************************************************************************************
+
+   //**Multiplication of an intermediate result and a factor***************************************
+   /*!\brief Multiplication of an intermediate result and the factor \a j.
+   //
+   // \param lhs The left-hand side intermediate result.
+   // \param j The index of the right-hand side factor.
+   // \param result The intermediate result.
+   // \return void
+   */
+   template< bool SMP     // Compilation switch for SMP assignments
+           , size_t I >   // Index of the currently checked factor
+   inline void multiplyRight( const TT& lhs, size_t j, TT& result, IntegralConstant<size_t,I> ) const
+   {
+      if( j == I )
+         multiply( result, lhs, factor<I>(), BoolConstant<SMP>() );
+      else
+         multiplyRight<SMP>( lhs, j, result, IntegralConstant<size_t,I+1UL>() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief End of the recursive multiplication of an intermediate result and a factor.
+   //
+   // \return void
+   */
+   template< bool SMP >  // Compilation switch for SMP assignments
+   inline void multiplyRight( const TT&, size_t, TT&, IntegralConstant<size_t,N> ) const noexcept
+   {}
+   //**********************************************************************************************
+
+   //**Multiply functions**************************************************************************
+   /*!\brief Serial multiplication of two matrices into an intermediate result.
+   //
+   // \param result The intermediate result.
+   // \param A The left-hand side matrix operand.
+   // \param B The right-hand side matrix operand.
+   // \return void
+   */
+   template< typename MT1    // Type of the left-hand side matrix operand
+           , typename MT2 >  // Type of the right-hand side matrix operand
+   static inline void multiply( TT& result, const MT1& A, const MT2& B, FalseType ) {
+      result = serial( A * B );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief SMP multiplication of two matrices into an intermediate result.
+   //
+   // \param result The intermediate result.
+   // \param A The left-hand side matrix operand.
+   // \param B The right-hand side matrix operand.
+   // \return void
+   */
+   template< typename MT1    // Type of the left-hand side matrix operand
+           , typename MT2 >  // Type of the right-hand side matrix operand
+   static inline void multiply( TT& result, const MT1& A, const MT2& B, TrueType ) {
+      result = A * B;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const MT& chain_;        //!< The matrix multiplication chain.
+   size_t rows_    [N];     //!< The number of rows of all factors.
+   size_t columns_ [N];     //!< The number of columns of all factors.
+   double nonZeros_[N];     //!< The (estimated) number of non-zero elements of all factors.
+   bool   sparse_  [N];     //!< Sparsity flags of all factors.
+   size_t split_   [N][N];  //!< Optimal splits of all subchains.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -47,6 +47,7 @@
 #include <blaze/math/constraints/RowMajorMatrix.h>
 #include <blaze/math/constraints/SparseMatrix.h>
 #include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/dispatch/SpMV.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -54,18 +55,24 @@
 #include <blaze/math/expressions/MatVecMultExpr.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/SymmetricKernels.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/math/typetraits/Size.h>
+#include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Reference.h>
@@ -75,6 +82,8 @@
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -151,6 +160,40 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the element type and the index type of a row-major compact matrix and the type of
+       the dense vector are suited for a gather-based computation of the matrix/vector product,
+       the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseGatherKernel {
+      enum : bool { value = useOptimizedKernels &&
+                            HasConstDataAccess<T3>::value &&
+                            IsIntegral<T2>::value && sizeof( T2 ) == 4UL &&
+                            ( IsSame<T1,float>::value || IsSame<T1,double>::value ) &&
+                            IsSame< T1, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case neither the matrix nor the vector operand requires an intermediate evaluation, the
+       matrix operand is a symmetric sparse matrix and the element types of all involved types
+       are identical, the nested \a value will be set to 1 and the multiplication is evaluated
+       by means of the symmetric kernel (see symv()), otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseSymmetricKernel {
+      enum : bool { value = useOptimizedKernels && !useAssign &&
+                            IsSymmetric<T2>::value && !IsDiagonal<T2>::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef SMatDVecMultExpr<MT,VT>     This;           //!< Type of this SMatDVecMultExpr instance.
@@ -206,7 +249,7 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    */
    inline ReturnType operator[]( size_t index ) const {
       BLAZE_INTERNAL_ASSERT( index < mat_.rows(), "Invalid vector access index" );
-      return row( mat_, index ) * vec_;
+      return selectSubscriptKernel( mat_, vec_, index );
    }
    //**********************************************************************************************
 
@@ -305,6 +348,94 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    RightOperand vec_;  //!< Right-hand side dense vector of the multiplication expression.
    //**********************************************************************************************
 
+   //**Default subscript kernel********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default computation of a single element of the sparse matrix-dense vector product.
+   // \ingroup dense_vector
+   //
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param i The index of the element to be computed.
+   // \return The resulting value.
+   */
+   template< typename MT1    // Type of the left-hand side matrix operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline ElementType selectSubscriptKernel( const MT1& A, const VT1& x, size_t i )
+   {
+      return row( A, i ) * x;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Gather-based subscript kernel***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Gather-based computation of a single element of the compact matrix-dense vector
+   //        product.
+   // \ingroup dense_vector
+   //
+   // \param A The left-hand side compact matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param i The index of the element to be computed.
+   // \return The resulting value.
+   //
+   // This function implements the computation of a single element of a row-major compact
+   // matrix-dense vector multiplication. Due to the separate value and index arrays of the
+   // compact matrix, the values of row \a i can be loaded as a contiguous SIMD vector, whereas
+   // the according elements of the dense vector are collected via a single gather operation.
+   // Since the gather operation interprets the indices as signed 32-bit integers, the SIMD
+   // computation is only applied in case the number of columns doesn't exceed \f$ 2^{31} \f$.
+   // In case a more powerful instruction set than the compile time instruction set is available
+   // at runtime, the computation is relayed to the according gather kernel (see dispatchSpMV()).
+   // The SMP backends also compute the parts of a parallel evaluation via this kernel.
+   */
+   template< typename ET     // Element type of the left-hand side compact matrix
+           , typename IT     // Index type of the left-hand side compact matrix
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseGatherKernel<ET,IT,VT1>, ElementType >
+      selectSubscriptKernel( const CompactMatrix<ET,false,IT>& A, const VT1& x, size_t i )
+   {
+      typedef SIMDTrait_<ET>  SIMDType;
+
+      const size_t SIMDSIZE( SIMDType::size );
+
+      const ET* const values ( A.values()  );
+      const IT* const indices( A.indices() );
+      const ET* const data   ( x.data()    );
+
+      const size_t kend( A.offset( i+1UL ) );
+      size_t k( A.offset( i ) );
+
+      ElementType value = ElementType();
+
+      if( A.columns() <= 2147483648UL )
+      {
+         if( dispatchSpMV( values+k, indices+k, kend-k, data, value ) )
+            return value;
+
+         SIMDType xmm1, xmm2;
+
+         for( ; (k+SIMDSIZE*2UL) <= kend; k+=SIMDSIZE*2UL ) {
+            xmm1 += loadu( values+k          ) * gather( data, indices+k          );
+            xmm2 += loadu( values+k+SIMDSIZE ) * gather( data, indices+k+SIMDSIZE );
+         }
+
+         if( k+SIMDSIZE <= kend ) {
+            xmm1 += loadu( values+k ) * gather( data, indices+k );
+            k += SIMDSIZE;
+         }
+
+         value = sum( xmm1 + xmm2 );
+      }
+
+      for( ; k<kend; ++k ) {
+         value += values[k] * data[indices[k]];
+      }
+
+      return value;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense vectors*****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-dense vector multiplication to a dense vector
@@ -347,6 +478,37 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Assignment to dense vectors (symmetric kernel)**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a symmetric sparse matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the assignment of a sparse matrix-dense vector multiplication
+   // expression with symmetric matrix operand to a dense vector by means of the symmetric kernel,
+   // which traverses only the lower triangle of the matrix (see symv()). Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler in
+   // case the symmetric kernel is applicable.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSymmetricKernel<VT1,MT,VT> >
+      assign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      reset( ~lhs );
+
+      symv( ~lhs, rhs.mat_, rhs.vec_, ElementType_<VT1>( 1 ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-dense vector multiplication to a sparse vector
@@ -422,6 +584,35 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Addition assignment to dense vectors (symmetric kernel)*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a symmetric sparse matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the addition assignment of a sparse matrix-dense vector
+   // multiplication expression with symmetric matrix operand to a dense vector by means of the
+   // symmetric kernel, which traverses only the lower triangle of the matrix (see symv()). Due to
+   // the explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the symmetric kernel is applicable.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSymmetricKernel<VT1,MT,VT> >
+      addAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      symv( ~lhs, rhs.mat_, rhs.vec_, ElementType_<VT1>( 1 ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -467,6 +658,35 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Subtraction assignment to dense vectors (symmetric kernel)**********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a symmetric sparse matrix-dense vector multiplication from a
+   //        dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the subtraction assignment of a sparse matrix-dense vector
+   // multiplication expression with symmetric matrix operand to a dense vector by means of the
+   // symmetric kernel, which traverses only the lower triangle of the matrix (see symv()). Due to
+   // the explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the symmetric kernel is applicable.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSymmetricKernel<VT1,MT,VT> >
+      subAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      symv( ~lhs, rhs.mat_, rhs.vec_, ElementType_<VT1>( -1 ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -588,6 +808,33 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to dense vectors (symmetric kernel)******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a symmetric sparse matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the SMP assignment of a sparse matrix-dense vector multiplication
+   // expression with symmetric matrix operand to a dense vector. The operation is not wrapped in a
+   // parallel section since the symmetric kernel distributes the work among the available threads
+   // itself (see symv()). Due to the explicit application of the SFINAE principle, this function
+   // can only be selected by the compiler in case the symmetric kernel is applicable.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSymmetricKernel<VT1,MT,VT> >
+      smpAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      assign( ~lhs, rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse vectors************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a sparse matrix-dense vector multiplication to a sparse vector
@@ -661,6 +908,34 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP addition assignment to dense vectors (symmetric kernel)*********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a symmetric sparse matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the SMP addition assignment of a sparse matrix-dense vector
+   // multiplication expression with symmetric matrix operand to a dense vector. The operation is
+   // not wrapped in a parallel section since the symmetric kernel distributes the work among the
+   // available threads itself (see symv()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the symmetric kernel is
+   // applicable.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSymmetricKernel<VT1,MT,VT> >
+      smpAddAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      addAssign( ~lhs, rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse vectors***************************************************
    // No special implementation for the SMP addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -705,6 +980,34 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP subtraction assignment to dense vectors (symmetric kernel)******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a symmetric sparse matrix-dense vector multiplication
+   //        from a dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the SMP subtraction assignment of a sparse matrix-dense vector
+   // multiplication expression with symmetric matrix operand to a dense vector. The operation is
+   // not wrapped in a parallel section since the symmetric kernel distributes the work among the
+   // available threads itself (see symv()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the symmetric kernel is
+   // applicable.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSymmetricKernel<VT1,MT,VT> >
+      smpSubAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      subAssign( ~lhs, rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to sparse vectors************************************************
    // No special implementation for the SMP subtraction assignment to sparse vectors.
    //**********************************************************************************************
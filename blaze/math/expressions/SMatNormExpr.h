@@ -0,0 +1,299 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/SMatNormExpr.h
+//  \brief Header file for the sparse matrix norm functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_SMATNORMEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_SMATNORMEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/SMatForEachExpr.h>
+#include <blaze/math/expressions/SMatReduceExpr.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/SqrAbs.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/sparse/SparseMatrix.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the squared L2 norm for the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the norm computation.
+// \return The squared L2 norm of the given sparse matrix.
+//
+// This function computes the squared L2 norm of the given sparse matrix, i.e. the sum of the
+// squared absolute values of all elements:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+   const double l2 = sqrNorm( A );
+   \endcode
+//
+// Note that all matrix norms are computed element-wise, i.e. the given sparse matrix is treated as a
+// vector of all its elements (e.g. the norm() function computes the Frobenius norm).
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline decltype(auto) sqrNorm( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sum( forEach( ~sm, SqrAbs() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L2 norm for the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the norm computation.
+// \return The L2 norm of the given sparse matrix.
+//
+// This function computes the L2 norm (i.e. the Euclidean norm) of the given sparse matrix:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+   const double l2 = norm( A );
+   \endcode
+//
+// Note that all matrix norms are computed element-wise, i.e. the given sparse matrix is treated as a
+// vector of all its elements (e.g. the norm() function computes the Frobenius norm).
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline decltype(auto) norm( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sqrt( sqrNorm( ~sm ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L1 norm for the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the norm computation.
+// \return The L1 norm of the given sparse matrix.
+//
+// This function computes the L1 norm of the given sparse matrix, i.e. the sum of the absolute
+// values of all elements:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+   const double l1 = l1Norm( A );
+   \endcode
+//
+// Note that all matrix norms are computed element-wise, i.e. the given sparse matrix is treated as a
+// vector of all its elements (e.g. the norm() function computes the Frobenius norm).
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline decltype(auto) l1Norm( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sum( forEach( ~sm, Abs() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the maximum norm for the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the norm computation.
+// \return The maximum norm of the given sparse matrix.
+//
+// This function computes the maximum norm (i.e. the infinity norm) of the given sparse matrix, i.e.
+// the largest absolute value of all elements:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+   const double linf = maxNorm( A );
+   \endcode
+//
+// Note that all matrix norms are computed element-wise, i.e. the given sparse matrix is treated as a
+// vector of all its elements (e.g. the norm() function computes the Frobenius norm).
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline decltype(auto) maxNorm( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return max( forEach( ~sm, Abs() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the squared L2 norm of each row or column of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the norm computation.
+// \return The row-wise or column-wise squared L2 norms of the given sparse matrix.
+//
+// This function computes the squared L2 norm of each row (in case \a RF is set to blaze::rowwise)
+// or each column (in case \a RF is set to blaze::columnwise) of the given sparse matrix:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+   blaze::DynamicVector<double,columnVector> rownorms = sqrNorm<rowwise>( A );
+   blaze::DynamicVector<double,rowVector> colnorms = sqrNorm<columnwise>( A );
+   \endcode
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline decltype(auto) sqrNorm( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sum<RF>( forEach( ~sm, SqrAbs() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L2 norm of each row or column of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the norm computation.
+// \return The row-wise or column-wise L2 norms of the given sparse matrix.
+//
+// This function computes the L2 norm of each row (in case \a RF is set to blaze::rowwise)
+// or each column (in case \a RF is set to blaze::columnwise) of the given sparse matrix:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+   blaze::DynamicVector<double,columnVector> rownorms = norm<rowwise>( A );
+   blaze::DynamicVector<double,rowVector> colnorms = norm<columnwise>( A );
+   \endcode
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline decltype(auto) norm( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sqrt( sqrNorm<RF>( ~sm ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L1 norm of each row or column of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the norm computation.
+// \return The row-wise or column-wise L1 norms of the given sparse matrix.
+//
+// This function computes the L1 norm of each row (in case \a RF is set to blaze::rowwise)
+// or each column (in case \a RF is set to blaze::columnwise) of the given sparse matrix:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+   blaze::DynamicVector<double,columnVector> rownorms = l1Norm<rowwise>( A );
+   blaze::DynamicVector<double,rowVector> colnorms = l1Norm<columnwise>( A );
+   \endcode
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline decltype(auto) l1Norm( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sum<RF>( forEach( ~sm, Abs() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the maximum norm of each row or column of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the norm computation.
+// \return The row-wise or column-wise maximum norms of the given sparse matrix.
+//
+// This function computes the maximum norm of each row (in case \a RF is set to blaze::rowwise)
+// or each column (in case \a RF is set to blaze::columnwise) of the given sparse matrix:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+   blaze::DynamicVector<double,columnVector> rownorms = maxNorm<rowwise>( A );
+   blaze::DynamicVector<double,rowVector> colnorms = maxNorm<columnwise>( A );
+   \endcode
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline decltype(auto) maxNorm( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return max<RF>( forEach( ~sm, Abs() ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1939 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/SMatReduceExpr.h
+//  \brief Header file for the sparse matrix reduction functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_SMATREDUCEEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_SMATREDUCEEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/ColumnVector.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/RowVector.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatReduceExpr.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/expressions/SVecReduceExpr.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Maximum.h>
+#include <blaze/math/functors/Minimum.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/SubmatrixExprTrait.h>
+#include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/math/typetraits/Size.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SMATREDUCEEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Base template for row-wise and column-wise reduction operations of sparse matrices.
+// \ingroup dense_vector_expression
+//
+// The SMatReduceExpr class template represents the compile time expression for partial
+// reduction operations of sparse matrices. The reduction flag \a RF selects between row-wise
+// (blaze::rowwise) and column-wise (blaze::columnwise) reductions. Only these two reduction
+// flags are supported by means of specializations.
+*/
+template< typename MT  // Type of the sparse matrix
+        , typename OP  // Type of the reduction operation
+        , size_t RF >  // Reduction flag
+class SMatReduceExpr;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR COLUMN-WISE REDUCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for column-wise sparse matrix reduction operations.
+// \ingroup dense_vector_expression
+//
+// This specialization of the SMatReduceExpr class template represents the compile time
+// expression for column-wise reduction operations of sparse matrices. The result of the reduction
+// is a row vector of size \a N, which contains the reductions of the \a N columns of
+// the \f$ M \times N \f$ sparse matrix.
+*/
+template< typename MT    // Type of the sparse matrix
+        , typename OP >  // Type of the reduction operation
+class SMatReduceExpr<MT,OP,columnwise>
+   : public DenseVector< SMatReduceExpr<MT,OP,columnwise>, true >
+   , private MatReduceExpr
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef ResultType_<MT>     RT;  //!< Result type of the sparse matrix expression.
+   typedef CompositeType_<MT>  CT;  //!< Composite type of the sparse matrix expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the sparse matrix expression.
+   enum : bool { evaluateMatrix = RequiresEvaluation<MT>::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSMPAssign struct is a helper struct for the selection of the parallel evaluation
+       strategy. In case the sparse matrix operand requires an intermediate evaluation, the
+       nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename VT >
+   struct UseSMPAssign {
+      enum : bool { value = evaluateMatrix };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef SMatReduceExpr<MT,OP,columnwise>      This;           //!< Type of this SMatReduceExpr instance.
+   typedef DynamicVector<ElementType_<RT>,true>  ResultType;     //!< Result type for expression template evaluations.
+   typedef TransposeType_<ResultType>            TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef ElementType_<ResultType>              ElementType;    //!< Resulting element type.
+   typedef const ElementType                     ReturnType;     //!< Return type for expression template evaluations.
+   typedef const ResultType                      CompositeType;  //!< Data type for composite expression templates.
+
+   //! Composite type of the sparse matrix expression.
+   typedef If_< IsExpression<MT>, const MT, const MT& >  Operand;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = false };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = !evaluateMatrix && MT::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SMatReduceExpr class.
+   //
+   // \param sm The sparse matrix operand of the reduction expression.
+   // \param op The reduction operation.
+   */
+   explicit inline SMatReduceExpr( const MT& sm, OP op ) noexcept
+      : sm_( sm )  // Sparse matrix of the reduction expression
+      , op_( op )  // The reduction operation
+   {}
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Subscript operator for the direct access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator[]( size_t index ) const {
+      BLAZE_INTERNAL_ASSERT( index < sm_.columns(), "Invalid vector access index" );
+      return reduce( column( sm_, index ), op_ );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid vector access index.
+   */
+   inline ReturnType at( size_t index ) const {
+      if( index >= sm_.columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+      }
+      return (*this)[index];
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current size/dimension of the vector.
+   //
+   // \return The size of the vector.
+   */
+   inline size_t size() const noexcept {
+      return sm_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the sparse matrix operand.
+   //
+   // \return The sparse matrix operand.
+   */
+   inline Operand operand() const noexcept {
+      return sm_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the reduction operation.
+   //
+   // \return A copy of the reduction operation.
+   */
+   inline OP operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an aliasing effect is possible, \a false if not.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( sm_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the given alias is contained in this expression, \a false if not.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( sm_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return sm_.canSMPAssign() || ( size() > SMP_TDVECSMATMULT_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand sm_;  //!< Sparse matrix of the reduction expression.
+   OP      op_;  //!< The reduction operation.
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a column-wise sparse matrix reduction operation to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a column-wise sparse matrix
+   // reduction expression to a dense vector. The traversal order is chosen based on the storage
+   // order of the sparse matrix operand such that the non-zero elements are always traversed
+   // in storage order.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void assign( DenseVector<VT1,true>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.sm_.columns() == 0UL ) {
+         return;
+      }
+      else if( rhs.sm_.rows() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      CT A( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.sm_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.sm_.columns(), "Invalid number of columns" );
+
+      smatcolumnreduce( ~lhs, A, rhs.op_ );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse vectors****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a column-wise sparse matrix reduction operation to a sparse vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a column-wise sparse matrix
+   // reduction expression to a sparse vector.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline void assign( SparseVector<VT1,true>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a column-wise sparse matrix reduction operation to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a column-wise
+   // sparse matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void addAssign( DenseVector<VT1,true>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      addAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse vectors*******************************************************
+   // No special implementation for the addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a column-wise sparse matrix reduction operation to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a column-wise
+   // sparse matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void subAssign( DenseVector<VT1,true>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      subAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse vectors****************************************************
+   // No special implementation for the subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplication assignment of a column-wise sparse matrix reduction operation to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized multiplication assignment of a column-wise
+   // sparse matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void multAssign( DenseVector<VT1,true>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      multAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse vectors*************************************************
+   // No special implementation for the multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Division assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Division assignment of a column-wise sparse matrix reduction operation to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized division assignment of a column-wise
+   // sparse matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void divAssign( DenseVector<VT1,true>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      divAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Division assignment to sparse vectors*******************************************************
+   // No special implementation for the division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a column-wise sparse matrix reduction operation to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a column-wise dense
+   // matrix reduction expression to a dense vector. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpAssign( DenseVector<VT1,true>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.sm_.columns() == 0UL ) {
+         return;
+      }
+      else if( rhs.sm_.rows() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      const RT tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
+      smpAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse vectors************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a column-wise sparse matrix reduction operation to a sparse vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a column-wise dense
+   // matrix reduction expression to a sparse vector. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpAssign( SparseVector<VT1,true>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a column-wise sparse matrix reduction operation to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a
+   // column-wise sparse matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpAddAssign( DenseVector<VT1,true>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse vectors***************************************************
+   // No special implementation for the SMP addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a column-wise sparse matrix reduction operation to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a
+   // column-wise sparse matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpSubAssign( DenseVector<VT1,true>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse vectors************************************************
+   // No special implementation for the SMP subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP multiplication assignment of a column-wise sparse matrix reduction operation to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized SMP multiplication assignment of a
+   // column-wise sparse matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpMultAssign( DenseVector<VT1,true>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpMultAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to sparse vectors*********************************************
+   // No special implementation for the SMP multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP division assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP division assignment of a column-wise sparse matrix reduction operation to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized SMP division assignment of a
+   // column-wise sparse matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpDivAssign( DenseVector<VT1,true>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpDivAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP division assignment to sparse vectors***************************************************
+   // No special implementation for the SMP division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR ROW-WISE REDUCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for row-wise sparse matrix reduction operations.
+// \ingroup dense_vector_expression
+//
+// This specialization of the SMatReduceExpr class template represents the compile time
+// expression for row-wise reduction operations of sparse matrices. The result of the reduction
+// is a column vector of size \a M, which contains the reductions of the \a M rows of
+// the \f$ M \times N \f$ sparse matrix.
+*/
+template< typename MT    // Type of the sparse matrix
+        , typename OP >  // Type of the reduction operation
+class SMatReduceExpr<MT,OP,rowwise>
+   : public DenseVector< SMatReduceExpr<MT,OP,rowwise>, false >
+   , private MatReduceExpr
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef ResultType_<MT>     RT;  //!< Result type of the sparse matrix expression.
+   typedef CompositeType_<MT>  CT;  //!< Composite type of the sparse matrix expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the sparse matrix expression.
+   enum : bool { evaluateMatrix = RequiresEvaluation<MT>::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSMPAssign struct is a helper struct for the selection of the parallel evaluation
+       strategy. In case the sparse matrix operand requires an intermediate evaluation, the
+       nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename VT >
+   struct UseSMPAssign {
+      enum : bool { value = evaluateMatrix };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef SMatReduceExpr<MT,OP,rowwise>          This;           //!< Type of this SMatReduceExpr instance.
+   typedef DynamicVector<ElementType_<RT>,false>  ResultType;     //!< Result type for expression template evaluations.
+   typedef TransposeType_<ResultType>             TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef ElementType_<ResultType>               ElementType;    //!< Resulting element type.
+   typedef const ElementType                      ReturnType;     //!< Return type for expression template evaluations.
+   typedef const ResultType                       CompositeType;  //!< Data type for composite expression templates.
+
+   //! Composite type of the sparse matrix expression.
+   typedef If_< IsExpression<MT>, const MT, const MT& >  Operand;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = false };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = !evaluateMatrix && MT::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SMatReduceExpr class.
+   //
+   // \param sm The sparse matrix operand of the reduction expression.
+   // \param op The reduction operation.
+   */
+   explicit inline SMatReduceExpr( const MT& sm, OP op ) noexcept
+      : sm_( sm )  // Sparse matrix of the reduction expression
+      , op_( op )  // The reduction operation
+   {}
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Subscript operator for the direct access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..M-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator[]( size_t index ) const {
+      BLAZE_INTERNAL_ASSERT( index < sm_.rows(), "Invalid vector access index" );
+      return reduce( row( sm_, index ), op_ );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..M-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid vector access index.
+   */
+   inline ReturnType at( size_t index ) const {
+      if( index >= sm_.rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+      }
+      return (*this)[index];
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current size/dimension of the vector.
+   //
+   // \return The size of the vector.
+   */
+   inline size_t size() const noexcept {
+      return sm_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the sparse matrix operand.
+   //
+   // \return The sparse matrix operand.
+   */
+   inline Operand operand() const noexcept {
+      return sm_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the reduction operation.
+   //
+   // \return A copy of the reduction operation.
+   */
+   inline OP operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an aliasing effect is possible, \a false if not.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( sm_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the given alias is contained in this expression, \a false if not.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( sm_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return sm_.canSMPAssign() || ( size() > SMP_SMATDVECMULT_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand sm_;  //!< Sparse matrix of the reduction expression.
+   OP      op_;  //!< The reduction operation.
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a row-wise sparse matrix reduction operation to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a row-wise sparse matrix
+   // reduction expression to a dense vector. The traversal order is chosen based on the storage
+   // order of the sparse matrix operand such that the non-zero elements are always traversed
+   // in storage order.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void assign( DenseVector<VT1,false>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.sm_.rows() == 0UL ) {
+         return;
+      }
+      else if( rhs.sm_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      CT A( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.sm_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.sm_.columns(), "Invalid number of columns" );
+
+      smatrowreduce( ~lhs, A, rhs.op_ );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse vectors****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a row-wise sparse matrix reduction operation to a sparse vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a row-wise sparse matrix
+   // reduction expression to a sparse vector.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline void assign( SparseVector<VT1,false>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a row-wise sparse matrix reduction operation to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a row-wise
+   // sparse matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void addAssign( DenseVector<VT1,false>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      addAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse vectors*******************************************************
+   // No special implementation for the addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a row-wise sparse matrix reduction operation to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a row-wise
+   // sparse matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void subAssign( DenseVector<VT1,false>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      subAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse vectors****************************************************
+   // No special implementation for the subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplication assignment of a row-wise sparse matrix reduction operation to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized multiplication assignment of a row-wise
+   // sparse matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void multAssign( DenseVector<VT1,false>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      multAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse vectors*************************************************
+   // No special implementation for the multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Division assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Division assignment of a row-wise sparse matrix reduction operation to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized division assignment of a row-wise
+   // sparse matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void divAssign( DenseVector<VT1,false>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      divAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Division assignment to sparse vectors*******************************************************
+   // No special implementation for the division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a row-wise sparse matrix reduction operation to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a row-wise dense
+   // matrix reduction expression to a dense vector. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpAssign( DenseVector<VT1,false>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.sm_.rows() == 0UL ) {
+         return;
+      }
+      else if( rhs.sm_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      const RT tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
+      smpAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse vectors************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a row-wise sparse matrix reduction operation to a sparse vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a row-wise dense
+   // matrix reduction expression to a sparse vector. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpAssign( SparseVector<VT1,false>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a row-wise sparse matrix reduction operation to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a
+   // row-wise sparse matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpAddAssign( DenseVector<VT1,false>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse vectors***************************************************
+   // No special implementation for the SMP addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a row-wise sparse matrix reduction operation to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a
+   // row-wise sparse matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpSubAssign( DenseVector<VT1,false>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse vectors************************************************
+   // No special implementation for the SMP subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP multiplication assignment of a row-wise sparse matrix reduction operation to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized SMP multiplication assignment of a
+   // row-wise sparse matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpMultAssign( DenseVector<VT1,false>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpMultAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to sparse vectors*********************************************
+   // No special implementation for the SMP multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP division assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP division assignment of a row-wise sparse matrix reduction operation to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized SMP division assignment of a
+   // row-wise sparse matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpDivAssign( DenseVector<VT1,false>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_<ResultType> );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpDivAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP division assignment to sparse vectors***************************************************
+   // No special implementation for the SMP division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the row-wise reduction of a row-major sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param lhs The target column vector.
+// \param sm The given row-major sparse matrix.
+// \param op The reduction operation.
+// \return void
+//
+// This function implements the serial row-wise reduction of the given row-major sparse matrix.
+// The non-zero elements of each row are reduced directly. In case a row is not completely
+// filled, the zero elements are taken into account by a single, final application of the
+// reduction operation with a default value. Rows without non-zero elements result in the
+// default value of the element type.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename OP >  // Type of the reduction operation
+inline void smatrowreduce( DenseVector<VT,false>& lhs, const SparseMatrix<MT,rowMajor>& sm, OP op )
+{
+   typedef ElementType_<MT>      ET;
+   typedef ConstIterator_<MT>  ConstIterator;
+
+   const size_t M( (~sm).rows()    );
+   const size_t N( (~sm).columns() );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == M, "Invalid vector size" );
+
+   for( size_t i=0UL; i<M; ++i )
+   {
+      const ConstIterator end( (~sm).end(i) );
+      ConstIterator element( (~sm).begin(i) );
+
+      if( element == end ) {
+         (~lhs)[i] = ET();
+         continue;
+      }
+
+      ET redux( element->value() );
+      size_t nonzeros( 1UL );
+
+      for( ++element; element!=end; ++element, ++nonzeros ) {
+         redux = op( redux, element->value() );
+      }
+
+      if( nonzeros < N ) {
+         redux = op( redux, ET() );
+      }
+
+      (~lhs)[i] = redux;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the row-wise reduction of a column-major sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param lhs The target column vector.
+// \param sm The given column-major sparse matrix.
+// \param op The reduction operation.
+// \return void
+//
+// This function implements the serial row-wise reduction of the given column-major sparse
+// matrix. In order to traverse the non-zero elements in storage order, the target vector is
+// used as accumulator and the columns of the matrix are combined with it one after another.
+// The number of non-zero elements per row is counted to take the zero elements of partially
+// filled rows into account.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename OP >  // Type of the reduction operation
+inline void smatrowreduce( DenseVector<VT,false>& lhs, const SparseMatrix<MT,columnMajor>& sm, OP op )
+{
+   typedef ElementType_<MT>      ET;
+   typedef ConstIterator_<MT>  ConstIterator;
+
+   const size_t M( (~sm).rows()    );
+   const size_t N( (~sm).columns() );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == M, "Invalid vector size" );
+
+   std::vector<size_t> nonzeros( M, 0UL );
+
+   for( size_t j=0UL; j<N; ++j )
+   {
+      const ConstIterator end( (~sm).end(j) );
+      for( ConstIterator element=(~sm).begin(j); element!=end; ++element )
+      {
+         const size_t i( element->index() );
+
+         if( nonzeros[i] == 0UL )
+            (~lhs)[i] = element->value();
+         else
+            (~lhs)[i] = op( (~lhs)[i], element->value() );
+
+         ++nonzeros[i];
+      }
+   }
+
+   for( size_t i=0UL; i<M; ++i ) {
+      if( nonzeros[i] == 0UL )
+         (~lhs)[i] = ET();
+      else if( nonzeros[i] < N )
+         (~lhs)[i] = op( (~lhs)[i], ET() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the column-wise reduction of a row-major sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param lhs The target row vector.
+// \param sm The given row-major sparse matrix.
+// \param op The reduction operation.
+// \return void
+//
+// This function implements the serial column-wise reduction of the given row-major sparse
+// matrix. In order to traverse the non-zero elements in storage order, the target vector is
+// used as accumulator and the rows of the matrix are combined with it one after another.
+// The number of non-zero elements per column is counted to take the zero elements of partially
+// filled columns into account.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename OP >  // Type of the reduction operation
+inline void smatcolumnreduce( DenseVector<VT,true>& lhs, const SparseMatrix<MT,rowMajor>& sm, OP op )
+{
+   typedef ElementType_<MT>      ET;
+   typedef ConstIterator_<MT>  ConstIterator;
+
+   const size_t M( (~sm).rows()    );
+   const size_t N( (~sm).columns() );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == N, "Invalid vector size" );
+
+   std::vector<size_t> nonzeros( N, 0UL );
+
+   for( size_t i=0UL; i<M; ++i )
+   {
+      const ConstIterator end( (~sm).end(i) );
+      for( ConstIterator element=(~sm).begin(i); element!=end; ++element )
+      {
+         const size_t j( element->index() );
+
+         if( nonzeros[j] == 0UL )
+            (~lhs)[j] = element->value();
+         else
+            (~lhs)[j] = op( (~lhs)[j], element->value() );
+
+         ++nonzeros[j];
+      }
+   }
+
+   for( size_t j=0UL; j<N; ++j ) {
+      if( nonzeros[j] == 0UL )
+         (~lhs)[j] = ET();
+      else if( nonzeros[j] < M )
+         (~lhs)[j] = op( (~lhs)[j], ET() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the column-wise reduction of a column-major sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param lhs The target row vector.
+// \param sm The given column-major sparse matrix.
+// \param op The reduction operation.
+// \return void
+//
+// This function implements the serial column-wise reduction of the given column-major sparse
+// matrix. The non-zero elements of each column are reduced directly. In case a column is not
+// completely filled, the zero elements are taken into account by a single, final application
+// of the reduction operation with a default value. Columns without non-zero elements result
+// in the default value of the element type.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename OP >  // Type of the reduction operation
+inline void smatcolumnreduce( DenseVector<VT,true>& lhs, const SparseMatrix<MT,columnMajor>& sm, OP op )
+{
+   typedef ElementType_<MT>      ET;
+   typedef ConstIterator_<MT>  ConstIterator;
+
+   const size_t M( (~sm).rows()    );
+   const size_t N( (~sm).columns() );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == N, "Invalid vector size" );
+
+   for( size_t j=0UL; j<N; ++j )
+   {
+      const ConstIterator end( (~sm).end(j) );
+      ConstIterator element( (~sm).begin(j) );
+
+      if( element == end ) {
+         (~lhs)[j] = ET();
+         continue;
+      }
+
+      ET redux( element->value() );
+      size_t nonzeros( 1UL );
+
+      for( ++element; element!=end; ++element, ++nonzeros ) {
+         redux = op( redux, element->value() );
+      }
+
+      if( nonzeros < M ) {
+         redux = op( redux, ET() );
+      }
+
+      (~lhs)[j] = redux;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a custom reduction operation on the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the non-zero elements of the given sparse matrix \a sm by means of the
+// given reduction operation \a op:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   const double totalsum1 = reduce( A, blaze::Add() );
+   const double totalsum2 = reduce( A, []( double a, double b ){ return a + b; } );
+   \endcode
+
+// In case the sparse matrix is not completely filled, the zero elements are taken into account
+// by a single, final application of the reduction operation with a default value (e.g. 0 in
+// case of fundamental data types). Please note that the evaluation order of the reduction
+// operation is unspecified. Thus the behavior is non-deterministic if \a op is not associative
+// or not commutative. Also, the operation is undefined if the given reduction operation
+// modifies the values. In case the given matrix has either 0 rows or 0 columns or doesn't
+// contain any non-zero elements, the function returns the default value of the element type.
+*/
+template< typename MT    // Type of the sparse matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline ElementType_<MT> reduce( const SparseMatrix<MT,SO>& sm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef ElementType_<MT>    ET;
+   typedef CompositeType_<MT>  CT;
+   typedef ConstIterator_< RemoveReference_<CT> >  ConstIterator;
+
+   CT tmp( ~sm );  // Evaluation of the sparse matrix operand
+
+   const size_t M( tmp.rows()    );
+   const size_t N( tmp.columns() );
+
+   ET redux{};
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<( SO == rowMajor ? M : N ); ++i )
+   {
+      const ConstIterator end( tmp.end(i) );
+      ConstIterator element( tmp.begin(i) );
+
+      for( ; element!=end; ++element, ++nonzeros ) {
+         if( nonzeros == 0UL )
+            redux = element->value();
+         else
+            redux = op( redux, element->value() );
+      }
+   }
+
+   if( nonzeros != 0UL && nonzeros < M*N ) {
+      redux = op( redux, ET() );
+   }
+
+   return redux;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given sparse matrix by means of addition.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the reduction computation.
+// \return The sum of all matrix elements.
+
+   \code
+   blaze::CompressedMatrix<int> A{ { 1, 2 }, { 3, 4 } };
+
+   const int totalsum = sum( A );  // Results in 10
+   \endcode
+
+// In case the given matrix has either 0 rows or 0 columns, the function returns the default
+// value of the element type (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline ElementType_<MT> sum( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~sm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given sparse matrix by means of multiplication.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the reduction computation.
+// \return The product of all matrix elements.
+
+   \code
+   blaze::CompressedMatrix<int> A{ { 1, 2 }, { 3, 4 } };
+
+   const int totalprod = prod( A );  // Results in 24
+   \endcode
+
+// Note that the product of a sparse matrix that is not completely filled is 0. In case the
+// given matrix has either 0 rows or 0 columns, the function returns the default value of the
+// element type (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline ElementType_<MT> prod( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~sm, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a custom reduction operation on the given sparse matrix in the given dimension.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the rows or columns of the given sparse matrix \a sm by means of the
+// given reduction operation \a op. In case the reduction flag \a RF is set to blaze::columnwise,
+// the elements of each column are reduced and the result is a row vector:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double,rowVector> colsum;
+   // ... Resizing and initialization
+
+   colsum = reduce<columnwise>( A, blaze::Add() );
+   \endcode
+
+// In case \a RF is set to blaze::rowwise, the elements of each row are reduced and the result
+// is a column vector:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double,columnVector> rowsum;
+   // ... Resizing and initialization
+
+   rowsum = reduce<rowwise>( A, blaze::Add() );
+   \endcode
+
+// The function returns an expression representing the reduction. The non-zero elements of the
+// matrix are always traversed in storage order: the rows/columns of the matrix that match its
+// storage order are reduced directly, whereas in the opposite case the rows/columns are
+// accumulated into the target vector. In case a row or column is not completely filled, the
+// zero elements are taken into account by a single, final application of the reduction
+// operation with a default value (e.g. 0 in case of fundamental data types).
+//
+// Please note that the evaluation order of the reduction operation is unspecified. Thus the
+// behavior is non-deterministic if \a op is not associative or not commutative. Also, the
+// operation is undefined if the given reduction operation modifies the values. In case the
+// reduced rows or columns are empty, the corresponding elements of the result are set to the
+// default value of the element type (e.g. 0 in case of fundamental data types).
+*/
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the sparse matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline const SMatReduceExpr<MT,OP,RF> reduce( const SparseMatrix<MT,SO>& sm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return SMatReduceExpr<MT,OP,RF>( ~sm, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given sparse matrix by means of addition in the given dimension.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the reduction computation.
+// \return The row-wise or column-wise sums of the matrix elements.
+
+   \code
+   blaze::CompressedMatrix<int> A{ { 1, 2 }, { 3, 4 } };
+
+   blaze::DynamicVector<int,rowVector> colsum;
+   blaze::DynamicVector<int,columnVector> rowsum;
+
+   colsum = sum<columnwise>( A );  // Results in ( 4, 6 )
+   rowsum = sum<rowwise>( A );     // Results in ( 3, 7 )
+   \endcode
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline const SMatReduceExpr<MT,Add,RF> sum( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~sm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given sparse matrix by means of multiplication in the given dimension.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the reduction computation.
+// \return The row-wise or column-wise products of the matrix elements.
+
+   \code
+   blaze::CompressedMatrix<int> A{ { 1, 2 }, { 3, 4 } };
+
+   blaze::DynamicVector<int,rowVector> colprod;
+   blaze::DynamicVector<int,columnVector> rowprod;
+
+   colprod = prod<columnwise>( A );  // Results in ( 3, 8 )
+   rowprod = prod<rowwise>( A );     // Results in ( 2, 12 )
+   \endcode
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline const SMatReduceExpr<MT,Mult,RF> prod( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~sm, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the smallest element of each row or column of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix.
+// \return The smallest elements of the rows or columns.
+
+   \code
+   blaze::CompressedMatrix<int> A{ { 1, 4 }, { 3, 2 } };
+
+   blaze::DynamicVector<int,rowVector> colmin;
+   blaze::DynamicVector<int,columnVector> rowmin;
+
+   colmin = min<columnwise>( A );  // Results in ( 1, 2 )
+   rowmin = min<rowwise>( A );     // Results in ( 1, 2 )
+   \endcode
+
+// This function can only be used for element types that support the smaller-than relationship.
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline const SMatReduceExpr<MT,Minimum,RF> min( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~sm, Minimum() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the largest element of each row or column of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix.
+// \return The largest elements of the rows or columns.
+
+   \code
+   blaze::CompressedMatrix<int> A{ { 1, 4 }, { 3, 2 } };
+
+   blaze::DynamicVector<int,rowVector> colmax;
+   blaze::DynamicVector<int,columnVector> rowmax;
+
+   colmax = max<columnwise>( A );  // Results in ( 3, 4 )
+   rowmax = max<rowwise>( A );     // Results in ( 4, 3 )
+   \endcode
+
+// This function can only be used for element types that support the smaller-than relationship.
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline const SMatReduceExpr<MT,Maximum,RF> max( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~sm, Maximum() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SIZE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, typename OP >
+struct Size< SMatReduceExpr<MT,OP,columnwise> > : public Columns<MT>
+{};
+
+template< typename MT, typename OP >
+struct Size< SMatReduceExpr<MT,OP,rowwise> > : public Rows<MT>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, typename OP, size_t RF, bool AF >
+struct SubvectorExprTrait< SMatReduceExpr<MT,OP,RF>, AF >
+{
+ public:
+   //**********************************************************************************************
+   using Type = SMatReduceExpr< RemoveReference_< SubmatrixExprTrait_<const MT,AF> >, OP, RF >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
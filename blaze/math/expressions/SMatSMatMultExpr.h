@@ -40,8 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <algorithm>
-#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/RowMajorMatrix.h>
@@ -53,10 +51,9 @@
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
-#include <blaze/math/Infinity.h>
 #include <blaze/math/shims/IsDefault.h>
-#include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/SparseAccumulator.h>
 #include <blaze/math/traits/ColumnExprTrait.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
@@ -73,6 +70,7 @@
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsRowVector.h>
@@ -466,7 +464,10 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
    // \return void
    //
    // This function implements the performance optimized assignment of a sparse matrix-sparse
-   // matrix multiplication expression to a row-major sparse matrix.
+   // matrix multiplication expression to a row-major sparse matrix. The multiplication is
+   // performed row by row (Gustavson's algorithm) in two phases: The symbolic phase computes
+   // the exact number of non-zero elements of the result, which is reserved at once, the
+   // numeric phase computes the rows of the result via a SparseAccumulator.
    */
    template< typename MT >  // Type of the target sparse matrix
    friend inline void assign( SparseMatrix<MT,false>& lhs, const SMatSMatMultExpr& rhs )
@@ -476,9 +477,6 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      typedef ConstIterator_< RemoveReference_<CT1> >  LeftIterator;
-      typedef ConstIterator_< RemoveReference_<CT2> >  RightIterator;
-
       CT1 A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side sparse matrix operand
       CT2 B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
 
@@ -489,89 +487,20 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
 
-      // (Over-)Estimating the number of non-zero entries in the resulting matrix
+      SparseAccumulator<ElementType> accumulator( (~lhs).columns() );
+
+      // Symbolic phase: computing the exact number of non-zero elements of the result
       size_t nonzeros( 0UL );
 
       for( size_t i=0UL; i<(~lhs).rows(); ++i ) {
-         const LeftIterator lend( A.end(i) );
-         for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
-            nonzeros += B.nonZeros( lelem->index() );
-         }
-      }
-
-      if( nonzeros > (~lhs).rows() * (~lhs).columns() ) {
-         nonzeros = (~lhs).rows() * (~lhs).columns();
+         nonzeros += accumulator.count( A, B, i );
       }
 
       (~lhs).reserve( nonzeros );
-      nonzeros = 0UL;
-
-      // Performing the matrix-matrix multiplication
-      std::vector<ElementType> values ( (~lhs).columns(), ElementType() );
-      std::vector<byte_t>      valid  ( (~lhs).columns(), 0   );
-      std::vector<size_t>      indices( (~lhs).columns(), 0UL );
-      size_t minIndex( inf ), maxIndex( 0UL );
-
-      for( size_t i=0UL; i<(~lhs).rows(); ++i )
-      {
-         const LeftIterator lend( A.end(i) );
-         for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem )
-         {
-            const RightIterator rend( B.end( lelem->index() ) );
-            for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
-            {
-               if( !valid[relem->index()] ) {
-                  values[relem->index()] = lelem->value() * relem->value();
-                  valid [relem->index()] = 1;
-                  indices[nonzeros] = relem->index();
-                  ++nonzeros;
-                  if( relem->index() < minIndex ) minIndex = relem->index();
-                  if( relem->index() > maxIndex ) maxIndex = relem->index();
-               }
-               else {
-                  values[relem->index()] += lelem->value() * relem->value();
-               }
-            }
-         }
-
-         BLAZE_INTERNAL_ASSERT( nonzeros <= (~lhs).columns(), "Invalid number of non-zero elements" );
-
-         if( nonzeros > 0UL )
-         {
-            BLAZE_INTERNAL_ASSERT( minIndex <= maxIndex, "Invalid index detected" );
-
-            if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) )
-            {
-               std::sort( indices.begin(), indices.begin() + nonzeros );
-
-               for( size_t j=0UL; j<nonzeros; ++j )
-               {
-                  const size_t index( indices[j] );
-                  if( !isDefault( values[index] ) ) {
-                     (~lhs).append( i, index, values[index] );
-                     reset( values[index] );
-                  }
-
-                  reset( valid [index] );
-               }
-            }
-            else {
-               for( size_t j=minIndex; j<=maxIndex; ++j )
-               {
-                  if( !isDefault( values[j] ) ) {
-                     (~lhs).append( i, j, values[j] );
-                     reset( values[j] );
-                  }
-
-                  reset( valid [j] );
-               }
-            }
-
-            nonzeros = 0UL;
-            minIndex = inf;
-            maxIndex = 0UL;
-         }
 
+      // Numeric phase: computing the result row by row
+      for( size_t i=0UL; i<(~lhs).rows(); ++i ) {
+         accumulator.multiply( ~lhs, A, B, i );
          (~lhs).finalize( i );
       }
    }
@@ -1148,7 +1077,8 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
 */
 template< typename T1    // Type of the left-hand side sparse matrix
         , typename T2 >  // Type of the right-hand side sparse matrix
-inline const SMatSMatMultExpr<T1,T2>
+inline const DisableIf_< Or< IsMatMatMultExpr<T1>, IsMatMatMultExpr<T2> >
+                       , SMatSMatMultExpr<T1,T2> >
    operator*( const SparseMatrix<T1,false>& lhs, const SparseMatrix<T2,false>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
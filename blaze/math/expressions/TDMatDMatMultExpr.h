@@ -48,6 +48,9 @@
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/RowMajorMatrix.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/BandKernels.h>
+#include <blaze/math/dense/MMM.h>
+#include <blaze/math/dense/PackedKernels.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -77,6 +80,7 @@
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsBanded.h>
 #include <blaze/math/typetraits/IsBLASCompatible.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsColumnVector.h>
@@ -86,6 +90,8 @@
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsPacked.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsRowVector.h>
 #include <blaze/math/typetraits/IsSparseVector.h>
@@ -97,6 +103,7 @@
 #include <blaze/math/typetraits/IsUniLower.h>
 #include <blaze/math/typetraits/IsUniUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/typetraits/RemoveAdaptor.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/system/BLAS.h>
@@ -225,6 +232,57 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case all three involved data types are suited for the packed matrix multiplication
+       kernel, the nested \value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UsePackedKernel {
+      enum : bool { value = usePackedKernels &&
+                            UseVectorizedDefaultKernel<T1,T2,T3>::value &&
+                            !IsDiagonal<T2>::value && !IsDiagonal<T3>::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case either of the two matrix operands is stored in packed format (see PackedMatrix)
+       and the target matrix provides direct access to its elements, the nested \a value will
+       be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UsePackedStorageKernel {
+      enum : bool { value = HasMutableDataAccess<T1>::value &&
+                            ( IsPacked< RemoveAdaptor_<T2> >::value || IsPacked< RemoveAdaptor_<T3> >::value ) &&
+                            !IsDiagonal<T2>::value && !IsDiagonal<T3>::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case either of the two matrix operands is stored in band format (see BandMatrix) and
+       the target matrix is either a band matrix itself (in case both operands are band matrices)
+       or provides direct access to its elements, the nested \a value will be set to 1, otherwise
+       it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseBandKernel {
+      enum : bool { value = ( IsBanded<T2>::value || IsBanded<T3>::value ) &&
+                            ( ( IsBanded<T1>::value && IsBanded<T2>::value && IsBanded<T3>::value ) ||
+                              HasMutableDataAccess<T1>::value ) &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef TDMatDMatMultExpr<MT1,MT2>  This;           //!< Type of this TDMatDMatMultExpr instance.
@@ -499,8 +557,16 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<MT3,MT4,MT5>::value ) {
+         reset( C );
+         selectPackedStorageKernel( C, A, B, ElementType_<MT3>( 1 ) );
+      }
+      else if( UseBandKernel<MT3,MT4,MT5>::value ) {
+         reset( C );
+         selectBandKernel( C, A, B, ElementType_<MT3>( 1 ) );
+      }
+      else if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
+               ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
          selectSmallAssignKernel( C, A, B );
       else
          selectBlasAssignKernel( C, A, B );
@@ -508,6 +574,97 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Default packed storage kernel***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default fallback for the packed storage kernel of the transpose dense matrix-dense
+   //        matrix multiplication.
+   // \ingroup dense_matrix
+   //
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UsePackedStorageKernel<MT3,MT4,MT5> >
+      selectPackedStorageKernel( MT3& /*C*/, const MT4& /*A*/, const MT5& /*B*/, ST2 /*alpha*/ )
+   {}
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed storage kernel***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed storage kernel for a transpose dense matrix-dense matrix multiplication
+   //        (\f$ C+=\alpha*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the packed storage kernel (see pmm()), which reads
+   // each stored element of the packed matrix operand only once, also in case of a symmetric or
+   // Hermitian matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UsePackedStorageKernel<MT3,MT4,MT5> >
+      selectPackedStorageKernel( MT3& C, const MT4& A, const MT5& B, ST2 alpha )
+   {
+      pmm( C, A, B, alpha );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default band kernel*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default fallback for the band kernel of the transpose dense matrix-dense
+   //        matrix multiplication.
+   // \ingroup dense_matrix
+   //
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UseBandKernel<MT3,MT4,MT5> >
+      selectBandKernel( MT3& /*C*/, const MT4& /*A*/, const MT5& /*B*/, ST2 /*alpha*/ )
+   {}
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band kernel*********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Band kernel for a transpose dense matrix-dense matrix multiplication
+   //        (\f$ C+=\alpha*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the band kernel (see bmm()), which only touches
+   // the stored diagonals of the band matrix operands.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UseBandKernel<MT3,MT4,MT5> >
+      selectBandKernel( MT3& C, const MT4& A, const MT5& B, ST2 alpha )
+   {
+      bmm( C, A, B, alpha );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to row-major dense matrices (general/general)****************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a general transpose dense matrix-general dense matrix
@@ -1597,7 +1754,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5> > > >
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
       const size_t M( A.rows()    );
@@ -1869,7 +2027,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5> > > >
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
       const size_t M( A.rows()    );
@@ -2123,6 +2282,32 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed assignment to dense matrices (large matrices)****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed assignment of a large transpose dense matrix-dense matrix multiplication
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the packed, cache- and register-blocked implementation of the
+   // assignment of a large transpose dense matrix-dense matrix multiplication expression to a dense
+   // matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< UsePackedKernel<MT3,MT4,MT5> >
+      selectLargeAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      mmm( C, A, B, ElementType_<MT3>(1), ElementType_<MT3>(0) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense matrices (default)*******************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a transpose dense matrix-dense matrix multiplication
@@ -2281,8 +2466,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<MT3,MT4,MT5>::value ) {
+         selectPackedStorageKernel( C, A, B, ElementType_<MT3>( 1 ) );
+      }
+      else if( UseBandKernel<MT3,MT4,MT5>::value ) {
+         selectBandKernel( C, A, B, ElementType_<MT3>( 1 ) );
+      }
+      else if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
+               ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
          selectSmallAddAssignKernel( C, A, B );
       else
          selectBlasAddAssignKernel( C, A, B );
@@ -3329,7 +3520,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5> > > >
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
       const size_t M( A.rows()    );
@@ -3595,7 +3787,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5> > > >
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
       const size_t M( A.rows()    );
@@ -3843,6 +4036,32 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed addition assignment to dense matrices (large matrices)*******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed addition assignment of a large transpose dense matrix-dense matrix
+   //        multiplication (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the packed, cache- and register-blocked implementation of the addition
+   // assignment of a large transpose dense matrix-dense matrix multiplication expression to a dense
+   // matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< UsePackedKernel<MT3,MT4,MT5> >
+      selectLargeAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      mmm( C, A, B, ElementType_<MT3>(1), ElementType_<MT3>(1) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense matrices (default)**********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a transpose dense matrix-dense matrix multiplication
@@ -3970,8 +4189,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<MT3,MT4,MT5>::value ) {
+         selectPackedStorageKernel( C, A, B, ElementType_<MT3>( -1 ) );
+      }
+      else if( UseBandKernel<MT3,MT4,MT5>::value ) {
+         selectBandKernel( C, A, B, ElementType_<MT3>( -1 ) );
+      }
+      else if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
+               ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
          selectSmallSubAssignKernel( C, A, B );
       else
          selectBlasSubAssignKernel( C, A, B );
@@ -5018,7 +5243,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5> > > >
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
       const size_t M( A.rows()    );
@@ -5284,7 +5510,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5> > > >
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
       const size_t M( A.rows()    );
@@ -5532,6 +5759,32 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed subtraction assignment to dense matrices (large matrices)****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed subtraction assignment of a large transpose dense matrix-dense matrix
+   //        multiplication (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the packed, cache- and register-blocked implementation of the
+   // subtraction assignment of a large transpose dense matrix-dense matrix multiplication
+   // expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< UsePackedKernel<MT3,MT4,MT5> >
+      selectLargeSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      mmm( C, A, B, ElementType_<MT3>(-1), ElementType_<MT3>(1) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense matrices (default)*******************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a transpose dense matrix-dense matrix multiplication
@@ -5917,6 +6170,53 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case all four involved data types are suited for the packed matrix multiplication
+       kernel, the nested \value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UsePackedKernel {
+      enum : bool { value = usePackedKernels &&
+                            UseVectorizedDefaultKernel<T1,T2,T3,T4>::value &&
+                            !IsDiagonal<T2>::value && !IsDiagonal<T3>::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case either of the two matrix operands is stored in packed format (see PackedMatrix)
+       and the target matrix provides direct access to its elements, the nested \a value will
+       be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UsePackedStorageKernel {
+      enum : bool { value = HasMutableDataAccess<T1>::value &&
+                            ( IsPacked< RemoveAdaptor_<T2> >::value || IsPacked< RemoveAdaptor_<T3> >::value ) &&
+                            !IsDiagonal<T2>::value && !IsDiagonal<T3>::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value &&
+                            !( IsBuiltin< ElementType_<T1> >::value && IsComplex<T4>::value ) };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case either of the two matrix operands is stored in band format (see BandMatrix) and
+       the target matrix is either a band matrix itself (in case both operands are band matrices)
+       or provides direct access to its elements, the nested \a value will be set to 1, otherwise
+       it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseBandKernel {
+      enum : bool { value = ( IsBanded<T2>::value || IsBanded<T3>::value ) &&
+                            ( ( IsBanded<T1>::value && IsBanded<T2>::value && IsBanded<T3>::value ) ||
+                              HasMutableDataAccess<T1>::value ) &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value &&
+                            !( IsBuiltin< ElementType_<T1> >::value && IsComplex<T4>::value ) };
+   };
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DMatScalarMultExpr<MMM,ST,true>  This;           //!< Type of this DMatScalarMultExpr instance.
@@ -6159,14 +6459,105 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
            , typename ST2 >  // Type of the scalar value
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<MT3,MT4,MT5,ST2>::value ) {
+         reset( C );
+         selectPackedStorageKernel( C, A, B, scalar );
+      }
+      else if( UseBandKernel<MT3,MT4,MT5,ST2>::value ) {
+         reset( C );
+         selectBandKernel( C, A, B, scalar );
+      }
+      else if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
+               ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
          selectSmallAssignKernel( C, A, B, scalar );
       else
          selectBlasAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
 
+   //**Default packed storage kernel***************************************************************
+   /*!\brief Default fallback for the packed storage kernel of the scaled transpose dense
+   //        matrix-dense matrix multiplication.
+   // \ingroup dense_matrix
+   //
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UsePackedStorageKernel<MT3,MT4,MT5,ST2> >
+      selectPackedStorageKernel( MT3& /*C*/, const MT4& /*A*/, const MT5& /*B*/, ST2 /*alpha*/ )
+   {}
+   //**********************************************************************************************
+
+   //**Packed storage kernel***********************************************************************
+   /*!\brief Packed storage kernel for a scaled transpose dense matrix-dense matrix multiplication
+   //        (\f$ C+=\alpha*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the packed storage kernel (see pmm()), which reads
+   // each stored element of the packed matrix operand only once, also in case of a symmetric or
+   // Hermitian matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UsePackedStorageKernel<MT3,MT4,MT5,ST2> >
+      selectPackedStorageKernel( MT3& C, const MT4& A, const MT5& B, ST2 alpha )
+   {
+      pmm( C, A, B, alpha );
+   }
+   //**********************************************************************************************
+
+   //**Default band kernel*************************************************************************
+   /*!\brief Default fallback for the band kernel of the scaled transpose dense
+   //        matrix-dense matrix multiplication.
+   // \ingroup dense_matrix
+   //
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UseBandKernel<MT3,MT4,MT5,ST2> >
+      selectBandKernel( MT3& /*C*/, const MT4& /*A*/, const MT5& /*B*/, ST2 /*alpha*/ )
+   {}
+   //**********************************************************************************************
+
+   //**Band kernel*********************************************************************************
+   /*!\brief Band kernel for a scaled transpose dense matrix-dense matrix multiplication
+   //        (\f$ C+=\alpha*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the band kernel (see bmm()), which only touches
+   // the stored diagonals of the band matrix operands.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UseBandKernel<MT3,MT4,MT5,ST2> >
+      selectBandKernel( MT3& C, const MT4& A, const MT5& B, ST2 alpha )
+   {
+      bmm( C, A, B, alpha );
+   }
+   //**********************************************************************************************
+
    //**Default assignment to row-major dense matrices (general/general)****************************
    /*!\brief Default assignment of a scaled general transpose dense matrix-general dense matrix
    //        multiplication (\f$ C=s*A*B \f$).
@@ -7289,7 +7680,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       const size_t M( A.rows()    );
@@ -7542,7 +7934,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       const size_t M( A.rows()    );
@@ -7776,6 +8169,32 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    }
    //**********************************************************************************************
 
+   //**Packed assignment to dense matrices (large matrices)****************************************
+   /*!\brief Packed assignment of a large scaled transpose dense matrix-dense matrix multiplication
+   //        (\f$ C=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the packed, cache- and register-blocked implementation of the
+   // assignment of a large scaled transpose dense matrix-dense matrix multiplication expression to
+   // a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UsePackedKernel<MT3,MT4,MT5,ST2> >
+      selectLargeAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      mmm( C, A, B, ElementType_<MT3>(scalar), ElementType_<MT3>(0) );
+   }
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense matrices (default)*******************************************
    /*!\brief Default assignment of a scaled transpose dense matrix-dense matrix multiplication
    //        (\f$ C=s*A*B \f$).
@@ -7934,8 +8353,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
            , typename ST2 >  // Type of the scalar value
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<MT3,MT4,MT5,ST2>::value ) {
+         selectPackedStorageKernel( C, A, B, scalar );
+      }
+      else if( UseBandKernel<MT3,MT4,MT5,ST2>::value ) {
+         selectBandKernel( C, A, B, scalar );
+      }
+      else if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
+               ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
          selectSmallAddAssignKernel( C, A, B, scalar );
       else
          selectBlasAddAssignKernel( C, A, B, scalar );
@@ -8848,7 +9273,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       const size_t M( A.rows()    );
@@ -9095,7 +9521,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       const size_t M( A.rows()    );
@@ -9323,6 +9750,32 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    }
    //**********************************************************************************************
 
+   //**Packed addition assignment to dense matrices (large matrices)*******************************
+   /*!\brief Packed addition assignment of a large scaled transpose dense matrix-dense matrix
+   //        multiplication (\f$ C+=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the packed, cache- and register-blocked implementation of the addition
+   // assignment of a large scaled transpose dense matrix-dense matrix multiplication expression to
+   // a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UsePackedKernel<MT3,MT4,MT5,ST2> >
+      selectLargeAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      mmm( C, A, B, ElementType_<MT3>(scalar), ElementType_<MT3>(1) );
+   }
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense matrices (default)**********************************
    /*!\brief Default addition assignment of a scaled transpose dense matrix-dense matrix
    //        multiplication (\f$ C+=s*A*B \f$).
@@ -9452,8 +9905,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
            , typename ST2 >  // Type of the scalar value
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<MT3,MT4,MT5,ST2>::value ) {
+         selectPackedStorageKernel( C, A, B, -scalar );
+      }
+      else if( UseBandKernel<MT3,MT4,MT5,ST2>::value ) {
+         selectBandKernel( C, A, B, -scalar );
+      }
+      else if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
+               ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
          selectSmallSubAssignKernel( C, A, B, scalar );
       else
          selectBlasSubAssignKernel( C, A, B, scalar );
@@ -10366,7 +10825,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       const size_t M( A.rows()    );
@@ -10613,7 +11073,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       const size_t M( A.rows()    );
@@ -10841,6 +11302,32 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    }
    //**********************************************************************************************
 
+   //**Packed subtraction assignment to dense matrices (large matrices)****************************
+   /*!\brief Packed subtraction assignment of a large scaled transpose dense matrix-dense matrix
+   //        multiplication (\f$ C-=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the packed, cache- and register-blocked implementation of the
+   // subtraction assignment of a large scaled transpose dense matrix-dense matrix multiplication
+   // expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UsePackedKernel<MT3,MT4,MT5,ST2> >
+      selectLargeSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      mmm( C, A, B, ElementType_<MT3>(-scalar), ElementType_<MT3>(1) );
+   }
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense matrices (default)*******************************
    /*!\brief Default subtraction assignment of a scaled transpose dense matrix-dense matrix
    //        multiplication (\f$ C-=s*A*B \f$).
@@ -11170,7 +11657,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 */
 template< typename T1    // Type of the left-hand side dense matrix
         , typename T2 >  // Type of the right-hand side dense matrix
-inline const TDMatDMatMultExpr<T1,T2>
+inline const DisableIf_< Or< IsMatMatMultExpr<T1>, IsMatMatMultExpr<T2> >
+                       , TDMatDMatMultExpr<T1,T2> >
    operator*( const DenseMatrix<T1,true>& lhs, const DenseMatrix<T2,false>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
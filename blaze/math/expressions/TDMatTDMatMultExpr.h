@@ -49,6 +49,10 @@
 #include <blaze/math/constraints/RowMajorMatrix.h>
 #include <blaze/math/constraints/StorageOrder.h>
 #include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/dense/BandKernels.h>
+#include <blaze/math/dense/MMM.h>
+#include <blaze/math/dense/PackedKernels.h>
+#include <blaze/math/dense/SymmetricKernels.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -75,6 +79,7 @@
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsBanded.h>
 #include <blaze/math/typetraits/IsBLASCompatible.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsColumnVector.h>
@@ -84,6 +89,8 @@
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsPacked.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsRowVector.h>
@@ -96,6 +103,7 @@
 #include <blaze/math/typetraits/IsUniLower.h>
 #include <blaze/math/typetraits/IsUniUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/typetraits/RemoveAdaptor.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/system/BLAS.h>
@@ -125,6 +133,7 @@
 #include <blaze/util/typetraits/IsFloat.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
 
 
 namespace blaze {
@@ -168,18 +177,75 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    enum : bool { evaluateRight = IsComputation<MT2>::value || RequiresEvaluation<MT2>::value };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case either of the two matrix operands is stored in packed format (see PackedMatrix)
+       and the target matrix provides direct access to its elements, the nested \a value will
+       be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UsePackedStorageKernel {
+      enum : bool { value = HasMutableDataAccess<T1>::value &&
+                            ( IsPacked< RemoveAdaptor_<T2> >::value || IsPacked< RemoveAdaptor_<T3> >::value ) &&
+                            !IsDiagonal<T2>::value && !IsDiagonal<T3>::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case either of the two matrix operands is stored in band format (see BandMatrix) and
+       the target matrix is either a band matrix itself (in case both operands are band matrices)
+       or provides direct access to its elements, the nested \a value will be set to 1, otherwise
+       it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseBandKernel {
+      enum : bool { value = ( IsBanded<T2>::value || IsBanded<T3>::value ) &&
+                            ( ( IsBanded<T1>::value && IsBanded<T2>::value && IsBanded<T3>::value ) ||
+                              HasMutableDataAccess<T1>::value ) &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the left-hand side matrix operand is a symmetric dense matrix with direct data
+       access (but not stored in packed format) and the target matrix and the right-hand side
+       matrix operand are suited for the symmetric kernel (see symm()), the nested \a value
+       will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseSymmetricKernel {
+      enum : bool { value = useOptimizedKernels &&
+                            IsSymmetric<T2>::value &&
+                            !IsPacked< RemoveAdaptor_<T2> >::value &&
+                            !IsDiagonal<T2>::value && !IsDiagonal<T3>::value &&
+                            HasConstDataAccess<T2>::value &&
+                            HasConstDataAccess<T3>::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
    /*! The CanExploitSymmetry struct is a helper struct for the selection of the optimal
        evaluation strategy. In case the target matrix is row-major and either of the two
        matrix operands is symmetric, \a value is set to 1 and an optimized evaluation
-       strategy is selected. Otherwise \a value is set to 0 and the default strategy is
-       chosen. */
+       strategy is selected. Otherwise or in case the packed storage kernel can be applied
+       \a value is set to 0 and the default strategy is chosen. */
    template< typename T1, typename T2, typename T3 >
    struct CanExploitSymmetry {
       enum : bool { value = IsRowMajorMatrix<T1>::value &&
-                            ( IsSymmetric<T2>::value || IsSymmetric<T3>::value ) };
+                            ( IsSymmetric<T2>::value || IsSymmetric<T3>::value ) &&
+                            !UsePackedStorageKernel<T1,T2,T3>::value };
    };
    /*! \endcond */
    //**********************************************************************************************
@@ -196,6 +262,22 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                             CanExploitSymmetry<T1,T2,T3>::value };
    };
    /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSymmetricSMPAssign struct is a helper struct for the selection of the parallel
+       evaluation strategy. In case no intermediate evaluation is required, no symmetry can be
+       exploited by restructuring and the symmetric kernel can be used, the nested \a value will
+       be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseSymmetricSMPAssign {
+      enum : bool { value = !IsEvaluationRequired<T1,MT1,MT2>::value &&
+                            !CanExploitSymmetry<T1,MT1,MT2>::value &&
+                            UseSymmetricKernel<T1,T2,T3>::value };
+   };
+   /*! \endcond */
    //**********************************************************************************************
 
       //**********************************************************************************************
@@ -239,6 +321,22 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case all three involved data types are suited for the packed matrix multiplication
+       kernel, the nested \value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UsePackedKernel {
+      enum : bool { value = usePackedKernels &&
+                            UseVectorizedDefaultKernel<T1,T2,T3>::value &&
+                            !IsDiagonal<T2>::value && !IsDiagonal<T3>::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef TDMatTDMatMultExpr<MT1,MT2>  This;           //!< Type of this TDMatTDMatMultExpr instance.
@@ -514,15 +612,163 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      if( ( IsDiagonal<MT4>::value ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<MT3,MT4,MT5>::value ) {
+         reset( C );
+         selectPackedStorageKernel( C, A, B, ElementType_<MT3>( 1 ) );
+      }
+      else if( UseBandKernel<MT3,MT4,MT5>::value ) {
+         reset( C );
+         selectBandKernel( C, A, B, ElementType_<MT3>( 1 ) );
+      }
+      else if( ( IsDiagonal<MT4>::value ) ||
+               ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
          selectSmallAssignKernel( C, A, B );
+      else if( UseSymmetricKernel<MT3,MT4,MT5>::value && B.columns() <= symmColumnLimit ) {
+         reset( C );
+         selectSymmetricKernel( C, A, B, ElementType_<MT3>( 1 ) );
+      }
       else
          selectBlasAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Default packed storage kernel***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default fallback for the packed storage kernel of the transpose dense matrix-transpose
+   //        dense matrix multiplication.
+   // \ingroup dense_matrix
+   //
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UsePackedStorageKernel<MT3,MT4,MT5> >
+      selectPackedStorageKernel( MT3& /*C*/, const MT4& /*A*/, const MT5& /*B*/, ST2 /*alpha*/ )
+   {}
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed storage kernel***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed storage kernel for a transpose dense matrix-transpose dense matrix
+   //        multiplication (\f$ C+=\alpha*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the packed storage kernel (see pmm()), which reads
+   // each stored element of the packed matrix operand only once, also in case of a symmetric or
+   // Hermitian matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UsePackedStorageKernel<MT3,MT4,MT5> >
+      selectPackedStorageKernel( MT3& C, const MT4& A, const MT5& B, ST2 alpha )
+   {
+      pmm( C, A, B, alpha );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default band kernel*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default fallback for the band kernel of the transpose dense matrix-transpose
+   //        dense matrix multiplication.
+   // \ingroup dense_matrix
+   //
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UseBandKernel<MT3,MT4,MT5> >
+      selectBandKernel( MT3& /*C*/, const MT4& /*A*/, const MT5& /*B*/, ST2 /*alpha*/ )
+   {}
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band kernel*********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Band kernel for a transpose dense matrix-transpose dense matrix
+   //        multiplication (\f$ C+=\alpha*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the band kernel (see bmm()), which only touches
+   // the stored diagonals of the band matrix operands.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UseBandKernel<MT3,MT4,MT5> >
+      selectBandKernel( MT3& C, const MT4& A, const MT5& B, ST2 alpha )
+   {
+      bmm( C, A, B, alpha );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default symmetric kernel********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default fallback for the symmetric kernel of the dense matrix-dense matrix
+   //        multiplication.
+   // \ingroup dense_matrix
+   //
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UseSymmetricKernel<MT3,MT4,MT5> >
+      selectSymmetricKernel( MT3& /*C*/, const MT4& /*A*/, const MT5& /*B*/, ST2 /*alpha*/ )
+   {}
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Symmetric kernel****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Symmetric kernel for a dense matrix-dense matrix multiplication
+   //        (\f$ C+=\alpha*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side symmetric multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the symmetric kernel (see symm()), which reads
+   // only one triangle of the symmetric matrix operand.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UseSymmetricKernel<MT3,MT4,MT5> >
+      selectSymmetricKernel( MT3& C, const MT4& A, const MT5& B, ST2 alpha )
+   {
+      symm( C, A, B, alpha );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to dense matrices (general/general)**************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a general transpose dense matrix-general transpose dense matrix
@@ -1161,7 +1407,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5> > > >
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
       selectSmallAssignKernel( ~C, A, B );
@@ -1187,7 +1434,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5> > > >
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
       const size_t M( A.rows()    );
@@ -1441,6 +1689,32 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed assignment to dense matrices (large matrices)****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed assignment of a large transpose dense matrix-transpose dense matrix
+   //        multiplication (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the packed, cache- and register-blocked implementation of the
+   // assignment of a large transpose dense matrix-transpose dense matrix multiplication expression
+   // to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< UsePackedKernel<MT3,MT4,MT5> >
+      selectLargeAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      mmm( C, A, B, ElementType_<MT3>(1), ElementType_<MT3>(0) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense matrices (default)*******************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a transpose dense matrix-transpose dense matrix multiplication
@@ -1637,9 +1911,18 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      if( ( IsDiagonal<MT4>::value ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<MT3,MT4,MT5>::value ) {
+         selectPackedStorageKernel( C, A, B, ElementType_<MT3>( 1 ) );
+      }
+      else if( UseBandKernel<MT3,MT4,MT5>::value ) {
+         selectBandKernel( C, A, B, ElementType_<MT3>( 1 ) );
+      }
+      else if( ( IsDiagonal<MT4>::value ) ||
+               ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
          selectSmallAddAssignKernel( C, A, B );
+      else if( UseSymmetricKernel<MT3,MT4,MT5>::value && B.columns() <= symmColumnLimit ) {
+         selectSymmetricKernel( C, A, B, ElementType_<MT3>( 1 ) );
+      }
       else
          selectBlasAddAssignKernel( C, A, B );
    }
@@ -2265,7 +2548,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5> > > >
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
       selectSmallAddAssignKernel( ~C, A, B );
@@ -2291,7 +2575,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5> > > >
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
       const size_t M( A.rows()    );
@@ -2539,6 +2824,32 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed addition assignment to dense matrices (large matrices)*******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed addition assignment of a large transpose dense matrix-transpose dense matrix
+   //        multiplication (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the packed, cache- and register-blocked implementation of the addition
+   // assignment of a large transpose dense matrix-transpose dense matrix multiplication expression
+   // to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< UsePackedKernel<MT3,MT4,MT5> >
+      selectLargeAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      mmm( C, A, B, ElementType_<MT3>(1), ElementType_<MT3>(1) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense matrices (default)**********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a transpose dense matrix-transpose dense matrix
@@ -2703,9 +3014,18 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      if( ( IsDiagonal<MT4>::value ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<MT3,MT4,MT5>::value ) {
+         selectPackedStorageKernel( C, A, B, ElementType_<MT3>( -1 ) );
+      }
+      else if( UseBandKernel<MT3,MT4,MT5>::value ) {
+         selectBandKernel( C, A, B, ElementType_<MT3>( -1 ) );
+      }
+      else if( ( IsDiagonal<MT4>::value ) ||
+               ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
          selectSmallSubAssignKernel( C, A, B );
+      else if( UseSymmetricKernel<MT3,MT4,MT5>::value && B.columns() <= symmColumnLimit ) {
+         selectSymmetricKernel( C, A, B, ElementType_<MT3>( -1 ) );
+      }
       else
          selectBlasSubAssignKernel( C, A, B );
    }
@@ -3331,7 +3651,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5> > > >
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
       selectSmallSubAssignKernel( ~C, A, B );
@@ -3357,7 +3678,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5> > > >
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
       const size_t M( A.rows()    );
@@ -3605,6 +3927,32 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed subtraction assignment to dense matrices (large matrices)****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed subtraction assignment of a large transpose dense matrix-transpose dense matrix
+   //        multiplication (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the packed, cache- and register-blocked implementation of the
+   // subtraction assignment of a large transpose dense matrix-transpose dense matrix multiplication
+   // expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< UsePackedKernel<MT3,MT4,MT5> >
+      selectLargeSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      mmm( C, A, B, ElementType_<MT3>(-1), ElementType_<MT3>(1) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense matrices (default)*******************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a transpose dense matrix-transpose dense matrix
@@ -3769,6 +4117,41 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to dense matrices (symmetric kernel)******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense matrix-dense matrix multiplication with symmetric matrix
+   //        operand to a dense matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // In case the symmetric kernel is selected for the operation, the assignment is not wrapped in a
+   // parallel section since the symmetric kernel distributes the work among the available threads
+   // itself (see smpFused()). Due to the explicit application of the SFINAE principle, this
+   // function can only be selected by the compiler in case the symmetric kernel is applicable.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseSymmetricSMPAssign< MT, RemoveReference_<LT>, RemoveReference_<RT> > >
+      smpAssign( DenseMatrix<MT,SO>& lhs, const TDMatTDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( rhs.rows() * rhs.columns() < TDMATTDMATMULT_THRESHOLD || rhs.columns() > symmColumnLimit ) {
+         smpAssign( ~lhs, static_cast<const DenseMatrix<TDMatTDMatMultExpr,true>&>( rhs ) );
+      }
+      else {
+         assign( ~lhs, rhs );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse matrices***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a transpose dense matrix-transpose dense matrix multiplication
@@ -3891,35 +4274,71 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Restructuring SMP addition assignment to row-major matrices*********************************
+   //**SMP addition assignment to dense matrices (symmetric kernel)*********************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Restructuring SMP addition assignment of a transpose dense matrix-transpose dense
-   //        matrix multiplication to a row-major matrix (\f$ C+=A*B \f$).
+   /*!\brief SMP addition assignment of a dense matrix-dense matrix multiplication with symmetric
+   //        matrix operand to a dense matrix (\f$ C+=A*B \f$).
    // \ingroup dense_matrix
    //
-   // \param lhs The target left-hand side matrix.
+   // \param lhs The target left-hand side dense matrix.
    // \param rhs The right-hand side multiplication expression to be added.
    // \return void
    //
-   // This function implements the symmetry-based restructuring SMP addition assignment of a
-   // transpose dense matrix-transpose dense matrix multiplication expression to a row-major
-   // matrix. Due to the explicit application of the SFINAE principle this function can only be
-   // selected by the compiler in case the symmetry of either of the two matrix operands can be
-   // exploited.
+   // In case the symmetric kernel is selected for the operation, the addition assignment is not
+   // wrapped in a parallel section since the symmetric kernel distributes the work among the
+   // available threads itself (see smpFused()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the symmetric kernel is
+   // applicable.
    */
-   template< typename MT >  // Type of the target matrix
-   friend inline EnableIf_< CanExploitSymmetry<MT,MT1,MT2> >
-      smpAddAssign( Matrix<MT,false>& lhs, const TDMatTDMatMultExpr& rhs )
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseSymmetricSMPAssign< MT, RemoveReference_<LT>, RemoveReference_<RT> > >
+      smpAddAssign( DenseMatrix<MT,SO>& lhs, const TDMatTDMatMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
-
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      if( IsSymmetric<MT1>::value && IsSymmetric<MT2>::value )
-         smpAddAssign( ~lhs, trans( rhs.lhs_ ) * trans( rhs.rhs_ ) );
+      if( rhs.rows() * rhs.columns() < TDMATTDMATMULT_THRESHOLD || rhs.columns() > symmColumnLimit ) {
+         smpAddAssign( ~lhs, static_cast<const DenseMatrix<TDMatTDMatMultExpr,true>&>( rhs ) );
+      }
+      else {
+         addAssign( ~lhs, rhs );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Restructuring SMP addition assignment to row-major matrices*********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Restructuring SMP addition assignment of a transpose dense matrix-transpose dense
+   //        matrix multiplication to a row-major matrix (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the symmetry-based restructuring SMP addition assignment of a
+   // transpose dense matrix-transpose dense matrix multiplication expression to a row-major
+   // matrix. Due to the explicit application of the SFINAE principle this function can only be
+   // selected by the compiler in case the symmetry of either of the two matrix operands can be
+   // exploited.
+   */
+   template< typename MT >  // Type of the target matrix
+   friend inline EnableIf_< CanExploitSymmetry<MT,MT1,MT2> >
+      smpAddAssign( Matrix<MT,false>& lhs, const TDMatTDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( IsSymmetric<MT1>::value && IsSymmetric<MT2>::value )
+         smpAddAssign( ~lhs, trans( rhs.lhs_ ) * trans( rhs.rhs_ ) );
       else if( IsSymmetric<MT1>::value )
          smpAddAssign( ~lhs, trans( rhs.lhs_ ) * rhs.rhs_ );
       else
@@ -3977,6 +4396,42 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP subtraction assignment to dense matrices (symmetric kernel)******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a dense matrix-dense matrix multiplication with
+   //        symmetric matrix operand from a dense matrix (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // In case the symmetric kernel is selected for the operation, the subtraction assignment is not
+   // wrapped in a parallel section since the symmetric kernel distributes the work among the
+   // available threads itself (see smpFused()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the symmetric kernel is
+   // applicable.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseSymmetricSMPAssign< MT, RemoveReference_<LT>, RemoveReference_<RT> > >
+      smpSubAssign( DenseMatrix<MT,SO>& lhs, const TDMatTDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( rhs.rows() * rhs.columns() < TDMATTDMATMULT_THRESHOLD || rhs.columns() > symmColumnLimit ) {
+         smpSubAssign( ~lhs, static_cast<const DenseMatrix<TDMatTDMatMultExpr,true>&>( rhs ) );
+      }
+      else {
+         subAssign( ~lhs, rhs );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring SMP subtraction assignment to row-major matrices******************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring SMP subtraction assignment of a transpose dense matrix-transpose dense
@@ -4085,17 +4540,71 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    enum : bool { evaluateRight = IsComputation<MT2>::value || RequiresEvaluation<MT2>::value };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case either of the two matrix operands is stored in packed format (see PackedMatrix)
+       and the target matrix provides direct access to its elements, the nested \a value will
+       be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UsePackedStorageKernel {
+      enum : bool { value = HasMutableDataAccess<T1>::value &&
+                            ( IsPacked< RemoveAdaptor_<T2> >::value || IsPacked< RemoveAdaptor_<T3> >::value ) &&
+                            !IsDiagonal<T2>::value && !IsDiagonal<T3>::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value &&
+                            !( IsBuiltin< ElementType_<T1> >::value && IsComplex<T4>::value ) };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case either of the two matrix operands is stored in band format (see BandMatrix) and
+       the target matrix is either a band matrix itself (in case both operands are band matrices)
+       or provides direct access to its elements, the nested \a value will be set to 1, otherwise
+       it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseBandKernel {
+      enum : bool { value = ( IsBanded<T2>::value || IsBanded<T3>::value ) &&
+                            ( ( IsBanded<T1>::value && IsBanded<T2>::value && IsBanded<T3>::value ) ||
+                              HasMutableDataAccess<T1>::value ) &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value &&
+                            !( IsBuiltin< ElementType_<T1> >::value && IsComplex<T4>::value ) };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the left-hand side matrix operand is a symmetric dense matrix with direct data
+       access (but not stored in packed format) and the target matrix and the right-hand side
+       matrix operand are suited for the symmetric kernel (see symm()), the nested \a value
+       will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseSymmetricKernel {
+      enum : bool { value = useOptimizedKernels &&
+                            IsSymmetric<T2>::value &&
+                            !IsPacked< RemoveAdaptor_<T2> >::value &&
+                            !IsDiagonal<T2>::value && !IsDiagonal<T3>::value &&
+                            HasConstDataAccess<T2>::value &&
+                            HasConstDataAccess<T3>::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value &&
+                            !( IsBuiltin< ElementType_<T1> >::value && IsComplex<T4>::value ) };
+   };
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper structure for the explicit application of the SFINAE principle.
    /*! The CanExploitSymmetry struct is a helper struct for the selection of the optimal
        evaluation strategy. In case the target matrix is row-major and either of the two
        matrix operands is symmetric, \a value is set to 1 and an optimized evaluation
-       strategy is selected. Otherwise \a value is set to 0 and the default strategy is
-       chosen. */
+       strategy is selected. Otherwise or in case the packed storage kernel can be applied
+       \a value is set to 0 and the default strategy is chosen. */
    template< typename T1, typename T2, typename T3 >
    struct CanExploitSymmetry {
       enum : bool { value = IsRowMajorMatrix<T1>::value &&
-                            ( IsSymmetric<T2>::value || IsSymmetric<T3>::value ) };
+                            ( IsSymmetric<T2>::value || IsSymmetric<T3>::value ) &&
+                            !UsePackedStorageKernel<T1,T2,T3,ST>::value };
    };
    //**********************************************************************************************
 
@@ -4111,6 +4620,20 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSymmetricSMPAssign struct is a helper struct for the selection of the parallel
+       evaluation strategy. In case no intermediate evaluation is required, no symmetry can be
+       exploited by restructuring and the symmetric kernel can be used, the nested \a value will
+       be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseSymmetricSMPAssign {
+      enum : bool { value = !IsEvaluationRequired<T1,MT1,MT2>::value &&
+                            !CanExploitSymmetry<T1,MT1,MT2>::value &&
+                            UseSymmetricKernel<T1,T2,T3,T4>::value };
+   };
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper structure for the explicit application of the SFINAE principle.
    /*! In case the types of all three involved matrices and the scalar type are suited for a BLAS
@@ -4150,6 +4673,20 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case all four involved data types are suited for the packed matrix multiplication
+       kernel, the nested \value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UsePackedKernel {
+      enum : bool { value = usePackedKernels &&
+                            UseVectorizedDefaultKernel<T1,T2,T3,T4>::value &&
+                            !IsDiagonal<T2>::value && !IsDiagonal<T3>::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DMatScalarMultExpr<MMM,ST,true>  This;           //!< Type of this DMatScalarMultExpr instance.
@@ -4393,14 +4930,150 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
            , typename ST2 >  // Type of the scalar value
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      if( ( IsDiagonal<MT4>::value ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<MT3,MT4,MT5,ST2>::value ) {
+         reset( C );
+         selectPackedStorageKernel( C, A, B, scalar );
+      }
+      else if( UseBandKernel<MT3,MT4,MT5,ST2>::value ) {
+         reset( C );
+         selectBandKernel( C, A, B, scalar );
+      }
+      else if( ( IsDiagonal<MT4>::value ) ||
+               ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
          selectSmallAssignKernel( C, A, B, scalar );
+      else if( UseSymmetricKernel<MT3,MT4,MT5,ST2>::value && B.columns() <= symmColumnLimit ) {
+         reset( C );
+         selectSymmetricKernel( C, A, B, scalar );
+      }
       else
          selectBlasAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
 
+   //**Default packed storage kernel***************************************************************
+   /*!\brief Default fallback for the packed storage kernel of the scaled transpose dense
+   //        matrix-transpose dense matrix multiplication.
+   // \ingroup dense_matrix
+   //
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UsePackedStorageKernel<MT3,MT4,MT5,ST2> >
+      selectPackedStorageKernel( MT3& /*C*/, const MT4& /*A*/, const MT5& /*B*/, ST2 /*alpha*/ )
+   {}
+   //**********************************************************************************************
+
+   //**Packed storage kernel***********************************************************************
+   /*!\brief Packed storage kernel for a scaled transpose dense matrix-transpose dense matrix
+   //        multiplication (\f$ C+=\alpha*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the packed storage kernel (see pmm()), which reads
+   // each stored element of the packed matrix operand only once, also in case of a symmetric or
+   // Hermitian matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UsePackedStorageKernel<MT3,MT4,MT5,ST2> >
+      selectPackedStorageKernel( MT3& C, const MT4& A, const MT5& B, ST2 alpha )
+   {
+      pmm( C, A, B, alpha );
+   }
+   //**********************************************************************************************
+
+   //**Default band kernel*************************************************************************
+   /*!\brief Default fallback for the band kernel of the scaled transpose dense
+   //        matrix-transpose dense matrix multiplication.
+   // \ingroup dense_matrix
+   //
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UseBandKernel<MT3,MT4,MT5,ST2> >
+      selectBandKernel( MT3& /*C*/, const MT4& /*A*/, const MT5& /*B*/, ST2 /*alpha*/ )
+   {}
+   //**********************************************************************************************
+
+   //**Band kernel*********************************************************************************
+   /*!\brief Band kernel for a scaled transpose dense matrix-transpose dense matrix
+   //        multiplication (\f$ C+=\alpha*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the band kernel (see bmm()), which only touches
+   // the stored diagonals of the band matrix operands.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UseBandKernel<MT3,MT4,MT5,ST2> >
+      selectBandKernel( MT3& C, const MT4& A, const MT5& B, ST2 alpha )
+   {
+      bmm( C, A, B, alpha );
+   }
+   //**********************************************************************************************
+
+   //**Default symmetric kernel********************************************************************
+   /*!\brief Default fallback for the symmetric kernel of the scaled dense matrix-dense matrix
+   //        multiplication.
+   // \ingroup dense_matrix
+   //
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UseSymmetricKernel<MT3,MT4,MT5,ST2> >
+      selectSymmetricKernel( MT3& /*C*/, const MT4& /*A*/, const MT5& /*B*/, ST2 /*alpha*/ )
+   {}
+   //**********************************************************************************************
+
+   //**Symmetric kernel****************************************************************************
+   /*!\brief Symmetric kernel for a scaled dense matrix-dense matrix multiplication
+   //        (\f$ C+=\alpha*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side symmetric multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the symmetric kernel (see symm()), which reads
+   // only one triangle of the symmetric matrix operand.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UseSymmetricKernel<MT3,MT4,MT5,ST2> >
+      selectSymmetricKernel( MT3& C, const MT4& A, const MT5& B, ST2 alpha )
+   {
+      symm( C, A, B, alpha );
+   }
+   //**********************************************************************************************
+
    //**Default assignment to dense matrices (general/general)**************************************
    /*!\brief Default assignment of a scaled general transpose dense matrix-general transpose
    //        dense matrix multiplication (\f$ C=s*A*B \f$).
@@ -5056,7 +5729,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       selectSmallAssignKernel( ~C, A, B, scalar );
@@ -5082,7 +5756,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       const size_t M( A.rows()    );
@@ -5316,6 +5991,32 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    }
    //**********************************************************************************************
 
+   //**Packed assignment to dense matrices (large matrices)****************************************
+   /*!\brief Packed assignment of a large scaled transpose dense matrix-transpose dense matrix
+   //        multiplication (\f$ C=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the packed, cache- and register-blocked implementation of the
+   // assignment of a large scaled transpose dense matrix-transpose dense matrix multiplication
+   // expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UsePackedKernel<MT3,MT4,MT5,ST2> >
+      selectLargeAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      mmm( C, A, B, ElementType_<MT3>(scalar), ElementType_<MT3>(0) );
+   }
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense matrices (default)*******************************************
    /*!\brief Default assignment of a scaled transpose dense matrix-transpose dense matrix
    //        multiplication (\f$ C=s*A*B \f$).
@@ -5513,9 +6214,18 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
            , typename ST2 >  // Type of the scalar value
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      if( ( IsDiagonal<MT4>::value ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<MT3,MT4,MT5,ST2>::value ) {
+         selectPackedStorageKernel( C, A, B, scalar );
+      }
+      else if( UseBandKernel<MT3,MT4,MT5,ST2>::value ) {
+         selectBandKernel( C, A, B, scalar );
+      }
+      else if( ( IsDiagonal<MT4>::value ) ||
+               ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
          selectSmallAddAssignKernel( C, A, B, scalar );
+      else if( UseSymmetricKernel<MT3,MT4,MT5,ST2>::value && B.columns() <= symmColumnLimit ) {
+         selectSymmetricKernel( C, A, B, scalar );
+      }
       else
          selectBlasAddAssignKernel( C, A, B, scalar );
    }
@@ -6087,7 +6797,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       selectSmallAddAssignKernel( ~C, A, B, scalar );
@@ -6113,7 +6824,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       const size_t M( A.rows()    );
@@ -6341,6 +7053,32 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    }
    //**********************************************************************************************
 
+   //**Packed addition assignment to dense matrices (large matrices)*******************************
+   /*!\brief Packed addition assignment of a large scaled transpose dense matrix-transpose dense
+   //        matrix multiplication (\f$ C+=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the packed, cache- and register-blocked implementation of the addition
+   // assignment of a large scaled transpose dense matrix-transpose dense matrix multiplication
+   // expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UsePackedKernel<MT3,MT4,MT5,ST2> >
+      selectLargeAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      mmm( C, A, B, ElementType_<MT3>(scalar), ElementType_<MT3>(1) );
+   }
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense matrices (default)**********************************
    /*!\brief Default addition assignment of a scaled transpose dense matrix-transpose dense matrix
    //        multiplication (\f$ C+=s*A*B \f$).
@@ -6510,9 +7248,18 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
            , typename ST2 >  // Type of the scalar value
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      if( ( IsDiagonal<MT4>::value ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<MT3,MT4,MT5,ST2>::value ) {
+         selectPackedStorageKernel( C, A, B, -scalar );
+      }
+      else if( UseBandKernel<MT3,MT4,MT5,ST2>::value ) {
+         selectBandKernel( C, A, B, -scalar );
+      }
+      else if( ( IsDiagonal<MT4>::value ) ||
+               ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
          selectSmallSubAssignKernel( C, A, B, scalar );
+      else if( UseSymmetricKernel<MT3,MT4,MT5,ST2>::value && B.columns() <= symmColumnLimit ) {
+         selectSymmetricKernel( C, A, B, -scalar );
+      }
       else
          selectBlasSubAssignKernel( C, A, B, scalar );
    }
@@ -7084,7 +7831,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       selectSmallSubAssignKernel( ~C, A, B, scalar );
@@ -7110,7 +7858,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline EnableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >
+   static inline EnableIf_< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                 , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       const size_t M( A.rows()    );
@@ -7338,6 +8087,32 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    }
    //**********************************************************************************************
 
+   //**Packed subtraction assignment to dense matrices (large matrices)****************************
+   /*!\brief Packed subtraction assignment of a large scaled transpose dense matrix-transpose dense
+   //        matrix multiplication (\f$ C-=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the packed, cache- and register-blocked implementation of the
+   // subtraction assignment of a large scaled transpose dense matrix-transpose dense matrix
+   // multiplication expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UsePackedKernel<MT3,MT4,MT5,ST2> >
+      selectLargeSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      mmm( C, A, B, ElementType_<MT3>(-scalar), ElementType_<MT3>(1) );
+   }
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense matrices (default)*******************************
    /*!\brief Default subtraction assignment of a scaled transpose dense matrix-transpose dense
    //        matrix multiplication (\f$ C-=s*A*B \f$).
@@ -7504,6 +8279,39 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    }
    //**********************************************************************************************
 
+   //**SMP assignment to dense matrices (symmetric kernel)******************************************
+   /*!\brief SMP assignment of a scaled dense matrix-dense matrix multiplication with symmetric
+   //        matrix operand to a dense matrix (\f$ C=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be assigned.
+   // \return void
+   //
+   // In case the symmetric kernel is selected for the operation, the assignment is not wrapped in a
+   // parallel section since the symmetric kernel distributes the work among the available threads
+   // itself (see smpFused()). Due to the explicit application of the SFINAE principle, this
+   // function can only be selected by the compiler in case the symmetric kernel is applicable.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseSymmetricSMPAssign< MT, RemoveReference_<LT>, RemoveReference_<RT>, ST > >
+      smpAssign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( rhs.rows() * rhs.columns() < TDMATTDMATMULT_THRESHOLD || rhs.columns() > symmColumnLimit ) {
+         smpAssign( ~lhs, static_cast<const DenseMatrix<DMatScalarMultExpr,true>&>( rhs ) );
+      }
+      else {
+         assign( ~lhs, rhs );
+      }
+   }
+   //**********************************************************************************************
+
    //**SMP assignment to sparse matrices***********************************************************
    /*!\brief SMP assignment of a scaled transpose dense matrix-transpose dense matrix
    //        multiplication to a sparse matrix (\f$ C=s*A*B \f$).
@@ -7626,6 +8434,40 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    }
    //**********************************************************************************************
 
+   //**SMP addition assignment to dense matrices (symmetric kernel)*********************************
+   /*!\brief SMP addition assignment of a scaled dense matrix-dense matrix multiplication with
+   //        symmetric matrix operand to a dense matrix (\f$ C+=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be added.
+   // \return void
+   //
+   // In case the symmetric kernel is selected for the operation, the addition assignment is not
+   // wrapped in a parallel section since the symmetric kernel distributes the work among the
+   // available threads itself (see smpFused()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the symmetric kernel is
+   // applicable.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseSymmetricSMPAssign< MT, RemoveReference_<LT>, RemoveReference_<RT>, ST > >
+      smpAddAssign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( rhs.rows() * rhs.columns() < TDMATTDMATMULT_THRESHOLD || rhs.columns() > symmColumnLimit ) {
+         smpAddAssign( ~lhs, static_cast<const DenseMatrix<DMatScalarMultExpr,true>&>( rhs ) );
+      }
+      else {
+         addAssign( ~lhs, rhs );
+      }
+   }
+   //**********************************************************************************************
+
    //**Restructuring SMP addition assignment to row-major matrices*********************************
    /*!\brief Restructuring SMP addition assignment of a scaled transpose dense matrix-transpose
    //        dense matrix multiplication to a row-major matrix (\f$ C+=s*A*B \f$).
@@ -7714,6 +8556,40 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    }
    //**********************************************************************************************
 
+   //**SMP subtraction assignment to dense matrices (symmetric kernel)******************************
+   /*!\brief SMP subtraction assignment of a scaled dense matrix-dense matrix multiplication with
+   //        symmetric matrix operand from a dense matrix (\f$ C-=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be subtracted.
+   // \return void
+   //
+   // In case the symmetric kernel is selected for the operation, the subtraction assignment is not
+   // wrapped in a parallel section since the symmetric kernel distributes the work among the
+   // available threads itself (see smpFused()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the symmetric kernel is
+   // applicable.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseSymmetricSMPAssign< MT, RemoveReference_<LT>, RemoveReference_<RT>, ST > >
+      smpSubAssign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( rhs.rows() * rhs.columns() < TDMATTDMATMULT_THRESHOLD || rhs.columns() > symmColumnLimit ) {
+         smpSubAssign( ~lhs, static_cast<const DenseMatrix<DMatScalarMultExpr,true>&>( rhs ) );
+      }
+      else {
+         subAssign( ~lhs, rhs );
+      }
+   }
+   //**********************************************************************************************
+
    //**Restructuring SMP subtraction assignment to row-major matrices******************************
    /*!\brief Restructuring SMP subtraction assignment of a scaled transpose dense matrix-transpose
    //        dense matrix multiplication to a row-major matrix (\f$ C-=s*A*B \f$).
@@ -7815,7 +8691,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 */
 template< typename T1    // Type of the left-hand side dense matrix
         , typename T2 >  // Type of the right-hand side dense matrix
-inline const TDMatTDMatMultExpr<T1,T2>
+inline const DisableIf_< Or< IsMatMatMultExpr<T1>, IsMatMatMultExpr<T2> >
+                       , TDMatTDMatMultExpr<T1,T2> >
    operator*( const DenseMatrix<T1,true>& lhs, const DenseMatrix<T2,true>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
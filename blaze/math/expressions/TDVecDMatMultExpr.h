@@ -49,6 +49,9 @@
 #include <blaze/math/constraints/RowVector.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/TVecMatMultExpr.h>
+#include <blaze/math/dense/BandKernels.h>
+#include <blaze/math/dense/PackedKernels.h>
+#include <blaze/math/dense/SymmetricKernels.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -70,16 +73,20 @@
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsBanded.h>
 #include <blaze/math/typetraits/IsBLASCompatible.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsPacked.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
 #include <blaze/math/typetraits/IsTriangular.h>
 #include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/typetraits/RemoveAdaptor.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/system/BLAS.h>
@@ -104,6 +111,7 @@
 #include <blaze/util/typetraits/IsFloat.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
 
 
 namespace blaze {
@@ -203,6 +211,76 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix operand is stored in packed format (see PackedMatrix) and the two
+       involved vector types are suited for the packed storage kernel, the nested \a value
+       will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UsePackedStorageKernel {
+      enum : bool { value = IsPacked< RemoveAdaptor_<T3> >::value &&
+                            HasMutableDataAccess<T1>::value &&
+                            HasConstDataAccess<T2>::value &&
+                            !IsDiagonal<T3>::value &&
+                            T1::simdEnabled && T2::simdEnabled &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix operand is stored in band format (see BandMatrix) and the target
+       vector provides direct access to its contiguous elements, the nested \a value will be
+       set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseBandKernel {
+      enum : bool { value = IsBanded<T3>::value &&
+                            HasMutableDataAccess<T1>::value &&
+                            T1::simdEnabled &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix operand is a symmetric dense matrix with direct data access (but not
+       stored in packed format) and the two involved vector types are suited for the symmetric
+       kernel (see symv()), the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseSymmetricKernel {
+      enum : bool { value = useOptimizedKernels &&
+                            IsSymmetric<T3>::value &&
+                            !IsPacked< RemoveAdaptor_<T3> >::value &&
+                            !IsDiagonal<T3>::value &&
+                            HasConstDataAccess<T2>::value &&
+                            HasConstDataAccess<T3>::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSymmetricSMPAssign struct is a helper struct for the selection of the parallel
+       evaluation strategy. In case no intermediate evaluation is required and the symmetric
+       kernel can be used, the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseSymmetricSMPAssign {
+      enum : bool { value = !UseSMPAssign<T1>::value &&
+                            UseSymmetricKernel<T1,T2,T3>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef TDVecDMatMultExpr<VT,MT>    This;           //!< Type of this TDVecDMatMultExpr instance.
@@ -443,16 +521,163 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
            , typename MT1 >  // Type of the right-hand side matrix operand
    static inline void selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
-      if( ( IsDiagonal<MT1>::value ) ||
-          ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<VT1,VT2,MT1>::value ) {
+         reset( y );
+         selectPackedStorageKernel( y, x, A, ElementType_<VT1>( 1 ) );
+      }
+      else if( UseBandKernel<VT1,VT2,MT1>::value ) {
+         reset( y );
+         selectBandKernel( y, x, A, ElementType_<VT1>( 1 ) );
+      }
+      else if( ( IsDiagonal<MT1>::value ) ||
+               ( IsComputation<MT>::value && !evaluateMatrix ) ||
+               ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
          selectSmallAssignKernel( y, x, A );
+      else if( UseSymmetricKernel<VT1,VT2,MT1>::value ) {
+         reset( y );
+         selectSymmetricKernel( y, x, A, ElementType_<VT1>( 1 ) );
+      }
       else
          selectBlasAssignKernel( y, x, A );
    }
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Default packed storage kernel***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default fallback for the packed storage kernel of the transpose dense vector-dense
+   //        matrix multiplication.
+   // \ingroup dense_vector
+   //
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UsePackedStorageKernel<VT1,VT2,MT1> >
+      selectPackedStorageKernel( VT1& /*y*/, const VT2& /*x*/, const MT1& /*A*/, ST2 /*alpha*/ )
+   {}
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed storage kernel***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed storage kernel for a transpose dense vector-dense matrix multiplication
+   //        (\f$ \vec{y}^T+=\alpha*\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side packed dense matrix operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the packed storage kernel (see pmv()), which reads
+   // each stored element of \a A only once, also in case of a symmetric or Hermitian matrix.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UsePackedStorageKernel<VT1,VT2,MT1> >
+      selectPackedStorageKernel( VT1& y, const VT2& x, const MT1& A, ST2 alpha )
+   {
+      pmv( y, x, A, alpha );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default band kernel*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default fallback for the band kernel of the transpose dense vector-dense
+   //        matrix multiplication.
+   // \ingroup dense_vector
+   //
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UseBandKernel<VT1,VT2,MT1> >
+      selectBandKernel( VT1& /*y*/, const VT2& /*x*/, const MT1& /*A*/, ST2 /*alpha*/ )
+   {}
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band kernel*********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Band kernel for a transpose dense vector-dense matrix multiplication
+   //        (\f$ \vec{y}^T+=\alpha*\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side band matrix operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the band kernel (see bmv()), which traverses
+   // the band of the matrix operand diagonal by diagonal by means of SIMD operations.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UseBandKernel<VT1,VT2,MT1> >
+      selectBandKernel( VT1& y, const VT2& x, const MT1& A, ST2 alpha )
+   {
+      bmv( y, x, A, alpha );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default symmetric kernel********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default fallback for the symmetric kernel of the transpose dense vector-dense matrix
+   //        multiplication.
+   // \ingroup dense_vector
+   //
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UseSymmetricKernel<VT1,VT2,MT1> >
+      selectSymmetricKernel( VT1& /*y*/, const VT2& /*x*/, const MT1& /*A*/, ST2 /*alpha*/ )
+   {}
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Symmetric kernel****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Symmetric kernel for a transpose dense vector-dense matrix multiplication
+   //        (\f$ \vec{y}^T+=\alpha*\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side symmetric dense matrix operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the symmetric kernel (see symv()), which reads
+   // only one triangle of \a A.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UseSymmetricKernel<VT1,VT2,MT1> >
+      selectSymmetricKernel( VT1& y, const VT2& x, const MT1& A, ST2 alpha )
+   {
+      symv( y, x, A, alpha );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors*********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a transpose dense vector-dense matrix multiplication
@@ -1045,10 +1270,19 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
            , typename MT1 >  // Type of the right-hand side matrix operand
    static inline void selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
-      if( ( IsDiagonal<MT1>::value ) ||
-          ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<VT1,VT2,MT1>::value ) {
+         selectPackedStorageKernel( y, x, A, ElementType_<VT1>( 1 ) );
+      }
+      else if( UseBandKernel<VT1,VT2,MT1>::value ) {
+         selectBandKernel( y, x, A, ElementType_<VT1>( 1 ) );
+      }
+      else if( ( IsDiagonal<MT1>::value ) ||
+               ( IsComputation<MT>::value && !evaluateMatrix ) ||
+               ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
          selectSmallAddAssignKernel( y, x, A );
+      else if( UseSymmetricKernel<VT1,VT2,MT1>::value ) {
+         selectSymmetricKernel( y, x, A, ElementType_<VT1>( 1 ) );
+      }
       else
          selectBlasAddAssignKernel( y, x, A );
    }
@@ -1614,10 +1848,19 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
            , typename MT1 >  // Type of the right-hand side matrix operand
    static inline void selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
-      if( ( IsDiagonal<MT1>::value ) ||
-          ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<VT1,VT2,MT1>::value ) {
+         selectPackedStorageKernel( y, x, A, ElementType_<VT1>( -1 ) );
+      }
+      else if( UseBandKernel<VT1,VT2,MT1>::value ) {
+         selectBandKernel( y, x, A, ElementType_<VT1>( -1 ) );
+      }
+      else if( ( IsDiagonal<MT1>::value ) ||
+               ( IsComputation<MT>::value && !evaluateMatrix ) ||
+               ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
          selectSmallSubAssignKernel( y, x, A );
+      else if( UseSymmetricKernel<VT1,VT2,MT1>::value ) {
+         selectSymmetricKernel( y, x, A, ElementType_<VT1>( -1 ) );
+      }
       else
          selectBlasSubAssignKernel( y, x, A );
    }
@@ -2244,6 +2487,39 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to dense vectors (symmetric kernel)******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense vector-dense matrix multiplication with symmetric matrix
+   //        operand to a dense vector (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // In case the symmetric kernel is selected for the operation, the assignment is not wrapped in a
+   // parallel section since the symmetric kernel distributes the work among the available threads
+   // itself (see smpFused()). Due to the explicit application of the SFINAE principle, this
+   // function can only be selected by the compiler in case the symmetric kernel is applicable.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSymmetricSMPAssign< VT1, RemoveReference_<LT>, RemoveReference_<RT> > >
+      smpAssign( DenseVector<VT1,true>& lhs, const TDVecDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.size() * rhs.size() < TDVECDMATMULT_THRESHOLD ) {
+         smpAssign( ~lhs, static_cast<const DenseVector<TDVecDMatMultExpr,true>&>( rhs ) );
+      }
+      else {
+         assign( ~lhs, rhs );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse vectors************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a transpose dense vector-dense matrix multiplication to a transpose
@@ -2317,6 +2593,40 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP addition assignment to dense vectors (symmetric kernel)*********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a dense vector-dense matrix multiplication with symmetric
+   //        matrix operand to a dense vector (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // In case the symmetric kernel is selected for the operation, the addition assignment is not
+   // wrapped in a parallel section since the symmetric kernel distributes the work among the
+   // available threads itself (see smpFused()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the symmetric kernel is
+   // applicable.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSymmetricSMPAssign< VT1, RemoveReference_<LT>, RemoveReference_<RT> > >
+      smpAddAssign( DenseVector<VT1,true>& lhs, const TDVecDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.size() * rhs.size() < TDVECDMATMULT_THRESHOLD ) {
+         smpAddAssign( ~lhs, static_cast<const DenseVector<TDVecDMatMultExpr,true>&>( rhs ) );
+      }
+      else {
+         addAssign( ~lhs, rhs );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse vectors***************************************************
    // No special implementation for the SMP addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -2361,6 +2671,40 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP subtraction assignment to dense vectors (symmetric kernel)******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a dense vector-dense matrix multiplication with
+   //        symmetric matrix operand from a dense vector (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // In case the symmetric kernel is selected for the operation, the subtraction assignment is not
+   // wrapped in a parallel section since the symmetric kernel distributes the work among the
+   // available threads itself (see smpFused()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the symmetric kernel is
+   // applicable.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSymmetricSMPAssign< VT1, RemoveReference_<LT>, RemoveReference_<RT> > >
+      smpSubAssign( DenseVector<VT1,true>& lhs, const TDVecDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.size() * rhs.size() < TDVECDMATMULT_THRESHOLD ) {
+         smpSubAssign( ~lhs, static_cast<const DenseVector<TDVecDMatMultExpr,true>&>( rhs ) );
+      }
+      else {
+         subAssign( ~lhs, rhs );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to sparse vectors************************************************
    // No special implementation for the SMP subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -2550,6 +2894,71 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix operand is stored in packed format (see PackedMatrix) and the two
+       involved vector types are suited for the packed storage kernel, the nested \a value
+       will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UsePackedStorageKernel {
+      enum : bool { value = IsPacked< RemoveAdaptor_<T3> >::value &&
+                            HasMutableDataAccess<T1>::value &&
+                            HasConstDataAccess<T2>::value &&
+                            !IsDiagonal<T3>::value &&
+                            T1::simdEnabled && T2::simdEnabled &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value &&
+                            !( IsBuiltin< ElementType_<T1> >::value && IsComplex<T4>::value ) };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix operand is stored in band format (see BandMatrix) and the target
+       vector provides direct access to its contiguous elements, the nested \a value will be
+       set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseBandKernel {
+      enum : bool { value = IsBanded<T3>::value &&
+                            HasMutableDataAccess<T1>::value &&
+                            T1::simdEnabled &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value &&
+                            !( IsBuiltin< ElementType_<T1> >::value && IsComplex<T4>::value ) };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix operand is a symmetric dense matrix with direct data access (but not
+       stored in packed format) and the two involved vector types are suited for the symmetric
+       kernel (see symv()), the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseSymmetricKernel {
+      enum : bool { value = useOptimizedKernels &&
+                            IsSymmetric<T3>::value &&
+                            !IsPacked< RemoveAdaptor_<T3> >::value &&
+                            !IsDiagonal<T3>::value &&
+                            HasConstDataAccess<T2>::value &&
+                            HasConstDataAccess<T3>::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value &&
+                            !( IsBuiltin< ElementType_<T1> >::value && IsComplex<T4>::value ) };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSymmetricSMPAssign struct is a helper struct for the selection of the parallel
+       evaluation strategy. In case no intermediate evaluation is required and the symmetric
+       kernel can be used, the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseSymmetricSMPAssign {
+      enum : bool { value = !UseSMPAssign<T1>::value &&
+                            UseSymmetricKernel<T1,T2,T3,T4>::value };
+   };
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DVecScalarMultExpr<VMM,ST,true>  This;           //!< Type of this DVecScalarMultExpr instance.
@@ -2773,15 +3182,150 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
            , typename ST2 >  // Type of the scalar value
    static inline void selectAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
    {
-      if( ( IsDiagonal<MT1>::value ) ||
-          ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<VT1,VT2,MT1,ST2>::value ) {
+         reset( y );
+         selectPackedStorageKernel( y, x, A, scalar );
+      }
+      else if( UseBandKernel<VT1,VT2,MT1,ST2>::value ) {
+         reset( y );
+         selectBandKernel( y, x, A, scalar );
+      }
+      else if( ( IsDiagonal<MT1>::value ) ||
+               ( IsComputation<MT>::value && !evaluateMatrix ) ||
+               ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
          selectSmallAssignKernel( y, x, A, scalar );
+      else if( UseSymmetricKernel<VT1,VT2,MT1,ST2>::value ) {
+         reset( y );
+         selectSymmetricKernel( y, x, A, scalar );
+      }
       else
          selectBlasAssignKernel( y, x, A, scalar );
    }
    //**********************************************************************************************
 
+   //**Default packed storage kernel***************************************************************
+   /*!\brief Default fallback for the packed storage kernel of the scaled transpose dense
+   //        vector-dense matrix multiplication.
+   // \ingroup dense_vector
+   //
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UsePackedStorageKernel<VT1,VT2,MT1,ST2> >
+      selectPackedStorageKernel( VT1& /*y*/, const VT2& /*x*/, const MT1& /*A*/, ST2 /*alpha*/ )
+   {}
+   //**********************************************************************************************
+
+   //**Packed storage kernel***********************************************************************
+   /*!\brief Packed storage kernel for a scaled transpose dense vector-dense matrix multiplication
+   //        (\f$ \vec{y}^T+=\alpha*\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side packed dense matrix operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the packed storage kernel (see pmv()), which reads
+   // each stored element of \a A only once, also in case of a symmetric or Hermitian matrix.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UsePackedStorageKernel<VT1,VT2,MT1,ST2> >
+      selectPackedStorageKernel( VT1& y, const VT2& x, const MT1& A, ST2 alpha )
+   {
+      pmv( y, x, A, alpha );
+   }
+   //**********************************************************************************************
+
+   //**Default band kernel*************************************************************************
+   /*!\brief Default fallback for the band kernel of the scaled transpose dense
+   //        vector-dense matrix multiplication.
+   // \ingroup dense_vector
+   //
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UseBandKernel<VT1,VT2,MT1,ST2> >
+      selectBandKernel( VT1& /*y*/, const VT2& /*x*/, const MT1& /*A*/, ST2 /*alpha*/ )
+   {}
+   //**********************************************************************************************
+
+   //**Band kernel*********************************************************************************
+   /*!\brief Band kernel for a scaled transpose dense vector-dense matrix multiplication
+   //        (\f$ \vec{y}^T+=\alpha*\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side band matrix operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the band kernel (see bmv()), which traverses
+   // the band of the matrix operand diagonal by diagonal by means of SIMD operations.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UseBandKernel<VT1,VT2,MT1,ST2> >
+      selectBandKernel( VT1& y, const VT2& x, const MT1& A, ST2 alpha )
+   {
+      bmv( y, x, A, alpha );
+   }
+   //**********************************************************************************************
+
+   //**Default symmetric kernel********************************************************************
+   /*!\brief Default fallback for the symmetric kernel of the scaled transpose dense vector-dense
+   //        matrix multiplication.
+   // \ingroup dense_vector
+   //
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline DisableIf_< UseSymmetricKernel<VT1,VT2,MT1,ST2> >
+      selectSymmetricKernel( VT1& /*y*/, const VT2& /*x*/, const MT1& /*A*/, ST2 /*alpha*/ )
+   {}
+   //**********************************************************************************************
+
+   //**Symmetric kernel****************************************************************************
+   /*!\brief Symmetric kernel for a scaled transpose dense vector-dense matrix multiplication
+   //        (\f$ \vec{y}^T+=\alpha*\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side symmetric dense matrix operand.
+   // \param alpha The scaling factor for the multiplication.
+   // \return void
+   //
+   // This function relays the multiplication to the symmetric kernel (see symv()), which reads
+   // only one triangle of \a A.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scaling factor
+   static inline EnableIf_< UseSymmetricKernel<VT1,VT2,MT1,ST2> >
+      selectSymmetricKernel( VT1& y, const VT2& x, const MT1& A, ST2 alpha )
+   {
+      symv( y, x, A, alpha );
+   }
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors*********************************************************
    /*!\brief Default assignment of a scaled transpose dense vector-dense matrix multiplication
    //        (\f$ \vec{y}^T=s*\vec{x}^T*A \f$).
@@ -3384,10 +3928,19 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
            , typename ST2 >  // Type of the scalar value
    static inline void selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
    {
-      if( ( IsDiagonal<MT1>::value ) ||
-          ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<VT1,VT2,MT1,ST2>::value ) {
+         selectPackedStorageKernel( y, x, A, scalar );
+      }
+      else if( UseBandKernel<VT1,VT2,MT1,ST2>::value ) {
+         selectBandKernel( y, x, A, scalar );
+      }
+      else if( ( IsDiagonal<MT1>::value ) ||
+               ( IsComputation<MT>::value && !evaluateMatrix ) ||
+               ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
          selectSmallAddAssignKernel( y, x, A, scalar );
+      else if( UseSymmetricKernel<VT1,VT2,MT1,ST2>::value ) {
+         selectSymmetricKernel( y, x, A, scalar );
+      }
       else
          selectBlasAddAssignKernel( y, x, A, scalar );
    }
@@ -3917,10 +4470,19 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
            , typename ST2 >  // Type of the scalar value
    static inline void selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
    {
-      if( ( IsDiagonal<MT1>::value ) ||
-          ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+      if( UsePackedStorageKernel<VT1,VT2,MT1,ST2>::value ) {
+         selectPackedStorageKernel( y, x, A, -scalar );
+      }
+      else if( UseBandKernel<VT1,VT2,MT1,ST2>::value ) {
+         selectBandKernel( y, x, A, -scalar );
+      }
+      else if( ( IsDiagonal<MT1>::value ) ||
+               ( IsComputation<MT>::value && !evaluateMatrix ) ||
+               ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
          selectSmallSubAssignKernel( y, x, A, scalar );
+      else if( UseSymmetricKernel<VT1,VT2,MT1,ST2>::value ) {
+         selectSymmetricKernel( y, x, A, -scalar );
+      }
       else
          selectBlasSubAssignKernel( y, x, A, scalar );
    }
@@ -4504,6 +5066,37 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    }
    //**********************************************************************************************
 
+   //**SMP assignment to dense vectors (symmetric kernel)******************************************
+   /*!\brief SMP assignment of a scaled dense vector-dense matrix multiplication with symmetric
+   //        matrix operand to a dense vector (\f$ \vec{y}^T=s*\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side scaled multiplication expression to be assigned.
+   // \return void
+   //
+   // In case the symmetric kernel is selected for the operation, the assignment is not wrapped in a
+   // parallel section since the symmetric kernel distributes the work among the available threads
+   // itself (see smpFused()). Due to the explicit application of the SFINAE principle, this
+   // function can only be selected by the compiler in case the symmetric kernel is applicable.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSymmetricSMPAssign< VT1, RemoveReference_<LT>, RemoveReference_<RT>, ST > >
+      smpAssign( DenseVector<VT1,true>& lhs, const DVecScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.size() * rhs.size() < TDVECDMATMULT_THRESHOLD ) {
+         smpAssign( ~lhs, static_cast<const DenseVector<DVecScalarMultExpr,true>&>( rhs ) );
+      }
+      else {
+         assign( ~lhs, rhs );
+      }
+   }
+   //**********************************************************************************************
+
    //**SMP assignment to sparse vectors************************************************************
    /*!\brief SMP assignment of a scaled transpose dense vector-dense matrix multiplication to a
    //        transpose sparse vector.
@@ -4576,6 +5169,38 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    }
    //**********************************************************************************************
 
+   //**SMP addition assignment to dense vectors (symmetric kernel)*********************************
+   /*!\brief SMP addition assignment of a scaled dense vector-dense matrix multiplication with
+   //        symmetric matrix operand to a dense vector (\f$ \vec{y}^T+=s*\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side scaled multiplication expression to be added.
+   // \return void
+   //
+   // In case the symmetric kernel is selected for the operation, the addition assignment is not
+   // wrapped in a parallel section since the symmetric kernel distributes the work among the
+   // available threads itself (see smpFused()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the symmetric kernel is
+   // applicable.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSymmetricSMPAssign< VT1, RemoveReference_<LT>, RemoveReference_<RT>, ST > >
+      smpAddAssign( DenseVector<VT1,true>& lhs, const DVecScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.size() * rhs.size() < TDVECDMATMULT_THRESHOLD ) {
+         smpAddAssign( ~lhs, static_cast<const DenseVector<DVecScalarMultExpr,true>&>( rhs ) );
+      }
+      else {
+         addAssign( ~lhs, rhs );
+      }
+   }
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse vectors***************************************************
    // No special implementation for the SMP addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -4621,6 +5246,38 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    }
    //**********************************************************************************************
 
+   //**SMP subtraction assignment to dense vectors (symmetric kernel)******************************
+   /*!\brief SMP subtraction assignment of a scaled dense vector-dense matrix multiplication with
+   //        symmetric matrix operand from a dense vector (\f$ \vec{y}^T-=s*\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side scaled multiplication expression to be subtracted.
+   // \return void
+   //
+   // In case the symmetric kernel is selected for the operation, the subtraction assignment is not
+   // wrapped in a parallel section since the symmetric kernel distributes the work among the
+   // available threads itself (see smpFused()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the symmetric kernel is
+   // applicable.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSymmetricSMPAssign< VT1, RemoveReference_<LT>, RemoveReference_<RT>, ST > >
+      smpSubAssign( DenseVector<VT1,true>& lhs, const DVecScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.size() * rhs.size() < TDVECDMATMULT_THRESHOLD ) {
+         smpSubAssign( ~lhs, static_cast<const DenseVector<DVecScalarMultExpr,true>&>( rhs ) );
+      }
+      else {
+         subAssign( ~lhs, rhs );
+      }
+   }
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to sparse vectors************************************************
    // No special implementation for the SMP subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -43,11 +43,16 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecDVecMultExpr.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/expressions/DVecTransExpr.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -200,7 +205,8 @@ inline DisableIf_< TDVecDVecMultExprHelper<T1,T2>
 // and \a T2 as well as the two element types \a T1::ElementType and \a T2::ElementType have
 // to be supported by the MultTrait class template.\n
 // In case the current sizes of the two given vectors don't match, a \a std::invalid_argument
-// is thrown.
+// is thrown. Inner products of vectors with a size larger or equal to the
+// blaze::SMP_DVECREDUCE_THRESHOLD are computed in parallel (see \ref shared_memory_parallelization).
 */
 template< typename T1    // Type of the left-hand side dense vector
         , typename T2 >  // Type of the right-hand side dense vector
@@ -229,6 +235,10 @@ inline EnableIf_< TDVecDVecMultExprHelper<T1,T2>
 
    const size_t N( left.size() );
 
+   if( N >= SMP_DVECREDUCE_THRESHOLD ) {
+      return reduce( trans( left ) * right, Add() );
+   }
+
    SIMDTrait_<MultType> xmm1, xmm2, xmm3, xmm4;
    size_t i( 0UL );
 
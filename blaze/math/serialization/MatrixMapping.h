@@ -0,0 +1,622 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/MatrixMapping.h
+//  \brief Memory-mapped storage of dense and sparse matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_MATRIXMAPPING_H_
+#define _BLAZE_MATH_SERIALIZATION_MATRIXMAPPING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/MappedCSRMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/MemoryMap.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  FILE FORMAT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Header of a memory mappable matrix file.
+// \ingroup math_serialization
+//
+// A memory mappable matrix file starts with this 64-byte header, which is followed by the
+// matrix payload starting at the 64-byte aligned offset \a offset. The payload of a dense matrix
+// consists of \a rows times \a spacing (row-major) or \a columns times \a spacing (column-major)
+// elements, where the \a spacing corresponds to the padded number of elements per row/column of
+// a DynamicMatrix. The payload of a sparse matrix consists of the \a rows+1 row offsets and the
+// \a nonZeros column indices (both as 64-bit unsigned integers), followed by the \a nonZeros
+// values starting at the next 64-byte boundary. All values are stored in the native byte order
+// of the writing machine, which is recorded by the \a byteOrder field.
+*/
+struct MappedMatrixHeader
+{
+   char     magic[8];     //!< The file signature "BLAZEMAP".
+   uint32_t byteOrder;    //!< The byte order mark 0x01020304.
+   uint8_t  version;      //!< The version of the file format.
+   uint8_t  type;         //!< The type of the stored matrix (see MappedMatrixType).
+   uint8_t  elementType;  //!< The serial representation of the element type (see TypeValueMapping).
+   uint8_t  elementSize;  //!< The size of a single element in bytes.
+   uint64_t rows;         //!< The number of rows of the matrix.
+   uint64_t columns;      //!< The number of columns of the matrix.
+   uint64_t spacing;      //!< The number of elements between two rows/columns of a dense matrix.
+   uint64_t nonZeros;     //!< The number of non-zero elements of a sparse matrix.
+   uint64_t offset;       //!< The byte offset of the matrix payload.
+   uint64_t reserved;     //!< Reserved for future use.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Type identifiers of the memory mappable matrix file format.
+// \ingroup math_serialization
+*/
+enum MappedMatrixType : uint8_t
+{
+   mappedDenseRowMajor    = 0,  //!< Row-major dense matrix.
+   mappedDenseColumnMajor = 1,  //!< Column-major dense matrix.
+   mappedSparseRowMajor   = 2   //!< Row-major sparse matrix in CSR format.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! Version of the memory mappable matrix file format.
+const uint8_t mappedMatrixVersion = 1U;
+
+//! Alignment of the payload of a memory mappable matrix file.
+const size_t mappedMatrixAlignment = 64UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the header of a memory mappable matrix file.
+// \ingroup math_serialization
+//
+// \param type The type of the stored matrix.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param spacing The number of elements between two rows/columns of a dense matrix.
+// \param nonZeros The number of non-zero elements of a sparse matrix.
+// \return The initialized header.
+*/
+template< typename Type >  // Data type of the elements
+inline MappedMatrixHeader makeMappedMatrixHeader( MappedMatrixType type, size_t m, size_t n,
+                                                  size_t spacing, size_t nonZeros )
+{
+   MappedMatrixHeader header;
+   std::memset( &header, 0, sizeof( header ) );
+   std::memcpy( header.magic, "BLAZEMAP", 8UL );
+   header.byteOrder   = 0x01020304U;
+   header.version     = mappedMatrixVersion;
+   header.type        = type;
+   header.elementType = static_cast<uint8_t>( TypeValueMapping<Type>::value );
+   header.elementSize = static_cast<uint8_t>( sizeof(Type) );
+   header.rows        = m;
+   header.columns     = n;
+   header.spacing     = spacing;
+   header.nonZeros    = nonZeros;
+   header.offset      = mappedMatrixAlignment;
+   return header;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Validation of the header of a memory mapped matrix file.
+// \ingroup math_serialization
+//
+// \param map The memory mapped file.
+// \param type The expected type of the stored matrix.
+// \return Reference to the valid header.
+// \exception std::runtime_error Invalid matrix file detected.
+//
+// This function checks the header of the given memory mapped file against the expected matrix
+// type and element type \a Type. In case the header does not match, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Data type of the elements
+inline const MappedMatrixHeader& checkMappedMatrixHeader( const MemoryMap& map, MappedMatrixType type )
+{
+   if( map.size() < sizeof( MappedMatrixHeader ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix file detected" );
+   }
+
+   const MappedMatrixHeader& header( *reinterpret_cast<const MappedMatrixHeader*>( map.data() ) );
+
+   if( std::memcmp( header.magic, "BLAZEMAP", 8UL ) != 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix file detected" );
+   }
+   else if( header.byteOrder != 0x01020304U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid byte order detected" );
+   }
+   else if( header.version != mappedMatrixVersion ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid file format version detected" );
+   }
+   else if( header.type != type ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix type detected" );
+   }
+   else if( header.elementType != static_cast<uint8_t>( TypeValueMapping<Type>::value ) ||
+            header.elementSize != static_cast<uint8_t>( sizeof(Type) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+   else if( header.offset < sizeof( MappedMatrixHeader ) ||
+            header.offset % mappedMatrixAlignment != 0UL ||
+            header.offset > map.size() ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid payload offset detected" );
+   }
+
+   return header;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes zero bytes to the given output stream up to the next payload boundary.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param bytes The number of bytes written so far.
+// \return The number of bytes written after the padding.
+*/
+inline size_t padMappedMatrix( std::ostream& os, size_t bytes )
+{
+   static const char zeros[mappedMatrixAlignment] = {};
+   const size_t next( nextMultiple( bytes, mappedMatrixAlignment ) );
+   os.write( zeros, static_cast<std::streamsize>( next - bytes ) );
+   return next;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Deleter for matrices residing in a memory mapped file.
+// \ingroup math_serialization
+//
+// The MappedMatrixDeleter keeps the memory mapped file alive as long as any matrix referring
+// to the mapped memory exists. The mapping is released together with the last copy.
+*/
+struct MappedMatrixDeleter
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor of the MappedMatrixDeleter.
+   //
+   // \param map The memory mapped file.
+   */
+   explicit inline MappedMatrixDeleter( std::shared_ptr<MemoryMap> map )
+      : map_( std::move( map ) )  // The memory mapped file
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief No-op deallocation; the mapping is released by the destructor of the MemoryMap.
+   */
+   template< typename Type >
+   inline void operator()( Type* ) const noexcept
+   {}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::shared_ptr<MemoryMap> map_;  //!< The memory mapped file.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Memory mapping functions */
+//@{
+template< typename MT, bool SO >
+void saveMappedMatrix( const std::string& file, const DenseMatrix<MT,SO>& dm );
+
+template< typename MT >
+void saveMappedMatrix( const std::string& file, const SparseMatrix<MT,false>& sm );
+
+template< typename MT >
+void saveMappedMatrix( const std::string& file, const SparseMatrix<MT,true>& sm );
+
+template< typename Type, bool SO = rowMajor >
+CustomMatrix<Type,aligned,padded,SO> mmapMatrix( const std::string& file );
+
+template< typename Type >
+MappedCSRMatrix<Type> mmapCSRMatrix( const std::string& file, bool check = true );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stores the given dense matrix in a memory mappable file.
+// \ingroup math_serialization
+//
+// \param file The name of the file.
+// \param dm The dense matrix to be stored.
+// \return void
+// \exception std::runtime_error File could not be written.
+//
+// This function writes the given dense matrix into the given file in a format that can be
+// directly memory mapped via the mmapMatrix() function. The elements are stored aligned and
+// padded exactly like the elements of a DynamicMatrix, i.e. each row (row-major) or column
+// (column-major) starts at a SIMD boundary and is padded with zeros:
+
+   \code
+   blaze::DynamicMatrix<double> A( 1000UL, 1000UL );
+   // ... Initialization
+
+   blaze::saveMappedMatrix( "matrix.bmap", A );
+
+   blaze::CustomMatrix<double,blaze::aligned,blaze::padded> B( blaze::mmapMatrix<double>( "matrix.bmap" ) );
+   \endcode
+
+// Note that the file is written in the native byte order of the machine.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void saveMappedMatrix( const std::string& file, const DenseMatrix<MT,SO>& dm )
+{
+   typedef ElementType_<MT>  ET;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   const size_t M( SO ? (~dm).columns() : (~dm).rows()    );
+   const size_t N( SO ? (~dm).rows()    : (~dm).columns() );
+   const size_t spacing( IsVectorizable<ET>::value ? nextMultiple<size_t>( N, SIMDSIZE ) : N );
+
+   std::ofstream os( file.c_str(), std::ofstream::binary | std::ofstream::trunc );
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   const MappedMatrixHeader header( makeMappedMatrixHeader<ET>(
+      SO ? mappedDenseColumnMajor : mappedDenseRowMajor, (~dm).rows(), (~dm).columns(), spacing, 0UL ) );
+
+   os.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+   padMappedMatrix( os, sizeof( header ) );
+
+   std::vector<ET> buffer( spacing, ET() );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         buffer[j] = SO ? (~dm)(j,i) : (~dm)(i,j);
+      }
+      os.write( reinterpret_cast<const char*>( buffer.data() ),
+                static_cast<std::streamsize>( spacing*sizeof(ET) ) );
+   }
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stores the given row-major sparse matrix in a memory mappable file.
+// \ingroup math_serialization
+//
+// \param file The name of the file.
+// \param sm The sparse matrix to be stored.
+// \return void
+// \exception std::runtime_error File could not be written.
+//
+// This function writes the given sparse matrix in CSR format into the given file. The file
+// can be directly memory mapped via the mmapCSRMatrix() function. Note that the file is
+// written in the native byte order of the machine.
+*/
+template< typename MT >  // Type of the sparse matrix
+void saveMappedMatrix( const std::string& file, const SparseMatrix<MT,false>& sm )
+{
+   typedef ElementType_<MT>  ET;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   CompositeType_<MT> A( ~sm );  // Evaluation of the sparse matrix operand
+
+   std::ofstream os( file.c_str(), std::ofstream::binary | std::ofstream::trunc );
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   std::vector<uint64_t> offsets( A.rows()+1UL, 0UL );
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      offsets[i+1UL] = offsets[i] + static_cast<uint64_t>( A.end(i) - A.begin(i) );
+   }
+
+   const size_t nonzeros( offsets.back() );
+
+   const MappedMatrixHeader header( makeMappedMatrixHeader<ET>(
+      mappedSparseRowMajor, A.rows(), A.columns(), 0UL, nonzeros ) );
+
+   os.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+   size_t bytes( padMappedMatrix( os, sizeof( header ) ) );
+
+   os.write( reinterpret_cast<const char*>( offsets.data() ),
+             static_cast<std::streamsize>( offsets.size()*sizeof(uint64_t) ) );
+   bytes += offsets.size()*sizeof(uint64_t);
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         const uint64_t index( element->index() );
+         os.write( reinterpret_cast<const char*>( &index ), sizeof(uint64_t) );
+      }
+   }
+   bytes += nonzeros*sizeof(uint64_t);
+
+   padMappedMatrix( os, bytes );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         const ET value( element->value() );
+         os.write( reinterpret_cast<const char*>( &value ), sizeof(ET) );
+      }
+   }
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stores the given column-major sparse matrix in a memory mappable file.
+// \ingroup math_serialization
+//
+// \param file The name of the file.
+// \param sm The sparse matrix to be stored.
+// \return void
+// \exception std::runtime_error File could not be written.
+//
+// This function converts the given column-major sparse matrix to row-major storage order and
+// writes it in CSR format into the given file.
+*/
+template< typename MT >  // Type of the sparse matrix
+void saveMappedMatrix( const std::string& file, const SparseMatrix<MT,true>& sm )
+{
+   const CompressedMatrix<ElementType_<MT>,rowMajor> tmp( ~sm );
+   saveMappedMatrix( file, tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Memory maps a dense matrix stored via saveMappedMatrix().
+// \ingroup math_serialization
+//
+// \param file The name of the file.
+// \return Aligned and padded custom matrix referring to the mapped file.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error Invalid matrix file detected.
+//
+// This function maps the given file into memory and returns an aligned and padded CustomMatrix
+// directly referring to the mapped elements, i.e. without copying or deserializing the file
+// content. The mapping stays valid as long as any copy of the returned matrix exists. Since
+// the file is mapped privately, modifications of the matrix are not written back to the file:
+
+   \code
+   using blaze::CustomMatrix;
+   using blaze::aligned;
+   using blaze::padded;
+
+   CustomMatrix<double,aligned,padded> A( blaze::mmapMatrix<double>( "matrix.bmap" ) );
+   blaze::DynamicVector<double> x( A.columns(), 1.0 ), y;
+
+   y = A * x;
+   \endcode
+
+// In case the file does not contain a dense matrix with the given element type \a Type and
+// storage order \a SO or in case the file cannot be mapped, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+CustomMatrix<Type,aligned,padded,SO> mmapMatrix( const std::string& file )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   enum : size_t { SIMDSIZE = SIMDTrait<Type>::size };
+
+   std::shared_ptr<MemoryMap> map( std::make_shared<MemoryMap>( file ) );
+
+   const MappedMatrixHeader& header(
+      checkMappedMatrixHeader<Type>( *map, SO ? mappedDenseColumnMajor : mappedDenseRowMajor ) );
+
+   const size_t m( header.rows );
+   const size_t n( header.columns );
+   const size_t spacing( header.spacing );
+   const size_t M( SO ? n : m );
+   const size_t N( SO ? m : n );
+
+   if( spacing < N || ( IsVectorizable<Type>::value && spacing != nextMultiple<size_t>( N, SIMDSIZE ) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix spacing detected" );
+   }
+
+   if( spacing != 0UL && M > ( map->size() - header.offset ) / ( spacing*sizeof(Type) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   Type* ptr( reinterpret_cast<Type*>( map->data() + header.offset ) );
+   return CustomMatrix<Type,aligned,padded,SO>( ptr, m, n, spacing, MappedMatrixDeleter( map ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Memory maps a sparse matrix stored via saveMappedMatrix().
+// \ingroup math_serialization
+//
+// \param file The name of the file.
+// \param check \a true to validate the row offsets and column indices, \a false if not.
+// \return Read-only CSR view referring to the mapped file.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error Invalid matrix file detected.
+// \exception std::invalid_argument Invalid CSR structure detected.
+//
+// This function maps the given file into memory and returns a read-only MappedCSRMatrix
+// directly referring to the mapped row offsets, column indices, and values. The mapping stays
+// valid as long as any copy of the returned view exists:
+
+   \code
+   blaze::MappedCSRMatrix<double> A( blaze::mmapCSRMatrix<double>( "matrix.bmap" ) );
+   blaze::DynamicVector<double> x( A.columns(), 1.0 ), y;
+
+   y = A * x;
+   \endcode
+
+// In case the file does not contain a sparse matrix with the given element type \a Type or
+// in case the file cannot be mapped, a \a std::runtime_error exception is thrown. By default,
+// the function additionally verifies that the row offsets are non-decreasing and that the
+// column indices of each row are strictly increasing and smaller than the number of columns,
+// since all accesses to the mapped matrix rely on this structure. In case the structure is
+// violated, a \a std::invalid_argument exception is thrown. Since the verification touches
+// all pages of the row offsets and column indices, it can be skipped for trusted files by
+// setting \a check to \a false. In this case only the first and the last row offset are
+// verified and the behavior of any access to a malformed matrix is undefined.
+*/
+template< typename Type >  // Data type of the elements
+MappedCSRMatrix<Type> mmapCSRMatrix( const std::string& file, bool check )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   std::shared_ptr<MemoryMap> map( std::make_shared<MemoryMap>( file ) );
+
+   const MappedMatrixHeader& header( checkMappedMatrixHeader<Type>( *map, mappedSparseRowMajor ) );
+
+   const size_t m( header.rows );
+   const size_t n( header.columns );
+   const size_t nonzeros( header.nonZeros );
+   const size_t available( map->size() - header.offset );
+
+   if( m >= available / sizeof(uint64_t) ||
+       nonzeros > ( available - (m+1UL)*sizeof(uint64_t) ) / sizeof(uint64_t) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   const size_t valueOffset( nextMultiple( header.offset + ( m+1UL+nonzeros )*sizeof(uint64_t),
+                                           mappedMatrixAlignment ) );
+
+   if( valueOffset > map->size() || nonzeros > ( map->size() - valueOffset ) / sizeof(Type) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   const uint64_t* offsets( reinterpret_cast<const uint64_t*>( map->data() + header.offset ) );
+   const uint64_t* indices( offsets + m + 1UL );
+   const Type*     values ( reinterpret_cast<const Type*>( map->data() + valueOffset ) );
+
+   if( offsets[0] != 0UL || offsets[m] != nonzeros ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid row offsets detected" );
+   }
+
+   if( check )
+   {
+      for( size_t i=0UL; i<m; ++i ) {
+         if( offsets[i] > offsets[i+1UL] ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid row offsets detected" );
+         }
+      }
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t k=offsets[i]; k<offsets[i+1UL]; ++k ) {
+            if( indices[k] >= n || ( k > offsets[i] && indices[k-1UL] >= indices[k] ) ) {
+               BLAZE_THROW_INVALID_ARGUMENT( "Invalid column indices detected" );
+            }
+         }
+      }
+   }
+
+   return MappedCSRMatrix<Type>( m, n, offsets, indices, values, map );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <cstring>
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Matrix.h>
 #include <blaze/math/dense/DynamicMatrix.h>
@@ -49,12 +51,14 @@
 #include <blaze/math/expressions/Matrix.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
 #include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 
@@ -235,10 +239,20 @@ class MatrixSerializer
    void serializeHeader( Archive& archive, const MT& mat );
 
    template< typename Archive, typename MT, bool SO >
-   void serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
+   EnableIf_< And< HasConstDataAccess<MT>, IsNumeric< ElementType_<MT> > > >
+      serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
 
    template< typename Archive, typename MT, bool SO >
-   void serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat );
+   DisableIf_< And< HasConstDataAccess<MT>, IsNumeric< ElementType_<MT> > > >
+      serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   EnableIf_< IsNumeric< ElementType_<MT> > >
+      serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   DisableIf_< IsNumeric< ElementType_<MT> > >
+      serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat );
    //@}
    //**********************************************************************************************
 
@@ -420,7 +434,40 @@ void MatrixSerializer::serializeHeader( Archive& archive, const MT& mat )
 template< typename Archive  // Type of the archive
         , typename MT       // Type of the matrix
         , bool SO >         // Storage order
-void MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
+EnableIf_< And< HasConstDataAccess<MT>, IsNumeric< ElementType_<MT> > > >
+   MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
+{
+   if( IsRowMajorMatrix<MT>::value ) {
+      for( size_t i=0UL; i<(~mat).rows(); ++i ) {
+         archive.write( (~mat).data(i), (~mat).columns() );
+      }
+   }
+   else {
+      for( size_t j=0UL; j<(~mat).columns(); ++j ) {
+         archive.write( (~mat).data(j), (~mat).rows() );
+      }
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a dense matrix.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Dense matrix could not be serialized.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+DisableIf_< And< HasConstDataAccess<MT>, IsNumeric< ElementType_<MT> > > >
+   MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
 {
    if( IsRowMajorMatrix<MT>::value ) {
       for( size_t i=0UL; i<(~mat).rows(); ++i ) {
@@ -455,7 +502,55 @@ void MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,S
 template< typename Archive  // Type of the archive
         , typename MT       // Type of the matrix
         , bool SO >         // Storage order
-void MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat )
+EnableIf_< IsNumeric< ElementType_<MT> > >
+   MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat )
+{
+   typedef ElementType_<MT>    ET;
+   typedef ConstIterator_<MT>  ConstIterator;
+
+   const size_t N( IsRowMajorMatrix<MT>::value ? (~mat).rows() : (~mat).columns() );
+   const size_t pairSize( sizeof(size_t) + sizeof(ET) );
+
+   std::vector<char> buffer;
+
+   for( size_t i=0UL; i<N; ++i )
+   {
+      buffer.clear();
+      buffer.reserve( (~mat).nonZeros( i )*pairSize );
+
+      for( ConstIterator element=(~mat).begin(i); element!=(~mat).end(i); ++element ) {
+         const size_t index( element->index() );
+         const ET     value( element->value() );
+         const size_t offset( buffer.size() );
+         buffer.resize( offset+pairSize );
+         std::memcpy( &buffer[offset], &index, sizeof(size_t) );
+         std::memcpy( &buffer[offset+sizeof(size_t)], &value, sizeof(ET) );
+      }
+
+      archive << uint64_t( buffer.size() / pairSize );
+      archive.write( buffer.data(), buffer.size() );
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a sparse matrix.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be serialized.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+DisableIf_< IsNumeric< ElementType_<MT> > >
+   MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat )
 {
    typedef ConstIterator_<MT>  ConstIterator;
 
@@ -0,0 +1,936 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/RowBlockSerializer.h
+//  \brief Streaming serialization of sparse matrices in row blocks
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_ROWBLOCKSERIALIZER_H_
+#define _BLAZE_MATH_SERIALIZATION_ROWBLOCKSERIALIZER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/MappedCSRMatrix.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS ROWBLOCKFORMAT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constants of the row block serialization format.
+// \ingroup math_serialization
+//
+// A row block stream starts with a header that resembles the header of the MatrixSerializer:
+
+   \code
+   uint8_t  version       // The version of the row block format (1)
+   uint8_t  type          // The matrix type (0x0B: matrix, sparse, row-major, row blocks)
+   uint8_t  elementType   // The serial representation of the element type (see TypeValueMapping)
+   uint8_t  elementSize   // The size of a single element in bytes
+   uint64_t rows          // The total number of rows of the matrix
+   uint64_t columns       // The total number of columns of the matrix
+   \endcode
+
+// The header is followed by a sequence of row blocks, which together cover all rows of the
+// matrix in ascending order. Each row block consists of a block header and three arrays:
+
+   \code
+   uint64_t row           // The index of the first row of the block
+   uint64_t rows          // The number of rows in the block
+   uint64_t nonZeros      // The number of non-zero elements in the block
+   uint64_t counts[rows]      // The number of non-zero elements per row
+   uint64_t indices[nonZeros] // The column indices of all non-zero elements
+   Type     values[nonZeros]  // The values of all non-zero elements
+   \endcode
+
+// Since the size of a block is known from its header, a block can be skipped without reading
+// its payload.
+*/
+struct RowBlockFormat
+{
+   enum : uint8_t { version = 1U };  //!< The version of the row block format.
+   enum : uint8_t { type = 0x0BU };  //!< The matrix type flags of the row block format.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ROWBLOCKWRITER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Streaming writer for sparse matrices in row blocks.
+// \ingroup math_serialization
+//
+// The RowBlockWriter writes a sparse matrix block by block into an archive. In contrast to the
+// MatrixSerializer it does not require the complete matrix to be held in memory: the rows of
+// the matrix can be generated and written in arbitrarily sized row blocks, of which only a
+// single block has to exist at a time. The counts, indices, and values of each block are
+// written via bulk Archive::write() calls:
+
+   \code
+   using blaze::CompressedMatrix;
+
+   blaze::Archive<std::ofstream> archive( "matrix.blaze" );
+
+   // Writing a 1000000x1000000 matrix in blocks of 10000 rows
+   blaze::RowBlockWriter< blaze::Archive<std::ofstream>, double > writer( archive, 1000000UL, 1000000UL );
+
+   for( size_t i=0UL; i<1000000UL; i+=10000UL ) {
+      CompressedMatrix<double> block( 10000UL, 1000000UL );
+      // ... Initialization of rows i to i+9999
+      writer.write( block );
+   }
+   \endcode
+
+// The resulting stream can be read via the RowBlockReader class. Note that the element type
+// \a Type has to be a numeric data type.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the elements
+class RowBlockWriter : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline RowBlockWriter( Archive& archive, size_t m, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows    () const noexcept;
+   inline size_t columns () const noexcept;
+   inline size_t position() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Serialization functions*********************************************************************
+   /*!\name Serialization functions */
+   //@{
+   template< typename MT > void write( const SparseMatrix<MT,false>& block );
+   template< typename MT > void write( const SparseMatrix<MT,true>& block );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Archive& archive_;               //!< The archive to be written.
+   size_t m_;                       //!< The total number of rows of the matrix.
+   size_t n_;                       //!< The total number of columns of the matrix.
+   size_t row_;                     //!< The index of the first row of the next block.
+   std::vector<uint64_t> counts_;   //!< The number of non-zero elements per row of the current block.
+   std::vector<uint64_t> indices_;  //!< The column indices of the current block.
+   std::vector<Type>     values_;   //!< The values of the current block.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the RowBlockWriter class.
+//
+// \param archive The archive to be written.
+// \param m The total number of rows of the matrix.
+// \param n The total number of columns of the matrix.
+// \exception std::runtime_error Faulty archive detected.
+//
+// The constructor writes the header of the row block stream to the given archive.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the elements
+inline RowBlockWriter<Archive,Type>::RowBlockWriter( Archive& archive, size_t m, size_t n )
+   : archive_( archive )  // The archive to be written
+   , m_      ( m )        // The total number of rows of the matrix
+   , n_      ( n )        // The total number of columns of the matrix
+   , row_    ( 0UL )      // The index of the first row of the next block
+   , counts_ ()           // The number of non-zero elements per row of the current block
+   , indices_()           // The column indices of the current block
+   , values_ ()           // The values of the current block
+{
+   if( !archive_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty archive detected" );
+   }
+
+   archive_ << uint8_t ( RowBlockFormat::version );
+   archive_ << uint8_t ( RowBlockFormat::type );
+   archive_ << uint8_t ( TypeValueMapping<Type>::value );
+   archive_ << uint8_t ( sizeof( Type ) );
+   archive_ << uint64_t( m_ );
+   archive_ << uint64_t( n_ );
+
+   if( !archive_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File header could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the total number of rows of the written matrix.
+//
+// \return The total number of rows.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the elements
+inline size_t RowBlockWriter<Archive,Type>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of columns of the written matrix.
+//
+// \return The total number of columns.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the elements
+inline size_t RowBlockWriter<Archive,Type>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the first row of the next block.
+//
+// \return The number of rows written so far.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the elements
+inline size_t RowBlockWriter<Archive,Type>::position() const noexcept
+{
+   return row_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes the given row-major sparse matrix as next row block.
+//
+// \param block The rows of the next block.
+// \return void
+// \exception std::invalid_argument Invalid row block.
+// \exception std::runtime_error Row block could not be serialized.
+//
+// This function appends the given rows to the row block stream. In case the number of columns
+// of the block doesn't match or in case the block exceeds the total number of rows of the
+// matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the elements
+template< typename MT >     // Type of the sparse matrix
+void RowBlockWriter<Archive,Type>::write( const SparseMatrix<MT,false>& block )
+{
+   typedef ConstIterator_< RemoveReference_< CompositeType_<MT> > >  ConstIterator;
+
+   if( (~block).columns() != n_ || (~block).rows() > m_ - row_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid row block" );
+   }
+
+   if( (~block).rows() == 0UL ) return;
+
+   CompositeType_<MT> A( ~block );  // Evaluation of the sparse matrix operand
+
+   counts_.resize( A.rows() );
+   indices_.clear();
+   values_.clear();
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      const size_t begin( indices_.size() );
+      for( ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         indices_.push_back( element->index() );
+         values_.push_back( element->value() );
+      }
+      counts_[i] = indices_.size() - begin;
+   }
+
+   archive_ << uint64_t( row_ ) << uint64_t( A.rows() ) << uint64_t( indices_.size() );
+   archive_.write( counts_.data(), counts_.size() );
+   archive_.write( indices_.data(), indices_.size() );
+   archive_.write( values_.data(), values_.size() );
+
+   if( !archive_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Row block could not be serialized" );
+   }
+
+   row_ += A.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given column-major sparse matrix as next row block.
+//
+// \param block The rows of the next block.
+// \return void
+// \exception std::invalid_argument Invalid row block.
+// \exception std::runtime_error Row block could not be serialized.
+//
+// This function converts the given column-major block to row-major storage order and appends
+// it to the row block stream.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the elements
+template< typename MT >     // Type of the sparse matrix
+void RowBlockWriter<Archive,Type>::write( const SparseMatrix<MT,true>& block )
+{
+   const CompressedMatrix<Type,rowMajor> tmp( ~block );
+   write( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ROWBLOCKREADER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Streaming reader for sparse matrices stored in row blocks.
+// \ingroup math_serialization
+//
+// The RowBlockReader reads a sparse matrix written by a RowBlockWriter block by block. Only a
+// single row block is held in memory at a time and blocks that are not of interest can be
+// skipped without reading their payload. The current block is provided as MappedCSRMatrix,
+// which refers to the internal buffers of the reader and can be used in any expression:
+
+   \code
+   blaze::Archive<std::ifstream> archive( "matrix.blaze" );
+   blaze::RowBlockReader< blaze::Archive<std::ifstream>, double > reader( archive );
+
+   blaze::DynamicVector<double> x( reader.columns(), 1.0 ), y( reader.rows() );
+
+   while( reader.next() ) {
+      subvector( y, reader.row(), reader.blockRows() ) = reader.read() * x;
+   }
+   \endcode
+
+// Note that the view returned by read() is only valid until the next call to next(). In case
+// the stream is corrupt or was written with a different element type, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the elements
+class RowBlockReader : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline RowBlockReader( Archive& archive );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows         () const noexcept;
+   inline size_t columns      () const noexcept;
+   inline size_t position     () const noexcept;
+   inline size_t row          () const noexcept;
+   inline size_t blockRows    () const noexcept;
+   inline size_t blockNonZeros() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Deserialization functions*******************************************************************
+   /*!\name Deserialization functions */
+   //@{
+   bool                  next();
+   MappedCSRMatrix<Type> read();
+   void                  skip();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Archive& archive_;               //!< The archive to be read from.
+   size_t m_;                       //!< The total number of rows of the matrix.
+   size_t n_;                       //!< The total number of columns of the matrix.
+   size_t row_;                     //!< The index of the first row of the current block.
+   size_t blockRows_;               //!< The number of rows of the current block.
+   size_t blockNonZeros_;           //!< The number of non-zero elements of the current block.
+   bool pending_;                   //!< \a true in case the payload of the current block is unread.
+   std::vector<uint64_t> offsets_;  //!< The row offsets of the current block.
+   std::vector<uint64_t> indices_;  //!< The column indices of the current block.
+   std::vector<Type>     values_;   //!< The values of the current block.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the RowBlockReader class.
+//
+// \param archive The archive to be read from.
+// \exception std::runtime_error Invalid row block stream.
+//
+// The constructor reads and validates the header of the row block stream.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the elements
+inline RowBlockReader<Archive,Type>::RowBlockReader( Archive& archive )
+   : archive_      ( archive )  // The archive to be read from
+   , m_            ( 0UL )      // The total number of rows of the matrix
+   , n_            ( 0UL )      // The total number of columns of the matrix
+   , row_          ( 0UL )      // The index of the first row of the current block
+   , blockRows_    ( 0UL )      // The number of rows of the current block
+   , blockNonZeros_( 0UL )      // The number of non-zero elements of the current block
+   , pending_      ( false )    // Flag for an unread block payload
+   , offsets_      ()           // The row offsets of the current block
+   , indices_      ()           // The column indices of the current block
+   , values_       ()           // The values of the current block
+{
+   uint8_t  version    ( 0U  );
+   uint8_t  type       ( 0U  );
+   uint8_t  elementType( 0U  );
+   uint8_t  elementSize( 0U  );
+   uint64_t rows       ( 0UL );
+   uint64_t columns    ( 0UL );
+
+   if( !archive_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty archive detected" );
+   }
+   else if( !( archive_ >> version >> type >> elementType >> elementSize >> rows >> columns ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+   else if( version != RowBlockFormat::version ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
+   }
+   else if( type != RowBlockFormat::type ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix type detected" );
+   }
+   else if( elementType != TypeValueMapping<Type>::value ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+   else if( elementSize != sizeof( Type ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element size detected" );
+   }
+
+   m_ = rows;
+   n_ = columns;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the total number of rows of the matrix.
+//
+// \return The total number of rows.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the elements
+inline size_t RowBlockReader<Archive,Type>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of columns of the matrix.
+//
+// \return The total number of columns.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the elements
+inline size_t RowBlockReader<Archive,Type>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the first row following the current block.
+//
+// \return The number of rows consumed so far.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the elements
+inline size_t RowBlockReader<Archive,Type>::position() const noexcept
+{
+   return row_ + blockRows_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the first row of the current block.
+//
+// \return The index of the first row of the current block.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the elements
+inline size_t RowBlockReader<Archive,Type>::row() const noexcept
+{
+   return row_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the current block.
+//
+// \return The number of rows of the current block.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the elements
+inline size_t RowBlockReader<Archive,Type>::blockRows() const noexcept
+{
+   return blockRows_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the current block.
+//
+// \return The number of non-zero elements of the current block.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the elements
+inline size_t RowBlockReader<Archive,Type>::blockNonZeros() const noexcept
+{
+   return blockNonZeros_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Advances to the next row block.
+//
+// \return \a true in case a next block exists, \a false if all rows have been consumed.
+// \exception std::runtime_error Invalid row block detected.
+//
+// This function reads the header of the next row block. In case the payload of the current
+// block has not been read, it is skipped.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the elements
+bool RowBlockReader<Archive,Type>::next()
+{
+   if( pending_ ) {
+      skip();
+   }
+
+   const size_t position( row_ + blockRows_ );
+
+   if( position == m_ ) {
+      return false;
+   }
+
+   uint64_t row( 0UL ), rows( 0UL ), nonzeros( 0UL );
+
+   if( !( archive_ >> row >> rows >> nonzeros ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+   else if( row != position || rows > m_ - position ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid row block detected" );
+   }
+   else if( nonzeros != 0UL && ( n_ == 0UL || ( nonzeros - 1UL ) / n_ >= rows ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   row_           = row;
+   blockRows_     = rows;
+   blockNonZeros_ = nonzeros;
+   pending_       = true;
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the payload of the current row block.
+//
+// \return Read-only view on the rows of the current block.
+// \exception std::logic_error No pending row block.
+// \exception std::runtime_error Row block could not be deserialized.
+//
+// This function reads the counts, indices, and values of the current block via bulk
+// Archive::read() calls and returns a view on the rows of the block. The view is valid
+// until the next call to next().
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the elements
+MappedCSRMatrix<Type> RowBlockReader<Archive,Type>::read()
+{
+   if( !pending_ ) {
+      BLAZE_THROW_LOGIC_ERROR( "No pending row block" );
+   }
+
+   pending_ = false;
+
+   offsets_.resize( blockRows_+1UL );
+   indices_.resize( blockNonZeros_ );
+   values_.resize( blockNonZeros_ );
+
+   offsets_[0] = 0UL;
+   archive_.read( offsets_.data()+1UL, blockRows_ );
+   archive_.read( indices_.data(), blockNonZeros_ );
+   archive_.read( values_.data(), blockNonZeros_ );
+
+   if( !archive_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Row block could not be deserialized" );
+   }
+
+   for( size_t i=0UL; i<blockRows_; ++i )
+   {
+      const uint64_t begin( offsets_[i] );
+
+      if( offsets_[i+1UL] > blockNonZeros_ - begin ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+      }
+
+      offsets_[i+1UL] += begin;
+
+      for( uint64_t k=begin; k<offsets_[i+1UL]; ++k ) {
+         if( indices_[k] >= n_ || ( k > begin && indices_[k] <= indices_[k-1UL] ) ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Invalid element index detected" );
+         }
+      }
+   }
+
+   if( offsets_[blockRows_] != blockNonZeros_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   return MappedCSRMatrix<Type>( blockRows_, n_, offsets_.data(), indices_.data(), values_.data() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skips the payload of the current row block.
+//
+// \return void
+// \exception std::logic_error No pending row block.
+// \exception std::runtime_error Row block could not be skipped.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the elements
+void RowBlockReader<Archive,Type>::skip()
+{
+   if( !pending_ ) {
+      BLAZE_THROW_LOGIC_ERROR( "No pending row block" );
+   }
+
+   pending_ = false;
+
+   archive_.ignore( blockRows_*sizeof(uint64_t) + blockNonZeros_*( sizeof(uint64_t) + sizeof(Type) ) );
+
+   if( !archive_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Row block could not be skipped" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Row block serialization functions */
+//@{
+template< typename Archive, typename MT, bool SO >
+void serializeRowBlocks( Archive& archive, const SparseMatrix<MT,SO>& mat, size_t blockSize );
+
+template< typename Archive, typename Type, typename MT, bool SO >
+void deserializeRows( RowBlockReader<Archive,Type>& reader, size_t row, size_t m, Matrix<MT,SO>& mat );
+
+template< typename Archive, typename Type, typename VT1, typename VT2 >
+void multiplyRowBlocks( RowBlockReader<Archive,Type>& reader,
+                        const DenseVector<VT1,false>& x, DenseVector<VT2,false>& y );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the given sparse matrix in row blocks of the given size.
+// \ingroup math_serialization
+//
+// \param archive The archive to be written.
+// \param mat The sparse matrix to be serialized.
+// \param blockSize The number of rows per block.
+// \return void
+// \exception std::invalid_argument Invalid block size.
+// \exception std::runtime_error Error during serialization.
+//
+// This function writes the given sparse matrix via a RowBlockWriter in blocks of \a blockSize
+// rows. The last block may contain less rows.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the sparse matrix
+        , bool SO >         // Storage order
+void serializeRowBlocks( Archive& archive, const SparseMatrix<MT,SO>& mat, size_t blockSize )
+{
+   if( blockSize == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid block size" );
+   }
+
+   CompositeType_<MT> A( ~mat );  // Evaluation of the sparse matrix operand
+
+   RowBlockWriter< Archive, ElementType_<MT> > writer( archive, A.rows(), A.columns() );
+
+   for( size_t i=0UL; i<A.rows(); i+=blockSize ) {
+      const size_t rows( min( blockSize, A.rows() - i ) );
+      writer.write( submatrix( A, i, 0UL, rows, A.columns() ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a range of rows from a row block stream.
+// \ingroup math_serialization
+//
+// \param reader The reader of the row block stream.
+// \param row The index of the first row to be deserialized.
+// \param m The number of rows to be deserialized.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::invalid_argument Invalid row range.
+// \exception std::runtime_error Error during deserialization.
+//
+// This function reconstitutes the given matrix from the rows \f$ [row..row+m) \f$ of the
+// row block stream. All blocks preceding the range are skipped without reading their payload
+// and the reading stops after the last block containing rows of the range. Since the stream
+// can only be read forward, the range must not start before the current position of the
+// reader. In case the matrix cannot be resized to \f$ m \times N \f$, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type     // Data type of the elements
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void deserializeRows( RowBlockReader<Archive,Type>& reader, size_t row, size_t m, Matrix<MT,SO>& mat )
+{
+   typedef ConstIterator_< MappedCSRMatrix<Type> >  ConstIterator;
+
+   if( row < reader.position() || row > reader.rows() || m > reader.rows() - row ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid row range" );
+   }
+
+   CompressedMatrix<Type,rowMajor> tmp( m, reader.columns() );
+
+   size_t i( row );
+
+   while( i < row+m && reader.next() )
+   {
+      if( reader.position() <= i ) {
+         reader.skip();
+         continue;
+      }
+
+      const MappedCSRMatrix<Type> block( reader.read() );
+
+      tmp.reserve( tmp.nonZeros() + block.nonZeros() );
+
+      for( ; i<reader.position() && i<row+m; ++i ) {
+         const size_t k( i - reader.row() );
+         for( ConstIterator element=block.begin(k); element!=block.end(k); ++element ) {
+            tmp.append( i-row, element->index(), element->value() );
+         }
+         tmp.finalize( i-row );
+      }
+   }
+
+   if( i != row+m ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Row range could not be deserialized" );
+   }
+
+   ~mat = tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a row block stream with a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup math_serialization
+//
+// \param reader The reader of the row block stream.
+// \param x The right-hand side dense vector.
+// \param y The resulting dense vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::runtime_error Error during deserialization.
+//
+// This function computes the sparse matrix/dense vector multiplication \f$ \vec{y}=A*\vec{x} \f$
+// block by block directly from the row block stream, without ever holding more than a single
+// row block in memory. The reader must be positioned at the beginning of the stream. In case
+// the size of \a x doesn't match the number of columns of the matrix or \a y cannot be resized
+// to the number of rows, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type     // Data type of the elements
+        , typename VT1      // Type of the right-hand side dense vector
+        , typename VT2 >    // Type of the resulting dense vector
+void multiplyRowBlocks( RowBlockReader<Archive,Type>& reader,
+                        const DenseVector<VT1,false>& x, DenseVector<VT2,false>& y )
+{
+   if( reader.position() != 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid position of the row block reader" );
+   }
+
+   if( (~x).size() != reader.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   resize( ~y, reader.rows(), false );
+
+   while( reader.next() ) {
+      subvector( ~y, reader.row(), reader.blockRows() ) = reader.read() * (~x);
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -63,7 +63,11 @@ namespace blaze {
 // This operation is only available for SSSE3, AVX2, and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDuint8 abs( const SIMDint8& a ) noexcept
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+{
+   return _mm512_abs_epi8( a.value );
+}
+#elif BLAZE_AVX2_MODE
 {
    return _mm256_abs_epi8( a.value );
 }
@@ -95,7 +99,11 @@ BLAZE_ALWAYS_INLINE const SIMDuint8 abs( const SIMDint8& a ) noexcept
 // This operation is only available for SSSE3, AVX2, and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDuint16 abs( const SIMDint16& a ) noexcept
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+{
+   return _mm512_abs_epi16( a.value );
+}
+#elif BLAZE_AVX2_MODE
 {
    return _mm256_abs_epi16( a.value );
 }
@@ -127,7 +135,7 @@ BLAZE_ALWAYS_INLINE const SIMDuint16 abs( const SIMDint16& a ) noexcept
 // This operation is only available for SSSE3, AVX2, and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDuint32 abs( const SIMDint32& a ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_abs_epi32( a.value );
 }
@@ -163,7 +171,7 @@ BLAZE_ALWAYS_INLINE const SIMDuint32 abs( const SIMDint32& a ) noexcept
 // This operation is only available for AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDuint64 abs( const SIMDint64& a ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_abs_epi64( a.value );
 }
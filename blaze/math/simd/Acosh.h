@@ -64,7 +64,7 @@ namespace blaze {
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDfloat acosh( const SIMDf32<T>& a ) noexcept
-#if BLAZE_SVML_MODE && BLAZE_MIC_MODE
+#if BLAZE_SVML_MODE && ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE )
 {
    return _mm512_acosh_ps( (~a).eval().value );
 }
@@ -101,7 +101,7 @@ BLAZE_ALWAYS_INLINE const SIMDfloat acosh( const SIMDf32<T>& a ) noexcept
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDdouble acosh( const SIMDf64<T>& a ) noexcept
-#if BLAZE_SVML_MODE && BLAZE_MIC_MODE
+#if BLAZE_SVML_MODE && ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE )
 {
    return _mm512_acosh_pd( (~a).eval().value );
 }
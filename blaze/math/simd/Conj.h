@@ -98,10 +98,17 @@ BLAZE_ALWAYS_INLINE const T conj( const SIMDi16<T>& a ) noexcept
 // \param a The vector of 16-bit integral complex values.
 // \return The complex conjugate values.
 //
-// This operation is only available for SSE2 and AVX2.
+// This operation is only available for SSE2, AVX2, and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDcint16 conj( const SIMDcint16& a ) noexcept
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+{
+   return _mm512_mullo_epi16( a.value, _mm512_set_epi16( -1, 1, -1, 1, -1, 1, -1, 1,
+                                                         -1, 1, -1, 1, -1, 1, -1, 1,
+                                                         -1, 1, -1, 1, -1, 1, -1, 1,
+                                                         -1, 1, -1, 1, -1, 1, -1, 1 ) );
+}
+#elif BLAZE_AVX2_MODE
 {
    return _mm256_mullo_epi16( a.value, _mm256_set_epi16( -1, 1, -1, 1, -1, 1, -1, 1,
                                                          -1, 1, -1, 1, -1, 1, -1, 1 ) );
@@ -149,7 +156,7 @@ BLAZE_ALWAYS_INLINE const T conj( const SIMDi32<T>& a ) noexcept
 // This operation is only available for SSE4, AVX2, and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDcint32 conj( const SIMDcint32& a ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_mullo_epi32( a.value, _mm512_set_epi32( -1, 1, -1, 1, -1, 1, -1, 1,
                                                          -1, 1, -1, 1, -1, 1, -1, 1 ) );
@@ -224,7 +231,7 @@ BLAZE_ALWAYS_INLINE const T conj( const SIMDf32<T>& a ) noexcept
 // This operation is only available for SSE2, AVX, and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDcfloat conj( const SIMDcfloat& a ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_mul_ps( a.value, _mm512_set_ps( -1.0F, 1.0F, -1.0F, 1.0F, -1.0F, 1.0F, -1.0F, 1.0F,
                                                  -1.0F, 1.0F, -1.0F, 1.0F, -1.0F, 1.0F, -1.0F, 1.0F ) );
@@ -276,7 +283,7 @@ BLAZE_ALWAYS_INLINE const T conj( const SIMDf64<T>& a ) noexcept
 // This operation is only available for SSE2, AVX, and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDcdouble conj( const SIMDcdouble& a ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_mul_pd( a.value, _mm512_set_pd( -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0 ) );
 }
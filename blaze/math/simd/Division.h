@@ -61,11 +61,11 @@ namespace blaze {
 // \param b The right-hand side SIMD operand.
 // \return The result of the division.
 //
-// This operation is only available for AVX-512.
+// This operation is only available for SVML and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDint32
    operator/( const SIMDint32& a, const SIMDint32& b ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_SVML_MODE && ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE )
 {
    return _mm512_div_epi32( a.value, b.value );
 }
@@ -83,11 +83,11 @@ BLAZE_ALWAYS_INLINE const SIMDint32
 // \param b The right-hand side scalars.
 // \return The result of the division.
 //
-// This operation is only available for AVX-512.
+// This operation is only available for SVML and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDcint32
    operator/( const SIMDcint32& a, const SIMDint32& b ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_SVML_MODE && ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE )
 {
    return _mm512_div_epi32( a.value, b.value );
 }
@@ -113,11 +113,11 @@ BLAZE_ALWAYS_INLINE const SIMDcint32
 // \param b The right-hand side SIMD operand.
 // \return The result of the division.
 //
-// This operation is only available for AVX-512.
+// This operation is only available for SVML and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDint64
    operator/( const SIMDint64& a, const SIMDint64& b ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_SVML_MODE && ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE )
 {
    return _mm512_div_epi64( a.value, b.value );
 }
@@ -135,11 +135,11 @@ BLAZE_ALWAYS_INLINE const SIMDint64
 // \param b The right-hand side scalars.
 // \return The result of the division.
 //
-// This operation is only available for AVX-512.
+// This operation is only available for SVML and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDcint64
    operator/( const SIMDcint64& a, const SIMDint64& b ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_SVML_MODE && ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE )
 {
    return _mm512_div_epi64( (~a).value, (~b).value );
 }
@@ -171,7 +171,7 @@ template< typename T1    // Type of the left-hand side operand
         , typename T2 >  // Type of the right-hand side operand
 BLAZE_ALWAYS_INLINE const SIMDfloat
    operator/( const SIMDf32<T1>& a, const SIMDf32<T2>& b ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_div_ps( (~a).eval().value, (~b).eval().value );
 }
@@ -201,7 +201,7 @@ BLAZE_ALWAYS_INLINE const SIMDfloat
 */
 BLAZE_ALWAYS_INLINE const SIMDcfloat
    operator/( const SIMDcfloat& a, const SIMDfloat& b ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_div_ps( a.value, b.value );
 }
@@ -241,7 +241,7 @@ template< typename T1    // Type of the left-hand side operand
         , typename T2 >  // Type of the right-hand side operand
 BLAZE_ALWAYS_INLINE const SIMDdouble
    operator/( const SIMDf64<T1>& a, const SIMDf64<T2>& b ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_div_pd( (~a).eval().value, (~b).eval().value );
 }
@@ -271,7 +271,7 @@ BLAZE_ALWAYS_INLINE const SIMDdouble
 */
 BLAZE_ALWAYS_INLINE const SIMDcdouble
    operator/( const SIMDcdouble& a, const SIMDdouble& b ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_div_pd( a.value, b.value );
 }
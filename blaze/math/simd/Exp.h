@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Transcendental.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Vectorization.h>
 
@@ -60,11 +61,13 @@ namespace blaze {
 // \param a The vector of single precision floating point values.
 // \return The resulting vector.
 //
-// This operation is only available via the SVML for SSE, AVX, and AVX-512.
+// This operation is available via the SVML for SSE, AVX, and AVX-512. In case the SVML is not
+// available, a native approximation with a maximum error of 1.1 ULP is used for SSE2, AVX, and
+// AVX-512.
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDfloat exp( const SIMDf32<T>& a ) noexcept
-#if BLAZE_SVML_MODE && BLAZE_MIC_MODE
+#if BLAZE_SVML_MODE && ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE )
 {
    return _mm512_exp_ps( (~a).eval().value );
 }
@@ -76,6 +79,10 @@ BLAZE_ALWAYS_INLINE const SIMDfloat exp( const SIMDf32<T>& a ) noexcept
 {
    return _mm_exp_ps( (~a).eval().value );
 }
+#elif BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || BLAZE_SSE2_MODE
+{
+   return SIMDTranscendental<float>::exp( (~a).eval().value );
+}
 #else
 = delete;
 #endif
@@ -97,11 +104,13 @@ BLAZE_ALWAYS_INLINE const SIMDfloat exp( const SIMDf32<T>& a ) noexcept
 // \param a The vector of double precision floating point values.
 // \return The resulting vector.
 //
-// This operation is only available via the SVML for SSE, AVX, and AVX-512.
+// This operation is available via the SVML for SSE, AVX, and AVX-512. In case the SVML is not
+// available, a native approximation with a maximum error of 1.1 ULP is used for SSE2, AVX, and
+// AVX-512.
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDdouble exp( const SIMDf64<T>& a ) noexcept
-#if BLAZE_SVML_MODE && BLAZE_MIC_MODE
+#if BLAZE_SVML_MODE && ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE )
 {
    return _mm512_exp_pd( (~a).eval().value );
 }
@@ -113,6 +122,10 @@ BLAZE_ALWAYS_INLINE const SIMDdouble exp( const SIMDf64<T>& a ) noexcept
 {
    return _mm_exp_pd( (~a).eval().value );
 }
+#elif BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || BLAZE_SSE2_MODE
+{
+   return SIMDTranscendental<double>::exp( (~a).eval().value );
+}
 #else
 = delete;
 #endif
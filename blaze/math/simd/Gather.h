@@ -0,0 +1,156 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Gather.h
+//  \brief Header file for the SIMD gather functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SIMD_GATHER_H_
+#define _BLAZE_MATH_SIMD_GATHER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/typetraits/HasSize.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values via a vector of 4-byte integral indices.
+// \ingroup simd
+//
+// \param address The base address of the 'float' values.
+// \param indices The first of the 4-byte integral indices.
+// \return The gathered vector of 'float' values.
+//
+// This function loads the 'float' values at the positions \a address[indices[0]],
+// \a address[indices[1]], ... into a single SIMD vector. The given indices are not required
+// to be properly aligned. Note that the indices are interpreted as signed 32-bit integers,
+// i.e. all indices have to be in the range \f$[0..2^{31}-1]\f$. The masked gather operations
+// with a zero source vector and a full mask are used in order to avoid the uninitialized source
+// vector of the unmasked intrinsics.
+*/
+template< typename T >  // Type of the integral indices
+BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,4UL> >, SIMDfloat >
+   gather( const float* address, const T* indices ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_mask_i32gather_ps( _mm512_setzero_ps(), 0xFFFF,
+                                    _mm512_loadu_si512( reinterpret_cast<const __m512i*>( indices ) ), address, 4 );
+#elif BLAZE_MIC_MODE
+   alignas( 64 ) float tmp[16UL];
+   for( size_t i=0UL; i<16UL; ++i )
+      tmp[i] = address[indices[i]];
+   return _mm512_load_ps( tmp );
+#elif BLAZE_AVX2_MODE
+   return _mm256_mask_i32gather_ps( _mm256_setzero_ps(), address,
+                                    _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ),
+                                    _mm256_castsi256_ps( _mm256_set1_epi32( -1 ) ), 4 );
+#elif BLAZE_AVX_MODE
+   return _mm256_set_ps( address[indices[7]], address[indices[6]], address[indices[5]], address[indices[4]],
+                         address[indices[3]], address[indices[2]], address[indices[1]], address[indices[0]] );
+#elif BLAZE_SSE_MODE
+   return _mm_set_ps( address[indices[3]], address[indices[2]], address[indices[1]], address[indices[0]] );
+#else
+   return address[*indices];
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values via a vector of 4-byte integral indices.
+// \ingroup simd
+//
+// \param address The base address of the 'double' values.
+// \param indices The first of the 4-byte integral indices.
+// \return The gathered vector of 'double' values.
+//
+// This function loads the 'double' values at the positions \a address[indices[0]],
+// \a address[indices[1]], ... into a single SIMD vector. The given indices are not required
+// to be properly aligned. Note that the indices are interpreted as signed 32-bit integers,
+// i.e. all indices have to be in the range \f$[0..2^{31}-1]\f$. The masked gather operations
+// with a zero source vector and a full mask are used in order to avoid the uninitialized source
+// vector of the unmasked intrinsics.
+*/
+template< typename T >  // Type of the integral indices
+BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,4UL> >, SIMDdouble >
+   gather( const double* address, const T* indices ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_mask_i32gather_pd( _mm512_setzero_pd(), 0xFF,
+                                    _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ), address, 8 );
+#elif BLAZE_MIC_MODE
+   alignas( 64 ) double tmp[8UL];
+   for( size_t i=0UL; i<8UL; ++i )
+      tmp[i] = address[indices[i]];
+   return _mm512_load_pd( tmp );
+#elif BLAZE_AVX2_MODE
+   return _mm256_mask_i32gather_pd( _mm256_setzero_pd(), address,
+                                    _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices ) ),
+                                    _mm256_castsi256_pd( _mm256_set1_epi64x( -1L ) ), 8 );
+#elif BLAZE_AVX_MODE
+   return _mm256_set_pd( address[indices[3]], address[indices[2]], address[indices[1]], address[indices[0]] );
+#elif BLAZE_SSE2_MODE
+   return _mm_set_pd( address[indices[1]], address[indices[0]] );
+#else
+   return address[*indices];
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,386 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/ISA.h
+//  \brief Header file for the detection of the available SIMD instruction sets
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_ISA_H_
+#define _BLAZE_MATH_SIMD_ISA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <ostream>
+#include <blaze/system/Vectorization.h>
+
+#if ( defined(__x86_64__) || defined(__i386__) ) && ( defined(__GNUC__) || defined(__clang__) )
+#  include <cpuid.h>
+#elif ( defined(_M_X64) || defined(_M_IX86) ) && defined(_MSC_VER)
+#  include <intrin.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INSTRUCTION SET ARCHITECTURES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief SIMD instruction set architectures.
+// \ingroup simd
+//
+// The ISA enumeration lists the SIMD instruction sets distinguished by the Blaze library in
+// ascending order, i.e. each instruction set implies the support of all previous instruction
+// sets. Note that \a sse4 represents both SSE4.1 and SSE4.2 and that \a avx2 additionally
+// implies the support of the FMA instructions.
+*/
+enum class ISA : int
+{
+   generic = 0,  //!< No SIMD instruction set.
+   sse2    = 1,  //!< The SSE2 instruction set.
+   sse3    = 2,  //!< The SSE3 instruction set.
+   ssse3   = 3,  //!< The SSSE3 instruction set.
+   sse4    = 4,  //!< The SSE4.1 and SSE4.2 instruction sets.
+   avx     = 5,  //!< The AVX instruction set.
+   avx2    = 6,  //!< The AVX2 and FMA instruction sets.
+   avx512f = 7   //!< The AVX-512F instruction set.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISA FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name ISA functions */
+//@{
+constexpr ISA compiledISA() noexcept;
+ISA detectedISA() noexcept;
+ISA activeISA() noexcept;
+bool isDispatched( ISA isa ) noexcept;
+const char* name( ISA isa ) noexcept;
+std::ostream& operator<<( std::ostream& os, ISA isa );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the SIMD instruction set the code is compiled for.
+// \ingroup simd
+//
+// \return The SIMD instruction set determined at compile time.
+//
+// This function returns the instruction set that has been selected at compile time via the
+// according compiler flags (as for instance \c -mavx2 or \c -march=native). All kernels that
+// are not explicitly dispatched at runtime use this instruction set.
+*/
+constexpr ISA compiledISA() noexcept
+{
+   return ( BLAZE_AVX512F_MODE )
+          ?( ISA::avx512f )
+          :( ( BLAZE_AVX2_MODE && BLAZE_FMA_MODE )
+             ?( ISA::avx2 )
+             :( ( BLAZE_AVX_MODE )
+                ?( ISA::avx )
+                :( ( BLAZE_SSE4_MODE )
+                   ?( ISA::sse4 )
+                   :( ( BLAZE_SSSE3_MODE )
+                      ?( ISA::ssse3 )
+                      :( ( BLAZE_SSE3_MODE )
+                         ?( ISA::sse3 )
+                         :( ( BLAZE_SSE2_MODE )?( ISA::sse2 ):( ISA::generic ) ) ) ) ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the SIMD instruction set supported by the CPU.
+// \ingroup simd
+//
+// \return The most powerful SIMD instruction set supported by the CPU and the operating system.
+//
+// This function queries the CPU via the \c cpuid instruction. The AVX-based instruction sets
+// are only reported in case the operating system saves the according register state on context
+// switches (as reported via the \c xgetbv instruction). On platforms without \c cpuid support
+// the function returns the instruction set the code is compiled for.
+*/
+inline ISA detectISA() noexcept
+{
+#if ( ( defined(__x86_64__) || defined(__i386__) ) && ( defined(__GNUC__) || defined(__clang__) ) ) || \
+    ( ( defined(_M_X64) || defined(_M_IX86) ) && defined(_MSC_VER) )
+
+   unsigned int regs[4] = { 0U, 0U, 0U, 0U };  // The EAX, EBX, ECX, and EDX registers
+   unsigned int maxLeaf( 0U );
+
+#  if !defined(__GNUC__) && !defined(__clang__)
+   int info[4];
+   __cpuid( info, 0 );
+   maxLeaf = static_cast<unsigned int>( info[0] );
+   if( maxLeaf < 1U ) return ISA::generic;
+   __cpuid( info, 1 );
+   for( int i=0; i<4; ++i ) regs[i] = static_cast<unsigned int>( info[i] );
+#  else
+   maxLeaf = __get_cpuid_max( 0U, nullptr );
+   if( maxLeaf < 1U ) return ISA::generic;
+   __cpuid( 1U, regs[0], regs[1], regs[2], regs[3] );
+#  endif
+
+   const unsigned int ecx( regs[2] );
+   const unsigned int edx( regs[3] );
+
+   if( !( edx & ( 1U << 26 ) ) ) return ISA::generic;
+   if( !( ecx & ( 1U <<  0 ) ) ) return ISA::sse2;
+   if( !( ecx & ( 1U <<  9 ) ) ) return ISA::sse3;
+   if( !( ecx & ( 1U << 19 ) ) || !( ecx & ( 1U << 20 ) ) ) return ISA::ssse3;
+
+   // Checking for AVX and the OS support of the YMM register state
+   if( !( ecx & ( 1U << 27 ) ) || !( ecx & ( 1U << 28 ) ) ) return ISA::sse4;
+
+#  if !defined(__GNUC__) && !defined(__clang__)
+   const unsigned long long xcr0( _xgetbv( 0 ) );
+#  else
+   unsigned int xcr0lo( 0U ), xcr0hi( 0U );
+   __asm__ __volatile__ ( "xgetbv" : "=a"(xcr0lo), "=d"(xcr0hi) : "c"(0) );
+   const unsigned long long xcr0( ( static_cast<unsigned long long>( xcr0hi ) << 32 ) | xcr0lo );
+#  endif
+
+   if( ( xcr0 & 0x06ULL ) != 0x06ULL ) return ISA::sse4;
+
+   // Checking for AVX2 and FMA
+   if( maxLeaf < 7U || !( ecx & ( 1U << 12 ) ) ) return ISA::avx;
+
+#  if !defined(__GNUC__) && !defined(__clang__)
+   __cpuidex( info, 7, 0 );
+   const unsigned int ebx7( static_cast<unsigned int>( info[1] ) );
+#  else
+   unsigned int eax7( 0U ), ebx7( 0U ), ecx7( 0U ), edx7( 0U );
+   __cpuid_count( 7U, 0U, eax7, ebx7, ecx7, edx7 );
+#  endif
+
+   if( !( ebx7 & ( 1U << 5 ) ) ) return ISA::avx;
+
+   // Checking for AVX-512F and the OS support of the opmask and ZMM register state
+   if( !( ebx7 & ( 1U << 16 ) ) || ( xcr0 & 0xE6ULL ) != 0xE6ULL ) return ISA::avx2;
+
+   return ISA::avx512f;
+
+#else
+
+   return compiledISA();
+
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the SIMD instruction set supported by the CPU.
+// \ingroup simd
+//
+// \return The most powerful SIMD instruction set supported by the CPU and the operating system.
+//
+// This function returns the most powerful instruction set supported by the CPU the program is
+// running on. The CPU is queried only once, all subsequent calls return the cached result.
+*/
+inline ISA detectedISA() noexcept
+{
+   static const ISA isa( detectISA() );
+   return isa;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the SIMD instruction set to be used by the runtime dispatched kernels.
+// \ingroup simd
+//
+// \return The active SIMD instruction set.
+//
+// This function determines the active instruction set based on the CPU capabilities and the
+// \c BLAZE_ISA environment variable. In case the environment variable is set to the name of
+// an instruction set (see the name() function), the active instruction set is restricted to
+// the given instruction set. In case the environment variable is set to any other value, a
+// warning is printed to the standard error stream and the detected instruction set is used
+// (see detectedISA()). An empty setting is treated like an unset variable. The active
+// instruction set is never higher than the instruction set supported by the CPU and never
+// lower than the instruction set the code is compiled for.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+inline ISA initActiveISA() noexcept
+{
+   ISA isa( detectedISA() );
+
+   const char* env = std::getenv( "BLAZE_ISA" );
+
+   if( env != nullptr && *env != '\0' )
+   {
+      bool valid( false );
+
+      for( int i=static_cast<int>( ISA::generic ); i<=static_cast<int>( ISA::avx512f ); ++i ) {
+         if( std::strcmp( env, name( static_cast<ISA>( i ) ) ) == 0 ) {
+            isa = ( static_cast<int>( isa ) < i )?( isa ):( static_cast<ISA>( i ) );
+            valid = true;
+            break;
+         }
+      }
+
+      if( !valid ) {
+         std::cerr << " Warning: Invalid BLAZE_ISA setting '" << env << "' (expected one of generic, "
+                   << "sse2, sse3, ssse3, sse4, avx, avx2, or avx512f)! Falling back to the detected "
+                   << "instruction set '" << name( isa ) << "'.\n";
+      }
+   }
+
+   return ( static_cast<int>( isa ) < static_cast<int>( compiledISA() ) )?( compiledISA() ):( isa );
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the active SIMD instruction set.
+// \ingroup simd
+//
+// \return The active SIMD instruction set.
+//
+// This function returns the instruction set used by the runtime dispatched kernels of the
+// Blaze library. By default, this is the most powerful instruction set supported by the CPU
+// (see detectedISA()). For testing purposes the instruction set can be restricted via the
+// \c BLAZE_ISA environment variable:
+
+   \code
+   BLAZE_ISA=avx2 ./program  // Restricts the dispatched kernels to AVX2
+   BLAZE_ISA=sse2 ./program  // Disables the dispatched kernels on SSE2 builds
+   \endcode
+
+// Valid settings are the names of the instruction sets as returned by the name() function
+// (i.e. \c generic, \c sse2, \c sse3, \c ssse3, \c sse4, \c avx, \c avx2, and \c avx512f).
+// Any other setting is reported on the standard error stream and the most powerful instruction
+// set supported by the CPU is used instead. The instruction set is determined on the first call,
+// later changes of the environment variable have no effect. Note that the active instruction set is never lower than the
+// instruction set the code is compiled for (see compiledISA()) since all kernels that are
+// not dispatched at runtime are unconditionally compiled for this instruction set.
+*/
+inline ISA activeISA() noexcept
+{
+   static const ISA isa( initActiveISA() );
+   return isa;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the runtime dispatched kernels for the given instruction set are used.
+// \ingroup simd
+//
+// \param isa The instruction set of a runtime dispatched kernel.
+// \return \a true in case the kernel should be used, \a false if not.
+//
+// This function returns \a true in case the runtime dispatch mode is active, the given
+// instruction set is supported by the active instruction set (see activeISA()), and the
+// instruction set is more powerful than the instruction set the code is compiled for. In
+// all other cases the default kernels, compiled for the compile time instruction set, are
+// at least as fast and the function returns \a false.
+*/
+inline bool isDispatched( ISA isa ) noexcept
+{
+   return BLAZE_RUNTIME_DISPATCH_MODE &&
+          static_cast<int>( isa ) >  static_cast<int>( compiledISA() ) &&
+          static_cast<int>( isa ) <= static_cast<int>( activeISA() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the given SIMD instruction set.
+// \ingroup simd
+//
+// \param isa The given SIMD instruction set.
+// \return The name of the instruction set (for instance \c "avx2").
+*/
+inline const char* name( ISA isa ) noexcept
+{
+   switch( isa ) {
+      case ISA::generic: return "generic";
+      case ISA::sse2   : return "sse2";
+      case ISA::sse3   : return "sse3";
+      case ISA::ssse3  : return "ssse3";
+      case ISA::sse4   : return "sse4";
+      case ISA::avx    : return "avx";
+      case ISA::avx2   : return "avx2";
+      case ISA::avx512f: return "avx512f";
+      default          : return "unknown";
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global output operator for SIMD instruction sets.
+// \ingroup simd
+//
+// \param os Reference to the output stream.
+// \param isa The SIMD instruction set to be added to the stream.
+// \return Reference to the output stream.
+*/
+inline std::ostream& operator<<( std::ostream& os, ISA isa )
+{
+   return os << name( isa );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1011 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Primitives.h
+//  \brief Header file for the low-level SIMD primitives of the native SIMD math kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_PRIMITIVES_H_
+#define _BLAZE_MATH_SIMD_PRIMITIVES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Low-level SIMD primitives for the native SIMD math kernels.
+// \ingroup simd
+//
+// The SIMDMath class template provides the raw arithmetic, bitwise, comparison, and exponent
+// manipulation primitives on the intrinsic vector types that the native SIMD math kernels
+// (see blaze/math/simd/Transcendental.h) are built upon. In contrast to the SIMD operators
+// of the SIMD data types all primitives are evaluated exactly in the given order, i.e. no
+// automatic contraction to fused multiply-add operations or reassociation takes place. The
+// primitives are only available for SSE2, AVX, and AVX-512.
+*/
+template< typename T >  // Type of the vector elements
+struct SIMDMath;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+#if BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || BLAZE_SSE2_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SIMDMath class template for single precision values.
+// \ingroup simd
+*/
+template<>
+struct SIMDMath<float>
+{
+   //**Type definitions****************************************************************************
+#if BLAZE_AVX512F_MODE
+   using Type = __m512;     //!< Type of the SIMD vector.
+   using Mask = __mmask16;  //!< Type of the comparison mask.
+#elif BLAZE_AVX_MODE
+   using Type = __m256;     //!< Type of the SIMD vector.
+   using Mask = __m256;     //!< Type of the comparison mask.
+#else
+   using Type = __m128;     //!< Type of the SIMD vector.
+   using Mask = __m128;     //!< Type of the comparison mask.
+#endif
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum : size_t { size = sizeof( Type ) / sizeof( float ) };  //!< Number of vector elements.
+   //**********************************************************************************************
+
+   //**Initialization functions********************************************************************
+   static BLAZE_ALWAYS_INLINE Type set( float v ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_set1_ps( v );
+#elif BLAZE_AVX_MODE
+      return _mm256_set1_ps( v );
+#else
+      return _mm_set1_ps( v );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type setbits( int v ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_castsi512_ps( _mm512_set1_epi32( v ) );
+#elif BLAZE_AVX_MODE
+      return _mm256_castsi256_ps( _mm256_set1_epi32( v ) );
+#else
+      return _mm_castsi128_ps( _mm_set1_epi32( v ) );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type loadu( const float* p ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_loadu_ps( p );
+#elif BLAZE_AVX_MODE
+      return _mm256_loadu_ps( p );
+#else
+      return _mm_loadu_ps( p );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE void storeu( float* p, Type a ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      _mm512_storeu_ps( p, a );
+#elif BLAZE_AVX_MODE
+      _mm256_storeu_ps( p, a );
+#else
+      _mm_storeu_ps( p, a );
+#endif
+   }
+   //**********************************************************************************************
+
+   //**Arithmetic functions************************************************************************
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_add_ps( a, b );
+#elif BLAZE_AVX_MODE
+      return _mm256_add_ps( a, b );
+#else
+      return _mm_add_ps( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type sub( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_sub_ps( a, b );
+#elif BLAZE_AVX_MODE
+      return _mm256_sub_ps( a, b );
+#else
+      return _mm_sub_ps( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type mul( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_mul_ps( a, b );
+#elif BLAZE_AVX_MODE
+      return _mm256_mul_ps( a, b );
+#else
+      return _mm_mul_ps( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type div( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_div_ps( a, b );
+#elif BLAZE_AVX_MODE
+      return _mm256_div_ps( a, b );
+#else
+      return _mm_div_ps( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type sqrt( Type a ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_sqrt_ps( a );
+#elif BLAZE_AVX_MODE
+      return _mm256_sqrt_ps( a );
+#else
+      return _mm_sqrt_ps( a );
+#endif
+   }
+
+   // Computes a*b+c (fused in case FMA is available)
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_fmadd_ps( a, b, c );
+#elif BLAZE_FMA_MODE && BLAZE_AVX_MODE
+      return _mm256_fmadd_ps( a, b, c );
+#elif BLAZE_FMA_MODE
+      return _mm_fmadd_ps( a, b, c );
+#else
+      return add( mul( a, b ), c );
+#endif
+   }
+
+   // Computes c-a*b (fused in case FMA is available)
+   static BLAZE_ALWAYS_INLINE Type fnmadd( Type a, Type b, Type c ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_fnmadd_ps( a, b, c );
+#elif BLAZE_FMA_MODE && BLAZE_AVX_MODE
+      return _mm256_fnmadd_ps( a, b, c );
+#elif BLAZE_FMA_MODE
+      return _mm_fnmadd_ps( a, b, c );
+#else
+      return sub( c, mul( a, b ) );
+#endif
+   }
+
+   // Horner evaluation of c0 + c1*x + c2*x^2 + ...
+   static BLAZE_ALWAYS_INLINE Type poly( Type /*x*/, float c0 ) noexcept
+   {
+      return set( c0 );
+   }
+
+   template< typename... Cs >
+   static BLAZE_ALWAYS_INLINE Type poly( Type x, float c0, Cs... cs ) noexcept
+   {
+      return fmadd( poly( x, cs... ), x, set( c0 ) );
+   }
+   //**********************************************************************************************
+
+   //**Bitwise functions***************************************************************************
+   static BLAZE_ALWAYS_INLINE Type bitAnd( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_castsi512_ps( _mm512_and_si512( _mm512_castps_si512( a ), _mm512_castps_si512( b ) ) );
+#elif BLAZE_AVX_MODE
+      return _mm256_and_ps( a, b );
+#else
+      return _mm_and_ps( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type bitOr( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_castsi512_ps( _mm512_or_si512( _mm512_castps_si512( a ), _mm512_castps_si512( b ) ) );
+#elif BLAZE_AVX_MODE
+      return _mm256_or_ps( a, b );
+#else
+      return _mm_or_ps( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type bitXor( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_castsi512_ps( _mm512_xor_si512( _mm512_castps_si512( a ), _mm512_castps_si512( b ) ) );
+#elif BLAZE_AVX_MODE
+      return _mm256_xor_ps( a, b );
+#else
+      return _mm_xor_ps( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type signbit( Type a ) noexcept
+   {
+      return bitAnd( a, setbits( int( 0x80000000 ) ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type abs( Type a ) noexcept
+   {
+      return bitAnd( a, setbits( 0x7FFFFFFF ) );
+   }
+   //**********************************************************************************************
+
+   //**Comparison functions************************************************************************
+   static BLAZE_ALWAYS_INLINE Mask cmpeq( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_cmp_ps_mask( a, b, _CMP_EQ_OQ );
+#elif BLAZE_AVX_MODE
+      return _mm256_cmp_ps( a, b, _CMP_EQ_OQ );
+#else
+      return _mm_cmpeq_ps( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Mask cmplt( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_cmp_ps_mask( a, b, _CMP_LT_OQ );
+#elif BLAZE_AVX_MODE
+      return _mm256_cmp_ps( a, b, _CMP_LT_OQ );
+#else
+      return _mm_cmplt_ps( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Mask cmple( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_cmp_ps_mask( a, b, _CMP_LE_OQ );
+#elif BLAZE_AVX_MODE
+      return _mm256_cmp_ps( a, b, _CMP_LE_OQ );
+#else
+      return _mm_cmple_ps( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Mask cmpgt( Type a, Type b ) noexcept
+   {
+      return cmplt( b, a );
+   }
+
+   static BLAZE_ALWAYS_INLINE Mask cmpge( Type a, Type b ) noexcept
+   {
+      return cmple( b, a );
+   }
+
+   static BLAZE_ALWAYS_INLINE Mask isNan( Type a ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_cmp_ps_mask( a, a, _CMP_UNORD_Q );
+#elif BLAZE_AVX_MODE
+      return _mm256_cmp_ps( a, a, _CMP_UNORD_Q );
+#else
+      return _mm_cmpunord_ps( a, a );
+#endif
+   }
+   //**********************************************************************************************
+
+   //**Mask functions******************************************************************************
+   static BLAZE_ALWAYS_INLINE Mask mand( Mask a, Mask b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return static_cast<Mask>( a & b );
+#else
+      return bitAnd( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Mask mor( Mask a, Mask b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return static_cast<Mask>( a | b );
+#else
+      return bitOr( a, b );
+#endif
+   }
+
+   // Computes ~a & b
+   static BLAZE_ALWAYS_INLINE Mask mandnot( Mask a, Mask b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return static_cast<Mask>( ~a & b );
+#elif BLAZE_AVX_MODE
+      return _mm256_andnot_ps( a, b );
+#else
+      return _mm_andnot_ps( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE bool any( Mask m ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return m != 0;
+#elif BLAZE_AVX_MODE
+      return _mm256_movemask_ps( m ) != 0;
+#else
+      return _mm_movemask_ps( m ) != 0;
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE bool all( Mask m ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return m == 0xFFFF;
+#elif BLAZE_AVX_MODE
+      return _mm256_movemask_ps( m ) == 0xFF;
+#else
+      return _mm_movemask_ps( m ) == 0xF;
+#endif
+   }
+
+   // Selects a for all set and b for all unset mask elements
+   static BLAZE_ALWAYS_INLINE Type select( Mask m, Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_mask_blend_ps( m, b, a );
+#elif BLAZE_AVX_MODE
+      return _mm256_blendv_ps( b, a, m );
+#elif BLAZE_SSE4_MODE
+      return _mm_blendv_ps( b, a, m );
+#else
+      return _mm_or_ps( _mm_and_ps( m, a ), _mm_andnot_ps( m, b ) );
+#endif
+   }
+   //**********************************************************************************************
+
+   //**Rounding and exponent functions*************************************************************
+   // Rounds to the nearest integral value (ties to even)
+   static BLAZE_ALWAYS_INLINE Type round( Type a ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_roundscale_ps( a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+#elif BLAZE_AVX_MODE
+      return _mm256_round_ps( a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+#elif BLAZE_SSE4_MODE
+      return _mm_round_ps( a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+#else
+      const Type magic( set( 12582912.0F ) );  // 1.5 * 2^23
+      const Type r( sub( add( a, magic ), magic ) );
+      return select( cmplt( abs( a ), set( 4194304.0F ) ), r, a );
+#endif
+   }
+
+   // Computes 2^n for an integral n in the range [-126,127]
+   static BLAZE_ALWAYS_INLINE Type pow2( Type n ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_scalef_ps( set( 1.0F ), n );
+#else
+      const Type t( add( n, set( 12583039.0F ) ) );  // 1.5 * 2^23 + 127
+#  if BLAZE_AVX2_MODE
+      return _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_castps_si256( t ), 23 ) );
+#  elif BLAZE_AVX_MODE
+      const __m256i bits( _mm256_castps_si256( t ) );
+      const __m128i lo( _mm_slli_epi32( _mm256_castsi256_si128( bits ), 23 ) );
+      const __m128i hi( _mm_slli_epi32( _mm256_extractf128_si256( bits, 1 ), 23 ) );
+      return _mm256_castsi256_ps( _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) );
+#  else
+      return _mm_castsi128_ps( _mm_slli_epi32( _mm_castps_si128( t ), 23 ) );
+#  endif
+#endif
+   }
+
+   // Computes a*2^n for an integral n in the range [-252,254]
+   static BLAZE_ALWAYS_INLINE Type ldexp( Type a, Type n ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_scalef_ps( a, n );
+#else
+      const Type n1( round( mul( n, set( 0.5F ) ) ) );
+      return mul( mul( a, pow2( n1 ) ), pow2( sub( n, n1 ) ) );
+#endif
+   }
+
+   // Computes floor(log2(a)) for a positive, normalized a
+   static BLAZE_ALWAYS_INLINE Type exponent( Type a ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_getexp_ps( a );
+#else
+#  if BLAZE_AVX2_MODE
+      const Type e( _mm256_castsi256_ps( _mm256_srli_epi32( _mm256_castps_si256( a ), 23 ) ) );
+#  elif BLAZE_AVX_MODE
+      const __m256i bits( _mm256_castps_si256( a ) );
+      const __m128i lo( _mm_srli_epi32( _mm256_castsi256_si128( bits ), 23 ) );
+      const __m128i hi( _mm_srli_epi32( _mm256_extractf128_si256( bits, 1 ), 23 ) );
+      const Type e( _mm256_castsi256_ps( _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) ) );
+#  else
+      const Type e( _mm_castsi128_ps( _mm_srli_epi32( _mm_castps_si128( a ), 23 ) ) );
+#  endif
+      return sub( bitOr( e, setbits( 0x4B000000 ) ), set( 8388735.0F ) );  // 2^23 + 127
+#endif
+   }
+
+   // Computes a*2^-exponent(a), i.e. the mantissa in [1,2), for a positive, normalized a
+   static BLAZE_ALWAYS_INLINE Type mantissa( Type a ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_getmant_ps( a, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero );
+#else
+      return bitOr( bitAnd( a, setbits( 0x007FFFFF ) ), set( 1.0F ) );
+#endif
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+#if BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || BLAZE_SSE2_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SIMDMath class template for double precision values.
+// \ingroup simd
+*/
+template<>
+struct SIMDMath<double>
+{
+   //**Type definitions****************************************************************************
+#if BLAZE_AVX512F_MODE
+   using Type = __m512d;   //!< Type of the SIMD vector.
+   using Mask = __mmask8;  //!< Type of the comparison mask.
+#elif BLAZE_AVX_MODE
+   using Type = __m256d;   //!< Type of the SIMD vector.
+   using Mask = __m256d;   //!< Type of the comparison mask.
+#else
+   using Type = __m128d;   //!< Type of the SIMD vector.
+   using Mask = __m128d;   //!< Type of the comparison mask.
+#endif
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum : size_t { size = sizeof( Type ) / sizeof( double ) };  //!< Number of vector elements.
+   //**********************************************************************************************
+
+   //**Initialization functions********************************************************************
+   static BLAZE_ALWAYS_INLINE Type set( double v ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_set1_pd( v );
+#elif BLAZE_AVX_MODE
+      return _mm256_set1_pd( v );
+#else
+      return _mm_set1_pd( v );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type setbits( long long v ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_castsi512_pd( _mm512_set1_epi64( v ) );
+#elif BLAZE_AVX_MODE
+      return _mm256_castsi256_pd( _mm256_set1_epi64x( v ) );
+#else
+      return _mm_castsi128_pd( _mm_set1_epi64x( v ) );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type loadu( const double* p ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_loadu_pd( p );
+#elif BLAZE_AVX_MODE
+      return _mm256_loadu_pd( p );
+#else
+      return _mm_loadu_pd( p );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE void storeu( double* p, Type a ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      _mm512_storeu_pd( p, a );
+#elif BLAZE_AVX_MODE
+      _mm256_storeu_pd( p, a );
+#else
+      _mm_storeu_pd( p, a );
+#endif
+   }
+   //**********************************************************************************************
+
+   //**Arithmetic functions************************************************************************
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_add_pd( a, b );
+#elif BLAZE_AVX_MODE
+      return _mm256_add_pd( a, b );
+#else
+      return _mm_add_pd( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type sub( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_sub_pd( a, b );
+#elif BLAZE_AVX_MODE
+      return _mm256_sub_pd( a, b );
+#else
+      return _mm_sub_pd( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type mul( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_mul_pd( a, b );
+#elif BLAZE_AVX_MODE
+      return _mm256_mul_pd( a, b );
+#else
+      return _mm_mul_pd( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type div( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_div_pd( a, b );
+#elif BLAZE_AVX_MODE
+      return _mm256_div_pd( a, b );
+#else
+      return _mm_div_pd( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type sqrt( Type a ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_sqrt_pd( a );
+#elif BLAZE_AVX_MODE
+      return _mm256_sqrt_pd( a );
+#else
+      return _mm_sqrt_pd( a );
+#endif
+   }
+
+   // Computes a*b+c (fused in case FMA is available)
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_fmadd_pd( a, b, c );
+#elif BLAZE_FMA_MODE && BLAZE_AVX_MODE
+      return _mm256_fmadd_pd( a, b, c );
+#elif BLAZE_FMA_MODE
+      return _mm_fmadd_pd( a, b, c );
+#else
+      return add( mul( a, b ), c );
+#endif
+   }
+
+   // Computes c-a*b (fused in case FMA is available)
+   static BLAZE_ALWAYS_INLINE Type fnmadd( Type a, Type b, Type c ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_fnmadd_pd( a, b, c );
+#elif BLAZE_FMA_MODE && BLAZE_AVX_MODE
+      return _mm256_fnmadd_pd( a, b, c );
+#elif BLAZE_FMA_MODE
+      return _mm_fnmadd_pd( a, b, c );
+#else
+      return sub( c, mul( a, b ) );
+#endif
+   }
+
+   // Computes the product p=a*b and its rounding error e=a*b-p exactly
+   static BLAZE_ALWAYS_INLINE void twoProd( Type a, Type b, Type& p, Type& e ) noexcept
+   {
+      p = mul( a, b );
+#if BLAZE_AVX512F_MODE
+      e = _mm512_fmsub_pd( a, b, p );
+#elif BLAZE_FMA_MODE && BLAZE_AVX_MODE
+      e = _mm256_fmsub_pd( a, b, p );
+#elif BLAZE_FMA_MODE
+      e = _mm_fmsub_pd( a, b, p );
+#else
+      const Type split( set( 134217729.0 ) );  // 2^27 + 1
+      const Type ta( mul( a, split ) );
+      const Type tb( mul( b, split ) );
+      const Type ah( sub( ta, sub( ta, a ) ) );
+      const Type bh( sub( tb, sub( tb, b ) ) );
+      const Type al( sub( a, ah ) );
+      const Type bl( sub( b, bh ) );
+      e = add( add( add( sub( mul( ah, bh ), p ), mul( ah, bl ) ), mul( al, bh ) ), mul( al, bl ) );
+#endif
+   }
+
+   // Computes the sum s=a+b and its rounding error e=a+b-s exactly
+   static BLAZE_ALWAYS_INLINE void twoSum( Type a, Type b, Type& s, Type& e ) noexcept
+   {
+      s = add( a, b );
+      const Type bb( sub( s, a ) );
+      e = add( sub( a, sub( s, bb ) ), sub( b, bb ) );
+   }
+
+   // Horner evaluation of c0 + c1*x + c2*x^2 + ...
+   static BLAZE_ALWAYS_INLINE Type poly( Type /*x*/, double c0 ) noexcept
+   {
+      return set( c0 );
+   }
+
+   template< typename... Cs >
+   static BLAZE_ALWAYS_INLINE Type poly( Type x, double c0, Cs... cs ) noexcept
+   {
+      return fmadd( poly( x, cs... ), x, set( c0 ) );
+   }
+   //**********************************************************************************************
+
+   //**Bitwise functions***************************************************************************
+   static BLAZE_ALWAYS_INLINE Type bitAnd( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_castsi512_pd( _mm512_and_si512( _mm512_castpd_si512( a ), _mm512_castpd_si512( b ) ) );
+#elif BLAZE_AVX_MODE
+      return _mm256_and_pd( a, b );
+#else
+      return _mm_and_pd( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type bitOr( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_castsi512_pd( _mm512_or_si512( _mm512_castpd_si512( a ), _mm512_castpd_si512( b ) ) );
+#elif BLAZE_AVX_MODE
+      return _mm256_or_pd( a, b );
+#else
+      return _mm_or_pd( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type bitXor( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_castsi512_pd( _mm512_xor_si512( _mm512_castpd_si512( a ), _mm512_castpd_si512( b ) ) );
+#elif BLAZE_AVX_MODE
+      return _mm256_xor_pd( a, b );
+#else
+      return _mm_xor_pd( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type signbit( Type a ) noexcept
+   {
+      return bitAnd( a, setbits( static_cast<long long>( 0x8000000000000000ULL ) ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type abs( Type a ) noexcept
+   {
+      return bitAnd( a, setbits( 0x7FFFFFFFFFFFFFFFLL ) );
+   }
+   //**********************************************************************************************
+
+   //**Comparison functions************************************************************************
+   static BLAZE_ALWAYS_INLINE Mask cmpeq( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_cmp_pd_mask( a, b, _CMP_EQ_OQ );
+#elif BLAZE_AVX_MODE
+      return _mm256_cmp_pd( a, b, _CMP_EQ_OQ );
+#else
+      return _mm_cmpeq_pd( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Mask cmplt( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_cmp_pd_mask( a, b, _CMP_LT_OQ );
+#elif BLAZE_AVX_MODE
+      return _mm256_cmp_pd( a, b, _CMP_LT_OQ );
+#else
+      return _mm_cmplt_pd( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Mask cmple( Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_cmp_pd_mask( a, b, _CMP_LE_OQ );
+#elif BLAZE_AVX_MODE
+      return _mm256_cmp_pd( a, b, _CMP_LE_OQ );
+#else
+      return _mm_cmple_pd( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Mask cmpgt( Type a, Type b ) noexcept
+   {
+      return cmplt( b, a );
+   }
+
+   static BLAZE_ALWAYS_INLINE Mask cmpge( Type a, Type b ) noexcept
+   {
+      return cmple( b, a );
+   }
+
+   static BLAZE_ALWAYS_INLINE Mask isNan( Type a ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_cmp_pd_mask( a, a, _CMP_UNORD_Q );
+#elif BLAZE_AVX_MODE
+      return _mm256_cmp_pd( a, a, _CMP_UNORD_Q );
+#else
+      return _mm_cmpunord_pd( a, a );
+#endif
+   }
+   //**********************************************************************************************
+
+   //**Mask functions******************************************************************************
+   static BLAZE_ALWAYS_INLINE Mask mand( Mask a, Mask b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return static_cast<Mask>( a & b );
+#else
+      return bitAnd( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Mask mor( Mask a, Mask b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return static_cast<Mask>( a | b );
+#else
+      return bitOr( a, b );
+#endif
+   }
+
+   // Computes ~a & b
+   static BLAZE_ALWAYS_INLINE Mask mandnot( Mask a, Mask b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return static_cast<Mask>( ~a & b );
+#elif BLAZE_AVX_MODE
+      return _mm256_andnot_pd( a, b );
+#else
+      return _mm_andnot_pd( a, b );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE bool any( Mask m ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return m != 0;
+#elif BLAZE_AVX_MODE
+      return _mm256_movemask_pd( m ) != 0;
+#else
+      return _mm_movemask_pd( m ) != 0;
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE bool all( Mask m ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return m == 0xFF;
+#elif BLAZE_AVX_MODE
+      return _mm256_movemask_pd( m ) == 0xF;
+#else
+      return _mm_movemask_pd( m ) == 0x3;
+#endif
+   }
+
+   // Selects a for all set and b for all unset mask elements
+   static BLAZE_ALWAYS_INLINE Type select( Mask m, Type a, Type b ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_mask_blend_pd( m, b, a );
+#elif BLAZE_AVX_MODE
+      return _mm256_blendv_pd( b, a, m );
+#elif BLAZE_SSE4_MODE
+      return _mm_blendv_pd( b, a, m );
+#else
+      return _mm_or_pd( _mm_and_pd( m, a ), _mm_andnot_pd( m, b ) );
+#endif
+   }
+   //**********************************************************************************************
+
+   //**Rounding and exponent functions*************************************************************
+   // Rounds to the nearest integral value (ties to even)
+   static BLAZE_ALWAYS_INLINE Type round( Type a ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_roundscale_pd( a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+#elif BLAZE_AVX_MODE
+      return _mm256_round_pd( a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+#elif BLAZE_SSE4_MODE
+      return _mm_round_pd( a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+#else
+      const Type magic( set( 6755399441055744.0 ) );  // 1.5 * 2^52
+      const Type r( sub( add( a, magic ), magic ) );
+      return select( cmplt( abs( a ), set( 2251799813685248.0 ) ), r, a );
+#endif
+   }
+
+   // Computes 2^n for an integral n in the range [-1022,1023]
+   static BLAZE_ALWAYS_INLINE Type pow2( Type n ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_scalef_pd( set( 1.0 ), n );
+#else
+      const Type t( add( n, set( 6755399441056767.0 ) ) );  // 1.5 * 2^52 + 1023
+#  if BLAZE_AVX2_MODE
+      return _mm256_castsi256_pd( _mm256_slli_epi64( _mm256_castpd_si256( t ), 52 ) );
+#  elif BLAZE_AVX_MODE
+      const __m256i bits( _mm256_castpd_si256( t ) );
+      const __m128i lo( _mm_slli_epi64( _mm256_castsi256_si128( bits ), 52 ) );
+      const __m128i hi( _mm_slli_epi64( _mm256_extractf128_si256( bits, 1 ), 52 ) );
+      return _mm256_castsi256_pd( _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) );
+#  else
+      return _mm_castsi128_pd( _mm_slli_epi64( _mm_castpd_si128( t ), 52 ) );
+#  endif
+#endif
+   }
+
+   // Computes a*2^n for an integral n in the range [-2044,2046]
+   static BLAZE_ALWAYS_INLINE Type ldexp( Type a, Type n ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_scalef_pd( a, n );
+#else
+      const Type n1( round( mul( n, set( 0.5 ) ) ) );
+      return mul( mul( a, pow2( n1 ) ), pow2( sub( n, n1 ) ) );
+#endif
+   }
+
+   // Computes floor(log2(a)) for a positive, normalized a
+   static BLAZE_ALWAYS_INLINE Type exponent( Type a ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_getexp_pd( a );
+#else
+#  if BLAZE_AVX2_MODE
+      const Type e( _mm256_castsi256_pd( _mm256_srli_epi64( _mm256_castpd_si256( a ), 52 ) ) );
+#  elif BLAZE_AVX_MODE
+      const __m256i bits( _mm256_castpd_si256( a ) );
+      const __m128i lo( _mm_srli_epi64( _mm256_castsi256_si128( bits ), 52 ) );
+      const __m128i hi( _mm_srli_epi64( _mm256_extractf128_si256( bits, 1 ), 52 ) );
+      const Type e( _mm256_castsi256_pd( _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) ) );
+#  else
+      const Type e( _mm_castsi128_pd( _mm_srli_epi64( _mm_castpd_si128( a ), 52 ) ) );
+#  endif
+      return sub( bitOr( e, setbits( 0x4330000000000000LL ) ), set( 4503599627371519.0 ) );  // 2^52 + 1023
+#endif
+   }
+
+   // Computes a*2^-exponent(a), i.e. the mantissa in [1,2), for a positive, normalized a
+   static BLAZE_ALWAYS_INLINE Type mantissa( Type a ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_getmant_pd( a, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero );
+#else
+      return bitOr( bitAnd( a, setbits( 0x000FFFFFFFFFFFFFLL ) ), set( 1.0 ) );
+#endif
+   }
+   //**********************************************************************************************
+
+   //**Conversion functions************************************************************************
+   // Converts the lower half of a single precision vector to double precision
+   static BLAZE_ALWAYS_INLINE Type cvtlo( SIMDMath<float>::Type a ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_cvtps_pd( _mm512_castps512_ps256( a ) );
+#elif BLAZE_AVX_MODE
+      return _mm256_cvtps_pd( _mm256_castps256_ps128( a ) );
+#else
+      return _mm_cvtps_pd( a );
+#endif
+   }
+
+   // Converts the upper half of a single precision vector to double precision
+   static BLAZE_ALWAYS_INLINE Type cvthi( SIMDMath<float>::Type a ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      return _mm512_cvtps_pd( _mm256_castpd_ps( _mm512_extractf64x4_pd( _mm512_castps_pd( a ), 1 ) ) );
+#elif BLAZE_AVX_MODE
+      return _mm256_cvtps_pd( _mm256_extractf128_ps( a, 1 ) );
+#else
+      return _mm_cvtps_pd( _mm_movehl_ps( a, a ) );
+#endif
+   }
+
+   // Converts two double precision vectors to a single precision vector
+   static BLAZE_ALWAYS_INLINE SIMDMath<float>::Type cvt( Type lo, Type hi ) noexcept
+   {
+#if BLAZE_AVX512F_MODE
+      const __m256d l( _mm256_castps_pd( _mm512_cvtpd_ps( lo ) ) );
+      const __m256d h( _mm256_castps_pd( _mm512_cvtpd_ps( hi ) ) );
+      return _mm512_castpd_ps( _mm512_insertf64x4( _mm512_castpd256_pd512( l ), h, 1 ) );
+#elif BLAZE_AVX_MODE
+      const __m128 l( _mm256_cvtpd_ps( lo ) );
+      const __m128 h( _mm256_cvtpd_ps( hi ) );
+      return _mm256_insertf128_ps( _mm256_castps128_ps256( l ), h, 1 );
+#else
+      return _mm_movelh_ps( _mm_cvtpd_ps( lo ), _mm_cvtpd_ps( hi ) );
+#endif
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
@@ -53,6 +53,24 @@ namespace blaze {
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Returns the sum of all elements in the 8-bit integral SIMD vector.
+// \ingroup simd
+//
+// \param a The vector to be sumed up.
+// \return The sum of all vector elements.
+*/
+BLAZE_ALWAYS_INLINE int8_t sum( const SIMDint8& a ) noexcept
+{
+   int8_t b( a[0UL] );
+   for( size_t i=1UL; i<SIMDint8::size; ++i ) {
+      b += a[i];
+   }
+   return b;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Returns the sum of all elements in the 8-bit integral complex SIMD vector.
 // \ingroup simd
@@ -62,7 +80,12 @@ namespace blaze {
 */
 BLAZE_ALWAYS_INLINE const complex<int8_t> sum( const SIMDcint8& a ) noexcept
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   return complex<int8_t>( a[ 0] + a[ 1] + a[ 2] + a[ 3] + a[ 4] + a[ 5] + a[ 6] + a[ 7] +
+                           a[ 8] + a[ 9] + a[10] + a[11] + a[12] + a[13] + a[14] + a[15] +
+                           a[16] + a[17] + a[18] + a[19] + a[20] + a[21] + a[22] + a[23] +
+                           a[24] + a[25] + a[26] + a[27] + a[28] + a[29] + a[30] + a[31] );
+#elif BLAZE_AVX2_MODE
    return complex<int8_t>( a[0] + a[1] + a[ 2] + a[ 3] + a[ 4] + a[ 5] + a[ 6] + a[ 7] +
                            a[8] + a[9] + a[10] + a[11] + a[12] + a[13] + a[14] + a[15] );
 #elif BLAZE_SSE2_MODE
@@ -91,7 +114,9 @@ BLAZE_ALWAYS_INLINE const complex<int8_t> sum( const SIMDcint8& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE int16_t sum( const SIMDint16& a ) noexcept
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   return _mm512_reduce_add_epi32( _mm512_madd_epi16( a.value, _mm512_set1_epi16( 1 ) ) );
+#elif BLAZE_AVX2_MODE
    const __m256i b( _mm256_hadd_epi16( a.value, a.value ) );
    const __m256i c( _mm256_hadd_epi16( b, b ) );
    const __m256i d( _mm256_hadd_epi16( c, c ) );
@@ -121,7 +146,10 @@ BLAZE_ALWAYS_INLINE int16_t sum( const SIMDint16& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE const complex<int16_t> sum( const SIMDcint16& a ) noexcept
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   return complex<int16_t>( a[0] + a[1] + a[ 2] + a[ 3] + a[ 4] + a[ 5] + a[ 6] + a[ 7] +
+                            a[8] + a[9] + a[10] + a[11] + a[12] + a[13] + a[14] + a[15] );
+#elif BLAZE_AVX2_MODE
    return complex<int16_t>( a[0] + a[1] + a[2] + a[3] + a[4] + a[5] + a[6] + a[7] );
 #elif BLAZE_SSE2_MODE
    return complex<int16_t>( a[0] + a[1] + a[2] + a[3] );
@@ -149,7 +177,7 @@ BLAZE_ALWAYS_INLINE const complex<int16_t> sum( const SIMDcint16& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE int32_t sum( const SIMDint32& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return _mm512_reduce_add_epi32( a.value );
 #elif BLAZE_AVX2_MODE
    const __m256i b( _mm256_hadd_epi32( a.value, a.value ) );
@@ -179,7 +207,7 @@ BLAZE_ALWAYS_INLINE int32_t sum( const SIMDint32& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE const complex<int32_t> sum( const SIMDcint32& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return complex<int32_t>( a[0] + a[1] + a[2] + a[3] + a[4] + a[5] + a[6] + a[7] );
 #elif BLAZE_AVX2_MODE
    return complex<int32_t>( a[0] + a[1] + a[2] + a[3] );
@@ -209,7 +237,7 @@ BLAZE_ALWAYS_INLINE const complex<int32_t> sum( const SIMDcint32& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE int64_t sum( const SIMDint64& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return _mm512_reduce_add_epi64( a.value );
 #elif BLAZE_AVX2_MODE
    return a[0] + a[1] + a[2] + a[3];
@@ -231,7 +259,7 @@ BLAZE_ALWAYS_INLINE int64_t sum( const SIMDint64& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE const complex<int64_t> sum( const SIMDcint64& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return complex<int64_t>( a[0] + a[1] + a[2] + a[3] );
 #elif BLAZE_AVX2_MODE
    return complex<int64_t>( a[0] + a[1] );
@@ -261,7 +289,7 @@ BLAZE_ALWAYS_INLINE const complex<int64_t> sum( const SIMDcint64& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE float sum( const SIMDfloat& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return _mm512_reduce_add_ps( a.value );
 #elif BLAZE_AVX_MODE
    const __m256 b( _mm256_hadd_ps( a.value, a.value ) );
@@ -290,7 +318,7 @@ BLAZE_ALWAYS_INLINE float sum( const SIMDfloat& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE const complex<float> sum( const SIMDcfloat& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return complex<float>( a[0] + a[1] + a[2] + a[3] + a[4] + a[5] + a[6] + a[7] );
 #elif BLAZE_AVX_MODE
    return complex<float>( a[0] + a[1] + a[2] + a[3] );
@@ -320,7 +348,7 @@ BLAZE_ALWAYS_INLINE const complex<float> sum( const SIMDcfloat& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE double sum( const SIMDdouble& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return _mm512_reduce_add_pd( a.value );
 #elif BLAZE_AVX_MODE
    const __m256d b( _mm256_hadd_pd( a.value, a.value ) );
@@ -347,7 +375,7 @@ BLAZE_ALWAYS_INLINE double sum( const SIMDdouble& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE const complex<double> sum( const SIMDcdouble& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return complex<double>( a[0] + a[1] + a[2] + a[3] );
 #elif BLAZE_AVX_MODE
    return complex<double>( a[0] + a[1] );
@@ -80,7 +80,9 @@ BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,1UL> > >
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   _mm512_store_si512( reinterpret_cast<__m512i*>( address ), (~value).value );
+#elif BLAZE_AVX2_MODE
    _mm256_store_si256( reinterpret_cast<__m256i*>( address ), (~value).value );
 #elif BLAZE_SSE2_MODE
    _mm_store_si128( reinterpret_cast<__m128i*>( address ), (~value).value );
@@ -111,7 +113,9 @@ BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,1UL> > >
    BLAZE_STATIC_ASSERT( sizeof( complex<T1> ) == 2UL*sizeof( T1 ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   _mm512_store_si512( reinterpret_cast<__m512i*>( address ), (~value).value );
+#elif BLAZE_AVX2_MODE
    _mm256_store_si256( reinterpret_cast<__m256i*>( address ), (~value).value );
 #elif BLAZE_SSE2_MODE
    _mm_store_si128( reinterpret_cast<__m128i*>( address ), (~value).value );
@@ -149,7 +153,9 @@ BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,2UL> > >
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   _mm512_store_si512( reinterpret_cast<__m512i*>( address ), (~value).value );
+#elif BLAZE_AVX2_MODE
    _mm256_store_si256( reinterpret_cast<__m256i*>( address ), (~value).value );
 #elif BLAZE_SSE2_MODE
    _mm_store_si128( reinterpret_cast<__m128i*>( address ), (~value).value );
@@ -180,7 +186,9 @@ BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,2UL> > >
    BLAZE_STATIC_ASSERT( sizeof( complex<T1> ) == 2UL*sizeof( T1 ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   _mm512_store_si512( reinterpret_cast<__m512i*>( address ), (~value).value );
+#elif BLAZE_AVX2_MODE
    _mm256_store_si256( reinterpret_cast<__m256i*>( address ), (~value).value );
 #elif BLAZE_SSE2_MODE
    _mm_store_si128( reinterpret_cast<__m128i*>( address ), (~value).value );
@@ -218,7 +226,7 @@ BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,4UL> > >
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    _mm512_store_epi32( address, (~value).value );
 #elif BLAZE_AVX2_MODE
    _mm256_store_si256( reinterpret_cast<__m256i*>( address ), (~value).value );
@@ -251,7 +259,7 @@ BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,4UL> > >
    BLAZE_STATIC_ASSERT( sizeof( complex<T1> ) == 2UL*sizeof( T1 ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    _mm512_store_epi32( address, (~value).value );
 #elif BLAZE_AVX2_MODE
    _mm256_store_si256( reinterpret_cast<__m256i*>( address ), (~value).value );
@@ -291,7 +299,7 @@ BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,8UL> > >
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    _mm512_store_epi64( address, (~value).value );
 #elif BLAZE_AVX2_MODE
    _mm256_store_si256( reinterpret_cast<__m256i*>( address ), (~value).value );
@@ -324,7 +332,7 @@ BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,8UL> > >
    BLAZE_STATIC_ASSERT( sizeof( complex<T1> ) == 2UL*sizeof( T1 ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    _mm512_store_epi64( address, (~value).value );
 #elif BLAZE_AVX2_MODE
    _mm256_store_si256( reinterpret_cast<__m256i*>( address ), (~value).value );
@@ -362,7 +370,7 @@ BLAZE_ALWAYS_INLINE void storea( float* address, const SIMDf32<T>& value ) noexc
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    _mm512_store_ps( address, (~value).eval().value );
 #elif BLAZE_AVX_MODE
    _mm256_store_ps( address, (~value).eval().value );
@@ -392,7 +400,7 @@ BLAZE_ALWAYS_INLINE void storea( complex<float>* address, const SIMDcfloat& valu
    BLAZE_STATIC_ASSERT  ( sizeof( complex<float> ) == 2UL*sizeof( float ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    _mm512_store_ps( reinterpret_cast<float*>( address ), value.value );
 #elif BLAZE_AVX_MODE
    _mm256_store_ps( reinterpret_cast<float*>( address ), value.value );
@@ -430,7 +438,7 @@ BLAZE_ALWAYS_INLINE void storea( double* address, const SIMDf64<T>& value ) noex
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    _mm512_store_pd( address, (~value).eval().value );
 #elif BLAZE_AVX_MODE
    _mm256_store_pd( address, (~value).eval().value );
@@ -460,7 +468,7 @@ BLAZE_ALWAYS_INLINE void storea( complex<double>* address, const SIMDcdouble& va
    BLAZE_STATIC_ASSERT  ( sizeof( complex<double> ) == 2UL*sizeof( double ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    _mm512_store_pd( reinterpret_cast<double*>( address ), value.value );
 #elif BLAZE_AVX_MODE
    _mm256_store_pd( reinterpret_cast<double*>( address ), value.value );
@@ -0,0 +1,756 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Transcendental.h
+//  \brief Header file for the native SIMD implementations of the transcendental functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_TRANSCENDENTAL_H_
+#define _BLAZE_MATH_SIMD_TRANSCENDENTAL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <blaze/math/simd/Primitives.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+#if BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || BLAZE_SSE2_MODE
+
+//=================================================================================================
+//
+//  CLASS SIMDMATHCONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constants and polynomial approximations of the native SIMD math kernels.
+// \ingroup simd
+//
+// All polynomial coefficients are the coefficients of Chebyshev interpolants of the respective
+// reduced functions, rounded to the target precision. The splits of the constants \f$ ln(2) \f$,
+// \f$ log_{10}(2) \f$, and \f$ \pi/2 \f$ into a high and a low part are chosen such that the
+// multiplication of the high part with the integral reduction factor is exact.
+*/
+template< typename T >  // Type of the vector elements
+struct SIMDMathConstants;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SIMDMathConstants class template for single precision values.
+// \ingroup simd
+*/
+template<>
+struct SIMDMathConstants<float>
+{
+   using M    = SIMDMath<float>;
+   using Type = M::Type;
+
+   static constexpr float log2e     = 1.442695022e+00F;
+   static constexpr float ln2Hi     = 6.931457520e-01F;   // 16 significant bits
+   static constexpr float ln2Lo     = 1.428606765e-06F;
+   static constexpr float log102Hi  = 3.010330200e-01F;   // 16 significant bits
+   static constexpr float log102Lo  = -3.024355465e-06F;
+   static constexpr float ivln10    = 4.342944920e-01F;
+   static constexpr float sqrt2     = 1.414213538e+00F;
+   static constexpr float expMax    = 88.72283172607422F;
+   static constexpr float expMin    = -103.97207641601562F;
+   static constexpr float minNormal = 1.17549435e-38F;
+   static constexpr float subScale  = 16777216.0F;        // 2^24
+   static constexpr float subExp    = 24.0F;
+   static constexpr float trigMax   = 8192.0F;
+   static constexpr float tanhMax   = 9.1F;
+   static constexpr float erfCenter = 0.5F;
+   static constexpr float erfMax    = 4.0F;
+   static constexpr float cbrt2     = 1.259921074e+00F;
+   static constexpr float cbrt4     = 1.587401032e+00F;
+
+   // (e^r-1-r)/r^2 on [-ln(2)/2,ln(2)/2]
+   static BLAZE_ALWAYS_INLINE Type expPoly( Type r ) noexcept {
+      return M::poly( r, 5.000000000e-01F, 1.666657776e-01F, 4.166655615e-02F, 8.363173343e-03F
+                       , 1.392617589e-03F );
+   }
+
+   // (2*atanh(s)-2s)/s^3 in z=s^2 on [0,(3-2*sqrt(2))^2]
+   static BLAZE_ALWAYS_INLINE Type logPoly( Type z ) noexcept {
+      return M::poly( z, 6.666668653e-01F, 3.998878002e-01F, 2.957994938e-01F );
+   }
+
+   // (sin(r)-r)/r^3 in z=r^2 on [0,(pi/4)^2]
+   static BLAZE_ALWAYS_INLINE Type sinPoly( Type z ) noexcept {
+      return M::poly( z, -1.666666716e-01F, 8.333331905e-03F, -1.984008704e-04F, 2.724992555e-06F );
+   }
+
+   // (cos(r)-1+r^2/2)/r^4 in z=r^2 on [0,(pi/4)^2]
+   static BLAZE_ALWAYS_INLINE Type cosPoly( Type z ) noexcept {
+      return M::poly( z, 4.166666418e-02F, -1.388830249e-03F, 2.454794230e-05F );
+   }
+
+   // erf(x)/x in z=x^2 on [0,1]
+   static BLAZE_ALWAYS_INLINE Type erfPoly( Type z ) noexcept {
+      return M::poly( z, 1.128379107e+00F, -3.761262596e-01F, 1.128359437e-01F, -2.685421146e-02F
+                       , 5.189087242e-03F, -8.016864303e-04F, 7.875874871e-05F );
+   }
+
+   // log(erfc(x)*e^(x^2)/t) in u=t-0.5 with t=1/(1+x/2) on x in [1,4]
+   static BLAZE_ALWAYS_INLINE Type erfcPoly( Type u ) noexcept {
+      return M::poly( u, -6.717939973e-01F, 1.345286250e+00F, 1.893250644e-01F, -3.750403821e-01F
+                       , -1.533245444e-01F, 2.703232765e-01F );
+   }
+
+   // cbrt(x) in u=x-1.5 on [1,2]
+   static BLAZE_ALWAYS_INLINE Type cbrtPoly( Type u ) noexcept {
+      return M::poly( u, 1.144791842e+00F, 2.543427348e-01F, -5.899331346e-02F, 2.214869857e-02F );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SIMDMathConstants class template for double precision values.
+// \ingroup simd
+*/
+template<>
+struct SIMDMathConstants<double>
+{
+   using M    = SIMDMath<double>;
+   using Type = M::Type;
+
+   static constexpr double log2e     = 1.4426950408889634;
+   static constexpr double ln2Hi     = 0.6931471805598903;      // 42 significant bits
+   static constexpr double ln2Lo     = 5.497923018708371e-14;
+   static constexpr double log102Hi  = 0.30102999566395283;     // 42 significant bits
+   static constexpr double log102Lo  = 2.8363394551044964e-14;
+   static constexpr double ivln10    = 0.4342944819032518;
+   static constexpr double sqrt2     = 1.4142135623730951;
+   static constexpr double expMax    = 709.782712893384;
+   static constexpr double expMin    = -745.1332191019412;
+   static constexpr double minNormal = 2.2250738585072014e-308;
+   static constexpr double subScale  = 18014398509481984.0;     // 2^54
+   static constexpr double subExp    = 54.0;
+   static constexpr double twoOverPi = 0.6366197723675814;
+   static constexpr double pio2Hi    = 1.5707963267341256;      // 33 significant bits
+   static constexpr double pio2Mid   = 6.077100506303966e-11;   // 33 significant bits
+   static constexpr double pio2Lo    = 2.0222662487959506e-21;
+   static constexpr double trigMax   = 1048576.0;
+   static constexpr double tanhMax   = 22.0;
+   static constexpr double erfCenter = 0.4375;
+   static constexpr double erfMax    = 6.0;
+   static constexpr double cbrt2     = 1.2599210498948732;
+   static constexpr double cbrt4     = 1.5874010519681996;
+   static constexpr double twoThrdHi = 0.6666666666666666;
+   static constexpr double twoThrdLo = 3.700743415417188e-17;
+
+   // (e^r-1-r)/r^2 on [-ln(2)/2,ln(2)/2]
+   static BLAZE_ALWAYS_INLINE Type expPoly( Type r ) noexcept {
+      return M::poly( r, 0.5000000000000001, 0.16666666666666669, 0.041666666666624164
+                       , 0.008333333333330065, 0.0013888888917196719, 0.00019841269863040545
+                       , 2.4801521322368692e-05, 2.7557268480310024e-06, 2.7620075879983367e-07
+                       , 2.5100375832561234e-08 );
+   }
+
+   // (2*atanh(s)-2s)/s^3 in z=s^2 on [0,(3-2*sqrt(2))^2]
+   static BLAZE_ALWAYS_INLINE Type logPoly( Type z ) noexcept {
+      return M::poly( z, 0.666666666666667, 0.39999999999899505, 0.28571428625975487
+                       , 0.2222221113479508, 0.18182889125261723, 0.15331721600556042
+                       , 0.14616449685043406 );
+   }
+
+   // (2*atanh(s)-2s-2s^3/3)/s^5 in z=s^2 (Taylor series up to s^25 for the power function)
+   static BLAZE_ALWAYS_INLINE Type powLogPoly( Type z ) noexcept {
+      return M::poly( z, 0.4, 0.2857142857142857, 0.2222222222222222, 0.18181818181818182
+                       , 0.15384615384615385, 0.13333333333333333, 0.11764705882352941
+                       , 0.10526315789473684, 0.09523809523809523, 0.08695652173913043, 0.08 );
+   }
+
+   // (sin(r)-r)/r^3 in z=r^2 on [0,(pi/4)^2]
+   static BLAZE_ALWAYS_INLINE Type sinPoly( Type z ) noexcept {
+      return M::poly( z, -0.16666666666666666, 0.008333333333330948, -0.00019841269836758574
+                       , 2.755731610255244e-06, -2.5051131845003624e-08, 1.5918129294866608e-10 );
+   }
+
+   // (cos(r)-1+r^2/2)/r^4 in z=r^2 on [0,(pi/4)^2]
+   static BLAZE_ALWAYS_INLINE Type cosPoly( Type z ) noexcept {
+      return M::poly( z, 0.041666666666666664, -0.0013888888888887398, 2.480158729876569e-05
+                       , -2.7557317271729793e-07, 2.08761462684032e-09, -1.1382632425521717e-11 );
+   }
+
+   // erf(x)/x in z=x^2 on [0,1]
+   static BLAZE_ALWAYS_INLINE Type erfPoly( Type z ) noexcept {
+      return M::poly( z, 1.1283791670955126, -0.37612638903183543, 0.11283791670945006
+                       , -0.02686617064323777, 0.0052239776071164225, -0.0008548325975389692
+                       , 0.00012055294904839707, -1.492473690741966e-05, 1.6447424703317362e-06
+                       , -1.6208483801871705e-07, 1.3720064546777686e-08, -7.795898827002142e-10 );
+   }
+
+   // log(erfc(x)*e^(x^2)/t) in u=t-0.4375 with t=1/(1+x/2) on x in [1,6]
+   static BLAZE_ALWAYS_INLINE Type erfcPoly( Type u ) noexcept {
+      return M::poly( u, -0.7550458267214988, 1.3173933695348243, 0.2553566054958727
+                       , -0.32534922141941286, -0.23713285061918796, 0.21674007587902852
+                       , 0.23263252647807348, -0.23221243508091288, -0.2321487013323355
+                       , 0.3162289222637232, 0.1994618683621389, -0.454125713972037
+                       , -0.08068412790646871, 0.5793461302363934, -0.12907400778549116
+                       , -0.4142604476067672 );
+   }
+
+   // cbrt(x) in u=x-1.5 on [1,2]
+   static BLAZE_ALWAYS_INLINE Type cbrtPoly( Type u ) noexcept {
+      return M::poly( u, 1.1447918716844296, 0.2543427306341776, -0.05899331361608753
+                       , 0.022148699208245193 );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SIMDTRANSCENDENTAL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native SIMD implementations of the transcendental functions.
+// \ingroup simd
+//
+// The SIMDTranscendental class template provides portable SIMD implementations of exp(), log(),
+// log10(), sin(), cos(), tan(), tanh(), erf(), pow(), cbrt(), and invsqrt() for single and
+// double precision values that are used in case the Intel SVML is not available. All functions
+// are based on an argument reduction, a polynomial approximation of the reduced function, and
+// a reconstruction step (Cody-Waite reduction by \f$ ln(2) \f$ and \f$ \pi/2 \f$, reduction of
+// the mantissa to \f$ [\sqrt{1/2},\sqrt{2}) \f$, ...) and handle infinities, NaNs, signed zeros,
+// and subnormal numbers in accordance with the corresponding functions of the C++ standard
+// library. The following table lists the maximum error in units in the last place (ULP) that
+// has been observed in comparison to the exact result:
+
+   <table border="0" cellspacing="0" cellpadding="1">
+   <tr><td width="100px"> <b>Function</b> </td>
+       <td width="150px"> <b>float</b>    </td>
+       <td width="150px"> <b>double</b>   </td>
+   </tr>
+   <tr><td> exp()     </td><td> 1.1 ULP </td><td> 1.1 ULP </td></tr>
+   <tr><td> log()     </td><td> 0.9 ULP </td><td> 0.9 ULP </td></tr>
+   <tr><td> log10()   </td><td> 2.1 ULP </td><td> 2.0 ULP </td></tr>
+   <tr><td> sin()     </td><td> 1.6 ULP </td><td> 1.6 ULP </td></tr>
+   <tr><td> cos()     </td><td> 1.6 ULP </td><td> 1.6 ULP </td></tr>
+   <tr><td> tan()     </td><td> 3.7 ULP </td><td> 3.7 ULP </td></tr>
+   <tr><td> tanh()    </td><td> 2.6 ULP </td><td> 2.7 ULP </td></tr>
+   <tr><td> erf()     </td><td> 2.7 ULP </td><td> 2.1 ULP </td></tr>
+   <tr><td> pow()     </td><td> 0.5 ULP </td><td> 1.4 ULP </td></tr>
+   <tr><td> cbrt()    </td><td> 1.0 ULP </td><td> 1.0 ULP </td></tr>
+   <tr><td> invsqrt() </td><td> 1.5 ULP </td><td> 1.5 ULP </td></tr>
+   </table>
+
+// The trigonometric functions are vectorized for arguments with an absolute value of up to
+// \f$ 2^{13} \f$ (float) and \f$ 2^{20} \f$ (double), respectively. Larger arguments are reduced
+// by the scalar functions of the C++ standard library.
+*/
+template< typename T >  // Type of the vector elements
+struct SIMDTranscendental
+{
+   //**Type definitions****************************************************************************
+   using M    = SIMDMath<T>;
+   using C    = SIMDMathConstants<T>;
+   using Type = typename M::Type;
+   using Mask = typename M::Mask;
+   using Limits = std::numeric_limits<T>;
+   //**********************************************************************************************
+
+   //**Exponential functions***********************************************************************
+   /*!\brief Computes \f$ e^x \f$.
+   */
+   static BLAZE_ALWAYS_INLINE Type exp( Type x ) noexcept
+   {
+      const Type n( M::round( M::mul( x, M::set( C::log2e ) ) ) );
+      const Type r( M::fnmadd( n, M::set( C::ln2Lo ), M::fnmadd( n, M::set( C::ln2Hi ), x ) ) );
+      return expReconstruct( x, n, r );
+   }
+
+   /*!\brief Computes \f$ \frac{e^x-1}{e^x+1} \f$.
+   */
+   static BLAZE_ALWAYS_INLINE Type tanh( Type x ) noexcept
+   {
+      const Type a( M::abs( x ) );
+      const Type y( M::add( a, a ) );
+      const Type n( M::round( M::mul( y, M::set( C::log2e ) ) ) );
+      const Type r( M::fnmadd( n, M::set( C::ln2Lo ), M::fnmadd( n, M::set( C::ln2Hi ), y ) ) );
+
+      // e^y-1 = 2^n*(e^r-1) + (2^n-1)
+      const Type p( M::fmadd( M::mul( r, r ), C::expPoly( r ), r ) );
+      const Type s( M::pow2( n ) );
+      const Type u( M::fmadd( p, s, M::sub( s, M::set( T(1) ) ) ) );
+
+      Type res( M::div( u, M::add( u, M::set( T(2) ) ) ) );
+      res = M::select( M::cmpgt( a, M::set( C::tanhMax ) ), M::set( T(1) ), res );
+      return M::bitOr( res, M::signbit( x ) );
+   }
+
+   /*!\brief Computes \f$ x^y \f$.
+   */
+   static BLAZE_ALWAYS_INLINE Type pow( Type x, Type y ) noexcept;
+   //**********************************************************************************************
+
+   //**Logarithmic functions***********************************************************************
+   /*!\brief Computes \f$ ln(x) \f$.
+   */
+   static BLAZE_ALWAYS_INLINE Type log( Type x ) noexcept
+   {
+      Type e, m;
+      logReduce( x, e, m );
+
+      const Type f( M::sub( m, M::set( T(1) ) ) );
+      const Type s( M::div( f, M::add( M::set( T(2) ), f ) ) );
+      const Type z( M::mul( s, s ) );
+      const Type R( M::mul( z, C::logPoly( z ) ) );
+      const Type hfsq( M::mul( M::set( T(0.5) ), M::mul( f, f ) ) );
+
+      // e*ln2 + f - hfsq + s*(hfsq+R)
+      const Type t( M::fmadd( e, M::set( C::ln2Lo ), M::mul( s, M::add( hfsq, R ) ) ) );
+      const Type res( M::fmadd( e, M::set( C::ln2Hi ), M::sub( f, M::sub( hfsq, t ) ) ) );
+
+      return logSpecial( x, res );
+   }
+
+   /*!\brief Computes \f$ log_{10}(x) \f$.
+   */
+   static BLAZE_ALWAYS_INLINE Type log10( Type x ) noexcept
+   {
+      Type e, m;
+      logReduce( x, e, m );
+
+      const Type f( M::sub( m, M::set( T(1) ) ) );
+      const Type s( M::div( f, M::add( M::set( T(2) ), f ) ) );
+      const Type z( M::mul( s, s ) );
+      const Type R( M::mul( z, C::logPoly( z ) ) );
+      const Type hfsq( M::mul( M::set( T(0.5) ), M::mul( f, f ) ) );
+      const Type lm( M::sub( f, M::fnmadd( s, M::add( hfsq, R ), hfsq ) ) );
+
+      // e*log10(2) + ln(m)/ln(10)
+      const Type t( M::fmadd( lm, M::set( C::ivln10 ), M::mul( e, M::set( C::log102Lo ) ) ) );
+      const Type res( M::fmadd( e, M::set( C::log102Hi ), t ) );
+
+      return logSpecial( x, res );
+   }
+   //**********************************************************************************************
+
+   //**Trigonometric functions*********************************************************************
+   /*!\brief Computes \f$ sin(x) \f$.
+   */
+   static BLAZE_ALWAYS_INLINE Type sin( Type x ) noexcept
+   {
+      const Type a( M::abs( x ) );
+      Type q, s, c;
+      sincos( a, q, s, c );
+
+      const Type res( quadrant( q, s, c ) );
+      return largeArgs( x, M::bitXor( res, M::signbit( x ) ), []( T v ){ return std::sin( v ); } );
+   }
+
+   /*!\brief Computes \f$ cos(x) \f$.
+   */
+   static BLAZE_ALWAYS_INLINE Type cos( Type x ) noexcept
+   {
+      const Type a( M::abs( x ) );
+      Type q, s, c;
+      sincos( a, q, s, c );
+
+      const Type res( quadrant( M::add( q, M::set( T(1) ) ), s, c ) );
+      return largeArgs( x, res, []( T v ){ return std::cos( v ); } );
+   }
+
+   /*!\brief Computes \f$ tan(x) \f$.
+   */
+   static BLAZE_ALWAYS_INLINE Type tan( Type x ) noexcept
+   {
+      const Type a( M::abs( x ) );
+      Type q, s, c;
+      sincos( a, q, s, c );
+
+      // tan(x) = -cos(r)/sin(r) in case of an odd quadrant
+      const Type h( M::round( M::fnmadd( q, M::set( T(-0.5) ), M::set( T(-0.25) ) ) ) );
+      const Mask odd( M::cmpeq( M::fnmadd( h, M::set( T(2) ), q ), M::set( T(1) ) ) );
+      const Type t( M::div( M::select( odd, c, s ), M::select( odd, s, c ) ) );
+      const Type res( M::bitXor( t, M::select( odd, M::set( T(-0.0) ), M::set( T(0) ) ) ) );
+
+      return largeArgs( x, M::bitXor( res, M::signbit( x ) ), []( T v ){ return std::tan( v ); } );
+   }
+   //**********************************************************************************************
+
+   //**Error function******************************************************************************
+   /*!\brief Computes \f$ erf(x) \f$.
+   */
+   static BLAZE_ALWAYS_INLINE Type erf( Type x ) noexcept
+   {
+      const Type a( M::abs( x ) );
+      const Mask small( M::cmple( a, M::set( T(1) ) ) );
+
+      Type res( M::set( T(1) ) );
+
+      if( !M::all( small ) ) {
+         // erf(x) = 1 - t*e^(-x^2+P(t)) with t=1/(1+x/2)
+         const Type t( M::div( M::set( T(2) ), M::add( M::set( T(2) ), a ) ) );
+         const Type p( C::erfcPoly( M::sub( t, M::set( C::erfCenter ) ) ) );
+         const Type e( exp( M::fnmadd( a, a, p ) ) );
+         res = M::fnmadd( t, e, M::set( T(1) ) );
+         res = M::select( M::cmpge( a, M::set( C::erfMax ) ), M::set( T(1) ), res );
+      }
+
+      if( M::any( small ) ) {
+         const Type p( M::mul( a, C::erfPoly( M::mul( a, a ) ) ) );
+         res = M::all( small ) ? p : M::select( small, p, res );
+      }
+
+      return M::bitOr( res, M::signbit( x ) );
+   }
+   //**********************************************************************************************
+
+   //**Root functions******************************************************************************
+   /*!\brief Computes \f$ \sqrt[3]{x} \f$.
+   */
+   static BLAZE_ALWAYS_INLINE Type cbrt( Type x ) noexcept
+   {
+      const Type a( M::abs( x ) );
+      const Mask sub( M::cmplt( a, M::set( C::minNormal ) ) );
+      const Type as( M::select( sub, M::mul( a, M::set( C::subScale ) ), a ) );
+      const Type e( M::exponent( as ) );
+      const Type m( M::mantissa( as ) );
+
+      // e = 3k+i with i in {0,1,2}
+      const Type k( M::round( M::mul( M::sub( e, M::set( T(1) ) ), M::set( T(1)/T(3) ) ) ) );
+      const Type i( M::fnmadd( k, M::set( T(3) ), e ) );
+      const Mask i1( M::cmpeq( i, M::set( T(1) ) ) );
+      const Mask i2( M::cmpeq( i, M::set( T(2) ) ) );
+
+      // cbrt(w) for w=m*2^i in [1,8)
+      const Type w( M::mul( m, M::select( i1, M::set( T(2) ), M::select( i2, M::set( T(4) ), M::set( T(1) ) ) ) ) );
+      Type y( M::mul( C::cbrtPoly( M::sub( m, M::set( T(1.5) ) ) )
+                    , M::select( i1, M::set( C::cbrt2 ), M::select( i2, M::set( C::cbrt4 ), M::set( T(1) ) ) ) ) );
+
+      // Halley iteration: y = y*(y^3+2w)/(2y^3+w)
+      Type y3( M::mul( M::mul( y, y ), y ) );
+      y = M::mul( y, M::div( M::fmadd( M::set( T(2) ), w, y3 ), M::fmadd( M::set( T(2) ), y3, w ) ) );
+
+      // Newton iteration: y = y-(y^3-w)/(3y^2)
+      y3 = M::mul( M::mul( y, y ), y );
+      y = M::sub( y, M::div( M::sub( y3, w ), M::mul( M::set( T(3) ), M::mul( y, y ) ) ) );
+
+      const Type scale( M::sub( k, M::select( sub, M::set( C::subExp/T(3) ), M::set( T(0) ) ) ) );
+      Type res( M::mul( y, M::pow2( scale ) ) );
+
+      const Mask special( M::mor( M::cmpeq( a, M::set( T(0) ) )
+                                , M::mor( M::cmpeq( a, M::set( Limits::infinity() ) ), M::isNan( a ) ) ) );
+      res = M::select( special, a, res );
+
+      return M::bitOr( res, M::signbit( x ) );
+   }
+
+   /*!\brief Computes \f$ \frac{1}{\sqrt{x}} \f$.
+   */
+   static BLAZE_ALWAYS_INLINE Type invsqrt( Type x ) noexcept
+   {
+      return M::div( M::set( T(1) ), M::sqrt( x ) );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\brief Reconstruction of \f$ e^x=2^n e^r \f$ including the overflow and underflow handling.
+   */
+   static BLAZE_ALWAYS_INLINE Type expReconstruct( Type x, Type n, Type r ) noexcept
+   {
+      const Type p( M::add( M::set( T(1) ), M::fmadd( M::mul( r, r ), C::expPoly( r ), r ) ) );
+
+      Type res( M::ldexp( p, n ) );
+      res = M::select( M::cmpgt( x, M::set( C::expMax ) ), M::set( Limits::infinity() ), res );
+      res = M::select( M::cmplt( x, M::set( C::expMin ) ), M::set( T(0) ), res );
+      return res;
+   }
+
+   /*!\brief Reduction of a positive x to \f$ x=2^e m \f$ with \f$ m \in [\sqrt{1/2},\sqrt{2}) \f$.
+   */
+   static BLAZE_ALWAYS_INLINE void logReduce( Type x, Type& e, Type& m ) noexcept
+   {
+      const Mask sub( M::cmplt( x, M::set( C::minNormal ) ) );
+      const Type xs( M::select( sub, M::mul( x, M::set( C::subScale ) ), x ) );
+
+      e = M::sub( M::exponent( xs ), M::select( sub, M::set( C::subExp ), M::set( T(0) ) ) );
+      m = M::mantissa( xs );
+
+      const Mask big( M::cmpgt( m, M::set( C::sqrt2 ) ) );
+      m = M::select( big, M::mul( m, M::set( T(0.5) ) ), m );
+      e = M::select( big, M::add( e, M::set( T(1) ) ), e );
+   }
+
+   /*!\brief Handling of zero, negative, infinite, and NaN arguments of the logarithm functions.
+   */
+   static BLAZE_ALWAYS_INLINE Type logSpecial( Type x, Type res ) noexcept
+   {
+      res = M::select( M::cmpeq( x, M::set( T(0) ) ), M::set( -Limits::infinity() ), res );
+      res = M::select( M::cmplt( x, M::set( T(0) ) ), M::set( Limits::quiet_NaN() ), res );
+      res = M::select( M::cmpeq( x, M::set( Limits::infinity() ) ), x, res );
+      return M::select( M::isNan( x ), x, res );
+   }
+
+   /*!\brief Reduction of a non-negative a to \f$ r=a-q\pi/2 \f$.
+   */
+   static BLAZE_ALWAYS_INLINE void reduce( Type a, Type& q, Type& r ) noexcept
+   {
+      q = M::round( M::mul( a, M::set( C::twoOverPi ) ) );
+
+      // Three-part Cody-Waite reduction with compensation of the rounding error of a-q*pio2Mid
+      const Type r1( M::fnmadd( q, M::set( C::pio2Hi ), a ) );
+      const Type w1( M::mul( q, M::set( C::pio2Mid ) ) );
+      const Type r2( M::sub( r1, w1 ) );
+      const Type w2( M::fmadd( q, M::set( C::pio2Lo ), M::sub( w1, M::sub( r1, r2 ) ) ) );
+      r = M::sub( r2, w2 );
+   }
+
+   /*!\brief Reduction of a non-negative a to \f$ r=a-q\pi/2 \f$ and evaluation of sin(r) and cos(r).
+   */
+   static BLAZE_ALWAYS_INLINE void sincos( Type a, Type& q, Type& s, Type& c ) noexcept
+   {
+      Type r;
+      reduce( a, q, r );
+      const Type z( M::mul( r, r ) );
+
+      s = M::fmadd( M::mul( r, z ), C::sinPoly( z ), r );
+      c = M::fmadd( M::mul( z, z ), C::cosPoly( z ), M::fnmadd( M::set( T(0.5) ), z, M::set( T(1) ) ) );
+   }
+
+   /*!\brief Selection of \f$ \pm sin(r) \f$ or \f$ \pm cos(r) \f$ depending on the quadrant q.
+   */
+   static BLAZE_ALWAYS_INLINE Type quadrant( Type q, Type s, Type c ) noexcept
+   {
+      // q mod 4
+      const Type h( M::round( M::fnmadd( q, M::set( T(-0.25) ), M::set( T(-0.375) ) ) ) );
+      const Type j( M::fnmadd( h, M::set( T(4) ), q ) );
+
+      const Mask swap( M::mor( M::cmpeq( j, M::set( T(1) ) ), M::cmpeq( j, M::set( T(3) ) ) ) );
+      const Mask neg ( M::cmpge( j, M::set( T(2) ) ) );
+
+      const Type res( M::select( swap, c, s ) );
+      return M::bitXor( res, M::select( neg, M::set( T(-0.0) ), M::set( T(0) ) ) );
+   }
+
+   /*!\brief Recomputation of all elements with arguments beyond the range of the SIMD reduction.
+   */
+   template< typename F >  // Type of the scalar fallback function
+   static BLAZE_ALWAYS_INLINE Type largeArgs( Type x, Type res, F f )
+   {
+      if( !M::any( M::cmpgt( M::abs( x ), M::set( C::trigMax ) ) ) )
+         return res;
+
+      T xs[M::size], rs[M::size];
+      M::storeu( xs, x );
+      M::storeu( rs, res );
+
+      for( size_t i=0UL; i<M::size; ++i ) {
+         if( std::abs( xs[i] ) > C::trigMax )
+            rs[i] = f( xs[i] );
+      }
+
+      return M::loadu( rs );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction of a non-negative single precision a to \f$ r=a-q\pi/2 \f$.
+//
+// In order to avoid the cancellation in case of arguments close to a multiple of \f$ \pi/2 \f$
+// the single precision argument reduction is performed in double precision.
+*/
+template<>
+BLAZE_ALWAYS_INLINE void SIMDTranscendental<float>::reduce( Type a, Type& q, Type& r ) noexcept
+{
+   using MD = SIMDMath<double>;
+   using CD = SIMDMathConstants<double>;
+
+   const auto reduceHalf = []( MD::Type x, MD::Type& qd ) {
+      qd = MD::round( MD::mul( x, MD::set( CD::twoOverPi ) ) );
+      const MD::Type r1( MD::fnmadd( qd, MD::set( CD::pio2Hi ), x ) );
+      const MD::Type r2( MD::fnmadd( qd, MD::set( CD::pio2Mid ), r1 ) );
+      return MD::fnmadd( qd, MD::set( CD::pio2Lo ), r2 );
+   };
+
+   MD::Type qlo, qhi;
+   const MD::Type rlo( reduceHalf( MD::cvtlo( a ), qlo ) );
+   const MD::Type rhi( reduceHalf( MD::cvthi( a ), qhi ) );
+
+   q = MD::cvt( qlo, qhi );
+   r = MD::cvt( rlo, rhi );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ x^y \f$ for double precision values.
+//
+// The logarithm of \f$ |x| \f$ is computed in double-word arithmetic such that the rounding
+// error of \f$ y \cdot ln|x| \f$ does not get amplified by the subsequent exponentiation. For
+// this purpose all terms of \f$ 2\,atanh(s) = 2s + \frac{2}{3}s^3 + s^5 P(s^2) \f$ are evaluated
+// and accumulated in double-word arithmetic.
+*/
+template<>
+BLAZE_ALWAYS_INLINE SIMDTranscendental<double>::Type
+   SIMDTranscendental<double>::pow( Type x, Type y ) noexcept
+{
+   const Type ax( M::abs( x ) );
+
+   Type e, m;
+   logReduce( ax, e, m );
+
+   // s = f/(2+f) = sh+sl
+   const Type f( M::sub( m, M::set( 1.0 ) ) );
+   Type dh, dl, p, pe;
+   M::twoSum( m, M::set( 1.0 ), dh, dl );
+   const Type sh( M::div( f, dh ) );
+   M::twoProd( sh, dh, p, pe );
+   const Type sl( M::div( M::fnmadd( sh, dl, M::sub( M::sub( f, p ), pe ) ), dh ) );
+
+   // 2s^3/3 = ch+cl
+   Type zh, zl, qh, ql, ch, cl;
+   M::twoProd( sh, sh, zh, zl );
+   M::twoProd( zh, sh, qh, ql );
+   ql = M::fmadd( zl, sh, M::fmadd( M::set( 3.0 ), M::mul( zh, sl ), ql ) );
+   M::twoProd( qh, M::set( C::twoThrdHi ), ch, cl );
+   cl = M::fmadd( qh, M::set( C::twoThrdLo ), M::fmadd( ql, M::set( C::twoThrdHi ), cl ) );
+
+   // s^5*P(s^2) = rh+rl
+   Type fh, fl, rh, rl;
+   M::twoProd( qh, zh, fh, fl );
+   fl = M::fmadd( qh, zl, M::fmadd( ql, zh, fl ) );
+   const Type P( C::powLogPoly( zh ) );
+   M::twoProd( fh, P, rh, rl );
+   rl = M::fmadd( fl, P, rl );
+
+   // ln|x| = e*ln2 + 2s + 2s^3/3 + s^5*P(s^2) = h+l
+   Type ah, al, bh, bl, gh, gl;
+   M::twoSum( M::mul( e, M::set( C::ln2Hi ) ), M::add( sh, sh ), ah, al );
+   M::twoSum( ah, ch, bh, bl );
+   M::twoSum( bh, rh, gh, gl );
+   const Type ll( M::add( M::add( M::add( al, bl ), M::add( gl, M::add( cl, rl ) ) )
+                        , M::fmadd( e, M::set( C::ln2Lo ), M::add( sl, sl ) ) ) );
+   const Type h( M::add( gh, ll ) );
+   const Type l( M::sub( ll, M::sub( h, gh ) ) );
+
+   // y*ln|x| = th+tl
+   Type ph, pl;
+   M::twoProd( y, h, ph, pl );
+   pl = M::fmadd( y, l, pl );
+   const Type th( M::add( ph, pl ) );
+   const Type tl( M::sub( pl, M::sub( th, ph ) ) );
+
+   const Type n( M::round( M::mul( th, M::set( C::log2e ) ) ) );
+   const Type r( M::fnmadd( n, M::set( C::ln2Lo ), M::fnmadd( n, M::set( C::ln2Hi ), th ) ) );
+   Type res( expReconstruct( ph, n, M::add( r, tl ) ) );
+
+   // Special cases according to the C++ standard library
+   const Type zero( M::set( 0.0 ) );
+   const Type one ( M::set( 1.0 ) );
+   const Type inf ( M::set( Limits::infinity() ) );
+
+   const Type ry( M::round( y ) );
+   const Type hy( M::mul( y, M::set( 0.5 ) ) );
+   const Mask yint( M::cmpeq( ry, y ) );
+   const Mask yodd( M::mandnot( M::cmpeq( M::round( hy ), hy ), yint ) );
+   const Mask yneg( M::cmplt( y, zero ) );
+   const Mask ypos( M::cmpgt( y, zero ) );
+
+   res = M::select( M::cmpeq( ax, zero ), M::select( yneg, inf, zero ), res );
+   res = M::select( M::cmpeq( ax, inf ), M::select( yneg, zero, inf ), res );
+   res = M::select( M::cmpeq( ax, one ), one, res );
+
+   const Mask big( M::mor( M::mand( M::cmplt( ax, one ), yneg ), M::mand( M::cmpgt( ax, one ), ypos ) ) );
+   const Type yinf( M::select( M::cmpeq( ax, one ), one, M::select( big, inf, zero ) ) );
+   res = M::select( M::cmpeq( M::abs( y ), inf ), yinf, res );
+
+   res = M::select( yodd, M::bitXor( res, M::signbit( x ) ), res );
+
+   const Mask nonint( M::mandnot( yint, M::mandnot( M::cmpeq( ax, inf ), M::cmplt( x, zero ) ) ) );
+   res = M::select( nonint, M::set( Limits::quiet_NaN() ), res );
+   res = M::select( M::mor( M::isNan( x ), M::isNan( y ) ), M::add( x, y ), res );
+   res = M::select( M::mor( M::cmpeq( y, zero ), M::cmpeq( x, one ) ), one, res );
+
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ x^y \f$ for single precision values.
+//
+// The single precision power function is evaluated in double precision, which results in a
+// correctly rounded result in almost all cases.
+*/
+template<>
+BLAZE_ALWAYS_INLINE SIMDTranscendental<float>::Type
+   SIMDTranscendental<float>::pow( Type x, Type y ) noexcept
+{
+   using MD = SIMDMath<double>;
+
+   const MD::Type lo( SIMDTranscendental<double>::pow( MD::cvtlo( x ), MD::cvtlo( y ) ) );
+   const MD::Type hi( SIMDTranscendental<double>::pow( MD::cvthi( x ), MD::cvthi( y ) ) );
+
+   return MD::cvt( lo, hi );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
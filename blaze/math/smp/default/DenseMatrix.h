@@ -40,7 +40,10 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatReduceExpr.h>
 #include <blaze/math/expressions/Matrix.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/system/SMP.h>
@@ -48,6 +51,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -72,6 +76,12 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 template< typename MT1, bool SO1, typename MT2, bool SO2 >
 inline EnableIf_< IsDenseMatrix<MT1> >
    smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+template< typename MT, bool SO, typename OP >
+inline ElementType_<MT> smpReduce( const DenseMatrix<MT,SO>& dm, OP op );
+
+template< typename MT, bool SO, typename ET >
+inline void smpFill( DenseMatrix<MT,SO>& lhs, const ET& value );
 //@}
 //*************************************************************************************************
 
@@ -169,6 +179,62 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default SMP reduction of a dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline ElementType_<MT> smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dmatreduce( ~dm, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP initialization of a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target dense matrix.
+// \param value The value to be assigned to all elements.
+// \return void
+//
+// This function implements the default SMP initialization of all elements of a dense matrix
+// with the given value.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename ET >  // Type of the initialization value
+inline void smpFill( DenseMatrix<MT,SO>& lhs, const ET& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t N( SO ? (~lhs).columns() : (~lhs).rows() );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      std::fill( (~lhs).begin(i), (~lhs).end(i), value );
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -40,7 +40,10 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
 #include <blaze/math/expressions/Vector.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/system/SMP.h>
@@ -80,6 +83,12 @@ inline EnableIf_< IsDenseVector<VT1> >
 template< typename VT1, bool TF1, typename VT2, bool TF2 >
 inline EnableIf_< IsDenseVector<VT1> >
    smpDivAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+
+template< typename VT, bool TF, typename OP >
+inline ElementType_<VT> smpReduce( const DenseVector<VT,TF>& dv, OP op );
+
+template< typename VT, bool TF, typename ET >
+inline void smpFill( DenseVector<VT,TF>& lhs, const ET& value );
 //@}
 //*************************************************************************************************
 
@@ -229,6 +238,58 @@ inline EnableIf_< IsDenseVector<VT1> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default SMP reduction of a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline ElementType_<VT> smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dvecreduce( ~dv, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The target dense vector.
+// \param value The value to be assigned to all elements.
+// \return void
+//
+// This function implements the default SMP initialization of all elements of a dense vector
+// with the given value.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense vectors. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename ET >  // Type of the initialization value
+inline void smpFill( DenseVector<VT,TF>& lhs, const ET& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   std::fill( (~lhs).begin(), (~lhs).end(), value );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,162 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/Batch.h
+//  \brief Header file for the OpenMP-based small matrix batch SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_BATCH_H_
+#define _BLAZE_MATH_SMP_OPENMP_BATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BATCH EVALUATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP evaluation of a batch operation.
+// \ingroup smp
+//
+// \param batch The batch determining the number of chunks to be processed.
+// \param op The batch operation to be applied to a range of chunks.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP evaluation of a batch
+// operation. The chunks of the batch are evenly distributed among the OpenMP threads.\n
+// This function must \b NOT be called explicitly! It is used internally for the evaluation of
+// the batched small matrix kernels. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename BT    // Type of the batch
+        , typename OP >  // Type of the batch operation
+void smpBatch_backend( const BT& batch, const OP& op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const size_t chunks( batch.chunks() );
+   const int    threads( omp_get_num_threads() );
+   const size_t addon( ( ( chunks % threads ) != 0UL )? 1UL : 0UL );
+   const size_t chunksPerThread( chunks / threads + addon );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0; i<threads; ++i )
+   {
+      const size_t begin( i*chunksPerThread );
+
+      if( begin >= chunks )
+         continue;
+
+      op( begin, min( begin + chunksPerThread, chunks ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP evaluation of a batch operation.
+// \ingroup smp
+//
+// \param batch The batch determining the number of chunks to be processed.
+// \param op The batch operation to be applied to a range of chunks.
+// \return void
+//
+// This function performs the OpenMP-based SMP evaluation of a batch operation. Batches with
+// less matrices than the blaze::SMP_BATCH_THRESHOLD as well as operations within a serial
+// section or within an active parallel section are performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the evaluation of
+// the batched small matrix kernels. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename BT    // Type of the batch
+        , typename OP >  // Type of the batch operation
+inline void smpBatch( const BT& batch, const OP& op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( isSerialSectionActive() || isParallelSectionActive() || !batch.canSMPAssign() ) {
+      op( 0UL, batch.chunks() );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel shared( batch, op )
+      smpBatch_backend( batch, op );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_OPENMP_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,11 +40,14 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <vector>
 #include <omp.h>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatReduceExpr.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/simd/SIMDTrait.h>
@@ -58,6 +61,7 @@
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/views/Submatrix.h>
 #include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
@@ -819,6 +823,325 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \param results The storage for the partial results of the single threads.
+// \param redux The result of the reduction operation.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP reduction of
+// a dense matrix. The rows (in case of a row-major matrix) or columns (in case of a column-major
+// matrix) are split into one block per thread, the blocks are reduced concurrently, and the
+// partial results are combined in order.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+void smpReduce_backend( const DenseMatrix<MT,SO>& dm, OP op,
+                        std::vector< ElementType_<MT> >& results, ElementType_<MT>& redux )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef ElementType_<MT>  ET;
+
+   const size_t N( SO ? (~dm).columns() : (~dm).rows() );
+
+   const int    threads      ( omp_get_num_threads() );
+   const size_t addon        ( ( ( N % threads ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerThread( N / threads + addon );
+   const size_t parts        ( ( N + sizePerThread - 1UL ) / sizePerThread );
+
+   BLAZE_INTERNAL_ASSERT( parts <= results.size(), "Invalid number of partial results" );
+
+#pragma omp for schedule(dynamic,1)
+   for( int i=0; i<int( parts ); ++i )
+   {
+      const size_t index( i*sizePerThread );
+      const size_t size ( min( sizePerThread, N - index ) );
+      if( SO )
+         results[i] = dmatreduce( submatrix<unaligned>( ~dm, 0UL, index, (~dm).rows(), size ), op );
+      else
+         results[i] = dmatreduce( submatrix<unaligned>( ~dm, index, 0UL, size, (~dm).columns() ), op );
+   }
+
+   // The implicit barrier at the end of the loop guarantees that all partial results are
+   // available before they are combined.
+#pragma omp single
+   {
+      ET tmp( results[0UL] );
+      for( size_t i=1UL; i<parts; ++i ) {
+         tmp = op( tmp, results[i] );
+      }
+      redux = tmp;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default OpenMP-based SMP reduction of a dense matrix. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the dense matrix is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< Not< IsSMPAssignable<MT> >, ElementType_<MT> >
+   smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dmatreduce( ~dm, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function performs the OpenMP-based SMP reduction of a dense matrix. Due to the explicit
+// application of the SFINAE principle, this function can only be selected by the compiler in
+// case the dense matrix is SMP-assignable. Matrices with less elements than the
+// blaze::SMP_DMATREDUCE_THRESHOLD as well as reductions within a serial
+// section or within an active parallel section are performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< IsSMPAssignable<MT>, ElementType_<MT> >
+   smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef ElementType_<MT>    ET;
+   typedef CompositeType_<MT>  CT;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ET );
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       (~dm).rows() * (~dm).columns() < SMP_DMATREDUCE_THRESHOLD ) {
+      return dmatreduce( ~dm, op );
+   }
+
+   CT tmp( ~dm );
+   std::vector<ET> results( omp_get_max_threads() );
+   ET redux{};
+
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel shared( tmp, op, results, redux )
+      smpReduce_backend( tmp, op, results, redux );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP initialization of a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target dense matrix.
+// \param value The value to be assigned to all elements.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP initialization of a dense
+// matrix. The matrix is split into the same blocks as in case of an SMP assignment, and every
+// block is initialized by one of the OpenMP threads. Due to the first-touch policy of the
+// operating system, the memory pages of each block are thus placed on the NUMA node of the
+// initializing thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename ET >  // Type of the initialization value
+void smpFill_backend( DenseMatrix<MT,SO>& lhs, const ET& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef SubmatrixExprTrait_<MT,unaligned>  Target;
+
+   enum : size_t { SIMDSIZE = SIMDTrait< ElementType_<MT> >::size };
+
+   const bool simdEnabled( MT::simdEnabled );
+
+   const int threads( omp_get_num_threads() );
+   const ThreadMapping threadmap( createThreadMapping( threads, ~lhs ) );
+
+   const size_t addon1     ( ( ( (~lhs).rows() % threadmap.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1( (~lhs).rows() / threadmap.first + addon1 );
+   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
+   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+
+   const size_t addon2     ( ( ( (~lhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( (~lhs).columns() / threadmap.second + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0; i<threads; ++i )
+   {
+      const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
+      const size_t column( ( i % threadmap.second ) * colsPerThread );
+
+      if( row >= (~lhs).rows() || column >= (~lhs).columns() )
+         continue;
+
+      const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
+      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+
+      Target target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+
+      for( size_t k=0UL; k<( SO ? n : m ); ++k ) {
+         std::fill( target.begin(k), target.end(k), value );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP initialization of a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target dense matrix.
+// \param value The value to be assigned to all elements.
+// \return void
+//
+// This function implements the default OpenMP-based SMP initialization of a dense matrix. Due
+// to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case the dense matrix is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename ET >  // Type of the initialization value
+inline EnableIf_< Not< IsSMPAssignable<MT> > >
+   smpFill( DenseMatrix<MT,SO>& lhs, const ET& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t N( SO ? (~lhs).columns() : (~lhs).rows() );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      std::fill( (~lhs).begin(i), (~lhs).end(i), value );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP initialization of a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target dense matrix.
+// \param value The value to be assigned to all elements.
+// \return void
+//
+// This function performs the OpenMP-based SMP initialization of a dense matrix. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the dense matrix is SMP-assignable. Matrices that are too small for an SMP
+// assignment as well as initializations within a serial section or within an active parallel
+// section are performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename ET >  // Type of the initialization value
+inline EnableIf_< IsSMPAssignable<MT> >
+   smpFill( DenseMatrix<MT,SO>& lhs, const ET& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT> );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || !(~lhs).canSMPAssign() )
+   {
+      const size_t N( SO ? (~lhs).columns() : (~lhs).rows() );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         std::fill( (~lhs).begin(i), (~lhs).end(i), value );
+      }
+
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel shared( lhs, value )
+      smpFill_backend( ~lhs, value );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
@@ -40,20 +40,30 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <vector>
 #include <omp.h>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/dense/DynamicVector.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/NonZeroPartition.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/IsCompact.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/views/Submatrix.h>
 #include <blaze/math/views/Subvector.h>
 #include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
@@ -67,6 +77,393 @@
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  SPARSE MATRIX/DENSE VECTOR MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a row-major sparse matrix/dense vector
+//        multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a
+// row-major sparse matrix/dense vector multiplication to a dense vector. In contrast to the
+// general dense vector backend, the rows of the sparse matrix are distributed among the threads
+// such that every thread processes approximately the same number of non-zero elements (see the
+// NonZeroPartition class). In case the sparse matrix is a compact matrix, the elements of each
+// part are computed via the subscript operator of the multiplication expression, which applies
+// the gather-based kernel for compact matrices.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix
+        , typename VT2 >  // Type of the right-hand side dense vector
+void smpAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef SubvectorExprTrait_<VT1,unaligned>  UnalignedTarget;
+
+   const int threads( omp_get_num_threads() );
+
+   NonZeroPartition buffer;
+   const NonZeroPartition* partition( nullptr );
+
+#pragma omp single copyprivate( partition )
+   partition = &nonZeroPartition( rhs.leftOperand(), threads, buffer );
+
+   // The implicit barrier at the end of the loop guarantees that the partition buffer of the
+   // thread executing the single construct outlives all accesses to the partition.
+#pragma omp for schedule(dynamic,1)
+   for( int p=0; p<threads; ++p )
+   {
+      const size_t index( partition->begin(p) );
+      const size_t size ( partition->end(p) - index );
+
+      if( size == 0UL )
+         continue;
+
+      if( IsCompact<MT>::value && HasConstDataAccess<VT2>::value ) {
+         for( size_t i=index; i<index+size; ++i )
+            (~lhs)[i] = (~rhs)[i];
+         continue;
+      }
+
+      UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+      assign( target, subvector<unaligned>( ~rhs, index, size ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP addition assignment of a row-major sparse matrix/dense vector
+//        multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be added.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP addition assignment of a
+// row-major sparse matrix/dense vector multiplication to a dense vector. In contrast to the
+// general dense vector backend, the rows of the sparse matrix are distributed among the threads
+// such that every thread processes approximately the same number of non-zero elements (see the
+// NonZeroPartition class). In case the sparse matrix is a compact matrix, the elements of each
+// part are computed via the subscript operator of the multiplication expression, which applies
+// the gather-based kernel for compact matrices.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix
+        , typename VT2 >  // Type of the right-hand side dense vector
+void smpAddAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef SubvectorExprTrait_<VT1,unaligned>  UnalignedTarget;
+
+   const int threads( omp_get_num_threads() );
+
+   NonZeroPartition buffer;
+   const NonZeroPartition* partition( nullptr );
+
+#pragma omp single copyprivate( partition )
+   partition = &nonZeroPartition( rhs.leftOperand(), threads, buffer );
+
+   // The implicit barrier at the end of the loop guarantees that the partition buffer of the
+   // thread executing the single construct outlives all accesses to the partition.
+#pragma omp for schedule(dynamic,1)
+   for( int p=0; p<threads; ++p )
+   {
+      const size_t index( partition->begin(p) );
+      const size_t size ( partition->end(p) - index );
+
+      if( size == 0UL )
+         continue;
+
+      if( IsCompact<MT>::value && HasConstDataAccess<VT2>::value ) {
+         for( size_t i=index; i<index+size; ++i )
+            (~lhs)[i] += (~rhs)[i];
+         continue;
+      }
+
+      UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+      addAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a row-major sparse matrix/dense vector
+//        multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be subtracted.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP subtraction assignment of a
+// row-major sparse matrix/dense vector multiplication to a dense vector. In contrast to the
+// general dense vector backend, the rows of the sparse matrix are distributed among the threads
+// such that every thread processes approximately the same number of non-zero elements (see the
+// NonZeroPartition class). In case the sparse matrix is a compact matrix, the elements of each
+// part are computed via the subscript operator of the multiplication expression, which applies
+// the gather-based kernel for compact matrices.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix
+        , typename VT2 >  // Type of the right-hand side dense vector
+void smpSubAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef SubvectorExprTrait_<VT1,unaligned>  UnalignedTarget;
+
+   const int threads( omp_get_num_threads() );
+
+   NonZeroPartition buffer;
+   const NonZeroPartition* partition( nullptr );
+
+#pragma omp single copyprivate( partition )
+   partition = &nonZeroPartition( rhs.leftOperand(), threads, buffer );
+
+   // The implicit barrier at the end of the loop guarantees that the partition buffer of the
+   // thread executing the single construct outlives all accesses to the partition.
+#pragma omp for schedule(dynamic,1)
+   for( int p=0; p<threads; ++p )
+   {
+      const size_t index( partition->begin(p) );
+      const size_t size ( partition->end(p) - index );
+
+      if( size == 0UL )
+         continue;
+
+      if( IsCompact<MT>::value && HasConstDataAccess<VT2>::value ) {
+         for( size_t i=index; i<index+size; ++i )
+            (~lhs)[i] -= (~rhs)[i];
+         continue;
+      }
+
+      UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+      subAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP (addition/subtraction) assignment of a column-major
+//        sparse matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression.
+// \param accumulate \a true in case of an addition or subtraction assignment.
+// \param subtract \a true in case of a subtraction assignment.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment, addition
+// assignment and subtraction assignment of a column-major sparse matrix/dense vector
+// multiplication to a dense vector. Since every column of the sparse matrix contributes to the
+// complete result vector, the columns are distributed among the threads based on the number of
+// non-zero elements and every thread computes the product of its block of columns into a
+// private accumulator. Afterwards the private accumulators are reduced into the target vector
+// in several rounds: in every round each thread adds a different contiguous range of its
+// accumulator to the target vector via vectorized subvector operations. Therefore no two
+// threads ever write to the same range of the target vector at the same time.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix
+        , typename VT2 >  // Type of the right-hand side dense vector
+void smpTSMatDVecMult_backend( DenseVector<VT1,false>& lhs, const TSMatDVecMultExpr<MT,VT2>& rhs,
+                               bool accumulate, bool subtract )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef DynamicVector< ElementType_<VT1>, false >  PartialType;
+   typedef SubvectorExprTrait_<VT1,unaligned>         UnalignedTarget;
+
+   enum : size_t { SIMDSIZE = SIMDTrait< ElementType_<VT1> >::size };
+
+   const size_t M( (~lhs).size() );
+
+   if( M == 0UL )
+      return;
+
+   const int threads( omp_get_num_threads() );
+   const int thread ( omp_get_thread_num()  );
+
+   NonZeroPartition buffer;
+   const NonZeroPartition* partition( nullptr );
+
+#pragma omp single copyprivate( partition )
+   partition = &nonZeroPartition( rhs.leftOperand(), threads, buffer );
+
+   const size_t index( partition->begin( thread ) );
+   const size_t size ( partition->end( thread ) - index );
+
+   PartialType partial;
+
+   if( size > 0UL ) {
+      partial.resize( M, false );
+      assign( partial, submatrix<unaligned>( rhs.leftOperand(), 0UL, index, M, size ) *
+                       subvector<unaligned>( rhs.rightOperand(), index, size ) );
+   }
+
+   const size_t addon        ( ( ( M % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( M / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+
+   // All threads have to pass all barriers of the reduction, which additionally guarantees that
+   // the partition buffer of the thread executing the single construct outlives all accesses.
+   for( int round=0; round<threads; ++round )
+   {
+      if( round > 0 ) {
+#pragma omp barrier
+      }
+
+      const size_t begin( ( ( thread + round ) % threads ) * sizePerThread );
+
+      if( begin >= M )
+         continue;
+
+      const size_t n( min( sizePerThread, M - begin ) );
+      const bool init( round == 0 && !accumulate );
+
+      UnalignedTarget target( subvector<unaligned>( ~lhs, begin, n ) );
+
+      if( size == 0UL ) {
+         if( init ) reset( target );
+      }
+      else if( subtract ) {
+         subAssign( target, subvector<unaligned>( partial, begin, n ) );
+      }
+      else if( init ) {
+         assign( target, subvector<unaligned>( partial, begin, n ) );
+      }
+      else {
+         addAssign( target, subvector<unaligned>( partial, begin, n ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a column-major sparse matrix/dense
+//        vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix
+        , typename VT2 >  // Type of the right-hand side dense vector
+void smpAssign_backend( DenseVector<VT1,false>& lhs, const TSMatDVecMultExpr<MT,VT2>& rhs )
+{
+   smpTSMatDVecMult_backend( ~lhs, rhs, false, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP addition assignment of a column-major sparse matrix/dense
+//        vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix
+        , typename VT2 >  // Type of the right-hand side dense vector
+void smpAddAssign_backend( DenseVector<VT1,false>& lhs, const TSMatDVecMultExpr<MT,VT2>& rhs )
+{
+   smpTSMatDVecMult_backend( ~lhs, rhs, true, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a column-major sparse matrix/dense
+//        vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix
+        , typename VT2 >  // Type of the right-hand side dense vector
+void smpSubAssign_backend( DenseVector<VT1,false>& lhs, const TSMatDVecMultExpr<MT,VT2>& rhs )
+{
+   smpTSMatDVecMult_backend( ~lhs, rhs, true, true );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  PLAIN ASSIGNMENT
@@ -1100,6 +1497,303 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \param results The storage for the partial results of the single threads.
+// \param redux The result of the reduction operation.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP reduction of
+// a dense vector. The vector is split into one range per thread, the ranges are reduced
+// concurrently, and the partial results are combined in order.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+void smpReduce_backend( const DenseVector<VT,TF>& dv, OP op,
+                        std::vector< ElementType_<VT> >& results, ElementType_<VT>& redux )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef ElementType_<VT>  ET;
+
+   const size_t N( (~dv).size() );
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   const int    threads      ( omp_get_num_threads() );
+   const size_t addon        ( ( ( N % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( N / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const size_t parts        ( ( N + sizePerThread - 1UL ) / sizePerThread );
+
+   BLAZE_INTERNAL_ASSERT( parts <= results.size(), "Invalid number of partial results" );
+
+#pragma omp for schedule(dynamic,1)
+   for( int i=0; i<int( parts ); ++i )
+   {
+      const size_t index( i*sizePerThread );
+      const size_t size ( min( sizePerThread, N - index ) );
+      results[i] = dvecreduce( subvector<unaligned>( ~dv, index, size ), op );
+   }
+
+   // The implicit barrier at the end of the loop guarantees that all partial results are
+   // available before they are combined.
+#pragma omp single
+   {
+      ET tmp( results[0UL] );
+      for( size_t i=1UL; i<parts; ++i ) {
+         tmp = op( tmp, results[i] );
+      }
+      redux = tmp;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default OpenMP-based SMP reduction of a dense vector. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the dense vector is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< Not< IsSMPAssignable<VT> >, ElementType_<VT> >
+   smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dvecreduce( ~dv, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function performs the OpenMP-based SMP reduction of a dense vector. Due to the explicit
+// application of the SFINAE principle, this function can only be selected by the compiler in
+// case the dense vector is SMP-assignable. Vectors smaller than the
+// blaze::SMP_DVECREDUCE_THRESHOLD as well as reductions within a serial
+// section or within an active parallel section are performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< IsSMPAssignable<VT>, ElementType_<VT> >
+   smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef ElementType_<VT>    ET;
+   typedef CompositeType_<VT>  CT;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ET );
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       (~dv).size() < SMP_DVECREDUCE_THRESHOLD ) {
+      return dvecreduce( ~dv, op );
+   }
+
+   CT tmp( ~dv );
+   std::vector<ET> results( omp_get_max_threads() );
+   ET redux{};
+
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel shared( tmp, op, results, redux )
+      smpReduce_backend( tmp, op, results, redux );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The target dense vector.
+// \param value The value to be assigned to all elements.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP initialization of a dense
+// vector. The vector is split into the same ranges as in case of an SMP assignment, and every
+// range is initialized by one of the OpenMP threads. Due to the first-touch policy of the
+// operating system, the memory pages of each range are thus placed on the NUMA node of the
+// initializing thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense vectors. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename ET >  // Type of the initialization value
+void smpFill_backend( DenseVector<VT,TF>& lhs, const ET& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef SubvectorExprTrait_<VT,unaligned>  Target;
+
+   enum : size_t { SIMDSIZE = SIMDTrait< ElementType_<VT> >::size };
+
+   const bool simdEnabled( VT::simdEnabled );
+
+   const int    threads      ( omp_get_num_threads() );
+   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~lhs).size() / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= (~lhs).size() )
+         continue;
+
+      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+
+      Target target( subvector<unaligned>( ~lhs, index, size ) );
+      std::fill( target.begin(), target.end(), value );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The target dense vector.
+// \param value The value to be assigned to all elements.
+// \return void
+//
+// This function implements the default OpenMP-based SMP initialization of a dense vector. Due
+// to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case the dense vector is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense vectors. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename ET >  // Type of the initialization value
+inline EnableIf_< Not< IsSMPAssignable<VT> > >
+   smpFill( DenseVector<VT,TF>& lhs, const ET& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   std::fill( (~lhs).begin(), (~lhs).end(), value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The target dense vector.
+// \param value The value to be assigned to all elements.
+// \return void
+//
+// This function performs the OpenMP-based SMP initialization of a dense vector. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the dense vector is SMP-assignable. Vectors that are too small for an SMP
+// assignment as well as initializations within a serial section or within an active parallel
+// section are performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense vectors. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename ET >  // Type of the initialization value
+inline EnableIf_< IsSMPAssignable<VT> >
+   smpFill( DenseVector<VT,TF>& lhs, const ET& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<VT> );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || !(~lhs).canSMPAssign() ) {
+      std::fill( (~lhs).begin(), (~lhs).end(), value );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel shared( lhs, value )
+      smpFill_backend( ~lhs, value );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
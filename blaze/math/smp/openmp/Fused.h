@@ -0,0 +1,184 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/Fused.h
+//  \brief Header file for the OpenMP-based fused vector kernel SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_FUSED_H_
+#define _BLAZE_MATH_SMP_OPENMP_FUSED_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <omp.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  FUSED KERNEL EVALUATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP evaluation of a fused vector kernel.
+// \ingroup smp
+//
+// \param kernel The fused vector kernel to be evaluated.
+// \param results The storage for the partial results of the single threads.
+// \param parts The number of computed partial results.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP evaluation of a fused
+// vector kernel. The elements are split into one range per thread, where the size of each
+// range is a multiple of the granularity of the kernel. The partial result of each range is
+// stored in \a results.\n
+// This function must \b NOT be called explicitly! It is used internally for the evaluation of
+// the fused kernels of the iterative solvers. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename KT >  // Type of the fused vector kernel
+void smpFused_backend( const KT& kernel, std::vector< typename KT::ResultType >& results,
+                       size_t& parts )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const size_t N( kernel.size() );
+
+   const int    threads      ( omp_get_num_threads() );
+   const size_t addon        ( ( ( N % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( N / threads + addon );
+   const size_t rest         ( equalShare % KT::granularity );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + KT::granularity ):( equalShare ) );
+   const size_t numParts     ( ( N + sizePerThread - 1UL ) / sizePerThread );
+
+   BLAZE_INTERNAL_ASSERT( numParts <= results.size(), "Invalid number of partial results" );
+
+#pragma omp for schedule(dynamic,1)
+   for( int i=0; i<int( numParts ); ++i )
+   {
+      const size_t begin( i*sizePerThread );
+      results[i] = kernel( begin, min( begin + sizePerThread, N ) );
+   }
+
+#pragma omp single
+   parts = numParts;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP evaluation of a fused vector kernel.
+// \ingroup smp
+//
+// \param kernel The fused vector kernel to be evaluated.
+// \return The result of the fused vector kernel.
+//
+// This function performs the OpenMP-based SMP evaluation of a fused vector kernel. Kernels
+// that cannot be SMP assigned as well as kernels within a serial section or within an active
+// parallel section are evaluated serially. The partial results are combined in order after the
+// parallel section has been closed, i.e. the result does not depend on the scheduling of the
+// threads and vector- or matrix-valued results may themselves be combined in parallel.\n
+// This function must \b NOT be called explicitly! It is used internally for the evaluation of
+// the fused kernels of the iterative solvers. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename KT >  // Type of the fused vector kernel
+inline typename KT::ResultType smpFused( const KT& kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ResultType = typename KT::ResultType;
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       kernel.size() == 0UL || !kernel.canSMPAssign() ) {
+      return kernel( 0UL, kernel.size() );
+   }
+
+   std::vector<ResultType> results( omp_get_max_threads() );
+   size_t parts( 0UL );
+
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel shared( kernel, results, parts )
+      smpFused_backend( kernel, results, parts );
+   }
+
+   ResultType result( results[0UL] );
+
+   for( size_t i=1UL; i<parts; ++i ) {
+      result += results[i];
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_OPENMP_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
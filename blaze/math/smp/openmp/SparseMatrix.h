@@ -0,0 +1,515 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/SparseMatrix.h
+//  \brief Header file for the OpenMP-based sparse matrix SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_SPARSEMATRIX_H_
+#define _BLAZE_MATH_SMP_OPENMP_SPARSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <omp.h>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/NonZeroPartition.h>
+#include <blaze/math/sparse/SparseAccumulator.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transfers the result of an SMP assignment into a compressed matrix of matching type.
+// \ingroup math
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param tmp The evaluated right-hand side matrix.
+// \return void
+//
+// The target matrix directly takes over the storage of the evaluated matrix.
+*/
+template< typename Type  // Data type of the sparse matrices
+        , bool SO >      // Storage order of the sparse matrices
+inline void smpAssign_transfer( CompressedMatrix<Type,SO>& lhs, CompressedMatrix<Type,SO>& tmp )
+{
+   lhs.swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transfers the result of an SMP assignment into a compact matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side compact matrix.
+// \param tmp The evaluated right-hand side matrix.
+// \return void
+//
+// The capacity of the target matrix is adapted to the number of non-zero elements of the
+// evaluated matrix before the elements are copied. Note that the capacity of the target
+// matrix cannot be determined in advance since the number of non-zero elements of several
+// expressions (as for instance sparse matrix multiplications) is unknown.
+*/
+template< typename Type  // Data type of the sparse matrices
+        , bool SO        // Storage order of the sparse matrices
+        , typename IT >  // Index type of the compact matrix
+inline void smpAssign_transfer( CompactMatrix<Type,SO,IT>& lhs, CompressedMatrix<Type,SO>& tmp )
+{
+   lhs.reserve( tmp.nonZeros() );
+   lhs.assign( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transfers the result of an SMP assignment into an arbitrary sparse matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param tmp The evaluated right-hand side matrix.
+// \return void
+//
+// Since the assign() functions of sparse matrices require the target matrix to provide the
+// necessary capacity, the capacity for the non-zero elements of the evaluated matrix is
+// reserved before the elements are copied.
+*/
+template< typename MT      // Type of the left-hand side sparse matrix
+        , bool SO          // Storage order of the sparse matrices
+        , typename Type >  // Data type of the evaluated matrix
+inline void smpAssign_transfer( SparseMatrix<MT,SO>& lhs, CompressedMatrix<Type,SO>& tmp )
+{
+   (~lhs).reserve( tmp.nonZeros() );
+   assign( ~lhs, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a matrix to a sparse matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a matrix
+// to a sparse matrix. Since the number of non-zero elements of the result is in general unknown
+// in advance, the assignment is performed in three phases: First, every thread evaluates a
+// contiguous range of rows (row-major target) or columns (column-major target) into a block-
+// local compressed matrix. Second, the exact number of non-zero elements per row/column is
+// gathered from the blocks and the according capacity is reserved in a single compressed matrix.
+// Third, the blocks are copied in parallel into the disjoint row/column ranges of this compressed
+// matrix, which is finally transferred to the target matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void smpAssign_backend( SparseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef CompressedMatrix<ElementType_<MT1>,SO1>  BlockType;
+   typedef ConstIterator_<BlockType>                ConstIterator;
+
+   const size_t M( SO1 ? (~rhs).columns() : (~rhs).rows() );
+   const size_t N( SO1 ? (~rhs).rows() : (~rhs).columns() );
+
+   const size_t threads( omp_get_max_threads() );
+   const size_t addon  ( ( ( M % threads ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerThread( max( M / threads + addon, 1UL ) );
+   const int    blocks ( ( M + sizePerThread - 1UL ) / sizePerThread );
+
+   std::vector<BlockType> parts( blocks );
+
+#pragma omp parallel for schedule(dynamic,1) shared( rhs, parts )
+   for( int b=0; b<blocks; ++b )
+   {
+      const size_t index( b*sizePerThread );
+      const size_t size ( min( sizePerThread, M - index ) );
+
+      if( SO1 )
+         parts[b] = serial( submatrix<unaligned>( ~rhs, 0UL, index, (~rhs).rows(), size ) );
+      else
+         parts[b] = serial( submatrix<unaligned>( ~rhs, index, 0UL, size, (~rhs).columns() ) );
+   }
+
+   std::vector<size_t> nonzeros( M );
+
+   for( int b=0; b<blocks; ++b ) {
+      const size_t index( b*sizePerThread );
+      const size_t size ( min( sizePerThread, M - index ) );
+      for( size_t k=0UL; k<size; ++k )
+         nonzeros[index+k] = parts[b].nonZeros(k);
+   }
+
+   BlockType tmp( SO1 ? N : M, SO1 ? M : N, nonzeros );
+
+#pragma omp parallel for schedule(dynamic,1) shared( parts, tmp )
+   for( int b=0; b<blocks; ++b )
+   {
+      const size_t index( b*sizePerThread );
+      const size_t size ( min( sizePerThread, M - index ) );
+
+      for( size_t k=0UL; k<size; ++k ) {
+         const ConstIterator end( parts[b].end(k) );
+         for( ConstIterator element=parts[b].begin(k); element!=end; ++element ) {
+            if( SO1 )
+               tmp.append( element->index(), index+k, element->value() );
+            else
+               tmp.append( index+k, element->index(), element->value() );
+         }
+      }
+   }
+
+   smpAssign_transfer( ~lhs, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a sparse matrix-sparse matrix
+//        multiplication to a row-major sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a sparse
+// matrix-sparse matrix multiplication to a row-major sparse matrix. In contrast to the general
+// sparse matrix backend, no block-local results are created: First, the threads compute the
+// exact number of non-zero elements of each row of the product (symbolic phase). Second, the
+// according capacity is reserved in a single compressed matrix. Third, the threads compute the
+// rows of the product directly into this compressed matrix (numeric phase), which is finally
+// transferred to the target matrix. The rows are distributed among the threads based on the
+// number of non-zero elements of the left-hand side operand (see the NonZeroPartition class).\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix operand
+        , typename MT3 >  // Type of the right-hand side sparse matrix operand
+void smpAssign_backend( SparseMatrix<MT1,false>& lhs, const SMatSMatMultExpr<MT2,MT3>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef ElementType_< SMatSMatMultExpr<MT2,MT3> >  ET;
+   typedef CompressedMatrix<ElementType_<MT1>,false>  ResultType;
+
+   const MT2& A( rhs.leftOperand()  );
+   const MT3& B( rhs.rightOperand() );
+
+   NonZeroPartition buffer;
+   const NonZeroPartition& partition( nonZeroPartition( A, omp_get_max_threads(), buffer ) );
+   const int parts( partition.parts() );
+
+   std::vector<size_t> nonzeros( A.rows() );
+
+#pragma omp parallel for schedule(dynamic,1) shared( A, B, partition, nonzeros )
+   for( int p=0; p<parts; ++p )
+   {
+      SparseAccumulator<ET> accumulator( B.columns() );
+
+      for( size_t i=partition.begin(p); i<partition.end(p); ++i ) {
+         nonzeros[i] = accumulator.count( A, B, i );
+      }
+   }
+
+   ResultType tmp( A.rows(), B.columns(), nonzeros );
+
+#pragma omp parallel for schedule(dynamic,1) shared( A, B, partition, tmp )
+   for( int p=0; p<parts; ++p )
+   {
+      SparseAccumulator<ET> accumulator( B.columns() );
+
+      for( size_t i=partition.begin(p); i<partition.end(p); ++i ) {
+         accumulator.multiply( tmp, A, B, i );
+      }
+   }
+
+   smpAssign_transfer( ~lhs, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the default OpenMP-based SMP assignment to a sparse
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case either of the two operands is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< And< IsSparseMatrix<MT1>
+                     , Or< Not< IsSMPAssignable<MT1> >
+                         , Not< IsSMPAssignable<MT2> > > > >
+   smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   assign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the OpenMP-based SMP assignment to a sparse matrix. Due
+// to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case both operands are SMP-assignable and the element types of both operands
+// are not SMP-assignable. In case the assignment is performed within an active parallel section
+// (as for instance during the evaluation of a temporary within a thread of another parallel
+// assignment), the assignment is performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< And< IsSparseMatrix<MT1>, IsSMPAssignable<MT1>, IsSMPAssignable<MT2> > >
+   smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT2> );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( isParallelSectionActive() ) {
+      assign( ~lhs, ~rhs );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         assign( ~lhs, ~rhs );
+      }
+      else {
+         smpAssign_backend( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP addition assignment to a
+//        sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function implements the default OpenMP-based SMP addition assignment to a
+// sparse matrix. Note that the addition assignment to a sparse matrix is always performed
+// serially, since it changes the number of non-zero elements of the target rows/columns.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< IsSparseMatrix<MT1> >
+   smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   addAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP subtraction assignment to a
+//        sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function implements the default OpenMP-based SMP subtraction assignment to
+// a sparse matrix. Note that the subtraction assignment to a sparse matrix is always performed
+// serially, since it changes the number of non-zero elements of the target rows/columns.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< IsSparseMatrix<MT1> >
+   smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   subAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_OPENMP_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,9 +40,12 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatReduceExpr.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/simd/SIMDTrait.h>
@@ -57,6 +60,7 @@
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/views/Submatrix.h>
 #include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
@@ -70,6 +74,144 @@
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  AUXILIARY FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded reduction of a block of a dense matrix.
+// \ingroup smp
+//
+// The DMatPartialReduction class template reduces the given range of rows (in case of a
+// row-major matrix) or columns (in case of a column-major matrix) of a dense matrix by means
+// of the given reduction operation and stores the result in the given location. The partial
+// results of several blocks are combined after all partial reductions have completed.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+struct DMatPartialReduction
+{
+   //**Type definitions****************************************************************************
+   typedef ElementType_<MT>  ET;  //!< Element type of the dense matrix.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DMatPartialReduction class template.
+   //
+   // \param mat The dense matrix to be reduced.
+   // \param op The reduction operation.
+   // \param result The location of the partial result.
+   // \param index The index of the first row/column of the block.
+   // \param size The number of rows/columns of the block.
+   */
+   explicit inline DMatPartialReduction( const MT& mat, OP op, ET& result, size_t index, size_t size )
+      : mat_   ( mat    )  // The dense matrix to be reduced
+      , op_    ( op     )  // The reduction operation
+      , result_( result )  // The location of the partial result
+      , index_ ( index  )  // The index of the first row/column of the block
+      , size_  ( size   )  // The number of rows/columns of the block
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the reduction of the block.
+   //
+   // \return void
+   */
+   inline void operator()() const
+   {
+      if( SO )
+         result_ = dmatreduce( submatrix<unaligned>( mat_, 0UL, index_, mat_.rows(), size_ ), op_ );
+      else
+         result_ = dmatreduce( submatrix<unaligned>( mat_, index_, 0UL, size_, mat_.columns() ), op_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const MT& mat_;     //!< The dense matrix to be reduced.
+   OP        op_;      //!< The reduction operation.
+   ET&       result_;  //!< The location of the partial result.
+   size_t    index_;   //!< The index of the first row/column of the block.
+   size_t    size_;    //!< The number of rows/columns of the block.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded initialization of a block of a dense matrix.
+// \ingroup smp
+//
+// The DMatPartialFill class template assigns the given value to all elements of the given
+// block of a dense matrix. It is used for the first-touch initialization of dense matrices,
+// i.e. every block is initialized by the thread that will later on work on the block.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename ET >  // Type of the initialization value
+struct DMatPartialFill
+{
+   //**Type definitions****************************************************************************
+   typedef SubmatrixExprTrait_<MT,unaligned>  Target;  //!< Type of the block of the dense matrix.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DMatPartialFill class template.
+   //
+   // \param mat The dense matrix to be initialized.
+   // \param value The value to be assigned to all elements of the block.
+   // \param row The index of the first row of the block.
+   // \param column The index of the first column of the block.
+   // \param m The number of rows of the block.
+   // \param n The number of columns of the block.
+   */
+   explicit inline DMatPartialFill( MT& mat, const ET& value,
+                                    size_t row, size_t column, size_t m, size_t n )
+      : mat_   ( mat    )  // The dense matrix to be initialized
+      , value_ ( value  )  // The value to be assigned to all elements of the block
+      , row_   ( row    )  // The index of the first row of the block
+      , column_( column )  // The index of the first column of the block
+      , m_     ( m      )  // The number of rows of the block
+      , n_     ( n      )  // The number of columns of the block
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the initialization of the block.
+   //
+   // \return void
+   */
+   inline void operator()() const
+   {
+      Target target( submatrix<unaligned>( mat_, row_, column_, m_, n_ ) );
+
+      for( size_t i=0UL; i<( SO ? n_ : m_ ); ++i ) {
+         std::fill( target.begin(i), target.end(i), value_ );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   MT&       mat_;     //!< The dense matrix to be initialized.
+   const ET& value_;   //!< The value to be assigned to all elements of the block.
+   size_t    row_;     //!< The index of the first row of the block.
+   size_t    column_;  //!< The index of the first column of the block.
+   size_t    m_;       //!< The number of rows of the block.
+   size_t    n_;       //!< The number of columns of the block.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  PLAIN ASSIGNMENT
@@ -865,6 +1007,315 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP reduction of
+// a dense matrix. The rows (in case of a row-major matrix) or columns (in case of a column-major
+// matrix) are split into one block per thread, the blocks are reduced concurrently, and the
+// partial results are combined in order.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+ElementType_<MT> smpReduce_backend( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef ElementType_<MT>  ET;
+
+   const size_t N( SO ? (~dm).columns() : (~dm).rows() );
+
+   const size_t threads      ( TheThreadBackend::size() );
+   const size_t addon        ( ( ( N % threads ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerThread( N / threads + addon );
+   const size_t parts        ( ( N + sizePerThread - 1UL ) / sizePerThread );
+
+   std::vector<ET> results( parts );
+
+   for( size_t i=0UL; i<parts; ++i ) {
+      const size_t index( i*sizePerThread );
+      const size_t size ( min( sizePerThread, N - index ) );
+      TheThreadBackend::schedule( DMatPartialReduction<MT,SO,OP>( ~dm, op, results[i], index, size ) );
+   }
+
+   TheThreadBackend::wait();
+
+   ET redux( results[0UL] );
+
+   for( size_t i=1UL; i<parts; ++i ) {
+      redux = op( redux, results[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default C++11/Boost thread-based SMP reduction of a dense matrix.
+// Due to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case the dense matrix is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< Not< IsSMPAssignable<MT> >, ElementType_<MT> >
+   smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dmatreduce( ~dm, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function performs the C++11/Boost thread-based SMP reduction of a dense matrix. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the dense matrix is SMP-assignable. Matrices with less elements than the
+// blaze::SMP_DMATREDUCE_THRESHOLD as well as reductions within a serial section or within an
+// active parallel section are performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< IsSMPAssignable<MT>, ElementType_<MT> >
+   smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef ElementType_<MT>    ET;
+   typedef CompositeType_<MT>  CT;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ET );
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       (~dm).rows() * (~dm).columns() < SMP_DMATREDUCE_THRESHOLD ) {
+      return dmatreduce( ~dm, op );
+   }
+
+   CT tmp( ~dm );
+   ET redux{};
+
+   BLAZE_PARALLEL_SECTION
+   {
+      redux = smpReduce_backend( tmp, op );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP initialization of a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target dense matrix.
+// \param value The value to be assigned to all elements.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP initialization
+// of a dense matrix. The matrix is split into the same blocks as in case of an SMP assignment,
+// and every block is initialized by one of the threads of the thread pool. Due to the first-touch
+// policy of the operating system, the memory pages of each block are thus placed on the NUMA
+// node of the initializing thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename ET >  // Type of the initialization value
+void smpFill_backend( DenseMatrix<MT,SO>& lhs, const ET& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   enum : size_t { SIMDSIZE = SIMDTrait< ElementType_<MT> >::size };
+
+   const bool simdEnabled( MT::simdEnabled );
+
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~lhs ) );
+
+   const size_t addon1     ( ( ( (~lhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1( (~lhs).rows() / threads.first + addon1 );
+   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
+   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+
+   const size_t addon2     ( ( ( (~lhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( (~lhs).columns() / threads.second + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+
+   for( size_t i=0UL; i<threads.first; ++i )
+   {
+      const size_t row( i*rowsPerThread );
+
+      if( row >= (~lhs).rows() )
+         continue;
+
+      for( size_t j=0UL; j<threads.second; ++j )
+      {
+         const size_t column( j*colsPerThread );
+
+         if( column >= (~lhs).columns() )
+            continue;
+
+         const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
+         const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+
+         TheThreadBackend::schedule( DMatPartialFill<MT,SO,ET>( ~lhs, value, row, column, m, n ) );
+      }
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP initialization of a dense
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target dense matrix.
+// \param value The value to be assigned to all elements.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP initialization of a dense
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case the dense matrix is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename ET >  // Type of the initialization value
+inline EnableIf_< Not< IsSMPAssignable<MT> > >
+   smpFill( DenseMatrix<MT,SO>& lhs, const ET& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t N( SO ? (~lhs).columns() : (~lhs).rows() );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      std::fill( (~lhs).begin(i), (~lhs).end(i), value );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP initialization of a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target dense matrix.
+// \param value The value to be assigned to all elements.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP initialization of a dense matrix.
+// Due to the explicit application of the SFINAE principle, this function can only be selected
+// by the compiler in case the dense matrix is SMP-assignable. Matrices that are too small for
+// an SMP assignment as well as initializations within a serial section or within an active
+// parallel section are performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename ET >  // Type of the initialization value
+inline EnableIf_< IsSMPAssignable<MT> >
+   smpFill( DenseMatrix<MT,SO>& lhs, const ET& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT> );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || !(~lhs).canSMPAssign() )
+   {
+      const size_t N( SO ? (~lhs).columns() : (~lhs).rows() );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         std::fill( (~lhs).begin(i), (~lhs).end(i), value );
+      }
+
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpFill_backend( ~lhs, value );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
@@ -40,20 +40,30 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/dense/DynamicVector.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/sparse/NonZeroPartition.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/IsCompact.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/views/Submatrix.h>
 #include <blaze/math/views/Subvector.h>
 #include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
@@ -67,6 +77,564 @@
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  AUXILIARY FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded reduction of partial results into a dense vector.
+// \ingroup smp
+//
+// The DVecPartialReducer class template accumulates the given range of elements of several
+// partial result vectors and assigns (\a accumulate set to \a false), adds (\a accumulate set
+// to \a true) or subtracts (\a subtract set to \a true) the sum to/from the according range of
+// the target dense vector. Since every reducer only modifies its own range of the target vector,
+// several reducers can be executed concurrently.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename PT >  // Type of the partial result vectors
+struct DVecPartialReducer
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DVecPartialReducer class template.
+   //
+   // \param target The target dense vector.
+   // \param partials The partial result vectors.
+   // \param index The index of the first element of the range.
+   // \param size The number of elements of the range.
+   // \param accumulate \a true if the partial results are added to the target vector.
+   // \param subtract \a true if the partial results are subtracted from the target vector.
+   */
+   explicit inline DVecPartialReducer( VT& target, const std::vector<PT>& partials,
+                                       size_t index, size_t size, bool accumulate, bool subtract )
+      : target_    ( target     )  // The target dense vector
+      , partials_  ( partials   )  // The partial result vectors
+      , index_     ( index      )  // The index of the first element of the range
+      , size_      ( size       )  // The number of elements of the range
+      , accumulate_( accumulate )  // Accumulation flag
+      , subtract_  ( subtract   )  // Subtraction flag
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the reduction of the range.
+   //
+   // \return void
+   */
+   inline void operator()() const
+   {
+      typedef SubvectorExprTrait_<VT,unaligned>  Target;
+
+      Target target( subvector<unaligned>( target_, index_, size_ ) );
+
+      for( size_t k=0UL; k<partials_.size(); ++k ) {
+         if( subtract_ )
+            subAssign( target, subvector<unaligned>( partials_[k], index_, size_ ) );
+         else if( k == 0UL && !accumulate_ )
+            assign( target, subvector<unaligned>( partials_[k], index_, size_ ) );
+         else
+            addAssign( target, subvector<unaligned>( partials_[k], index_, size_ ) );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   VT&                    target_;      //!< The target dense vector.
+   const std::vector<PT>& partials_;    //!< The partial result vectors.
+   size_t                 index_;       //!< The index of the first element of the range.
+   size_t                 size_;        //!< The number of elements of the range.
+   bool                   accumulate_;  //!< Accumulation flag.
+   bool                   subtract_;    //!< Subtraction flag.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded reduction of a range of a dense vector.
+// \ingroup smp
+//
+// The DVecPartialReduction class template reduces the given range of elements of a dense vector
+// by means of the given reduction operation and stores the result in the given location. The
+// partial results of several ranges are combined after all partial reductions have completed.
+*/
+template< typename VT    // Type of the dense vector
+        , typename OP >  // Type of the reduction operation
+struct DVecPartialReduction
+{
+   //**Type definitions****************************************************************************
+   typedef ElementType_<VT>  ET;  //!< Element type of the dense vector.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DVecPartialReduction class template.
+   //
+   // \param vec The dense vector to be reduced.
+   // \param op The reduction operation.
+   // \param result The location of the partial result.
+   // \param index The index of the first element of the range.
+   // \param size The number of elements of the range.
+   */
+   explicit inline DVecPartialReduction( const VT& vec, OP op, ET& result, size_t index, size_t size )
+      : vec_   ( vec    )  // The dense vector to be reduced
+      , op_    ( op     )  // The reduction operation
+      , result_( result )  // The location of the partial result
+      , index_ ( index  )  // The index of the first element of the range
+      , size_  ( size   )  // The number of elements of the range
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the reduction of the range.
+   //
+   // \return void
+   */
+   inline void operator()() const
+   {
+      result_ = dvecreduce( subvector<unaligned>( vec_, index_, size_ ), op_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const VT& vec_;     //!< The dense vector to be reduced.
+   OP        op_;      //!< The reduction operation.
+   ET&       result_;  //!< The location of the partial result.
+   size_t    index_;   //!< The index of the first element of the range.
+   size_t    size_;    //!< The number of elements of the range.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded initialization of a range of a dense vector.
+// \ingroup smp
+//
+// The DVecPartialFill class template assigns the given value to all elements of the given
+// range of a dense vector. It is used for the first-touch initialization of dense vectors, i.e.
+// every range is initialized by the thread that will later on work on the range.
+*/
+template< typename VT    // Type of the dense vector
+        , typename ET >  // Type of the initialization value
+struct DVecPartialFill
+{
+   //**Type definitions****************************************************************************
+   typedef SubvectorExprTrait_<VT,unaligned>  Target;  //!< Type of the range of the dense vector.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DVecPartialFill class template.
+   //
+   // \param vec The dense vector to be initialized.
+   // \param value The value to be assigned to all elements of the range.
+   // \param index The index of the first element of the range.
+   // \param size The number of elements of the range.
+   */
+   explicit inline DVecPartialFill( VT& vec, const ET& value, size_t index, size_t size )
+      : vec_  ( vec   )  // The dense vector to be initialized
+      , value_( value )  // The value to be assigned to all elements of the range
+      , index_( index )  // The index of the first element of the range
+      , size_ ( size  )  // The number of elements of the range
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the initialization of the range.
+   //
+   // \return void
+   */
+   inline void operator()() const
+   {
+      Target target( subvector<unaligned>( vec_, index_, size_ ) );
+      std::fill( target.begin(), target.end(), value_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   VT&       vec_;    //!< The dense vector to be initialized.
+   const ET& value_;  //!< The value to be assigned to all elements of the range.
+   size_t    index_;  //!< The index of the first element of the range.
+   size_t    size_;   //!< The number of elements of the range.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE MATRIX/DENSE VECTOR MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a row-major sparse matrix/dense
+//        vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment
+// of a row-major sparse matrix/dense vector multiplication to a dense vector. In contrast to
+// the general dense vector backend, the rows of the sparse matrix are distributed among the
+// threads such that every thread processes approximately the same number of non-zero elements
+// (see the NonZeroPartition class). In case the sparse matrix is a compact matrix, the elements
+// of each part are computed via the subscript operator of the multiplication expression, which
+// applies the gather-based kernel for compact matrices.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix
+        , typename VT2 >  // Type of the right-hand side dense vector
+void smpAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef SubvectorExprTrait_<VT1,unaligned>  UnalignedTarget;
+
+   NonZeroPartition buffer;
+   const NonZeroPartition& partition(
+      nonZeroPartition( rhs.leftOperand(), TheThreadBackend::size(), buffer ) );
+
+   for( size_t p=0UL; p<partition.parts(); ++p )
+   {
+      const size_t index( partition.begin(p) );
+      const size_t size ( partition.end(p) - index );
+
+      if( size == 0UL )
+         continue;
+
+      if( IsCompact<MT>::value && HasConstDataAccess<VT2>::value ) {
+         TheThreadBackend::schedule( [&lhs,&rhs,index,size]() {
+            for( size_t i=index; i<index+size; ++i )
+               (~lhs)[i] = (~rhs)[i];
+         } );
+         continue;
+      }
+
+      UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+      TheThreadBackend::scheduleAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a row-major sparse
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be added.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP addition
+// assignment of a row-major sparse matrix/dense vector multiplication to a dense vector. The
+// rows of the sparse matrix are distributed among the threads based on the number of non-zero
+// elements. Compact matrices are handled via the gather-based subscript operator.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix
+        , typename VT2 >  // Type of the right-hand side dense vector
+void smpAddAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef SubvectorExprTrait_<VT1,unaligned>  UnalignedTarget;
+
+   NonZeroPartition buffer;
+   const NonZeroPartition& partition(
+      nonZeroPartition( rhs.leftOperand(), TheThreadBackend::size(), buffer ) );
+
+   for( size_t p=0UL; p<partition.parts(); ++p )
+   {
+      const size_t index( partition.begin(p) );
+      const size_t size ( partition.end(p) - index );
+
+      if( size == 0UL )
+         continue;
+
+      if( IsCompact<MT>::value && HasConstDataAccess<VT2>::value ) {
+         TheThreadBackend::schedule( [&lhs,&rhs,index,size]() {
+            for( size_t i=index; i<index+size; ++i )
+               (~lhs)[i] += (~rhs)[i];
+         } );
+         continue;
+      }
+
+      UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+      TheThreadBackend::scheduleAddAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a row-major sparse
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be subtracted.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
+// assignment of a row-major sparse matrix/dense vector multiplication to a dense vector. The
+// rows of the sparse matrix are distributed among the threads based on the number of non-zero
+// elements. Compact matrices are handled via the gather-based subscript operator.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix
+        , typename VT2 >  // Type of the right-hand side dense vector
+void smpSubAssign_backend( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr<MT,VT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef SubvectorExprTrait_<VT1,unaligned>  UnalignedTarget;
+
+   NonZeroPartition buffer;
+   const NonZeroPartition& partition(
+      nonZeroPartition( rhs.leftOperand(), TheThreadBackend::size(), buffer ) );
+
+   for( size_t p=0UL; p<partition.parts(); ++p )
+   {
+      const size_t index( partition.begin(p) );
+      const size_t size ( partition.end(p) - index );
+
+      if( size == 0UL )
+         continue;
+
+      if( IsCompact<MT>::value && HasConstDataAccess<VT2>::value ) {
+         TheThreadBackend::schedule( [&lhs,&rhs,index,size]() {
+            for( size_t i=index; i<index+size; ++i )
+               (~lhs)[i] -= (~rhs)[i];
+         } );
+         continue;
+      }
+
+      UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+      TheThreadBackend::scheduleSubAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP (addition/subtraction) assignment of a
+//        column-major sparse matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression.
+// \param accumulate \a true in case of an addition or subtraction assignment.
+// \param subtract \a true in case of a subtraction assignment.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment,
+// addition assignment and subtraction assignment of a column-major sparse matrix/dense vector
+// multiplication to a dense vector. Since every column of the sparse matrix contributes to
+// the complete result vector, the columns are distributed among the threads based on the
+// number of non-zero elements and every thread computes the product of its block of columns
+// into a private accumulator. Afterwards the private accumulators are reduced into the target
+// vector in parallel, where every thread sums up a contiguous range of elements of all
+// accumulators via vectorized subvector operations.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix
+        , typename VT2 >  // Type of the right-hand side dense vector
+void smpTSMatDVecMult_backend( DenseVector<VT1,false>& lhs, const TSMatDVecMultExpr<MT,VT2>& rhs,
+                               bool accumulate, bool subtract )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef DynamicVector< ElementType_<VT1>, false >  PartialType;
+   typedef SubvectorExprTrait_<PartialType,unaligned>  PartialTarget;
+
+   enum : size_t { SIMDSIZE = SIMDTrait< ElementType_<VT1> >::size };
+
+   const size_t M( (~lhs).size() );
+
+   if( M == 0UL )
+      return;
+
+   const size_t threads( TheThreadBackend::size() );
+
+   NonZeroPartition buffer;
+   const NonZeroPartition& partition(
+      nonZeroPartition( rhs.leftOperand(), threads, buffer ) );
+
+   size_t count( 0UL );
+   for( size_t p=0UL; p<partition.parts(); ++p ) {
+      if( partition.begin(p) != partition.end(p) )
+         ++count;
+   }
+
+   std::vector<PartialType> partials( count, PartialType( M ) );
+
+   for( size_t p=0UL, k=0UL; p<partition.parts(); ++p )
+   {
+      const size_t index( partition.begin(p) );
+      const size_t size ( partition.end(p) - index );
+
+      if( size == 0UL )
+         continue;
+
+      PartialTarget target( subvector<unaligned>( partials[k], 0UL, M ) );
+      TheThreadBackend::scheduleAssign( target,
+         submatrix<unaligned>( rhs.leftOperand(), 0UL, index, M, size ) *
+         subvector<unaligned>( rhs.rightOperand(), index, size ) );
+      ++k;
+   }
+
+   TheThreadBackend::wait();
+
+   const size_t addon        ( ( ( M % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( M / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= M )
+         continue;
+
+      const size_t size( min( sizePerThread, M - index ) );
+
+      TheThreadBackend::schedule( DVecPartialReducer<VT1,PartialType>(
+         ~lhs, partials, index, size, accumulate, subtract ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a column-major sparse
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix
+        , typename VT2 >  // Type of the right-hand side dense vector
+void smpAssign_backend( DenseVector<VT1,false>& lhs, const TSMatDVecMultExpr<MT,VT2>& rhs )
+{
+   smpTSMatDVecMult_backend( ~lhs, rhs, false, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a column-major sparse
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix
+        , typename VT2 >  // Type of the right-hand side dense vector
+void smpAddAssign_backend( DenseVector<VT1,false>& lhs, const TSMatDVecMultExpr<MT,VT2>& rhs )
+{
+   smpTSMatDVecMult_backend( ~lhs, rhs, true, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a column-major
+//        sparse matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename MT     // Type of the left-hand side sparse matrix
+        , typename VT2 >  // Type of the right-hand side dense vector
+void smpSubAssign_backend( DenseVector<VT1,false>& lhs, const TSMatDVecMultExpr<MT,VT2>& rhs )
+{
+   smpTSMatDVecMult_backend( ~lhs, rhs, true, true );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  PLAIN ASSIGNMENT
@@ -1116,6 +1684,292 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP reduction of
+// a dense vector. The vector is split into one range per thread, the ranges are reduced
+// concurrently, and the partial results are combined in order.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+ElementType_<VT> smpReduce_backend( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef ElementType_<VT>  ET;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   const size_t N( (~dv).size() );
+
+   const size_t threads      ( TheThreadBackend::size() );
+   const size_t addon        ( ( ( N % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( N / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const size_t parts        ( ( N + sizePerThread - 1UL ) / sizePerThread );
+
+   std::vector<ET> results( parts );
+
+   for( size_t i=0UL; i<parts; ++i ) {
+      const size_t index( i*sizePerThread );
+      const size_t size ( min( sizePerThread, N - index ) );
+      TheThreadBackend::schedule( DVecPartialReduction<VT,OP>( ~dv, op, results[i], index, size ) );
+   }
+
+   TheThreadBackend::wait();
+
+   ET redux( results[0UL] );
+
+   for( size_t i=1UL; i<parts; ++i ) {
+      redux = op( redux, results[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default C++11/Boost thread-based SMP reduction of a dense vector.
+// Due to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case the dense vector is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< Not< IsSMPAssignable<VT> >, ElementType_<VT> >
+   smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dvecreduce( ~dv, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function performs the C++11/Boost thread-based SMP reduction of a dense vector. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the dense vector is SMP-assignable. Vectors smaller than the
+// blaze::SMP_DVECREDUCE_THRESHOLD as well as reductions within a serial section or within an
+// active parallel section are performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< IsSMPAssignable<VT>, ElementType_<VT> >
+   smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef ElementType_<VT>    ET;
+   typedef CompositeType_<VT>  CT;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ET );
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       (~dv).size() < SMP_DVECREDUCE_THRESHOLD ) {
+      return dvecreduce( ~dv, op );
+   }
+
+   CT tmp( ~dv );
+   ET redux{};
+
+   BLAZE_PARALLEL_SECTION
+   {
+      redux = smpReduce_backend( tmp, op );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The target dense vector.
+// \param value The value to be assigned to all elements.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP initialization
+// of a dense vector. The vector is split into the same ranges as in case of an SMP assignment,
+// and every range is initialized by one of the threads of the thread pool. Due to the first-touch
+// policy of the operating system, the memory pages of each range are thus placed on the NUMA
+// node of the initializing thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense vectors. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename ET >  // Type of the initialization value
+void smpFill_backend( DenseVector<VT,TF>& lhs, const ET& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   enum : size_t { SIMDSIZE = SIMDTrait< ElementType_<VT> >::size };
+
+   const bool simdEnabled( VT::simdEnabled );
+
+   const size_t threads      ( TheThreadBackend::size() );
+   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~lhs).size() / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= (~lhs).size() )
+         continue;
+
+      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      TheThreadBackend::schedule( DVecPartialFill<VT,ET>( ~lhs, value, index, size ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP initialization of a dense
+//        vector.
+// \ingroup smp
+//
+// \param lhs The target dense vector.
+// \param value The value to be assigned to all elements.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP initialization of a dense
+// vector. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case the dense vector is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense vectors. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename ET >  // Type of the initialization value
+inline EnableIf_< Not< IsSMPAssignable<VT> > >
+   smpFill( DenseVector<VT,TF>& lhs, const ET& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   std::fill( (~lhs).begin(), (~lhs).end(), value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The target dense vector.
+// \param value The value to be assigned to all elements.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP initialization of a dense vector.
+// Due to the explicit application of the SFINAE principle, this function can only be selected
+// by the compiler in case the dense vector is SMP-assignable. Vectors that are too small for
+// an SMP assignment as well as initializations within a serial section or within an active
+// parallel section are performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense vectors. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename ET >  // Type of the initialization value
+inline EnableIf_< IsSMPAssignable<VT> >
+   smpFill( DenseVector<VT,TF>& lhs, const ET& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<VT> );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || !(~lhs).canSMPAssign() ) {
+      std::fill( (~lhs).begin(), (~lhs).end(), value );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpFill_backend( ~lhs, value );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
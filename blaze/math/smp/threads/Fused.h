@@ -0,0 +1,237 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/Fused.h
+//  \brief Header file for the C++11/Boost thread-based fused vector kernel SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_FUSED_H_
+#define _BLAZE_MATH_SMP_THREADS_FUSED_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded evaluation of a fused vector kernel.
+// \ingroup smp
+//
+// The FusedPartialKernel class template applies the given fused vector kernel to the given
+// range of elements and stores the partial result of the kernel in the given result.
+*/
+template< typename KT >  // Type of the fused vector kernel
+struct FusedPartialKernel
+{
+   //**Type definitions****************************************************************************
+   using ResultType = typename KT::ResultType;  //!< Result type of the fused vector kernel.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedPartialKernel class template.
+   //
+   // \param kernel The fused vector kernel.
+   // \param result The target of the partial result.
+   // \param begin The index of the first element of the range.
+   // \param end The index one past the last element of the range.
+   */
+   explicit inline FusedPartialKernel( const KT& kernel, ResultType& result, size_t begin, size_t end )
+      : kernel_( kernel )  // The fused vector kernel
+      , result_( result )  // The target of the partial result
+      , begin_ ( begin  )  // The index of the first element of the range
+      , end_   ( end    )  // The index one past the last element of the range
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Applies the fused vector kernel to the range of elements.
+   //
+   // \return void
+   */
+   inline void operator()() const
+   {
+      result_ = kernel_( begin_, end_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const KT&   kernel_;  //!< The fused vector kernel.
+   ResultType& result_;  //!< The target of the partial result.
+   size_t      begin_;   //!< The index of the first element of the range.
+   size_t      end_;     //!< The index one past the last element of the range.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUSED KERNEL EVALUATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP evaluation of a fused vector kernel.
+// \ingroup smp
+//
+// \param kernel The fused vector kernel to be evaluated.
+// \param results The storage for the partial results of the single ranges.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP evaluation
+// of a fused vector kernel. The elements are split into one range per thread, where the size
+// of each range is a multiple of the granularity of the kernel. The partial result of each
+// range is stored in \a results.\n
+// This function must \b NOT be called explicitly! It is used internally for the evaluation of
+// the fused kernels of the iterative solvers. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename KT >  // Type of the fused vector kernel
+void smpFused_backend( const KT& kernel, std::vector< typename KT::ResultType >& results )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const size_t N( kernel.size() );
+
+   const size_t threads      ( TheThreadBackend::size() );
+   const size_t addon        ( ( ( N % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( N / threads + addon );
+   const size_t rest         ( equalShare % KT::granularity );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + KT::granularity ):( equalShare ) );
+   const size_t parts        ( ( N + sizePerThread - 1UL ) / sizePerThread );
+
+   results.resize( parts );
+
+   for( size_t i=0UL; i<parts; ++i ) {
+      const size_t begin( i*sizePerThread );
+      const size_t end  ( min( begin + sizePerThread, N ) );
+      TheThreadBackend::schedule( FusedPartialKernel<KT>( kernel, results[i], begin, end ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP evaluation of a fused vector kernel.
+// \ingroup smp
+//
+// \param kernel The fused vector kernel to be evaluated.
+// \return The result of the fused vector kernel.
+//
+// This function performs the C++11/Boost thread-based SMP evaluation of a fused vector kernel.
+// Kernels that cannot be SMP assigned as well as kernels within a serial section or within an
+// active parallel section are evaluated serially. The partial results are combined in order
+// after the parallel section has been closed, i.e. the result does not depend on the scheduling
+// of the threads and vector- or matrix-valued results may themselves be combined in parallel.\n
+// This function must \b NOT be called explicitly! It is used internally for the evaluation of
+// the fused kernels of the iterative solvers. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename KT >  // Type of the fused vector kernel
+inline typename KT::ResultType smpFused( const KT& kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       kernel.size() == 0UL || !kernel.canSMPAssign() ) {
+      return kernel( 0UL, kernel.size() );
+   }
+
+   std::vector< typename KT::ResultType > results;
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpFused_backend( kernel, results );
+   }
+
+   typename KT::ResultType result( results[0UL] );
+
+   for( size_t i=1UL; i<results.size(); ++i ) {
+      result += results[i];
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,741 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/SparseMatrix.h
+//  \brief Header file for the C++11/Boost thread-based sparse matrix SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_SPARSEMATRIX_H_
+#define _BLAZE_MATH_SMP_THREADS_SPARSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/NonZeroPartition.h>
+#include <blaze/math/sparse/SparseAccumulator.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded evaluation of a block of rows/columns of a matrix.
+// \ingroup smp
+//
+// The SMatBlockEvaluator class template evaluates a contiguous range of rows (in case of a
+// row-major block) or columns (in case of a column-major block) of the given matrix into a
+// block-local compressed matrix. The evaluation is performed serially, since it is executed
+// by a single thread of the thread backend.
+*/
+template< typename MT    // Type of the matrix to be evaluated
+        , typename BT >  // Type of the block-local sparse matrix
+struct SMatBlockEvaluator
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SMatBlockEvaluator class template.
+   //
+   // \param matrix The matrix to be evaluated.
+   // \param block The block-local sparse matrix.
+   // \param index The index of the first row/column of the block.
+   // \param size The number of rows/columns of the block.
+   */
+   explicit inline SMatBlockEvaluator( const MT& matrix, BT& block, size_t index, size_t size )
+      : matrix_( matrix )  // The matrix to be evaluated
+      , block_ ( block  )  // The block-local sparse matrix
+      , index_ ( index  )  // The index of the first row/column of the block
+      , size_  ( size   )  // The number of rows/columns of the block
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the evaluation of the block.
+   //
+   // \return void
+   */
+   inline void operator()() const {
+      if( IsColumnMajorMatrix<BT>::value )
+         block_ = serial( submatrix<unaligned>( matrix_, 0UL, index_, matrix_.rows(), size_ ) );
+      else
+         block_ = serial( submatrix<unaligned>( matrix_, index_, 0UL, size_, matrix_.columns() ) );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const MT& matrix_;  //!< The matrix to be evaluated.
+   BT&       block_;   //!< The block-local sparse matrix.
+   size_t    index_;   //!< The index of the first row/column of the block.
+   size_t    size_;    //!< The number of rows/columns of the block.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded copy of a block of rows/columns into a sparse matrix.
+// \ingroup smp
+//
+// The SMatBlockCopier class template appends the elements of a block-local compressed matrix
+// to the according rows/columns of the target compressed matrix. The target matrix is required
+// to provide exactly the necessary capacity for each row/column. Since every block only modifies
+// its own range of rows/columns, several blocks can be copied concurrently.
+*/
+template< typename BT >  // Type of the sparse matrices
+struct SMatBlockCopier
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SMatBlockCopier class template.
+   //
+   // \param target The target sparse matrix.
+   // \param block The block-local sparse matrix to be copied.
+   // \param index The index of the first row/column of the block.
+   */
+   explicit inline SMatBlockCopier( BT& target, const BT& block, size_t index )
+      : target_( target )  // The target sparse matrix
+      , block_ ( block  )  // The block-local sparse matrix
+      , index_ ( index  )  // The index of the first row/column of the block
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the copy of the block.
+   //
+   // \return void
+   */
+   inline void operator()() const
+   {
+      typedef ConstIterator_<BT>  ConstIterator;
+
+      const bool columnMajor( IsColumnMajorMatrix<BT>::value );
+      const size_t size( columnMajor ? block_.columns() : block_.rows() );
+
+      for( size_t k=0UL; k<size; ++k ) {
+         const ConstIterator end( block_.end(k) );
+         for( ConstIterator element=block_.begin(k); element!=end; ++element ) {
+            if( columnMajor )
+               target_.append( element->index(), index_+k, element->value() );
+            else
+               target_.append( index_+k, element->index(), element->value() );
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   BT&       target_;  //!< The target sparse matrix.
+   const BT& block_;   //!< The block-local sparse matrix.
+   size_t    index_;   //!< The index of the first row/column of the block.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded symbolic phase of a sparse matrix multiplication.
+// \ingroup smp
+//
+// The SMatSMatMultCounter class template computes the exact number of non-zero elements of a
+// contiguous range of rows of the product of two row-major sparse matrices. Since every counter
+// only writes the counts of its own range of rows, several counters can run concurrently.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix operand
+        , typename MT2    // Type of the right-hand side sparse matrix operand
+        , typename ET >   // Element type of the product
+struct SMatSMatMultCounter
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SMatSMatMultCounter class template.
+   //
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side sparse matrix operand.
+   // \param nonzeros The number of non-zero elements per row of the product.
+   // \param begin The index of the first row of the range.
+   // \param end The index one past the last row of the range.
+   */
+   explicit inline SMatSMatMultCounter( const MT1& A, const MT2& B, std::vector<size_t>& nonzeros,
+                                        size_t begin, size_t end )
+      : A_       ( A        )  // The left-hand side sparse matrix operand
+      , B_       ( B        )  // The right-hand side sparse matrix operand
+      , nonzeros_( nonzeros )  // The number of non-zero elements per row
+      , begin_   ( begin    )  // The index of the first row of the range
+      , end_     ( end      )  // The index one past the last row of the range
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the symbolic phase for the range of rows.
+   //
+   // \return void
+   */
+   inline void operator()() const
+   {
+      SparseAccumulator<ET> accumulator( B_.columns() );
+
+      for( size_t i=begin_; i<end_; ++i ) {
+         nonzeros_[i] = accumulator.count( A_, B_, i );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const MT1&           A_;         //!< The left-hand side sparse matrix operand.
+   const MT2&           B_;         //!< The right-hand side sparse matrix operand.
+   std::vector<size_t>& nonzeros_;  //!< The number of non-zero elements per row of the product.
+   size_t               begin_;     //!< The index of the first row of the range.
+   size_t               end_;       //!< The index one past the last row of the range.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded numeric phase of a sparse matrix multiplication.
+// \ingroup smp
+//
+// The SMatSMatMultKernel class template computes a contiguous range of rows of the product of
+// two row-major sparse matrices and appends them directly to the according rows of the target
+// compressed matrix. The target matrix is required to provide sufficient capacity for each row.
+// Since every kernel only modifies its own range of rows, several kernels can run concurrently.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix operand
+        , typename MT2    // Type of the right-hand side sparse matrix operand
+        , typename ET     // Element type of the product
+        , typename RT >   // Type of the target compressed matrix
+struct SMatSMatMultKernel
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SMatSMatMultKernel class template.
+   //
+   // \param target The target compressed matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side sparse matrix operand.
+   // \param begin The index of the first row of the range.
+   // \param end The index one past the last row of the range.
+   */
+   explicit inline SMatSMatMultKernel( RT& target, const MT1& A, const MT2& B,
+                                       size_t begin, size_t end )
+      : target_( target )  // The target compressed matrix
+      , A_     ( A      )  // The left-hand side sparse matrix operand
+      , B_     ( B      )  // The right-hand side sparse matrix operand
+      , begin_ ( begin  )  // The index of the first row of the range
+      , end_   ( end    )  // The index one past the last row of the range
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the numeric phase for the range of rows.
+   //
+   // \return void
+   */
+   inline void operator()() const
+   {
+      SparseAccumulator<ET> accumulator( B_.columns() );
+
+      for( size_t i=begin_; i<end_; ++i ) {
+         accumulator.multiply( target_, A_, B_, i );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   RT&        target_;  //!< The target compressed matrix.
+   const MT1& A_;       //!< The left-hand side sparse matrix operand.
+   const MT2& B_;       //!< The right-hand side sparse matrix operand.
+   size_t     begin_;   //!< The index of the first row of the range.
+   size_t     end_;     //!< The index one past the last row of the range.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transfers the result of an SMP assignment into a compressed matrix of matching type.
+// \ingroup math
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param tmp The evaluated right-hand side matrix.
+// \return void
+//
+// The target matrix directly takes over the storage of the evaluated matrix.
+*/
+template< typename Type  // Data type of the sparse matrices
+        , bool SO >      // Storage order of the sparse matrices
+inline void smpAssign_transfer( CompressedMatrix<Type,SO>& lhs, CompressedMatrix<Type,SO>& tmp )
+{
+   lhs.swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transfers the result of an SMP assignment into a compact matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side compact matrix.
+// \param tmp The evaluated right-hand side matrix.
+// \return void
+//
+// The capacity of the target matrix is adapted to the number of non-zero elements of the
+// evaluated matrix before the elements are copied. Note that the capacity of the target
+// matrix cannot be determined in advance since the number of non-zero elements of several
+// expressions (as for instance sparse matrix multiplications) is unknown.
+*/
+template< typename Type  // Data type of the sparse matrices
+        , bool SO        // Storage order of the sparse matrices
+        , typename IT >  // Index type of the compact matrix
+inline void smpAssign_transfer( CompactMatrix<Type,SO,IT>& lhs, CompressedMatrix<Type,SO>& tmp )
+{
+   lhs.reserve( tmp.nonZeros() );
+   lhs.assign( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transfers the result of an SMP assignment into an arbitrary sparse matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param tmp The evaluated right-hand side matrix.
+// \return void
+//
+// Since the assign() functions of sparse matrices require the target matrix to provide the
+// necessary capacity, the capacity for the non-zero elements of the evaluated matrix is
+// reserved before the elements are copied.
+*/
+template< typename MT      // Type of the left-hand side sparse matrix
+        , bool SO          // Storage order of the sparse matrices
+        , typename Type >  // Data type of the evaluated matrix
+inline void smpAssign_transfer( SparseMatrix<MT,SO>& lhs, CompressedMatrix<Type,SO>& tmp )
+{
+   (~lhs).reserve( tmp.nonZeros() );
+   assign( ~lhs, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a matrix to a sparse matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment
+// of a matrix to a sparse matrix. Since the number of non-zero elements of the result is in
+// general unknown in advance, the assignment is performed in three phases: First, every thread
+// evaluates a contiguous range of rows (row-major target) or columns (column-major target) into
+// a block-local compressed matrix. Second, the exact number of non-zero elements per row/column
+// is gathered from the blocks and the according capacity is reserved in a single compressed
+// matrix. Third, the blocks are copied in parallel into the disjoint row/column ranges of this
+// compressed matrix, which is finally transferred to the target matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void smpAssign_backend( SparseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef CompressedMatrix<ElementType_<MT1>,SO1>  BlockType;
+
+   const size_t M( SO1 ? (~rhs).columns() : (~rhs).rows() );
+   const size_t N( SO1 ? (~rhs).rows() : (~rhs).columns() );
+
+   const size_t threads( TheThreadBackend::size() );
+   const size_t addon  ( ( ( M % threads ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerThread( max( M / threads + addon, 1UL ) );
+   const size_t blocks( ( M + sizePerThread - 1UL ) / sizePerThread );
+
+   std::vector<BlockType> parts( blocks );
+
+   for( size_t b=0UL; b<blocks; ++b ) {
+      const size_t index( b*sizePerThread );
+      const size_t size ( min( sizePerThread, M - index ) );
+      TheThreadBackend::schedule( SMatBlockEvaluator<MT2,BlockType>( ~rhs, parts[b], index, size ) );
+   }
+
+   TheThreadBackend::wait();
+
+   std::vector<size_t> nonzeros( M );
+
+   for( size_t b=0UL; b<blocks; ++b ) {
+      const size_t index( b*sizePerThread );
+      const size_t size ( min( sizePerThread, M - index ) );
+      for( size_t k=0UL; k<size; ++k )
+         nonzeros[index+k] = parts[b].nonZeros(k);
+   }
+
+   BlockType tmp( SO1 ? N : M, SO1 ? M : N, nonzeros );
+
+   for( size_t b=0UL; b<blocks; ++b ) {
+      TheThreadBackend::schedule( SMatBlockCopier<BlockType>( tmp, parts[b], b*sizePerThread ) );
+   }
+
+   TheThreadBackend::wait();
+
+   smpAssign_transfer( ~lhs, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a sparse matrix-sparse matrix
+//        multiplication to a row-major sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment
+// of a sparse matrix-sparse matrix multiplication to a row-major sparse matrix. In contrast to
+// the general sparse matrix backend, no block-local results are created: First, the threads
+// compute the exact number of non-zero elements of each row of the product (symbolic phase).
+// Second, the according capacity is reserved in a single compressed matrix. Third, the threads
+// compute the rows of the product directly into this compressed matrix (numeric phase), which
+// is finally transferred to the target matrix. The rows are distributed among the threads based
+// on the number of non-zero elements of the left-hand side operand (see the NonZeroPartition
+// class).\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix operand
+        , typename MT3 >  // Type of the right-hand side sparse matrix operand
+void smpAssign_backend( SparseMatrix<MT1,false>& lhs, const SMatSMatMultExpr<MT2,MT3>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef ElementType_< SMatSMatMultExpr<MT2,MT3> >  ET;
+   typedef CompressedMatrix<ElementType_<MT1>,false>  ResultType;
+
+   const MT2& A( rhs.leftOperand()  );
+   const MT3& B( rhs.rightOperand() );
+
+   NonZeroPartition buffer;
+   const NonZeroPartition& partition( nonZeroPartition( A, TheThreadBackend::size(), buffer ) );
+
+   std::vector<size_t> nonzeros( A.rows() );
+
+   for( size_t p=0UL; p<partition.parts(); ++p ) {
+      if( partition.begin(p) == partition.end(p) ) continue;
+      TheThreadBackend::schedule( SMatSMatMultCounter<MT2,MT3,ET>(
+         A, B, nonzeros, partition.begin(p), partition.end(p) ) );
+   }
+
+   TheThreadBackend::wait();
+
+   ResultType tmp( A.rows(), B.columns(), nonzeros );
+
+   for( size_t p=0UL; p<partition.parts(); ++p ) {
+      if( partition.begin(p) == partition.end(p) ) continue;
+      TheThreadBackend::schedule( SMatSMatMultKernel<MT2,MT3,ET,ResultType>(
+         tmp, A, B, partition.begin(p), partition.end(p) ) );
+   }
+
+   TheThreadBackend::wait();
+
+   smpAssign_transfer( ~lhs, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP assignment to a sparse
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case either of the two operands is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< And< IsSparseMatrix<MT1>
+                     , Or< Not< IsSMPAssignable<MT1> >
+                         , Not< IsSMPAssignable<MT2> > > > >
+   smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   assign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP assignment to a sparse matrix. Due
+// to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case both operands are SMP-assignable and the element types of both operands
+// are not SMP-assignable. In case the assignment is performed within an active parallel section
+// (as for instance during the evaluation of a temporary within a thread of another parallel
+// assignment), the assignment is performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< And< IsSparseMatrix<MT1>, IsSMPAssignable<MT1>, IsSMPAssignable<MT2> > >
+   smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT2> );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( isParallelSectionActive() ) {
+      assign( ~lhs, ~rhs );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         assign( ~lhs, ~rhs );
+      }
+      else {
+         smpAssign_backend( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP addition assignment to a
+//        sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP addition assignment to a
+// sparse matrix. Note that the addition assignment to a sparse matrix is always performed
+// serially, since it changes the number of non-zero elements of the target rows/columns.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< IsSparseMatrix<MT1> >
+   smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   addAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP subtraction assignment to a
+//        sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP subtraction assignment to
+// a sparse matrix. Note that the subtraction assignment to a sparse matrix is always performed
+// serially, since it changes the number of non-zero elements of the target rows/columns.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< IsSparseMatrix<MT1> >
+   smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   subAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -58,6 +58,8 @@
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/ThreadPool.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+#include <blaze/util/WorkStealingPool.h>
 
 
 namespace blaze {
@@ -112,6 +114,9 @@ class ThreadBackend
 
    template< typename Target, typename Source >
    static inline void scheduleDivAssign( Target& target, const Source& source );
+
+   template< typename Callable >
+   static inline void schedule( Callable func );
    //@}
    //**********************************************************************************************
 
@@ -321,6 +326,14 @@ class ThreadBackend
    };
    //**********************************************************************************************
 
+   //**Type definitions****************************************************************************
+#if BLAZE_USE_WORK_STEALING_THREADPOOL
+   typedef WorkStealingPool<TT,MT,LT,CT>  Pool;  //!< Type of the thread pool.
+#else
+   typedef ThreadPool<TT,MT,LT,CT>  Pool;  //!< Type of the thread pool.
+#endif
+   //**********************************************************************************************
+
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
@@ -331,12 +344,10 @@ class ThreadBackend
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static ThreadPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
-                                                /*!< It is initialized with the number of threads
-                                                     specified via the environment variable
-                                                     \c BLAZE_NUM_THREADS. However, it can be
-                                                     explicitly resized to arbitrary numbers of
-                                                     threads. */
+   static Pool threadpool_;  //!< The pool of active threads of the backend system.
+                             /*!< It is initialized with the number of threads specified via
+                                  the environment variable \c BLAZE_NUM_THREADS. However, it
+                                  can be explicitly resized to arbitrary numbers of threads. */
    //@}
    //**********************************************************************************************
 };
@@ -355,7 +366,7 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+typename ThreadBackend<TT,MT,LT,CT>::Pool ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -391,7 +402,7 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 /*!\brief Changes the total number of threads managed by the thread backend system.
 //
 // \param n The new number of threads \f$[1..\infty)\f$.
-// \param block \a true if the function shall block, \a false if not.
+// \param block Without effect, the function always blocks.
 // \return void
 // \exception std::invalid_argument Invalid number of threads.
 //
@@ -399,8 +410,8 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 // \a n is smaller than the current size of the thread pool, the according number of threads is
 // removed from the backend system, otherwise new threads are added to the backend system. In
 // case an invalid number of threads is specified, an \a std::invalid_argument exception is
-// thrown. Via the \a block flag it is possible to block the function until the desired
-// number of threads is available.
+// thrown. Note that the \a block flag has no effect since the underlying WorkStealingPool
+// always blocks until the desired number of threads is available.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -408,7 +419,9 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 {
-   return threadpool_.resize( n, block );
+   UNUSED_PARAMETER( block );
+
+   return threadpool_.resize( n );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -567,6 +580,30 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleDivAssign( Target& target, const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given function/functor for execution.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function schedules an arbitrary function/functor for execution. It is used by SMP
+// assignments that cannot be expressed as a (compound) assignment between two expressions,
+// as for instance the multi-phase assignments to sparse matrices.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( Callable func )
+{
+   threadpool_.schedule( func );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,264 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/BiCGSTAB.h
+//  \brief Header file for the BiCGSTAB solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_BICGSTAB_H_
+#define _BLAZE_MATH_SOLVERS_BICGSTAB_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/smp/Fused.h>
+#include <blaze/math/solvers/FusedKernels.h>
+#include <blaze/math/solvers/LinearOperator.h>
+#include <blaze/math/solvers/Preconditioners.h>
+#include <blaze/math/solvers/SolverControl.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BICGSTAB FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BiCGSTAB functions */
+//@{
+template< typename OP, typename VT1, typename VT2 >
+SolverResult bicgstab( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                       const SolverControl& control = SolverControl() );
+
+template< typename OP, typename VT1, typename VT2, typename PT >
+SolverResult bicgstab( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                       const PT& M, const SolverControl& control = SolverControl() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given general linear system of equations via the BiCGSTAB method.
+// \ingroup solvers
+//
+// \param A The system matrix or matrix-free operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \param control The stopping criteria.
+// \return The number of iterations, the final relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system of equations \f$ A \cdot x = b \f$ for a general
+// square system matrix \a A by means of the biconjugate gradient stabilized (BiCGSTAB) method
+// without preconditioning. See the preconditioned version of bicgstab() for details.
+*/
+template< typename OP    // Type of the system matrix or matrix-free operator
+        , typename VT1   // Type of the solution vector
+        , typename VT2 > // Type of the right-hand side vector
+SolverResult bicgstab( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                       const SolverControl& control )
+{
+   return bicgstab( A, x, b, IdentityPreconditioner(), control );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given general linear system of equations via the right-preconditioned
+//        BiCGSTAB method.
+// \ingroup solvers
+//
+// \param A The system matrix or matrix-free operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \param M The preconditioner.
+// \param control The stopping criteria.
+// \return The number of iterations, the final relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system of equations \f$ A \cdot x = b \f$ for a general
+// square system matrix \a A by means of the right-preconditioned biconjugate gradient
+// stabilized (BiCGSTAB) method by van der Vorst. The given vector \a x is used as initial guess
+// and is overwritten with the solution. The iteration stops as soon as the norm of the residual
+// drops below the relative tolerance of the given \a control times the norm of \a b, in case the
+// maximum number of iterations has been reached, or in case of a breakdown of the method.
+//
+// As for cg(), the system matrix \a A can be any square dense or sparse matrix (including all
+// adaptors and views) or a matrix-free operator and \a M can be any preconditioner providing
+// the function call operator \c M( r, z ) computing \f$ z = M^{-1} \cdot r \f$. Per iteration
+// the algorithm performs two multiplications with the system matrix and four passes over the
+// vectors: the update of the search direction, the update of the intermediate residual fused
+// with its norm, the two inner products required for the stabilization step, and the update
+// of both the solution and the residual fused with the inner products of the next iteration.
+// In case of a row-major sparse system matrix, the inner product with the shadow residual is
+// computed during the first matrix/vector multiplication. The element type of \a x determines
+// the precision of all computations and has to be \c float, \c double, \c complex<float> or
+// \c complex<double>.
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Initialization
+
+   const blaze::SolverResult result( blaze::bicgstab( A, x, b, blaze::SolverControl( 1E-10 ) ) );
+   \endcode
+*/
+template< typename OP    // Type of the system matrix or matrix-free operator
+        , typename VT1   // Type of the solution vector
+        , typename VT2   // Type of the right-hand side vector
+        , typename PT >  // Type of the preconditioner
+SolverResult bicgstab( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                       const PT& M, const SolverControl& control )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using Type = ElementType_<VT1>;
+   using UT   = UnderlyingBuiltin_<Type>;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   const size_t n( (~b).size() );
+
+   if( (~x).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   checkOperator( A, n );
+
+   const size_t maxIterations( ( control.maxIterations != 0UL )?( control.maxIterations ):( n ) );
+
+   SolverResult result;
+
+   DynamicVector<Type> r( ~b );
+
+   const UT bnorm( sqrt( real( smpFused( FusedDotKernel<Type>( r, r ) ) ) ) );
+
+   if( bnorm == UT(0) ) {
+      reset( ~x );
+      result.converged = true;
+      return result;
+   }
+
+   DynamicVector<Type> xtmp( ~x ), p( n, Type() ), v( n, Type() ), t( n ), y, z;
+
+   applyOperator( A, xtmp, t );
+   r -= t;
+
+   const DynamicVector<Type> rhat( r );
+
+   const UT threshold( UT( control.tolerance ) * bnorm );
+   Type rho   ( smpFused( FusedDotKernel<Type>( rhat, r ) ) );
+   Type rhoOld( 1 );
+   Type alpha ( 1 );
+   Type omega ( 1 );
+   UT residual( sqrt( real( rho ) ) );
+
+   while( residual > threshold && result.iterations < maxIterations )
+   {
+      if( result.iterations > 0UL ) {
+         p = r + ( ( rho / rhoOld ) * ( alpha / omega ) ) * ( p - omega * v );
+      }
+      else {
+         p = r;
+      }
+
+      const DynamicVector<Type>& py( applyPreconditioner( M, p, y ) );
+      const Type rhatv( applyOperatorDot( A, py, v, rhat ) );
+
+      if( !isDivisor( rhatv ) )
+         break;
+
+      alpha = rho / rhatv;
+
+      residual = sqrt( real( smpFused( FusedSubNormKernel<Type>( r, v, alpha ) ) ) );
+      ++result.iterations;
+
+      if( residual <= threshold ) {
+         xtmp += alpha * py;
+         break;
+      }
+
+      const DynamicVector<Type>& sz( applyPreconditioner( M, r, z ) );
+      applyOperator( A, sz, t );
+
+      const StaticVector<Type,2UL> ts( smpFused( FusedDotPairKernel<Type>( t, r ) ) );
+
+      if( !isDivisor( ts[1] ) ) {
+         xtmp += alpha * py;
+         break;
+      }
+
+      omega = ts[0] / ts[1];
+
+      const StaticVector<Type,2UL> dots(
+         smpFused( FusedBiCGSTABUpdateKernel<Type>( xtmp, r, py, sz, t, rhat, alpha, omega ) ) );
+
+      rhoOld   = rho;
+      rho      = dots[0];
+      residual = sqrt( real( dots[1] ) );
+
+      if( !isDivisor( rho ) || !isDivisor( omega ) )
+         break;
+   }
+
+   ~x = xtmp;
+
+   result.residual  = residual / bnorm;
+   result.converged = ( residual <= threshold );
+
+   return result;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,466 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/CG.h
+//  \brief Header file for the conjugate gradient solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_CG_H_
+#define _BLAZE_MATH_SOLVERS_CG_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/smp/Fused.h>
+#include <blaze/math/solvers/FusedKernels.h>
+#include <blaze/math/solvers/LinearOperator.h>
+#include <blaze/math/solvers/Preconditioners.h>
+#include <blaze/math/solvers/SolverControl.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CG AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the weights of the fused CG update kernel for the given preconditioner.
+// \ingroup solvers
+//
+// \param M The preconditioner.
+// \param n The size of the system.
+// \return \c nullptr.
+*/
+template< typename Type    // Data type of the vector elements
+        , typename PT >    // Type of the preconditioner
+inline const Type* cgWeights( const PT& M, size_t n ) noexcept
+{
+   UNUSED_PARAMETER( M, n );
+
+   return nullptr;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the weights of the fused CG update kernel for the given Jacobi preconditioner.
+// \ingroup solvers
+//
+// \param M The Jacobi preconditioner.
+// \param n The size of the system.
+// \return The inverse diagonal elements of the system matrix.
+// \exception std::invalid_argument Invalid preconditioner size.
+*/
+template< typename Type >  // Data type of the vector elements
+inline const Type* cgWeights( const JacobiPreconditioner<Type>& M, size_t n )
+{
+   if( M.size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid preconditioner size" );
+   }
+
+   return M.inverseDiagonal().data();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the inner product of the residual and the preconditioned residual for the
+//        identity preconditioner.
+// \ingroup solvers
+//
+// \param M The identity preconditioner.
+// \param r The residual.
+// \param z The preconditioned residual (unused).
+// \param norms The squared norm and the weighted squared norm of the residual.
+// \return The squared norm of the residual.
+*/
+template< typename Type >  // Data type of the vector elements
+inline Type cgPrecondition( const IdentityPreconditioner& M, const DynamicVector<Type>& r,
+                            DynamicVector<Type>& z, const StaticVector<Type,2UL>& norms )
+{
+   UNUSED_PARAMETER( M, r, z );
+
+   return norms[0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the inner product of the residual and the preconditioned residual for the
+//        Jacobi preconditioner.
+// \ingroup solvers
+//
+// \param M The Jacobi preconditioner.
+// \param r The residual.
+// \param z The preconditioned residual (unused).
+// \param norms The squared norm and the weighted squared norm of the residual.
+// \return The weighted squared norm of the residual.
+//
+// The inner product has already been computed by the fused update kernel, i.e. the Jacobi
+// preconditioner is never applied explicitly.
+*/
+template< typename Type >  // Data type of the vector elements
+inline Type cgPrecondition( const JacobiPreconditioner<Type>& M, const DynamicVector<Type>& r,
+                            DynamicVector<Type>& z, const StaticVector<Type,2UL>& norms )
+{
+   UNUSED_PARAMETER( M, r, z );
+
+   return norms[1];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given preconditioner to the residual and computes the inner product of the
+//        residual and the preconditioned residual.
+// \ingroup solvers
+//
+// \param M The preconditioner.
+// \param r The residual.
+// \param z The target vector for the preconditioned residual.
+// \param norms The squared norm and the weighted squared norm of the residual (unused).
+// \return The inner product \f$ r^H \cdot z \f$.
+*/
+template< typename PT      // Type of the preconditioner
+        , typename Type >  // Data type of the vector elements
+inline Type cgPrecondition( const PT& M, const DynamicVector<Type>& r,
+                            DynamicVector<Type>& z, const StaticVector<Type,2UL>& norms )
+{
+   UNUSED_PARAMETER( norms );
+
+   applyPreconditioner( M, r, z );
+   return smpFused( FusedDotKernel<Type>( r, z ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Updates the search direction of the CG method for the identity preconditioner.
+// \ingroup solvers
+//
+// \param M The identity preconditioner.
+// \param p The search direction.
+// \param r The residual.
+// \param z The preconditioned residual (unused).
+// \param beta The scaling factor of the previous search direction.
+// \return void
+*/
+template< typename Type >  // Data type of the vector elements
+inline void cgUpdateDirection( const IdentityPreconditioner& M, DynamicVector<Type>& p,
+                               const DynamicVector<Type>& r, const DynamicVector<Type>& z, Type beta )
+{
+   UNUSED_PARAMETER( M, z );
+
+   p = r + beta * p;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Updates the search direction of the CG method for the Jacobi preconditioner.
+// \ingroup solvers
+//
+// \param M The Jacobi preconditioner.
+// \param p The search direction.
+// \param r The residual.
+// \param z The preconditioned residual (unused).
+// \param beta The scaling factor of the previous search direction.
+// \return void
+//
+// The preconditioned residual is computed on the fly, i.e. it is never stored.
+*/
+template< typename Type >  // Data type of the vector elements
+inline void cgUpdateDirection( const JacobiPreconditioner<Type>& M, DynamicVector<Type>& p,
+                               const DynamicVector<Type>& r, const DynamicVector<Type>& z, Type beta )
+{
+   UNUSED_PARAMETER( z );
+
+   p = M.inverseDiagonal() * r + beta * p;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Updates the search direction of the CG method for the given preconditioner.
+// \ingroup solvers
+//
+// \param M The preconditioner.
+// \param p The search direction.
+// \param r The residual (unused).
+// \param z The preconditioned residual.
+// \param beta The scaling factor of the previous search direction.
+// \return void
+*/
+template< typename PT      // Type of the preconditioner
+        , typename Type >  // Data type of the vector elements
+inline void cgUpdateDirection( const PT& M, DynamicVector<Type>& p,
+                               const DynamicVector<Type>& r, const DynamicVector<Type>& z, Type beta )
+{
+   UNUSED_PARAMETER( M, r );
+
+   p = z + beta * p;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CG FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CG functions */
+//@{
+template< typename OP, typename VT1, typename VT2 >
+SolverResult cg( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                 const SolverControl& control = SolverControl() );
+
+template< typename OP, typename VT1, typename VT2, typename PT >
+SolverResult cg( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                 const PT& M, const SolverControl& control = SolverControl() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given symmetric/Hermitian positive definite linear system of equations via
+//        the conjugate gradient method.
+// \ingroup solvers
+//
+// \param A The system matrix or matrix-free operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \param control The stopping criteria.
+// \return The number of iterations, the final relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system of equations \f$ A \cdot x = b \f$ for a symmetric
+// (or Hermitian) positive definite system matrix \a A by means of the conjugate gradient (CG)
+// method without preconditioning. See the preconditioned version of cg() for details.
+*/
+template< typename OP    // Type of the system matrix or matrix-free operator
+        , typename VT1   // Type of the solution vector
+        , typename VT2 > // Type of the right-hand side vector
+SolverResult cg( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                 const SolverControl& control )
+{
+   return cg( A, x, b, IdentityPreconditioner(), control );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given symmetric/Hermitian positive definite linear system of equations via
+//        the preconditioned conjugate gradient method.
+// \ingroup solvers
+//
+// \param A The system matrix or matrix-free operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \param M The preconditioner.
+// \param control The stopping criteria.
+// \return The number of iterations, the final relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::invalid_argument Invalid preconditioner size.
+//
+// This function solves the linear system of equations \f$ A \cdot x = b \f$ for a symmetric
+// (or Hermitian) positive definite system matrix \a A by means of the preconditioned conjugate
+// gradient (CG) method. The given vector \a x is used as initial guess and is overwritten with
+// the solution. The iteration stops as soon as the norm of the residual drops below the relative
+// tolerance of the given \a control times the norm of \a b or in case the maximum number of
+// iterations has been reached.
+//
+// The system matrix \a A can be any square dense or sparse matrix, including the symmetric,
+// Hermitian and triangular adaptors and views. Alternatively, \a A can be a matrix-free operator
+// that provides a function call operator \c A( x, y ) computing \f$ y = A \cdot x \f$ for two
+// dense column vectors of type DynamicVector (the target vector must not be resized):
+
+   \code
+   struct Laplace1D {
+      void operator()( const blaze::DynamicVector<double>& x, blaze::DynamicVector<double>& y ) const {
+         const size_t n( x.size() );
+         for( size_t i=0UL; i<n; ++i )
+            y[i] = 2.0*x[i] - ( i > 0UL ? x[i-1UL] : 0.0 ) - ( i+1UL < n ? x[i+1UL] : 0.0 );
+      }
+   };
+
+   blaze::DynamicVector<double> x( 1000UL, 0.0 ), b( 1000UL, 1.0 );
+   blaze::cg( Laplace1D(), x, b );
+   \endcode
+
+// The preconditioner \a M must provide a function call operator \c M( r, z ) computing
+// \f$ z = M^{-1} \cdot r \f$ (see for instance the IdentityPreconditioner and the
+// JacobiPreconditioner classes).
+//
+// Per iteration the algorithm performs a single multiplication with the system matrix and
+// two passes over the vectors. The vector updates of the solution and the residual are fused
+// with the following inner products into a single vectorized and (if enabled) parallel pass.
+// In case of a Jacobi preconditioner, the preconditioner is applied within the same pass. In
+// case of a row-major sparse system matrix, the inner product of the search direction with the
+// matrix/vector product is computed while the product is computed. The second pass is the
+// update of the search direction, which is performed by the vectorized and parallel vector
+// assignment. The element type of \a x determines the precision of all computations and has
+// to be \c float, \c double, \c complex<float> or \c complex<double>.
+//
+// Note that in contrast to the direct solvers this function does not throw an exception in
+// case of a failure. Instead the returned SolverResult indicates whether the iteration has
+// converged:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Initialization
+
+   const blaze::SolverResult result( blaze::cg( A, x, b, blaze::JacobiPreconditioner<double>( A ) ) );
+   \endcode
+*/
+template< typename OP    // Type of the system matrix or matrix-free operator
+        , typename VT1   // Type of the solution vector
+        , typename VT2   // Type of the right-hand side vector
+        , typename PT >  // Type of the preconditioner
+SolverResult cg( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                 const PT& M, const SolverControl& control )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using Type = ElementType_<VT1>;
+   using UT   = UnderlyingBuiltin_<Type>;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   const size_t n( (~b).size() );
+
+   if( (~x).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   checkOperator( A, n );
+
+   const Type* const w( cgWeights<Type>( M, n ) );
+   const size_t maxIterations( ( control.maxIterations != 0UL )?( control.maxIterations ):( n ) );
+
+   SolverResult result;
+
+   DynamicVector<Type> r( ~b );
+
+   const UT bnorm( sqrt( real( smpFused( FusedDotKernel<Type>( r, r ) ) ) ) );
+
+   if( bnorm == UT(0) ) {
+      reset( ~x );
+      result.converged = true;
+      return result;
+   }
+
+   DynamicVector<Type> xtmp( ~x ), p( n, Type() ), q( n ), z;
+
+   applyOperator( A, xtmp, q );
+   r -= q;
+
+   StaticVector<Type,2UL> norms( smpFused( FusedNormKernel<Type>( r, w ) ) );
+
+   const UT threshold( UT( control.tolerance ) * bnorm );
+   UT residual( sqrt( real( norms[0] ) ) );
+   Type rz( cgPrecondition( M, r, z, norms ) );
+
+   cgUpdateDirection( M, p, r, z, Type(0) );
+
+   while( residual > threshold && result.iterations < maxIterations )
+   {
+      const Type pq( applyOperatorDot( A, p, q, p ) );
+
+      if( !isDivisor( pq ) )
+         break;
+
+      norms = smpFused( FusedCGUpdateKernel<Type>( xtmp, r, p, q, rz / pq, w ) );
+      residual = sqrt( real( norms[0] ) );
+      ++result.iterations;
+
+      if( residual <= threshold )
+         break;
+
+      const Type rzNew( cgPrecondition( M, r, z, norms ) );
+      cgUpdateDirection( M, p, r, z, rzNew / rz );
+      rz = rzNew;
+   }
+
+   ~x = xtmp;
+
+   result.residual  = residual / bnorm;
+   result.converged = ( residual <= threshold );
+
+   return result;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,661 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/DualMult.h
+//  \brief Header file for the fused dual matrix/vector multiplication
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_DUALMULT_H_
+#define _BLAZE_MATH_SOLVERS_DUALMULT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/BatchPack.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/smp/Fused.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DENSEDUALMULTKERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused kernel for the dual multiplication of a dense matrix with two dense vectors.
+// \ingroup solvers
+//
+// The DenseDualMultKernel class template traverses the rows (row-major) or columns (column-major)
+// of a dense matrix exactly once. For every row/column \f$ a_k \f$ it computes the inner product
+// \f$ a_k \cdot d \f$ and at the same time adds \f$ a_k \cdot s_k \f$ to the result of the other
+// product. The inner products are stored directly in the target vector, the updates are
+// accumulated in a separate vector per range of rows/columns, which is returned and combined by
+// the smpFused() function. Two rows/columns are processed at a time such that every loaded
+// element of \a d and of the accumulator is used twice. In case padding is enabled, the SIMD
+// loops include the padding elements, which are zero in both the matrix and the vectors.
+*/
+template< typename Type >  // Data type of the elements
+struct DenseDualMultKernel
+{
+   //**Type definitions****************************************************************************
+   using ResultType = DynamicVector<Type>;  //!< Result type of the kernel.
+   using PackType   = BatchPack<Type>;      //!< Type of a pack of elements.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! The granularity of the ranges of rows/columns.
+   enum : size_t { granularity = 1UL };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation flag for the SIMD loop over the rows/columns.
+   /*! Without padding the rows/columns of a matrix are not guaranteed to be aligned. In this case
+       the SIMD loop is skipped. */
+   enum : bool { simd = usePadding || PackType::size == 1UL };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DenseDualMultKernel class template.
+   //
+   // \param A The first element of the dense matrix.
+   // \param spacing The spacing between two rows/columns of the dense matrix.
+   // \param major The number of rows (row-major) or columns (column-major) of the matrix.
+   // \param d The vector of the inner products.
+   // \param s The vector of the scaling factors of the accumulated rows/columns.
+   // \param out The target vector of the inner products.
+   // \param parallel \a true in case the kernel should be evaluated in parallel.
+   */
+   explicit inline DenseDualMultKernel( const Type* A, size_t spacing, size_t major,
+                                        const DynamicVector<Type>& d, const DynamicVector<Type>& s,
+                                        DynamicVector<Type>& out, bool parallel ) noexcept
+      : A_       ( A          )  // The first element of the dense matrix
+      , spacing_ ( spacing    )  // The spacing between two rows/columns
+      , major_   ( major      )  // The number of rows/columns
+      , minor_   ( d.size()   )  // The number of elements per row/column
+      , d_       ( d.data()   )  // The vector of the inner products
+      , s_       ( s.data()   )  // The vector of the scaling factors
+      , out_     ( out.data() )  // The target vector of the inner products
+      , parallel_( parallel   )  // Flag for the parallel evaluation
+   {
+      BLAZE_INTERNAL_ASSERT( s.size()   == major, "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( out.size() == major, "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( !simd || d.capacity() >= simdEnd(), "Invalid vector capacity" );
+      BLAZE_INTERNAL_ASSERT( !simd || spacing >= simdEnd(), "Invalid matrix spacing" );
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the number of rows/columns processed by the kernel.
+   //
+   // \return The number of rows (row-major) or columns (column-major) of the matrix.
+   */
+   inline size_t size() const noexcept {
+      return major_;
+   }
+
+   /*!\brief Returns whether the kernel can be evaluated in parallel.
+   //
+   // \return \a true in case the kernel can be evaluated in parallel, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return parallel_;
+   }
+
+   /*!\brief Returns the end of the SIMD loop over the elements of a row/column.
+   //
+   // \return The index one past the last element of the SIMD loop.
+   */
+   inline size_t simdEnd() const noexcept {
+      return ( usePadding )?( nextMultiple<size_t>( minor_, PackType::size ) )
+                           :( ( simd )?( minor_ ):( 0UL ) );
+   }
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the given range of rows/columns of both products.
+   //
+   // \param begin The index of the first row/column of the range.
+   // \param end The index one past the last row/column of the range.
+   // \return The partial result of the accumulated product.
+   */
+   inline ResultType operator()( size_t begin, size_t end ) const
+   {
+      const size_t jpos( simdEnd() );
+
+      ResultType acc( minor_, Type() );
+      Type* a( acc.data() );
+
+      size_t k( begin );
+
+      for( ; (k+2UL) <= end; k+=2UL )
+      {
+         const Type* a1( A_ + k*spacing_ );
+         const Type* a2( a1 + spacing_ );
+         const PackType s1( PackType::set( s_[k    ] ) );
+         const PackType s2( PackType::set( s_[k+1UL] ) );
+
+         PackType xmm1, xmm2;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=PackType::size ) {
+            const PackType d ( PackType::load( d_+j ) );
+            const PackType v1( PackType::load( a1+j ) );
+            const PackType v2( PackType::load( a2+j ) );
+            xmm1 += v1 * d;
+            xmm2 += v2 * d;
+            PackType::store( a+j, PackType::load( a+j ) + v1 * s1 + v2 * s2 );
+         }
+
+         Type tmp1( sum( xmm1 ) );
+         Type tmp2( sum( xmm2 ) );
+
+         for( ; j<minor_; ++j ) {
+            tmp1 += a1[j] * d_[j];
+            tmp2 += a2[j] * d_[j];
+            a[j] += a1[j] * s_[k] + a2[j] * s_[k+1UL];
+         }
+
+         out_[k    ] = tmp1;
+         out_[k+1UL] = tmp2;
+      }
+
+      if( k < end )
+      {
+         const Type* a1( A_ + k*spacing_ );
+         const PackType s1( PackType::set( s_[k] ) );
+
+         PackType xmm1;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=PackType::size ) {
+            const PackType v1( PackType::load( a1+j ) );
+            xmm1 += v1 * PackType::load( d_+j );
+            PackType::store( a+j, PackType::load( a+j ) + v1 * s1 );
+         }
+
+         Type tmp1( sum( xmm1 ) );
+
+         for( ; j<minor_; ++j ) {
+            tmp1 += a1[j] * d_[j];
+            a[j] += a1[j] * s_[k];
+         }
+
+         out_[k] = tmp1;
+      }
+
+      return acc;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const Type* A_;         //!< The first element of the dense matrix.
+   size_t      spacing_;   //!< The spacing between two rows/columns of the dense matrix.
+   size_t      major_;     //!< The number of rows/columns of the matrix.
+   size_t      minor_;     //!< The number of elements per row/column.
+   const Type* d_;         //!< The vector of the inner products.
+   const Type* s_;         //!< The vector of the scaling factors.
+   Type*       out_;       //!< The target vector of the inner products.
+   bool        parallel_;  //!< Flag for the parallel evaluation.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SPARSEDUALMULTKERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused kernel for the dual multiplication of a sparse matrix with two dense vectors.
+// \ingroup solvers
+//
+// The SparseDualMultKernel class template traverses the non-zero elements of each row (row-major)
+// or column (column-major) of a compressed matrix exactly once. Every non-zero element enters
+// both the inner product of its row/column with \a d and the accumulated update of the other
+// product. As in case of the DenseDualMultKernel, the updates are accumulated in a separate
+// vector per range of rows/columns.
+*/
+template< typename MT      // Type of the sparse matrix
+        , typename Type >  // Data type of the elements
+struct SparseDualMultKernel
+{
+   //**Type definitions****************************************************************************
+   using ResultType = DynamicVector<Type>;  //!< Result type of the kernel.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! The granularity of the ranges of rows/columns.
+   enum : size_t { granularity = 1UL };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SparseDualMultKernel class template.
+   //
+   // \param A The sparse matrix.
+   // \param major The number of rows (row-major) or columns (column-major) of the matrix.
+   // \param d The vector of the inner products.
+   // \param s The vector of the scaling factors of the accumulated rows/columns.
+   // \param out The target vector of the inner products.
+   // \param parallel \a true in case the kernel should be evaluated in parallel.
+   */
+   explicit inline SparseDualMultKernel( const MT& A, size_t major,
+                                         const DynamicVector<Type>& d, const DynamicVector<Type>& s,
+                                         DynamicVector<Type>& out, bool parallel ) noexcept
+      : A_       ( A          )  // The sparse matrix
+      , major_   ( major      )  // The number of rows/columns
+      , minor_   ( d.size()   )  // The number of elements per row/column
+      , d_       ( d.data()   )  // The vector of the inner products
+      , s_       ( s.data()   )  // The vector of the scaling factors
+      , out_     ( out.data() )  // The target vector of the inner products
+      , parallel_( parallel   )  // Flag for the parallel evaluation
+   {
+      BLAZE_INTERNAL_ASSERT( s.size()   == major, "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( out.size() == major, "Invalid vector size" );
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the number of rows/columns processed by the kernel.
+   //
+   // \return The number of rows (row-major) or columns (column-major) of the matrix.
+   */
+   inline size_t size() const noexcept {
+      return major_;
+   }
+
+   /*!\brief Returns whether the kernel can be evaluated in parallel.
+   //
+   // \return \a true in case the kernel can be evaluated in parallel, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return parallel_;
+   }
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the given range of rows/columns of both products.
+   //
+   // \param begin The index of the first row/column of the range.
+   // \param end The index one past the last row/column of the range.
+   // \return The partial result of the accumulated product.
+   */
+   inline ResultType operator()( size_t begin, size_t end ) const
+   {
+      ResultType acc( minor_, Type() );
+      Type* a( acc.data() );
+
+      for( size_t k=begin; k<end; ++k )
+      {
+         const Type s( s_[k] );
+         Type tmp{};
+
+         const ConstIterator_<MT> last( A_.end(k) );
+         for( ConstIterator_<MT> element=A_.begin(k); element!=last; ++element ) {
+            const size_t j( element->index() );
+            tmp  += element->value() * d_[j];
+            a[j] += element->value() * s;
+         }
+
+         out_[k] = tmp;
+      }
+
+      return acc;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const MT&   A_;         //!< The sparse matrix.
+   size_t      major_;     //!< The number of rows/columns of the matrix.
+   size_t      minor_;     //!< The number of elements per row/column.
+   const Type* d_;         //!< The vector of the inner products.
+   const Type* s_;         //!< The vector of the scaling factors.
+   Type*       out_;       //!< The target vector of the inner products.
+   bool        parallel_;  //!< Flag for the parallel evaluation.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Provides the given operand of a dual multiplication as DynamicVector.
+// \ingroup solvers
+//
+// \param v The operand of the dual multiplication.
+// \param tmp Temporary vector (unused).
+// \return Reference to the operand.
+*/
+template< typename Type >  // Data type of the elements
+inline const DynamicVector<Type>&
+   dualMultOperand( const DynamicVector<Type,false>& v, DynamicVector<Type>& tmp ) noexcept
+{
+   UNUSED_PARAMETER( tmp );
+   return v;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Provides the given operand of a dual multiplication as DynamicVector.
+// \ingroup solvers
+//
+// \param v The operand of the dual multiplication.
+// \param tmp Temporary vector for the evaluation of the operand.
+// \return Reference to the evaluated operand.
+*/
+template< typename VT      // Type of the operand
+        , typename Type >  // Data type of the elements
+inline const DynamicVector<Type>&
+   dualMultOperand( const DenseVector<VT,false>& v, DynamicVector<Type>& tmp )
+{
+   tmp = ~v;
+   return tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Moves the result of a dual multiplication into the given target vector.
+// \ingroup solvers
+//
+// \param v The target vector.
+// \param tmp The result of the dual multiplication.
+// \return void
+*/
+template< typename Type >  // Data type of the elements
+inline void dualMultResult( DynamicVector<Type,false>& v, DynamicVector<Type>& tmp ) noexcept
+{
+   swap( v, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assigns the result of a dual multiplication to the given target vector.
+// \ingroup solvers
+//
+// \param v The target vector.
+// \param tmp The result of the dual multiplication.
+// \return void
+*/
+template< typename VT      // Type of the target vector
+        , typename Type >  // Data type of the elements
+inline void dualMultResult( DenseVector<VT,false>& v, DynamicVector<Type>& tmp )
+{
+   ~v = tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DUAL MULTIPLICATION BACKENDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the dual multiplication for general matrices.
+// \ingroup solvers
+//
+// \param A The matrix.
+// \param x The right-hand side vector of the multiplication \f$ A \cdot x \f$.
+// \param w The right-hand side vector of the multiplication \f$ A^T \cdot w \f$.
+// \param y The target vector for \f$ A \cdot x \f$.
+// \param z The target vector for \f$ A^T \cdot w \f$.
+// \return void
+//
+// This backend computes both products separately via the according expression templates.
+*/
+template< typename MT     // Type of the matrix
+        , typename VT1    // Type of the right-hand side vector of A*x
+        , typename VT2    // Type of the right-hand side vector of trans(A)*w
+        , typename VT3    // Type of the target vector of A*x
+        , typename VT4 >  // Type of the target vector of trans(A)*w
+inline void multiplyBoth_backend( const MT& A, const VT1& x, const VT2& w, VT3& y, VT4& z )
+{
+   const DynamicVector< MultTrait_< ElementType_<MT>, ElementType_<VT1> > > ytmp( A * x );
+   const DynamicVector< MultTrait_< ElementType_<MT>, ElementType_<VT2> > > ztmp( trans( A ) * w );
+
+   y = ytmp;
+   z = ztmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the fused dual multiplication for dense matrices.
+// \ingroup solvers
+//
+// \param A The dense matrix.
+// \param x The right-hand side vector of the multiplication \f$ A \cdot x \f$.
+// \param w The right-hand side vector of the multiplication \f$ A^T \cdot w \f$.
+// \param y The target vector for \f$ A \cdot x \f$.
+// \param z The target vector for \f$ A^T \cdot w \f$.
+// \return void
+*/
+template< typename Type   // Data type of the matrix elements
+        , bool SO         // Storage order of the dense matrix
+        , typename VT1    // Type of the right-hand side vector of A*x
+        , typename VT2    // Type of the right-hand side vector of trans(A)*w
+        , typename VT3    // Type of the target vector of A*x
+        , typename VT4 >  // Type of the target vector of trans(A)*w
+inline EnableIf_< And< IsSame< ElementType_<VT1>, Type >, IsSame< ElementType_<VT2>, Type > > >
+   multiplyBoth_backend( const DynamicMatrix<Type,SO>& A, const VT1& x, const VT2& w, VT3& y, VT4& z )
+{
+   DynamicVector<Type> xtmp, wtmp;
+   const DynamicVector<Type>& xref( dualMultOperand( x, xtmp ) );
+   const DynamicVector<Type>& wref( dualMultOperand( w, wtmp ) );
+
+   DynamicVector<Type> ytmp, ztmp;
+
+   if( SO == rowMajor ) {
+      ytmp.resize( A.rows(), false );
+      const DenseDualMultKernel<Type> kernel( A.data(), A.spacing(), A.rows(), xref, wref, ytmp,
+                                              A.rows() >= SMP_DMATDVECMULT_THRESHOLD );
+      ztmp = smpFused( kernel );
+   }
+   else {
+      ztmp.resize( A.columns(), false );
+      const DenseDualMultKernel<Type> kernel( A.data(), A.spacing(), A.columns(), wref, xref, ztmp,
+                                              A.rows() >= SMP_TDMATDVECMULT_THRESHOLD );
+      ytmp = smpFused( kernel );
+   }
+
+   dualMultResult( y, ytmp );
+   dualMultResult( z, ztmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the fused dual multiplication for sparse matrices.
+// \ingroup solvers
+//
+// \param A The sparse matrix.
+// \param x The right-hand side vector of the multiplication \f$ A \cdot x \f$.
+// \param w The right-hand side vector of the multiplication \f$ A^T \cdot w \f$.
+// \param y The target vector for \f$ A \cdot x \f$.
+// \param z The target vector for \f$ A^T \cdot w \f$.
+// \return void
+*/
+template< typename Type   // Data type of the matrix elements
+        , bool SO         // Storage order of the sparse matrix
+        , typename VT1    // Type of the right-hand side vector of A*x
+        , typename VT2    // Type of the right-hand side vector of trans(A)*w
+        , typename VT3    // Type of the target vector of A*x
+        , typename VT4 >  // Type of the target vector of trans(A)*w
+inline EnableIf_< And< IsSame< ElementType_<VT1>, Type >, IsSame< ElementType_<VT2>, Type > > >
+   multiplyBoth_backend( const CompressedMatrix<Type,SO>& A, const VT1& x, const VT2& w, VT3& y, VT4& z )
+{
+   using KT = SparseDualMultKernel< CompressedMatrix<Type,SO>, Type >;
+
+   DynamicVector<Type> xtmp, wtmp;
+   const DynamicVector<Type>& xref( dualMultOperand( x, xtmp ) );
+   const DynamicVector<Type>& wref( dualMultOperand( w, wtmp ) );
+
+   DynamicVector<Type> ytmp, ztmp;
+
+   if( SO == rowMajor ) {
+      ytmp.resize( A.rows(), false );
+      const KT kernel( A, A.rows(), xref, wref, ytmp, A.rows() >= SMP_SMATDVECMULT_THRESHOLD );
+      ztmp = smpFused( kernel );
+   }
+   else {
+      ztmp.resize( A.columns(), false );
+      const KT kernel( A, A.columns(), wref, xref, ztmp, A.rows() >= SMP_TSMATDVECMULT_THRESHOLD );
+      ytmp = smpFused( kernel );
+   }
+
+   dualMultResult( y, ytmp );
+   dualMultResult( z, ztmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DUAL MULTIPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the two matrix/vector products \f$ y = A \cdot x \f$ and \f$ z = A^T \cdot w \f$.
+// \ingroup solvers
+//
+// \param A The matrix.
+// \param x The right-hand side vector of the multiplication \f$ A \cdot x \f$.
+// \param w The right-hand side vector of the multiplication \f$ A^T \cdot w \f$.
+// \param y The target vector for \f$ A \cdot x \f$.
+// \param z The target vector for \f$ A^T \cdot w \f$.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes both the product of the given matrix with \a x and the product of the
+// transpose of the matrix with \a w, as for instance required in every iteration of the BiCG
+// and QMR methods or of the Lanczos bidiagonalization:
+
+   \code
+   blaze::CompressedMatrix<double> A( 1000UL, 800UL );
+   blaze::DynamicVector<double> x( 800UL ), w( 1000UL ), y, z;
+   // ... Initialization
+
+   multiplyBoth( A, x, w, y, z );  // Equivalent to y = A * x; z = trans( A ) * w;
+   \endcode
+
+// In case \a A is a DynamicMatrix or a CompressedMatrix with the same element type as \a x and
+// \a w, both products are computed in a single traversal of the matrix, i.e. the matrix is read
+// from memory only once instead of twice. Each row (row-major) or column (column-major) of the
+// matrix is used for an inner product of one product and as update of the other product. The
+// updates are accumulated in a separate vector per thread, which are combined in order at the
+// end. Therefore the result does not depend on the number of threads. For all other matrices,
+// the two products are computed separately.
+//
+// The target vectors \a y and \a z may be identical to \a x or \a w. In case the sizes of the
+// matrix and the vectors don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT     // Type of the matrix
+        , bool SO         // Storage order of the matrix
+        , typename VT1    // Type of the right-hand side vector of A*x
+        , typename VT2    // Type of the right-hand side vector of trans(A)*w
+        , typename VT3    // Type of the target vector of A*x
+        , typename VT4 >  // Type of the target vector of trans(A)*w
+inline void multiplyBoth( const Matrix<MT,SO>& A, const DenseVector<VT1,false>& x,
+                          const DenseVector<VT2,false>& w, DenseVector<VT3,false>& y,
+                          DenseVector<VT4,false>& z )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~A).columns() != (~x).size() || (~A).rows() != (~w).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   multiplyBoth_backend( ~A, ~x, ~w, ~y, ~z );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
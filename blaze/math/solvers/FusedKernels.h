@@ -0,0 +1,690 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/FusedKernels.h
+//  \brief Header file for the fused vector kernels of the iterative solvers
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_FUSEDKERNELS_H_
+#define _BLAZE_MATH_SOLVERS_FUSEDKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/BatchPack.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS FUSEDKERNELBASE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Base class for the fused vector kernels of the iterative solvers.
+// \ingroup solvers
+//
+// The fused vector kernels combine the vector updates of an iteration of a Krylov solver with
+// the subsequent inner products into a single pass over the involved vectors. All kernels work
+// on the raw, aligned data of dense vectors of type DynamicVector and are evaluated by the
+// smpFused() function, which splits the elements into one range per thread and combines the
+// partial results of the ranges in order. The FusedKernelBase class template provides the
+// common size and granularity information of all kernels. In case the vectors are padded, the
+// padding elements are processed as well. Since they are zero, they affect neither the vector
+// updates nor the inner products.
+*/
+template< typename Type >  // Data type of the elements
+struct FusedKernelBase
+{
+   //**Type definitions****************************************************************************
+   using PackType = BatchPack<Type>;  //!< Type of a pack of elements.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! The granularity of the ranges of elements.
+   enum : size_t { granularity = PackType::size };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedKernelBase class template.
+   //
+   // \param v One of the vectors processed by the kernel.
+   */
+   explicit inline FusedKernelBase( const DynamicVector<Type>& v ) noexcept
+      : size_( ( usePadding )?( nextMultiple<size_t>( v.size(), granularity ) ):( v.size() ) )
+   {
+      BLAZE_INTERNAL_ASSERT( v.capacity() >= size_, "Invalid vector capacity detected" );
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the number of elements processed by the kernel.
+   //
+   // \return The number of elements including the padding elements.
+   */
+   inline size_t size() const noexcept {
+      return size_;
+   }
+
+   /*!\brief Returns whether the kernel can be evaluated in parallel.
+   //
+   // \return \a true in case the kernel can be evaluated in parallel, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return size_ >= SMP_DVECREDUCE_THRESHOLD;
+   }
+
+   /*!\brief Returns the end of the SIMD loop for the given range of elements.
+   //
+   // \param begin The index of the first element of the range.
+   // \param end The index one past the last element of the range.
+   // \return The index one past the last element of the SIMD loop.
+   */
+   static BLAZE_ALWAYS_INLINE size_t simdEnd( size_t begin, size_t end ) noexcept {
+      return end - ( end - begin ) % granularity;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   size_t size_;  //!< The number of elements processed by the kernel.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS FUSEDDOTKERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused kernel for the inner product \f$ a^H \cdot b \f$.
+// \ingroup solvers
+*/
+template< typename Type >  // Data type of the elements
+struct FusedDotKernel : public FusedKernelBase<Type>
+{
+   //**Type definitions****************************************************************************
+   using ResultType = Type;                                      //!< Result type of the kernel.
+   using PackType   = typename FusedKernelBase<Type>::PackType;  //!< Type of a pack of elements.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedDotKernel class template.
+   //
+   // \param a The left-hand side vector of the inner product.
+   // \param b The right-hand side vector of the inner product.
+   */
+   explicit inline FusedDotKernel( const DynamicVector<Type>& a, const DynamicVector<Type>& b ) noexcept
+      : FusedKernelBase<Type>( a )  // Initialization of the base class
+      , a_( a.data() )              // The left-hand side vector
+      , b_( b.data() )              // The right-hand side vector
+   {
+      BLAZE_INTERNAL_ASSERT( a.size() == b.size(), "Invalid vector sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the partial inner product of the given range of elements.
+   //
+   // \param begin The index of the first element of the range.
+   // \param end The index one past the last element of the range.
+   // \return The partial inner product.
+   */
+   inline ResultType operator()( size_t begin, size_t end ) const
+   {
+      const size_t ipos( this->simdEnd( begin, end ) );
+
+      PackType xmm;
+      size_t i( begin );
+
+      for( ; i<ipos; i+=PackType::size ) {
+         xmm += conj( PackType::load( a_+i ) ) * PackType::load( b_+i );
+      }
+
+      Type dot( sum( xmm ) );
+
+      for( ; i<end; ++i ) {
+         dot += conj( a_[i] ) * b_[i];
+      }
+
+      return dot;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const Type* a_;  //!< The left-hand side vector.
+   const Type* b_;  //!< The right-hand side vector.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS FUSEDDOTPAIRKERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused kernel for the two inner products \f$ a^H \cdot b \f$ and \f$ a^H \cdot a \f$.
+// \ingroup solvers
+*/
+template< typename Type >  // Data type of the elements
+struct FusedDotPairKernel : public FusedKernelBase<Type>
+{
+   //**Type definitions****************************************************************************
+   using ResultType = StaticVector<Type,2UL>;                    //!< Result type of the kernel.
+   using PackType   = typename FusedKernelBase<Type>::PackType;  //!< Type of a pack of elements.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedDotPairKernel class template.
+   //
+   // \param a The left-hand side vector of both inner products.
+   // \param b The right-hand side vector of the first inner product.
+   */
+   explicit inline FusedDotPairKernel( const DynamicVector<Type>& a, const DynamicVector<Type>& b ) noexcept
+      : FusedKernelBase<Type>( a )  // Initialization of the base class
+      , a_( a.data() )              // The left-hand side vector of both inner products
+      , b_( b.data() )              // The right-hand side vector of the first inner product
+   {
+      BLAZE_INTERNAL_ASSERT( a.size() == b.size(), "Invalid vector sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the partial inner products of the given range of elements.
+   //
+   // \param begin The index of the first element of the range.
+   // \param end The index one past the last element of the range.
+   // \return The partial inner products \f$ a^H \cdot b \f$ and \f$ a^H \cdot a \f$.
+   */
+   inline ResultType operator()( size_t begin, size_t end ) const
+   {
+      const size_t ipos( this->simdEnd( begin, end ) );
+
+      PackType xmm1, xmm2;
+      size_t i( begin );
+
+      for( ; i<ipos; i+=PackType::size ) {
+         const PackType a( conj( PackType::load( a_+i ) ) );
+         xmm1 += a * PackType::load( b_+i );
+         xmm2 += a * PackType::load( a_+i );
+      }
+
+      ResultType dots{ sum( xmm1 ), sum( xmm2 ) };
+
+      for( ; i<end; ++i ) {
+         dots[0] += conj( a_[i] ) * b_[i];
+         dots[1] += conj( a_[i] ) * a_[i];
+      }
+
+      return dots;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const Type* a_;  //!< The left-hand side vector of both inner products.
+   const Type* b_;  //!< The right-hand side vector of the first inner product.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS FUSEDNORMKERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused kernel for the squared norm \f$ r^H \cdot r \f$ and the weighted squared norm
+//        \f$ r^H \cdot W \cdot r \f$ of a residual.
+// \ingroup solvers
+//
+// The diagonal weight matrix \f$ W \f$ is given by its diagonal elements. In case no weights
+// are given, the second result is zero.
+*/
+template< typename Type >  // Data type of the elements
+struct FusedNormKernel : public FusedKernelBase<Type>
+{
+   //**Type definitions****************************************************************************
+   using ResultType = StaticVector<Type,2UL>;                    //!< Result type of the kernel.
+   using PackType   = typename FusedKernelBase<Type>::PackType;  //!< Type of a pack of elements.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedNormKernel class template.
+   //
+   // \param r The residual vector.
+   // \param w The diagonal elements of the weight matrix (may be \c nullptr).
+   */
+   explicit inline FusedNormKernel( const DynamicVector<Type>& r, const Type* w ) noexcept
+      : FusedKernelBase<Type>( r )  // Initialization of the base class
+      , r_( r.data() )              // The residual vector
+      , w_( w )                     // The diagonal elements of the weight matrix
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the partial (weighted) squared norms of the given range of elements.
+   //
+   // \param begin The index of the first element of the range.
+   // \param end The index one past the last element of the range.
+   // \return The partial squared norm and the partial weighted squared norm.
+   */
+   inline ResultType operator()( size_t begin, size_t end ) const
+   {
+      const size_t ipos( this->simdEnd( begin, end ) );
+
+      PackType xmm1, xmm2;
+      size_t i( begin );
+
+      if( w_ != nullptr ) {
+         for( ; i<ipos; i+=PackType::size ) {
+            const PackType r( PackType::load( r_+i ) );
+            const PackType rr( conj( r ) * r );
+            xmm1 += rr;
+            xmm2 += rr * PackType::load( w_+i );
+         }
+      }
+      else {
+         for( ; i<ipos; i+=PackType::size ) {
+            const PackType r( PackType::load( r_+i ) );
+            xmm1 += conj( r ) * r;
+         }
+      }
+
+      ResultType norms{ sum( xmm1 ), sum( xmm2 ) };
+
+      for( ; i<end; ++i ) {
+         norms[0] += conj( r_[i] ) * r_[i];
+         if( w_ != nullptr )
+            norms[1] += conj( r_[i] ) * w_[i] * r_[i];
+      }
+
+      return norms;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const Type* r_;  //!< The residual vector.
+   const Type* w_;  //!< The diagonal elements of the weight matrix.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS FUSEDSUBNORMKERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused kernel for the update \f$ r = r - \alpha \cdot v \f$ and the squared norm
+//        \f$ r^H \cdot r \f$ of the updated vector.
+// \ingroup solvers
+*/
+template< typename Type >  // Data type of the elements
+struct FusedSubNormKernel : public FusedKernelBase<Type>
+{
+   //**Type definitions****************************************************************************
+   using ResultType = Type;                                      //!< Result type of the kernel.
+   using PackType   = typename FusedKernelBase<Type>::PackType;  //!< Type of a pack of elements.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedSubNormKernel class template.
+   //
+   // \param r The vector to be updated.
+   // \param v The update direction.
+   // \param alpha The scaling factor of the update direction.
+   */
+   explicit inline FusedSubNormKernel( DynamicVector<Type>& r, const DynamicVector<Type>& v, Type alpha ) noexcept
+      : FusedKernelBase<Type>( r )  // Initialization of the base class
+      , r_    ( r.data() )          // The vector to be updated
+      , v_    ( v.data() )          // The update direction
+      , alpha_( alpha    )          // The scaling factor of the update direction
+   {
+      BLAZE_INTERNAL_ASSERT( r.size() == v.size(), "Invalid vector sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Updates the given range of elements and computes their partial squared norm.
+   //
+   // \param begin The index of the first element of the range.
+   // \param end The index one past the last element of the range.
+   // \return The partial squared norm of the updated vector.
+   */
+   inline ResultType operator()( size_t begin, size_t end ) const
+   {
+      const size_t ipos( this->simdEnd( begin, end ) );
+
+      const PackType alpha( PackType::set( alpha_ ) );
+
+      PackType xmm;
+      size_t i( begin );
+
+      for( ; i<ipos; i+=PackType::size ) {
+         const PackType r( PackType::load( r_+i ) - alpha * PackType::load( v_+i ) );
+         PackType::store( r_+i, r );
+         xmm += conj( r ) * r;
+      }
+
+      Type norm( sum( xmm ) );
+
+      for( ; i<end; ++i ) {
+         r_[i] -= alpha_ * v_[i];
+         norm += conj( r_[i] ) * r_[i];
+      }
+
+      return norm;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Type*       r_;      //!< The vector to be updated.
+   const Type* v_;      //!< The update direction.
+   Type        alpha_;  //!< The scaling factor of the update direction.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS FUSEDCGUPDATEKERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused kernel for the solution and residual update of the conjugate gradient method.
+// \ingroup solvers
+//
+// The FusedCGUpdateKernel class template performs the updates \f$ x = x + \alpha \cdot p \f$ and
+// \f$ r = r - \alpha \cdot q \f$ and computes the squared norm \f$ r^H \cdot r \f$ as well as
+// the weighted squared norm \f$ r^H \cdot W \cdot r \f$ of the updated residual in a single
+// pass. The diagonal weight matrix \f$ W \f$ is the inverse diagonal of a Jacobi preconditioner.
+// In case no weights are given, the second result is zero.
+*/
+template< typename Type >  // Data type of the elements
+struct FusedCGUpdateKernel : public FusedKernelBase<Type>
+{
+   //**Type definitions****************************************************************************
+   using ResultType = StaticVector<Type,2UL>;                    //!< Result type of the kernel.
+   using PackType   = typename FusedKernelBase<Type>::PackType;  //!< Type of a pack of elements.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedCGUpdateKernel class template.
+   //
+   // \param x The solution vector.
+   // \param r The residual vector.
+   // \param p The search direction.
+   // \param q The product of the system matrix and the search direction.
+   // \param alpha The step length.
+   // \param w The diagonal elements of the weight matrix (may be \c nullptr).
+   */
+   explicit inline FusedCGUpdateKernel( DynamicVector<Type>& x, DynamicVector<Type>& r,
+                                        const DynamicVector<Type>& p, const DynamicVector<Type>& q,
+                                        Type alpha, const Type* w ) noexcept
+      : FusedKernelBase<Type>( x )  // Initialization of the base class
+      , x_    ( x.data() )          // The solution vector
+      , r_    ( r.data() )          // The residual vector
+      , p_    ( p.data() )          // The search direction
+      , q_    ( q.data() )          // The product of the system matrix and the search direction
+      , w_    ( w        )          // The diagonal elements of the weight matrix
+      , alpha_( alpha    )          // The step length
+   {
+      BLAZE_INTERNAL_ASSERT( x.size() == r.size(), "Invalid vector sizes" );
+      BLAZE_INTERNAL_ASSERT( x.size() == p.size(), "Invalid vector sizes" );
+      BLAZE_INTERNAL_ASSERT( x.size() == q.size(), "Invalid vector sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Updates the given range of elements and computes their partial squared norms.
+   //
+   // \param begin The index of the first element of the range.
+   // \param end The index one past the last element of the range.
+   // \return The partial squared norm and the partial weighted squared norm of the residual.
+   */
+   inline ResultType operator()( size_t begin, size_t end ) const
+   {
+      const size_t ipos( this->simdEnd( begin, end ) );
+
+      const PackType alpha( PackType::set( alpha_ ) );
+
+      PackType xmm1, xmm2;
+      size_t i( begin );
+
+      if( w_ != nullptr ) {
+         for( ; i<ipos; i+=PackType::size ) {
+            PackType::store( x_+i, PackType::load( x_+i ) + alpha * PackType::load( p_+i ) );
+            const PackType r( PackType::load( r_+i ) - alpha * PackType::load( q_+i ) );
+            PackType::store( r_+i, r );
+            const PackType rr( conj( r ) * r );
+            xmm1 += rr;
+            xmm2 += rr * PackType::load( w_+i );
+         }
+      }
+      else {
+         for( ; i<ipos; i+=PackType::size ) {
+            PackType::store( x_+i, PackType::load( x_+i ) + alpha * PackType::load( p_+i ) );
+            const PackType r( PackType::load( r_+i ) - alpha * PackType::load( q_+i ) );
+            PackType::store( r_+i, r );
+            xmm1 += conj( r ) * r;
+         }
+      }
+
+      ResultType norms{ sum( xmm1 ), sum( xmm2 ) };
+
+      for( ; i<end; ++i ) {
+         x_[i] += alpha_ * p_[i];
+         r_[i] -= alpha_ * q_[i];
+         norms[0] += conj( r_[i] ) * r_[i];
+         if( w_ != nullptr )
+            norms[1] += conj( r_[i] ) * w_[i] * r_[i];
+      }
+
+      return norms;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Type*       x_;      //!< The solution vector.
+   Type*       r_;      //!< The residual vector.
+   const Type* p_;      //!< The search direction.
+   const Type* q_;      //!< The product of the system matrix and the search direction.
+   const Type* w_;      //!< The diagonal elements of the weight matrix.
+   Type        alpha_;  //!< The step length.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS FUSEDBICGSTABUPDATEKERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused kernel for the solution and residual update of the BiCGSTAB method.
+// \ingroup solvers
+//
+// The FusedBiCGSTABUpdateKernel class template performs the updates
+// \f$ x = x + \alpha \cdot y + \omega \cdot z \f$ and \f$ r = r - \omega \cdot t \f$ and computes
+// the inner product \f$ \hat{r}^H \cdot r \f$ with the shadow residual as well as the squared
+// norm \f$ r^H \cdot r \f$ of the updated residual in a single pass. Note that \a z may refer
+// to the residual vector \a r itself (in case no preconditioner is used).
+*/
+template< typename Type >  // Data type of the elements
+struct FusedBiCGSTABUpdateKernel : public FusedKernelBase<Type>
+{
+   //**Type definitions****************************************************************************
+   using ResultType = StaticVector<Type,2UL>;                    //!< Result type of the kernel.
+   using PackType   = typename FusedKernelBase<Type>::PackType;  //!< Type of a pack of elements.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedBiCGSTABUpdateKernel class template.
+   //
+   // \param x The solution vector.
+   // \param r The residual vector.
+   // \param y The first update direction of the solution.
+   // \param z The second update direction of the solution.
+   // \param t The update direction of the residual.
+   // \param rhat The shadow residual.
+   // \param alpha The scaling factor of the first update direction.
+   // \param omega The scaling factor of the second update direction.
+   */
+   explicit inline FusedBiCGSTABUpdateKernel( DynamicVector<Type>& x, DynamicVector<Type>& r,
+                                              const DynamicVector<Type>& y, const DynamicVector<Type>& z,
+                                              const DynamicVector<Type>& t, const DynamicVector<Type>& rhat,
+                                              Type alpha, Type omega ) noexcept
+      : FusedKernelBase<Type>( x )  // Initialization of the base class
+      , x_    ( x.data()    )       // The solution vector
+      , r_    ( r.data()    )       // The residual vector
+      , y_    ( y.data()    )       // The first update direction of the solution
+      , z_    ( z.data()    )       // The second update direction of the solution
+      , t_    ( t.data()    )       // The update direction of the residual
+      , rhat_ ( rhat.data() )       // The shadow residual
+      , alpha_( alpha       )       // The scaling factor of the first update direction
+      , omega_( omega       )       // The scaling factor of the second update direction
+   {
+      BLAZE_INTERNAL_ASSERT( x.size() == r.size()   , "Invalid vector sizes" );
+      BLAZE_INTERNAL_ASSERT( x.size() == y.size()   , "Invalid vector sizes" );
+      BLAZE_INTERNAL_ASSERT( x.size() == z.size()   , "Invalid vector sizes" );
+      BLAZE_INTERNAL_ASSERT( x.size() == t.size()   , "Invalid vector sizes" );
+      BLAZE_INTERNAL_ASSERT( x.size() == rhat.size(), "Invalid vector sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Updates the given range of elements and computes their partial inner products.
+   //
+   // \param begin The index of the first element of the range.
+   // \param end The index one past the last element of the range.
+   // \return The partial inner product with the shadow residual and the partial squared norm.
+   */
+   inline ResultType operator()( size_t begin, size_t end ) const
+   {
+      const size_t ipos( this->simdEnd( begin, end ) );
+
+      const PackType alpha( PackType::set( alpha_ ) );
+      const PackType omega( PackType::set( omega_ ) );
+
+      PackType xmm1, xmm2;
+      size_t i( begin );
+
+      for( ; i<ipos; i+=PackType::size ) {
+         const PackType z( PackType::load( z_+i ) );
+         const PackType r( PackType::load( r_+i ) - omega * PackType::load( t_+i ) );
+         PackType::store( x_+i, PackType::load( x_+i ) + alpha * PackType::load( y_+i ) + omega * z );
+         PackType::store( r_+i, r );
+         xmm1 += conj( PackType::load( rhat_+i ) ) * r;
+         xmm2 += conj( r ) * r;
+      }
+
+      ResultType dots{ sum( xmm1 ), sum( xmm2 ) };
+
+      for( ; i<end; ++i ) {
+         const Type z( z_[i] );
+         const Type r( r_[i] - omega_ * t_[i] );
+         x_[i] += alpha_ * y_[i] + omega_ * z;
+         r_[i] = r;
+         dots[0] += conj( rhat_[i] ) * r;
+         dots[1] += conj( r ) * r;
+      }
+
+      return dots;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Type*       x_;      //!< The solution vector.
+   Type*       r_;      //!< The residual vector.
+   const Type* y_;      //!< The first update direction of the solution.
+   const Type* z_;      //!< The second update direction of the solution.
+   const Type* t_;      //!< The update direction of the residual.
+   const Type* rhat_;   //!< The shadow residual.
+   Type        alpha_;  //!< The scaling factor of the first update direction.
+   Type        omega_;  //!< The scaling factor of the second update direction.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,310 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/GMRES.h
+//  \brief Header file for the GMRES solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_GMRES_H_
+#define _BLAZE_MATH_SOLVERS_GMRES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/smp/Fused.h>
+#include <blaze/math/solvers/FusedKernels.h>
+#include <blaze/math/solvers/LinearOperator.h>
+#include <blaze/math/solvers/Preconditioners.h>
+#include <blaze/math/solvers/SolverControl.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GMRES FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name GMRES functions */
+//@{
+template< typename OP, typename VT1, typename VT2 >
+SolverResult gmres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                    const SolverControl& control = SolverControl() );
+
+template< typename OP, typename VT1, typename VT2, typename PT >
+SolverResult gmres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                    const PT& M, const SolverControl& control = SolverControl() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given general linear system of equations via the restarted GMRES method.
+// \ingroup solvers
+//
+// \param A The system matrix or matrix-free operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \param control The stopping criteria and the restart length.
+// \return The number of iterations, the final relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system of equations \f$ A \cdot x = b \f$ for a general
+// square system matrix \a A by means of the restarted generalized minimal residual (GMRES)
+// method without preconditioning. See the preconditioned version of gmres() for details.
+*/
+template< typename OP    // Type of the system matrix or matrix-free operator
+        , typename VT1   // Type of the solution vector
+        , typename VT2 > // Type of the right-hand side vector
+SolverResult gmres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                    const SolverControl& control )
+{
+   return gmres( A, x, b, IdentityPreconditioner(), control );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given general linear system of equations via the right-preconditioned
+//        restarted GMRES method.
+// \ingroup solvers
+//
+// \param A The system matrix or matrix-free operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \param M The preconditioner.
+// \param control The stopping criteria and the restart length.
+// \return The number of iterations, the final relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system of equations \f$ A \cdot x = b \f$ for a general
+// square system matrix \a A by means of the right-preconditioned restarted generalized minimal
+// residual method GMRES(m), where the restart length \a m is given by the \a restart member of
+// the given \a control. The given vector \a x is used as initial guess and is overwritten with
+// the solution. The iteration stops as soon as the norm of the residual drops below the relative
+// tolerance of the given \a control times the norm of \a b or in case the maximum number of
+// iterations has been reached. Each iteration adds one vector to the Krylov basis, i.e. it
+// performs one multiplication with the system matrix. The norm of the residual is estimated via
+// the Givens rotations of the Hessenberg matrix and recomputed explicitly at each restart.
+//
+// As for cg(), the system matrix \a A can be any square dense or sparse matrix (including all
+// adaptors and views) or a matrix-free operator and \a M can be any preconditioner providing
+// the function call operator \c M( r, z ) computing \f$ z = M^{-1} \cdot r \f$. The Krylov
+// basis is stored as the columns of a column-major dense matrix and is orthogonalized via the
+// classical Gram-Schmidt method with one reorthogonalization. Thus all inner products with the
+// basis vectors as well as the according vector updates are performed as two vectorized and
+// (if enabled) parallel dense matrix/vector multiplications, each of which reads the basis only
+// once. The element type of \a x determines the precision of all computations and has to be
+// \c float, \c double, \c complex<float> or \c complex<double>.
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Initialization
+
+   blaze::SolverControl control( 1E-10, 1000UL );
+   control.restart = 50UL;
+
+   const blaze::SolverResult result( blaze::gmres( A, x, b, control ) );
+   \endcode
+*/
+template< typename OP    // Type of the system matrix or matrix-free operator
+        , typename VT1   // Type of the solution vector
+        , typename VT2   // Type of the right-hand side vector
+        , typename PT >  // Type of the preconditioner
+SolverResult gmres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                    const PT& M, const SolverControl& control )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using Type = ElementType_<VT1>;
+   using UT   = UnderlyingBuiltin_<Type>;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   const size_t n( (~b).size() );
+
+   if( (~x).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   checkOperator( A, n );
+
+   const size_t maxIterations( ( control.maxIterations != 0UL )?( control.maxIterations ):( n ) );
+
+   SolverResult result;
+
+   const DynamicVector<Type> btmp( ~b );
+
+   const UT bnorm( sqrt( real( smpFused( FusedDotKernel<Type>( btmp, btmp ) ) ) ) );
+
+   if( bnorm == UT(0) ) {
+      reset( ~x );
+      result.converged = true;
+      return result;
+   }
+
+   const size_t m( min( max( control.restart, 1UL ), n ) );
+
+   DynamicVector<Type> xtmp( ~x ), r( n ), v( n ), w( n ), z, h, h2;
+   DynamicMatrix<Type,columnMajor> V( n, m+1UL );
+   DynamicMatrix<Type,columnMajor> H( m+1UL, m, Type() );
+   DynamicVector<UT> cs( m );
+   DynamicVector<Type> sn( m ), g( m+1UL ), y( m );
+
+   const UT threshold( UT( control.tolerance ) * bnorm );
+   UT residual( bnorm );
+
+   while( true )
+   {
+      // Computing the residual of the current solution
+      applyOperator( A, xtmp, w );
+      r = btmp - w;
+      residual = sqrt( real( smpFused( FusedDotKernel<Type>( r, r ) ) ) );
+
+      if( residual <= threshold || result.iterations >= maxIterations )
+         break;
+
+      column( V, 0UL ) = ( UT(1) / residual ) * r;
+      reset( g );
+      g[0UL] = residual;
+
+      // Arnoldi process
+      size_t k( 0UL );
+
+      while( k < m && result.iterations < maxIterations )
+      {
+         v = column( V, k );
+         applyOperator( A, applyPreconditioner( M, v, z ), w );
+
+         const auto Vk( submatrix( V, 0UL, 0UL, n, k+1UL ) );
+
+         h  = ctrans( Vk ) * w;
+         w -= Vk * h;
+         h2 = ctrans( Vk ) * w;
+         w -= Vk * h2;
+         h += h2;
+
+         const UT hnorm( sqrt( real( smpFused( FusedDotKernel<Type>( w, w ) ) ) ) );
+
+         for( size_t i=0UL; i<=k; ++i ) {
+            H(i,k) = h[i];
+         }
+
+         // Applying the previous Givens rotations to the new column of the Hessenberg matrix
+         for( size_t i=0UL; i<k; ++i ) {
+            const Type tmp( cs[i]*H(i,k) + sn[i]*H(i+1UL,k) );
+            H(i+1UL,k) = cs[i]*H(i+1UL,k) - conj( sn[i] )*H(i,k);
+            H(i,k) = tmp;
+         }
+
+         // Computing the Givens rotation eliminating the subdiagonal element
+         const Type hkk( H(k,k) );
+         const UT   abskk( abs( hkk ) );
+
+         if( abskk == UT(0) ) {
+            cs[k] = UT(0);
+            sn[k] = Type(1);
+            H(k,k) = hnorm;
+         }
+         else {
+            const UT   nu( sqrt( abskk*abskk + hnorm*hnorm ) );
+            const Type phase( hkk / abskk );
+            cs[k] = abskk / nu;
+            sn[k] = phase * hnorm / nu;
+            H(k,k) = phase * nu;
+         }
+
+         g[k+1UL] = -conj( sn[k] ) * g[k];
+         g[k]     = cs[k] * g[k];
+
+         residual = abs( g[k+1UL] );
+         ++result.iterations;
+         ++k;
+
+         if( residual <= threshold || hnorm == UT(0) )
+            break;
+
+         column( V, k ) = ( UT(1) / hnorm ) * w;
+      }
+
+      // Solving the upper triangular least squares system and updating the solution
+      for( size_t i=k; i-- > 0UL; ) {
+         Type tmp( g[i] );
+         for( size_t j=i+1UL; j<k; ++j ) {
+            tmp -= H(i,j) * y[j];
+         }
+         y[i] = ( isDivisor( H(i,i) ) )?( tmp / H(i,i) ):( Type() );
+      }
+
+      v = submatrix( V, 0UL, 0UL, n, k ) * subvector( y, 0UL, k );
+      xtmp += applyPreconditioner( M, v, z );
+   }
+
+   ~x = xtmp;
+
+   result.residual  = residual / bnorm;
+   result.converged = ( residual <= threshold );
+
+   return result;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
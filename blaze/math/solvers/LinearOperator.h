@@ -0,0 +1,390 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/LinearOperator.h
+//  \brief Header file for the application of the system operator of the iterative solvers
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_LINEAROPERATOR_H_
+#define _BLAZE_MATH_SOLVERS_LINEAROPERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/smp/Fused.h>
+#include <blaze/math/solvers/FusedKernels.h>
+#include <blaze/math/solvers/Preconditioners.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsMatrix.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS FUSEDSMATDVECDOTKERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused kernel for a row-major sparse matrix/dense vector multiplication and a subsequent
+//        inner product.
+// \ingroup solvers
+//
+// The FusedSMatDVecDotKernel class template computes \f$ y = A \cdot x \f$ for a row-major sparse
+// matrix \a A and at the same time the inner product \f$ w^H \cdot y \f$. Each element of \a y
+// enters the inner product as soon as it has been computed, i.e. \a y does not have to be read
+// again from memory.
+*/
+template< typename MT      // Type of the row-major sparse matrix
+        , typename Type >  // Data type of the vector elements
+struct FusedSMatDVecDotKernel
+{
+   //**Type definitions****************************************************************************
+   using ResultType = Type;  //!< Result type of the kernel.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! The granularity of the ranges of rows.
+   enum : size_t { granularity = 1UL };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedSMatDVecDotKernel class template.
+   //
+   // \param A The row-major sparse matrix.
+   // \param x The right-hand side dense vector of the multiplication.
+   // \param y The target dense vector of the multiplication.
+   // \param w The left-hand side dense vector of the inner product.
+   */
+   explicit inline FusedSMatDVecDotKernel( const MT& A, const DynamicVector<Type>& x,
+                                           DynamicVector<Type>& y, const DynamicVector<Type>& w ) noexcept
+      : A_( A        )  // The row-major sparse matrix
+      , x_( x.data() )  // The right-hand side dense vector of the multiplication
+      , y_( y.data() )  // The target dense vector of the multiplication
+      , w_( w.data() )  // The left-hand side dense vector of the inner product
+   {
+      BLAZE_INTERNAL_ASSERT( A.columns() == x.size(), "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == y.size(), "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == w.size(), "Invalid vector size" );
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the number of rows processed by the kernel.
+   //
+   // \return The number of rows of the sparse matrix.
+   */
+   inline size_t size() const noexcept {
+      return A_.rows();
+   }
+
+   /*!\brief Returns whether the kernel can be evaluated in parallel.
+   //
+   // \return \a true in case the kernel can be evaluated in parallel, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return A_.rows() >= SMP_SMATDVECMULT_THRESHOLD;
+   }
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the given range of rows of the product and their partial inner product.
+   //
+   // \param begin The index of the first row of the range.
+   // \param end The index one past the last row of the range.
+   // \return The partial inner product.
+   */
+   inline ResultType operator()( size_t begin, size_t end ) const
+   {
+      Type dot{};
+
+      for( size_t i=begin; i<end; ++i )
+      {
+         Type tmp{};
+
+         const ConstIterator_<MT> last( A_.end(i) );
+         for( ConstIterator_<MT> element=A_.begin(i); element!=last; ++element ) {
+            tmp += element->value() * x_[element->index()];
+         }
+
+         y_[i] = tmp;
+         dot += conj( w_[i] ) * tmp;
+      }
+
+      return dot;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const MT&   A_;  //!< The row-major sparse matrix.
+   const Type* x_;  //!< The right-hand side dense vector of the multiplication.
+   Type*       y_;  //!< The target dense vector of the multiplication.
+   const Type* w_;  //!< The left-hand side dense vector of the inner product.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATOR APPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the dimensions of the given system matrix.
+// \ingroup solvers
+//
+// \param A The system matrix.
+// \param n The size of the solution and right-hand side vectors.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO >    // Storage order of the system matrix
+inline void checkOperator( const Matrix<MT,SO>& A, size_t n )
+{
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~A).rows() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the dimensions of the given matrix-free operator.
+// \ingroup solvers
+//
+// \param op The matrix-free operator.
+// \param n The size of the solution and right-hand side vectors.
+// \return void
+//
+// The dimensions of a matrix-free operator cannot be checked in advance. Instead, the size of
+// the result of each application of the operator is checked.
+*/
+template< typename OP >  // Type of the matrix-free operator
+inline DisableIf_< IsMatrix<OP> > checkOperator( const OP& op, size_t n ) noexcept
+{
+   UNUSED_PARAMETER( op, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the product of the given system matrix and the given vector.
+// \ingroup solvers
+//
+// \param A The system matrix.
+// \param x The vector to be multiplied.
+// \param y The target vector for the result.
+// \return void
+//
+// This function computes \f$ y = A \cdot x \f$ via the according (vectorized and if enabled
+// parallel) matrix/vector multiplication of Blaze.
+*/
+template< typename MT      // Type of the system matrix
+        , bool SO          // Storage order of the system matrix
+        , typename Type >  // Data type of the vector elements
+inline void applyOperator( const Matrix<MT,SO>& A, const DynamicVector<Type>& x, DynamicVector<Type>& y )
+{
+   y = (~A) * x;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given matrix-free operator to the given vector.
+// \ingroup solvers
+//
+// \param op The matrix-free operator.
+// \param x The vector the operator is applied to.
+// \param y The target vector for the result.
+// \return void
+// \exception std::invalid_argument Invalid size of the operator result.
+//
+// This function computes \f$ y = A \cdot x \f$ by means of the function call operator
+// \c op( x, y ) of the given matrix-free operator.
+*/
+template< typename OP      // Type of the matrix-free operator
+        , typename Type >  // Data type of the vector elements
+inline DisableIf_< IsMatrix<OP> >
+   applyOperator( const OP& op, const DynamicVector<Type>& x, DynamicVector<Type>& y )
+{
+   op( x, y );
+
+   if( y.size() != x.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size of the operator result" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the product of the given row-major sparse matrix and the given vector and the
+//        inner product of the result with another vector.
+// \ingroup solvers
+//
+// \param A The row-major sparse system matrix.
+// \param x The vector to be multiplied.
+// \param y The target vector for the result.
+// \param w The left-hand side vector of the inner product.
+// \return The inner product \f$ w^H \cdot y \f$.
+//
+// This function computes \f$ y = A \cdot x \f$ and \f$ w^H \cdot y \f$ in a single pass by means
+// of the FusedSMatDVecDotKernel.
+*/
+template< typename MT      // Type of the system matrix
+        , bool SO          // Storage order of the system matrix
+        , typename Type >  // Data type of the vector elements
+inline EnableIf_< And< IsSparseMatrix<MT>, IsRowMajorMatrix<MT>, Not< IsComputation<MT> > >, Type >
+   applyOperatorDot( const Matrix<MT,SO>& A, const DynamicVector<Type>& x,
+                     DynamicVector<Type>& y, const DynamicVector<Type>& w )
+{
+   return smpFused( FusedSMatDVecDotKernel<MT,Type>( ~A, x, y, w ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given operator to the given vector and computes the inner product of the
+//        result with another vector.
+// \ingroup solvers
+//
+// \param op The system matrix or matrix-free operator.
+// \param x The vector the operator is applied to.
+// \param y The target vector for the result.
+// \param w The left-hand side vector of the inner product.
+// \return The inner product \f$ w^H \cdot y \f$.
+//
+// This function computes \f$ y = A \cdot x \f$ and afterwards \f$ w^H \cdot y \f$ by means of
+// the FusedDotKernel.
+*/
+template< typename OP      // Type of the system matrix or matrix-free operator
+        , typename Type >  // Data type of the vector elements
+inline DisableIf_< And< IsSparseMatrix<OP>, IsRowMajorMatrix<OP>, Not< IsComputation<OP> > >, Type >
+   applyOperatorDot( const OP& op, const DynamicVector<Type>& x,
+                     DynamicVector<Type>& y, const DynamicVector<Type>& w )
+{
+   applyOperator( op, x, y );
+   return smpFused( FusedDotKernel<Type>( w, y ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the identity preconditioner to the given vector.
+// \ingroup solvers
+//
+// \param r The vector to be preconditioned.
+// \return Reference to the given vector \a r.
+//
+// In case of the identity preconditioner, the vector is returned as is, i.e. no copy of the
+// vector is created.
+*/
+template< typename Type >  // Data type of the vector elements
+inline const DynamicVector<Type>&
+   applyPreconditioner( const IdentityPreconditioner&, const DynamicVector<Type>& r, DynamicVector<Type>& )
+{
+   return r;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given preconditioner to the given vector.
+// \ingroup solvers
+//
+// \param M The preconditioner.
+// \param r The vector to be preconditioned.
+// \param z The target vector for the preconditioned vector.
+// \return Reference to the preconditioned vector \a z.
+// \exception std::invalid_argument Invalid size of the preconditioner result.
+*/
+template< typename PT      // Type of the preconditioner
+        , typename Type >  // Data type of the vector elements
+inline const DynamicVector<Type>&
+   applyPreconditioner( const PT& M, const DynamicVector<Type>& r, DynamicVector<Type>& z )
+{
+   M( r, z );
+
+   if( z.size() != r.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size of the preconditioner result" );
+   }
+
+   return z;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,298 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/Preconditioners.h
+//  \brief Header file for the preconditioners of the iterative solvers
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_PRECONDITIONERS_H_
+#define _BLAZE_MATH_SOLVERS_PRECONDITIONERS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS IDENTITYPRECONDITIONER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The identity preconditioner of the iterative solvers.
+// \ingroup solvers
+//
+// The IdentityPreconditioner class represents the absence of a preconditioner. It is the
+// default preconditioner of the iterative solvers cg(), bicgstab() and gmres(), which detect
+// it at compile time and skip the preconditioning step entirely.
+//
+// Any other preconditioner has to provide the same function call operator, which computes
+// \f$ z = M^{-1} \cdot r \f$ for the given residual \a r. The function call operator must not
+// resize the target vector \a z.
+*/
+struct IdentityPreconditioner
+{
+   //**Function call operator**********************************************************************
+   /*!\brief Applies the identity preconditioner to the given residual.
+   //
+   // \param r The residual to be preconditioned.
+   // \param z The resulting preconditioned residual.
+   // \return void
+   */
+   template< typename VT1    // Type of the residual vector
+           , typename VT2 >  // Type of the target vector
+   inline void operator()( const DenseVector<VT1,false>& r, DenseVector<VT2,false>& z ) const
+   {
+      ~z = ~r;
+   }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS JACOBIPRECONDITIONER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The Jacobi (diagonal) preconditioner of the iterative solvers.
+// \ingroup solvers
+//
+// The JacobiPreconditioner class template scales the residual by the inverse of the diagonal
+// of the system matrix, i.e. it computes \f$ z = D^{-1} \cdot r \f$. It can be constructed from
+// any square dense or sparse matrix or, for instance in case of a matrix-free operator, from a
+// dense vector containing the diagonal elements:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Initialization
+
+   blaze::JacobiPreconditioner<double> M( A );
+   blaze::cg( A, x, b, M );
+   \endcode
+
+// In case the element type of the preconditioner matches the element type of the solution
+// vector, cg() applies the preconditioner within its fused update kernel, i.e. without any
+// additional pass over the residual.
+*/
+template< typename Type >  // Data type of the elements
+class JacobiPreconditioner
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   template< typename MT, bool SO >
+   explicit inline JacobiPreconditioner( const Matrix<MT,SO>& A );
+
+   template< typename VT >
+   explicit inline JacobiPreconditioner( const DenseVector<VT,false>& diagonal );
+   //@}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\name Function call operator */
+   //@{
+   template< typename VT1, typename VT2 >
+   inline void operator()( const DenseVector<VT1,false>& r, DenseVector<VT2,false>& z ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t                     size           () const noexcept;
+   inline const DynamicVector<Type>& inverseDiagonal() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   DynamicVector<Type> inv_;  //!< The inverse diagonal elements of the system matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for a Jacobi preconditioner for the given square matrix.
+//
+// \param A The system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid zero diagonal element.
+*/
+template< typename Type >  // Data type of the elements
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+inline JacobiPreconditioner<Type>::JacobiPreconditioner( const Matrix<MT,SO>& A )
+   : inv_( (~A).rows() )  // The inverse diagonal elements of the system matrix
+{
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   for( size_t i=0UL; i<inv_.size(); ++i )
+   {
+      const Type diag( (~A)(i,i) );
+
+      if( !isDivisor( diag ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid zero diagonal element" );
+      }
+
+      inv_[i] = Type(1) / diag;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a Jacobi preconditioner for the given diagonal elements.
+//
+// \param diagonal The diagonal elements of the system matrix.
+// \exception std::invalid_argument Invalid zero diagonal element.
+*/
+template< typename Type >  // Data type of the elements
+template< typename VT >    // Type of the dense vector
+inline JacobiPreconditioner<Type>::JacobiPreconditioner( const DenseVector<VT,false>& diagonal )
+   : inv_( (~diagonal).size() )  // The inverse diagonal elements of the system matrix
+{
+   for( size_t i=0UL; i<inv_.size(); ++i )
+   {
+      const Type diag( (~diagonal)[i] );
+
+      if( !isDivisor( diag ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid zero diagonal element" );
+      }
+
+      inv_[i] = Type(1) / diag;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUNCTION CALL OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Applies the Jacobi preconditioner to the given residual.
+//
+// \param r The residual to be preconditioned.
+// \param z The resulting preconditioned residual.
+// \return void
+*/
+template< typename Type >  // Data type of the elements
+template< typename VT1     // Type of the residual vector
+        , typename VT2 >   // Type of the target vector
+inline void JacobiPreconditioner<Type>::operator()( const DenseVector<VT1,false>& r,
+                                                    DenseVector<VT2,false>& z ) const
+{
+   BLAZE_USER_ASSERT( (~r).size() == inv_.size(), "Invalid vector size detected" );
+
+   ~z = inv_ * ~r;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of the preconditioner.
+//
+// \return The number of rows of the system matrix.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t JacobiPreconditioner<Type>::size() const noexcept
+{
+   return inv_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the inverse diagonal elements of the system matrix.
+//
+// \return The inverse diagonal elements of the system matrix.
+*/
+template< typename Type >  // Data type of the elements
+inline const DynamicVector<Type>& JacobiPreconditioner<Type>::inverseDiagonal() const noexcept
+{
+   return inv_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,143 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SolverControl.h
+//  \brief Header file for the control and result types of the iterative solvers
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SOLVERCONTROL_H_
+#define _BLAZE_MATH_SOLVERS_SOLVERCONTROL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SOLVERCONTROL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Stopping criteria and parameters of the iterative solvers.
+// \ingroup solvers
+//
+// The SolverControl class bundles the parameters of the iterative solvers cg(), bicgstab() and
+// gmres(). An iterative solver stops as soon as the Euclidean norm of the residual
+// \f$ r = b - A \cdot x \f$ drops below the given relative \a tolerance times the norm of the
+// right-hand side \a b or as soon as the given maximum number of iterations has been performed.
+// A maximum number of iterations of 0 selects the number of rows of the system. The \a restart
+// parameter is only used by gmres() and specifies the maximum dimension of the Krylov subspace
+// before a restart:
+
+   \code
+   blaze::SolverControl control( 1E-10, 500UL );  // Relative tolerance 1E-10, at most 500 iterations
+   control.restart = 50UL;                        // GMRES(50)
+   \endcode
+*/
+struct SolverControl
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SolverControl class.
+   //
+   // \param tol The relative tolerance of the residual norm.
+   // \param maxIter The maximum number of iterations (0 for the number of rows of the system).
+   // \param restartAfter The maximum dimension of the Krylov subspace of gmres().
+   */
+   explicit inline SolverControl( double tol = 1E-8, size_t maxIter = 0UL, size_t restartAfter = 30UL )
+      : tolerance    ( tol          )  // The relative tolerance of the residual norm
+      , maxIterations( maxIter      )  // The maximum number of iterations
+      , restart      ( restartAfter )  // The maximum dimension of the Krylov subspace
+   {}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   double tolerance;      //!< The relative tolerance of the residual norm.
+   size_t maxIterations;  //!< The maximum number of iterations (0 for the number of rows).
+   size_t restart;        //!< The maximum dimension of the Krylov subspace of gmres().
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SOLVERRESULT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Result of an iterative solver.
+// \ingroup solvers
+//
+// The SolverResult class is returned by the iterative solvers cg(), bicgstab() and gmres(). It
+// contains the number of performed iterations, the final residual norm relative to the norm of
+// the right-hand side, and the information whether the requested tolerance has been reached.
+// Note that the iterative solvers do not throw an exception in case they do not converge:
+
+   \code
+   const blaze::SolverResult result( blaze::cg( A, x, b ) );
+
+   if( !result.converged ) {
+      std::cerr << "CG did not converge, relative residual = " << result.residual << "\n";
+   }
+   \endcode
+*/
+struct SolverResult
+{
+   //**Constructor*********************************************************************************
+   /*!\brief The default constructor for the SolverResult class.
+   */
+   inline SolverResult()
+      : iterations( 0UL   )  // The number of performed iterations
+      , residual  ( 0.0   )  // The final relative residual norm
+      , converged ( false )  // Convergence flag
+   {}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   size_t iterations;  //!< The number of performed iterations.
+   double residual;    //!< The final residual norm relative to the norm of the right-hand side.
+   bool   converged;   //!< \a true in case the requested tolerance has been reached.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
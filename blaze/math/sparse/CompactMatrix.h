@@ -0,0 +1,3928 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CompactMatrix.h
+//  \brief Implementation of a compact MxN matrix with separate value and index arrays
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_COMPACTMATRIX_H_
+#define _BLAZE_MATH_SPARSE_COMPACTMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/MatrixAccessProxy.h>
+#include <blaze/math/sparse/NonZeroPartition.h>
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/IsCompact.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsStrictlyLower.h>
+#include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Algorithm.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Limits.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup compact_matrix CompactMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a \f$ M \times N \f$ compact sparse matrix.
+// \ingroup compact_matrix
+//
+// The CompactMatrix class template is the representation of an arbitrary sized sparse matrix
+// in the classic compressed row storage (CRS) or compressed column storage (CCS) format. In
+// contrast to the CompressedMatrix, which stores the non-zero elements as value-index-pairs,
+// the CompactMatrix stores the values and the indices of all non-zero elements in two separate,
+// contiguous arrays and the start of each row/column in a single offset array. The type of the
+// elements, the storage order, and the type of the stored indices can be specified via the
+// three template parameters:
+
+   \code
+   template< typename Type, bool SO, typename IT >
+   class CompactMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CompactMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//  - IT  : specifies the integral type of the stored column (in case of a row-major matrix)
+//          or row (in case of a column-major matrix) indices. The default value is \c uint32_t.
+//
+// The separate storage reduces the memory traffic of the sparse matrix operations: In case
+// of a double precision matrix with the default 32-bit indices, every non-zero element
+// occupies 12 bytes instead of the 16 bytes of a (padded) value-index-pair. Additionally, the
+// contiguous arrays enable the vectorization of the sparse matrix/dense vector multiplication
+// via SIMD gather operations.
+//
+// The CompactMatrix provides the same interface as the CompressedMatrix and can be used in
+// all expressions in combination with any other dense or sparse vector or matrix. However,
+// since the rows/columns don't have individual capacities, inserting an element in front of
+// the last non-zero element of the matrix requires to shift all subsequent elements. The most
+// efficient way to fill a CompactMatrix is therefore to append() the elements in the order of
+// the rows/columns:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::CompactMatrix<double,rowMajor> A( 4, 3 );
+
+   A.reserve( 3 );         // Reserving enough space for 3 non-zero elements
+   A.append( 0, 1, 1.0 );  // Appending the value 1 in row 0 with column index 1
+   A.append( 1, 1, 2.0 );  // Appending the value 2 in row 1 with column index 1
+   A.append( 3, 0, 3.0 );  // Appending the value 3 in row 3 with column index 0
+   \endcode
+
+// In contrast to the CompressedMatrix, the rows/columns of a CompactMatrix don't need to be
+// finalized. For compatibility the finalize() function is nevertheless provided.
+//
+// The number of columns of a row-major CompactMatrix (or the number of rows of a column-major
+// CompactMatrix) is limited by the range of the index type. In case the specified size cannot
+// be represented by the index type, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type                    // Data type of the sparse matrix
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename IT = uint32_t >         // Index type
+class CompactMatrix : public SparseMatrix< CompactMatrix<Type,SO,IT>, SO >
+{
+ private:
+   //**CompactElement class definition*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Access proxy for a single non-zero element of the compact matrix.
+   //
+   // Since the values and indices of the non-zero elements are stored in two separate arrays,
+   // the CompactElement class combines the two to provide the common value()/index() interface
+   // of sparse elements.
+   */
+   template< typename VT >  // Type of the accessed value (Type or const Type)
+   class CompactElement : private SparseElement
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef Type         ValueType;       //!< The value type of the sparse element.
+      typedef size_t       IndexType;       //!< The index type of the sparse element.
+      typedef VT&          Reference;       //!< Reference return type.
+      typedef const Type&  ConstReference;  //!< Reference-to-const return type.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the CompactElement class.
+      //
+      // \param value Pointer to the value of the non-zero element.
+      // \param index Pointer to the index of the non-zero element.
+      */
+      inline CompactElement( VT* value, const IT* index ) noexcept
+         : value_( value )  // Pointer to the value of the non-zero element
+         , index_( index )  // Pointer to the index of the non-zero element
+      {}
+      //*******************************************************************************************
+
+      //**Assignment operator**********************************************************************
+      /*!\brief Assignment to the accessed non-zero element.
+      //
+      // \param v The new value of the non-zero element.
+      // \return Reference to the non-zero element.
+      */
+      template< typename T > inline CompactElement& operator=( const T& v ) {
+         *value_ = v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment to the accessed non-zero element.
+      //
+      // \param v The right-hand side value for the addition.
+      // \return Reference to the non-zero element.
+      */
+      template< typename T > inline CompactElement& operator+=( const T& v ) {
+         *value_ += v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment to the accessed non-zero element.
+      //
+      // \param v The right-hand side value for the subtraction.
+      // \return Reference to the non-zero element.
+      */
+      template< typename T > inline CompactElement& operator-=( const T& v ) {
+         *value_ -= v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Multiplication assignment operator*******************************************************
+      /*!\brief Multiplication assignment to the accessed non-zero element.
+      //
+      // \param v The right-hand side value for the multiplication.
+      // \return Reference to the non-zero element.
+      */
+      template< typename T > inline CompactElement& operator*=( const T& v ) {
+         *value_ *= v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Division assignment operator*************************************************************
+      /*!\brief Division assignment to the accessed non-zero element.
+      //
+      // \param v The right-hand side value for the division.
+      // \return Reference to the non-zero element.
+      */
+      template< typename T > inline CompactElement& operator/=( const T& v ) {
+         *value_ /= v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the non-zero element.
+      //
+      // \return Pointer to the non-zero element.
+      */
+      inline const CompactElement* operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the non-zero element.
+      //
+      // \return The current value of the non-zero element.
+      */
+      inline Reference value() const noexcept {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the non-zero element.
+      //
+      // \return The current index of the non-zero element.
+      */
+      inline IndexType index() const noexcept {
+         return *index_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      VT*       value_;  //!< Pointer to the value of the non-zero element.
+      const IT* index_;  //!< Pointer to the index of the non-zero element.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**CompactIterator class definition************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Iterator over the non-zero elements of the compact matrix.
+   */
+   template< typename VT >  // Type of the accessed values (Type or const Type)
+   class CompactIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef CompactElement<VT>               ValueType;         //!< Type of the underlying elements.
+      typedef ValueType                        PointerType;       //!< Pointer return type.
+      typedef ValueType                        ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the CompactIterator class.
+      */
+      inline CompactIterator() noexcept
+         : value_( nullptr )  // Pointer to the current value
+         , index_( nullptr )  // Pointer to the current index
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the CompactIterator class.
+      //
+      // \param value Pointer to the current value.
+      // \param index Pointer to the current index.
+      */
+      inline CompactIterator( VT* value, const IT* index ) noexcept
+         : value_( value )  // Pointer to the current value
+         , index_( index )  // Pointer to the current index
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Conversion constructor from different CompactIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename VT2 >
+      inline CompactIterator( const CompactIterator<VT2>& it ) noexcept
+         : value_( it.value_ )  // Pointer to the current value
+         , index_( it.index_ )  // Pointer to the current index
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline CompactIterator& operator+=( ptrdiff_t inc ) noexcept {
+         value_ += inc;
+         index_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline CompactIterator& operator-=( ptrdiff_t dec ) noexcept {
+         value_ -= dec;
+         index_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline CompactIterator& operator++() noexcept {
+         ++value_;
+         ++index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const CompactIterator operator++( int ) noexcept {
+         const CompactIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline CompactIterator& operator--() noexcept {
+         --value_;
+         --index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const CompactIterator operator--( int ) noexcept {
+         const CompactIterator tmp( *this );
+         --(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current non-zero element.
+      //
+      // \return Reference to the current non-zero element.
+      */
+      inline ReferenceType operator*() const noexcept {
+         return ReferenceType( value_, index_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current non-zero element.
+      //
+      // \return Pointer to the current non-zero element.
+      */
+      inline PointerType operator->() const noexcept {
+         return PointerType( value_, index_ );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two CompactIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator==( const CompactIterator<VT2>& rhs ) const noexcept {
+         return value_ == rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two CompactIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      template< typename VT2 >
+      inline bool operator!=( const CompactIterator<VT2>& rhs ) const noexcept {
+         return value_ != rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two CompactIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator<( const CompactIterator<VT2>& rhs ) const noexcept {
+         return value_ < rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two CompactIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator>( const CompactIterator<VT2>& rhs ) const noexcept {
+         return value_ > rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two CompactIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator<=( const CompactIterator<VT2>& rhs ) const noexcept {
+         return value_ <= rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two CompactIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator>=( const CompactIterator<VT2>& rhs ) const noexcept {
+         return value_ >= rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      template< typename VT2 >
+      inline DifferenceType operator-( const CompactIterator<VT2>& rhs ) const noexcept {
+         return value_ - rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a CompactIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const CompactIterator operator+( const CompactIterator& it, size_t inc ) noexcept {
+         return CompactIterator( it.value_ + inc, it.index_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a CompactIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const CompactIterator operator+( size_t inc, const CompactIterator& it ) noexcept {
+         return CompactIterator( it.value_ + inc, it.index_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a CompactIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const CompactIterator operator-( const CompactIterator& it, size_t dec ) noexcept {
+         return CompactIterator( it.value_ - dec, it.index_ - dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      VT*       value_;  //!< Pointer to the current value.
+      const IT* index_;  //!< Pointer to the current index.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename VT2 > friend class CompactIterator;
+      friend class CompactMatrix;
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef CompactMatrix<Type,SO,IT>   This;            //!< Type of this CompactMatrix instance.
+   typedef SparseMatrix<This,SO>       BaseType;        //!< Base type of this CompactMatrix instance.
+   typedef This                        ResultType;      //!< Result type for expression template evaluations.
+   typedef CompactMatrix<Type,!SO,IT>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompactMatrix<Type,!SO,IT>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                        ElementType;     //!< Type of the sparse matrix elements.
+   typedef IT                          IndexType;       //!< Type of the stored indices.
+   typedef const Type&                 ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                 CompositeType;   //!< Data type for composite expression templates.
+   typedef MatrixAccessProxy<This>     Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                 ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef CompactIterator<Type>       Iterator;        //!< Iterator over non-constant elements.
+   typedef CompactIterator<const Type> ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CompactMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef CompactMatrix<ET,SO,IT>  Other;  //!< The type of the other CompactMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+                            explicit inline CompactMatrix();
+                            explicit inline CompactMatrix( size_t m, size_t n );
+                            explicit inline CompactMatrix( size_t m, size_t n, size_t nonzeros );
+                            explicit        CompactMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
+                                     inline CompactMatrix( const CompactMatrix& sm );
+                                     inline CompactMatrix( CompactMatrix&& sm ) noexcept;
+   template< typename MT, bool SO2 > inline CompactMatrix( const DenseMatrix<MT,SO2>&  dm );
+   template< typename MT, bool SO2 > inline CompactMatrix( const SparseMatrix<MT,SO2>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~CompactMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline CompactMatrix& operator=( const CompactMatrix& rhs );
+   inline CompactMatrix& operator=( CompactMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline CompactMatrix& operator= ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline CompactMatrix& operator= ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompactMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompactMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompactMatrix& operator*=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline EnableIf_< IsNumeric<Other>, CompactMatrix >& operator*=( Other rhs );
+
+   template< typename Other >
+   inline EnableIf_< IsNumeric<Other>, CompactMatrix >& operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t         rows() const noexcept;
+                              inline size_t         columns() const noexcept;
+                              inline size_t         capacity() const noexcept;
+                              inline size_t         capacity( size_t i ) const noexcept;
+                              inline size_t         nonZeros() const;
+                              inline size_t         nonZeros( size_t i ) const;
+                              inline void           reset();
+                              inline void           reset( size_t i );
+                              inline void           clear();
+                              inline Iterator       set    ( size_t i, size_t j, const Type& value );
+                              inline Iterator       insert ( size_t i, size_t j, const Type& value );
+                              inline void           erase  ( size_t i, size_t j );
+                              inline Iterator       erase  ( size_t i, Iterator pos );
+                              inline Iterator       erase  ( size_t i, Iterator first, Iterator last );
+                                     void           resize ( size_t m, size_t n, bool preserve=true );
+                              inline void           reserve( size_t nonzeros );
+                              inline void           reserve( size_t i, size_t nonzeros );
+                              inline void           trim   ();
+                              inline void           trim   ( size_t i );
+                              inline CompactMatrix& transpose();
+                              inline CompactMatrix& ctranspose();
+   template< typename Other > inline CompactMatrix& scale( const Other& scalar );
+   template< typename Other > inline CompactMatrix& scaleDiagonal( Other scalar );
+                              inline void           swap( CompactMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline void append  ( size_t i, size_t j, const Type& value, bool check=false );
+   inline void finalize( size_t i );
+
+   inline const NonZeroPartition& partition( size_t parts ) const;
+
+   inline const Type* values () const noexcept;
+   inline const IT*   indices() const noexcept;
+   inline size_t      offset ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO2 > inline void assign   ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT >           inline void assign   ( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT >           inline void assign   ( const SparseMatrix<MT,!SO>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+          inline size_t   lines() const noexcept;
+          inline size_t   position( size_t i, size_t j ) const;
+                 Iterator insert( size_t i, size_t pos, size_t j, const Type& value );
+                 Iterator erase ( size_t i, size_t first, size_t last );
+          inline size_t   extendCapacity() const noexcept;
+                 void     reserveElements( size_t nonzeros );
+   static inline void     checkIndexRange( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  m_;         //!< The current number of rows of the sparse matrix.
+   size_t  n_;         //!< The current number of columns of the sparse matrix.
+   size_t  capacity_;  //!< The current capacity of the value and index arrays.
+   Type*   values_;    //!< The values of the non-zero elements.
+   IT*     indices_;   //!< The column/row indices of the non-zero elements.
+   size_t* offsets_;   //!< The offsets of the first non-zero element of each row/column.
+   size_t  last_;      //!< The last row/column with a valid offset.
+                       /*!< All rows/columns behind \a last_ are empty. The offset of these
+                            rows/columns and of \a last_+1 is the total number of non-zero
+                            elements, which is stored at the end of the offset array. */
+
+   NonZeroPartitionCache partition_;  //!< Cached non-zero balanced partitions of the rows/columns.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT   );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO, typename IT >
+const Type CompactMatrix<Type,SO,IT>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CompactMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>::CompactMatrix()
+   : m_       ( 0UL )      // The current number of rows of the sparse matrix
+   , n_       ( 0UL )      // The current number of columns of the sparse matrix
+   , capacity_( 0UL )      // The current capacity of the value and index arrays
+   , values_  ( nullptr )  // The values of the non-zero elements
+   , indices_ ( nullptr )  // The column/row indices of the non-zero elements
+   , offsets_ ( nullptr )  // The offsets of the first non-zero element of each row/column
+   , last_    ( 0UL )      // The last row/column with a valid offset
+   , partition_()          // Cached non-zero balanced partition
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>::CompactMatrix( size_t m, size_t n )
+   : m_       ( m )        // The current number of rows of the sparse matrix
+   , n_       ( n )        // The current number of columns of the sparse matrix
+   , capacity_( 0UL )      // The current capacity of the value and index arrays
+   , values_  ( nullptr )  // The values of the non-zero elements
+   , indices_ ( nullptr )  // The column/row indices of the non-zero elements
+   , offsets_ ( nullptr )  // The offsets of the first non-zero element of each row/column
+   , last_    ( 0UL )      // The last row/column with a valid offset
+   , partition_()          // Cached non-zero balanced partition
+{
+   checkIndexRange( SO ? m : n );
+   offsets_ = new size_t[lines()+1UL]();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero elements.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>::CompactMatrix( size_t m, size_t n, size_t nonzeros )
+   : CompactMatrix( m, n )
+{
+   reserveElements( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The expected number of non-zero elements in each row/column.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix and will have enough capacity for the total
+// number of expected non-zero elements. Note that in case of a row-major matrix the given
+// vector must have at least \a m elements, in case of a column-major matrix at least \a n
+// elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+CompactMatrix<Type,SO,IT>::CompactMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+   : CompactMatrix( m, n )
+{
+   BLAZE_USER_ASSERT( nonzeros.size() == lines(), "Size of capacity vector and number of rows/columns don't match" );
+
+   size_t newCapacity( 0UL );
+   for( std::vector<size_t>::const_iterator it=nonzeros.begin(); it!=nonzeros.end(); ++it )
+      newCapacity += *it;
+
+   reserveElements( newCapacity );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for CompactMatrix.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>::CompactMatrix( const CompactMatrix& sm )
+   : CompactMatrix()
+{
+   *this = sm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for CompactMatrix.
+//
+// \param sm The sparse matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>::CompactMatrix( CompactMatrix&& sm ) noexcept
+   : m_       ( sm.m_ )         // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )         // The current number of columns of the sparse matrix
+   , capacity_( sm.capacity_ )  // The current capacity of the value and index arrays
+   , values_  ( sm.values_ )    // The values of the non-zero elements
+   , indices_ ( sm.indices_ )   // The column/row indices of the non-zero elements
+   , offsets_ ( sm.offsets_ )   // The offsets of the first non-zero element of each row/column
+   , last_    ( sm.last_ )      // The last row/column with a valid offset
+   , partition_()               // Cached non-zero balanced partition
+{
+   sm.m_        = 0UL;
+   sm.n_        = 0UL;
+   sm.capacity_ = 0UL;
+   sm.values_   = nullptr;
+   sm.indices_  = nullptr;
+   sm.offsets_  = nullptr;
+   sm.last_     = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be copied.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign dense matrix
+        , bool SO2 >     // Storage order of the foreign dense matrix
+inline CompactMatrix<Type,SO,IT>::CompactMatrix( const DenseMatrix<MT,SO2>& dm )
+   : CompactMatrix( (~dm).rows(), (~dm).columns() )
+{
+   using blaze::assign;
+
+   assign( *this, ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices.
+//
+// \param sm Sparse matrix to be copied.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO2 >     // Storage order of the foreign sparse matrix
+inline CompactMatrix<Type,SO,IT>::CompactMatrix( const SparseMatrix<MT,SO2>& sm )
+   : CompactMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros() )
+{
+   smpAssign( *this, ~sm );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for CompactMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>::~CompactMatrix()
+{
+   deallocate( values_  );
+   deallocate( indices_ );
+   delete[] offsets_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function returns a reference to the accessed value at position (\a i,\a j). In case the
+// compact matrix does not yet store an element at position (\a i,\a j) , a new element is
+// inserted into the compact matrix. Note that this function only performs an index check in
+// case BLAZE_USER_ASSERT() is active. In contrast, the at() function is guaranteed to perform a
+// check of the given access indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Reference
+   CompactMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return Reference( *this, i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstReference
+   CompactMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t line( SO ? j : i );
+   const size_t pos ( position( i, j ) );
+
+   if( pos == offset( line+1UL ) || indices_[pos] != ( SO ? i : j ) )
+      return zero_;
+   else
+      return values_[pos];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// This function returns a reference to the accessed value at position (\a i,\a j). In case the
+// compact matrix does not yet store an element at position (\a i,\a j) , a new element is
+// inserted into the compact matrix. In contrast to the subscript operator this function always
+// performs a check of the given access indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Reference
+   CompactMatrix<Type,SO,IT>::at( size_t i, size_t j )
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstReference
+   CompactMatrix<Type,SO,IT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   const size_t pos( offset( i ) );
+   return Iterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstIterator
+   CompactMatrix<Type,SO,IT>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   const size_t pos( offset( i ) );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstIterator
+   CompactMatrix<Type,SO,IT>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   const size_t pos( offset( i ) );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   const size_t pos( offset( i+1UL ) );
+   return Iterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstIterator
+   CompactMatrix<Type,SO,IT>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   const size_t pos( offset( i+1UL ) );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstIterator
+   CompactMatrix<Type,SO,IT>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   const size_t pos( offset( i+1UL ) );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for CompactMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+//
+// The sparse matrix is resized according to the given sparse matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>&
+   CompactMatrix<Type,SO,IT>::operator=( const CompactMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   const size_t nonzeros( rhs.nonZeros() );
+   const size_t L( rhs.lines() );
+
+   if( offsets_ == nullptr || L != lines() ) {
+      size_t* newOffsets( new size_t[L+1UL] );
+      std::swap( offsets_, newOffsets );
+      delete[] newOffsets;
+   }
+
+   m_ = rhs.m_;
+   n_ = rhs.n_;
+
+   if( nonzeros > capacity_ ) {
+      offsets_[L] = 0UL;
+      reserveElements( nonzeros );
+   }
+
+   std::copy( rhs.values_ , rhs.values_ +nonzeros, values_  );
+   std::copy( rhs.indices_, rhs.indices_+nonzeros, indices_ );
+
+   for( size_t k=0UL; k<=L; ++k )
+      offsets_[k] = rhs.offset( k );
+
+   last_ = ( L > 0UL )?( L-1UL ):( 0UL );
+
+   partition_.reset();
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for CompactMatrix.
+//
+// \param rhs The sparse matrix to be moved into this instance.
+// \return Reference to the assigned sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>&
+   CompactMatrix<Type,SO,IT>::operator=( CompactMatrix&& rhs ) noexcept
+{
+   deallocate( values_  );
+   deallocate( indices_ );
+   delete[] offsets_;
+
+   m_        = rhs.m_;
+   n_        = rhs.n_;
+   capacity_ = rhs.capacity_;
+   values_   = rhs.values_;
+   indices_  = rhs.indices_;
+   offsets_  = rhs.offsets_;
+   last_     = rhs.last_;
+
+   partition_.swap( rhs.partition_ );
+   rhs.partition_.reset();
+
+   rhs.m_        = 0UL;
+   rhs.n_        = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.values_   = nullptr;
+   rhs.indices_  = nullptr;
+   rhs.offsets_  = nullptr;
+   rhs.last_     = 0UL;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Dense matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline CompactMatrix<Type,SO,IT>&
+   CompactMatrix<Type,SO,IT>::operator=( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) ) {
+      CompactMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      assign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different sparse matrices.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline CompactMatrix<Type,SO,IT>&
+   CompactMatrix<Type,SO,IT>::operator=( const SparseMatrix<MT,SO2>& rhs )
+{
+   if( (~rhs).canAlias( this ) || (~rhs).nonZeros() > capacity_ ) {
+      CompactMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      reset();
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompactMatrix<Type,SO,IT>&
+   CompactMatrix<Type,SO,IT>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::addAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   addAssign( *this, ~rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompactMatrix<Type,SO,IT>&
+   CompactMatrix<Type,SO,IT>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::subAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   subAssign( *this, ~rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two given matrices don't match, a \a std::invalid_argument
+// is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompactMatrix<Type,SO,IT>&
+   CompactMatrix<Type,SO,IT>::operator*=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompactMatrix tmp( *this * (~rhs) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a sparse matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_< IsNumeric<Other>, CompactMatrix<Type,SO,IT> >&
+   CompactMatrix<Type,SO,IT>::operator*=( Other rhs )
+{
+   const size_t nonzeros( nonZeros() );
+   for( size_t k=0UL; k<nonzeros; ++k )
+      values_[k] *= rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a sparse matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_< IsNumeric<Other>, CompactMatrix<Type,SO,IT> >&
+   CompactMatrix<Type,SO,IT>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   typedef DivTrait_<Type,Other>            DT;
+   typedef If_< IsNumeric<DT>, DT, Other >  Tmp;
+
+   const size_t nonzeros( nonZeros() );
+
+   // Depending on the two involved data types, an integer division is applied or a
+   // floating point division is selected.
+   if( IsNumeric<DT>::value && IsFloatingPoint<DT>::value ) {
+      const Tmp tmp( Tmp(1)/static_cast<Tmp>( rhs ) );
+      for( size_t k=0UL; k<nonzeros; ++k )
+         values_[k] *= tmp;
+   }
+   else {
+      for( size_t k=0UL; k<nonzeros; ++k )
+         values_[k] /= rhs;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::capacity() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column. Since the rows/columns
+// of a compact matrix don't have individual capacities, the capacity of a row/column is given by
+// its number of non-zero elements plus the total free capacity of the matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   return nonZeros( i ) + ( capacity_ - nonZeros() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::nonZeros() const
+{
+   if( offsets_ != nullptr )
+      return offsets_[lines()];
+   else return 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   return offset( i+1UL ) - offset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::reset()
+{
+   if( offsets_ != nullptr ) {
+      offsets_[0UL] = offsets_[lines()] = 0UL;
+      last_ = 0UL;
+   }
+
+   partition_.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+// Note that the capacity of the matrix remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::reset( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   erase( i, offset( i ), offset( i+1UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::clear()
+{
+   if( offsets_ != nullptr )
+      offsets_[0UL] = 0UL;
+
+   m_    = 0UL;
+   n_    = 0UL;
+   last_ = 0UL;
+
+   partition_.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting an element of the compact matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of an element of the compact matrix. In case the compact matrix
+// already contains an element with row index \a i and column index \a j its value is modified,
+// else a new element with the given \a value is inserted.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+   const size_t pos  ( position( i, j ) );
+
+   if( pos != offset( line+1UL ) && indices_[pos] == index ) {
+      values_[pos] = value;
+      return Iterator( values_+pos, indices_+pos );
+   }
+   else return insert( line, pos, index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compact matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid compact matrix access index.
+//
+// This function inserts a new element into the compact matrix. However, duplicate elements are
+// not allowed. In case the compact matrix already contains an element with row index \a i and
+// column index \a j, a \a std::invalid_argument exception is thrown. Note that all non-zero
+// elements behind the new element have to be shifted, which might be expensive in case the
+// element is not inserted at the end of the last non-empty row/column.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::insert( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+   const size_t pos  ( position( i, j ) );
+
+   if( pos != offset( line+1UL ) && indices_[pos] == index ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Bad access index" );
+   }
+
+   return insert( line, pos, index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the compact matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+//
+// This function erases an element from the compact matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t line( SO ? j : i );
+   const size_t pos ( position( i, j ) );
+
+   if( pos != offset( line+1UL ) && indices_[pos] == ( SO ? i : j ) )
+      erase( line, pos, pos+1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the compact matrix.
+//
+// \param i The row/column index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases an element from the compact matrix. In case the storage order is set to
+// \a rowMajor the function erases an element from row \a i, in case the storage flag is set to
+// \a columnMajor the function erases an element from column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::erase( size_t i, Iterator pos )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( pos >= begin(i) && pos <= end(i), "Invalid compact matrix iterator" );
+
+   if( pos == end(i) )
+      return pos;
+
+   const size_t first( pos.value_ - values_ );
+   return erase( i, first, first+1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the compact matrix.
+//
+// \param i The row/column index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases a range of elements from the compact matrix. In case the storage order is
+// set to \a rowMajor the function erases a range of elements element from row \a i, in case the
+// storage flag is set to \a columnMajor the function erases a range of elements from column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::erase( size_t i, Iterator first, Iterator last )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range" );
+   BLAZE_USER_ASSERT( first >= begin(i) && first <= end(i), "Invalid compact matrix iterator" );
+   BLAZE_USER_ASSERT( last  >= begin(i) && last  <= end(i), "Invalid compact matrix iterator" );
+
+   return erase( i, size_t( first.value_ - values_ ), size_t( last.value_ - values_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the compact matrix.
+//
+// \param m The new number of rows of the compact matrix.
+// \param n The new number of columns of the compact matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompactMatrix<Type,SO,IT>::resize( size_t m, size_t n, bool preserve )
+{
+   if( m == m_ && n == n_ ) return;
+
+   checkIndexRange( SO ? m : n );
+
+   partition_.reset();
+
+   const size_t oldLines( ( offsets_ != nullptr )?( lines() ):( 0UL ) );
+   const size_t newLines( SO ? n : m );
+   const size_t minor   ( SO ? m : n );
+
+   size_t* newOffsets( ( offsets_ == nullptr || newLines != oldLines )
+                       ?( new size_t[newLines+1UL] )
+                       :( offsets_ ) );
+
+   size_t nonzeros( 0UL );
+
+   if( preserve )
+   {
+      const size_t lmin( blaze::min( oldLines, newLines ) );
+
+      for( size_t k=0UL; k<lmin; ++k )
+      {
+         const size_t begin( offset( k     ) );
+         const size_t end  ( offset( k+1UL ) );
+
+         newOffsets[k] = nonzeros;
+
+         for( size_t pos=begin; pos<end; ++pos ) {
+            if( indices_[pos] < minor ) {
+               if( pos != nonzeros ) {
+                  values_ [nonzeros] = std::move( values_[pos] );
+                  indices_[nonzeros] = indices_[pos];
+               }
+               ++nonzeros;
+            }
+         }
+      }
+
+      for( size_t k=lmin; k<newLines; ++k )
+         newOffsets[k] = nonzeros;
+   }
+   else
+   {
+      for( size_t k=0UL; k<newLines; ++k )
+         newOffsets[k] = 0UL;
+   }
+
+   newOffsets[newLines] = nonzeros;
+
+   if( newOffsets != offsets_ ) {
+      std::swap( offsets_, newOffsets );
+      delete[] newOffsets;
+   }
+
+   m_    = m;
+   n_    = n;
+   last_ = ( newLines > 0UL )?( newLines-1UL ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the sparse matrix.
+//
+// \param nonzeros The new minimum capacity of the sparse matrix.
+// \return void
+//
+// This function increases the capacity of the sparse matrix to at least \a nonzeros elements.
+// The current values of the matrix elements and the individual capacities of the matrix rows
+// are preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::reserve( size_t nonzeros )
+{
+   if( nonzeros > capacity_ )
+      reserveElements( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of a specific row/column of the sparse matrix.
+//
+// \param i The row/column index \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row/column.
+// \return void
+//
+// This function increases the capacity of row/column \a i of the sparse matrix to at least
+// \a nonzeros elements, i.e. it guarantees that at least \a nonzeros minus the current number
+// of non-zero elements of the row/column can be inserted without reallocation. The current
+// values of the sparse matrix and all other individual row/column capacities are preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::reserve( size_t i, size_t nonzeros )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+
+   const size_t current( nonZeros( i ) );
+
+   if( nonzeros > current && nonzeros - current > capacity_ - nonZeros() )
+      reserveElements( nonZeros() + ( nonzeros - current ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from all rows/columns.
+//
+// \return void
+//
+// Since the rows/columns of a compact matrix are stored without any gaps, this function has
+// no effect. It is provided for compatibility with the interface of the CompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::trim()
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity of a specific row/column of the sparse matrix.
+//
+// \param i The index of the row/column to be trimmed (\f$[0..M-1]\f$ or \f$[0..N-1]\f$).
+// \return void
+//
+// Since the rows/columns of a compact matrix are stored without any gaps, this function has
+// no effect. It is provided for compatibility with the interface of the CompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::trim( size_t i )
+{
+   UNUSED_PARAMETER( i );
+
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>& CompactMatrix<Type,SO,IT>::transpose()
+{
+   CompactMatrix tmp( trans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>& CompactMatrix<Type,SO,IT>::ctranspose()
+{
+   CompactMatrix tmp( ctrans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the sparse matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the scalar value
+inline CompactMatrix<Type,SO,IT>& CompactMatrix<Type,SO,IT>::scale( const Other& scalar )
+{
+   const size_t nonzeros( nonZeros() );
+   for( size_t k=0UL; k<nonzeros; ++k )
+      values_[k] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling the diagonal of the sparse matrix by the scalar value \a scalar.
+//
+// \param scalar The scalar value for the diagonal scaling.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the scalar value
+inline CompactMatrix<Type,SO,IT>& CompactMatrix<Type,SO,IT>::scaleDiagonal( Other scalar )
+{
+   const size_t size( blaze::min( m_, n_ ) );
+
+   for( size_t i=0UL; i<size; ++i ) {
+      const size_t pos( position( i, i ) );
+      if( pos != offset( i+1UL ) && indices_[pos] == i )
+         values_[pos] *= scalar;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::swap( CompactMatrix& sm ) noexcept
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( capacity_, sm.capacity_ );
+   std::swap( values_  , sm.values_   );
+   std::swap( indices_ , sm.indices_  );
+   std::swap( offsets_ , sm.offsets_  );
+   std::swap( last_    , sm.last_     );
+   partition_.swap( sm.partition_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows/columns of the matrix.
+//
+// \return The number of rows (in case of a row-major matrix) or columns (in case of a
+//         column-major matrix) of the matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::lines() const noexcept
+{
+   return ( SO )?( n_ ):( m_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of the first element not smaller than the given element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return The position of the first element not smaller than the search element.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::position( size_t i, size_t j ) const
+{
+   const size_t line ( SO ? j : i );
+   const IT     index( static_cast<IT>( SO ? i : j ) );
+
+   return std::lower_bound( indices_+offset( line ), indices_+offset( line+1UL ), index ) - indices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element at the given position of the compact matrix.
+//
+// \param i The row/column index of the new element.
+// \param pos The position of the new element within the value and index arrays.
+// \param j The column/row index of the new element.
+// \param value The value of the new element.
+// \return Iterator to the newly inserted element.
+//
+// This function inserts the given element at the given position of the compact matrix. In case
+// the element is inserted behind the last non-zero element of the matrix, the insertion is a
+// constant time operation. Otherwise all subsequent elements have to be shifted and the offsets
+// of all subsequent rows/columns have to be updated.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::insert( size_t i, size_t pos, size_t j, const Type& value )
+{
+   BLAZE_INTERNAL_ASSERT( pos >= offset( i ) && pos <= offset( i+1UL ), "Invalid insertion position" );
+
+   partition_.reset();
+
+   const size_t nonzeros( nonZeros() );
+
+   if( nonzeros == capacity_ )
+      reserveElements( extendCapacity() );
+
+   if( pos == nonzeros )
+   {
+      // All rows/columns behind row/column i are empty: Row/column i becomes the last
+      // row/column with a valid offset and the element is appended behind the last element
+      for( size_t k=last_+1UL; k<=i; ++k )
+         offsets_[k] = nonzeros;
+      last_ = i;
+   }
+   else
+   {
+      BLAZE_INTERNAL_ASSERT( i <= last_, "Invalid row/column index detected" );
+
+      std::move_backward( values_ +pos, values_ +nonzeros, values_ +nonzeros+1UL );
+      std::copy_backward( indices_+pos, indices_+nonzeros, indices_+nonzeros+1UL );
+
+      for( size_t k=i+1UL; k<=last_; ++k )
+         ++offsets_[k];
+   }
+
+   values_ [pos] = value;
+   indices_[pos] = static_cast<IT>( j );
+   ++offsets_[lines()];
+
+   return Iterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the compact matrix.
+//
+// \param i The row/column index of the elements to be erased.
+// \param first The position of the first element to be erased.
+// \param last The position just past the last element to be erased.
+// \return Iterator to the element after the erased elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::erase( size_t i, size_t first, size_t last )
+{
+   BLAZE_INTERNAL_ASSERT( first <= last, "Invalid erasure range" );
+   BLAZE_INTERNAL_ASSERT( first >= offset( i ) && last <= offset( i+1UL ), "Invalid erasure range" );
+
+   if( first != last )
+   {
+      partition_.reset();
+
+      const size_t nonzeros( nonZeros() );
+      const size_t count   ( last - first );
+
+      std::move( values_ +last, values_ +nonzeros, values_ +first );
+      std::copy( indices_+last, indices_+nonzeros, indices_+first );
+
+      for( size_t k=i+1UL; k<=last_; ++k )
+         offsets_[k] -= count;
+      offsets_[lines()] -= count;
+   }
+
+   return Iterator( values_+first, indices_+first );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating a new matrix capacity.
+//
+// \return The new sparse matrix capacity.
+//
+// This function calculates a new matrix capacity based on the current capacity of the sparse
+// matrix. Note that the new capacity is restricted to the interval \f$[7..\infty)\f$.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::extendCapacity() const noexcept
+{
+   size_t nonzeros( 2UL*capacity_+1UL );
+   nonzeros = blaze::max( nonzeros, 7UL );
+
+   BLAZE_INTERNAL_ASSERT( nonzeros > capacity_, "Invalid capacity value" );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reserving the specified number of sparse matrix elements.
+//
+// \param nonzeros The number of matrix elements to be reserved.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompactMatrix<Type,SO,IT>::reserveElements( size_t nonzeros )
+{
+   BLAZE_INTERNAL_ASSERT( nonzeros >= nonZeros(), "Invalid capacity detected" );
+
+   const size_t current( nonZeros() );
+
+   Type* newValues ( allocate<Type>( nonzeros ) );
+   IT*   newIndices( nullptr );
+
+   try {
+      newIndices = allocate<IT>( nonzeros );
+   }
+   catch( ... ) {
+      deallocate( newValues );
+      throw;
+   }
+
+   transfer( values_, values_+current, newValues );
+   std::copy( indices_, indices_+current, newIndices );
+
+   std::swap( values_ , newValues  );
+   std::swap( indices_, newIndices );
+   capacity_ = nonzeros;
+
+   deallocate( newValues  );
+   deallocate( newIndices );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking whether the given number of rows/columns can be represented by the index type.
+//
+// \param n The number of columns (row-major) or rows (column-major) of the matrix.
+// \return void
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::checkIndexRange( size_t n )
+{
+   if( n > 0UL && n-1UL > static_cast<size_t>( Limits<IT>::inf() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix size exceeds the range of the index type" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned. Note that the returned sparse matrix iterator is subject to
+// invalidation due to inserting operations via the function call operator or the insert()
+// function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::find( size_t i, size_t j )
+{
+   const size_t line ( SO ? j : i );
+   const size_t end  ( offset( line+1UL ) );
+   const size_t pos  ( position( i, j ) );
+
+   if( pos != end && indices_[pos] == ( SO ? i : j ) )
+      return Iterator( values_+pos, indices_+pos );
+   else
+      return Iterator( values_+end, indices_+end );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned. Note that the returned sparse matrix iterator is subject to
+// invalidation due to inserting operations via the function call operator or the insert()
+// function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstIterator
+   CompactMatrix<Type,SO,IT>::find( size_t i, size_t j ) const
+{
+   const size_t line ( SO ? j : i );
+   const size_t end  ( offset( line+1UL ) );
+   const size_t pos  ( position( i, j ) );
+
+   if( pos != end && indices_[pos] == ( SO ? i : j ) )
+      return ConstIterator( values_+pos, indices_+pos );
+   else
+      return ConstIterator( values_+end, indices_+end );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compact matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j )
+{
+   const size_t pos( position( i, j ) );
+   return Iterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compact matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstIterator
+   CompactMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j ) const
+{
+   const size_t pos( position( i, j ) );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compact matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::upperBound( size_t i, size_t j )
+{
+   const size_t line ( SO ? j : i );
+   const IT     index( static_cast<IT>( SO ? i : j ) );
+   const size_t pos  ( std::upper_bound( indices_+offset( line ), indices_+offset( line+1UL ), index ) - indices_ );
+
+   return Iterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compact matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstIterator
+   CompactMatrix<Type,SO,IT>::upperBound( size_t i, size_t j ) const
+{
+   const size_t line ( SO ? j : i );
+   const IT     index( static_cast<IT>( SO ? i : j ) );
+   const size_t pos  ( std::upper_bound( indices_+offset( line ), indices_+offset( line+1UL ), index ) - indices_ );
+
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appending an element to the specified row/column of the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a compact matrix with elements. It appends
+// a new element to the end of the specified row/column without any additional memory allocation.
+// Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the specified row/column of the sparse matrix
+//  - the current number of non-zero elements in the matrix must be smaller than the capacity
+//    of the matrix
+//
+// Ignoring these preconditions might result in undefined behavior! The optional \a check
+// parameter specifies whether the new value should be tested for a default value. If the new
+// value is a default value (for instance 0 in case of an integral element type) the value is
+// not appended. Per default the values are not tested.
+//
+// In combination with the reserve() and the finalize() function, append() provides the most
+// efficient way to add new elements to a (newly created) compact matrix:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::CompactMatrix<double,rowMajor> A( 4, 3 );
+
+   A.reserve( 3 );         // Reserving enough capacity for 3 non-zero elements
+   A.append( 0, 1, 1.0 );  // Appending the value 1 in row 0 with column index 1
+   A.finalize( 0 );        // Finalizing row 0
+   A.append( 1, 1, 2.0 );  // Appending the value 2 in row 1 with column index 1
+   A.finalize( 1 );        // Finalizing row 1
+   A.finalize( 2 );        // Finalizing the empty row 2 to prepare row 3
+   A.append( 3, 0, 3.0 );  // Appending the value 3 in row 3 with column index 0
+   A.finalize( 3 );        // Finalizing row 3
+   \endcode
+
+// \note Since the non-zero elements of all rows/columns are stored contiguously, append() is a
+// constant time operation only in case all rows/columns behind the specified row/column are
+// empty, i.e. in case the rows/columns are filled in ascending order. Additionally, append()
+// invalidates all iterators returned by the end() functions!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::append( size_t i, size_t j, const Type& value, bool check )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+   BLAZE_USER_ASSERT( nonZeros() < capacity(), "Not enough reserved capacity left" );
+   BLAZE_USER_ASSERT( nonZeros( SO ? j : i ) == 0UL ||
+                      ( SO ? i : j ) > indices_[offset( ( SO ? j : i )+1UL )-1UL], "Index is not strictly increasing" );
+
+   if( check && isDefault( value ) )
+      return;
+
+   const size_t line( SO ? j : i );
+   insert( line, offset( line+1UL ), SO ? i : j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the element insertion of a row/column.
+//
+// \param i The index of the row/column to be finalized \f$[0..M-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with elements.
+// Since the offsets of the rows/columns of a compact matrix are updated by append() directly,
+// this function has no effect and is only provided for compatibility with the interface of the
+// CompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::finalize( size_t i )
+{
+   UNUSED_PARAMETER( i );
+
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a non-zero balanced partition of the rows/columns of the matrix.
+//
+// \param parts The number of parts \f$[1..\infty)\f$.
+// \return Reference to the partition.
+//
+// This function returns a partition of the rows (in case the storage order is set to \a rowMajor)
+// or columns (in case the storage flag is set to \a columnMajor) of the matrix into \a parts
+// contiguous parts with approximately equal numbers of non-zero elements. The partition is
+// computed on demand and cached until the next modification of the sparsity pattern of the
+// matrix.
+//
+// \note This function is thread-safe with respect to concurrent calls to partition(), but it
+// must not be called concurrently with a modification of the matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline const NonZeroPartition& CompactMatrix<Type,SO,IT>::partition( size_t parts ) const
+{
+   return partition_.get( *this, parts );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the values of the non-zero elements.
+//
+// \return Pointer to the values of the non-zero elements.
+//
+// This function returns a pointer to the contiguous array of the values of all non-zero elements
+// of the compact matrix. The values of row/column \a i are stored in the range
+// \f$[offset(i)..offset(i+1))\f$.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline const Type* CompactMatrix<Type,SO,IT>::values() const noexcept
+{
+   return values_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the column/row indices of the non-zero elements.
+//
+// \return Pointer to the column/row indices of the non-zero elements.
+//
+// This function returns a pointer to the contiguous array of the column (in case of a row-major
+// matrix) or row (in case of a column-major matrix) indices of all non-zero elements of the
+// compact matrix. The indices of row/column \a i are stored in the range
+// \f$[offset(i)..offset(i+1))\f$ in strictly increasing order.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline const IT* CompactMatrix<Type,SO,IT>::indices() const noexcept
+{
+   return indices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first non-zero element of the specified row/column.
+//
+// \param i The index of the row/column \f$[0..M]\f$ or \f$[0..N]\f$.
+// \return The offset of the first non-zero element of row/column \a i.
+//
+// This function returns the position of the first non-zero element of row/column \a i within
+// the value and index arrays. The offset of the row/column one past the last row/column is the
+// total number of non-zero elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::offset( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i <= lines(), "Invalid row/column access index" );
+   return ( i <= last_ )?( offsets_[i] ):( offsets_[lines()] );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool CompactMatrix<Type,SO,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool CompactMatrix<Type,SO,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool CompactMatrix<Type,SO,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompactMatrix<Type,SO,IT>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   partition_.reset();
+
+   const size_t L( lines() );
+
+   if( L == 0UL )
+      return;
+
+   size_t nonzeros( 0UL );
+
+   offsets_[L] = 0UL;
+
+   for( size_t i=0UL; i<L; ++i )
+   {
+      offsets_[i] = nonzeros;
+
+      const size_t jbegin( ( SO ? IsLower<MT>::value : IsUpper<MT>::value )
+                           ?( ( SO ? IsStrictlyLower<MT>::value : IsStrictlyUpper<MT>::value ) ? i+1UL : i )
+                           :( 0UL ) );
+      const size_t jend  ( ( SO ? IsUpper<MT>::value : IsLower<MT>::value )
+                           ?( ( SO ? IsStrictlyUpper<MT>::value : IsStrictlyLower<MT>::value ) ? i : i+1UL )
+                           :( SO ? m_ : n_ ) );
+
+      for( size_t j=jbegin; j<jend; ++j )
+      {
+         if( nonzeros == capacity_ ) {
+            offsets_[L] = nonzeros;
+            reserveElements( extendCapacity() );
+         }
+
+         values_[nonzeros] = ( SO )?( (~rhs)(j,i) ):( (~rhs)(i,j) );
+
+         if( !isDefault( values_[nonzeros] ) ) {
+            indices_[nonzeros] = static_cast<IT>( j );
+            ++nonzeros;
+         }
+      }
+   }
+
+   offsets_[L] = nonzeros;
+   last_ = L-1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with the same storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CompactMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   partition_.reset();
+
+   const size_t L( lines() );
+
+   if( L == 0UL )
+      return;
+
+   typedef ConstIterator_<MT>  RhsIterator;
+
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<L; ++i )
+   {
+      offsets_[i] = nonzeros;
+
+      for( RhsIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+         values_ [nonzeros] = element->value();
+         indices_[nonzeros] = static_cast<IT>( element->index() );
+         ++nonzeros;
+      }
+   }
+
+   offsets_[L] = nonzeros;
+   last_ = L-1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with opposite storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CompactMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   partition_.reset();
+
+   const size_t L( lines() );
+
+   if( L == 0UL )
+      return;
+
+   typedef ConstIterator_<MT>  RhsIterator;
+
+   const size_t minor( SO ? m_ : n_ );
+
+   // Counting the number of elements per row/column
+   std::vector<size_t> positions( L, 0UL );
+   for( size_t j=0UL; j<minor; ++j ) {
+      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         ++positions[element->index()];
+   }
+
+   // Computing the offsets of the rows/columns
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<L; ++i ) {
+      offsets_[i] = nonzeros;
+      nonzeros += positions[i];
+      positions[i] = offsets_[i];
+   }
+   offsets_[L] = nonzeros;
+   last_ = L-1UL;
+
+   // Scattering the elements into the rows/columns of the compact matrix
+   for( size_t j=0UL; j<minor; ++j ) {
+      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element ) {
+         const size_t pos( positions[element->index()]++ );
+         values_ [pos] = element->value();
+         indices_[pos] = static_cast<IT>( j );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompactMatrix<Type,SO,IT>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompactMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void CompactMatrix<Type,SO,IT>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompactMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompactMatrix<Type,SO,IT>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompactMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand sparse matrix
+inline void CompactMatrix<Type,SO,IT>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompactMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  COMPACTMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CompactMatrix operators */
+//@{
+template< typename Type, bool SO, typename IT >
+inline void reset( CompactMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline void reset( CompactMatrix<Type,SO,IT>& m, size_t i );
+
+template< typename Type, bool SO, typename IT >
+inline void clear( CompactMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline bool isDefault( const CompactMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline bool isIntact( const CompactMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline void swap( CompactMatrix<Type,SO,IT>& a, CompactMatrix<Type,SO,IT>& b ) noexcept;
+
+template< typename Type, bool SO, typename IT >
+inline const NonZeroPartition&
+   nonZeroPartition( const CompactMatrix<Type,SO,IT>& m, size_t parts, NonZeroPartition& buffer );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given compact matrix.
+// \ingroup compact_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( CompactMatrix<Type,SO,IT>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given compact matrix.
+// \ingroup compact_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column of the given compact matrix to
+// their default value. In case the given matrix is a \a rowMajor matrix the function resets the
+// values in row \a i, if it is a \a columnMajor matrix the function resets the values in column
+// \a i. Note that the capacity of the matrix remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( CompactMatrix<Type,SO,IT>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given compact matrix.
+// \ingroup compact_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void clear( CompactMatrix<Type,SO,IT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given compact matrix is in default state.
+// \ingroup compact_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the compact matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false. The following example demonstrates the use of the
+// \a isDefault() function:
+
+   \code
+   blaze::CompactMatrix<int> A;
+   // ... Resizing and initialization
+   if( isDefault( A ) ) { ... }
+   \endcode
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isDefault( const CompactMatrix<Type,SO,IT>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given compact matrix are intact.
+// \ingroup compact_matrix
+//
+// \param m The compact matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the compact matrix are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false. The following example demonstrates the use of the \a isIntact()
+// function:
+
+   \code
+   blaze::CompactMatrix<int> A;
+   // ... Resizing and initialization
+   if( isIntact( A ) ) { ... }
+   \endcode
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isIntact( const CompactMatrix<Type,SO,IT>& m )
+{
+   if( m.nonZeros() > m.capacity() )
+      return false;
+
+   const size_t lines( SO ? m.columns() : m.rows() );
+
+   for( size_t i=0UL; i<lines; ++i ) {
+      if( m.offset( i ) > m.offset( i+1UL ) )
+         return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compact matrices.
+// \ingroup compact_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void swap( CompactMatrix<Type,SO,IT>& a, CompactMatrix<Type,SO,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the cached non-zero balanced partition of the given compact matrix.
+// \ingroup compact_matrix
+//
+// \param m The compact matrix to be partitioned.
+// \param parts The number of parts \f$[1..\infty)\f$.
+// \param buffer Unused partition buffer.
+// \return Reference to the cached partition of the matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline const NonZeroPartition&
+   nonZeroPartition( const CompactMatrix<Type,SO,IT>& m, size_t parts, NonZeroPartition& buffer )
+{
+   UNUSED_PARAMETER( buffer );
+
+   return m.partition( parts );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISCOMPACT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct IsCompact< CompactMatrix<T,SO,IT> > : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct IsResizable< CompactMatrix<T,SO,IT> > : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct AddTrait< CompactMatrix<T1,SO,IT>, StaticMatrix<T2,M,N,SO> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct AddTrait< CompactMatrix<T1,SO1,IT>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO2 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct AddTrait< StaticMatrix<T1,M,N,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< StaticMatrix<T1,M,N,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct AddTrait< CompactMatrix<T1,SO,IT>, HybridMatrix<T2,M,N,SO> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct AddTrait< CompactMatrix<T1,SO1,IT>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO2 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct AddTrait< HybridMatrix<T1,M,N,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< HybridMatrix<T1,M,N,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct AddTrait< CompactMatrix<T1,SO,IT>, DynamicMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< CompactMatrix<T1,SO1,IT>, DynamicMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct AddTrait< DynamicMatrix<T1,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< DynamicMatrix<T1,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, bool AF, bool PF, typename IT >
+struct AddTrait< CompactMatrix<T1,SO,IT>, CustomMatrix<T2,AF,PF,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool AF, bool PF, bool SO2, typename IT >
+struct AddTrait< CompactMatrix<T1,SO1,IT>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO, typename T2, typename IT >
+struct AddTrait< CustomMatrix<T1,AF,PF,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< CustomMatrix<T1,AF,PF,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct AddTrait< CompactMatrix<T1,SO,IT1>, CompactMatrix<T2,SO,IT2> >
+{
+   using Type = CompactMatrix< AddTrait_<T1,T2>, SO, IT1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct AddTrait< CompactMatrix<T1,SO1,IT1>, CompactMatrix<T2,SO2,IT2> >
+{
+   using Type = CompactMatrix< AddTrait_<T1,T2>, false, IT1 >;
+};
+
+template< typename T1, bool SO, typename IT, typename T2 >
+struct AddTrait< CompactMatrix<T1,SO,IT>, CompressedMatrix<T2,SO> >
+{
+   using Type = CompressedMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename IT, typename T2, bool SO2 >
+struct AddTrait< CompactMatrix<T1,SO1,IT>, CompressedMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< AddTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct AddTrait< CompressedMatrix<T1,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = CompressedMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< CompressedMatrix<T1,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = CompressedMatrix< AddTrait_<T1,T2>, false >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct SubTrait< CompactMatrix<T1,SO,IT>, StaticMatrix<T2,M,N,SO> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct SubTrait< CompactMatrix<T1,SO1,IT>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO2 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct SubTrait< StaticMatrix<T1,M,N,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< StaticMatrix<T1,M,N,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct SubTrait< CompactMatrix<T1,SO,IT>, HybridMatrix<T2,M,N,SO> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct SubTrait< CompactMatrix<T1,SO1,IT>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO2 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct SubTrait< HybridMatrix<T1,M,N,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< HybridMatrix<T1,M,N,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct SubTrait< CompactMatrix<T1,SO,IT>, DynamicMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< CompactMatrix<T1,SO1,IT>, DynamicMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct SubTrait< DynamicMatrix<T1,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< DynamicMatrix<T1,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, bool AF, bool PF, typename IT >
+struct SubTrait< CompactMatrix<T1,SO,IT>, CustomMatrix<T2,AF,PF,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool AF, bool PF, bool SO2, typename IT >
+struct SubTrait< CompactMatrix<T1,SO1,IT>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO, typename T2, typename IT >
+struct SubTrait< CustomMatrix<T1,AF,PF,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< CustomMatrix<T1,AF,PF,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct SubTrait< CompactMatrix<T1,SO,IT1>, CompactMatrix<T2,SO,IT2> >
+{
+   using Type = CompactMatrix< SubTrait_<T1,T2> , SO, IT1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct SubTrait< CompactMatrix<T1,SO1,IT1>, CompactMatrix<T2,SO2,IT2> >
+{
+   using Type = CompactMatrix< SubTrait_<T1,T2> , false, IT1 >;
+};
+
+template< typename T1, bool SO, typename IT, typename T2 >
+struct SubTrait< CompactMatrix<T1,SO,IT>, CompressedMatrix<T2,SO> >
+{
+   using Type = CompressedMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename IT, typename T2, bool SO2 >
+struct SubTrait< CompactMatrix<T1,SO1,IT>, CompressedMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< SubTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct SubTrait< CompressedMatrix<T1,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = CompressedMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< CompressedMatrix<T1,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = CompressedMatrix< SubTrait_<T1,T2>, false >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, typename IT >
+struct MultTrait< CompactMatrix<T1,SO,IT>, T2, EnableIf_< IsNumeric<T2> > >
+{
+   using Type = CompactMatrix< MultTrait_<T1,T2>, SO, IT >;
+};
+
+template< typename T1, typename T2, bool SO, typename IT >
+struct MultTrait< T1, CompactMatrix<T2,SO,IT>, EnableIf_< IsNumeric<T1> > >
+{
+   using Type = CompactMatrix< MultTrait_<T1,T2>, SO, IT >;
+};
+
+template< typename T1, bool SO, typename T2, size_t N, typename IT >
+struct MultTrait< CompactMatrix<T1,SO,IT>, StaticVector<T2,N,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, size_t N, typename T2, bool SO, typename IT >
+struct MultTrait< StaticVector<T1,N,true>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO, typename T2, size_t N, typename IT >
+struct MultTrait< CompactMatrix<T1,SO,IT>, HybridVector<T2,N,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, size_t N, typename T2, bool SO, typename IT >
+struct MultTrait< HybridVector<T1,N,true>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct MultTrait< CompactMatrix<T1,SO,IT>, DynamicVector<T2,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, typename T2, bool SO, typename IT >
+struct MultTrait< DynamicVector<T1,true>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO, typename T2, bool AF, bool PF, typename IT >
+struct MultTrait< CompactMatrix<T1,SO,IT>, CustomVector<T2,AF,PF,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool AF, bool PF, typename T2, bool SO, typename IT >
+struct MultTrait< CustomVector<T1,AF,PF,true>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct MultTrait< CompactMatrix<T1,SO,IT>, CompressedVector<T2,false> >
+{
+   using Type = CompressedVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, typename T2, bool SO, typename IT >
+struct MultTrait< CompressedVector<T1,true>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = CompressedVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct MultTrait< CompactMatrix<T1,SO1,IT>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct MultTrait< CompactMatrix<T1,SO1,IT>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< CompactMatrix<T1,SO1,IT>, DynamicMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< DynamicMatrix<T1,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool AF, bool PF, bool SO2, typename IT >
+struct MultTrait< CompactMatrix<T1,SO1,IT>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< CustomMatrix<T1,AF,PF,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct MultTrait< CompactMatrix<T1,SO1,IT1>, CompactMatrix<T2,SO2,IT2> >
+{
+   using Type = CompactMatrix< MultTrait_<T1,T2>, SO1, IT1 >;
+};
+
+template< typename T1, bool SO, typename IT, typename T2 >
+struct MultTrait< CompactMatrix<T1,SO,IT>, CompressedMatrix<T2,SO> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename IT, typename T2, bool SO2 >
+struct MultTrait< CompactMatrix<T1,SO1,IT>, CompressedMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct MultTrait< CompressedMatrix<T1,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< CompressedMatrix<T1,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, typename IT >
+struct DivTrait< CompactMatrix<T1,SO,IT>, T2, EnableIf_< IsNumeric<T2> > >
+{
+   using Type = CompactMatrix< DivTrait_<T1,T2>, SO, IT >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct MathTrait< CompactMatrix<T1,SO,IT1>, CompactMatrix<T2,SO,IT2> >
+{
+   using HighType = CompactMatrix< typename MathTrait<T1,T2>::HighType, SO, IT1 >;
+   using LowType  = CompactMatrix< typename MathTrait<T1,T2>::LowType , SO, IT1 >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT >
+struct SubmatrixTrait< CompactMatrix<T1,SO,IT> >
+{
+   using Type = CompactMatrix<T1,SO,IT>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT >
+struct RowTrait< CompactMatrix<T1,SO,IT> >
+{
+   using Type = CompressedVector<T1,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT >
+struct ColumnTrait< CompactMatrix<T1,SO,IT> >
+{
+   using Type = CompressedVector<T1,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -52,6 +52,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/sparse/MatrixAccessProxy.h>
+#include <blaze/math/sparse/NonZeroPartition.h>
 #include <blaze/math/sparse/ValueIndexPair.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnTrait.h>
@@ -82,6 +83,7 @@
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
 #include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -368,6 +370,8 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    //@{
    inline void append  ( size_t i, size_t j, const Type& value, bool check=false );
    inline void finalize( size_t i );
+
+   inline const NonZeroPartition& partition( size_t parts ) const;
    //@}
    //**********************************************************************************************
 
@@ -408,6 +412,8 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    Iterator* begin_;  //!< Pointers to the first non-zero element of each row.
    Iterator* end_;    //!< Pointers one past the last non-zero element of each row.
 
+   NonZeroPartitionCache partition_;  //!< Cached non-zero balanced partitions of the rows.
+
    static const Type zero_;  //!< Neutral element for accesses to zero elements.
    //@}
    //**********************************************************************************************
@@ -456,6 +462,7 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix()
    , capacity_( 0UL )      // The current capacity of the pointer array
    , begin_   ( nullptr )  // Pointers to the first non-zero element of each row
    , end_     ( nullptr )  // Pointers one past the last non-zero element of each row
+   , partition_()          // Cached non-zero balanced partition
 {}
 //*************************************************************************************************
 
@@ -476,6 +483,7 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
    , capacity_( m )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
+   , partition_()                       // Cached non-zero balanced partition
 {
    for( size_t i=0UL; i<2UL*m_+2UL; ++i )
       begin_[i] = nullptr;
@@ -500,6 +508,7 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t n
    , capacity_( m )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
+   , partition_()                       // Cached non-zero balanced partition
 {
    begin_[0UL] = allocate<Element>( nonzeros );
    for( size_t i=1UL; i<(2UL*m_+1UL); ++i )
@@ -528,6 +537,7 @@ CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vect
    , capacity_( m )                      // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   , partition_()                        // Cached non-zero balanced partition
 {
    BLAZE_USER_ASSERT( nonzeros.size() == m, "Size of capacity vector and number of rows don't match" );
 
@@ -556,6 +566,7 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
    , capacity_( sm.m_ )                  // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   , partition_()                        // Cached non-zero balanced partition
 {
    const size_t nonzeros( sm.nonZeros() );
 
@@ -580,6 +591,7 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( CompressedMatrix&& sm ) noex
    , capacity_( sm.capacity_ )  // The current capacity of the pointer array
    , begin_   ( sm.begin_ )     // Pointers to the first non-zero element of each row
    , end_     ( sm.end_ )       // Pointers one past the last non-zero element of each row
+   , partition_()               // Cached non-zero balanced partition
 {
    sm.m_        = 0UL;
    sm.n_        = 0UL;
@@ -605,6 +617,7 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& d
    , capacity_( m_ )                        // The current capacity of the pointer array
    , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   , partition_()                           // Cached non-zero balanced partition
 {
    using blaze::assign;
 
@@ -631,9 +644,8 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
    , capacity_( m_ )                        // The current capacity of the pointer array
    , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   , partition_()                           // Cached non-zero balanced partition
 {
-   using blaze::assign;
-
    const size_t nonzeros( (~sm).nonZeros() );
 
    begin_[0UL] = allocate<Element>( nonzeros );
@@ -641,7 +653,7 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
       begin_[i+1UL] = end_[i] = begin_[0UL];
    end_[m_] = begin_[0UL]+nonzeros;
 
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 //*************************************************************************************************
 
@@ -974,6 +986,8 @@ inline CompressedMatrix<Type,SO>&
    m_ = rhs.m_;
    n_ = rhs.n_;
 
+   partition_.reset();
+
    return *this;
 }
 //*************************************************************************************************
@@ -1001,6 +1015,9 @@ inline CompressedMatrix<Type,SO>&
    begin_    = rhs.begin_;
    end_      = rhs.end_;
 
+   partition_.swap( rhs.partition_ );
+   rhs.partition_.reset();
+
    rhs.m_        = 0UL;
    rhs.n_        = 0UL;
    rhs.capacity_ = 0UL;
@@ -1060,8 +1077,6 @@ template< typename MT    // Type of the right-hand side sparse matrix
 inline CompressedMatrix<Type,SO>&
    CompressedMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).rows()     > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -1071,7 +1086,7 @@ inline CompressedMatrix<Type,SO>&
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -1353,6 +1368,8 @@ inline void CompressedMatrix<Type,SO>::reset()
 {
    for( size_t i=0UL; i<m_; ++i )
       end_[i] = begin_[i];
+
+   partition_.reset();
 }
 //*************************************************************************************************
 
@@ -1374,6 +1391,7 @@ inline void CompressedMatrix<Type,SO>::reset( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    end_[i] = begin_[i];
+   partition_.reset();
 }
 //*************************************************************************************************
 
@@ -1392,6 +1410,8 @@ inline void CompressedMatrix<Type,SO>::clear()
    end_[0UL] = end_[m_];
    m_ = 0UL;
    n_ = 0UL;
+
+   partition_.reset();
 }
 //*************************************************************************************************
 
@@ -1474,6 +1494,8 @@ template< typename Type  // Data type of the sparse matrix
 typename CompressedMatrix<Type,SO>::Iterator
    CompressedMatrix<Type,SO>::insert( Iterator pos, size_t i, size_t j, const Type& value )
 {
+   partition_.reset();
+
    if( begin_[i+1UL] - end_[i] != 0 ) {
       std::move_backward( pos, end_[i], end_[i]+1UL );
       pos->value_ = value;
@@ -1552,6 +1574,8 @@ inline void CompressedMatrix<Type,SO>::erase( size_t i, size_t j )
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
+   partition_.reset();
+
    const Iterator pos( find( i, j ) );
    if( pos != end_[i] )
       end_[i] = std::move( pos+1, end_[i], pos );
@@ -1578,6 +1602,8 @@ inline typename CompressedMatrix<Type,SO>::Iterator
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    BLAZE_USER_ASSERT( pos >= begin_[i] && pos <= end_[i], "Invalid compressed matrix iterator" );
 
+   partition_.reset();
+
    if( pos != end_[i] )
       end_[i] = std::move( pos+1, end_[i], pos );
 
@@ -1608,6 +1634,8 @@ inline typename CompressedMatrix<Type,SO>::Iterator
    BLAZE_USER_ASSERT( first >= begin_[i] && first <= end_[i], "Invalid compressed matrix iterator" );
    BLAZE_USER_ASSERT( last  >= begin_[i] && last  <= end_[i], "Invalid compressed matrix iterator" );
 
+   partition_.reset();
+
    if( first != last )
       end_[i] = std::move( last, end_[i], first );
 
@@ -1640,6 +1668,8 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 
    if( m == m_ && n == n_ ) return;
 
+   partition_.reset();
+
    if( begin_ == nullptr )
    {
       begin_ = new Iterator[2UL*m+2UL];
@@ -1945,6 +1975,7 @@ inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) noexcept
    std::swap( capacity_, sm.capacity_ );
    std::swap( begin_, sm.begin_ );
    std::swap( end_  , sm.end_   );
+   partition_.swap( sm.partition_ );
 }
 //*************************************************************************************************
 
@@ -2237,6 +2268,8 @@ inline void CompressedMatrix<Type,SO>::append( size_t i, size_t j, const Type& v
    BLAZE_USER_ASSERT( end_[i] < end_[m_], "Not enough reserved capacity left" );
    BLAZE_USER_ASSERT( begin_[i] == end_[i] || j > ( end_[i]-1UL )->index_, "Index is not strictly increasing" );
 
+   partition_.reset();
+
    end_[i]->value_ = value;
 
    if( !check || !isDefault( end_[i]->value_ ) ) {
@@ -2266,6 +2299,8 @@ inline void CompressedMatrix<Type,SO>::finalize( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
 
+   partition_.reset();
+
    begin_[i+1UL] = end_[i];
    if( i != m_-1UL )
       end_[i+1UL] = end_[i];
@@ -2273,6 +2308,31 @@ inline void CompressedMatrix<Type,SO>::finalize( size_t i )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns a non-zero balanced partition of the rows/columns of the matrix.
+//
+// \param parts The number of parts \f$[1..\infty)\f$.
+// \return Reference to the partition.
+//
+// This function returns a partition of the rows (in case the storage order is set to \a rowMajor)
+// or columns (in case the storage flag is set to \a columnMajor) of the matrix into \a parts
+// contiguous parts with approximately equal numbers of non-zero elements. The partition is
+// computed on demand and cached until the next modification of the sparsity pattern of the
+// matrix. Thus repeated (parallel) multiplications with the same matrix, as for instance in
+// iterative solvers, compute the partition only once.
+//
+// \note This function is thread-safe with respect to concurrent calls to partition(), but it
+// must not be called concurrently with a modification of the matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline const NonZeroPartition& CompressedMatrix<Type,SO>::partition( size_t parts ) const
+{
+   return partition_.get( *this, parts );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -2360,6 +2420,8 @@ inline void CompressedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
+   partition_.reset();
+
    if( m_ == 0UL || n_ == 0UL )
       return;
 
@@ -2423,6 +2485,8 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
    BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
 
+   partition_.reset();
+
    if( m_ == 0UL || begin_[0] == nullptr )
       return;
 
@@ -2456,6 +2520,8 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
    BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
 
+   partition_.reset();
+
    typedef ConstIterator_<MT>  RhsIterator;
 
    // Counting the number of elements per row
@@ -2768,6 +2834,8 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
    //@{
    inline void append  ( size_t i, size_t j, const Type& value, bool check=false );
    inline void finalize( size_t j );
+
+   inline const NonZeroPartition& partition( size_t parts ) const;
    //@}
    //**********************************************************************************************
 
@@ -2808,6 +2876,8 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
    Iterator* begin_;  //!< Pointers to the first non-zero element of each column.
    Iterator* end_;    //!< Pointers one past the last non-zero element of each column.
 
+   NonZeroPartitionCache partition_;  //!< Cached non-zero balanced partitions of the columns.
+
    static const Type zero_;  //!< Neutral element for accesses to zero elements.
    //@}
    //**********************************************************************************************
@@ -2857,6 +2927,7 @@ inline CompressedMatrix<Type,true>::CompressedMatrix()
    , capacity_( 0UL )      // The current capacity of the pointer array
    , begin_   ( nullptr )  // Pointers to the first non-zero element of each column
    , end_     ( nullptr )  // Pointers one past the last non-zero element of each column
+   , partition_()          // Cached non-zero balanced partition
 {}
 /*! \endcond */
 //*************************************************************************************************
@@ -2878,6 +2949,7 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
    , capacity_( n )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
    , end_  ( begin_+(n+1UL) )           // Pointers one past the last non-zero element of each column
+   , partition_()                       // Cached non-zero balanced partition
 {
    for( size_t j=0UL; j<2UL*n_+2UL; ++j )
       begin_[j] = nullptr;
@@ -2903,6 +2975,7 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t
    , capacity_( n )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
    , end_  ( begin_+(n+1UL) )           // Pointers one past the last non-zero element of each column
+   , partition_()                       // Cached non-zero balanced partition
 {
    begin_[0UL] = allocate<Element>( nonzeros );
    for( size_t j=1UL; j<(2UL*n_+1UL); ++j )
@@ -2931,6 +3004,7 @@ CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::ve
    , capacity_( n )                      // The current capacity of the pointer array
    , begin_( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
    , end_  ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+   , partition_()                        // Cached non-zero balanced partition
 {
    BLAZE_USER_ASSERT( nonzeros.size() == n, "Size of capacity vector and number of columns don't match" );
 
@@ -2960,6 +3034,7 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm
    , capacity_( sm.n_ )                     // The current capacity of the pointer array
    , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
    , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+   , partition_()                           // Cached non-zero balanced partition
 {
    const size_t nonzeros( sm.nonZeros() );
 
@@ -2985,6 +3060,7 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( CompressedMatrix&& sm ) no
    , capacity_( sm.capacity_ )  // The current capacity of the pointer array
    , begin_   ( sm.begin_ )     // Pointers to the first non-zero element of each column
    , end_     ( sm.end_ )       // Pointers one past the last non-zero element of each column
+   , partition_()               // Cached non-zero balanced partition
 {
    sm.m_        = 0UL;
    sm.n_        = 0UL;
@@ -3011,6 +3087,7 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>&
    , capacity_( n_ )                        // The current capacity of the pointer array
    , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
    , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+   , partition_()                           // Cached non-zero balanced partition
 {
    using blaze::assign;
 
@@ -3038,9 +3115,8 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
    , capacity_( n_ )                        // The current capacity of the pointer array
    , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
    , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+   , partition_()                           // Cached non-zero balanced partition
 {
-   using blaze::assign;
-
    const size_t nonzeros( (~sm).nonZeros() );
 
    begin_[0UL] = allocate<Element>( nonzeros );
@@ -3048,7 +3124,7 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
       begin_[j+1UL] = end_[j] = begin_[0UL];
    end_[n_] = begin_[0UL]+nonzeros;
 
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3363,6 +3439,8 @@ inline CompressedMatrix<Type,true>&
    m_ = rhs.m_;
    n_ = rhs.n_;
 
+   partition_.reset();
+
    return *this;
 }
 /*! \endcond */
@@ -3391,6 +3469,9 @@ inline CompressedMatrix<Type,true>&
    begin_    = rhs.begin_;
    end_      = rhs.end_;
 
+   partition_.swap( rhs.partition_ );
+   rhs.partition_.reset();
+
    rhs.m_        = 0UL;
    rhs.n_        = 0UL;
    rhs.capacity_ = 0UL;
@@ -3452,8 +3533,6 @@ template< typename MT      // Type of the right-hand side sparse matrix
 inline CompressedMatrix<Type,true>&
    CompressedMatrix<Type,true>::operator=( const SparseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).columns()  > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -3463,7 +3542,7 @@ inline CompressedMatrix<Type,true>&
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -3746,6 +3825,8 @@ inline void CompressedMatrix<Type,true>::reset()
 {
    for( size_t j=0UL; j<n_; ++j )
       end_[j] = begin_[j];
+
+   partition_.reset();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3766,6 +3847,7 @@ inline void CompressedMatrix<Type,true>::reset( size_t j )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    end_[j] = begin_[j];
+   partition_.reset();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3785,6 +3867,8 @@ inline void CompressedMatrix<Type,true>::clear()
    end_[0UL] = end_[n_];
    m_ = 0UL;
    n_ = 0UL;
+
+   partition_.reset();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3870,6 +3954,8 @@ template< typename Type >  // Data type of the sparse matrix
 typename CompressedMatrix<Type,true>::Iterator
    CompressedMatrix<Type,true>::insert( Iterator pos, size_t i, size_t j, const Type& value )
 {
+   partition_.reset();
+
    if( begin_[j+1UL] - end_[j] != 0 ) {
       std::move_backward( pos, end_[j], end_[j]+1UL );
       pos->value_ = value;
@@ -3949,6 +4035,8 @@ inline void CompressedMatrix<Type,true>::erase( size_t i, size_t j )
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
+   partition_.reset();
+
    const Iterator pos( find( i, j ) );
    if( pos != end_[j] )
       end_[j] = std::move( pos+1, end_[j], pos );
@@ -3974,6 +4062,8 @@ inline typename CompressedMatrix<Type,true>::Iterator
    BLAZE_USER_ASSERT( j < columns()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( pos >= begin_[j] && pos <= end_[j], "Invalid compressed matrix iterator" );
 
+   partition_.reset();
+
    if( pos != end_[j] )
       end_[j] = std::move( pos+1, end_[j], pos );
 
@@ -4003,6 +4093,8 @@ inline typename CompressedMatrix<Type,true>::Iterator
    BLAZE_USER_ASSERT( first >= begin_[j] && first <= end_[j], "Invalid compressed matrix iterator" );
    BLAZE_USER_ASSERT( last  >= begin_[j] && last  <= end_[j], "Invalid compressed matrix iterator" );
 
+   partition_.reset();
+
    if( first != last )
       end_[j] = std::move( last, end_[j], first );
 
@@ -4036,6 +4128,8 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 
    if( m == m_ && n == n_ ) return;
 
+   partition_.reset();
+
    if( begin_ == nullptr )
    {
       begin_ = new Iterator[2UL*n+2UL];
@@ -4345,6 +4439,7 @@ inline void CompressedMatrix<Type,true>::swap( CompressedMatrix& sm ) noexcept
    std::swap( capacity_, sm.capacity_ );
    std::swap( begin_, sm.begin_ );
    std::swap( end_  , sm.end_   );
+   partition_.swap( sm.partition_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -4633,6 +4728,8 @@ inline void CompressedMatrix<Type,true>::append( size_t i, size_t j, const Type&
    BLAZE_USER_ASSERT( end_[j] < end_[n_], "Not enough reserved capacity left" );
    BLAZE_USER_ASSERT( begin_[j] == end_[j] || i > ( end_[j]-1UL )->index_, "Index is not strictly increasing" );
 
+   partition_.reset();
+
    end_[j]->value_ = value;
 
    if( !check || !isDefault( end_[j]->value_ ) ) {
@@ -4663,6 +4760,8 @@ inline void CompressedMatrix<Type,true>::finalize( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid row access index" );
 
+   partition_.reset();
+
    begin_[j+1UL] = end_[j];
    if( j != n_-1UL )
       end_[j+1UL] = end_[j];
@@ -4671,6 +4770,29 @@ inline void CompressedMatrix<Type,true>::finalize( size_t j )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a non-zero balanced partition of the columns of the matrix.
+//
+// \param parts The number of parts \f$[1..\infty)\f$.
+// \return Reference to the partition.
+//
+// This function returns a partition of the columns of the matrix into \a parts contiguous
+// parts with approximately equal numbers of non-zero elements. The partition is computed on
+// demand and cached until the next modification of the sparsity pattern of the matrix.
+//
+// \note This function is thread-safe with respect to concurrent calls to partition(), but it
+// must not be called concurrently with a modification of the matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline const NonZeroPartition& CompressedMatrix<Type,true>::partition( size_t parts ) const
+{
+   return partition_.get( *this, parts );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -4761,6 +4883,8 @@ inline void CompressedMatrix<Type,true>::assign( const DenseMatrix<MT,SO>& rhs )
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
+   partition_.reset();
+
    if( m_ == 0UL || n_ == 0UL )
       return;
 
@@ -4825,6 +4949,8 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rh
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
    BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
 
+   partition_.reset();
+
    if( n_ == 0UL || begin_[0] == nullptr )
       return;
 
@@ -4859,6 +4985,8 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& r
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
    BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
 
+   partition_.reset();
+
    typedef ConstIterator_<MT>  RhsIterator;
 
    // Counting the number of elements per column
@@ -5023,6 +5151,10 @@ inline bool isIntact( const CompressedMatrix<Type,SO>& m );
 
 template< typename Type, bool SO >
 inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) noexcept;
+
+template< typename Type, bool SO >
+inline const NonZeroPartition&
+   nonZeroPartition( const CompressedMatrix<Type,SO>& m, size_t parts, NonZeroPartition& buffer );
 //@}
 //*************************************************************************************************
 
@@ -5152,6 +5284,29 @@ inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) n
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the cached non-zero balanced partition of the given compressed matrix.
+// \ingroup compressed_matrix
+//
+// \param m The compressed matrix to be partitioned.
+// \param parts The number of parts \f$[1..\infty)\f$.
+// \param buffer Unused partition buffer.
+// \return Reference to the cached partition of the matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline const NonZeroPartition&
+   nonZeroPartition( const CompressedMatrix<Type,SO>& m, size_t parts, NonZeroPartition& buffer )
+{
+   UNUSED_PARAMETER( buffer );
+
+   return m.partition( parts );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
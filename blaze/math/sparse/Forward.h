@@ -44,6 +44,7 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename, bool, typename > class CompactMatrix;
 template< typename, bool > class CompressedMatrix;
 template< typename, bool > class CompressedVector;
 
@@ -0,0 +1,804 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/MappedCSRMatrix.h
+//  \brief Implementation of a read-only view on a matrix in CSR format
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_MAPPEDCSRMATRIX_H_
+#define _BLAZE_MATH_SPARSE_MAPPEDCSRMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup mapped_csr_matrix MappedCSRMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-only view on an external row-major sparse matrix in CSR format.
+// \ingroup mapped_csr_matrix
+//
+// The MappedCSRMatrix class template represents a row-major sparse matrix whose elements are
+// stored in three external arrays in the compressed sparse row (CSR) format: an array of
+// \f$ M+1 \f$ row offsets, an array of column indices, and an array of values. The elements
+// of each row have to be sorted by their column index. In contrast to the CompressedMatrix,
+// the MappedCSRMatrix neither allocates nor copies any memory and can therefore be used to
+// directly work on sparse matrices residing in a memory mapped file (see mmapCSRMatrix()).
+// The type of the elements of the matrix can be specified via the template parameter:
+
+   \code
+   template< typename Type >
+   class MappedCSRMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. MappedCSRMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//
+// The optional owner of the arrays (as for instance the MemoryMap of the file containing the
+// arrays) is kept alive as long as any copy of the view exists. The following example shows
+// the use of a MappedCSRMatrix as right-hand side operand of several operations:
+
+   \code
+   using blaze::MappedCSRMatrix;
+
+   //     ( 1 0 2 )
+   // A = ( 0 0 3 )
+   const uint64_t offsets[] = { 0, 2, 3 };
+   const uint64_t indices[] = { 0, 2, 2 };
+   const double   values [] = { 1.0, 2.0, 3.0 };
+
+   MappedCSRMatrix<double> A( 2UL, 3UL, offsets, indices, values );
+
+   blaze::DynamicVector<double> x( 3UL, 1.0 ), y;
+   blaze::CompressedMatrix<double> B;
+
+   y = A * x;         // Sparse matrix/dense vector multiplication
+   B = trans( A );    // Transpose assignment to a column-major compressed matrix
+   \endcode
+
+// Since the view is read-only, a MappedCSRMatrix can not be used as left-hand side of an
+// assignment.
+*/
+template< typename Type >  // Data type of the sparse matrix
+class MappedCSRMatrix : public SparseMatrix< MappedCSRMatrix<Type>, rowMajor >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef MappedCSRMatrix<Type>               This;           //!< Type of this MappedCSRMatrix instance.
+   typedef SparseMatrix<This,rowMajor>         BaseType;       //!< Base type of this MappedCSRMatrix instance.
+   typedef CompressedMatrix<Type,rowMajor>     ResultType;     //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,columnMajor>  OppositeType;   //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,columnMajor>  TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef Type                                ElementType;    //!< Type of the sparse matrix elements.
+   typedef const Type&                         ReturnType;     //!< Return type for expression template evaluations.
+   typedef const This&                         CompositeType;  //!< Data type for composite expression templates.
+   typedef const Type&                         Reference;      //!< Reference to a sparse matrix value.
+   typedef const Type&                         ConstReference; //!< Reference to a constant sparse matrix value.
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of a single row of the CSR matrix.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef ValueIndexPair<Type>       ValueType;         //!< Type of the underlying elements.
+      typedef ValueType*                 PointerType;       //!< Pointer return type.
+      typedef ValueType&                 ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor of the ConstIterator class.
+      */
+      inline ConstIterator() noexcept
+         : index_( nullptr )  // Pointer to the column index of the current element
+         , value_( nullptr )  // Pointer to the value of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor of the ConstIterator class.
+      //
+      // \param index Pointer to the column index of the current element.
+      // \param value Pointer to the value of the current element.
+      */
+      inline ConstIterator( const uint64_t* index, const Type* value ) noexcept
+         : index_( index )  // Pointer to the column index of the current element
+         , value_( value )  // Pointer to the value of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() noexcept {
+         ++index_;
+         ++value_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) noexcept {
+         const ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The element at the current iterator position.
+      */
+      inline const ValueType operator*() const {
+         return ValueType( *value_, index() );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline const ConstIterator* operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Type& value() const noexcept {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const noexcept {
+         return static_cast<size_t>( *index_ );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const noexcept {
+         return index_ == rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const noexcept {
+         return index_ != rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const noexcept {
+         return index_ - rhs.index_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const uint64_t* index_;  //!< Pointer to the column index of the current element.
+      const Type*     value_;  //!< Pointer to the value of the current element.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef ConstIterator  Iterator;  //!< Iterator over the elements of the read-only matrix.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedCSRMatrix() noexcept;
+   explicit inline MappedCSRMatrix( size_t m, size_t n, const uint64_t* offsets,
+                                    const uint64_t* indices, const Type* values ) noexcept;
+   explicit inline MappedCSRMatrix( size_t m, size_t n, const uint64_t* offsets,
+                                    const uint64_t* indices, const Type* values,
+                                    std::shared_ptr<const void> owner ) noexcept;
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t          m_;        //!< The current number of rows of the sparse matrix.
+   size_t          n_;        //!< The current number of columns of the sparse matrix.
+   const uint64_t* offsets_;  //!< The offsets of the first element of each row.
+   const uint64_t* indices_;  //!< The column indices of the non-zero elements.
+   const Type*     values_;   //!< The values of the non-zero elements.
+
+   std::shared_ptr<const void> owner_;  //!< The owner of the external arrays.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Type >  // Data type of the sparse matrix
+const Type MappedCSRMatrix<Type>::zero_ = Type();
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for MappedCSRMatrix.
+//
+// The default constructor creates an empty \f$ 0 \times 0 \f$ view.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline MappedCSRMatrix<Type>::MappedCSRMatrix() noexcept
+   : m_      ( 0UL     )  // The current number of rows of the sparse matrix
+   , n_      ( 0UL     )  // The current number of columns of the sparse matrix
+   , offsets_( nullptr )  // The offsets of the first element of each row
+   , indices_( nullptr )  // The column indices of the non-zero elements
+   , values_ ( nullptr )  // The values of the non-zero elements
+   , owner_  ()           // The owner of the external arrays
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a view on the given CSR arrays.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param offsets The array of \f$ M+1 \f$ offsets of the first element of each row.
+// \param indices The array of column indices of the non-zero elements.
+// \param values The array of values of the non-zero elements.
+//
+// The given arrays have to stay valid as long as the view is used. Note that the arrays are
+// not checked for consistency!
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline MappedCSRMatrix<Type>::MappedCSRMatrix( size_t m, size_t n, const uint64_t* offsets,
+                                               const uint64_t* indices, const Type* values ) noexcept
+   : m_      ( m       )  // The current number of rows of the sparse matrix
+   , n_      ( n       )  // The current number of columns of the sparse matrix
+   , offsets_( offsets )  // The offsets of the first element of each row
+   , indices_( indices )  // The column indices of the non-zero elements
+   , values_ ( values  )  // The values of the non-zero elements
+   , owner_  ()           // The owner of the external arrays
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a view on the given CSR arrays with shared ownership.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param offsets The array of \f$ M+1 \f$ offsets of the first element of each row.
+// \param indices The array of column indices of the non-zero elements.
+// \param values The array of values of the non-zero elements.
+// \param owner The owner of the given arrays.
+//
+// The given owner of the arrays is kept alive as long as any copy of the view exists. Note
+// that the arrays are not checked for consistency!
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline MappedCSRMatrix<Type>::MappedCSRMatrix( size_t m, size_t n, const uint64_t* offsets,
+                                               const uint64_t* indices, const Type* values,
+                                               std::shared_ptr<const void> owner ) noexcept
+   : m_      ( m       )           // The current number of rows of the sparse matrix
+   , n_      ( n       )           // The current number of columns of the sparse matrix
+   , offsets_( offsets )           // The offsets of the first element of each row
+   , indices_( indices )           // The column indices of the non-zero elements
+   , values_ ( values  )           // The values of the non-zero elements
+   , owner_  ( std::move( owner ) )  // The owner of the external arrays
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename MappedCSRMatrix<Type>::ConstReference
+   MappedCSRMatrix<Type>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos == end( i ) || pos->index() != j )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename MappedCSRMatrix<Type>::ConstIterator
+   MappedCSRMatrix<Type>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return ConstIterator( indices_ + offsets_[i], values_ + offsets_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename MappedCSRMatrix<Type>::ConstIterator
+   MappedCSRMatrix<Type>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename MappedCSRMatrix<Type>::ConstIterator
+   MappedCSRMatrix<Type>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return ConstIterator( indices_ + offsets_[i+1UL], values_ + offsets_[i+1UL] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename MappedCSRMatrix<Type>::ConstIterator
+   MappedCSRMatrix<Type>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t MappedCSRMatrix<Type>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t MappedCSRMatrix<Type>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t MappedCSRMatrix<Type>::nonZeros() const noexcept
+{
+   return ( m_ > 0UL )?( static_cast<size_t>( offsets_[m_] - offsets_[0UL] ) ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t MappedCSRMatrix<Type>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return static_cast<size_t>( offsets_[i+1UL] - offsets_[i] );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename MappedCSRMatrix<Type>::ConstIterator
+   MappedCSRMatrix<Type>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename MappedCSRMatrix<Type>::ConstIterator
+   MappedCSRMatrix<Type>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const uint64_t* pos( std::lower_bound( indices_ + offsets_[i], indices_ + offsets_[i+1UL],
+                                          static_cast<uint64_t>( j ) ) );
+   return ConstIterator( pos, values_ + ( pos - indices_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename MappedCSRMatrix<Type>::ConstIterator
+   MappedCSRMatrix<Type>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const uint64_t* pos( std::upper_bound( indices_ + offsets_[i], indices_ + offsets_[i+1UL],
+                                          static_cast<uint64_t>( j ) ) );
+   return ConstIterator( pos, values_ + ( pos - indices_ ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type >   // Data type of the sparse matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool MappedCSRMatrix<Type>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type >   // Data type of the sparse matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool MappedCSRMatrix<Type>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline bool MappedCSRMatrix<Type>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct SubmatrixTrait< MappedCSRMatrix<T1> >
+{
+   using Type = CompressedMatrix<T1,rowMajor>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct RowTrait< MappedCSRMatrix<T1> >
+{
+   using Type = CompressedVector<T1,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct ColumnTrait< MappedCSRMatrix<T1> >
+{
+   using Type = CompressedVector<T1,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,458 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/NonZeroPartition.h
+//  \brief Header file for the non-zero balanced partitioning of sparse matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_NONZEROPARTITION_H_
+#define _BLAZE_MATH_SPARSE_NONZEROPARTITION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <forward_list>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Non-zero balanced partitioning of the rows/columns of a sparse matrix.
+// \ingroup sparse_matrix
+//
+// The NonZeroPartition class splits the rows of a row-major sparse matrix (or the columns of
+// a column-major sparse matrix) into a given number of contiguous parts such that every part
+// contains approximately the same number of non-zero elements. In contrast to a split into
+// parts of equal size, this results in a balanced workload for sparse matrices with a very
+// irregular distribution of the non-zero elements (as for instance in case of power-law
+// graphs). Part \a p covers the index range \f$ [begin(p)..end(p)) \f$, which might be empty.
+*/
+class NonZeroPartition
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline NonZeroPartition();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t parts  () const noexcept;
+   inline size_t begin  ( size_t p ) const noexcept;
+   inline size_t end    ( size_t p ) const noexcept;
+   inline bool   isValid( size_t size, size_t parts ) const noexcept;
+
+   template< typename MT, bool SO >
+   inline void compute( const SparseMatrix<MT,SO>& sm, size_t parts );
+
+   inline void reset() noexcept;
+   inline void swap ( NonZeroPartition& p ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;                 //!< The number of partitioned rows/columns.
+   std::vector<size_t> bounds_;  //!< The boundaries of the parts.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for NonZeroPartition.
+//
+// The default constructor creates an empty, invalid partition.
+*/
+inline NonZeroPartition::NonZeroPartition()
+   : size_  ( 0UL )  // The number of partitioned rows/columns
+   , bounds_()       // The boundaries of the parts
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of parts of the partition.
+//
+// \return The number of parts.
+*/
+inline size_t NonZeroPartition::parts() const noexcept
+{
+   return ( bounds_.empty() )?( 0UL ):( bounds_.size() - 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the first row/column of the given part.
+//
+// \param p The index of the part.
+// \return The index of the first row/column of the part.
+*/
+inline size_t NonZeroPartition::begin( size_t p ) const noexcept
+{
+   BLAZE_USER_ASSERT( p < parts(), "Invalid part access index" );
+   return bounds_[p];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the row/column one past the last row/column of the given part.
+//
+// \param p The index of the part.
+// \return The index one past the last row/column of the part.
+*/
+inline size_t NonZeroPartition::end( size_t p ) const noexcept
+{
+   BLAZE_USER_ASSERT( p < parts(), "Invalid part access index" );
+   return bounds_[p+1UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the partition matches the given number of rows/columns and parts.
+//
+// \param size The number of rows/columns to be partitioned.
+// \param parts The number of parts.
+// \return \a true if the partition can be reused, \a false if it has to be recomputed.
+*/
+inline bool NonZeroPartition::isValid( size_t size, size_t parts ) const noexcept
+{
+   return size_ == size && bounds_.size() == parts + 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the partition for the given sparse matrix.
+//
+// \param sm The sparse matrix to be partitioned.
+// \param parts The number of parts \f$[1..\infty)\f$.
+// \return void
+//
+// This function computes a partition of the rows (in case of a row-major matrix) or columns
+// (in case of a column-major matrix) of the given sparse matrix based on the prefix sum over
+// the number of non-zero elements. Each row/column is weighted with its number of non-zero
+// elements plus one to account for the update of the according result element.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline void NonZeroPartition::compute( const SparseMatrix<MT,SO>& sm, size_t parts )
+{
+   BLAZE_USER_ASSERT( parts > 0UL, "Invalid number of parts detected" );
+
+   const size_t size( SO ? (~sm).columns() : (~sm).rows() );
+   const size_t total( (~sm).nonZeros() + size );
+
+   size_ = size;
+   bounds_.resize( parts + 1UL );
+   bounds_[0UL] = 0UL;
+
+   size_t part( 1UL );
+   size_t acc ( 0UL );
+
+   for( size_t i=0UL; i<size && part<parts; ++i ) {
+      acc += (~sm).nonZeros(i) + 1UL;
+      while( part < parts && acc*parts >= part*total ) {
+         bounds_[part] = i + 1UL;
+         ++part;
+      }
+   }
+
+   for( ; part<=parts; ++part ) {
+      bounds_[part] = size;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the partition to its default, invalid state.
+//
+// \return void
+//
+// Resetting an already invalid partition doesn't modify the partition. Therefore several
+// threads can concurrently modify disjoint rows/columns of a sparse matrix with an invalid
+// cached partition.
+*/
+inline void NonZeroPartition::reset() noexcept
+{
+   if( size_ != 0UL || !bounds_.empty() ) {
+      size_ = 0UL;
+      bounds_.clear();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two partitions.
+//
+// \param p The partition to be swapped.
+// \return void
+*/
+inline void NonZeroPartition::swap( NonZeroPartition& p ) noexcept
+{
+   std::swap( size_, p.size_ );
+   bounds_.swap( p.bounds_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS NONZEROPARTITIONCACHE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Thread-safe cache for the non-zero balanced partitions of a sparse matrix.
+// \ingroup sparse_matrix
+//
+// The NonZeroPartitionCache class stores the partitions of a sparse matrix that have been
+// requested via get(). Since get() is called by const member functions, several threads may
+// request a partition of the same matrix concurrently (as for instance two concurrent parallel
+// multiplications with the same matrix). Therefore the lookup and the computation of a partition
+// are protected by a mutex. A computed partition is never modified or moved until the cache is
+// reset, i.e. the reference returned by get() stays valid until the next modification of the
+// matrix, even if another thread requests a partition with a different number of parts. Since
+// the modification of a matrix must not happen concurrently with any other access, reset()
+// doesn't lock the mutex.
+*/
+class NonZeroPartitionCache
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline NonZeroPartitionCache();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   inline const NonZeroPartition& get( const SparseMatrix<MT,SO>& sm, size_t parts ) const;
+
+   inline void reset() noexcept;
+   inline void swap ( NonZeroPartitionCache& c ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   mutable std::forward_list<NonZeroPartition> partitions_;  //!< The cached partitions.
+   mutable std::mutex mutex_;                                //!< Synchronization mutex for get().
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The default constructor for NonZeroPartitionCache.
+//
+// The default constructor creates an empty cache.
+*/
+inline NonZeroPartitionCache::NonZeroPartitionCache()
+   : partitions_()  // The cached partitions
+   , mutex_     ()  // Synchronization mutex for get()
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the partition of the given sparse matrix into the given number of parts.
+//
+// \param sm The sparse matrix to be partitioned.
+// \param parts The number of parts \f$[1..\infty)\f$.
+// \return Reference to the cached partition.
+//
+// This function returns the cached partition of the given sparse matrix into \a parts parts.
+// In case no such partition has been cached yet, the partition is computed and added to the
+// cache. This function is thread-safe.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline const NonZeroPartition&
+   NonZeroPartitionCache::get( const SparseMatrix<MT,SO>& sm, size_t parts ) const
+{
+   const size_t size( SO ? (~sm).columns() : (~sm).rows() );
+
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   for( const NonZeroPartition& partition : partitions_ ) {
+      if( partition.isValid( size, parts ) )
+         return partition;
+   }
+
+   NonZeroPartition partition;
+   partition.compute( ~sm, parts );
+   partitions_.push_front( std::move( partition ) );
+
+   return partitions_.front();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes all cached partitions.
+//
+// \return void
+//
+// Resetting an empty cache doesn't modify the cache. Therefore several threads can concurrently
+// modify disjoint rows/columns of a sparse matrix with an empty cache.
+*/
+inline void NonZeroPartitionCache::reset() noexcept
+{
+   if( !partitions_.empty() )
+      partitions_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the cached partitions of two caches.
+//
+// \param c The cache to be swapped.
+// \return void
+//
+// This function must not be called concurrently with get() on any of the two caches.
+*/
+inline void NonZeroPartitionCache::swap( NonZeroPartitionCache& c ) noexcept
+{
+   partitions_.swap( c.partitions_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name NonZeroPartition functions */
+//@{
+template< typename MT, bool SO >
+inline const NonZeroPartition&
+   nonZeroPartition( const SparseMatrix<MT,SO>& sm, size_t parts, NonZeroPartition& buffer );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a non-zero balanced partition of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The sparse matrix to be partitioned.
+// \param parts The number of parts \f$[1..\infty)\f$.
+// \param buffer Storage for the partition in case the matrix does not provide a cached partition.
+// \return Reference to the partition.
+//
+// This function returns a partition of the rows (row-major) or columns (column-major) of the
+// given sparse matrix into \a parts contiguous parts with approximately equal numbers of
+// non-zero elements. Sparse matrices that cache their partition (as for instance the
+// CompressedMatrix) provide a more specialized overload that returns the cached partition and
+// doesn't touch the given buffer.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline const NonZeroPartition&
+   nonZeroPartition( const SparseMatrix<MT,SO>& sm, size_t parts, NonZeroPartition& buffer )
+{
+   buffer.compute( ~sm, parts );
+   return buffer;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,508 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SparseAccumulator.h
+//  \brief Header file for the accumulator of the row-wise sparse matrix multiplication
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPARSEACCUMULATOR_H_
+#define _BLAZE_MATH_SPARSE_SPARSEACCUMULATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Accumulator for the row-wise (Gustavson) multiplication of two sparse matrices.
+// \ingroup sparse_matrix
+//
+// The SparseAccumulator class template computes single rows of the product \f$ C=A*B \f$ of two
+// row-major sparse matrices. Row \a i of \a C is the sum of the rows of \a B selected by the
+// non-zero elements of row \a i of \a A. The number of scalar multiplications (the \a flops)
+// required for the row decides how the partial results are accumulated:
+//
+//  - Rows with a large number of flops relative to the number of columns and rows with column
+//    indices in a narrow window are accumulated in a dense array of size \a n (the classic
+//    sparse accumulator). This array is only allocated in case it is required at least once
+//    and is never cleared explicitly: a row stamp marks the occupied entries.
+//  - All other rows are accumulated in an open-addressing hash table that is sized according
+//    to the number of flops of the row. This keeps the memory traffic independent of the number
+//    of columns, which is crucial for wide matrices with scattered column indices.
+//
+// The count() function performs the symbolic phase of the multiplication and returns the exact
+// number of non-zero elements of a row of the result, the multiply() function performs the
+// numeric phase and appends the non-zero elements of the row to the target matrix. Since every
+// accumulator holds its own workspace, several accumulators can be used concurrently on
+// disjoint rows of the same target matrix.
+*/
+template< typename Type >  // Data type of the accumulated elements
+class SparseAccumulator
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline SparseAccumulator( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT1, typename MT2 >
+   inline size_t flops( const MT1& A, const MT2& B, size_t i ) const;
+
+   template< typename MT1, typename MT2 >
+   size_t count( const MT1& A, const MT2& B, size_t i );
+
+   template< typename MT1, typename MT2, typename MT3 >
+   void multiply( MT3& C, const MT1& A, const MT2& B, size_t i );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool   useDense ( size_t flops ) const noexcept;
+   inline void   initDense();
+   inline size_t initHash ( size_t flops );
+   inline size_t hash     ( size_t j ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member constants****************************************************************************
+   /*!\name Member constants */
+   //@{
+   enum : size_t { denseRatio = 16UL };        //!< Flops ratio for the use of the dense accumulator.
+   enum : size_t { windowSize = 16384UL };     //!< Column window for the use of the dense accumulator.
+   enum : size_t { empty      = ~size_t(0) };  //!< Marker for an unoccupied slot of the hash table.
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                        //!< The number of columns of the result.
+   size_t stamp_;                    //!< The stamp of the current row of the dense accumulator.
+   size_t shift_;                    //!< The shift of the hash function of the current row.
+   size_t span_;                     //!< The column index span of the previous row.
+   std::vector<size_t> marker_;      //!< The row stamps of the dense accumulator.
+   std::vector<Type>   values_;      //!< The values of the dense accumulator.
+   std::vector<size_t> keys_;        //!< The column indices of the hash table.
+   std::vector<Type>   hashValues_;  //!< The values of the hash table.
+   std::vector<size_t> indices_;     //!< The column indices/hash slots of the current row.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for SparseAccumulator.
+//
+// \param n The number of columns of the result matrix.
+//
+// The constructor doesn't allocate any memory. The workspace is allocated on demand and reused
+// for all subsequent rows.
+*/
+template< typename Type >  // Data type of the accumulated elements
+inline SparseAccumulator<Type>::SparseAccumulator( size_t n )
+   : n_         ( n   )  // The number of columns of the result
+   , stamp_     ( 0UL )  // The stamp of the current row of the dense accumulator
+   , shift_     ( 0UL )  // The shift of the hash function of the current row
+   , span_      ( n   )  // The column index span of the previous row
+   , marker_    ()       // The row stamps of the dense accumulator
+   , values_    ()       // The values of the dense accumulator
+   , keys_      ()       // The column indices of the hash table
+   , hashValues_()       // The values of the hash table
+   , indices_   ()       // The column indices/hash slots of the current row
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of scalar multiplications required for a row of the product.
+//
+// \param A The left-hand side row-major sparse matrix operand.
+// \param B The right-hand side row-major sparse matrix operand.
+// \param i The index of the row.
+// \return The number of scalar multiplications for row \a i of \f$ A*B \f$.
+//
+// The number of flops is an upper bound for the number of non-zero elements of the row.
+*/
+template< typename Type >  // Data type of the accumulated elements
+template< typename MT1     // Type of the left-hand side sparse matrix operand
+        , typename MT2 >   // Type of the right-hand side sparse matrix operand
+inline size_t SparseAccumulator<Type>::flops( const MT1& A, const MT2& B, size_t i ) const
+{
+   typedef ConstIterator_<MT1>  LeftIterator;
+
+   size_t flops( 0UL );
+
+   const LeftIterator lend( A.end(i) );
+   for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+      flops += B.nonZeros( lelem->index() );
+   }
+
+   return flops;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the exact number of non-zero elements of a row of the product.
+//
+// \param A The left-hand side row-major sparse matrix operand.
+// \param B The right-hand side row-major sparse matrix operand.
+// \param i The index of the row.
+// \return The number of structural non-zero elements of row \a i of \f$ A*B \f$.
+//
+// This function performs the symbolic phase of the multiplication for row \a i. The returned
+// number of elements is exact with respect to the sparsity pattern. Due to numeric cancellation
+// the numeric phase might store less elements, but never more.
+*/
+template< typename Type >  // Data type of the accumulated elements
+template< typename MT1     // Type of the left-hand side sparse matrix operand
+        , typename MT2 >   // Type of the right-hand side sparse matrix operand
+size_t SparseAccumulator<Type>::count( const MT1& A, const MT2& B, size_t i )
+{
+   typedef ConstIterator_<MT1>  LeftIterator;
+   typedef ConstIterator_<MT2>  RightIterator;
+
+   const size_t flops( this->flops( A, B, i ) );
+
+   if( flops == 0UL )
+      return 0UL;
+
+   const LeftIterator lend( A.end(i) );
+   size_t nonzeros( 0UL );
+   size_t minIndex( n_ ), maxIndex( 0UL );
+
+   if( useDense( flops ) )
+   {
+      initDense();
+
+      for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+         const RightIterator rend( B.end( lelem->index() ) );
+         for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem ) {
+            const size_t j( relem->index() );
+            if( marker_[j] != stamp_ ) {
+               marker_[j] = stamp_;
+               ++nonzeros;
+               if( j < minIndex ) minIndex = j;
+               if( j > maxIndex ) maxIndex = j;
+            }
+         }
+      }
+   }
+   else
+   {
+      const size_t mask( initHash( flops ) );
+
+      for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+         const RightIterator rend( B.end( lelem->index() ) );
+         for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem ) {
+            const size_t j( relem->index() );
+            for( size_t pos=hash(j); ; pos=(pos+1UL)&mask ) {
+               if( keys_[pos] == j ) break;
+               if( keys_[pos] == empty ) {
+                  keys_[pos] = j;
+                  indices_.push_back( pos );
+                  break;
+               }
+            }
+         }
+      }
+
+      nonzeros = indices_.size();
+
+      for( size_t k=0UL; k<nonzeros; ++k ) {
+         const size_t j( keys_[indices_[k]] );
+         if( j < minIndex ) minIndex = j;
+         if( j > maxIndex ) maxIndex = j;
+         keys_[indices_[k]] = empty;
+      }
+   }
+
+   span_ = maxIndex - minIndex + 1UL;
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a row of the product and appends it to the target matrix.
+//
+// \param C The target row-major sparse matrix.
+// \param A The left-hand side row-major sparse matrix operand.
+// \param B The right-hand side row-major sparse matrix operand.
+// \param i The index of the row.
+// \return void
+//
+// This function performs the numeric phase of the multiplication for row \a i. The non-zero
+// elements of row \a i of \f$ A*B \f$ are appended to row \a i of \a C via the \c append()
+// function in ascending order of their column indices. Elements that cancel out to their
+// default value are not stored. Note that row \a i of \a C is not finalized and that \a C
+// must provide sufficient capacity (see the count() function).
+*/
+template< typename Type >  // Data type of the accumulated elements
+template< typename MT1     // Type of the left-hand side sparse matrix operand
+        , typename MT2     // Type of the right-hand side sparse matrix operand
+        , typename MT3 >   // Type of the target sparse matrix
+void SparseAccumulator<Type>::multiply( MT3& C, const MT1& A, const MT2& B, size_t i )
+{
+   typedef ConstIterator_<MT1>  LeftIterator;
+   typedef ConstIterator_<MT2>  RightIterator;
+
+   const size_t flops( this->flops( A, B, i ) );
+
+   if( flops == 0UL )
+      return;
+
+   const LeftIterator lend( A.end(i) );
+
+   if( useDense( flops ) )
+   {
+      initDense();
+      indices_.clear();
+
+      size_t minIndex( n_ ), maxIndex( 0UL );
+
+      for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+         const RightIterator rend( B.end( lelem->index() ) );
+         for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem ) {
+            const size_t j( relem->index() );
+            if( marker_[j] != stamp_ ) {
+               marker_[j] = stamp_;
+               values_[j] = lelem->value() * relem->value();
+               indices_.push_back( j );
+               if( j < minIndex ) minIndex = j;
+               if( j > maxIndex ) maxIndex = j;
+            }
+            else {
+               values_[j] += lelem->value() * relem->value();
+            }
+         }
+      }
+
+      const size_t nonzeros( indices_.size() );
+
+      span_ = maxIndex - minIndex + 1UL;
+
+      if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) )
+      {
+         std::sort( indices_.begin(), indices_.end() );
+
+         for( size_t k=0UL; k<nonzeros; ++k ) {
+            const size_t j( indices_[k] );
+            if( !isDefault( values_[j] ) )
+               C.append( i, j, values_[j] );
+         }
+      }
+      else
+      {
+         for( size_t j=minIndex; j<=maxIndex; ++j ) {
+            if( marker_[j] == stamp_ && !isDefault( values_[j] ) )
+               C.append( i, j, values_[j] );
+         }
+      }
+   }
+   else
+   {
+      const size_t mask( initHash( flops ) );
+
+      for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+         const RightIterator rend( B.end( lelem->index() ) );
+         for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem ) {
+            const size_t j( relem->index() );
+            for( size_t pos=hash(j); ; pos=(pos+1UL)&mask ) {
+               if( keys_[pos] == j ) {
+                  hashValues_[pos] += lelem->value() * relem->value();
+                  break;
+               }
+               if( keys_[pos] == empty ) {
+                  keys_[pos] = j;
+                  hashValues_[pos] = lelem->value() * relem->value();
+                  indices_.push_back( pos );
+                  break;
+               }
+            }
+         }
+      }
+
+      const std::vector<size_t>& keys( keys_ );
+      std::sort( indices_.begin(), indices_.end(),
+                 [&keys]( size_t a, size_t b ) { return keys[a] < keys[b]; } );
+
+      span_ = keys_[indices_.back()] - keys_[indices_.front()] + 1UL;
+
+      for( size_t k=0UL; k<indices_.size(); ++k ) {
+         const size_t pos( indices_[k] );
+         if( !isDefault( hashValues_[pos] ) )
+            C.append( i, keys_[pos], hashValues_[pos] );
+         keys_[pos] = empty;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether a row with the given number of flops uses the dense accumulator.
+//
+// \param flops The number of scalar multiplications of the row.
+// \return \a true for the dense accumulator, \a false for the hash table.
+//
+// Rows with at least \f$ n/16 \f$ flops are expected to touch a considerable fraction of the
+// columns and are therefore accumulated in the dense array. Additionally, the dense array is
+// used in case the column indices of the previous row were confined to a window of at most
+// 16384 columns. In this case the accessed part of the dense array is expected to remain in
+// cache (as for instance for banded matrices and for the products of a multigrid hierarchy).
+*/
+template< typename Type >  // Data type of the accumulated elements
+inline bool SparseAccumulator<Type>::useDense( size_t flops ) const noexcept
+{
+   return ( flops * denseRatio >= n_ ) || ( span_ <= windowSize );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prepares the dense accumulator for a new row.
+//
+// \return void
+*/
+template< typename Type >  // Data type of the accumulated elements
+inline void SparseAccumulator<Type>::initDense()
+{
+   if( marker_.empty() ) {
+      marker_.resize( n_, 0UL );
+      values_.resize( n_ );
+   }
+
+   ++stamp_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prepares the hash table for a new row with the given number of flops.
+//
+// \param flops The number of scalar multiplications of the row.
+// \return The bit mask for the hash table slots.
+//
+// The hash table is sized to the smallest power of two that is at least twice the maximum
+// number of non-zero elements of the row, which limits the load factor to 0.5. All slots of
+// the hash table are unoccupied between two rows.
+*/
+template< typename Type >  // Data type of the accumulated elements
+inline size_t SparseAccumulator<Type>::initHash( size_t flops )
+{
+   const size_t nonzeros( std::min( flops, n_ ) );
+
+   size_t bits( 1UL );
+   while( ( 1UL << bits ) < nonzeros + nonzeros )
+      ++bits;
+
+   const size_t size( 1UL << bits );
+
+   if( keys_.size() < size ) {
+      keys_.resize( size, empty );
+      hashValues_.resize( size );
+   }
+
+   shift_ = sizeof(size_t) * 8UL - bits;
+   indices_.clear();
+
+   return size - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the hash table slot for the given column index.
+//
+// \param j The column index.
+// \return The initial slot of the column index.
+//
+// The column index is scrambled by a multiplicative (Fibonacci) hash, whose upper bits are
+// well distributed even for strided column indices.
+*/
+template< typename Type >  // Data type of the accumulated elements
+inline size_t SparseAccumulator<Type>::hash( size_t j ) const noexcept
+{
+   return static_cast<size_t>( j * static_cast<size_t>( 11400714819323198485ULL ) ) >> shift_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
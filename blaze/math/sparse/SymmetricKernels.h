@@ -0,0 +1,270 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SymmetricKernels.h
+//  \brief Header file for the symmetric sparse matrix multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SYMMETRICKERNELS_H_
+#define _BLAZE_MATH_SPARSE_SYMMETRICKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/Fused.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SPARSESYMVKERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused kernel for the multiplication of a symmetric sparse matrix with a dense vector.
+// \ingroup sparse_matrix
+//
+// The SparseSymvKernel class template computes \f$ \vec{y}=\alpha*A*\vec{x} \f$ for a row-major
+// symmetric sparse matrix \a A by traversing only the non-zero elements \f$ a_{kj} \f$ with
+// \f$ j \leq k \f$ of each row \a k. Every off-diagonal element contributes both to element
+// \a k and to element \a j of the result. Since the latter are scattered over the complete
+// result, each range of rows accumulates its contribution in a separate vector, which is
+// returned and combined by the smpFused() function. Unit \a u of the kernel represents the
+// rows \a u and \f$ n-1-u \f$, which balances the triangular workload between the ranges.
+*/
+template< typename MT      // Type of the symmetric sparse matrix
+        , typename VT      // Type of the dense vector
+        , typename Type >  // Data type of the elements
+struct SparseSymvKernel
+{
+   //**Type definitions****************************************************************************
+   using ResultType = DynamicVector<Type,false>;  //!< Result type of the kernel.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! The granularity of the ranges of pairs of rows.
+   enum : size_t { granularity = 1UL };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SparseSymvKernel class template.
+   //
+   // \param A The symmetric sparse matrix.
+   // \param x The right-hand side dense vector.
+   // \param alpha The scaling factor.
+   // \param parallel \a true in case the kernel should be evaluated in parallel.
+   */
+   explicit inline SparseSymvKernel( const MT& A, const VT& x,
+                                     const Type& alpha, bool parallel ) noexcept
+      : A_       ( A        )  // The symmetric sparse matrix
+      , x_       ( x        )  // The right-hand side dense vector
+      , alpha_   ( alpha    )  // The scaling factor
+      , parallel_( parallel )  // Flag for the parallel evaluation
+   {}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the number of units processed by the kernel.
+   //
+   // \return The number of pairs of rows of the matrix.
+   */
+   inline size_t size() const noexcept {
+      return ( A_.rows() + 1UL ) / 2UL;
+   }
+
+   /*!\brief Returns whether the kernel can be evaluated in parallel.
+   //
+   // \return \a true in case the kernel can be evaluated in parallel, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return parallel_;
+   }
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the contribution of the given range of pairs of rows.
+   //
+   // \param begin The index of the first unit of the range.
+   // \param end The index one past the last unit of the range.
+   // \return The partial result of the multiplication.
+   */
+   inline ResultType operator()( size_t begin, size_t end ) const
+   {
+      ResultType acc( A_.rows(), Type() );
+      apply( acc, begin, end );
+      return acc;
+   }
+   //**********************************************************************************************
+
+   //**Apply function******************************************************************************
+   /*!\brief Adds the contribution of the given range of pairs of rows to the given vector.
+   //
+   // \param y The target dense vector.
+   // \param begin The index of the first unit of the range.
+   // \param end The index one past the last unit of the range.
+   // \return void
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   inline void apply( VT1& y, size_t begin, size_t end ) const
+   {
+      const size_t n( A_.rows() );
+
+      for( size_t u=begin; u<end; ++u )
+      {
+         const size_t k( n - 1UL - u );
+
+         applyRow( y, u );
+
+         if( k != u ) {
+            applyRow( y, k );
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Row kernel**********************************************************************************
+   /*!\brief Adds the contribution of the lower part of row \a k to the given vector.
+   //
+   // \param y The target dense vector.
+   // \param k The index of the row.
+   // \return void
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   inline void applyRow( VT1& y, size_t k ) const
+   {
+      const Type s( alpha_ * x_[k] );
+
+      Type value = Type();
+
+      const auto end( A_.end(k) );
+      for( auto element=A_.begin(k); element!=end; ++element )
+      {
+         const size_t j( element->index() );
+
+         if( j < k ) {
+            value += element->value() * x_[j];
+            y[j]  += element->value() * s;
+         }
+         else {
+            if( j == k ) {
+               y[k] += element->value() * s;
+            }
+            break;
+         }
+      }
+
+      y[k] += alpha_ * value;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const MT& A_;         //!< The symmetric sparse matrix.
+   const VT& x_;         //!< The right-hand side dense vector.
+   Type      alpha_;     //!< The scaling factor.
+   bool      parallel_;  //!< Flag for the parallel evaluation.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SYMMETRIC SPARSE MATRIX/DENSE VECTOR MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Symmetric kernel for a row-major sparse matrix/dense vector multiplication
+//        (\f$ \vec{y}+=\alpha*A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side symmetric sparse matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \return void
+//
+// This function performs the multiplication of a symmetric sparse matrix with a dense vector
+// by traversing only the lower triangle of \a A (see SparseSymvKernel). In case of a parallel
+// evaluation each thread accumulates its contribution in a separate vector, i.e. the threads
+// never write to the same elements. Small matrices are directly accumulated in \a y.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename MT1   // Type of the left-hand side matrix operand
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scaling factor
+inline void symv( DenseVector<VT1,false>& y, const SparseMatrix<MT1,false>& A,
+                  const DenseVector<VT2,false>& x, ST alpha )
+{
+   typedef ElementType_<VT1>  ET;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT2 );
+
+   BLAZE_STATIC_ASSERT( IsSymmetric<MT1>::value );
+
+   BLAZE_INTERNAL_ASSERT( (~A).rows()    == (~y).size(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~x).size(), "Invalid vector size" );
+
+   const SparseSymvKernel<MT1,VT2,ET> kernel( ~A, ~x, ET( alpha ),
+                                              (~A).rows() > SMP_SMATDVECMULT_THRESHOLD );
+
+   if( kernel.canSMPAssign() ) {
+      addAssign( ~y, smpFused( kernel ) );
+   }
+   else {
+      kernel.apply( ~y, 0UL, kernel.size() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
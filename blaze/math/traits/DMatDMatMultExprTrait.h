@@ -42,6 +42,7 @@
 
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/util/InvalidType.h>
 #include <blaze/util/mpl/And.h>
@@ -80,7 +81,9 @@ struct DMatDMatMultExprTrait
    /*! \cond BLAZE_INTERNAL */
    using Tmp = If< And< IsDenseMatrix<MT1>, IsRowMajorMatrix<MT1>
                       , IsDenseMatrix<MT2>, IsRowMajorMatrix<MT2> >
-                 , DMatDMatMultExpr<MT1,MT2>
+                 , If_< Or< IsMatMatMultExpr<MT1>, IsMatMatMultExpr<MT2> >
+                      , DMatChainMultExpr<MT1,MT2,false>
+                      , DMatDMatMultExpr<MT1,MT2> >
                  , INVALID_TYPE >;
    /*! \endcond */
    //**********************************************************************************************
@@ -43,6 +43,7 @@
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/util/InvalidType.h>
 #include <blaze/util/mpl/And.h>
@@ -82,7 +83,9 @@ struct DMatTDMatMultExprTrait
    /*! \cond BLAZE_INTERNAL */
    using Tmp = If< And< IsDenseMatrix<MT1>, IsRowMajorMatrix<MT1>
                       , IsDenseMatrix<MT2>, IsColumnMajorMatrix<MT2> >
-                 , DMatTDMatMultExpr<MT1,MT2>
+                 , If_< Or< IsMatMatMultExpr<MT1>, IsMatMatMultExpr<MT2> >
+                      , DMatChainMultExpr<MT1,MT2,false>
+                      , DMatTDMatMultExpr<MT1,MT2> >
                  , INVALID_TYPE >;
    /*! \endcond */
    //**********************************************************************************************
@@ -43,6 +43,7 @@
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsSparseMatrix.h>
 #include <blaze/util/InvalidType.h>
@@ -82,7 +83,9 @@ struct DMatTSMatMultExprTrait
    /*! \cond BLAZE_INTERNAL */
    using Tmp = If< And< IsDenseMatrix<MT1> , IsRowMajorMatrix<MT1>
                       , IsSparseMatrix<MT2>, IsColumnMajorMatrix<MT2> >
-                 , DMatTSMatMultExpr<MT1,MT2>
+                 , If_< Or< IsMatMatMultExpr<MT1>, IsMatMatMultExpr<MT2> >
+                      , DMatChainMultExpr<MT1,MT2,false>
+                      , DMatTSMatMultExpr<MT1,MT2> >
                  , INVALID_TYPE >;
    /*! \endcond */
    //**********************************************************************************************
@@ -42,6 +42,7 @@
 
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsSparseMatrix.h>
 #include <blaze/util/InvalidType.h>
@@ -81,7 +82,9 @@ struct SMatDMatMultExprTrait
    /*! \cond BLAZE_INTERNAL */
    using Tmp = If< And< IsSparseMatrix<MT1>, IsRowMajorMatrix<MT1>
                       , IsDenseMatrix<MT2> , IsRowMajorMatrix<MT2> >
-                 , SMatDMatMultExpr<MT1,MT2>
+                 , If_< Or< IsMatMatMultExpr<MT1>, IsMatMatMultExpr<MT2> >
+                      , DMatChainMultExpr<MT1,MT2,false>
+                      , SMatDMatMultExpr<MT1,MT2> >
                  , INVALID_TYPE >;
    /*! \endcond */
    //**********************************************************************************************
@@ -0,0 +1,201 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/traits/SchurTrait.h
+//  \brief Header file for the Schur product trait
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_TRAITS_SCHURTRAIT_H_
+#define _BLAZE_MATH_TRAITS_SCHURTRAIT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsMatrix.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/InvalidType.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsReference.h>
+#include <blaze/util/typetraits/IsVolatile.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Base template for the SchurTrait class.
+// \ingroup math_traits
+//
+// \section schurtrait_general General
+//
+// The SchurTrait class template offers the possibility to select the resulting data type of a
+// generic Schur product (i.e. an elementwise multiplication) between the two given matrix types
+// \a T1 and \a T2. SchurTrait defines the nested type \a Type, which represents the resulting
+// data type of the Schur product. In case \a T1 and \a T2 are not both matrix types, the
+// resulting data type \a Type is set to \a INVALID_TYPE. Note that \c const and \c volatile
+// qualifiers and reference modifiers are generally ignored.
+//
+// In contrast to the AddTrait and MultTrait class templates, which are specialized for every
+// single matrix type, SchurTrait derives the resulting type from the general properties of the
+// two operands: The element type of the result is the result of the multiplication of the two
+// element types. In case at least one of the two operands is a sparse matrix, the result is a
+// blaze::CompressedMatrix with the storage order of the (first) sparse operand, since the Schur
+// product contains at most as many non-zero elements as the sparse operand. Otherwise the result
+// is a blaze::StaticMatrix in case both dimensions are known at compile time and a
+// blaze::DynamicMatrix in all other cases, both with the storage order of the left-hand side
+// operand.
+//
+//
+// \n \section schurtrait_specializations Creating custom specializations
+//
+// It is possible to specialize the SchurTrait template for additional user-defined data types.
+// The following example shows the according specialization for the Schur product between two
+// hybrid row-major matrices:
+
+   \code
+   template< typename T1, size_t M, size_t N, typename T2 >
+   struct SchurTrait< HybridMatrix<T1,M,N,false>, HybridMatrix<T2,M,N,false> >
+   {
+      using Type = HybridMatrix< MultTrait_<T1,T2>, M, N, false >;
+   };
+   \endcode
+
+// \n \section schurtrait_examples Examples
+//
+// The following example demonstrates the use of the SchurTrait template, where depending on
+// the two given data types the resulting data type is selected:
+
+   \code
+   template< typename T1, typename T2 >  // The two generic types
+   typename SchurTrait<T1,T2>::Type      // The resulting generic return type
+   schur( const T1& t1, const T2& t2 )   //
+   {                                     // The function 'schur' returns the Schur
+      return t1 % t2;                    // product of the two given matrices
+   }                                     //
+   \endcode
+*/
+template< typename T1        // Type of the left-hand side operand
+        , typename T2        // Type of the right-hand side operand
+        , typename = void >  // Restricting condition
+struct SchurTrait
+{
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   struct Failure { using Type = INVALID_TYPE; };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   using Type = typename If_< Or< IsConst<T1>, IsVolatile<T1>, IsReference<T1>
+                                , IsConst<T2>, IsVolatile<T2>, IsReference<T2> >
+                            , SchurTrait< Decay_<T1>, Decay_<T2> >
+                            , Failure >::Type;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SchurTrait class template for two matrix types.
+// \ingroup math_traits
+*/
+template< typename T1, typename T2 >
+struct SchurTrait< T1, T2, EnableIf_< And< IsMatrix<T1>, IsMatrix<T2> > > >
+{
+ private:
+   //**********************************************************************************************
+   using ET = MultTrait_< ElementType_<T1>, ElementType_<T2> >;
+
+   enum : size_t { M = ( Rows<T1>::value != 0UL ? Rows<T1>::value : Rows<T2>::value ) };
+   enum : size_t { N = ( Columns<T1>::value != 0UL ? Columns<T1>::value : Columns<T2>::value ) };
+
+   enum : bool { SO = ( IsSparseMatrix<T1>::value || !IsSparseMatrix<T2>::value
+                        ? IsColumnMajorMatrix<T1>::value
+                        : IsColumnMajorMatrix<T2>::value ) };
+   //**********************************************************************************************
+
+ public:
+   //**********************************************************************************************
+   using Type = If_< Or< IsSparseMatrix<T1>, IsSparseMatrix<T2> >
+                   , CompressedMatrix<ET,SO>
+                   , IfTrue_< ( M != 0UL && N != 0UL )
+                            , StaticMatrix<ET,M,N,SO>
+                            , DynamicMatrix<ET,SO> > >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary alias declaration for the SchurTrait class template.
+// \ingroup math_traits
+//
+// The SchurTrait_ alias declaration provides a convenient shortcut to access the nested \a Type
+// of the SchurTrait class template. For instance, given the types \a T1 and \a T2 the following
+// two type definitions are identical:
+
+   \code
+   using Type1 = typename SchurTrait<T1,T2>::Type;
+   using Type2 = SchurTrait_<T1,T2>;
+   \endcode
+*/
+template< typename T1, typename T2 >
+using SchurTrait_ = typename SchurTrait<T1,T2>::Type;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -77,9 +77,10 @@ struct HasSIMDAbsHelper
 template< typename T >
 struct HasSIMDAbsHelper< T, EnableIf_< And< IsNumeric<T>, IsIntegral<T>, IsSigned<T> > > >
 {
-   enum : bool { value = ( bool( BLAZE_SSSE3_MODE ) && sizeof(T) <= 4UL ) ||
-                         ( bool( BLAZE_AVX2_MODE  ) && sizeof(T) <= 4UL ) ||
-                         ( bool( BLAZE_MIC_MODE   ) && sizeof(T) >= 4UL ) };
+   enum : bool { value = ( bool( BLAZE_SSSE3_MODE   ) && sizeof(T) <= 4UL ) ||
+                         ( bool( BLAZE_AVX2_MODE    ) && sizeof(T) <= 4UL ) ||
+                         ( bool( BLAZE_AVX512F_MODE ) && sizeof(T) >= 4UL ) ||
+                         ( bool( BLAZE_MIC_MODE     ) && sizeof(T) >= 4UL ) };
 };
 /*! \endcond */
 //*************************************************************************************************
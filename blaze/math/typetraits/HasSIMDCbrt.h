@@ -71,15 +71,19 @@ struct HasSIMDCbrtHelper
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-#if BLAZE_SVML_MODE
 template< typename T >
 struct HasSIMDCbrtHelper< T, EnableIf_< Or< IsFloat<T>, IsDouble<T> > > >
 {
+#if BLAZE_SVML_MODE
    enum : bool { value = bool( BLAZE_SSE_MODE ) ||
                          bool( BLAZE_AVX_MODE ) ||
                          bool( BLAZE_MIC_MODE ) };
-};
+#else
+   enum : bool { value = bool( BLAZE_SSE2_MODE ) ||
+                         bool( BLAZE_AVX_MODE ) ||
+                         bool( BLAZE_AVX512F_MODE ) };
 #endif
+};
 /*! \endcond */
 //*************************************************************************************************
 
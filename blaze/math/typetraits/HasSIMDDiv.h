@@ -79,13 +79,17 @@ struct HasSIMDDivHelper< T1, T2, EnableIf_< And< IsNumeric<T1>, IsIntegral<T1>,
                                                , IsNumeric<T2>, IsIntegral<T2>, IsSigned<T2>
                                                , Bool< sizeof(T1) == sizeof(T2) > > > >
 {
-   enum : bool { value = bool( BLAZE_MIC_MODE ) && sizeof(T1) >= 4UL };
+   enum : bool { value = bool( BLAZE_SVML_MODE ) &&
+                         ( bool( BLAZE_AVX512F_MODE ) || bool( BLAZE_MIC_MODE ) ) &&
+                         sizeof(T1) >= 4UL };
 };
 
 template< typename T >
 struct HasSIMDDivHelper< complex<T>, T, EnableIf_< And< IsNumeric<T>, IsIntegral<T>, IsSigned<T> > > >
 {
-   enum : bool { value = bool( BLAZE_MIC_MODE ) && sizeof(T) >= 4UL };
+   enum : bool { value = bool( BLAZE_SVML_MODE ) &&
+                         ( bool( BLAZE_AVX512F_MODE ) || bool( BLAZE_MIC_MODE ) ) &&
+                         sizeof(T) >= 4UL };
 };
 /*! \endcond */
 //*************************************************************************************************
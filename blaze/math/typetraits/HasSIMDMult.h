@@ -78,10 +78,11 @@ struct HasSIMDMultHelper< T1, T2, EnableIf_< And< IsNumeric<T1>, IsIntegral<T1>
                                                 , IsNumeric<T2>, IsIntegral<T2>
                                                 , Bool< sizeof(T1) == sizeof(T2) > > > >
 {
-   enum : bool { value = ( bool( BLAZE_SSE2_MODE ) && sizeof(T1) == 2UL ) ||
-                         ( bool( BLAZE_SSE4_MODE ) && sizeof(T1) >= 2UL && sizeof(T1) <= 4UL ) ||
-                         ( bool( BLAZE_AVX2_MODE ) && sizeof(T1) >= 2UL && sizeof(T1) <= 4UL ) ||
-                         ( bool( BLAZE_MIC_MODE  ) && sizeof(T1) == 4UL ) };
+   enum : bool { value = ( bool( BLAZE_SSE2_MODE     ) && sizeof(T1) == 2UL ) ||
+                         ( bool( BLAZE_SSE4_MODE     ) && sizeof(T1) >= 2UL && sizeof(T1) <= 4UL ) ||
+                         ( bool( BLAZE_AVX2_MODE     ) && sizeof(T1) >= 2UL && sizeof(T1) <= 4UL ) ||
+                         ( bool( BLAZE_AVX512DQ_MODE ) && sizeof(T1) == 8UL ) ||
+                         ( bool( BLAZE_MIC_MODE      ) && sizeof(T1) == 4UL ) };
 };
 
 template< typename T >
@@ -58,6 +58,7 @@
 #include <blaze/math/typetraits/IsMatForEachExpr.h>
 #include <blaze/math/typetraits/IsMatMatAddExpr.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsMatMatSchurExpr.h>
 #include <blaze/math/typetraits/IsMatMatSubExpr.h>
 #include <blaze/math/typetraits/IsMatScalarDivExpr.h>
 #include <blaze/math/typetraits/IsMatScalarMultExpr.h>
@@ -260,6 +261,31 @@ inline const EnableIf_< IsMatMatSubExpr<MT>, ColumnExprTrait_<MT> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific column of the given matrix/matrix Schur product.
+// \ingroup views
+//
+// \param matrix The constant matrix/matrix Schur product.
+// \param index The index of the column.
+// \return View on the specified column of the Schur product.
+//
+// This function returns an expression representing the specified column of the given matrix/matrix
+// Schur product.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+inline const EnableIf_< IsMatMatSchurExpr<MT>, ColumnExprTrait_<MT> >
+   column( const Matrix<MT,SO>& matrix, size_t index )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return column( (~matrix).leftOperand(), index ) * column( (~matrix).rightOperand(), index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Creating a view on a specific column of the given matrix/matrix multiplication.
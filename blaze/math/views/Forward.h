@@ -44,6 +44,7 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename, bool > class Band;
 template< typename, bool, bool, bool > class Column;
 template< typename, bool, bool, bool > class Row;
 template< typename, bool, bool, bool > class Submatrix;
@@ -44,9 +44,11 @@
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/constraints/MutableDataAccess.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/Matrix.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/InversionFlag.h>
+#include <blaze/math/ReductionFlag.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnTrait.h>
@@ -58,6 +60,7 @@
 #include <blaze/math/traits/SubmatrixTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
 #include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/TransposeFlag.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/IsAligned.h>
@@ -67,7 +70,9 @@
 #include <blaze/math/typetraits/IsMatForEachExpr.h>
 #include <blaze/math/typetraits/IsMatMatAddExpr.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsMatMatSchurExpr.h>
 #include <blaze/math/typetraits/IsMatMatSubExpr.h>
+#include <blaze/math/typetraits/IsMatReduceExpr.h>
 #include <blaze/math/typetraits/IsMatScalarDivExpr.h>
 #include <blaze/math/typetraits/IsMatScalarMultExpr.h>
 #include <blaze/math/typetraits/IsMatSerialExpr.h>
@@ -571,6 +576,64 @@ inline const EnableIf_< IsTVecMatMultExpr<VT>, SubvectorExprTrait_<VT,AF> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific subvector of the given column-wise matrix reduction.
+// \ingroup views
+//
+// \param vector The constant column-wise matrix reduction.
+// \param index The index of the first element of the subvector.
+// \param size The size of the subvector.
+// \return View on the specified subvector of the reduction.
+//
+// This function returns an expression representing the specified subvector of the given
+// column-wise matrix reduction.
+*/
+template< bool AF        // Alignment flag
+        , typename VT >  // Type of the vector
+inline const EnableIf_< IsMatReduceExpr<VT>, SubvectorExprTrait_<VT,AF> >
+   subvector( const Vector<VT,rowVector>& vector, size_t index, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t m( (~vector).operand().rows() );
+
+   return reduce<columnwise>( submatrix<AF>( (~vector).operand(), 0UL, index, m, size ),
+                              (~vector).operation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific subvector of the given row-wise matrix reduction.
+// \ingroup views
+//
+// \param vector The constant row-wise matrix reduction.
+// \param index The index of the first element of the subvector.
+// \param size The size of the subvector.
+// \return View on the specified subvector of the reduction.
+//
+// This function returns an expression representing the specified subvector of the given
+// row-wise matrix reduction.
+*/
+template< bool AF        // Alignment flag
+        , typename VT >  // Type of the vector
+inline const EnableIf_< IsMatReduceExpr<VT>, SubvectorExprTrait_<VT,AF> >
+   subvector( const Vector<VT,columnVector>& vector, size_t index, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t n( (~vector).operand().columns() );
+
+   return reduce<rowwise>( submatrix<AF>( (~vector).operand(), index, 0UL, size, n ),
+                           (~vector).operation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Creating a view on a specific submatrix of the given matrix/matrix addition.
@@ -631,6 +694,36 @@ inline const EnableIf_< IsMatMatSubExpr<MT>, SubmatrixExprTrait_<MT,AF> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific submatrix of the given matrix/matrix Schur product.
+// \ingroup views
+//
+// \param matrix The constant matrix/matrix Schur product.
+// \param row The index of the first row of the submatrix.
+// \param column The index of the first column of the submatrix.
+// \param m The number of rows of the submatrix.
+// \param n The number of columns of the submatrix.
+// \return View on the specified submatrix of the Schur product.
+//
+// This function returns an expression representing the specified submatrix of the given
+// matrix/matrix Schur product.
+*/
+template< bool AF      // Alignment flag
+        , typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+inline const EnableIf_< IsMatMatSchurExpr<MT>, SubmatrixExprTrait_<MT,AF> >
+   submatrix( const Matrix<MT,SO>& matrix, size_t row, size_t column, size_t m, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return submatrix<AF>( (~matrix).leftOperand() , row, column, m, n ) %
+          submatrix<AF>( (~matrix).rightOperand(), row, column, m, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Creating a view on a specific submatrix of the given matrix/matrix multiplication.
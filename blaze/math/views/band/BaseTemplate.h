@@ -0,0 +1,108 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/views/band/BaseTemplate.h
+//  \brief Header file for the implementation of the Band base template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_VIEWS_BAND_BASETEMPLATE_H_
+#define _BLAZE_MATH_VIEWS_BAND_BASETEMPLATE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup band Band
+// \ingroup views
+*/
+/*!\brief Reference to a specific band (i.e. diagonal) of a dense matrix.
+// \ingroup band
+//
+// The Band template represents a reference to a specific band of a dense matrix primitive, i.e.
+// to the diagonal \f$ k \f$ consisting of the elements \f$ a_{i,i+k} \f$. The type of the matrix
+// is specified via the first template parameter:
+
+   \code
+   template< typename MT, bool DF >
+   class Band;
+   \endcode
+
+//  - MT: specifies the type of the dense matrix primitive. Band can be used with every dense
+//        matrix primitive, but does not work with any matrix expression type.
+//  - DF: specifies whether the given matrix type is a dense or sparse matrix type. This template
+//        parameter doesn't have to be explicitly defined, but is automatically derived from the
+//        first template parameter. Currently only dense matrices are supported.
+//
+// A reference to a band of a dense matrix can be created very conveniently via the \c band()
+// function. The band index \f$ k \f$ selects the main diagonal (\f$ k = 0 \f$), a superdiagonal
+// (\f$ k > 0 \f$) or a subdiagonal (\f$ k < 0 \f$) of the matrix. A band is a column vector,
+// i.e. it can be used like any other dense column vector:
+
+   \code
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>  DenseMatrixType;
+
+   DenseMatrixType A( 5UL, 5UL );
+   blaze::DynamicVector<double,blaze::columnVector> x( 4UL );
+   // ... Resizing and initialization
+
+   // Setting the first subdiagonal of A to x
+   blaze::Band<DenseMatrixType> sub = band( A, -1L );
+   sub = x;
+
+   // Computing the sum of the main diagonal and the first superdiagonal
+   x = subvector( band( A, 0L ), 0UL, 4UL ) + band( A, 1L );
+   \endcode
+
+// Note that in contrast to a row or column of a dense matrix the elements of a band are not
+// stored adjacent to each other, but are separated by the spacing of the underlying matrix
+// plus one. Therefore a band does not provide SIMD and SMP support.
+*/
+template< typename MT                          // Type of the matrix
+        , bool DF = IsDenseMatrix<MT>::value >  // Density flag
+class Band;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
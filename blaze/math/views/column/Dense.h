@@ -1638,7 +1638,7 @@ inline EnableIf_< typename Column<MT,true,true,SF>::BLAZE_TEMPLATE VectorizedAss
    Iterator left( begin() );
    ConstIterator_<VT> right( (~rhs).begin() );
 
-   if( useStreaming && rows > ( cacheSize/( sizeof(ElementType) * 3UL ) ) && !(~rhs).isAliased( this ) )
+   if( useStreaming && rows > streamingThreshold( sizeof(ElementType) ) && !(~rhs).isAliased( this ) )
    {
       for( ; i<ipos; i+=SIMDSIZE ) {
          left.stream( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
@@ -5365,7 +5365,7 @@ inline EnableIf_< typename Column<MT,false,true,true>::BLAZE_TEMPLATE Vectorized
    Iterator left( begin() );
    ConstIterator_<VT> right( (~rhs).begin() );
 
-   if( useStreaming && columns > ( cacheSize/( sizeof(ElementType) * 3UL ) ) && !(~rhs).isAliased( this ) )
+   if( useStreaming && columns > streamingThreshold( sizeof(ElementType) ) && !(~rhs).isAliased( this ) )
    {
       for( ; j<jpos; j+=SIMDSIZE ) {
          left.stream( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
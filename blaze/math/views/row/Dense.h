@@ -1638,7 +1638,7 @@ inline EnableIf_< typename Row<MT,true,true,SF>::BLAZE_TEMPLATE VectorizedAssign
    Iterator left( begin() );
    ConstIterator_<VT> right( (~rhs).begin() );
 
-   if( useStreaming && columns > ( cacheSize/( sizeof(ElementType) * 3UL ) ) && !(~rhs).isAliased( &matrix_ ) )
+   if( useStreaming && columns > streamingThreshold( sizeof(ElementType) ) && !(~rhs).isAliased( &matrix_ ) )
    {
       for( ; j<jpos; j+=SIMDSIZE ) {
          left.stream( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
@@ -5348,7 +5348,7 @@ inline EnableIf_< typename Row<MT,false,true,true>::BLAZE_TEMPLATE VectorizedAss
    Iterator left( begin() );
    ConstIterator_<VT> right( (~rhs).begin() );
 
-   if( useStreaming && rows > ( cacheSize/( sizeof(ElementType) * 3UL ) ) && !(~rhs).isAliased( &matrix_ ) )
+   if( useStreaming && rows > streamingThreshold( sizeof(ElementType) ) && !(~rhs).isAliased( &matrix_ ) )
    {
       for( ; i<ipos; i+=SIMDSIZE ) {
          left.stream( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
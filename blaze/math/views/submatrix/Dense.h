@@ -2558,7 +2558,7 @@ inline EnableIf_< typename Submatrix<MT,unaligned,false,true>::BLAZE_TEMPLATE Ve
    BLAZE_INTERNAL_ASSERT( ( n_ - ( n_ % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
 
    if( useStreaming && isAligned_ &&
-       m_*n_ > ( cacheSize / ( sizeof(ElementType) * 3UL ) ) &&
+       m_*n_ > streamingThreshold( sizeof(ElementType) ) &&
        !(~rhs).isAliased( &matrix_ ) )
    {
       for( size_t i=0UL; i<m_; ++i )
@@ -5498,7 +5498,7 @@ inline EnableIf_< typename Submatrix<MT,unaligned,true,true>::BLAZE_TEMPLATE Vec
    BLAZE_INTERNAL_ASSERT( ( m_ - ( m_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
 
    if( useStreaming && isAligned_ &&
-       m_*n_ > ( cacheSize / ( sizeof(ElementType) * 3UL ) ) &&
+       m_*n_ > streamingThreshold( sizeof(ElementType) ) &&
        !(~rhs).isAliased( &matrix_ ) )
    {
       for( size_t j=0UL; j<n_; ++j )
@@ -8070,7 +8070,7 @@ inline EnableIf_< typename Submatrix<MT,aligned,false,true>::BLAZE_TEMPLATE Vect
    BLAZE_INTERNAL_ASSERT( ( n_ - ( n_ % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
 
    if( useStreaming &&
-       m_*n_ > ( cacheSize / ( sizeof(ElementType) * 3UL ) ) &&
+       m_*n_ > streamingThreshold( sizeof(ElementType) ) &&
        !(~rhs).isAliased( &matrix_ ) )
    {
       for( size_t i=0UL; i<m_; ++i )
@@ -10594,7 +10594,7 @@ inline EnableIf_< typename Submatrix<MT,aligned,true,true>::BLAZE_TEMPLATE Vecto
    BLAZE_INTERNAL_ASSERT( ( m_ - ( m_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
 
    if( useStreaming &&
-       m_*n_ > ( cacheSize / ( sizeof(ElementType) * 3UL ) ) &&
+       m_*n_ > streamingThreshold( sizeof(ElementType) ) &&
        !(~rhs).isAliased( &matrix_ ) )
    {
       for( size_t j=0UL; j<n_; ++j )
@@ -2092,7 +2092,7 @@ inline EnableIf_< typename Subvector<VT,unaligned,TF,true>::BLAZE_TEMPLATE Vecto
    ConstIterator_<VT2> right( (~rhs).begin() );
 
    if( useStreaming && isAligned_ &&
-       ( size_ > ( cacheSize/( sizeof(ElementType) * 3UL ) ) ) &&
+       ( size_ > streamingThreshold( sizeof(ElementType) ) ) &&
        !(~rhs).isAliased( &vector_ ) )
    {
       for( ; i<ipos; i+=SIMDSIZE ) {
@@ -4129,7 +4129,7 @@ inline EnableIf_< typename Subvector<VT,aligned,TF,true>::BLAZE_TEMPLATE Vectori
    Iterator left( begin() );
    ConstIterator_<VT2> right( (~rhs).begin() );
 
-   if( useStreaming && size_ > ( cacheSize/( sizeof(ElementType) * 3UL ) ) && !(~rhs).isAliased( &vector_ ) )
+   if( useStreaming && size_ > streamingThreshold( sizeof(ElementType) ) && !(~rhs).isAliased( &vector_ ) )
    {
       for( ; i<ipos; i+=SIMDSIZE ) {
          left.stream( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/system/CacheSize.h>
 #include <blaze/system/Debugging.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
@@ -64,6 +65,11 @@ constexpr size_t DMATDMATMULT_DEFAULT_KBLOCK_SIZE = 128UL;
 constexpr size_t TDMATTDMATMULT_DEFAULT_IBLOCK_SIZE = 128UL;
 constexpr size_t TDMATTDMATMULT_DEFAULT_JBLOCK_SIZE =  64UL;
 constexpr size_t TDMATTDMATMULT_DEFAULT_KBLOCK_SIZE = 128UL;
+
+constexpr size_t MMM_DEFAULT_IBLOCK_SIZE =  96UL;
+constexpr size_t MMM_DEFAULT_KBLOCK_SIZE = 256UL;
+
+constexpr size_t DECOMPOSITION_DEFAULT_BLOCK_SIZE = 64UL;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -79,12 +85,187 @@ constexpr size_t DMATDMATMULT_DEBUG_KBLOCK_SIZE =  8UL;
 constexpr size_t TDMATTDMATMULT_DEBUG_IBLOCK_SIZE = 64UL;
 constexpr size_t TDMATTDMATMULT_DEBUG_JBLOCK_SIZE =  8UL;
 constexpr size_t TDMATTDMATMULT_DEBUG_KBLOCK_SIZE =  8UL;
+
+constexpr size_t MMM_DEBUG_IBLOCK_SIZE = 12UL;
+constexpr size_t MMM_DEBUG_KBLOCK_SIZE =  8UL;
+
+constexpr size_t DECOMPOSITION_DEBUG_BLOCK_SIZE = 4UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compilation switch for the cache-dependent block sizes.
+// \ingroup system
+//
+// This compilation switch indicates whether the block sizes of the blocked kernels are derived
+// from the cache hierarchy detected at runtime (see the BLAZE_USE_CACHE_DETECTION switch). In
+// debug mode the small debug block sizes are used in any case.
+*/
+#define BLAZE_CACHE_BLOCKING_MODE ( BLAZE_USE_CACHE_DETECTION && !BLAZE_DEBUG_MODE )
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Identifiers of the cache-dependent block sizes.
+// \ingroup system
+*/
+enum class BlockingID : size_t
+{
+   BLOCK            = 0UL,  //!< The general block size of blocked assignments.
+   DMATDMATMULT_I   = 1UL,  //!< The row block size of the row-major multiplication kernels.
+   DMATDMATMULT_J   = 2UL,  //!< The column block size of the row-major multiplication kernels.
+   DMATDMATMULT_K   = 3UL,  //!< The inner block size of the row-major multiplication kernels.
+   TDMATTDMATMULT_I = 4UL,  //!< The row block size of the column-major multiplication kernels.
+   TDMATTDMATMULT_J = 5UL,  //!< The column block size of the column-major multiplication kernels.
+   TDMATTDMATMULT_K = 6UL   //!< The inner block size of the column-major multiplication kernels.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Table of the cache-dependent block sizes.
+// \ingroup system
+*/
+struct BlockingTable
+{
+   size_t values[7];  //!< The block sizes in the order of the BlockingID enumeration.
+};
 /*! \endcond */
 //*************************************************************************************************
 
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+/*!\brief Derives the block sizes from the cache hierarchy of the CPU.
+// \ingroup system
+//
+// \return The table of block sizes.
+//
+// The block sizes are chosen such that two square tiles of double precision values (i.e. a
+// tile of each operand) fit into the L2 cache and that a column of a tile of the general
+// block size does not occupy more than half of the cache lines of the L1 cache. The tile
+// size is a multiple of 32 in the range [64..512]. For the default cache hierarchy (32 KiB
+// L1 cache, 256 KiB L2 cache) the function reproduces the default block sizes. In case
+// the cache hierarchy could not be determined the default block sizes are used.
+*/
+inline BlockingTable initBlockingTable() noexcept
+{
+   const CacheHierarchy& caches( cacheHierarchy() );
+
+   if( !caches.detected ) {
+      return { { DEFAULT_BLOCK_SIZE
+               , DMATDMATMULT_DEFAULT_IBLOCK_SIZE
+               , DMATDMATMULT_DEFAULT_JBLOCK_SIZE
+               , DMATDMATMULT_DEFAULT_KBLOCK_SIZE
+               , TDMATTDMATMULT_DEFAULT_IBLOCK_SIZE
+               , TDMATTDMATMULT_DEFAULT_JBLOCK_SIZE
+               , TDMATTDMATMULT_DEFAULT_KBLOCK_SIZE } };
+   }
+
+   size_t tile( 64UL );
+   while( tile < 512UL && 2UL*(tile+32UL)*(tile+32UL)*sizeof(double) <= caches.l2Size ) {
+      tile += 32UL;
+   }
+
+   const size_t lines( caches.l1Size / ( 2UL * caches.lineSize ) );
+   const size_t block( ( lines < tile )?( lines < 16UL ? 16UL : lines & size_t(-16) ):( tile ) );
+
+   return { { block, tile/2UL, tile, tile, tile, tile/2UL, tile } };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the block size with the given identifier.
+// \ingroup system
+//
+// \param id The identifier of the block size.
+// \return The block size derived from the cache hierarchy of the CPU.
+*/
+inline size_t getBlockSize( BlockingID id ) noexcept
+{
+   static const BlockingTable table( initBlockingTable() );
+   return table.values[static_cast<size_t>( id )];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cache-dependent block size.
+// \ingroup system
+//
+// The CacheBlockSize class represents a block size that is derived from the cache hierarchy
+// of the CPU at runtime. Due to the implicit conversion to \c size_t it can be used in place
+// of a compile time block size in all runtime expressions.
+*/
+class CacheBlockSize
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the CacheBlockSize class.
+   //
+   // \param id The identifier of the block size.
+   // \param defaultValue The compile time default of the block size.
+   */
+   constexpr CacheBlockSize( BlockingID id, size_t defaultValue ) noexcept
+      : id_          ( id )            // The identifier of the block size
+      , defaultValue_( defaultValue )  // The compile time default of the block size
+   {}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\brief Conversion to the current value of the block size.
+   //
+   // \return The block size derived from the cache hierarchy of the CPU.
+   */
+   inline operator size_t() const noexcept {
+      return getBlockSize( id_ );
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the compile time default of the block size.
+   //
+   // \return The compile time default of the block size.
+   */
+   constexpr size_t defaultValue() const noexcept {
+      return defaultValue_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   BlockingID id_;        //!< The identifier of the block size.
+   size_t defaultValue_;  //!< The compile time default of the block size.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if BLAZE_CACHE_BLOCKING_MODE
+constexpr CacheBlockSize BLOCK_SIZE( BlockingID::BLOCK, DEFAULT_BLOCK_SIZE );
+
+constexpr CacheBlockSize DMATDMATMULT_JBLOCK_SIZE( BlockingID::DMATDMATMULT_J, DMATDMATMULT_DEFAULT_JBLOCK_SIZE );
+constexpr CacheBlockSize DMATDMATMULT_IBLOCK_SIZE( BlockingID::DMATDMATMULT_I, DMATDMATMULT_DEFAULT_IBLOCK_SIZE );
+constexpr CacheBlockSize DMATDMATMULT_KBLOCK_SIZE( BlockingID::DMATDMATMULT_K, DMATDMATMULT_DEFAULT_KBLOCK_SIZE );
+
+constexpr CacheBlockSize TDMATTDMATMULT_IBLOCK_SIZE( BlockingID::TDMATTDMATMULT_I, TDMATTDMATMULT_DEFAULT_IBLOCK_SIZE );
+constexpr CacheBlockSize TDMATTDMATMULT_JBLOCK_SIZE( BlockingID::TDMATTDMATMULT_J, TDMATTDMATMULT_DEFAULT_JBLOCK_SIZE );
+constexpr CacheBlockSize TDMATTDMATMULT_KBLOCK_SIZE( BlockingID::TDMATTDMATMULT_K, TDMATTDMATMULT_DEFAULT_KBLOCK_SIZE );
+#else
 constexpr size_t BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? DEBUG_BLOCK_SIZE : DEFAULT_BLOCK_SIZE );
 
 constexpr size_t DMATDMATMULT_JBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DEBUG_JBLOCK_SIZE : DMATDMATMULT_DEFAULT_JBLOCK_SIZE );
@@ -94,6 +275,12 @@ constexpr size_t DMATDMATMULT_KBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DE
 constexpr size_t TDMATTDMATMULT_IBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_IBLOCK_SIZE : TDMATTDMATMULT_DEFAULT_IBLOCK_SIZE );
 constexpr size_t TDMATTDMATMULT_JBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_JBLOCK_SIZE : TDMATTDMATMULT_DEFAULT_JBLOCK_SIZE );
 constexpr size_t TDMATTDMATMULT_KBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_KBLOCK_SIZE : TDMATTDMATMULT_DEFAULT_KBLOCK_SIZE );
+#endif
+
+constexpr size_t MMM_IBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? MMM_DEBUG_IBLOCK_SIZE : MMM_DEFAULT_IBLOCK_SIZE );
+constexpr size_t MMM_KBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? MMM_DEBUG_KBLOCK_SIZE : MMM_DEFAULT_KBLOCK_SIZE );
+
+constexpr size_t DECOMPOSITION_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? DECOMPOSITION_DEBUG_BLOCK_SIZE : DECOMPOSITION_DEFAULT_BLOCK_SIZE );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -112,6 +299,7 @@ constexpr size_t TDMATTDMATMULT_KBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? TDMATTDMATMUL
 /*! \cond BLAZE_INTERNAL */
 namespace {
 
+#if !BLAZE_CACHE_BLOCKING_MODE
 BLAZE_STATIC_ASSERT( blaze::BLOCK_SIZE >= 4UL );
 
 BLAZE_STATIC_ASSERT( blaze::DMATDMATMULT_IBLOCK_SIZE >=  4UL );
@@ -121,6 +309,11 @@ BLAZE_STATIC_ASSERT( blaze::DMATDMATMULT_KBLOCK_SIZE >=  4UL );
 BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_IBLOCK_SIZE >= 64UL && blaze::TDMATTDMATMULT_IBLOCK_SIZE % 32UL == 0UL );
 BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_JBLOCK_SIZE >=  4UL );
 BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_KBLOCK_SIZE >=  4UL );
+#endif
+
+BLAZE_STATIC_ASSERT( blaze::MMM_IBLOCK_SIZE >= 6UL && blaze::MMM_IBLOCK_SIZE % 6UL == 0UL );
+BLAZE_STATIC_ASSERT( blaze::MMM_KBLOCK_SIZE >= 4UL );
+BLAZE_STATIC_ASSERT( blaze::DECOMPOSITION_BLOCK_SIZE >= 2UL );
 
 }
 /*! \endcond */
@@ -40,8 +40,18 @@
 // Includes
 //*************************************************************************************************
 
+#include <cctype>
+#include <fstream>
+#include <string>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+#if ( defined(__x86_64__) || defined(__i386__) ) && ( defined(__GNUC__) || defined(__clang__) )
+#  include <cpuid.h>
+#elif ( defined(_M_X64) || defined(_M_IX86) ) && defined(_MSC_VER)
+#  include <intrin.h>
+#endif
 
 
 
@@ -57,6 +67,298 @@
 
 
 
+namespace blaze {
+
+//=================================================================================================
+//
+//  CACHE HIERARCHY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Description of the cache hierarchy of the CPU.
+// \ingroup system
+//
+// The CacheHierarchy class describes the data caches of a single core of the CPU. All sizes
+// are given in Byte. In case the cache hierarchy cannot be determined (see cacheHierarchy())
+// the \a detected flag is \a false and the remaining data members contain the default values,
+// which are based on the \a cacheSize setting.
+*/
+struct CacheHierarchy
+{
+   size_t l1Size;    //!< The size of the L1 data cache.
+   size_t l2Size;    //!< The size of the L2 cache.
+   size_t l3Size;    //!< The size of the L3 cache (or the last level cache).
+   size_t lineSize;  //!< The size of a cache line.
+   bool   detected;  //!< \a true in case the cache hierarchy has been detected at runtime.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\name Cache hierarchy functions */
+//@{
+const CacheHierarchy& cacheHierarchy() noexcept;
+size_t streamingThreshold( size_t elementSize ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads the size of a cache from the Linux sysfs interface.
+// \ingroup system
+//
+// \param file The sysfs file containing the size of the cache (as for instance "32K").
+// \return The size of the cache in Byte, 0 in case the file cannot be read.
+*/
+inline size_t readCacheSize( const std::string& file ) noexcept
+{
+   try {
+      std::ifstream in( file.c_str() );
+      size_t size( 0UL );
+
+      if( !( in >> size ) )
+         return 0UL;
+
+      char unit( '\0' );
+      if( in >> unit ) {
+         switch( std::toupper( unit ) ) {
+            case 'K': size *= 1024UL; break;
+            case 'M': size *= 1024UL*1024UL; break;
+            case 'G': size *= 1024UL*1024UL*1024UL; break;
+            default : break;
+         }
+      }
+
+      return size;
+   }
+   catch( ... ) {
+      return 0UL;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the cache hierarchy via the Linux sysfs interface.
+// \ingroup system
+//
+// \param caches The cache hierarchy to be completed.
+// \return void
+//
+// This function reads the cache descriptions of the first CPU from the directory
+// <tt>/sys/devices/system/cpu/cpu0/cache</tt>. Instruction caches are ignored. Only the
+// caches that could be determined are updated.
+*/
+inline void detectSysfsCaches( CacheHierarchy& caches ) noexcept
+{
+#if defined(__linux__)
+   try {
+      for( size_t index=0UL; index<16UL; ++index )
+      {
+         const std::string dir( "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string( index ) + "/" );
+
+         std::ifstream levelFile( ( dir + "level" ).c_str() );
+         std::ifstream typeFile ( ( dir + "type"  ).c_str() );
+
+         size_t level( 0UL );
+         std::string type;
+
+         if( !( levelFile >> level ) || !( typeFile >> type ) )
+            break;
+
+         if( type == "Instruction" )
+            continue;
+
+         const size_t size( readCacheSize( dir + "size" ) );
+         const size_t line( readCacheSize( dir + "coherency_line_size" ) );
+
+         if( size == 0UL )
+            continue;
+
+         if( level == 1UL ) caches.l1Size = size;
+         if( level == 2UL ) caches.l2Size = size;
+         if( level >= 3UL ) caches.l3Size = size;
+         if( line != 0UL && level == 1UL ) caches.lineSize = line;
+      }
+   }
+   catch( ... ) {}
+#else
+   UNUSED_PARAMETER( caches );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the cache hierarchy via the \c cpuid instruction.
+// \ingroup system
+//
+// \param caches The cache hierarchy to be completed.
+// \return void
+//
+// This function enumerates the deterministic cache parameters of the CPU (leaf 4 on Intel and
+// leaf 0x8000001D on AMD processors). Instruction caches are ignored. Only the caches that
+// could be determined are updated. On platforms without \c cpuid support the function has
+// no effect.
+*/
+inline void detectCpuidCaches( CacheHierarchy& caches ) noexcept
+{
+#if ( ( defined(__x86_64__) || defined(__i386__) ) && ( defined(__GNUC__) || defined(__clang__) ) ) || \
+    ( ( defined(_M_X64) || defined(_M_IX86) ) && defined(_MSC_VER) )
+
+   unsigned int regs[4] = { 0U, 0U, 0U, 0U };  // The EAX, EBX, ECX, and EDX registers
+
+   const auto cpuid = [&regs]( unsigned int leaf, unsigned int subleaf )
+   {
+#  if !defined(__GNUC__) && !defined(__clang__)
+      int info[4];
+      __cpuidex( info, static_cast<int>( leaf ), static_cast<int>( subleaf ) );
+      for( int i=0; i<4; ++i ) regs[i] = static_cast<unsigned int>( info[i] );
+#  else
+      __cpuid_count( leaf, subleaf, regs[0], regs[1], regs[2], regs[3] );
+#  endif
+   };
+
+   cpuid( 0U, 0U );
+   const unsigned int maxLeaf( regs[0] );
+   const bool intel( regs[1] == 0x756E6547U && regs[3] == 0x49656E69U && regs[2] == 0x6C65746EU );
+
+   cpuid( 0x80000000U, 0U );
+   const unsigned int maxExtLeaf( regs[0] );
+
+   unsigned int leaf( 0U );
+
+   if( intel && maxLeaf >= 4U )
+      leaf = 4U;
+   else if( !intel && maxExtLeaf >= 0x8000001DU )
+      leaf = 0x8000001DU;
+   else return;
+
+   for( unsigned int subleaf=0U; subleaf<16U; ++subleaf )
+   {
+      cpuid( leaf, subleaf );
+
+      const unsigned int type( regs[0] & 0x1FU );
+
+      if( type == 0U ) break;
+      if( type == 2U ) continue;
+
+      const size_t level     ( ( regs[0] >> 5 ) & 0x7U );
+      const size_t ways      ( ( ( regs[1] >> 22 ) & 0x3FFU ) + 1UL );
+      const size_t partitions( ( ( regs[1] >> 12 ) & 0x3FFU ) + 1UL );
+      const size_t line      ( ( regs[1] & 0xFFFU ) + 1UL );
+      const size_t sets      ( static_cast<size_t>( regs[2] ) + 1UL );
+      const size_t size      ( ways * partitions * line * sets );
+
+      if( level == 1UL ) { caches.l1Size = size; caches.lineSize = line; }
+      if( level == 2UL ) caches.l2Size = size;
+      if( level >= 3UL ) caches.l3Size = size;
+   }
+
+#else
+
+   UNUSED_PARAMETER( caches );
+
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the cache hierarchy of the CPU.
+// \ingroup system
+//
+// \return The detected cache hierarchy.
+//
+// This function queries the cache hierarchy via the Linux sysfs interface and, in case this
+// is not available, via the \c cpuid instruction. Implausible results are discarded. In case
+// the cache detection is disabled (see the BLAZE_USE_CACHE_DETECTION switch) or in case the
+// cache hierarchy cannot be determined, the function returns the default cache hierarchy.
+*/
+inline CacheHierarchy detectCacheHierarchy() noexcept
+{
+   const CacheHierarchy defaults = { 32768UL, 262144UL, cacheSize, 64UL, false };
+
+#if BLAZE_USE_CACHE_DETECTION
+   CacheHierarchy caches = { 0UL, 0UL, 0UL, 0UL, false };
+
+   detectSysfsCaches( caches );
+
+   if( caches.l1Size == 0UL || caches.l2Size == 0UL )
+      detectCpuidCaches( caches );
+
+   if( caches.l1Size < 4096UL || caches.l2Size < caches.l1Size )
+      return defaults;
+
+   if( caches.l3Size < caches.l2Size )
+      caches.l3Size = caches.l2Size;
+
+   if( caches.lineSize < 16UL || caches.lineSize > 1024UL )
+      caches.lineSize = defaults.lineSize;
+
+   caches.detected = true;
+
+   return caches;
+#else
+   return defaults;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the cache hierarchy of the CPU.
+// \ingroup system
+//
+// \return The cache hierarchy of the CPU.
+//
+// This function returns the sizes of the data caches of the CPU the program is running on. The
+// cache hierarchy is determined on the first call, all subsequent calls return the cached
+// result. In case the cache detection is disabled (see the BLAZE_USE_CACHE_DETECTION switch)
+// or in case the cache hierarchy cannot be determined, the function returns a cache hierarchy
+// based on the \a cacheSize setting.
+*/
+inline const CacheHierarchy& cacheHierarchy() noexcept
+{
+   static const CacheHierarchy caches( detectCacheHierarchy() );
+   return caches;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the size limit for assignments via regular stores.
+// \ingroup system
+//
+// \param elementSize The size of a single element in Byte.
+// \return The maximum number of elements that are assigned via regular stores.
+//
+// This function returns the number of elements of the given size that can be assigned via
+// regular stores without evicting the operands from the last level cache. Larger assignments
+// use non-temporal stores (given that streaming is enabled, see the \a useStreaming setting).
+*/
+inline size_t streamingThreshold( size_t elementSize ) noexcept
+{
+   return cacheHierarchy().l3Size / ( elementSize * 3UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
@@ -0,0 +1,625 @@
+//=================================================================================================
+/*!
+//  \file blaze/system/ThresholdProfile.h
+//  \brief Header file for the runtime configuration of the Blaze thresholds
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_SYSTEM_THRESHOLDPROFILE_H_
+#define _BLAZE_SYSTEM_THRESHOLDPROFILE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <blaze/util/Exception.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  THRESHOLD IDENTIFIERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Identifiers of all configurable thresholds.
+// \ingroup system
+//
+// The ThresholdID enumeration lists all thresholds of the Blaze library that can be configured
+// at runtime. The name of each identifier corresponds to the name of the threshold without the
+// \c _THRESHOLD suffix (e.g. ThresholdID::SMP_DVECASSIGN for blaze::SMP_DVECASSIGN_THRESHOLD)
+// and is used both in threshold profiles and in the \c BLAZE_THRESHOLD_* environment variables.
+*/
+enum class ThresholdID : size_t
+{
+   DMATDVECMULT       = 0,
+   TDMATDVECMULT      = 1,
+   TDVECDMATMULT      = 2,
+   TDVECTDMATMULT     = 3,
+   DMATDMATMULT       = 4,
+   DMATTDMATMULT      = 5,
+   TDMATDMATMULT      = 6,
+   TDMATTDMATMULT     = 7,
+   DMATSMATMULT       = 8,
+   TDMATSMATMULT      = 9,
+   TSMATDMATMULT      = 10,
+   TSMATTDMATMULT     = 11,
+   SMP_DVECASSIGN     = 12,
+   SMP_DVECDVECADD    = 13,
+   SMP_DVECDVECSUB    = 14,
+   SMP_DVECDVECMULT   = 15,
+   SMP_DVECDVECDIV    = 16,
+   SMP_DVECSCALARMULT = 17,
+   SMP_DMATDVECMULT   = 18,
+   SMP_TDMATDVECMULT  = 19,
+   SMP_TDVECDMATMULT  = 20,
+   SMP_TDVECTDMATMULT = 21,
+   SMP_DMATSVECMULT   = 22,
+   SMP_TDMATSVECMULT  = 23,
+   SMP_TSVECDMATMULT  = 24,
+   SMP_TSVECTDMATMULT = 25,
+   SMP_SMATDVECMULT   = 26,
+   SMP_TSMATDVECMULT  = 27,
+   SMP_TDVECSMATMULT  = 28,
+   SMP_TDVECTSMATMULT = 29,
+   SMP_SMATSVECMULT   = 30,
+   SMP_TSMATSVECMULT  = 31,
+   SMP_TSVECSMATMULT  = 32,
+   SMP_TSVECTSMATMULT = 33,
+   SMP_DMATASSIGN     = 34,
+   SMP_DMATDMATADD    = 35,
+   SMP_DMATTDMATADD   = 36,
+   SMP_DMATDMATSUB    = 37,
+   SMP_DMATTDMATSUB   = 38,
+   SMP_DMATSCALARMULT = 39,
+   SMP_DMATDMATMULT   = 40,
+   SMP_DMATTDMATMULT  = 41,
+   SMP_TDMATDMATMULT  = 42,
+   SMP_TDMATTDMATMULT = 43,
+   SMP_DMATSMATMULT   = 44,
+   SMP_DMATTSMATMULT  = 45,
+   SMP_TDMATSMATMULT  = 46,
+   SMP_TDMATTSMATMULT = 47,
+   SMP_SMATDMATMULT   = 48,
+   SMP_SMATTDMATMULT  = 49,
+   SMP_TSMATDMATMULT  = 50,
+   SMP_TSMATTDMATMULT = 51,
+   SMP_SMATSMATMULT   = 52,
+   SMP_SMATTSMATMULT  = 53,
+   SMP_TSMATSMATMULT  = 54,
+   SMP_TSMATTSMATMULT = 55,
+   SMP_SMATSMATADD    = 56,
+   SMP_SMATSMATSUB    = 57,
+   SMP_SMATSCALARMULT = 58,
+   SMP_SMATTRANS      = 59,
+   SMP_DVECTDVECMULT  = 60,
+   SMP_DVECREDUCE     = 61,
+   SMP_DMATREDUCE     = 62,
+   SMP_BATCH          = 63,
+   SMP_DMATDMATSCHUR  = 64,
+   SMP_DMATTDMATSCHUR = 65,
+   SMP_SMATSMATSCHUR  = 66
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The total number of configurable thresholds.
+// \ingroup system
+*/
+constexpr size_t thresholdCount = 67UL;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THRESHOLD TABLE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Table of the runtime values of all configurable thresholds.
+// \ingroup system
+//
+// The ThresholdTable holds the runtime value for each threshold and a flag that indicates
+// whether the threshold has been configured at all. Thresholds that have not been configured
+// fall back to the compile time values specified in <tt>./blaze/config/Thresholds.h</tt>.
+*/
+struct ThresholdTable
+{
+   size_t values [thresholdCount];  //!< The runtime values of the thresholds.
+   bool   isSet  [thresholdCount];  //!< Flags for the configured thresholds.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THRESHOLD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Threshold functions */
+//@{
+const char* name( ThresholdID id ) noexcept;
+bool findThreshold( const std::string& name, ThresholdID& id ) noexcept;
+void setThreshold( ThresholdID id, size_t value ) noexcept;
+void resetThreshold( ThresholdID id ) noexcept;
+size_t getThreshold( ThresholdID id, size_t defaultValue ) noexcept;
+void loadThresholdProfile( const std::string& file );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the given threshold.
+// \ingroup system
+//
+// \param id The identifier of the threshold.
+// \return The name of the threshold (as for instance "SMP_DVECASSIGN").
+*/
+inline const char* name( ThresholdID id ) noexcept
+{
+   static const char* const names[thresholdCount] = {
+   "DMATDVECMULT",
+   "TDMATDVECMULT",
+   "TDVECDMATMULT",
+   "TDVECTDMATMULT",
+   "DMATDMATMULT",
+   "DMATTDMATMULT",
+   "TDMATDMATMULT",
+   "TDMATTDMATMULT",
+   "DMATSMATMULT",
+   "TDMATSMATMULT",
+   "TSMATDMATMULT",
+   "TSMATTDMATMULT",
+   "SMP_DVECASSIGN",
+   "SMP_DVECDVECADD",
+   "SMP_DVECDVECSUB",
+   "SMP_DVECDVECMULT",
+   "SMP_DVECDVECDIV",
+   "SMP_DVECSCALARMULT",
+   "SMP_DMATDVECMULT",
+   "SMP_TDMATDVECMULT",
+   "SMP_TDVECDMATMULT",
+   "SMP_TDVECTDMATMULT",
+   "SMP_DMATSVECMULT",
+   "SMP_TDMATSVECMULT",
+   "SMP_TSVECDMATMULT",
+   "SMP_TSVECTDMATMULT",
+   "SMP_SMATDVECMULT",
+   "SMP_TSMATDVECMULT",
+   "SMP_TDVECSMATMULT",
+   "SMP_TDVECTSMATMULT",
+   "SMP_SMATSVECMULT",
+   "SMP_TSMATSVECMULT",
+   "SMP_TSVECSMATMULT",
+   "SMP_TSVECTSMATMULT",
+   "SMP_DMATASSIGN",
+   "SMP_DMATDMATADD",
+   "SMP_DMATTDMATADD",
+   "SMP_DMATDMATSUB",
+   "SMP_DMATTDMATSUB",
+   "SMP_DMATSCALARMULT",
+   "SMP_DMATDMATMULT",
+   "SMP_DMATTDMATMULT",
+   "SMP_TDMATDMATMULT",
+   "SMP_TDMATTDMATMULT",
+   "SMP_DMATSMATMULT",
+   "SMP_DMATTSMATMULT",
+   "SMP_TDMATSMATMULT",
+   "SMP_TDMATTSMATMULT",
+   "SMP_SMATDMATMULT",
+   "SMP_SMATTDMATMULT",
+   "SMP_TSMATDMATMULT",
+   "SMP_TSMATTDMATMULT",
+   "SMP_SMATSMATMULT",
+   "SMP_SMATTSMATMULT",
+   "SMP_TSMATSMATMULT",
+   "SMP_TSMATTSMATMULT",
+   "SMP_SMATSMATADD",
+   "SMP_SMATSMATSUB",
+   "SMP_SMATSCALARMULT",
+   "SMP_SMATTRANS",
+   "SMP_DVECTDVECMULT",
+   "SMP_DVECREDUCE",
+   "SMP_DMATREDUCE",
+   "SMP_BATCH",
+   "SMP_DMATDMATSCHUR",
+   "SMP_DMATTDMATSCHUR",
+   "SMP_SMATSMATSCHUR"
+   };
+
+   return names[static_cast<size_t>( id )];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches the threshold with the given name.
+// \ingroup system
+//
+// \param name The name of the threshold (with or without \c _THRESHOLD suffix).
+// \param id Reference to the identifier of the found threshold.
+// \return \a true in case the threshold was found, \a false if not.
+*/
+inline bool findThreshold( const std::string& name, ThresholdID& id ) noexcept
+{
+   const std::string suffix( "_THRESHOLD" );
+
+   const size_t length( ( name.size() > suffix.size() &&
+                          name.compare( name.size()-suffix.size(), suffix.size(), suffix ) == 0 )
+                        ?( name.size() - suffix.size() )
+                        :( name.size() ) );
+
+   for( size_t i=0UL; i<thresholdCount; ++i ) {
+      const char* const current( blaze::name( static_cast<ThresholdID>( i ) ) );
+      if( std::strlen( current ) == length && name.compare( 0UL, length, current ) == 0 ) {
+         id = static_cast<ThresholdID>( i );
+         return true;
+      }
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parses a single line of a threshold profile.
+// \ingroup system
+//
+// \param line The line to be parsed.
+// \param id Reference to the identifier of the parsed threshold.
+// \param value Reference to the parsed threshold value.
+// \return \a true in case the line contains a threshold setting, \a false if not.
+// \exception std::invalid_argument Invalid threshold setting.
+//
+// Each line of a threshold profile contains at most one setting of the form <tt>NAME = VALUE</tt>.
+// Empty lines and everything following a \c # character are ignored.
+*/
+inline bool parseThresholdSetting( std::string line, ThresholdID& id, size_t& value )
+{
+   const size_t comment( line.find( '#' ) );
+   if( comment != std::string::npos )
+      line.erase( comment );
+
+   const size_t equal( line.find( '=' ) );
+   if( equal != std::string::npos )
+      line[equal] = ' ';
+
+   std::istringstream iss( line );
+   std::string key;
+
+   if( !( iss >> key ) )
+      return false;
+
+   if( !findThreshold( key, id ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Unknown threshold" );
+   }
+
+   std::string number, rest;
+
+   if( !( iss >> number ) || ( iss >> rest ) ||
+       number.find_first_not_of( "0123456789" ) != std::string::npos ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid threshold value" );
+   }
+
+   value = static_cast<size_t>( std::strtoull( number.c_str(), nullptr, 10 ) );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads the threshold settings from the given file into the given table.
+// \ingroup system
+//
+// \param file The name of the threshold profile.
+// \param table The table to be updated.
+// \return void
+// \exception std::runtime_error The threshold profile could not be opened.
+// \exception std::invalid_argument Invalid threshold setting.
+*/
+inline void readThresholdProfile( const std::string& file, ThresholdTable& table )
+{
+   std::ifstream in( file.c_str() );
+
+   if( !in ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Threshold profile could not be opened" );
+   }
+
+   ThresholdTable tmp( table );
+   std::string line;
+   ThresholdID id;
+   size_t value( 0UL );
+
+   while( std::getline( in, line ) ) {
+      if( parseThresholdSetting( line, id, value ) ) {
+         tmp.values[static_cast<size_t>( id )] = value;
+         tmp.isSet [static_cast<size_t>( id )] = true;
+      }
+   }
+
+   table = tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initializes the threshold table from the environment.
+// \ingroup system
+//
+// \return The initialized threshold table.
+//
+// This function initializes the threshold table from the threshold profile specified by the
+// \c BLAZE_THRESHOLD_PROFILE environment variable and from the individual \c BLAZE_THRESHOLD_*
+// environment variables (as for instance \c BLAZE_THRESHOLD_SMP_DVECASSIGN). The individual
+// environment variables take precedence over the profile. Since the initialization happens
+// implicitly during the first use of a threshold, invalid profiles and settings are ignored.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+inline ThresholdTable initThresholdTable() noexcept
+{
+   ThresholdTable table;
+
+   for( size_t i=0UL; i<thresholdCount; ++i ) {
+      table.values[i] = 0UL;
+      table.isSet [i] = false;
+   }
+
+   try {
+      const char* profile = std::getenv( "BLAZE_THRESHOLD_PROFILE" );
+
+      if( profile != nullptr && *profile != '\0' ) {
+         try {
+            readThresholdProfile( profile, table );
+         }
+         catch( ... ) {}
+      }
+
+      for( size_t i=0UL; i<thresholdCount; ++i )
+      {
+         const std::string variable( std::string( "BLAZE_THRESHOLD_" ) + name( static_cast<ThresholdID>( i ) ) );
+         const char* env = std::getenv( variable.c_str() );
+
+         if( env != nullptr && *env != '\0' &&
+             std::string( env ).find_first_not_of( "0123456789" ) == std::string::npos ) {
+            table.values[i] = static_cast<size_t>( std::strtoull( env, nullptr, 10 ) );
+            table.isSet [i] = true;
+         }
+      }
+   }
+   catch( ... ) {}
+
+   return table;
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the global threshold table.
+// \ingroup system
+//
+// \return Reference to the global threshold table.
+*/
+inline ThresholdTable& thresholdTable() noexcept
+{
+   static ThresholdTable table( initThresholdTable() );
+   return table;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the runtime value of the given threshold.
+// \ingroup system
+//
+// \param id The identifier of the threshold.
+// \param value The new value of the threshold.
+// \return void
+//
+// This function overrides the current value of the given threshold. Note that this function is
+// not thread-safe and must not be called while other threads perform Blaze operations.
+*/
+inline void setThreshold( ThresholdID id, size_t value ) noexcept
+{
+   ThresholdTable& table( thresholdTable() );
+   table.values[static_cast<size_t>( id )] = value;
+   table.isSet [static_cast<size_t>( id )] = true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the given threshold to its compile time value.
+// \ingroup system
+//
+// \param id The identifier of the threshold.
+// \return void
+//
+// Note that this function is not thread-safe and must not be called while other threads perform
+// Blaze operations.
+*/
+inline void resetThreshold( ThresholdID id ) noexcept
+{
+   thresholdTable().isSet[static_cast<size_t>( id )] = false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the runtime value of the given threshold.
+// \ingroup system
+//
+// \param id The identifier of the threshold.
+// \param defaultValue The compile time value of the threshold.
+// \return The runtime value of the threshold, or the default value if it is not configured.
+*/
+inline size_t getThreshold( ThresholdID id, size_t defaultValue ) noexcept
+{
+   const ThresholdTable& table( thresholdTable() );
+   return ( table.isSet[static_cast<size_t>( id )] )
+          ?( table.values[static_cast<size_t>( id )] )
+          :( defaultValue );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads the given threshold profile.
+// \ingroup system
+//
+// \param file The name of the threshold profile.
+// \return void
+// \exception std::runtime_error The threshold profile could not be opened.
+// \exception std::invalid_argument Invalid threshold setting.
+//
+// This function reads all threshold settings from the given profile and applies them. A
+// threshold profile is a text file containing one setting of the form <tt>NAME = VALUE</tt>
+// per line (see ThresholdID for the available names). Empty lines and everything following
+// a \c # character are ignored. Thresholds that are not contained in the profile keep their
+// current value. In case the profile cannot be opened or contains an invalid setting, an
+// exception is thrown and none of the thresholds are changed. Note that this function is not
+// thread-safe and must not be called while other threads perform Blaze operations.
+*/
+inline void loadThresholdProfile( const std::string& file )
+{
+   readThresholdProfile( file, thresholdTable() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Runtime configurable threshold.
+// \ingroup system
+//
+// The RuntimeThreshold class represents a threshold whose value is determined at runtime. In
+// case the runtime thresholds are activated (see <tt>./blaze/config/Thresholds.h</tt>), all
+// Blaze thresholds (as for instance blaze::SMP_DVECASSIGN_THRESHOLD) are of this type. The
+// threshold implicitly converts to its current value, which is either the value configured via
+// a threshold profile, an environment variable or the setThreshold() function, or the compile
+// time default value.
+*/
+class RuntimeThreshold
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the RuntimeThreshold class.
+   //
+   // \param id The identifier of the threshold.
+   // \param defaultValue The compile time value of the threshold.
+   */
+   explicit constexpr RuntimeThreshold( ThresholdID id, size_t defaultValue ) noexcept
+      : id_          ( id           )  // The identifier of the threshold
+      , defaultValue_( defaultValue )  // The compile time value of the threshold
+   {}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\brief Conversion to the current value of the threshold.
+   //
+   // \return The current value of the threshold.
+   */
+   inline operator size_t() const noexcept {
+      return getThreshold( id_, defaultValue_ );
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the identifier of the threshold.
+   //
+   // \return The identifier of the threshold.
+   */
+   constexpr ThresholdID id() const noexcept {
+      return id_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the compile time value of the threshold.
+   //
+   // \return The compile time value of the threshold.
+   */
+   constexpr size_t defaultValue() const noexcept {
+      return defaultValue_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   ThresholdID id_;            //!< The identifier of the threshold.
+   size_t      defaultValue_;  //!< The compile time value of the threshold.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
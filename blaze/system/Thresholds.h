@@ -55,6 +55,10 @@
 
 #include <blaze/config/Thresholds.h>
 
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+#  include <blaze/system/ThresholdProfile.h>
+#endif
+
 
 
 
@@ -248,6 +252,20 @@ constexpr size_t TSMATTDMATMULT_DEBUG_THRESHOLD = 256UL;
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+constexpr RuntimeThreshold DMATDVECMULT_THRESHOLD  ( ThresholdID::DMATDVECMULT,   ( BLAZE_DEBUG_MODE ? DMATDVECMULT_DEBUG_THRESHOLD   : DMATDVECMULT_USER_THRESHOLD   ) );
+constexpr RuntimeThreshold TDMATDVECMULT_THRESHOLD ( ThresholdID::TDMATDVECMULT,  ( BLAZE_DEBUG_MODE ? TDMATDVECMULT_DEBUG_THRESHOLD  : TDMATDVECMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold TDVECDMATMULT_THRESHOLD ( ThresholdID::TDVECDMATMULT,  ( BLAZE_DEBUG_MODE ? TDVECDMATMULT_DEBUG_THRESHOLD  : TDVECDMATMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold TDVECTDMATMULT_THRESHOLD( ThresholdID::TDVECTDMATMULT, ( BLAZE_DEBUG_MODE ? TDVECTDMATMULT_DEBUG_THRESHOLD : TDVECTDMATMULT_USER_THRESHOLD ) );
+constexpr RuntimeThreshold DMATDMATMULT_THRESHOLD  ( ThresholdID::DMATDMATMULT,   ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DEBUG_THRESHOLD   : DMATDMATMULT_USER_THRESHOLD   ) );
+constexpr RuntimeThreshold DMATTDMATMULT_THRESHOLD ( ThresholdID::DMATTDMATMULT,  ( BLAZE_DEBUG_MODE ? DMATTDMATMULT_DEBUG_THRESHOLD  : DMATTDMATMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold TDMATDMATMULT_THRESHOLD ( ThresholdID::TDMATDMATMULT,  ( BLAZE_DEBUG_MODE ? TDMATDMATMULT_DEBUG_THRESHOLD  : TDMATDMATMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold TDMATTDMATMULT_THRESHOLD( ThresholdID::TDMATTDMATMULT, ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_THRESHOLD : TDMATTDMATMULT_USER_THRESHOLD ) );
+constexpr RuntimeThreshold DMATSMATMULT_THRESHOLD  ( ThresholdID::DMATSMATMULT,   ( BLAZE_DEBUG_MODE ? DMATSMATMULT_DEBUG_THRESHOLD   : DMATSMATMULT_USER_THRESHOLD   ) );
+constexpr RuntimeThreshold TDMATSMATMULT_THRESHOLD ( ThresholdID::TDMATSMATMULT,  ( BLAZE_DEBUG_MODE ? TDMATSMATMULT_DEBUG_THRESHOLD  : TDMATSMATMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold TSMATDMATMULT_THRESHOLD ( ThresholdID::TSMATDMATMULT,  ( BLAZE_DEBUG_MODE ? TSMATDMATMULT_DEBUG_THRESHOLD  : TSMATDMATMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold TSMATTDMATMULT_THRESHOLD( ThresholdID::TSMATTDMATMULT, ( BLAZE_DEBUG_MODE ? TSMATTDMATMULT_DEBUG_THRESHOLD : TSMATTDMATMULT_USER_THRESHOLD ) );
+#else
 constexpr size_t DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDVECMULT_DEBUG_THRESHOLD   : DMATDVECMULT_USER_THRESHOLD   );
 constexpr size_t TDMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATDVECMULT_DEBUG_THRESHOLD  : TDMATDVECMULT_USER_THRESHOLD  );
 constexpr size_t TDVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDVECDMATMULT_DEBUG_THRESHOLD  : TDVECDMATMULT_USER_THRESHOLD  );
@@ -260,6 +278,7 @@ constexpr size_t DMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATSMATMULT_DE
 constexpr size_t TDMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATSMATMULT_DEBUG_THRESHOLD  : TDMATSMATMULT_USER_THRESHOLD  );
 constexpr size_t TSMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TSMATDMATMULT_DEBUG_THRESHOLD  : TSMATDMATMULT_USER_THRESHOLD  );
 constexpr size_t TSMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TSMATTDMATMULT_DEBUG_THRESHOLD : TSMATTDMATMULT_USER_THRESHOLD );
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
@@ -656,6 +675,37 @@ constexpr size_t SMP_DMATTDMATSUB_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP row-major dense matrix/row-major dense matrix Schur product threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_DMATDMATSCHUR_USER_THRESHOLD while the
+// Blaze debug mode is active. It specifies when a row-major dense matrix/row-major dense matrix
+// Schur product can be executed in parallel. This threshold affects both Schur products between
+// two row-major matrices or two column-major dense matrices. In case the number of elements of
+// the target matrix is larger or equal to this threshold, the operation is executed in parallel.
+// If the number of elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DMATDMATSCHUR_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP row-major dense matrix/column-major dense matrix Schur product threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_DMATTDMATSCHUR_USER_THRESHOLD while the
+// Blaze debug mode is active. It specifies when a row-major dense matrix/column-major dense
+// matrix Schur product can be executed in parallel. This threshold affects both Schur products
+// between a row-major matrix and a column-major matrix and a column-major matrix and a row-major
+// matrix. In case the number of elements of the target matrix is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP dense matrix/scalar multiplication/division threshold.
 // \ingroup config
@@ -894,6 +944,76 @@ constexpr size_t SMP_TSMATTSMATMULT_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/sparse matrix addition threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_SMATSMATADD_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a sparse matrix/sparse matrix addition can be executed in parallel. In case
+// the number of non-zero elements of the sparse matrix operands is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of non-zero elements is below
+// this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATSMATADD_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/sparse matrix subtraction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_SMATSMATSUB_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a sparse matrix/sparse matrix subtraction can be executed in parallel. In case
+// the number of non-zero elements of the sparse matrix operands is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of non-zero elements is below
+// this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATSMATSUB_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix Schur product threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_SMATSMATSCHUR_USER_THRESHOLD while the
+// Blaze debug mode is active. It specifies when a Schur product with a sparse result can be
+// executed in parallel. In case the number of non-zero elements of the sparse matrix operands
+// is larger or equal to this threshold, the operation is executed in parallel. If the number of
+// non-zero elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATSMATSCHUR_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/scalar multiplication threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_SMATSCALARMULT_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a sparse matrix/scalar multiplication can be executed in parallel. In case
+// the number of non-zero elements of the sparse matrix operands is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of non-zero elements is below
+// this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATSCALARMULT_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix transposition threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_SMATTRANS_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the transposition of a sparse matrix can be executed in parallel. In case
+// the number of non-zero elements of the sparse matrix operands is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of non-zero elements is below
+// this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATTRANS_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP dense vector/dense vector outer product threshold.
 // \ingroup config
@@ -908,8 +1028,107 @@ constexpr size_t SMP_DVECTDVECMULT_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_DVECREDUCE_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the reduction of a dense vector can be executed in
+// parallel. In case the number of elements of the dense vector is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DVECREDUCE_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_DMATREDUCE_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the reduction of a dense matrix can be executed in
+// parallel. In case the number of elements of the dense matrix is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DMATREDUCE_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP small matrix batch threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_BATCH_USER_THRESHOLD while the Blaze debug
+// mode is active. It specifies when an operation on a batch of small matrices can be executed in
+// parallel. In case the number of matrices in the batch is larger or equal to this threshold,
+// the operation is executed in parallel. If the number of matrices is below this threshold the
+// operation is executed single-threaded.
+*/
+constexpr size_t SMP_BATCH_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+constexpr RuntimeThreshold SMP_DVECASSIGN_THRESHOLD    ( ThresholdID::SMP_DVECASSIGN,     ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : SMP_DVECASSIGN_USER_THRESHOLD     ) );
+constexpr RuntimeThreshold SMP_DVECDVECADD_THRESHOLD   ( ThresholdID::SMP_DVECDVECADD,    ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD    : SMP_DVECDVECADD_USER_THRESHOLD    ) );
+constexpr RuntimeThreshold SMP_DVECDVECSUB_THRESHOLD   ( ThresholdID::SMP_DVECDVECSUB,    ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD    : SMP_DVECDVECSUB_USER_THRESHOLD    ) );
+constexpr RuntimeThreshold SMP_DVECDVECMULT_THRESHOLD  ( ThresholdID::SMP_DVECDVECMULT,   ( BLAZE_DEBUG_MODE ? SMP_DVECDVECMULT_DEBUG_THRESHOLD   : SMP_DVECDVECMULT_USER_THRESHOLD   ) );
+constexpr RuntimeThreshold SMP_DVECDVECDIV_THRESHOLD   ( ThresholdID::SMP_DVECDVECDIV,    ( BLAZE_DEBUG_MODE ? SMP_DVECDVECDIV_DEBUG_THRESHOLD    : SMP_DVECDVECDIV_USER_THRESHOLD    ) );
+constexpr RuntimeThreshold SMP_DVECSCALARMULT_THRESHOLD( ThresholdID::SMP_DVECSCALARMULT, ( BLAZE_DEBUG_MODE ? SMP_DVECSCALARMULT_DEBUG_THRESHOLD : SMP_DVECSCALARMULT_USER_THRESHOLD ) );
+constexpr RuntimeThreshold SMP_DMATDVECMULT_THRESHOLD  ( ThresholdID::SMP_DMATDVECMULT,   ( BLAZE_DEBUG_MODE ? SMP_DMATDVECMULT_DEBUG_THRESHOLD   : SMP_DMATDVECMULT_USER_THRESHOLD   ) );
+constexpr RuntimeThreshold SMP_TDMATDVECMULT_THRESHOLD ( ThresholdID::SMP_TDMATDVECMULT,  ( BLAZE_DEBUG_MODE ? SMP_TDMATDVECMULT_DEBUG_THRESHOLD  : SMP_TDMATDVECMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_TDVECDMATMULT_THRESHOLD ( ThresholdID::SMP_TDVECDMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_TDVECDMATMULT_DEBUG_THRESHOLD  : SMP_TDVECDMATMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_TDVECTDMATMULT_THRESHOLD( ThresholdID::SMP_TDVECTDMATMULT, ( BLAZE_DEBUG_MODE ? SMP_TDVECTDMATMULT_DEBUG_THRESHOLD : SMP_TDVECTDMATMULT_USER_THRESHOLD ) );
+constexpr RuntimeThreshold SMP_DMATSVECMULT_THRESHOLD  ( ThresholdID::SMP_DMATSVECMULT,   ( BLAZE_DEBUG_MODE ? SMP_DMATSVECMULT_DEBUG_THRESHOLD   : SMP_DMATSVECMULT_USER_THRESHOLD   ) );
+constexpr RuntimeThreshold SMP_TDMATSVECMULT_THRESHOLD ( ThresholdID::SMP_TDMATSVECMULT,  ( BLAZE_DEBUG_MODE ? SMP_TDMATSVECMULT_DEBUG_THRESHOLD  : SMP_TDMATSVECMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_TSVECDMATMULT_THRESHOLD ( ThresholdID::SMP_TSVECDMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_TSVECDMATMULT_DEBUG_THRESHOLD  : SMP_TSVECDMATMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_TSVECTDMATMULT_THRESHOLD( ThresholdID::SMP_TSVECTDMATMULT, ( BLAZE_DEBUG_MODE ? SMP_TSVECTDMATMULT_DEBUG_THRESHOLD : SMP_TSVECTDMATMULT_USER_THRESHOLD ) );
+constexpr RuntimeThreshold SMP_SMATDVECMULT_THRESHOLD  ( ThresholdID::SMP_SMATDVECMULT,   ( BLAZE_DEBUG_MODE ? SMP_SMATDVECMULT_DEBUG_THRESHOLD   : SMP_SMATDVECMULT_USER_THRESHOLD   ) );
+constexpr RuntimeThreshold SMP_TSMATDVECMULT_THRESHOLD ( ThresholdID::SMP_TSMATDVECMULT,  ( BLAZE_DEBUG_MODE ? SMP_TSMATDVECMULT_DEBUG_THRESHOLD  : SMP_TSMATDVECMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_TDVECSMATMULT_THRESHOLD ( ThresholdID::SMP_TDVECSMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_TDVECSMATMULT_DEBUG_THRESHOLD  : SMP_TDVECSMATMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_TDVECTSMATMULT_THRESHOLD( ThresholdID::SMP_TDVECTSMATMULT, ( BLAZE_DEBUG_MODE ? SMP_TDVECTSMATMULT_DEBUG_THRESHOLD : SMP_TDVECTSMATMULT_USER_THRESHOLD ) );
+constexpr RuntimeThreshold SMP_SMATSVECMULT_THRESHOLD  ( ThresholdID::SMP_SMATSVECMULT,   ( BLAZE_DEBUG_MODE ? SMP_SMATSVECMULT_DEBUG_THRESHOLD   : SMP_SMATSVECMULT_USER_THRESHOLD   ) );
+constexpr RuntimeThreshold SMP_TSMATSVECMULT_THRESHOLD ( ThresholdID::SMP_TSMATSVECMULT,  ( BLAZE_DEBUG_MODE ? SMP_TSMATSVECMULT_DEBUG_THRESHOLD  : SMP_TSMATSVECMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_TSVECSMATMULT_THRESHOLD ( ThresholdID::SMP_TSVECSMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_TSVECSMATMULT_DEBUG_THRESHOLD  : SMP_TSVECSMATMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_TSVECTSMATMULT_THRESHOLD( ThresholdID::SMP_TSVECTSMATMULT, ( BLAZE_DEBUG_MODE ? SMP_TSVECTSMATMULT_DEBUG_THRESHOLD : SMP_TSVECTSMATMULT_USER_THRESHOLD ) );
+constexpr RuntimeThreshold SMP_DMATASSIGN_THRESHOLD    ( ThresholdID::SMP_DMATASSIGN,     ( BLAZE_DEBUG_MODE ? SMP_DMATASSIGN_DEBUG_THRESHOLD     : SMP_DMATASSIGN_USER_THRESHOLD     ) );
+constexpr RuntimeThreshold SMP_DMATDMATADD_THRESHOLD   ( ThresholdID::SMP_DMATDMATADD,    ( BLAZE_DEBUG_MODE ? SMP_DMATDMATADD_DEBUG_THRESHOLD    : SMP_DMATDMATADD_USER_THRESHOLD    ) );
+constexpr RuntimeThreshold SMP_DMATTDMATADD_THRESHOLD  ( ThresholdID::SMP_DMATTDMATADD,   ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD   : SMP_DMATTDMATADD_USER_THRESHOLD   ) );
+constexpr RuntimeThreshold SMP_DMATDMATSUB_THRESHOLD   ( ThresholdID::SMP_DMATDMATSUB,    ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD    : SMP_DMATDMATSUB_USER_THRESHOLD    ) );
+constexpr RuntimeThreshold SMP_DMATTDMATSUB_THRESHOLD  ( ThresholdID::SMP_DMATTDMATSUB,   ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD   : SMP_DMATTDMATSUB_USER_THRESHOLD   ) );
+constexpr RuntimeThreshold SMP_DMATDMATSCHUR_THRESHOLD ( ThresholdID::SMP_DMATDMATSCHUR,  ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSCHUR_DEBUG_THRESHOLD  : SMP_DMATDMATSCHUR_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_DMATTDMATSCHUR_THRESHOLD( ThresholdID::SMP_DMATTDMATSCHUR, ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD : SMP_DMATTDMATSCHUR_USER_THRESHOLD ) );
+constexpr RuntimeThreshold SMP_DMATSCALARMULT_THRESHOLD( ThresholdID::SMP_DMATSCALARMULT, ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD : SMP_DMATSCALARMULT_USER_THRESHOLD ) );
+constexpr RuntimeThreshold SMP_DMATDMATMULT_THRESHOLD  ( ThresholdID::SMP_DMATDMATMULT,   ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD   : SMP_DMATDMATMULT_USER_THRESHOLD   ) );
+constexpr RuntimeThreshold SMP_DMATTDMATMULT_THRESHOLD ( ThresholdID::SMP_DMATTDMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD  : SMP_DMATTDMATMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_TDMATDMATMULT_THRESHOLD ( ThresholdID::SMP_TDMATDMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_TDMATDMATMULT_DEBUG_THRESHOLD  : SMP_TDMATDMATMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_TDMATTDMATMULT_THRESHOLD( ThresholdID::SMP_TDMATTDMATMULT, ( BLAZE_DEBUG_MODE ? SMP_TDMATTDMATMULT_DEBUG_THRESHOLD : SMP_TDMATTDMATMULT_USER_THRESHOLD ) );
+constexpr RuntimeThreshold SMP_DMATSMATMULT_THRESHOLD  ( ThresholdID::SMP_DMATSMATMULT,   ( BLAZE_DEBUG_MODE ? SMP_DMATSMATMULT_DEBUG_THRESHOLD   : SMP_DMATSMATMULT_USER_THRESHOLD   ) );
+constexpr RuntimeThreshold SMP_DMATTSMATMULT_THRESHOLD ( ThresholdID::SMP_DMATTSMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_DMATTSMATMULT_DEBUG_THRESHOLD  : SMP_DMATTSMATMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_TDMATSMATMULT_THRESHOLD ( ThresholdID::SMP_TDMATSMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_TDMATSMATMULT_DEBUG_THRESHOLD  : SMP_TDMATSMATMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_TDMATTSMATMULT_THRESHOLD( ThresholdID::SMP_TDMATTSMATMULT, ( BLAZE_DEBUG_MODE ? SMP_TDMATTSMATMULT_DEBUG_THRESHOLD : SMP_TDMATTSMATMULT_USER_THRESHOLD ) );
+constexpr RuntimeThreshold SMP_SMATDMATMULT_THRESHOLD  ( ThresholdID::SMP_SMATDMATMULT,   ( BLAZE_DEBUG_MODE ? SMP_SMATDMATMULT_DEBUG_THRESHOLD   : SMP_SMATDMATMULT_USER_THRESHOLD   ) );
+constexpr RuntimeThreshold SMP_SMATTDMATMULT_THRESHOLD ( ThresholdID::SMP_SMATTDMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_SMATTDMATMULT_DEBUG_THRESHOLD  : SMP_SMATTDMATMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_TSMATDMATMULT_THRESHOLD ( ThresholdID::SMP_TSMATDMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_TSMATDMATMULT_DEBUG_THRESHOLD  : SMP_TSMATDMATMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_TSMATTDMATMULT_THRESHOLD( ThresholdID::SMP_TSMATTDMATMULT, ( BLAZE_DEBUG_MODE ? SMP_TSMATTDMATMULT_DEBUG_THRESHOLD : SMP_TSMATTDMATMULT_USER_THRESHOLD ) );
+constexpr RuntimeThreshold SMP_SMATSMATMULT_THRESHOLD  ( ThresholdID::SMP_SMATSMATMULT,   ( BLAZE_DEBUG_MODE ? SMP_SMATSMATMULT_DEBUG_THRESHOLD   : SMP_SMATSMATMULT_USER_THRESHOLD   ) );
+constexpr RuntimeThreshold SMP_SMATTSMATMULT_THRESHOLD ( ThresholdID::SMP_SMATTSMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD  : SMP_SMATTSMATMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_TSMATSMATMULT_THRESHOLD ( ThresholdID::SMP_TSMATSMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD  : SMP_TSMATSMATMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_TSMATTSMATMULT_THRESHOLD( ThresholdID::SMP_TSMATTSMATMULT, ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : SMP_TSMATTSMATMULT_USER_THRESHOLD ) );
+constexpr RuntimeThreshold SMP_SMATSMATADD_THRESHOLD   ( ThresholdID::SMP_SMATSMATADD,    ( BLAZE_DEBUG_MODE ? SMP_SMATSMATADD_DEBUG_THRESHOLD    : SMP_SMATSMATADD_USER_THRESHOLD    ) );
+constexpr RuntimeThreshold SMP_SMATSMATSUB_THRESHOLD   ( ThresholdID::SMP_SMATSMATSUB,    ( BLAZE_DEBUG_MODE ? SMP_SMATSMATSUB_DEBUG_THRESHOLD    : SMP_SMATSMATSUB_USER_THRESHOLD    ) );
+constexpr RuntimeThreshold SMP_SMATSMATSCHUR_THRESHOLD ( ThresholdID::SMP_SMATSMATSCHUR,  ( BLAZE_DEBUG_MODE ? SMP_SMATSMATSCHUR_DEBUG_THRESHOLD  : SMP_SMATSMATSCHUR_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_SMATSCALARMULT_THRESHOLD( ThresholdID::SMP_SMATSCALARMULT, ( BLAZE_DEBUG_MODE ? SMP_SMATSCALARMULT_DEBUG_THRESHOLD : SMP_SMATSCALARMULT_USER_THRESHOLD ) );
+constexpr RuntimeThreshold SMP_SMATTRANS_THRESHOLD     ( ThresholdID::SMP_SMATTRANS,      ( BLAZE_DEBUG_MODE ? SMP_SMATTRANS_DEBUG_THRESHOLD      : SMP_SMATTRANS_USER_THRESHOLD      ) );
+constexpr RuntimeThreshold SMP_DVECTDVECMULT_THRESHOLD ( ThresholdID::SMP_DVECTDVECMULT,  ( BLAZE_DEBUG_MODE ? SMP_DVECTDVECMULT_DEBUG_THRESHOLD  : SMP_DVECTDVECMULT_USER_THRESHOLD  ) );
+constexpr RuntimeThreshold SMP_DVECREDUCE_THRESHOLD    ( ThresholdID::SMP_DVECREDUCE,     ( BLAZE_DEBUG_MODE ? SMP_DVECREDUCE_DEBUG_THRESHOLD     : SMP_DVECREDUCE_USER_THRESHOLD     ) );
+constexpr RuntimeThreshold SMP_DMATREDUCE_THRESHOLD    ( ThresholdID::SMP_DMATREDUCE,     ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD     : SMP_DMATREDUCE_USER_THRESHOLD     ) );
+constexpr RuntimeThreshold SMP_BATCH_THRESHOLD         ( ThresholdID::SMP_BATCH,          ( BLAZE_DEBUG_MODE ? SMP_BATCH_DEBUG_THRESHOLD          : SMP_BATCH_USER_THRESHOLD          ) );
+#else
 constexpr size_t SMP_DVECASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : SMP_DVECASSIGN_USER_THRESHOLD     );
 constexpr size_t SMP_DVECDVECADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD    : SMP_DVECDVECADD_USER_THRESHOLD    );
 constexpr size_t SMP_DVECDVECSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD    : SMP_DVECDVECSUB_USER_THRESHOLD    );
@@ -937,6 +1156,8 @@ constexpr size_t SMP_DMATDMATADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMA
 constexpr size_t SMP_DMATTDMATADD_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD   : SMP_DMATTDMATADD_USER_THRESHOLD   );
 constexpr size_t SMP_DMATDMATSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD    : SMP_DMATDMATSUB_USER_THRESHOLD    );
 constexpr size_t SMP_DMATTDMATSUB_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD   : SMP_DMATTDMATSUB_USER_THRESHOLD   );
+constexpr size_t SMP_DMATDMATSCHUR_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSCHUR_DEBUG_THRESHOLD  : SMP_DMATDMATSCHUR_USER_THRESHOLD  );
+constexpr size_t SMP_DMATTDMATSCHUR_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD : SMP_DMATTDMATSCHUR_USER_THRESHOLD );
 constexpr size_t SMP_DMATSCALARMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD : SMP_DMATSCALARMULT_USER_THRESHOLD );
 constexpr size_t SMP_DMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD   : SMP_DMATDMATMULT_USER_THRESHOLD   );
 constexpr size_t SMP_DMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD  : SMP_DMATTDMATMULT_USER_THRESHOLD  );
@@ -954,7 +1175,16 @@ constexpr size_t SMP_SMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSMA
 constexpr size_t SMP_SMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD  : SMP_SMATTSMATMULT_USER_THRESHOLD  );
 constexpr size_t SMP_TSMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD  : SMP_TSMATSMATMULT_USER_THRESHOLD  );
 constexpr size_t SMP_TSMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : SMP_TSMATTSMATMULT_USER_THRESHOLD );
+constexpr size_t SMP_SMATSMATADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATADD_DEBUG_THRESHOLD    : SMP_SMATSMATADD_USER_THRESHOLD    );
+constexpr size_t SMP_SMATSMATSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATSUB_DEBUG_THRESHOLD    : SMP_SMATSMATSUB_USER_THRESHOLD    );
+constexpr size_t SMP_SMATSMATSCHUR_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATSCHUR_DEBUG_THRESHOLD  : SMP_SMATSMATSCHUR_USER_THRESHOLD  );
+constexpr size_t SMP_SMATSCALARMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_SMATSCALARMULT_DEBUG_THRESHOLD : SMP_SMATSCALARMULT_USER_THRESHOLD );
+constexpr size_t SMP_SMATTRANS_THRESHOLD      = ( BLAZE_DEBUG_MODE ? SMP_SMATTRANS_DEBUG_THRESHOLD      : SMP_SMATTRANS_USER_THRESHOLD      );
 constexpr size_t SMP_DVECTDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECTDVECMULT_DEBUG_THRESHOLD  : SMP_DVECTDVECMULT_USER_THRESHOLD  );
+constexpr size_t SMP_DVECREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECREDUCE_DEBUG_THRESHOLD     : SMP_DVECREDUCE_USER_THRESHOLD     );
+constexpr size_t SMP_DMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD     : SMP_DMATREDUCE_USER_THRESHOLD     );
+constexpr size_t SMP_BATCH_THRESHOLD          = ( BLAZE_DEBUG_MODE ? SMP_BATCH_DEBUG_THRESHOLD          : SMP_BATCH_USER_THRESHOLD          );
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
@@ -971,6 +1201,7 @@ constexpr size_t SMP_DVECTDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECTDV
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if !BLAZE_USE_RUNTIME_THRESHOLDS
 namespace {
 
 BLAZE_STATIC_ASSERT( blaze::DMATDVECMULT_THRESHOLD   > 0UL );
@@ -1008,6 +1239,8 @@ BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATADD_THRESHOLD    >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATADD_THRESHOLD   >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSUB_THRESHOLD    >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSUB_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSCHUR_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSCHUR_THRESHOLD >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATSCALARMULT_THRESHOLD >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATMULT_THRESHOLD   >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATMULT_THRESHOLD  >= 0UL );
@@ -1025,9 +1258,18 @@ BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_THRESHOLD   >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATADD_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATSUB_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATSCHUR_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSCALARMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTRANS_THRESHOLD      >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECTDVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_BATCH_THRESHOLD          >= 0UL );
 
 }
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
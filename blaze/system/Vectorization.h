@@ -110,7 +110,7 @@
 
 //=================================================================================================
 //
-//  SSE/AVX/MIC MODE CONFIGURATION
+//  SSE/AVX/AVX-512/MIC MODE CONFIGURATION
 //
 //=================================================================================================
 
@@ -233,6 +233,60 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX-512F mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX-512F mode. In case the AVX-512F mode is
+// enabled (i.e. in case AVX-512F functionality is available) the Blaze library attempts to
+// vectorize the linear algebra operations on 32-bit and 64-bit data types by AVX-512F
+// intrinsics. In case the AVX-512F mode is disabled, the Blaze library chooses the AVX2
+// functionality for the operations (if available).
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512F__)
+#  define BLAZE_AVX512F_MODE 1
+#else
+#  define BLAZE_AVX512F_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX-512BW mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX-512BW mode. In case the AVX-512BW mode is
+// enabled (i.e. in case AVX-512BW functionality is available) the Blaze library attempts to
+// vectorize the linear algebra operations on 8-bit and 16-bit integral data types by AVX-512BW
+// intrinsics. In case the AVX-512BW mode is disabled, the Blaze library chooses the AVX2
+// functionality for these data types (if available).
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512BW__)
+#  define BLAZE_AVX512BW_MODE 1
+#else
+#  define BLAZE_AVX512BW_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX-512DQ mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX-512DQ mode. In case the AVX-512DQ mode is
+// enabled (i.e. in case AVX-512DQ functionality is available) the Blaze library attempts to
+// vectorize the multiplication of 64-bit integral data types by AVX-512DQ intrinsics. In case
+// the AVX-512DQ mode is disabled, the Blaze library chooses default, non-vectorized
+// functionality for these operations.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512DQ__)
+#  define BLAZE_AVX512DQ_MODE 1
+#else
+#  define BLAZE_AVX512DQ_MODE 0
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Compilation switch for the MIC mode.
 // \ingroup system
@@ -302,6 +356,70 @@
 
 
 
+//=================================================================================================
+//
+//  RUNTIME DISPATCH MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime dispatch mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the runtime dispatch mode. In case the runtime
+// dispatch mode is enabled (i.e. in case the runtime dispatch is requested via the
+// BLAZE_USE_RUNTIME_DISPATCH switch, a GCC or Clang compiler is used on an x86 platform and the
+// code is not yet compiled for AVX-512F), the Blaze library compiles AVX2 and AVX-512F versions
+// of selected kernels and picks the best supported version at runtime. In case the runtime
+// dispatch mode is disabled, the instruction set is exclusively determined at compile time.
+*/
+#if BLAZE_USE_VECTORIZATION && BLAZE_USE_RUNTIME_DISPATCH && \
+    !BLAZE_AVX512F_MODE && !BLAZE_MIC_MODE && \
+    ( defined(__x86_64__) || defined(__i386__) ) && \
+    ( defined(__clang__) || ( defined(__GNUC__) && __GNUC__ >= 5 && !defined(__INTEL_COMPILER) ) )
+#  define BLAZE_RUNTIME_DISPATCH_MODE 1
+#else
+#  define BLAZE_RUNTIME_DISPATCH_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\def BLAZE_TARGET_AVX2
+// \brief Function attribute for the compilation of a runtime dispatched AVX2 kernel.
+// \ingroup system
+//
+// This attribute instructs the compiler to compile the attributed function for the AVX2 and
+// FMA instruction sets, independent of the compiler flags. The attributed function must only
+// be called in case the CPU supports both instruction sets (see blaze::activeISA()).
+*/
+#if BLAZE_RUNTIME_DISPATCH_MODE
+#  define BLAZE_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#  define BLAZE_TARGET_AVX2
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\def BLAZE_TARGET_AVX512F
+// \brief Function attribute for the compilation of a runtime dispatched AVX-512F kernel.
+// \ingroup system
+//
+// This attribute instructs the compiler to compile the attributed function for the AVX-512F
+// instruction set, independent of the compiler flags. The attributed function must only be
+// called in case the CPU supports the instruction set (see blaze::activeISA()).
+*/
+#if BLAZE_RUNTIME_DISPATCH_MODE
+#  define BLAZE_TARGET_AVX512F __attribute__((target("avx2,fma,avx512f")))
+#else
+#  define BLAZE_TARGET_AVX512F
+#endif
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
@@ -319,6 +437,10 @@ BLAZE_STATIC_ASSERT( !BLAZE_SSE4_MODE  || BLAZE_SSSE3_MODE );
 BLAZE_STATIC_ASSERT( !BLAZE_AVX_MODE   || BLAZE_SSE4_MODE  );
 BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
 
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512F_MODE  || BLAZE_AVX2_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512BW_MODE || BLAZE_AVX512F_MODE );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512DQ_MODE || BLAZE_AVX512F_MODE );
+
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -328,11 +450,11 @@ BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
 
 //=================================================================================================
 //
-//  SSE/AVX/MIC INCLUDE FILE CONFIGURATION
+//  SSE/AVX/AVX-512/MIC INCLUDE FILE CONFIGURATION
 //
 //=================================================================================================
 
-#if BLAZE_MIC_MODE || BLAZE_AVX_MODE || BLAZE_AVX2_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || BLAZE_AVX2_MODE || BLAZE_RUNTIME_DISPATCH_MODE
 #  include <immintrin.h>
 #elif BLAZE_SSE4_MODE
 #  include <smmintrin.h>
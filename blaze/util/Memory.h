@@ -49,6 +49,7 @@
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Exception.h>
+#include <blaze/util/NumaPolicy.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -74,7 +75,8 @@ namespace blaze {
 //
 // This function provides the functionality to allocate memory based on the given alignment
 // restrictions. For that purpose it uses the according system-specific memory allocation
-// functions.
+// functions. In case the blaze::NumaPolicy::interleave policy is active, the pages of large
+// allocations are interleaved across all memory nodes of the system (see blaze::interleave()).
 */
 inline byte_t* allocate_backend( size_t size, size_t alignment )
 {
@@ -89,6 +91,10 @@ inline byte_t* allocate_backend( size_t size, size_t alignment )
       BLAZE_THROW_BAD_ALLOC;
    }
 
+   if( size >= 1048576UL && numaPolicy() == NumaPolicy::interleave ) {
+      interleave( raw, size );
+   }
+
    return reinterpret_cast<byte_t*>( raw );
 }
 /*! \endcond */
@@ -0,0 +1,269 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/MemoryMap.h
+//  \brief Header file for the MemoryMap class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_MEMORYMAP_H_
+#define _BLAZE_UTIL_MEMORYMAP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_MSC_VER)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+#include <string>
+#include <blaze/util/Exception.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Private memory mapping of a complete file.
+// \ingroup util
+//
+// The MemoryMap class maps the complete content of a file into the address space of the calling
+// process. The pages of the file are loaded lazily on first access and are shared between all
+// processes that map the same file. The mapping is private, i.e. write accesses are possible
+// but trigger a copy of the affected pages and never modify the underlying file. The mapping is
+// released as soon as the MemoryMap instance is destroyed:
+
+   \code
+   blaze::MemoryMap map( "matrix.bin" );
+
+   const blaze::byte_t* data = map.data();  // Pointer to the first byte of the file
+   const size_t size = map.size();          // The size of the file in bytes
+   \endcode
+
+// In case the file cannot be opened or mapped, a \a std::runtime_error exception is thrown.
+*/
+class MemoryMap : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MemoryMap( const std::string& file );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MemoryMap();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline byte_t*       data() noexcept;
+   inline const byte_t* data() const noexcept;
+   inline size_t        size() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   byte_t* data_;  //!< The address of the first byte of the mapped file.
+   size_t  size_;  //!< The size of the mapped file in bytes.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Maps the given file into memory.
+//
+// \param file The name of the file to be mapped.
+// \exception std::runtime_error File could not be mapped.
+*/
+inline MemoryMap::MemoryMap( const std::string& file )
+   : data_( nullptr )  // The address of the first byte of the mapped file
+   , size_( 0UL     )  // The size of the mapped file in bytes
+{
+#if defined(_MSC_VER)
+   HANDLE handle( CreateFileA( file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                               OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr ) );
+   if( handle == INVALID_HANDLE_VALUE ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   LARGE_INTEGER size;
+   if( !GetFileSizeEx( handle, &size ) || size.QuadPart == 0 ) {
+      CloseHandle( handle );
+      BLAZE_THROW_RUNTIME_ERROR( "Empty or invalid file detected" );
+   }
+
+   HANDLE mapping( CreateFileMappingA( handle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr ) );
+   CloseHandle( handle );
+
+   if( mapping == nullptr ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+   }
+
+   void* address( MapViewOfFile( mapping, FILE_MAP_COPY, 0, 0, 0 ) );
+   CloseHandle( mapping );
+
+   if( address == nullptr ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+   }
+
+   size_ = static_cast<size_t>( size.QuadPart );
+#else
+   const int fd( ::open( file.c_str(), O_RDONLY ) );
+   if( fd == -1 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   struct stat info;
+   if( ::fstat( fd, &info ) != 0 || info.st_size == 0 ) {
+      ::close( fd );
+      BLAZE_THROW_RUNTIME_ERROR( "Empty or invalid file detected" );
+   }
+
+   void* address( ::mmap( nullptr, static_cast<size_t>( info.st_size ),
+                          PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 ) );
+   ::close( fd );
+
+   if( address == MAP_FAILED ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+   }
+
+   size_ = static_cast<size_t>( info.st_size );
+#endif
+
+   data_ = static_cast<byte_t*>( address );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Releases the memory mapping.
+*/
+inline MemoryMap::~MemoryMap()
+{
+#if defined(_MSC_VER)
+   UnmapViewOfFile( data_ );
+#else
+   ::munmap( data_, size_ );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the mapped file.
+//
+// \return Pointer to the first byte of the mapped file.
+//
+// Note that write accesses via the returned pointer are private to the calling process and
+// never modify the underlying file.
+*/
+inline byte_t* MemoryMap::data() noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the mapped file.
+//
+// \return Pointer to the first byte of the mapped file.
+*/
+inline const byte_t* MemoryMap::data() const noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the mapped file.
+//
+// \return The size of the mapped file in bytes.
+*/
+inline size_t MemoryMap::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
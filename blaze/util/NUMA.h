@@ -0,0 +1,415 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/NUMA.h
+//  \brief Header file for the thread affinity and NUMA memory placement functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_NUMA_H_
+#define _BLAZE_UTIL_NUMA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <sched.h>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blaze/util/Exception.h>
+#include <blaze/util/NumaPolicy.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NUMA FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name NUMA functions */
+//@{
+std::vector<size_t> parseCPUList( const std::string& list );
+const std::vector<size_t>& threadCPUs() noexcept;
+bool pinThread( size_t index ) noexcept;
+size_t numaNodes() noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parses a list of CPU (or memory node) indices.
+// \ingroup util
+//
+// \param list The list of indices (as for instance "0,2,4-7").
+// \return The parsed indices in the given order.
+// \exception std::invalid_argument Invalid CPU list.
+//
+// This function parses a comma separated list of indices and index ranges, as used by the
+// \c BLAZE_THREAD_AFFINITY environment variable and the Linux sysfs interface. In case the
+// list is malformed, a \a std::invalid_argument exception is thrown.
+*/
+inline std::vector<size_t> parseCPUList( const std::string& list )
+{
+   std::vector<size_t> cpus;
+
+   size_t pos( 0UL );
+
+   const auto parseIndex = [&list,&pos]()
+   {
+      if( pos >= list.size() || !std::isdigit( static_cast<unsigned char>( list[pos] ) ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid CPU list" );
+      }
+
+      size_t index( 0UL );
+      while( pos < list.size() && std::isdigit( static_cast<unsigned char>( list[pos] ) ) ) {
+         index = index*10UL + static_cast<size_t>( list[pos] - '0' );
+         ++pos;
+      }
+      return index;
+   };
+
+   while( pos < list.size() && !std::isspace( static_cast<unsigned char>( list[pos] ) ) )
+   {
+      const size_t first( parseIndex() );
+      size_t last( first );
+
+      if( pos < list.size() && list[pos] == '-' ) {
+         ++pos;
+         last = parseIndex();
+      }
+
+      if( last < first || last - first > 65536UL ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid CPU range" );
+      }
+
+      for( size_t cpu=first; cpu<=last; ++cpu ) {
+         cpus.push_back( cpu );
+      }
+
+      if( pos < list.size() && list[pos] == ',' ) {
+         ++pos;
+         if( pos == list.size() ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid CPU list" );
+         }
+      }
+   }
+
+   for( ; pos<list.size(); ++pos ) {
+      if( !std::isspace( static_cast<unsigned char>( list[pos] ) ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid CPU list" );
+      }
+   }
+
+   if( cpus.empty() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Empty CPU list" );
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads a list of indices from the given sysfs file.
+// \ingroup util
+//
+// \param file The sysfs file (as for instance "/sys/devices/system/node/online").
+// \return The indices listed in the file, an empty list in case the file cannot be read.
+*/
+inline std::vector<size_t> readCPUList( const std::string& file ) noexcept
+{
+   try {
+      std::ifstream in( file.c_str() );
+      std::string list;
+
+      if( !std::getline( in, list ) )
+         return std::vector<size_t>();
+
+      return parseCPUList( list );
+   }
+   catch( ... ) {
+      return std::vector<size_t>();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Orders the CPUs available to the process according to the given affinity policy.
+// \ingroup util
+//
+// \param scatter \a true for the \c scatter policy, \a false for the \c compact policy.
+// \return The ordered list of CPUs, an empty list in case the CPU topology is not available.
+//
+// This function groups the CPUs available to the process by their NUMA node (or by their
+// socket in case the node information is not available). Within each group, the CPUs are
+// ordered such that all physical cores are used before their hardware threads. The \c compact
+// policy fills one group after the other, the \c scatter policy distributes consecutive threads
+// round-robin across all groups.
+*/
+inline std::vector<size_t> orderCPUs( bool scatter ) noexcept
+{
+#if defined(__linux__)
+   try {
+      cpu_set_t mask;
+      CPU_ZERO( &mask );
+      if( sched_getaffinity( 0, sizeof(cpu_set_t), &mask ) != 0 )
+         return std::vector<size_t>();
+
+      struct CPU {
+         size_t id;     // Index of the CPU
+         size_t group;  // Index of the NUMA node or socket
+         size_t core;   // Index of the physical core within the socket
+         size_t rank;   // Index of the hardware thread within the physical core
+      };
+
+      std::vector< std::pair< size_t, std::vector<size_t> > > nodes;
+      for( size_t node : readCPUList( "/sys/devices/system/node/online" ) ) {
+         nodes.emplace_back( node, readCPUList( "/sys/devices/system/node/node" + std::to_string( node ) + "/cpulist" ) );
+      }
+
+      std::vector<CPU> cpus;
+
+      for( size_t id=0UL; id<CPU_SETSIZE; ++id )
+      {
+         if( !CPU_ISSET( id, &mask ) )
+            continue;
+
+         const std::string dir( "/sys/devices/system/cpu/cpu" + std::to_string( id ) + "/topology/" );
+
+         CPU cpu = { id, 0UL, id, 0UL };
+
+         std::ifstream package( ( dir + "physical_package_id" ).c_str() );
+         std::ifstream core   ( ( dir + "core_id" ).c_str() );
+         package >> cpu.group;
+         core    >> cpu.core;
+
+         for( const auto& node : nodes ) {
+            if( std::find( node.second.begin(), node.second.end(), id ) != node.second.end() ) {
+               cpu.group = node.first;
+               break;
+            }
+         }
+
+         for( const CPU& other : cpus ) {
+            if( other.group == cpu.group && other.core == cpu.core )
+               ++cpu.rank;
+         }
+
+         cpus.push_back( cpu );
+      }
+
+      std::stable_sort( cpus.begin(), cpus.end(), []( const CPU& a, const CPU& b ) {
+         return ( a.group != b.group )?( a.group < b.group ):( a.rank < b.rank );
+      } );
+
+      std::vector<size_t> order;
+      order.reserve( cpus.size() );
+
+      if( !scatter ) {
+         for( const CPU& cpu : cpus )
+            order.push_back( cpu.id );
+         return order;
+      }
+
+      std::vector< std::vector<size_t> > groups;
+      for( size_t i=0UL; i<cpus.size(); ++i ) {
+         if( i == 0UL || cpus[i].group != cpus[i-1UL].group )
+            groups.emplace_back();
+         groups.back().push_back( cpus[i].id );
+      }
+
+      for( size_t i=0UL; order.size()<cpus.size(); ++i ) {
+         for( const std::vector<size_t>& group : groups ) {
+            if( i < group.size() )
+               order.push_back( group[i] );
+         }
+      }
+
+      return order;
+   }
+   catch( ... ) {
+      return std::vector<size_t>();
+   }
+#else
+   UNUSED_PARAMETER( scatter );
+   return std::vector<size_t>();
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the CPUs of the pool threads based on the \c BLAZE_THREAD_AFFINITY variable.
+// \ingroup util
+//
+// \return The list of CPUs, an empty list in case the pool threads are not pinned.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+inline std::vector<size_t> initThreadCPUs() noexcept
+{
+   const char* env = std::getenv( "BLAZE_THREAD_AFFINITY" );
+
+   if( env == nullptr || std::strcmp( env, "none" ) == 0 )
+      return std::vector<size_t>();
+   else if( std::strcmp( env, "compact" ) == 0 )
+      return orderCPUs( false );
+   else if( std::strcmp( env, "scatter" ) == 0 )
+      return orderCPUs( true );
+
+   try {
+      return parseCPUList( env );
+   }
+   catch( ... ) {
+      return std::vector<size_t>();
+   }
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the CPUs the threads of the Blaze thread pools are pinned to.
+// \ingroup util
+//
+// \return The list of CPUs, an empty list in case the threads are not pinned.
+//
+// The affinity of the threads of the Blaze thread pools is specified via the
+// \c BLAZE_THREAD_AFFINITY environment variable, which is evaluated on the first call:
+//
+//  - \c compact: Consecutive threads are placed on the same NUMA node (or socket) until all
+//    physical cores of the node are used, then on the next node.
+//  - \c scatter: Consecutive threads are distributed round-robin across all NUMA nodes.
+//  - An explicit list of CPUs (as for instance "0,2,4-7"): The i-th thread is pinned to the
+//    i-th CPU of the list.
+//  - \c none (the default): The threads are not pinned.
+//
+// Invalid settings are ignored. In case the list contains less CPUs than there are threads,
+// the CPUs are reused cyclically.
+*/
+inline const std::vector<size_t>& threadCPUs() noexcept
+{
+   static const std::vector<size_t> cpus( initThreadCPUs() );
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pins the calling thread according to the thread affinity policy.
+// \ingroup util
+//
+// \param index The index of the calling thread within its thread pool.
+// \return \a true in case the thread has been pinned, \a false if not.
+//
+// This function pins the calling thread to the CPU assigned to the given thread index by the
+// \c BLAZE_THREAD_AFFINITY environment variable (see threadCPUs()). It is called by every
+// thread of the Blaze thread pools on start-up. Pinning is only supported on Linux; on all
+// other platforms the function returns \a false.
+*/
+inline bool pinThread( size_t index ) noexcept
+{
+#if defined(__linux__)
+   const std::vector<size_t>& cpus( threadCPUs() );
+
+   if( cpus.empty() || cpus[index % cpus.size()] >= CPU_SETSIZE )
+      return false;
+
+   cpu_set_t mask;
+   CPU_ZERO( &mask );
+   CPU_SET( cpus[index % cpus.size()], &mask );
+
+   return sched_setaffinity( 0, sizeof(cpu_set_t), &mask ) == 0;
+#else
+   UNUSED_PARAMETER( index );
+   return false;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the list of memory nodes of the system.
+// \ingroup util
+//
+// \return The indices of all nodes with memory, an empty list in case they cannot be determined.
+*/
+inline const std::vector<size_t>& memoryNodes() noexcept
+{
+   static const std::vector<size_t> nodes( readCPUList( "/sys/devices/system/node/has_memory" ) );
+   return nodes;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of memory nodes of the system.
+// \ingroup util
+//
+// \return The number of NUMA nodes with memory (1 in case the topology cannot be determined).
+*/
+inline size_t numaNodes() noexcept
+{
+   return std::max<size_t>( memoryNodes().size(), 1UL );
+}
+//*************************************************************************************************
+
+
+} // namespace blaze
+
+#endif
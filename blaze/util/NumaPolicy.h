@@ -0,0 +1,241 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/NumaPolicy.h
+//  \brief Header file for the NUMA memory placement policy
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_NUMAPOLICY_H_
+#define _BLAZE_UTIL_NUMAPOLICY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <unistd.h>
+#  include <sys/syscall.h>
+#endif
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NUMA POLICIES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Placement policies for the memory of large dense vectors and matrices.
+// \ingroup util
+//
+// The NumaPolicy enumeration lists the strategies to place the memory of large dense vectors
+// and matrices on the memory nodes of a NUMA system:
+//
+//  - \a none: The memory is placed by the operating system, which usually puts every page on
+//    the node of the thread that first writes to it. Since dense vectors and matrices are
+//    initialized by the constructing thread, all memory usually ends up on a single node.
+//  - \a firstTouch: The elements of large dense vectors and matrices are initialized in
+//    parallel by the threads of the shared memory parallelization, using the same partitioning
+//    as the SMP assignments. Thus the memory is distributed across the nodes of all threads.
+//  - \a interleave: The pages of large allocations are interleaved round-robin across all
+//    memory nodes (Linux only).
+*/
+enum class NumaPolicy : int
+{
+   none       = 0,  //!< Placement by the operating system.
+   firstTouch = 1,  //!< Parallel first-touch initialization.
+   interleave = 2   //!< Interleaved placement across all memory nodes.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMA POLICY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name NUMA policy functions */
+//@{
+NumaPolicy numaPolicy() noexcept;
+void setNumaPolicy( NumaPolicy policy ) noexcept;
+void interleave( void* address, size_t size ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the initial NUMA policy based on the \c BLAZE_NUMA_POLICY variable.
+// \ingroup util
+//
+// \return The initial NUMA policy.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+inline NumaPolicy initNumaPolicy() noexcept
+{
+   const char* env = std::getenv( "BLAZE_NUMA_POLICY" );
+
+   if( env != nullptr && std::strcmp( env, "first-touch" ) == 0 )
+      return NumaPolicy::firstTouch;
+   else if( env != nullptr && std::strcmp( env, "interleave" ) == 0 )
+      return NumaPolicy::interleave;
+   else return NumaPolicy::none;
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the storage of the active NUMA policy.
+// \ingroup util
+//
+// \return Reference to the active NUMA policy.
+*/
+inline std::atomic<NumaPolicy>& numaPolicyStorage() noexcept
+{
+   static std::atomic<NumaPolicy> policy( initNumaPolicy() );
+   return policy;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the active NUMA policy.
+// \ingroup util
+//
+// \return The active placement policy for the memory of large dense vectors and matrices.
+//
+// The initial NUMA policy is specified via the \c BLAZE_NUMA_POLICY environment variable,
+// which can be set to \c first-touch, \c interleave, or \c none (the default). The policy can
+// be changed at runtime via the setNumaPolicy() function.
+*/
+inline NumaPolicy numaPolicy() noexcept
+{
+   return numaPolicyStorage().load( std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changes the active NUMA policy.
+// \ingroup util
+//
+// \param policy The new placement policy for the memory of large dense vectors and matrices.
+// \return void
+//
+// The new policy only affects dense vectors and matrices that are allocated after the call.
+*/
+inline void setNumaPolicy( NumaPolicy policy ) noexcept
+{
+   numaPolicyStorage().store( policy, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Interleaves the pages of the given memory range across all memory nodes.
+// \ingroup util
+//
+// \param address The address of the memory range.
+// \param size The size of the memory range in Byte.
+// \return void
+//
+// This function requests the round-robin placement of all complete pages of the given memory
+// range across all memory nodes the calling thread is allowed to use. The placement only affects
+// pages that have not been touched yet. The memory nodes are queried from the kernel via the
+// \c get_mempolicy system call, i.e. the function neither allocates memory nor reads the sysfs
+// interface. On systems with a single memory node and on all platforms except Linux the function
+// has no effect.
+*/
+inline void interleave( void* address, size_t size ) noexcept
+{
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_get_mempolicy)
+   const size_t bits ( 8UL*sizeof(unsigned long) );
+   const size_t words( 16UL );  // Support for up to 1024 memory nodes
+
+   unsigned long nodemask[words] = {};
+
+   const int mempolicyMemsAllowed( 4 );  // MPOL_F_MEMS_ALLOWED
+
+   if( syscall( SYS_get_mempolicy, nullptr, nodemask, words*bits, nullptr, mempolicyMemsAllowed ) != 0 )
+      return;
+
+   size_t nodes( 0UL );
+   for( size_t i=0UL; i<words; ++i ) {
+      for( unsigned long mask=nodemask[i]; mask != 0UL; mask &= mask - 1UL ) {
+         ++nodes;
+      }
+   }
+
+   if( nodes < 2UL )
+      return;
+
+   const size_t page ( static_cast<size_t>( sysconf( _SC_PAGESIZE ) ) );
+   const size_t first( ( reinterpret_cast<size_t>( address ) + page - 1UL ) / page * page );
+   const size_t last ( ( reinterpret_cast<size_t>( address ) + size ) / page * page );
+
+   if( first >= last )
+      return;
+
+   const int interleavePolicy( 3 );  // MPOL_INTERLEAVE
+
+   syscall( SYS_mbind, reinterpret_cast<void*>( first ), last - first, interleavePolicy,
+            nodemask, words*bits + 1UL, 0U );
+#else
+   UNUSED_PARAMETER( address, size );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -44,6 +44,8 @@
 #include <memory>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NonCopyable.h>
+#include <blaze/util/NUMA.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -259,7 +261,7 @@ class Thread : private NonCopyable
    //**Constructors********************************************************************************
    /*!\name Constructors */
    //@{
-   explicit Thread( ThreadPoolType* pool );
+   explicit Thread( ThreadPoolType* pool, size_t index );
    //@}
    //**********************************************************************************************
 
@@ -310,6 +312,7 @@ class Thread : private NonCopyable
                                       pool to learn whether the thread has terminated
                                       its execution. */
    ThreadPoolType* pool_;        //!< Handle to the managing thread pool.
+   size_t          index_;       //!< Index of the thread within the managing thread pool.
    ThreadHandle    thread_;      //!< Handle to the thread of execution.
    //@}
    //**********************************************************************************************
@@ -335,17 +338,20 @@ class Thread : private NonCopyable
 /*!\brief Starting a thread in a thread pool.
 //
 // \param pool Handle to the managing thread pool.
+// \param index Index of the thread within the managing thread pool.
 //
 // This function creates a new thread in the given thread pool. The thread is kept alive until
-// explicitly killed by the managing thread pool.
+// explicitly killed by the managing thread pool. The index of the thread determines the CPU
+// the thread is pinned to (see pinThread()).
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-Thread<TT,MT,LT,CT>::Thread( ThreadPoolType* pool )
+Thread<TT,MT,LT,CT>::Thread( ThreadPoolType* pool, size_t index )
    : terminated_( false   )  // Thread termination flag
    , pool_      ( pool    )  // Handle to the managing thread pool
+   , index_     ( index   )  // Index of the thread within the managing thread pool
    , thread_    ( nullptr )  // Handle to the thread of execution
 {
    thread_.reset( new ThreadType( std::bind( &Thread::run, this ) ) );
@@ -370,6 +376,7 @@ template< typename Callable   // Type of the function/functor
         , typename... Args >  // Types of the function/functor arguments
 inline Thread<TT,MT,LT,CT>::Thread( Callable func, Args&&... args )
    : pool_  ( nullptr )  // Handle to the managing thread pool
+   , index_ ( 0UL     )  // Index of the thread within the managing thread pool
    , thread_( nullptr )  // Handle to the thread of execution
 {
    thread_.reset( new ThreadType( func, std::forward<Args>( args )... ) );
@@ -485,6 +492,9 @@ void Thread<TT,MT,LT,CT>::run()
    // Checking the thread pool handle
    BLAZE_INTERNAL_ASSERT( pool_, "Uninitialized pool handle detected" );
 
+   // Pinning the thread according to the thread affinity policy
+   pinThread( index_ );
+
    // Executing scheduled tasks
    while( pool_->executeTask() ) {}
 
@@ -0,0 +1,770 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/WorkStealingPool.h
+//  \brief Header file of the work stealing thread pool implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_WORKSTEALINGPOOL_H_
+#define _BLAZE_UTIL_WORKSTEALINGPOOL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/NUMA.h>
+#include <blaze/util/threadpool/TaskSlot.h>
+#include <blaze/util/threadpool/WorkStealingDeque.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of a work stealing thread pool.
+// \ingroup threads
+//
+// \section workstealingpool_general General
+//
+// The WorkStealingPool class template represents an alternative to the ThreadPool class template
+// that is optimized for the fork/join pattern of the Blaze shared memory parallelization, i.e.
+// for the frequent scheduling of a small number of tasks followed by a call to wait(). It offers
+// the same interface as the ThreadPool class template:
+
+   \code
+   typedef blaze::WorkStealingPool< std::thread
+                                  , std::mutex
+                                  , std::unique_lock<std::mutex>
+                                  , std::condition_variable >  StdWorkStealingPool;
+
+   StdWorkStealingPool threadpool( 4 );
+
+   // Scheduling two concurrent tasks
+   threadpool.schedule( function0 );
+   threadpool.schedule( Functor2(), 4, 6 );
+
+   // Waiting for the thread pool to complete both tasks
+   threadpool.wait();
+   \endcode
+
+// In contrast to the ThreadPool, which manages all tasks in a single, mutex protected FIFO
+// queue of std::function objects, the WorkStealingPool
+//
+//  - manages the tasks in per-thread, lock-free Chase-Lev deques (see WorkStealingDeque): tasks
+//    scheduled by any thread outside the pool are pushed to a shared deque, tasks scheduled by
+//    a thread of the pool are pushed to its own deque. Idle threads steal tasks from the top
+//    of all deques;
+//  - stores all tasks in place (see TaskSlot), i.e. scheduling a task does not require dynamic
+//    memory allocation;
+//  - lets idle threads spin for a short period of time before they are parked on a condition
+//    variable, which avoids the wake-up latency for tasks scheduled in quick succession;
+//  - lets the thread calling wait() help executing the scheduled tasks.
+//
+// In case a deque is full, the task is executed directly by the scheduling thread.
+//
+// \section workstealingpool_limitations Limitations
+//
+// The wait() function must not be called from within a task of the same thread pool. Also,
+// resize() first waits for all scheduled tasks to complete and always blocks until the new
+// number of threads is available. In case a task throws an exception, std::terminate() is
+// called. This applies to all tasks, i.e. also to tasks executed by the thread calling wait()
+// and to tasks executed directly by the scheduling thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+class WorkStealingPool : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef threadpool::TaskSlot           TaskSlot;  //!< Type of a single task.
+   typedef threadpool::WorkStealingDeque  Deque;     //!< Type of the task deques.
+   typedef std::unique_ptr<TT>            Thread;    //!< Type of the managed threads.
+   typedef MT                             Mutex;     //!< Type of the mutex.
+   typedef LT                             Lock;      //!< Type of a locking object.
+   typedef CT                             Condition; //!< Condition variable type.
+   //**********************************************************************************************
+
+   //**Context**************************************************************************************
+   /*!\brief Association of a thread with a thread pool and its deque.
+   */
+   struct Context {
+      const void* pool;  //!< The thread pool the thread belongs to.
+      size_t index;      //!< The index of the thread's deque.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum : size_t { spinCount = 64UL };  //!< Number of failed task searches before parking.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit WorkStealingPool( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~WorkStealingPool();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool   isEmpty() const;
+   inline size_t size()    const;
+   //@}
+   //**********************************************************************************************
+
+   //**Task scheduling*****************************************************************************
+   /*!\name Task scheduling */
+   //@{
+   template< typename Callable, typename... Args >
+   void schedule( Callable func, Args&&... args );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void resize( size_t n );
+   void wait();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Thread functions****************************************************************************
+   /*!\name Thread functions */
+   //@{
+   void      start        ( size_t n );
+   void      stop         ();
+   void      createDeques ( size_t n );
+   void      destroyDeques() noexcept;
+   void      work         ( size_t index );
+   TaskSlot* findTask     ( size_t index );
+   bool      hasTask      () const;
+   void      execute      ( TaskSlot* task ) noexcept;
+   void      complete     ();
+   size_t    current      () const noexcept;
+
+   static inline Context& context() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;                   //!< Total number of threads in the thread pool.
+   Deque* deques_;                 //!< The task deques.
+                                   /*!< The first deque is shared by all threads outside the
+                                        pool, the i-th deque belongs to the i-th thread. */
+   size_t numDeques_;              //!< The number of task deques.
+   std::vector<Thread> threads_;   //!< The threads contained in the thread pool.
+   std::atomic<size_t> pending_;   //!< Number of scheduled, not yet completed tasks.
+   std::atomic<size_t> sleeping_;  //!< Number of parked threads.
+   std::atomic<bool> stop_;        //!< Termination flag for the threads of the pool.
+   Mutex submitMutex_;             //!< Synchronization mutex for the shared deque.
+   mutable Mutex mutex_;           //!< Synchronization mutex for parking threads.
+   Condition waitForTask_;         //!< Wait condition for idle threads.
+   Condition waitForCompletion_;   //!< Wait condition for the completion of all tasks.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the WorkStealingPool class.
+//
+// \param n Initial number of threads \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid number of threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+WorkStealingPool<TT,MT,LT,CT>::WorkStealingPool( size_t n )
+   : size_             ( 0UL )      // Total number of threads in the thread pool
+   , deques_           ( nullptr )  // The task deques
+   , numDeques_        ( 0UL )      // The number of task deques
+   , threads_          ()           // The threads contained in the thread pool
+   , pending_          ( 0UL )      // Number of scheduled, not yet completed tasks
+   , sleeping_         ( 0UL )      // Number of parked threads
+   , stop_             ( false )    // Termination flag for the threads of the pool
+   , submitMutex_      ()           // Synchronization mutex for the shared deque
+   , mutex_            ()           // Synchronization mutex for parking threads
+   , waitForTask_      ()           // Wait condition for idle threads
+   , waitForCompletion_()           // Wait condition for the completion of all tasks
+{
+   resize( n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the WorkStealingPool class.
+//
+// The destructor completes all scheduled tasks, terminates all threads of the pool and releases
+// all acquired resources.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+WorkStealingPool<TT,MT,LT,CT>::~WorkStealingPool()
+{
+   wait();
+   stop();
+   destroyDeques();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether any tasks are scheduled for execution.
+//
+// \return \a true in case task are scheduled, \a false otherwise.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool WorkStealingPool<TT,MT,LT,CT>::isEmpty() const
+{
+   return !hasTask();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current size of the thread pool.
+//
+// \return The total number of threads in the thread pool.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t WorkStealingPool<TT,MT,LT,CT>::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TASK SCHEDULING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor for execution.
+//
+// \param func The given function/functor.
+// \param args The arguments for the function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable with the given arguments and must not return any value.
+// The function/functor and the arguments are stored in place, i.e. no dynamic memory allocation
+// takes place unless they exceed the size of a task slot.
+*/
+template< typename TT         // Type of the encapsulated thread
+        , typename MT         // Type of the synchronization mutex
+        , typename LT         // Type of the mutex lock
+        , typename CT >       // Type of the condition variable
+template< typename Callable   // Type of the function/functor
+        , typename... Args >  // Types of the function/functor arguments
+void WorkStealingPool<TT,MT,LT,CT>::schedule( Callable func, Args&&... args )
+{
+   auto task( std::bind<void>( func, std::forward<Args>( args )... ) );
+
+   const size_t index( current() );
+   bool pushed( false );
+
+   pending_.fetch_add( 1UL, std::memory_order_relaxed );
+
+   if( index != 0UL ) {
+      pushed = deques_[index].push( std::move( task ) );
+   }
+   else {
+      Lock lock( submitMutex_ );
+      pushed = deques_[0].push( std::move( task ) );
+   }
+
+   // Executing the task directly in case the deque is full
+   if( !pushed ) {
+      TaskSlot slot;
+      slot.assign( std::move( task ) );
+      execute( &slot );
+      return;
+   }
+
+   // Waking up a parked thread (see the according check in the work() function)
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+   if( sleeping_.load( std::memory_order_relaxed ) > 0UL ) {
+      Lock lock( mutex_ );
+      waitForTask_.notify_one();
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Changes the total number of threads in the thread pool.
+//
+// \param n The new number of threads \f$[1..\infty)\f$.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This function changes the size of the thread pool. Before the number of threads is adapted,
+// all scheduled tasks are completed. The function blocks until the new number of threads is
+// available. In case an invalid number of threads is specified, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::resize( size_t n )
+{
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+
+   if( n == size_ )
+      return;
+
+   if( deques_ != nullptr ) {
+      wait();
+      stop();
+      destroyDeques();
+   }
+
+   start( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for all scheduled tasks to be completed.
+//
+// \return void
+//
+// This function blocks until all scheduled tasks have been completed. While waiting, the calling
+// thread participates in the execution of the scheduled tasks.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::wait()
+{
+   const size_t index( current() );
+   size_t idle( 0UL );
+
+   while( pending_.load( std::memory_order_acquire ) != 0UL )
+   {
+      if( TaskSlot* task = findTask( index ) ) {
+         execute( task );
+         idle = 0UL;
+      }
+      else if( ++idle < spinCount ) {
+         std::this_thread::yield();
+      }
+      else {
+         Lock lock( mutex_ );
+         while( pending_.load( std::memory_order_acquire ) != 0UL ) {
+            waitForCompletion_.wait( lock );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates the task deques and starts the given number of threads.
+//
+// \param n The number of threads.
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::start( size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( deques_ == nullptr, "Active task deques detected" );
+   BLAZE_INTERNAL_ASSERT( threads_.empty(), "Active threads detected" );
+
+   createDeques( n+1UL );
+   size_ = n;
+   stop_.store( false );
+
+   threads_.reserve( n );
+   for( size_t i=1UL; i<=n; ++i ) {
+      threads_.emplace_back( new TT( [this,i]() { work( i ); } ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Terminates and joins all threads of the pool.
+//
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::stop()
+{
+   stop_.store( true );
+
+   {
+      Lock lock( mutex_ );
+      waitForTask_.notify_all();
+   }
+
+   for( Thread& thread : threads_ ) {
+      thread->join();
+   }
+
+   threads_.clear();
+   size_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the given number of task deques.
+//
+// \param n The number of task deques.
+// \return void
+// \exception std::bad_alloc Allocation failed.
+//
+// The deques are placed in memory aligned to the cache line alignment of the Deque type, such
+// that the owner end and the steal end of every deque reside on separate cache lines.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::createDeques( size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( deques_ == nullptr, "Active task deques detected" );
+
+   deques_ = reinterpret_cast<Deque*>( allocate_backend( n*sizeof(Deque), alignof(Deque) ) );
+   numDeques_ = n;
+
+   for( size_t i=0UL; i<n; ++i ) {
+      ::new ( deques_+i ) Deque();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destroys all task deques.
+//
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::destroyDeques() noexcept
+{
+   if( deques_ == nullptr )
+      return;
+
+   for( size_t i=numDeques_; i!=0UL; --i ) {
+      deques_[i-1UL].~Deque();
+   }
+
+   deallocate_backend( deques_ );
+   deques_    = nullptr;
+   numDeques_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The main loop of a thread of the pool.
+//
+// \param index The index of the thread's deque \f$[1..size]\f$.
+// \return void
+//
+// Each thread executes the tasks of its own deque and steals tasks from all other deques. In
+// case no task can be found, the thread spins for a short time before it is parked. The check
+// for available tasks before parking and the check for parked threads after pushing a task
+// (see schedule()) are both preceded by a sequentially consistent operation, which guarantees
+// that no wake-up is lost.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::work( size_t index )
+{
+   context().pool  = this;
+   context().index = index;
+
+   pinThread( index-1UL );
+
+   size_t idle( 0UL );
+
+   while( true )
+   {
+      if( TaskSlot* task = findTask( index ) ) {
+         execute( task );
+         idle = 0UL;
+         continue;
+      }
+
+      if( stop_.load( std::memory_order_acquire ) )
+         break;
+
+      if( ++idle < spinCount ) {
+         std::this_thread::yield();
+         continue;
+      }
+
+      Lock lock( mutex_ );
+      sleeping_.fetch_add( 1UL, std::memory_order_seq_cst );
+      if( !stop_.load() && !hasTask() ) {
+         waitForTask_.wait( lock );
+      }
+      sleeping_.fetch_sub( 1UL, std::memory_order_relaxed );
+      idle = 0UL;
+   }
+
+   context().pool = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searching for a task to execute.
+//
+// \param index The index of the deque of the calling thread (0 for threads outside the pool).
+// \return The found task or \a nullptr in case no task was found.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+typename WorkStealingPool<TT,MT,LT,CT>::TaskSlot*
+   WorkStealingPool<TT,MT,LT,CT>::findTask( size_t index )
+{
+   TaskSlot* task( nullptr );
+
+   if( index != 0UL ) {
+      task = deques_[index].pop();
+   }
+   else {
+      Lock lock( submitMutex_ );
+      task = deques_[0].pop();
+   }
+
+   for( size_t i=1UL; task == nullptr && i<=size_; ++i ) {
+      task = deques_[( index + i ) % ( size_ + 1UL )].steal();
+   }
+
+   return task;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether any of the deques contains a task.
+//
+// \return \a true in case a task is available, \a false if not.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+bool WorkStealingPool<TT,MT,LT,CT>::hasTask() const
+{
+   for( size_t i=0UL; i<=size_; ++i ) {
+      if( !deques_[i].isEmpty() )
+         return true;
+   }
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes the given task and marks it as completed.
+//
+// \param task The task to be executed.
+// \return void
+//
+// In case the task throws an exception, std::terminate() is called. Otherwise the exception
+// would skip the completion of the task and all subsequent calls to wait() would block forever.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::execute( TaskSlot* task ) noexcept
+{
+   task->run();
+   complete();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Marks a single task as completed and wakes up waiting threads if necessary.
+//
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::complete()
+{
+   if( pending_.fetch_sub( 1UL, std::memory_order_acq_rel ) == 1UL ) {
+      Lock lock( mutex_ );
+      waitForCompletion_.notify_all();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the deque index of the calling thread.
+//
+// \return The index of the calling thread's deque (0 for threads outside the pool).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+size_t WorkStealingPool<TT,MT,LT,CT>::current() const noexcept
+{
+   const Context& ctx( context() );
+   return ( ctx.pool == this )?( ctx.index ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the thread pool context of the calling thread.
+//
+// \return Reference to the thread local context of the calling thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename WorkStealingPool<TT,MT,LT,CT>::Context&
+   WorkStealingPool<TT,MT,LT,CT>::context() noexcept
+{
+   static thread_local Context ctx = { nullptr, 0UL };
+   return ctx;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -183,6 +183,8 @@ class Archive : private NonCopyable
 
    template< typename Type >
    inline EnableIf_< IsNumeric<Type>, Archive& > read ( Type* array, size_t count );
+
+   inline Archive& ignore( size_t count );
    //@}
    //**********************************************************************************************
 
@@ -419,6 +421,23 @@ inline EnableIf_< IsNumeric<Type>, Archive<Stream>& >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Skipping a number of bytes in the stream.
+//
+// \param count The number of bytes to be skipped.
+//
+// This function extracts and discards \a count bytes from the archive. It can for instance be
+// used to skip serialized data that is not required without allocating memory for it.
+*/
+template< typename Stream >  // Type of the bound stream
+inline Archive<Stream>& Archive<Stream>::ignore( size_t count )
+{
+   stream_.ignore( static_cast<std::streamsize>( count ) );
+   return *this;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
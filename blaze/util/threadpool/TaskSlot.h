@@ -0,0 +1,318 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/TaskSlot.h
+//  \brief Allocation-free task descriptor for the work stealing thread pool
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_TASKSLOT_H_
+#define _BLAZE_UTIL_THREADPOOL_TASKSLOT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <new>
+#include <utility>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocation-free descriptor for a single, executable task.
+// \ingroup threads
+//
+// The TaskSlot class represents a reusable storage location for a single task of the work
+// stealing thread pool. In contrast to the std::function based threadpool::Task, the given
+// function/functor is stored in place, i.e. the scheduling of a task does not require any
+// dynamic memory allocation. Only functors that exceed the size or alignment of the internal
+// buffer are stored on the heap. A task slot is marked busy from the moment a task is
+// assigned to it until the task has been executed and destroyed.
+*/
+class TaskSlot : private NonCopyable
+{
+ public:
+   //**Compilation flags***************************************************************************
+   enum : size_t { bufferSize = 192UL };  //!< Size of the internal buffer in bytes.
+   enum : size_t { alignment  =  64UL };  //!< Alignment of the internal buffer in bytes.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TaskSlot() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~TaskSlot();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isBusy() const noexcept;
+
+   template< typename Callable >
+   inline void assign( Callable&& func );
+
+   inline void run();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef void (*Invoker)( void*, bool );  //!< Type of the type-erased execution function.
+   //**********************************************************************************************
+
+   //**Storage and invocation functions************************************************************
+   /*!\name Storage and invocation functions */
+   //@{
+   template< typename Callable > inline void store( Callable&& func, TrueType  );
+   template< typename Callable > inline void store( Callable&& func, FalseType );
+
+   template< typename Callable > static void invokeInPlace( void* buffer, bool execute );
+   template< typename Callable > static void invokeOnHeap ( void* buffer, bool execute );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   alignas( alignment ) unsigned char buffer_[bufferSize];  //!< Storage for the stored functor.
+   Invoker invoker_;                                        //!< Execution function of the stored functor.
+   std::atomic<bool> busy_;                                 //!< Busy flag of the task slot.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for TaskSlot.
+*/
+inline TaskSlot::TaskSlot() noexcept
+   : invoker_( nullptr )  // Execution function of the stored functor
+   , busy_   ( false   )  // Busy flag of the task slot
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the TaskSlot class.
+//
+// In case the task slot still contains a task, the task is destroyed without being executed.
+*/
+inline TaskSlot::~TaskSlot()
+{
+   if( invoker_ != nullptr )
+      invoker_( buffer_, false );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the task slot currently contains a task.
+//
+// \return \a true in case the slot contains a task that has not yet completed, \a false if not.
+*/
+inline bool TaskSlot::isBusy() const noexcept
+{
+   return busy_.load( std::memory_order_acquire );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stores the given function/functor in the task slot.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function must only be called for a task slot that is not busy. The task slot is marked
+// busy until the function/functor has been executed via the run() function.
+*/
+template< typename Callable >  // Type of the function/functor
+inline void TaskSlot::assign( Callable&& func )
+{
+   typedef Decay_<Callable>  FunctorType;
+
+   BLAZE_INTERNAL_ASSERT( !isBusy(), "Busy task slot detected" );
+
+   store( std::forward<Callable>( func )
+        , BoolConstant< sizeof( FunctorType ) <= bufferSize && alignof( FunctorType ) <= alignment >() );
+
+   busy_.store( true, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes and destroys the stored task and releases the task slot.
+//
+// \return void
+*/
+inline void TaskSlot::run()
+{
+   BLAZE_INTERNAL_ASSERT( invoker_ != nullptr, "Empty task slot detected" );
+
+   const Invoker invoker( invoker_ );
+   invoker_ = nullptr;
+   invoker( buffer_, true );
+
+   busy_.store( false, std::memory_order_release );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STORAGE AND INVOCATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Stores the given function/functor within the internal buffer.
+//
+// \param func The given function/functor.
+// \return void
+*/
+template< typename Callable >  // Type of the function/functor
+inline void TaskSlot::store( Callable&& func, TrueType )
+{
+   typedef Decay_<Callable>  FunctorType;
+
+   ::new ( static_cast<void*>( buffer_ ) ) FunctorType( std::forward<Callable>( func ) );
+   invoker_ = &invokeInPlace<FunctorType>;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stores the given function/functor on the heap.
+//
+// \param func The given function/functor.
+// \return void
+*/
+template< typename Callable >  // Type of the function/functor
+inline void TaskSlot::store( Callable&& func, FalseType )
+{
+   typedef Decay_<Callable>  FunctorType;
+
+   ::new ( static_cast<void*>( buffer_ ) ) FunctorType*( new FunctorType( std::forward<Callable>( func ) ) );
+   invoker_ = &invokeOnHeap<FunctorType>;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes (optionally) and destroys a functor stored within the internal buffer.
+//
+// \param buffer The internal buffer of the task slot.
+// \param execute \a true if the functor has to be executed, \a false if not.
+// \return void
+*/
+template< typename Callable >  // Type of the function/functor
+void TaskSlot::invokeInPlace( void* buffer, bool execute )
+{
+   Callable* func( static_cast<Callable*>( buffer ) );
+   if( execute ) ( *func )();
+   func->~Callable();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes (optionally) and destroys a functor stored on the heap.
+//
+// \param buffer The internal buffer of the task slot.
+// \param execute \a true if the functor has to be executed, \a false if not.
+// \return void
+*/
+template< typename Callable >  // Type of the function/functor
+void TaskSlot::invokeOnHeap( void* buffer, bool execute )
+{
+   Callable* func( *static_cast<Callable**>( buffer ) );
+   if( execute ) ( *func )();
+   delete func;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,279 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/WorkStealingDeque.h
+//  \brief Chase-Lev work stealing deque for the work stealing thread pool
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_WORKSTEALINGDEQUE_H_
+#define _BLAZE_UTIL_THREADPOOL_WORKSTEALINGDEQUE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/TaskSlot.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Bounded Chase-Lev work stealing deque.
+// \ingroup threads
+//
+// The WorkStealingDeque class implements the lock-free work stealing deque by Chase and Lev
+// ("Dynamic Circular Work-Stealing Deque", SPAA 2005) in the formulation for the C++11 memory
+// model by Le et al. ("Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013).
+// The owner of the deque pushes and pops tasks at the bottom end, all other threads steal tasks
+// from the top end. In contrast to the original algorithm, the deque has a fixed capacity and
+// the elements of the deque are the task slots of a fixed ring buffer: the task at position
+// \a i is stored in slot \f$ i \bmod capacity \f$. Therefore pushing a task never allocates
+// any memory. In case the deque is full, push() returns \a false and the caller is expected
+// to execute the task directly.\n
+// The push() and pop() functions must only be called by the owner of the deque (or by threads
+// that are serialized by a mutex), whereas steal() and isEmpty() can be called by any thread.
+*/
+class WorkStealingDeque : private NonCopyable
+{
+ public:
+   //**Compilation flags***************************************************************************
+   enum : size_t { capacity = 256UL };  //!< Maximum number of tasks in the deque.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline WorkStealingDeque() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool isEmpty() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Element functions***************************************************************************
+   /*!\name Element functions */
+   //@{
+   template< typename Callable >
+   inline bool push( Callable&& func );
+
+   inline TaskSlot* pop  () noexcept;
+   inline TaskSlot* steal() noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   alignas( 64 ) std::atomic<ptrdiff_t> top_;     //!< Position of the topmost task (steal end).
+   alignas( 64 ) std::atomic<ptrdiff_t> bottom_;  //!< Position after the bottommost task (owner end).
+   TaskSlot slots_[capacity];                     //!< Ring buffer of task slots.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   static_assert( ( capacity & ( capacity - 1UL ) ) == 0UL, "Capacity must be a power of two" );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for WorkStealingDeque.
+*/
+inline WorkStealingDeque::WorkStealingDeque() noexcept
+   : top_   ( 0 )  // Position of the topmost task (steal end)
+   , bottom_( 0 )  // Position after the bottommost task (owner end)
+   , slots_ ()     // Ring buffer of task slots
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns \a true if the deque contains no tasks.
+//
+// \return \a true if the deque is empty, \a false if not.
+//
+// Note that in case of concurrent modifications the result is only a snapshot.
+*/
+inline bool WorkStealingDeque::isEmpty() const noexcept
+{
+   const ptrdiff_t t( top_.load( std::memory_order_seq_cst ) );
+   const ptrdiff_t b( bottom_.load( std::memory_order_seq_cst ) );
+   return b <= t;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ELEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a task to the bottom end of the deque.
+//
+// \param func The function/functor to be scheduled.
+// \return \a true if the task was added, \a false if the deque is full.
+//
+// This function must only be called by the owner of the deque.
+*/
+template< typename Callable >  // Type of the function/functor
+inline bool WorkStealingDeque::push( Callable&& func )
+{
+   const ptrdiff_t b( bottom_.load( std::memory_order_relaxed ) );
+   const ptrdiff_t t( top_.load( std::memory_order_acquire ) );
+
+   if( b - t >= ptrdiff_t( capacity ) )
+      return false;
+
+   TaskSlot& slot( slots_[ size_t( b ) & ( capacity - 1UL ) ] );
+
+   // The slot might still be executed by the thread that has stolen the previous task
+   if( slot.isBusy() )
+      return false;
+
+   slot.assign( std::forward<Callable>( func ) );
+   bottom_.store( b + 1, std::memory_order_release );
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing the bottommost task from the deque.
+//
+// \return The task slot of the removed task or \a nullptr in case the deque is empty.
+//
+// This function must only be called by the owner of the deque. The returned task is owned by
+// the calling thread and has to be executed via TaskSlot::run().
+*/
+inline TaskSlot* WorkStealingDeque::pop() noexcept
+{
+   const ptrdiff_t b( bottom_.load( std::memory_order_relaxed ) - 1 );
+   bottom_.store( b, std::memory_order_relaxed );
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+   ptrdiff_t t( top_.load( std::memory_order_relaxed ) );
+
+   if( t > b ) {
+      bottom_.store( b + 1, std::memory_order_release );
+      return nullptr;
+   }
+
+   TaskSlot* slot( &slots_[ size_t( b ) & ( capacity - 1UL ) ] );
+
+   if( t == b ) {
+      // Competing with the thieves for the last task in the deque
+      if( !top_.compare_exchange_strong( t, t + 1, std::memory_order_seq_cst,
+                                                   std::memory_order_relaxed ) )
+         slot = nullptr;
+      bottom_.store( b + 1, std::memory_order_release );
+   }
+
+   return slot;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stealing the topmost task from the deque.
+//
+// \return The task slot of the stolen task or \a nullptr in case no task could be stolen.
+//
+// This function can be called by any thread. The returned task is owned by the calling thread
+// and has to be executed via TaskSlot::run(). Note that the function might fail spuriously in
+// case of a concurrent access by another thread.
+*/
+inline TaskSlot* WorkStealingDeque::steal() noexcept
+{
+   ptrdiff_t t( top_.load( std::memory_order_acquire ) );
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+   const ptrdiff_t b( bottom_.load( std::memory_order_acquire ) );
+
+   if( t >= b )
+      return nullptr;
+
+   if( !top_.compare_exchange_strong( t, t + 1, std::memory_order_seq_cst,
+                                                std::memory_order_relaxed ) )
+      return nullptr;
+
+   return &slots_[ size_t( t ) & ( capacity - 1UL ) ];
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
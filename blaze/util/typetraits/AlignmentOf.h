@@ -43,6 +43,7 @@
 #include <type_traits>
 #include <blaze/system/Vectorization.h>
 #include <blaze/util/Complex.h>
+#include <blaze/util/typetraits/IsComplex.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
 
 
@@ -65,11 +66,18 @@ struct AlignmentOfHelper
  private:
    //**********************************************************************************************
    static constexpr size_t defaultAlignment = std::alignment_of<T>::value;
+   static constexpr size_t builtinSize = ( IsComplex<T>::value )?( sizeof(T) / 2UL ):( sizeof(T) );
    //**********************************************************************************************
 
  public:
    //**********************************************************************************************
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512BW_MODE
+   static constexpr size_t value = ( IsVectorizable<T>::value )?( 64UL ):( defaultAlignment );
+#elif BLAZE_AVX512F_MODE
+   static constexpr size_t value = ( IsVectorizable<T>::value )
+                                   ?( ( builtinSize >= 4UL )?( 64UL ):( 32UL ) )
+                                   :( defaultAlignment );
+#elif BLAZE_MIC_MODE
    static constexpr size_t value = ( IsVectorizable<T>::value )?( 64UL ):( defaultAlignment );
 #elif BLAZE_AVX2_MODE
    static constexpr size_t value = ( IsVectorizable<T>::value )?( 32UL ):( defaultAlignment );
@@ -94,7 +102,7 @@ struct AlignmentOfHelper<float>
 {
  public:
    //**********************************************************************************************
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    static constexpr size_t value = 64UL;
 #elif BLAZE_AVX_MODE
    static constexpr size_t value = 32UL;
@@ -119,7 +127,7 @@ struct AlignmentOfHelper<double>
 {
  public:
    //**********************************************************************************************
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    static constexpr size_t value = 64UL;
 #elif BLAZE_AVX_MODE
    static constexpr size_t value = 32UL;
@@ -144,7 +152,7 @@ struct AlignmentOfHelper< complex<float> >
 {
  public:
    //**********************************************************************************************
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    static constexpr size_t value = 64UL;
 #elif BLAZE_AVX_MODE
    static constexpr size_t value = 32UL;
@@ -169,7 +177,7 @@ struct AlignmentOfHelper< complex<double> >
 {
  public:
    //**********************************************************************************************
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    static constexpr size_t value = 64UL;
 #elif BLAZE_AVX_MODE
    static constexpr size_t value = 32UL;
@@ -195,9 +203,10 @@ struct AlignmentOfHelper< complex<double> >
 // via the nested \a value member.
 
    \code
-   AlignmentOf<unsigned int>::value  // Evaluates to 32 if AVX2 is available, to 16 if only
-                                     // SSE2 is available, and a multiple of the alignment
-                                     // chosen by the compiler otherwise.
+   AlignmentOf<unsigned int>::value  // Evaluates to 64 if AVX-512 is available, to 32 if
+                                     // AVX2 is available, to 16 if only SSE2 is available,
+                                     // and a multiple of the alignment chosen by the
+                                     // compiler otherwise.
    AlignmentOf<double>::value        // Evaluates to 32 if AVX is available, to 16 if only
                                      // SSE is available, and a multiple of the alignment
                                      // chosen by the compiler otherwise.
@@ -43,6 +43,7 @@
 #include <cstring>
 #include <sstream>
 #include <stdexcept>
+#include <blaze/util/NumaPolicy.h>
 #include <blazemark/system/Config.h>
 
 
@@ -223,9 +224,13 @@ inline Benchmarks::Benchmarks()
 //   - \a -eigen: Activates the Eigen kernels.
 //   - \a -no-eigen: Deactivates the Eigen kernels.
 //   - \a -only-eigen: Activates the Eigen kernels and deactivates all other.
+//   - \a -first-touch: Initializes large Blaze vectors and matrices in parallel (first-touch).
+//   - \a -interleave: Interleaves large Blaze vectors and matrices across all NUMA nodes.
+//   - \a -no-numa: Leaves the placement of Blaze vectors and matrices to the operating system.
 //
-// In case an unknown command line option is encountered, a \a std::invalid_argument exception
-// is thrown.
+// The NUMA options override the \c BLAZE_NUMA_POLICY environment variable. The placement of the
+// threads is controlled via the \c BLAZE_THREAD_AFFINITY environment variable. In case an unknown
+// command line option is encountered, a \a std::invalid_argument exception is thrown.
 */
 inline void parseCommandLineArguments( int argc, char** argv, Benchmarks& benchmarks )
 {
@@ -440,6 +445,15 @@ inline void parseCommandLineArguments( int argc, char** argv, Benchmarks& benchm
          benchmarks.runMTL       = false;
          benchmarks.runEigen     = true;
       }
+      else if( std::strcmp( argv[i], "-first-touch" ) == 0 ) {
+         ::blaze::setNumaPolicy( ::blaze::NumaPolicy::firstTouch );
+      }
+      else if( std::strcmp( argv[i], "-interleave" ) == 0 ) {
+         ::blaze::setNumaPolicy( ::blaze::NumaPolicy::interleave );
+      }
+      else if( std::strcmp( argv[i], "-no-numa" ) == 0 ) {
+         ::blaze::setNumaPolicy( ::blaze::NumaPolicy::none );
+      }
       else {
          std::ostringstream oss;
          oss << " Unknown command line argument: '" << argv[i] << "'";
@@ -0,0 +1,115 @@
+//=================================================================================================
+/*!
+//  \file src/classic/DMatColSum.cpp
+//  \brief Source file for the classic dense matrix column-wise sum kernel
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iostream>
+#include <blaze/util/Timing.h>
+#include <blazemark/classic/DMatColSum.h>
+#include <blazemark/classic/init/Matrix.h>
+#include <blazemark/classic/Matrix.h>
+#include <blazemark/classic/Vector.h>
+#include <blazemark/system/Config.h>
+
+
+namespace blazemark {
+
+namespace classic {
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Classic dense matrix column-wise sum kernel.
+//
+// \param N The number of rows and columns of the matrix.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function implements the dense matrix column-wise sum by means of plain loops over the
+// elements of the row-major matrix.
+*/
+double dmatcolsum( size_t N, size_t steps )
+{
+   using ::blazemark::element_t;
+
+   ::blaze::setSeed( seed );
+
+   ::blazemark::classic::Matrix<element_t,false> A( N, N );
+   ::blazemark::classic::Vector<element_t> b( N );
+   ::blaze::timing::WcTimer timer;
+
+   init( A );
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            b[j] = A(0UL,j);
+         }
+         for( size_t i=1UL; i<N; ++i ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               b[j] += A(i,j);
+            }
+         }
+      }
+      timer.end();
+
+      if( b.size() != N )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Classic kernel 'dmatcolsum': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
+} // namespace classic
+
+} // namespace blazemark
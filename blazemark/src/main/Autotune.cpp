@@ -0,0 +1,534 @@
+//=================================================================================================
+/*!
+//  \file src/main/Autotune.cpp
+//  \brief Source file for the Blaze threshold autotuning tool
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#define BLAZE_USE_RUNTIME_THRESHOLDS 1
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/SMP.h>
+#include <blaze/math/StaticMatrixBatch.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/timing/WcTimer.h>
+#include <blazemark/blaze/init/CompressedMatrix.h>
+#include <blazemark/blaze/init/DynamicMatrix.h>
+#include <blazemark/blaze/init/DynamicVector.h>
+#include <blazemark/system/Config.h>
+
+
+//=================================================================================================
+//
+//  USING DECLARATIONS
+//
+//=================================================================================================
+
+using blazemark::element_t;
+using blaze::ThresholdID;
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+typedef blaze::DynamicVector<element_t,blaze::columnVector>  DVec;   //!< Dense column vector.
+typedef blaze::DynamicVector<element_t,blaze::rowVector>     TDVec;  //!< Dense row vector.
+typedef blaze::DynamicMatrix<element_t,blaze::rowMajor>      DMat;   //!< Row-major dense matrix.
+typedef blaze::DynamicMatrix<element_t,blaze::columnMajor>   TDMat;  //!< Column-major dense matrix.
+typedef blaze::CompressedMatrix<element_t,blaze::rowMajor>   SMat;   //!< Row-major sparse matrix.
+typedef blaze::CompressedMatrix<element_t,blaze::columnMajor>  TSMat;  //!< Column-major sparse matrix.
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+const double mintime( 0.01 );  //!< Minimum runtime of a single timing measurement [s].
+const double growth ( 1.25 );  //!< Growth factor of the problem size between two measurements.
+const size_t nonzeros( 10UL );  //!< Number of non-zero elements per row/column of sparse matrices.
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Description of a single tuned threshold.
+//
+// Each tuned threshold is described by the according threshold identifier, the range of problem
+// sizes to be swept, the conversion from a problem size \a N to the unit of the threshold, and
+// a benchmark function that measures the runtime of the operation for a problem size \a N. The
+// benchmark is executed twice for each problem size: once with the threshold set to its maximum
+// (i.e. single-threaded execution or the small kernel) and once with the threshold set to zero
+// (i.e. parallel execution or the large kernel).
+*/
+struct Tuning
+{
+   ThresholdID id;                    //!< The identifier of the tuned threshold.
+   size_t first;                      //!< The smallest problem size of the sweep.
+   size_t last;                       //!< The largest problem size of the sweep.
+   bool square;                       //!< \a true if the threshold refers to N*N elements, \a false for N.
+   std::function<double(size_t)> run;  //!< Benchmark function for problem size N.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+//! Sink for the results of reduction operations.
+volatile element_t sink( 0 );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures the runtime of the given operation.
+//
+// \param op The operation to be measured.
+// \return The minimum runtime of a single execution of the operation [s].
+//
+// The number of executions per measurement is increased until a single measurement takes at
+// least \a mintime seconds. Afterwards, \a blazemark::reps measurements are performed and the
+// minimum runtime is returned.
+*/
+template< typename OP >
+double measure( OP op )
+{
+   size_t steps( 1UL );
+
+   op();
+
+   for( ;; )
+   {
+      blaze::timing::WcTimer timer;
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         op();
+      }
+      timer.end();
+
+      if( timer.last() >= mintime )
+         break;
+
+      steps *= 2UL;
+   }
+
+   blaze::timing::WcTimer timer;
+
+   for( size_t rep=0UL; rep<blazemark::reps; ++rep ) {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         op();
+      }
+      timer.end();
+   }
+
+   return timer.min() / steps;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the list of all tuned thresholds.
+//
+// \return The list of all tuned thresholds.
+*/
+std::vector<Tuning> tunings()
+{
+   using blazemark::blaze::init;
+
+   std::vector<Tuning> list;
+
+   // Kernel selection thresholds (single-threaded small vs. large kernels)
+   list.push_back( { ThresholdID::DMATDVECMULT, 16UL, 2048UL, true, []( size_t N ) {
+      DMat A( N, N ); DVec a( N ), b( N ); init( A ); init( a );
+      return measure( [&]() { b = blaze::serial( A * a ); } );
+   } } );
+   list.push_back( { ThresholdID::TDMATDVECMULT, 16UL, 2048UL, true, []( size_t N ) {
+      TDMat A( N, N ); DVec a( N ), b( N ); init( A ); init( a );
+      return measure( [&]() { b = blaze::serial( A * a ); } );
+   } } );
+   list.push_back( { ThresholdID::TDVECDMATMULT, 16UL, 2048UL, true, []( size_t N ) {
+      DMat A( N, N ); TDVec a( N ), b( N ); init( A ); init( a );
+      return measure( [&]() { b = blaze::serial( a * A ); } );
+   } } );
+   list.push_back( { ThresholdID::TDVECTDMATMULT, 16UL, 2048UL, true, []( size_t N ) {
+      TDMat A( N, N ); TDVec a( N ), b( N ); init( A ); init( a );
+      return measure( [&]() { b = blaze::serial( a * A ); } );
+   } } );
+   list.push_back( { ThresholdID::DMATDMATMULT, 8UL, 256UL, true, []( size_t N ) {
+      DMat A( N, N ), B( N, N ), C( N, N ); init( A ); init( B );
+      return measure( [&]() { C = blaze::serial( A * B ); } );
+   } } );
+   list.push_back( { ThresholdID::DMATTDMATMULT, 8UL, 256UL, true, []( size_t N ) {
+      DMat A( N, N ), C( N, N ); TDMat B( N, N ); init( A ); init( B );
+      return measure( [&]() { C = blaze::serial( A * B ); } );
+   } } );
+   list.push_back( { ThresholdID::TDMATDMATMULT, 8UL, 256UL, true, []( size_t N ) {
+      TDMat A( N, N ); DMat B( N, N ), C( N, N ); init( A ); init( B );
+      return measure( [&]() { C = blaze::serial( A * B ); } );
+   } } );
+   list.push_back( { ThresholdID::TDMATTDMATMULT, 8UL, 256UL, true, []( size_t N ) {
+      TDMat A( N, N ), B( N, N ), C( N, N ); init( A ); init( B );
+      return measure( [&]() { C = blaze::serial( A * B ); } );
+   } } );
+
+   // SMP thresholds for dense vector operations
+   list.push_back( { ThresholdID::SMP_DVECASSIGN, 1000UL, 4000000UL, false, []( size_t N ) {
+      DVec a( N ), b( N ); init( a );
+      return measure( [&]() { b = a; } );
+   } } );
+   list.push_back( { ThresholdID::SMP_DVECDVECADD, 1000UL, 4000000UL, false, []( size_t N ) {
+      DVec a( N ), b( N ), c( N ); init( a ); init( b );
+      return measure( [&]() { c = a + b; } );
+   } } );
+   list.push_back( { ThresholdID::SMP_DVECDVECSUB, 1000UL, 4000000UL, false, []( size_t N ) {
+      DVec a( N ), b( N ), c( N ); init( a ); init( b );
+      return measure( [&]() { c = a - b; } );
+   } } );
+   list.push_back( { ThresholdID::SMP_DVECDVECMULT, 1000UL, 4000000UL, false, []( size_t N ) {
+      DVec a( N ), b( N ), c( N ); init( a ); init( b );
+      return measure( [&]() { c = a * b; } );
+   } } );
+   list.push_back( { ThresholdID::SMP_DVECDVECDIV, 1000UL, 4000000UL, false, []( size_t N ) {
+      DVec a( N ), b( N ), c( N ); init( a ); init( b );
+      return measure( [&]() { c = a / b; } );
+   } } );
+   list.push_back( { ThresholdID::SMP_DVECSCALARMULT, 1000UL, 4000000UL, false, []( size_t N ) {
+      DVec a( N ), b( N ); init( a );
+      return measure( [&]() { b = a * element_t( 2 ); } );
+   } } );
+   list.push_back( { ThresholdID::SMP_DVECREDUCE, 1000UL, 4000000UL, false, []( size_t N ) {
+      DVec a( N ); init( a );
+      return measure( [&]() { sink = blaze::sum( a ); } );
+   } } );
+   list.push_back( { ThresholdID::SMP_DVECTDVECMULT, 16UL, 2048UL, true, []( size_t N ) {
+      DVec a( N ); TDVec b( N ); DMat C( N, N ); init( a ); init( b );
+      return measure( [&]() { C = a * b; } );
+   } } );
+
+   // SMP thresholds for dense matrix/dense vector multiplications
+   list.push_back( { ThresholdID::SMP_DMATDVECMULT, 16UL, 4096UL, false, []( size_t N ) {
+      DMat A( N, N ); DVec a( N ), b( N ); init( A ); init( a );
+      return measure( [&]() { b = A * a; } );
+   } } );
+   list.push_back( { ThresholdID::SMP_TDMATDVECMULT, 16UL, 4096UL, false, []( size_t N ) {
+      TDMat A( N, N ); DVec a( N ), b( N ); init( A ); init( a );
+      return measure( [&]() { b = A * a; } );
+   } } );
+   list.push_back( { ThresholdID::SMP_TDVECDMATMULT, 16UL, 4096UL, false, []( size_t N ) {
+      DMat A( N, N ); TDVec a( N ), b( N ); init( A ); init( a );
+      return measure( [&]() { b = a * A; } );
+   } } );
+   list.push_back( { ThresholdID::SMP_TDVECTDMATMULT, 16UL, 4096UL, false, []( size_t N ) {
+      TDMat A( N, N ); TDVec a( N ), b( N ); init( A ); init( a );
+      return measure( [&]() { b = a * A; } );
+   } } );
+
+   // SMP thresholds for sparse matrix/dense vector multiplications
+   list.push_back( { ThresholdID::SMP_SMATDVECMULT, 100UL, 1000000UL, false, []( size_t N ) {
+      SMat A( N, N ); DVec a( N ), b( N ); init( A, blaze::min( nonzeros, N ) ); init( a );
+      return measure( [&]() { b = A * a; } );
+   } } );
+   list.push_back( { ThresholdID::SMP_TSMATDVECMULT, 100UL, 1000000UL, false, []( size_t N ) {
+      TSMat A( N, N ); DVec a( N ), b( N ); init( A, blaze::min( nonzeros, N ) ); init( a );
+      return measure( [&]() { b = A * a; } );
+   } } );
+
+   // SMP threshold for sparse matrix Schur products (N non-zero elements, 1/8 fill rate)
+   list.push_back( { ThresholdID::SMP_SMATSMATSCHUR, 100UL, 1000000UL, false, []( size_t N ) {
+      const size_t M( static_cast<size_t>( std::sqrt( 8.0*N ) ) );
+      SMat A( M, M ), B( M, M ); DMat C( M, M ); init( A, M/8UL ); init( B, M/8UL );
+      return measure( [&]() { C = A % B; } );
+   } } );
+
+   // SMP thresholds for dense matrix operations
+   list.push_back( { ThresholdID::SMP_DMATASSIGN, 16UL, 2048UL, true, []( size_t N ) {
+      DMat A( N, N ), B( N, N ); init( A );
+      return measure( [&]() { B = A; } );
+   } } );
+   list.push_back( { ThresholdID::SMP_DMATDMATADD, 16UL, 2048UL, true, []( size_t N ) {
+      DMat A( N, N ), B( N, N ), C( N, N ); init( A ); init( B );
+      return measure( [&]() { C = A + B; } );
+   } } );
+   list.push_back( { ThresholdID::SMP_DMATTDMATADD, 16UL, 2048UL, true, []( size_t N ) {
+      DMat A( N, N ), C( N, N ); TDMat B( N, N ); init( A ); init( B );
+      return measure( [&]() { C = A + B; } );
+   } } );
+   list.push_back( { ThresholdID::SMP_DMATDMATSUB, 16UL, 2048UL, true, []( size_t N ) {
+      DMat A( N, N ), B( N, N ), C( N, N ); init( A ); init( B );
+      return measure( [&]() { C = A - B; } );
+   } } );
+   list.push_back( { ThresholdID::SMP_DMATTDMATSUB, 16UL, 2048UL, true, []( size_t N ) {
+      DMat A( N, N ), C( N, N ); TDMat B( N, N ); init( A ); init( B );
+      return measure( [&]() { C = A - B; } );
+   } } );
+   list.push_back( { ThresholdID::SMP_DMATSCALARMULT, 16UL, 2048UL, true, []( size_t N ) {
+      DMat A( N, N ), B( N, N ); init( A );
+      return measure( [&]() { B = A * element_t( 2 ); } );
+   } } );
+   list.push_back( { ThresholdID::SMP_DMATREDUCE, 16UL, 2048UL, true, []( size_t N ) {
+      DMat A( N, N ); init( A );
+      return measure( [&]() { sink = blaze::sum( A ); } );
+   } } );
+   list.push_back( { ThresholdID::SMP_DMATDMATSCHUR, 16UL, 2048UL, true, []( size_t N ) {
+      DMat A( N, N ), B( N, N ), C( N, N ); init( A ); init( B );
+      return measure( [&]() { C = A % B; } );
+   } } );
+   list.push_back( { ThresholdID::SMP_DMATTDMATSCHUR, 16UL, 2048UL, true, []( size_t N ) {
+      DMat A( N, N ), C( N, N ); TDMat B( N, N ); init( A ); init( B );
+      return measure( [&]() { C = A % B; } );
+   } } );
+
+   // SMP thresholds for dense matrix/dense matrix multiplications
+   list.push_back( { ThresholdID::SMP_DMATDMATMULT, 8UL, 512UL, true, []( size_t N ) {
+      DMat A( N, N ), B( N, N ), C( N, N ); init( A ); init( B );
+      return measure( [&]() { C = A * B; } );
+   } } );
+   list.push_back( { ThresholdID::SMP_DMATTDMATMULT, 8UL, 512UL, true, []( size_t N ) {
+      DMat A( N, N ), C( N, N ); TDMat B( N, N ); init( A ); init( B );
+      return measure( [&]() { C = A * B; } );
+   } } );
+   list.push_back( { ThresholdID::SMP_TDMATDMATMULT, 8UL, 512UL, true, []( size_t N ) {
+      TDMat A( N, N ); DMat B( N, N ), C( N, N ); init( A ); init( B );
+      return measure( [&]() { C = A * B; } );
+   } } );
+   list.push_back( { ThresholdID::SMP_TDMATTDMATMULT, 8UL, 512UL, true, []( size_t N ) {
+      TDMat A( N, N ), B( N, N ), C( N, N ); init( A ); init( B );
+      return measure( [&]() { C = A * B; } );
+   } } );
+
+   // SMP threshold for batches of small matrices
+   list.push_back( { ThresholdID::SMP_BATCH, 64UL, 262144UL, false, []( size_t N ) {
+      blaze::StaticMatrixBatch<double,3UL,3UL> A( N ), B( N ), C( N );
+      return measure( [&]() { multiply( C, A, B ); } );
+   } } );
+
+   return list;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Determines the crossover point of the given threshold.
+//
+// \param tuning The description of the tuned threshold.
+// \param value Reference to the resulting threshold value.
+// \return \a true in case a crossover was found within the swept range, \a false if not.
+//
+// This function sweeps the problem sizes of the given tuning and compares the runtime of the
+// operation with the threshold set to its maximum to the runtime with the threshold set to zero.
+// The crossover point is the smallest problem size for which the latter is faster both for the
+// current and the next problem size. The resulting threshold lies between the crossover point
+// and the previous problem size. In case no crossover is found, the threshold is set to the
+// largest swept problem size.
+*/
+bool tune( const Tuning& tuning, size_t& value )
+{
+   const size_t maximum( std::numeric_limits<size_t>::max() );
+
+   std::vector<size_t> sizes;
+   for( double N=tuning.first; N<=tuning.last; N*=growth ) {
+      if( sizes.empty() || static_cast<size_t>( N ) != sizes.back() )
+         sizes.push_back( static_cast<size_t>( N ) );
+   }
+
+   const auto units = [&tuning]( size_t N ) {
+      return ( tuning.square )?( N*N ):( N );
+   };
+
+   std::vector<bool> faster;
+
+   for( size_t i=0UL; i<sizes.size(); ++i )
+   {
+      blaze::setThreshold( tuning.id, maximum );
+      const double reference( tuning.run( sizes[i] ) );
+
+      blaze::setThreshold( tuning.id, 0UL );
+      const double candidate( tuning.run( sizes[i] ) );
+
+      blaze::resetThreshold( tuning.id );
+
+      faster.push_back( candidate < reference );
+
+      std::cout << "     N = " << std::setw(8) << sizes[i]
+                << "   " << std::setw(12) << reference << " s"
+                << "   " << std::setw(12) << candidate << " s"
+                << ( faster.back() ? "   *" : "" ) << std::endl;
+
+      if( i > 0UL && faster[i-1UL] && faster[i] ) {
+         value = ( i == 1UL )?( 0UL ):( ( units( sizes[i-2UL] ) + units( sizes[i-1UL] ) ) / 2UL );
+         return true;
+      }
+   }
+
+   value = units( sizes.back() );
+   return faster.back();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the Blaze threshold autotuning tool.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// The autotuning tool determines the crossover points of the Blaze thresholds on the current
+// machine and writes them to a threshold profile, which can be activated via the
+// \c BLAZE_THRESHOLD_PROFILE environment variable or the blaze::loadThresholdProfile() function
+// in case the runtime thresholds are enabled (see <tt>./blaze/config/Thresholds.h</tt>). By
+// default all supported thresholds are tuned, optionally the names of the thresholds to be
+// tuned can be specified.
+*/
+int main( int argc, char** argv )
+{
+   std::string file( "blaze.prf" );
+   std::vector<std::string> selection;
+
+   for( int i=1; i<argc; ++i )
+   {
+      const std::string arg( argv[i] );
+
+      if( arg == "-o" && i+1 < argc ) {
+         file = argv[++i];
+      }
+      else if( arg == "-h" || arg == "-help" || arg == "--help" || arg[0] == '-' ) {
+         std::cerr << " Invalid use of program 'Autotune'!\n"
+                   << "   Use: ./autotune [-o <profile>] [<threshold> ...]\n"
+                   << std::endl;
+         return EXIT_FAILURE;
+      }
+      else {
+         blaze::ThresholdID id;
+         if( !blaze::findThreshold( arg, id ) ) {
+            std::cerr << " Unknown threshold '" << arg << "'!\n" << std::endl;
+            return EXIT_FAILURE;
+         }
+         selection.push_back( blaze::name( id ) );
+      }
+   }
+
+   if( !( BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE ) ) {
+      std::cerr << " Warning: No shared memory parallelization is active, the SMP thresholds\n"
+                << "          cannot be tuned in a meaningful way!\n" << std::endl;
+   }
+
+   ::blaze::setSeed( blazemark::seed );
+
+   std::ofstream out( file.c_str() );
+
+   if( !out ) {
+      std::cerr << " Cannot open output file '" << file << "'!\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   out << "# Blaze threshold profile\n"
+       << "# Threads        : " << blaze::getNumThreads() << "\n"
+       << "# Instruction set: " << blaze::activeISA() << "\n"
+       << "# Element type   : " << ( sizeof( element_t ) == 4UL ? "float" : "double" ) << "\n\n";
+
+   std::cout << "\n Blaze threshold autotuning (" << blaze::getNumThreads() << " threads)\n";
+
+   for( const Tuning& tuning : tunings() )
+   {
+      const std::string name( blaze::name( tuning.id ) );
+
+      if( !selection.empty() && std::find( selection.begin(), selection.end(), name ) == selection.end() )
+         continue;
+
+      std::cout << "\n   " << name << " (" << ( tuning.square ? "N*N" : "N" ) << ")\n";
+
+      size_t value( 0UL );
+      const bool found( tune( tuning, value ) );
+
+      std::cout << "   => " << name << " = " << value << ( found ? "" : " (no crossover found)" ) << std::endl;
+
+      if( !found )
+         out << "# No crossover found up to the largest swept problem size\n";
+      out << name << " = " << value << std::endl;
+   }
+
+   std::cout << "\n Threshold profile written to '" << file << "'\n" << std::endl;
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
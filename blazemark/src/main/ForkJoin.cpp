@@ -0,0 +1,168 @@
+//=================================================================================================
+/*!
+//  \file src/main/ForkJoin.cpp
+//  \brief Source file for the Blaze fork/join latency benchmark
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <blaze/util/ThreadPool.h>
+#include <blaze/util/timing/WcTimer.h>
+#include <blaze/util/WorkStealingPool.h>
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+//! Default thread pool based on the C++11 thread library.
+typedef blaze::ThreadPool< std::thread
+                         , std::mutex
+                         , std::unique_lock<std::mutex>
+                         , std::condition_variable >  StdThreadPool;
+
+//! Work stealing thread pool based on the C++11 thread library.
+typedef blaze::WorkStealingPool< std::thread
+                               , std::mutex
+                               , std::unique_lock<std::mutex>
+                               , std::condition_variable >  StdWorkStealingPool;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Measures the average latency of a fork/join cycle of the given thread pool.
+//
+// \param pool The thread pool to be benchmarked.
+// \param tasks The number of tasks per fork/join cycle.
+// \param cycles The number of fork/join cycles.
+// \return The average latency of a single fork/join cycle in microseconds.
+//
+// Each fork/join cycle schedules the given number of (empty) tasks and waits for their
+// completion, which corresponds to the pattern of a single parallel Blaze operation.
+*/
+template< typename Pool >
+double measure( Pool& pool, std::size_t tasks, std::size_t cycles )
+{
+   volatile std::size_t sink( 0UL );
+   blaze::timing::WcTimer timer;
+
+   // Warm-up phase
+   for( std::size_t i=0UL; i<tasks; ++i ) {
+      pool.schedule( [&sink]() { sink = 1UL; } );
+   }
+   pool.wait();
+
+   timer.start();
+   for( std::size_t c=0UL; c<cycles; ++c ) {
+      for( std::size_t i=0UL; i<tasks; ++i ) {
+         pool.schedule( [&sink,i]() { sink = i; } );
+      }
+      pool.wait();
+   }
+   timer.end();
+
+   return timer.last() * 1E6 / cycles;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the Blaze fork/join latency benchmark.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+*/
+int main( int argc, char** argv )
+{
+   if( argc < 2 || argc > 4 ) {
+      std::cerr << " Invalid use of program 'ForkJoin'!\n"
+                << "   Use: ./forkjoin <number_of_threads> [<tasks_per_cycle> [<number_of_cycles>]]\n"
+                << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   const std::size_t threads( static_cast<std::size_t>( atoi( argv[1] ) ) );
+   const std::size_t tasks  ( ( argc > 2 )?( static_cast<std::size_t>( atoi( argv[2] ) ) ):( threads ) );
+   const std::size_t cycles ( ( argc > 3 )?( static_cast<std::size_t>( atoi( argv[3] ) ) ):( 10000UL ) );
+
+   if( threads == 0UL || tasks == 0UL || cycles == 0UL ) {
+      std::cerr << " Invalid number of threads, tasks or cycles!\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   std::cout << "\n Fork/join latency (" << threads << " threads, " << tasks << " tasks per cycle, "
+             << cycles << " cycles):\n";
+
+   {
+      StdThreadPool pool( threads );
+      std::cout << "   ThreadPool       : " << std::setw(10) << measure( pool, tasks, cycles ) << " us\n";
+   }
+
+   {
+      StdWorkStealingPool pool( threads );
+      std::cout << "   WorkStealingPool : " << std::setw(10) << measure( pool, tasks, cycles ) << " us\n";
+   }
+
+   std::cout << std::endl;
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,396 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/bandmatrix/ClassTest.h
+//  \brief Header file for the BandMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_BANDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_BANDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/Band.h>
+#include <blaze/math/BandMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace bandmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the BandMatrix class template.
+//
+// This class represents a test suite for the BandMatrix class template, its band kernels and
+// factorizations, and the Band view. All results are compared to the results of the same
+// operations on a DynamicMatrix.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testStorage      ();
+   void testElementAccess();
+   void testBandView     ();
+   void testMultiplication();
+   void testAddition     ();
+   void testSolvers      ();
+
+   template< bool SO >
+   void runMultTests( size_t m, size_t n, size_t kl, size_t ku );
+
+   template< bool SO >
+   void runSolverTests( size_t n, size_t kl, size_t ku );
+
+   template< typename MT1, typename MT2 >
+   void checkMatrix( const MT1& result, const MT2& ref, double tolerance );
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& result, const VT2& ref, double tolerance );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of all products with a band matrix of the given dimensions.
+//
+// \param m The number of rows of the tested band matrix.
+// \param n The number of columns of the tested band matrix.
+// \param kl The lower bandwidth of the tested band matrix.
+// \param ku The upper bandwidth of the tested band matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function initializes a random band matrix with the given storage order and compares the
+// results of matrix/vector, vector/matrix and matrix/matrix products (including the addition
+// and subtraction assignment and the scaled products) with the results computed by means of
+// a DynamicMatrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >  // Storage order of the band matrix
+void ClassTest::runMultTests( size_t m, size_t n, size_t kl, size_t ku )
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::columnVector;
+   using blaze::rowVector;
+
+   const double tol( 1E-10 );
+
+   const blaze::BandMatrix<double,SO> A( blaze::rand< blaze::BandMatrix<double,SO> >( m, n, kl, ku, -1.0, 1.0 ) );
+   const blaze::DynamicMatrix<double,rowMajor> ref( A );
+
+   // Matrix/vector products
+   {
+      const blaze::DynamicVector<double,columnVector> x( blaze::rand< blaze::DynamicVector<double,columnVector> >( n ) );
+      blaze::DynamicVector<double,columnVector> y( m ), z( m );
+
+      y = A * x;  z = ref * x;
+      checkVector( y, z, tol );
+
+      y += A * x;  z += ref * x;
+      checkVector( y, z, tol );
+
+      y -= 3.0 * ( A * x );  z -= 3.0 * ( ref * x );
+      checkVector( y, z, tol );
+   }
+
+   // Vector/matrix products
+   {
+      const blaze::DynamicVector<double,rowVector> x( blaze::rand< blaze::DynamicVector<double,rowVector> >( m ) );
+      blaze::DynamicVector<double,rowVector> y( n ), z( n );
+
+      y = x * A;  z = x * ref;
+      checkVector( y, z, tol );
+
+      y -= 2.0 * ( x * A );  z -= 2.0 * ( x * ref );
+      checkVector( y, z, tol );
+   }
+
+   // Matrix/matrix products
+   {
+      const blaze::DynamicMatrix<double,rowMajor> B( blaze::rand< blaze::DynamicMatrix<double,rowMajor> >( n, 7UL ) );
+      const blaze::DynamicMatrix<double,columnMajor> C( blaze::rand< blaze::DynamicMatrix<double,columnMajor> >( 5UL, m ) );
+      blaze::DynamicMatrix<double,rowMajor> D, E;
+      blaze::DynamicMatrix<double,columnMajor> F, G;
+
+      D = A * B;  E = ref * B;
+      checkMatrix( D, E, tol );
+
+      D += 2.0 * ( A * B );  E += 2.0 * ( ref * B );
+      checkMatrix( D, E, tol );
+
+      F = C * A;  G = C * ref;
+      checkMatrix( F, G, tol );
+
+      F -= C * A;  G -= C * ref;
+      checkMatrix( F, G, tol );
+   }
+
+   // Band/band products
+   {
+      const blaze::BandMatrix<double,!SO> B( blaze::rand< blaze::BandMatrix<double,!SO> >( n, m, ku, kl, -1.0, 1.0 ) );
+      const blaze::DynamicMatrix<double,columnMajor> refB( B );
+
+      blaze::BandMatrix<double,SO> D( A * trans( A ) );
+      checkMatrix( D, ref * trans( ref ), tol );
+
+      if( D.lowerBandwidth() != blaze::min( m-1UL, kl+ku ) ||
+          D.upperBandwidth() != blaze::min( m-1UL, kl+ku ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid bandwidth of band/band product\n"
+             << " Details:\n"
+             << "   Lower bandwidth: " << D.lowerBandwidth() << " (expected " << blaze::min( m-1UL, kl+ku ) << ")\n"
+             << "   Upper bandwidth: " << D.upperBandwidth() << " (expected " << blaze::min( m-1UL, kl+ku ) << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::DynamicMatrix<double,columnMajor> F( A * B ), G( ref * refB );
+      checkMatrix( F, G, tol );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the band LU and Cholesky solvers for a band matrix of the given dimensions.
+//
+// \param n The number of rows and columns of the tested band matrix.
+// \param kl The lower bandwidth of the tested band matrix.
+// \param ku The upper bandwidth of the tested band matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function initializes a random, diagonally dominant band matrix with the given storage
+// order and checks the solutions of the gbtrf()/gbtrs() and pbtrf()/pbtrs() functions by means
+// of the residual computed with a DynamicMatrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< bool SO >  // Storage order of the band matrix
+void ClassTest::runSolverTests( size_t n, size_t kl, size_t ku )
+{
+   using blaze::columnVector;
+
+   const double tol( 1E-10 );
+
+   const blaze::DynamicVector<double,columnVector> b( blaze::rand< blaze::DynamicVector<double,columnVector> >( n ) );
+
+   // LU decomposition of a general band matrix
+   {
+      blaze::BandMatrix<double,SO> A( blaze::rand< blaze::BandMatrix<double,SO> >( n, n, kl, ku, -1.0, 1.0 ) );
+      blaze::band( A, 0L ) += blaze::DynamicVector<double,columnVector>( n, double( kl+ku+1UL ) );
+      const blaze::DynamicMatrix<double,SO> ref( A );
+
+      std::vector<int> ipiv( n );
+      blaze::DynamicVector<double,columnVector> x( b );
+
+      blaze::gbtrf( A, ipiv.data() );
+      blaze::gbtrs( A, ipiv.data(), x );
+
+      checkVector( ref * x, b, tol );
+   }
+
+   // Cholesky decomposition of a symmetric positive definite band matrix
+   {
+      const blaze::BandMatrix<double,SO> B( blaze::rand< blaze::BandMatrix<double,SO> >( n, n, kl, 0UL, -1.0, 1.0 ) );
+      blaze::BandMatrix<double,SO> A( B * trans( B ) );
+      blaze::band( A, 0L ) += blaze::DynamicVector<double,columnVector>( n, 1.0 );
+      const blaze::DynamicMatrix<double,SO> ref( A );
+
+      blaze::DynamicVector<double,columnVector> x( b );
+
+      blaze::pbtrf( A );
+      blaze::pbtrs( A, x );
+
+      checkVector( ref * x, b, tol );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a computed matrix with the reference result.
+//
+// \param result The computed matrix.
+// \param ref The reference result.
+// \param tolerance The relative tolerance of the comparison.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the computed matrix
+        , typename MT2 >  // Type of the reference result
+void ClassTest::checkMatrix( const MT1& result, const MT2& ref, double tolerance )
+{
+   const double scale( 1.0 + blaze::max( blaze::abs( ref ) ) );
+
+   if( result.rows() != ref.rows() || result.columns() != ref.columns() ||
+       blaze::max( blaze::abs( result - ref ) ) > tolerance * scale ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect matrix result\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a computed vector with the reference result.
+//
+// \param result The computed vector.
+// \param ref The reference result.
+// \param tolerance The relative tolerance of the comparison.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename VT1    // Type of the computed vector
+        , typename VT2 >  // Type of the reference result
+void ClassTest::checkVector( const VT1& result, const VT2& ref, double tolerance )
+{
+   const double scale( 1.0 + blaze::max( blaze::abs( ref ) ) );
+
+   if( result.size() != ref.size() ||
+       blaze::max( blaze::abs( result - ref ) ) > tolerance * scale ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect vector result\n"
+          << " Details:\n"
+          << "   Vector type:\n"
+          << "     " << typeid( VT1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the BandMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the BandMatrix class test.
+*/
+#define RUN_BANDMATRIX_CLASS_TEST \
+   blazetest::mathtest::bandmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace bandmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
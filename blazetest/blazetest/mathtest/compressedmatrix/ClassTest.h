@@ -116,6 +116,8 @@ class ClassTest
    void testLowerBound  ();
    void testUpperBound  ();
    void testIsDefault   ();
+   void testPartition   ();
+   void testMultiplication();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
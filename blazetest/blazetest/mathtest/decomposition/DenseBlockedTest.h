@@ -0,0 +1,525 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/decomposition/DenseBlockedTest.h
+//  \brief Header file for the native blocked dense matrix decomposition test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DECOMPOSITION_DENSEBLOCKEDTEST_H_
+#define _BLAZETEST_MATHTEST_DECOMPOSITION_DENSEBLOCKEDTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/system/BLAS.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Unused.h>
+#include <blazetest/system/LAPACK.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace decomposition {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the tests of the native blocked dense matrix decompositions.
+//
+// This class represents a test suite for the native blocked LU, Cholesky, and QR decompositions
+// and the according matrix inversions, which are used in case the BLAS mode is disabled. The
+// tests use matrices that are larger than the block size of the decompositions such that both
+// the blocked updates and the remainder handling are covered.
+*/
+class DenseBlockedTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DenseBlockedTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testLU();
+   void testLLH();
+   void testQR();
+   void testInversion();
+   void testDeterminant();
+   void testErrors();
+
+   template< typename Type >
+   void testLU( size_t m, size_t n );
+
+   template< typename Type >
+   void testLLH( size_t n );
+
+   template< typename Type >
+   void testQR( size_t m, size_t n );
+
+   template< typename Type >
+   void testInversion( size_t n );
+
+   template< typename Type >
+   void testDeterminant( size_t n );
+
+   template< typename Type >
+   static Type identity( size_t n );
+
+   template< typename MT1, typename MT2 >
+   void checkResult( const MT1& result, const MT2& expected, const std::string& error ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::complex<double>  cdouble;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the LU decomposition of a random \a m-by-\a n matrix of the given type.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >
+void DenseBlockedTest::testLU( size_t m, size_t n )
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_BLAS_MODE
+
+   Type A( m, n ), L, U, P;
+   randomize( A );
+
+   blaze::lu( A, L, U, P );
+
+   Type LU( L*U );
+
+   if( blaze::IsRowMajorMatrix<Type>::value ) {
+      LU = LU * P;
+   }
+   else {
+      LU = P * LU;
+   }
+
+   checkResult( LU, A, "LU decomposition failed" );
+
+#else
+   UNUSED_PARAMETER( m, n );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Cholesky decomposition of a random positive definite matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >
+void DenseBlockedTest::testLLH( size_t n )
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_BLAS_MODE
+
+   Type B( n, n ), L;
+   randomize( B );
+
+   const Type A( B * ctrans( B ) + blaze::ElementType_<Type>( n ) * identity<Type>( n ) );
+
+   blaze::llh( A, L );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=i+1UL; j<n; ++j ) {
+         if( !blaze::isDefault( L(i,j) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Non-lower Cholesky factor detected\n"
+                << " Details:\n"
+                << "   Matrix type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Element (" << i << "," << j << "):\n"
+                << "     " << L(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   const Type LLH( L * ctrans( L ) );
+
+   checkResult( LLH, A, "Cholesky decomposition failed" );
+
+#else
+   UNUSED_PARAMETER( n );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the QR decomposition of a random \a m-by-\a n matrix of the given type.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >
+void DenseBlockedTest::testQR( size_t m, size_t n )
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_BLAS_MODE
+
+   Type A( m, n ), Q, R;
+   randomize( A );
+
+   blaze::qr( A, Q, R );
+
+   const Type QR( Q * R );
+   checkResult( QR, A, "QR decomposition failed" );
+
+   const Type QHQ( ctrans( Q ) * Q );
+   const Type I( identity<Type>( Q.columns() ) );
+   checkResult( QHQ, I, "Non-orthogonal Q matrix detected" );
+
+   for( size_t i=1UL; i<R.rows(); ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         if( !blaze::isDefault( R(i,j) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Non-upper R matrix detected\n"
+                << " Details:\n"
+                << "   Matrix type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Element (" << i << "," << j << "):\n"
+                << "     " << R(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+#else
+   UNUSED_PARAMETER( m, n );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the inversion of random \a n-by-\a n matrices of the given type.
+//
+// \param n The number of rows and columns of the matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the LU-based, the Cholesky-based and the symmetric inversion of a general
+// matrix as well as the inversion of triangular matrices.
+*/
+template< typename Type >
+void DenseBlockedTest::testInversion( size_t n )
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_BLAS_MODE
+
+   typedef blaze::ElementType_<Type>  ET;
+
+   const Type I( identity<Type>( n ) );
+
+   Type B( n, n );
+   randomize( B );
+
+   {
+      const Type A( B + ET( n ) * I );
+      Type X( A );
+      blaze::invert<blaze::byLU>( X );
+      checkResult( Type( A * X ), I, "LU-based inversion failed" );
+   }
+
+   {
+      const Type A( B * ctrans( B ) + ET( n ) * I );
+      Type X( A );
+      blaze::invert<blaze::byLLH>( X );
+      checkResult( Type( A * X ), I, "Cholesky-based inversion failed" );
+
+      Type Y( A );
+      blaze::invert<blaze::byLDLH>( Y );
+      checkResult( Type( A * Y ), I, "Hermitian inversion failed" );
+   }
+
+   {
+      Type L( n, n, ET(0) ), U( n, n, ET(0) );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<i; ++j ) {
+            L(i,j) = B(i,j) / ET( n );
+            U(j,i) = B(j,i) / ET( n );
+         }
+         L(i,i) = U(i,i) = B(i,i) + ET(1);
+      }
+
+      Type X( L );
+      blaze::invert<blaze::asLower>( X );
+      checkResult( Type( L * X ), I, "Lower inversion failed" );
+
+      Type Y( U );
+      blaze::invert<blaze::asUpper>( Y );
+      checkResult( Type( U * Y ), I, "Upper inversion failed" );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         L(i,i) = U(i,i) = ET(1);
+      }
+
+      X = L;
+      blaze::invert<blaze::asUniLower>( X );
+      checkResult( Type( L * X ), I, "Unilower inversion failed" );
+
+      Y = U;
+      blaze::invert<blaze::asUniUpper>( Y );
+      checkResult( Type( U * Y ), I, "Uniupper inversion failed" );
+   }
+
+#else
+   UNUSED_PARAMETER( n );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the determinant of a random \a n-by-\a n matrix of the given type.
+//
+// \param n The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// The matrix is set up as product of a unit lower and an upper triangular matrix, such that
+// the expected determinant is given by the product of the diagonal elements of the upper
+// matrix.
+*/
+template< typename Type >
+void DenseBlockedTest::testDeterminant( size_t n )
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_BLAS_MODE
+
+   typedef blaze::ElementType_<Type>  ET;
+
+   Type L( n, n, ET(0) ), U( n, n, ET(0) );
+   ET expected( 1 );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         L(i,j) = blaze::rand<ET>( -1, 1 ) / ET( n );
+         U(j,i) = blaze::rand<ET>( -1, 1 ) / ET( n );
+      }
+      L(i,i) = ET(1);
+      U(i,i) = ET(2) - blaze::rand<ET>( 0, 1 );
+      expected *= U(i,i);
+   }
+
+   const Type A( L * U );
+
+   const blaze::DynamicMatrix<ET> result  ( 1UL, 1UL, det( A ) );
+   const blaze::DynamicMatrix<ET> reference( 1UL, 1UL, expected );
+
+   checkResult( result, reference, "Determinant computation failed" );
+
+#else
+   UNUSED_PARAMETER( n );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating an \a n-by-\a n identity matrix of the given type.
+//
+// \param n The number of rows and columns of the matrix.
+// \return The identity matrix.
+*/
+template< typename Type >
+Type DenseBlockedTest::identity( size_t n )
+{
+   typedef blaze::ElementType_<Type>  ET;
+
+   Type I( n, n, ET(0) );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      I(i,i) = ET(1);
+   }
+
+   return I;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a computed result with the expected result.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \param error The error message in case of a mismatch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// Due to the accumulation of rounding errors in the decompositions of large matrices the result
+// is compared with a tolerance relative to the largest absolute element of the expected result.
+*/
+template< typename MT1    // Type of the computed result
+        , typename MT2 >  // Type of the expected result
+void DenseBlockedTest::checkResult( const MT1& result, const MT2& expected,
+                                    const std::string& error ) const
+{
+   using blaze::abs;
+
+   bool equal( result.rows() == expected.rows() && result.columns() == expected.columns() );
+
+   if( equal )
+   {
+      double maxDiff( 0.0 ), maxValue( 0.0 );
+
+      for( size_t i=0UL; i<expected.rows(); ++i ) {
+         for( size_t j=0UL; j<expected.columns(); ++j ) {
+            maxDiff  = std::max<double>( maxDiff , abs( result(i,j) - expected(i,j) ) );
+            maxValue = std::max<double>( maxValue, abs( expected(i,j) ) );
+         }
+      }
+
+      equal = ( maxDiff <= 1E-10 * ( 1.0 + maxValue ) * ( expected.rows() + expected.columns() ) );
+   }
+
+   if( !equal ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT2 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the native blocked dense matrix decompositions.
+//
+// \return void
+*/
+void runTest()
+{
+   DenseBlockedTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the native blocked dense matrix decomposition test.
+*/
+#define RUN_DENSE_BLOCKED_TEST \
+   blazetest::mathtest::decomposition::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace decomposition
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -103,6 +103,9 @@ class GeneralTest
    void testIsIdentity();
    void testMinimum();
    void testMaximum();
+   void testSum();
+   void testNorms();
+   void testPartialReduce();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
@@ -88,6 +88,10 @@ class OperationTest
    void testNormalize();
    void testMinimum();
    void testMaximum();
+   void testSum();
+   void testProduct();
+   void testReduce();
+   void testNorms();
 
    template< typename Type >
    void checkSize( const Type& vector, size_t expectedSize ) const;
@@ -0,0 +1,411 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrixchain/ClassTest.h
+//  \brief Header file for the matrix multiplication chain test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+
+
+#ifndef _BLAZETEST_MATHTEST_MATRIXCHAIN_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MATRIXCHAIN_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Row.h>
+#include <blaze/math/Submatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrixchain {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of matrix multiplication chains.
+//
+// This class represents a test suite for products of three and more dense and sparse matrices,
+// which are evaluated in the cheapest order determined at runtime. All results are compared to
+// the results of a strict left-to-right evaluation via explicit temporaries.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testDenseChains ();
+   void testSparseChains();
+   void testMixedChains ();
+   void testVectorChains();
+   void testOrder       ();
+
+   template< bool SO1, bool SO2, bool SO3 >
+   void runDenseTests( size_t m, size_t k, size_t l, size_t n );
+
+   template< bool SO1, bool SO2, bool SO3 >
+   void runSparseTests( size_t m, size_t k, size_t l, size_t n );
+
+   template< typename MT1, typename MT2, typename MT3 >
+   void runTests( const MT1& A, const MT2& B, const MT3& C );
+
+   template< typename MT1, typename MT2 >
+   void checkMatrix( const MT1& result, const MT2& ref );
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& result, const VT2& ref );
+
+   template< typename MT >
+   void checkSplit( const MT& chain, size_t expected );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT1, typename MT2, typename MT3 >
+   static blaze::DynamicMatrix<double> reference( const MT1& A, const MT2& B, const MT3& C );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of a product of three dense matrices of the given dimensions.
+//
+// \param m The number of rows of the first factor.
+// \param k The number of columns of the first factor.
+// \param l The number of columns of the second factor.
+// \param n The number of columns of the third factor.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< bool SO1    // Storage order of the first dense matrix
+        , bool SO2    // Storage order of the second dense matrix
+        , bool SO3 >  // Storage order of the third dense matrix
+void ClassTest::runDenseTests( size_t m, size_t k, size_t l, size_t n )
+{
+   const blaze::DynamicMatrix<double,SO1> A( blaze::rand< blaze::DynamicMatrix<double,SO1> >( m, k ) );
+   const blaze::DynamicMatrix<double,SO2> B( blaze::rand< blaze::DynamicMatrix<double,SO2> >( k, l ) );
+   const blaze::DynamicMatrix<double,SO3> C( blaze::rand< blaze::DynamicMatrix<double,SO3> >( l, n ) );
+
+   runTests( A, B, C );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of a product of three sparse matrices of the given dimensions.
+//
+// \param m The number of rows of the first factor.
+// \param k The number of columns of the first factor.
+// \param l The number of columns of the second factor.
+// \param n The number of columns of the third factor.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< bool SO1    // Storage order of the first sparse matrix
+        , bool SO2    // Storage order of the second sparse matrix
+        , bool SO3 >  // Storage order of the third sparse matrix
+void ClassTest::runSparseTests( size_t m, size_t k, size_t l, size_t n )
+{
+   const blaze::CompressedMatrix<double,SO1> A( blaze::rand< blaze::CompressedMatrix<double,SO1> >( m, k, m*k/5UL ) );
+   const blaze::CompressedMatrix<double,SO2> B( blaze::rand< blaze::CompressedMatrix<double,SO2> >( k, l, k*l/3UL ) );
+   const blaze::CompressedMatrix<double,SO3> C( blaze::rand< blaze::CompressedMatrix<double,SO3> >( l, n, l*n/4UL ) );
+
+   runTests( A, B, C );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the product of the three given matrices.
+//
+// \param A The first factor of the product.
+// \param B The second factor of the product.
+// \param C The third factor of the product.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the assignment, the addition assignment and the
+// subtraction assignment of the products \f$ A*B*C \f$ and \f$ A*(B*C) \f$ to dense and
+// sparse target matrices of both storage orders with the result of a left-to-right
+// evaluation. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the first factor
+        , typename MT2    // Type of the second factor
+        , typename MT3 >  // Type of the third factor
+void ClassTest::runTests( const MT1& A, const MT2& B, const MT3& C )
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const blaze::DynamicMatrix<double> ref( reference( A, B, C ) );
+
+   {
+      blaze::DynamicMatrix<double,rowMajor> D( A * B * C );
+      checkMatrix( D, ref );
+
+      D += A * ( B * C );
+      checkMatrix( D, 2.0*ref );
+
+      D -= 3.0 * A * B * C;
+      checkMatrix( D, -ref );
+   }
+
+   {
+      blaze::DynamicMatrix<double,columnMajor> D( A * ( B * C ) );
+      checkMatrix( D, ref );
+
+      D -= 2.0 * ( A * B ) * C;
+      checkMatrix( D, -ref );
+   }
+
+   {
+      blaze::CompressedMatrix<double,rowMajor> D( A * B * C );
+      checkMatrix( D, ref );
+   }
+
+   {
+      blaze::CompressedMatrix<double,columnMajor> D;
+      D = A * ( B * C );
+      checkMatrix( D, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a computed matrix with the reference result.
+//
+// \param result The computed matrix.
+// \param ref The reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the computed matrix
+        , typename MT2 >  // Type of the reference result
+void ClassTest::checkMatrix( const MT1& result, const MT2& ref )
+{
+   const double scale( 1.0 + blaze::max( blaze::abs( ref ) ) );
+
+   if( result.rows() != ref.rows() || result.columns() != ref.columns() ||
+       blaze::max( blaze::abs( result - ref ) ) > 1E-12 * scale ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect matrix result\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a computed vector with the reference result.
+//
+// \param result The computed vector.
+// \param ref The reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename VT1    // Type of the computed vector
+        , typename VT2 >  // Type of the reference result
+void ClassTest::checkVector( const VT1& result, const VT2& ref )
+{
+   const double scale( 1.0 + blaze::max( blaze::abs( ref ) ) );
+
+   if( result.size() != ref.size() ||
+       blaze::max( blaze::abs( result - ref ) ) > 1E-12 * scale ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect vector result\n"
+          << " Details:\n"
+          << "   Vector type:\n"
+          << "     " << typeid( VT1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the top-level split of the evaluation order of the given product.
+//
+// \param chain The matrix multiplication chain.
+// \param expected The expected index of the last factor of the left-hand side subchain.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the matrix multiplication chain
+void ClassTest::checkSplit( const MT& chain, size_t expected )
+{
+   const blaze::MatChain< MT, blaze::DynamicMatrix<double> > order( chain );
+   const size_t split( order.split( 0UL, blaze::MatChainLength<MT>::value - 1UL ) );
+
+   if( split != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid evaluation order\n"
+          << " Details:\n"
+          << "   Chain type:\n"
+          << "     " << typeid( MT ).name() << "\n"
+          << "   Result split: " << split << "\n"
+          << "   Expected split: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Left-to-right evaluation of the product of three matrices.
+//
+// \param A The first factor.
+// \param B The second factor.
+// \param C The third factor.
+// \return The product \f$ (A*B)*C \f$.
+*/
+template< typename MT1    // Type of the first factor
+        , typename MT2    // Type of the second factor
+        , typename MT3 >  // Type of the third factor
+blaze::DynamicMatrix<double> ClassTest::reference( const MT1& A, const MT2& B, const MT3& C )
+{
+   const blaze::DynamicMatrix<double> AB( A * B );
+   return AB * C;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of matrix multiplication chains.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the matrix multiplication chain test.
+*/
+#define RUN_MATRIXCHAIN_CLASS_TEST \
+   blazetest::mathtest::matrixchain::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace matrixchain
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,351 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrixmapping/ClassTest.h
+//  \brief Header file for the memory-mapped matrix test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MATRIXMAPPING_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MATRIXMAPPING_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/constraints/Matrix.h>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/serialization/MatrixMapping.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrixmapping {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the memory-mapped matrix functionality.
+//
+// This class represents a test suite for the saveMappedMatrix(), mmapMatrix(), and
+// mmapCSRMatrix() functions as well as the MappedCSRMatrix class template. It performs a
+// series of runtime tests with dense and sparse matrices of different element types.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   ~ClassTest();
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testDenseMatrices ();
+   void testSparseMatrices();
+   void testOwnership     ();
+   void testFailures      ();
+
+   template< typename Type, bool SO >
+   void runDenseTest( size_t m, size_t n );
+
+   template< typename Type, bool SO >
+   void runSparseTest( size_t m, size_t n, size_t nonzeros );
+
+   template< typename MT1, typename MT2 >
+   void compareMatrices( const MT1& src, const MT2& dst );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   std::string file_;  //!< Name of the temporary matrix file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Memory mapping test with a random dense matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function stores a random \f$ m \times n \f$ dense matrix via saveMappedMatrix() and
+// maps it via mmapMatrix(). It checks the alignment and padding of the mapped matrix and
+// compares it to the source matrix. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+void ClassTest::runDenseTest( size_t m, size_t n )
+{
+   blaze::DynamicMatrix<Type,SO> src( m, n );
+   randomize( src );
+
+   blaze::saveMappedMatrix( file_, src );
+
+   const blaze::CustomMatrix<Type,blaze::aligned,blaze::padded,SO> dst(
+      blaze::mmapMatrix<Type,SO>( file_ ) );
+
+   compareMatrices( src, dst );
+
+   if( m == 0UL || n == 0UL )
+      return;
+
+   if( !blaze::checkAlignment( dst.data() ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid alignment of the mapped matrix detected\n"
+          << " Details:\n"
+          << "   Element type: " << typeid( Type ).name() << "\n"
+          << "   Address: " << dst.data() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const size_t M( SO ? n : m );
+   const size_t N( SO ? m : n );
+   const size_t spacing( dst.spacing() );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=N; j<spacing; ++j ) {
+         if( dst.data()[i*spacing+j] != Type() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Non-zero padding element detected\n"
+                << " Details:\n"
+                << "   Element type: " << typeid( Type ).name() << "\n"
+                << "   Position: " << i << "/" << j << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Memory mapping test with a random sparse matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of non-zero elements of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function stores a random \f$ m \times n \f$ sparse matrix via saveMappedMatrix() and
+// maps it via mmapCSRMatrix(). It compares the mapped CSR matrix with the source matrix and
+// uses it as operand of a matrix/vector multiplication and of assignments. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+void ClassTest::runSparseTest( size_t m, size_t n, size_t nonzeros )
+{
+   blaze::CompressedMatrix<Type,SO> src( m, n );
+   randomize( src, nonzeros, 0, 10 );
+
+   blaze::saveMappedMatrix( file_, src );
+
+   const blaze::MappedCSRMatrix<Type> dst( blaze::mmapCSRMatrix<Type>( file_ ) );
+
+   compareMatrices( src, dst );
+
+   if( dst.nonZeros() != src.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros: " << dst.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << src.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   {
+      const blaze::CompressedMatrix<Type,blaze::rowMajor> tmp( dst );
+      compareMatrices( src, tmp );
+   }
+
+   {
+      const blaze::DynamicMatrix<Type,blaze::columnMajor> tmp( blaze::trans( dst ) );
+      compareMatrices( blaze::trans( src ), tmp );
+   }
+
+   {
+      blaze::DynamicVector<Type,blaze::columnVector> x( n );
+      randomize( x, 0, 10 );
+
+      // The reference is computed with a row-major copy of the source matrix, such that both
+      // products accumulate the elements of each row in the same order
+      const blaze::CompressedMatrix<Type,blaze::rowMajor> ref( src );
+
+      const blaze::DynamicVector<Type,blaze::columnVector> y1( dst * x );
+      const blaze::DynamicVector<Type,blaze::columnVector> y2( ref * x );
+
+      if( y1 != y2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Matrix/vector multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y1 << "\n"
+             << "   Expected result:\n" << y2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparing the given source and destination matrices.
+//
+// \param src The source matrix.
+// \param dst The destination matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given source and destination matrices element by element. In
+// case the two matrices don't match, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the source matrix
+        , typename MT2 >  // Type of the destination matrix
+void ClassTest::compareMatrices( const MT1& src, const MT2& dst )
+{
+   using blaze::IsDenseMatrix;
+
+   bool equal( src.rows() == dst.rows() && src.columns() == dst.columns() );
+
+   for( size_t i=0UL; equal && i<src.rows(); ++i ) {
+      for( size_t j=0UL; equal && j<src.columns(); ++j ) {
+         equal = ( src(i,j) == dst(i,j) );
+      }
+   }
+
+   if( !equal ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix comparison failed\n"
+          << " Details:\n"
+          << "   " << ( IsDenseMatrix<MT1>::value ? ( "Dense" ) : ( "Sparse" ) ) << " source matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   " << ( IsDenseMatrix<MT2>::value ? ( "Dense" ) : ( "Sparse" ) ) << " destination matrix type:\n"
+          << "     " << typeid( MT2 ).name() << "\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the memory-mapped matrix functionality.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the memory-mapped matrix test.
+*/
+#define RUN_MATRIXMAPPING_CLASS_TEST \
+   blazetest::mathtest::matrixmapping::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace matrixmapping
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
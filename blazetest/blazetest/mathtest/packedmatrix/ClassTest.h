@@ -0,0 +1,331 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/packedmatrix/ClassTest.h
+//  \brief Header file for the PackedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_PACKEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_PACKEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/HermitianMatrix.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/PackedMatrix.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace packedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the PackedMatrix class template.
+//
+// This class represents a test suite for the PackedMatrix class template and its use as data
+// type of the SymmetricMatrix, HermitianMatrix, LowerMatrix and UpperMatrix adaptors. All
+// results are compared to the results of the same operations on a DynamicMatrix.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testStorage      ();
+   void testElementAccess();
+   void testAssignment   ();
+   void testMultiplication();
+
+   template< typename AT, typename Type >
+   void runMultTests( size_t n );
+
+   template< typename MT1, typename MT2 >
+   void checkMatrix( const MT1& result, const MT2& ref, double tolerance );
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& result, const VT2& ref, double tolerance );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of all products of the given packed adaptor type.
+//
+// \param n The number of rows and columns of the tested matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function initializes a random matrix of the given packed adaptor type and compares the
+// results of matrix/vector, vector/matrix and matrix/matrix products (including the addition
+// and subtraction assignment and the scaled products) with the results computed by means of
+// a DynamicMatrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename AT      // Type of the packed adaptor
+        , typename Type >  // Data type of the elements
+void ClassTest::runMultTests( size_t n )
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::columnVector;
+   using blaze::rowVector;
+
+   const double tol( 1E-10 );
+
+   AT A( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         if( blaze::IsUpper<AT>::value )
+            A(j,i) = blaze::rand<Type>( -1, 1 );
+         else
+            A(i,j) = blaze::rand<Type>( -1, 1 );
+      }
+      A(i,i) = Type( blaze::rand<double>( -1.0, 1.0 ) );
+   }
+
+   const blaze::DynamicMatrix<Type,rowMajor> ref( A );
+
+   // Matrix/vector products
+   {
+      const blaze::DynamicVector<Type,columnVector> x( blaze::rand< blaze::DynamicVector<Type,columnVector> >( n ) );
+      blaze::DynamicVector<Type,columnVector> y( n ), z( n );
+
+      y = A * x;  z = ref * x;
+      checkVector( y, z, tol );
+
+      y += A * x;  z += ref * x;
+      checkVector( y, z, tol );
+
+      y -= Type(3) * ( A * x );  z -= Type(3) * ( ref * x );
+      checkVector( y, z, tol );
+
+      y = ( A * x ) * Type(2);  z = ( ref * x ) * Type(2);
+      checkVector( y, z, tol );
+   }
+
+   // Vector/matrix products
+   {
+      const blaze::DynamicVector<Type,rowVector> x( blaze::rand< blaze::DynamicVector<Type,rowVector> >( n ) );
+      blaze::DynamicVector<Type,rowVector> y( n ), z( n );
+
+      y = x * A;  z = x * ref;
+      checkVector( y, z, tol );
+
+      y += x * A;  z += x * ref;
+      checkVector( y, z, tol );
+
+      y -= Type(2) * ( x * A );  z -= Type(2) * ( x * ref );
+      checkVector( y, z, tol );
+   }
+
+   // Matrix/matrix products
+   {
+      const blaze::DynamicMatrix<Type,rowMajor> B( blaze::rand< blaze::DynamicMatrix<Type,rowMajor> >( n, 7UL ) );
+      const blaze::DynamicMatrix<Type,columnMajor> C( blaze::rand< blaze::DynamicMatrix<Type,columnMajor> >( 5UL, n ) );
+      blaze::DynamicMatrix<Type,rowMajor> D, E;
+      blaze::DynamicMatrix<Type,columnMajor> F, G;
+
+      D = A * B;  E = ref * B;
+      checkMatrix( D, E, tol );
+
+      D += Type(2) * ( A * B );  E += Type(2) * ( ref * B );
+      checkMatrix( D, E, tol );
+
+      F = C * A;  G = C * ref;
+      checkMatrix( F, G, tol );
+
+      F -= C * A;  G -= C * ref;
+      checkMatrix( F, G, tol );
+
+      D = A * A;  E = ref * ref;
+      checkMatrix( D, E, tol );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a computed matrix with the reference result.
+//
+// \param result The computed matrix.
+// \param ref The reference result.
+// \param tolerance The relative tolerance of the comparison.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the computed matrix
+        , typename MT2 >  // Type of the reference result
+void ClassTest::checkMatrix( const MT1& result, const MT2& ref, double tolerance )
+{
+   const double scale( 1.0 + blaze::max( blaze::abs( ref ) ) );
+
+   if( result.rows() != ref.rows() || result.columns() != ref.columns() ||
+       blaze::max( blaze::abs( result - ref ) ) > tolerance * scale ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect matrix result\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a computed vector with the reference result.
+//
+// \param result The computed vector.
+// \param ref The reference result.
+// \param tolerance The relative tolerance of the comparison.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename VT1    // Type of the computed vector
+        , typename VT2 >  // Type of the reference result
+void ClassTest::checkVector( const VT1& result, const VT2& ref, double tolerance )
+{
+   const double scale( 1.0 + blaze::max( blaze::abs( ref ) ) );
+
+   if( result.size() != ref.size() ||
+       blaze::max( blaze::abs( result - ref ) ) > tolerance * scale ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect vector result\n"
+          << " Details:\n"
+          << "   Vector type:\n"
+          << "     " << typeid( VT1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the PackedMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the PackedMatrix class test.
+*/
+#define RUN_PACKEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::packedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace packedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
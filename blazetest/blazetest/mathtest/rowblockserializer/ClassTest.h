@@ -0,0 +1,301 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/rowblockserializer/ClassTest.h
+//  \brief Header file for the row block serialization test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_ROWBLOCKSERIALIZER_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_ROWBLOCKSERIALIZER_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/serialization/RowBlockSerializer.h>
+#include <blaze/math/Submatrix.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/serialization/Archive.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace rowblockserializer {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the row block serialization.
+//
+// This class represents a test suite for the RowBlockWriter and RowBlockReader classes and the
+// according row block serialization functions. It performs a series of runtime tests with
+// sparse matrices of different sizes, element types, and block sizes.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::Archive<std::stringstream>  ArchiveType;  //!< Type of the archive.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testBlocks  ();
+   void testWriter  ();
+   void testFailures();
+
+   template< typename Type, bool SO >
+   void runBlockTest( size_t m, size_t n, size_t nonzeros, size_t blockSize );
+
+   template< typename MT1, typename MT2 >
+   void compareMatrices( const MT1& src, const MT2& dst );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Row block serialization test with a random sparse matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of non-zero elements of the matrix.
+// \param blockSize The number of rows per block.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function serializes a random sparse matrix in row blocks and reads it back block by
+// block, as a complete row range, and via a block-wise matrix/vector multiplication. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+void ClassTest::runBlockTest( size_t m, size_t n, size_t nonzeros, size_t blockSize )
+{
+   typedef blaze::RowBlockReader<ArchiveType,Type>  ReaderType;
+
+   blaze::CompressedMatrix<Type,SO> src( m, n );
+   randomize( src, nonzeros, 0, 10 );
+
+   // Reading the matrix block by block
+   {
+      ArchiveType archive;
+      serializeRowBlocks( archive, src, blockSize );
+
+      ReaderType reader( archive );
+      blaze::CompressedMatrix<Type,blaze::rowMajor> dst( m, n );
+
+      while( reader.next() ) {
+         if( reader.row() % blockSize != 0UL || reader.blockRows() > blockSize ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid row block detected\n"
+                << " Details:\n"
+                << "   Block size: " << blockSize << "\n"
+                << "   First row: " << reader.row() << "\n"
+                << "   Number of rows: " << reader.blockRows() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         submatrix( dst, reader.row(), 0UL, reader.blockRows(), n ) = reader.read();
+      }
+
+      compareMatrices( src, dst );
+   }
+
+   // Reading a range of rows
+   {
+      ArchiveType archive;
+      serializeRowBlocks( archive, src, blockSize );
+
+      ReaderType reader( archive );
+      const size_t row( m / 3UL );
+      const size_t rows( m / 2UL );
+
+      blaze::DynamicMatrix<Type,SO> dst;
+      deserializeRows( reader, row, rows, dst );
+
+      compareMatrices( submatrix( src, row, 0UL, rows, n ), dst );
+   }
+
+   // Block-wise matrix/vector multiplication
+   {
+      ArchiveType archive;
+      serializeRowBlocks( archive, src, blockSize );
+
+      ReaderType reader( archive );
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( n ), y;
+      randomize( x, 0, 10 );
+
+      multiplyRowBlocks( reader, x, y );
+
+      // The reference is computed with a row-major copy of the source matrix, such that both
+      // products accumulate the elements of each row in the same order
+      const blaze::CompressedMatrix<Type,blaze::rowMajor> tmp( src );
+      const blaze::DynamicVector<Type,blaze::columnVector> ref( tmp * x );
+
+      if( y != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Block-wise multiplication failed\n"
+             << " Details:\n"
+             << "   Block size: " << blockSize << "\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparing the given source and destination matrices.
+//
+// \param src The source matrix.
+// \param dst The destination matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given source and destination matrices. In case the two matrices
+// don't match, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the source matrix
+        , typename MT2 >  // Type of the destination matrix
+void ClassTest::compareMatrices( const MT1& src, const MT2& dst )
+{
+   using blaze::IsDenseMatrix;
+
+   if( src.rows() != dst.rows() || src.columns() != dst.columns() || src != dst ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix comparison failed\n"
+          << " Details:\n"
+          << "   " << ( IsDenseMatrix<MT1>::value ? ( "Dense" ) : ( "Sparse" ) ) << " source matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   " << ( IsDenseMatrix<MT2>::value ? ( "Dense" ) : ( "Sparse" ) ) << " destination matrix type:\n"
+          << "     " << typeid( MT2 ).name() << "\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the row block serialization.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the row block serialization test.
+*/
+#define RUN_ROWBLOCKSERIALIZER_CLASS_TEST \
+   blazetest::mathtest::rowblockserializer::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace rowblockserializer
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
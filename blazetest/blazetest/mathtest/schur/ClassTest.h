@@ -0,0 +1,369 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/schur/ClassTest.h
+//  \brief Header file for the Schur product test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+#ifndef _BLAZETEST_MATHTEST_SCHUR_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_SCHUR_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/Column.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Row.h>
+#include <blaze/math/Submatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace schur {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the Schur product.
+//
+// This class represents a test suite for the Schur (elementwise) product of dense and sparse
+// matrices of all storage orders. All results are compared to the results of an elementwise
+// multiplication computed by means of explicit loops.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testDenseDense  ();
+   void testDenseSparse ();
+   void testSparseSparse();
+   void testViews       ();
+   void testSizeMismatch();
+
+   template< bool SO1, bool SO2 >
+   void runDenseDenseTests( size_t m, size_t n );
+
+   template< bool SO1, bool SO2 >
+   void runDenseSparseTests( size_t m, size_t n );
+
+   template< bool SO1, bool SO2 >
+   void runSparseSparseTests( size_t m, size_t n );
+
+   template< typename MT1, typename MT2 >
+   void runTests( const MT1& A, const MT2& B );
+
+   template< typename MT1, typename MT2 >
+   void checkMatrix( const MT1& result, const MT2& ref, double tolerance );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT1, typename MT2 >
+   static blaze::DynamicMatrix<double> reference( const MT1& A, const MT2& B );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the Schur product between two dense matrices of the given dimensions.
+//
+// \param m The number of rows of the tested matrices.
+// \param n The number of columns of the tested matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< bool SO1    // Storage order of the left-hand side dense matrix
+        , bool SO2 >  // Storage order of the right-hand side dense matrix
+void ClassTest::runDenseDenseTests( size_t m, size_t n )
+{
+   const blaze::DynamicMatrix<double,SO1> A( blaze::rand< blaze::DynamicMatrix<double,SO1> >( m, n ) );
+   const blaze::DynamicMatrix<double,SO2> B( blaze::rand< blaze::DynamicMatrix<double,SO2> >( m, n ) );
+
+   runTests( A, B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Schur product between a dense and a sparse matrix of the given dimensions.
+//
+// \param m The number of rows of the tested matrices.
+// \param n The number of columns of the tested matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< bool SO1    // Storage order of the dense matrix
+        , bool SO2 >  // Storage order of the sparse matrix
+void ClassTest::runDenseSparseTests( size_t m, size_t n )
+{
+   const blaze::DynamicMatrix<double,SO1> A( blaze::rand< blaze::DynamicMatrix<double,SO1> >( m, n ) );
+   const blaze::CompressedMatrix<double,SO2> B( blaze::rand< blaze::CompressedMatrix<double,SO2> >( m, n, m*n/4UL ) );
+
+   runTests( A, B );
+   runTests( B, A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Schur product between two sparse matrices of the given dimensions.
+//
+// \param m The number of rows of the tested matrices.
+// \param n The number of columns of the tested matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< bool SO1    // Storage order of the left-hand side sparse matrix
+        , bool SO2 >  // Storage order of the right-hand side sparse matrix
+void ClassTest::runSparseSparseTests( size_t m, size_t n )
+{
+   const blaze::CompressedMatrix<double,SO1> A( blaze::rand< blaze::CompressedMatrix<double,SO1> >( m, n, m*n/3UL ) );
+   const blaze::CompressedMatrix<double,SO2> B( blaze::rand< blaze::CompressedMatrix<double,SO2> >( m, n, m*n/2UL ) );
+
+   runTests( A, B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Schur product between the two given matrices.
+//
+// \param A The left-hand side operand of the Schur product.
+// \param B The right-hand side operand of the Schur product.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the assignment, the addition assignment and the
+// subtraction assignment of the Schur product between the two given matrices to dense and
+// sparse target matrices of both storage orders with the result of an elementwise
+// multiplication. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the left-hand side operand
+        , typename MT2 >  // Type of the right-hand side operand
+void ClassTest::runTests( const MT1& A, const MT2& B )
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const double tol( 1E-12 );
+
+   const blaze::DynamicMatrix<double> ref( reference( A, B ) );
+
+   {
+      blaze::DynamicMatrix<double,rowMajor> C( A % B );
+      checkMatrix( C, ref, tol );
+
+      C += A % B;
+      checkMatrix( C, 2.0*ref, tol );
+
+      C -= 3.0 * blaze::schur( A, B );
+      checkMatrix( C, -ref, tol );
+   }
+
+   {
+      blaze::DynamicMatrix<double,columnMajor> C( blaze::schur( A, B ) );
+      checkMatrix( C, ref, tol );
+
+      C -= A % B;
+      checkMatrix( C, 0.0*ref, tol );
+   }
+
+   {
+      blaze::CompressedMatrix<double,rowMajor> C( A % B );
+      checkMatrix( C, ref, tol );
+   }
+
+   {
+      blaze::CompressedMatrix<double,columnMajor> C;
+      C = A % B;
+      checkMatrix( C, ref, tol );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a computed matrix with the reference result.
+//
+// \param result The computed matrix.
+// \param ref The reference result.
+// \param tolerance The relative tolerance of the comparison.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the computed matrix
+        , typename MT2 >  // Type of the reference result
+void ClassTest::checkMatrix( const MT1& result, const MT2& ref, double tolerance )
+{
+   const double scale( 1.0 + blaze::max( blaze::abs( ref ) ) );
+
+   if( result.rows() != ref.rows() || result.columns() != ref.columns() ||
+       blaze::max( blaze::abs( result - ref ) ) > tolerance * scale ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect matrix result\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computation of the elementwise product of two matrices by means of explicit loops.
+//
+// \param A The left-hand side operand.
+// \param B The right-hand side operand.
+// \return The elementwise product of the two matrices.
+*/
+template< typename MT1    // Type of the left-hand side operand
+        , typename MT2 >  // Type of the right-hand side operand
+blaze::DynamicMatrix<double> ClassTest::reference( const MT1& A, const MT2& B )
+{
+   blaze::DynamicMatrix<double> C( A.rows(), A.columns() );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         C(i,j) = A(i,j) * B(i,j);
+      }
+   }
+
+   return C;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the Schur product.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the Schur product test.
+*/
+#define RUN_SCHUR_CLASS_TEST \
+   blazetest::mathtest::schur::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace schur
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
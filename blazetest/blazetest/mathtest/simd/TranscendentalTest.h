@@ -0,0 +1,1154 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/simd/TranscendentalTest.h
+//  \brief Header file for the SIMD transcendental function test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SIMD_TRANSCENDENTALTEST_H_
+#define _BLAZETEST_MATHTEST_SIMD_TRANSCENDENTALTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/HasSIMDCbrt.h>
+#include <blaze/math/typetraits/HasSIMDCos.h>
+#include <blaze/math/typetraits/HasSIMDErf.h>
+#include <blaze/math/typetraits/HasSIMDExp.h>
+#include <blaze/math/typetraits/HasSIMDInvSqrt.h>
+#include <blaze/math/typetraits/HasSIMDLog.h>
+#include <blaze/math/typetraits/HasSIMDLog10.h>
+#include <blaze/math/typetraits/HasSIMDPow.h>
+#include <blaze/math/typetraits/HasSIMDSin.h>
+#include <blaze/math/typetraits/HasSIMDTan.h>
+#include <blaze/math/typetraits/HasSIMDTanh.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/typetraits/IsFloat.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace simd {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class template for the accuracy test of the SIMD transcendental functions.
+//
+// This class template represents the accuracy tests of the vectorized exp(), log(), log10(),
+// sin(), cos(), tan(), tanh(), erf(), pow(), cbrt(), and invsqrt() functions for the given
+// floating point data type \a T. The vectorized results are compared to the results of the
+// corresponding long double functions of the C++ standard library. For random arguments,
+// subnormal arguments, and arguments close to the overflow and underflow thresholds the error
+// in units in the last place (ULP) must not exceed the documented maximum error. Signed zeros,
+// infinities, and NaNs must result in exactly the same values as the scalar functions. The
+// test covers the SIMD width of the current build (SSE2, AVX, or AVX-512).
+*/
+template< typename T >  // Data type of the SIMD test
+class TranscendentalTest : private blaze::NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::SIMDTrait<T>                          SIMD;      //!< SIMD trait for the given floating point type.
+   typedef typename SIMD::Type                          SIMDType;  //!< SIMD type for the given floating point type.
+   typedef std::numeric_limits<T>                       Limits;    //!< Numeric limits of the given floating point type.
+   typedef std::vector< T, blaze::AlignedAllocator<T> >  Array;     //!< Aligned array of arguments/results.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum : size_t { SIMDSIZE = SIMD::size };  //!< Number of elements in a single SIMD vector.
+   enum : size_t { N = 8192UL };             //!< Number of random arguments per tested interval.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit TranscendentalTest();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testExp    ( blaze::TrueType  );
+   void testExp    ( blaze::FalseType );
+   void testLog    ( blaze::TrueType  );
+   void testLog    ( blaze::FalseType );
+   void testLog10  ( blaze::TrueType  );
+   void testLog10  ( blaze::FalseType );
+   void testSin    ( blaze::TrueType  );
+   void testSin    ( blaze::FalseType );
+   void testCos    ( blaze::TrueType  );
+   void testCos    ( blaze::FalseType );
+   void testTan    ( blaze::TrueType  );
+   void testTan    ( blaze::FalseType );
+   void testTanh   ( blaze::TrueType  );
+   void testTanh   ( blaze::FalseType );
+   void testErf    ( blaze::TrueType  );
+   void testErf    ( blaze::FalseType );
+   void testPow    ( blaze::TrueType  );
+   void testPow    ( blaze::FalseType );
+   void testCbrt   ( blaze::TrueType  );
+   void testCbrt   ( blaze::FalseType );
+   void testInvSqrt( blaze::TrueType  );
+   void testInvSqrt( blaze::FalseType );
+
+   template< typename OP, typename REF >
+   void checkAccuracy( Array x, OP op, REF ref, double fmax, double dmax );
+
+   template< typename OP, typename REF >
+   void checkAccuracy( Array x, Array y, OP op, REF ref, double fmax, double dmax );
+
+   template< typename OP, typename REF >
+   void checkSpecial( Array x, OP op, REF ref );
+
+   template< typename OP, typename REF >
+   void checkSpecial( Array x, Array y, OP op, REF ref );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static Array uniform   ( T min, T max );
+   static Array logUniform( int minExp, int maxExp, bool negative );
+   static Array trigEdges ( T max );
+   static Array specials  ();
+   static Array neighbors ( long double value );
+   static Array subnormals();
+   static Array concat    ( Array a, const Array& b );
+
+   static long double ulpError( T result, long double ref );
+   static bool        isSame  ( T result, T ref );
+   static void        pad     ( Array& x );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( T );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the accuracy test of the SIMD transcendental functions.
+//
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+TranscendentalTest<T>::TranscendentalTest()
+   : test_()  // Label of the currently performed test
+{
+   testExp    ( typename blaze::HasSIMDExp    <T>::Type() );
+   testLog    ( typename blaze::HasSIMDLog    <T>::Type() );
+   testLog10  ( typename blaze::HasSIMDLog10  <T>::Type() );
+   testSin    ( typename blaze::HasSIMDSin    <T>::Type() );
+   testCos    ( typename blaze::HasSIMDCos    <T>::Type() );
+   testTan    ( typename blaze::HasSIMDTan    <T>::Type() );
+   testTanh   ( typename blaze::HasSIMDTanh   <T>::Type() );
+   testErf    ( typename blaze::HasSIMDErf    <T>::Type() );
+   testPow    ( typename blaze::HasSIMDPow     <T>::Type() );
+   testCbrt   ( typename blaze::HasSIMDCbrt   <T>::Type() );
+   testInvSqrt( typename blaze::HasSIMDInvSqrt<T>::Type() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the exp operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testExp( blaze::TrueType )
+{
+   test_ = "Exponent operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::exp( a ); } );
+   const auto ref( []( long double x ) { return std::exp( x ); } );
+
+   const long double maxLog( std::log( static_cast<long double>( Limits::max() ) ) );
+   const long double minLog( std::log( static_cast<long double>( Limits::min() ) ) );
+   const long double subLog( std::log( static_cast<long double>( Limits::denorm_min() ) ) );
+
+   checkAccuracy( uniform( T(subLog)-T(1), T(maxLog)+T(1) ), op, ref, 1.1, 1.1 );
+   checkAccuracy( uniform( T(-1), T(1) ), op, ref, 1.1, 1.1 );
+   checkAccuracy( logUniform( Limits::min_exponent-Limits::digits, -1, false ), op, ref, 1.1, 1.1 );
+   checkAccuracy( logUniform( Limits::min_exponent-Limits::digits, -1, true  ), op, ref, 1.1, 1.1 );
+   checkAccuracy( concat( concat( neighbors( maxLog ), neighbors( minLog ) ), neighbors( subLog ) )
+                , op, ref, 1.1, 1.1 );
+   checkAccuracy( subnormals(), op, ref, 1.1, 1.1 );
+
+   checkSpecial( concat( specials(), Array{ T(-1E6), T(1E6) } ), op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the exp operation.
+//
+// \return void
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testExp( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the natural logarithm operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testLog( blaze::TrueType )
+{
+   test_ = "Natural logarithm operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::log( a ); } );
+   const auto ref( []( long double x ) { return std::log( x ); } );
+
+   checkAccuracy( logUniform( Limits::min_exponent-Limits::digits, Limits::max_exponent-1, false )
+                , op, ref, 0.9, 0.9 );
+   checkAccuracy( uniform( T(0.5), T(2) ), op, ref, 0.9, 0.9 );
+   checkAccuracy( concat( concat( neighbors( 1.0L ), subnormals() ), Array{ Limits::max() } )
+                , op, ref, 0.9, 0.9 );
+
+   checkSpecial( concat( specials(), Array{ T(-1), T(1) } ), op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the natural logarithm operation.
+//
+// \return void
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testLog( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the common logarithm operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testLog10( blaze::TrueType )
+{
+   test_ = "Common logarithm operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::log10( a ); } );
+   const auto ref( []( long double x ) { return std::log10( x ); } );
+
+   checkAccuracy( logUniform( Limits::min_exponent-Limits::digits, Limits::max_exponent-1, false )
+                , op, ref, 2.1, 2.0 );
+   checkAccuracy( uniform( T(0.5), T(2) ), op, ref, 2.1, 2.0 );
+   checkAccuracy( concat( concat( neighbors( 1.0L ), subnormals() ), Array{ Limits::max() } )
+                , op, ref, 2.1, 2.0 );
+
+   checkSpecial( concat( specials(), Array{ T(-1), T(1) } ), op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the common logarithm operation.
+//
+// \return void
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testLog10( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the sine operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testSin( blaze::TrueType )
+{
+   test_ = "Sine operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::sin( a ); } );
+   const auto ref( []( long double x ) { return std::sin( x ); } );
+
+   const T vmax( blaze::IsFloat<T>::value ? T(8192) : T(1048576) );
+
+   checkAccuracy( uniform( -vmax, vmax ), op, ref, 1.6, 1.6 );
+   checkAccuracy( uniform( T(-4), T(4) ), op, ref, 1.6, 1.6 );
+   checkAccuracy( uniform( T(-1E6)*vmax, T(1E6)*vmax ), op, ref, 1.6, 1.6 );
+   checkAccuracy( logUniform( Limits::min_exponent-Limits::digits, -1, true ), op, ref, 1.6, 1.6 );
+   checkAccuracy( trigEdges( vmax ), op, ref, 1.6, 1.6 );
+
+   checkSpecial( specials(), op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the sine operation.
+//
+// \return void
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testSin( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the cosine operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testCos( blaze::TrueType )
+{
+   test_ = "Cosine operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::cos( a ); } );
+   const auto ref( []( long double x ) { return std::cos( x ); } );
+
+   const T vmax( blaze::IsFloat<T>::value ? T(8192) : T(1048576) );
+
+   checkAccuracy( uniform( -vmax, vmax ), op, ref, 1.6, 1.6 );
+   checkAccuracy( uniform( T(-4), T(4) ), op, ref, 1.6, 1.6 );
+   checkAccuracy( uniform( T(-1E6)*vmax, T(1E6)*vmax ), op, ref, 1.6, 1.6 );
+   checkAccuracy( logUniform( Limits::min_exponent-Limits::digits, -1, true ), op, ref, 1.6, 1.6 );
+   checkAccuracy( trigEdges( vmax ), op, ref, 1.6, 1.6 );
+
+   checkSpecial( specials(), op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the cosine operation.
+//
+// \return void
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testCos( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the tangent operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testTan( blaze::TrueType )
+{
+   test_ = "Tangent operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::tan( a ); } );
+   const auto ref( []( long double x ) { return std::tan( x ); } );
+
+   const T vmax( blaze::IsFloat<T>::value ? T(8192) : T(1048576) );
+
+   checkAccuracy( uniform( -vmax, vmax ), op, ref, 3.7, 3.7 );
+   checkAccuracy( uniform( T(-4), T(4) ), op, ref, 3.7, 3.7 );
+   checkAccuracy( uniform( T(-1E6)*vmax, T(1E6)*vmax ), op, ref, 3.7, 3.7 );
+   checkAccuracy( logUniform( Limits::min_exponent-Limits::digits, -1, true ), op, ref, 3.7, 3.7 );
+   checkAccuracy( trigEdges( vmax ), op, ref, 3.7, 3.7 );
+
+   checkSpecial( specials(), op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the tangent operation.
+//
+// \return void
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testTan( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the hyperbolic tangent operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testTanh( blaze::TrueType )
+{
+   test_ = "Hyperbolic tangent operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::tanh( a ); } );
+   const auto ref( []( long double x ) { return std::tanh( x ); } );
+
+   const long double vmax( blaze::IsFloat<T>::value ? 9.1L : 22.0L );
+
+   checkAccuracy( uniform( T(-2)*T(vmax), T(2)*T(vmax) ), op, ref, 2.6, 2.7 );
+   checkAccuracy( uniform( T(-1), T(1) ), op, ref, 2.6, 2.7 );
+   checkAccuracy( logUniform( Limits::min_exponent-Limits::digits, -1, false ), op, ref, 2.6, 2.7 );
+   checkAccuracy( logUniform( Limits::min_exponent-Limits::digits, -1, true  ), op, ref, 2.6, 2.7 );
+   checkAccuracy( concat( neighbors( vmax ), neighbors( -vmax ) ), op, ref, 2.6, 2.7 );
+
+   checkSpecial( concat( specials(), Array{ T(-100), T(100) } ), op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the hyperbolic tangent operation.
+//
+// \return void
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testTanh( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the error function.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testErf( blaze::TrueType )
+{
+   test_ = "Error function";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::erf( a ); } );
+   const auto ref( []( long double x ) { return std::erf( x ); } );
+
+   const long double vmax( blaze::IsFloat<T>::value ? 4.0L : 6.0L );
+
+   checkAccuracy( uniform( T(-2)*T(vmax), T(2)*T(vmax) ), op, ref, 2.7, 2.1 );
+   checkAccuracy( uniform( T(-1), T(1) ), op, ref, 2.7, 2.1 );
+   checkAccuracy( logUniform( Limits::min_exponent-Limits::digits, -1, false ), op, ref, 2.7, 2.1 );
+   checkAccuracy( logUniform( Limits::min_exponent-Limits::digits, -1, true  ), op, ref, 2.7, 2.1 );
+   checkAccuracy( concat( concat( neighbors( 1.0L ), neighbors( -1.0L ) ), neighbors( vmax ) )
+                , op, ref, 2.7, 2.1 );
+
+   checkSpecial( concat( specials(), Array{ T(-100), T(100) } ), op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the error function.
+//
+// \return void
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testErf( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the power operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testPow( blaze::TrueType )
+{
+   test_ = "Power operation";
+
+   const auto op ( []( const SIMDType& a, const SIMDType& b ) { return blaze::pow( a, b ); } );
+   const auto ref( []( long double x, long double y ) { return std::pow( x, y ); } );
+
+   const T maxExp( Limits::max_exponent );
+   const T minExp( Limits::min_exponent - Limits::digits );
+
+   // Single precision results are correctly rounded up to the double rounding of the
+   // double precision intermediate result
+   const double fmax( 0.501 );
+   const double dmax( 1.4 );
+
+   checkAccuracy( logUniform( -20, 20, false ), uniform( T(-20), T(20) ), op, ref, fmax, dmax );
+   checkAccuracy( uniform( T(0.5), T(2) ), uniform( T(-100), T(100) ), op, ref, fmax, dmax );
+   checkAccuracy( logUniform( Limits::min_exponent-Limits::digits, Limits::max_exponent-1, false )
+                , uniform( T(-1), T(1) ), op, ref, fmax, dmax );
+
+   // Negative bases with integral exponents
+   {
+      Array y( uniform( T(-20), T(20) ) );
+      for( T& value : y ) {
+         value = std::round( value );
+      }
+      checkAccuracy( logUniform( -4, 4, true ), y, op, ref, fmax, dmax );
+   }
+
+   // Large exponents (amplification of the error of the logarithm)
+   {
+      const T maxLog( std::log( Limits::max() ) );
+
+      Array x( uniform( T(0.7), T(1.4) ) );
+      Array y( x.size() );
+      for( size_t i=0UL; i<x.size(); ++i ) {
+         y[i] = blaze::rand<T>( -maxLog, maxLog ) / std::log( x[i] );
+      }
+      checkAccuracy( x, y, op, ref, fmax, dmax );
+   }
+
+   // Overflow and underflow thresholds
+   {
+      const Array y( concat( concat( neighbors( maxExp ), neighbors( minExp ) )
+                           , concat( neighbors( Limits::min_exponent-1 ), uniform( minExp-T(2), maxExp+T(2) ) ) ) );
+      checkAccuracy( Array( y.size(), T(2) ), y, op, ref, fmax, dmax );
+      checkAccuracy( Array( y.size(), T(0.5) ), y, op, ref, fmax, dmax );
+   }
+
+   // Special cases of the bases and exponents
+   {
+      const T inf( Limits::infinity() );
+      const T nan( Limits::quiet_NaN() );
+
+      const Array bases{ T(0), -T(0), T(1), T(-1), inf, -inf, nan, T(2), T(-2), T(0.5), T(-0.5) };
+      const Array exponents{ T(0), -T(0), T(1), T(-1), T(2), T(-2), T(3), T(-3), T(0.5), T(-0.5)
+                           , inf, -inf, nan };
+
+      Array x, y;
+
+      for( T base : bases ) {
+         for( T exponent : exponents ) {
+            if( ( std::abs( base ) == T(2) || std::abs( base ) == T(0.5) ) &&
+                std::isfinite( exponent ) && exponent != T(0) &&
+                ( base > T(0) || std::round( exponent ) == exponent ) )
+               continue;
+            x.push_back( base );
+            y.push_back( exponent );
+         }
+      }
+
+      checkSpecial( x, y, op, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the power operation.
+//
+// \return void
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testPow( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the cubic root operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testCbrt( blaze::TrueType )
+{
+   test_ = "Cubic root operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::cbrt( a ); } );
+   const auto ref( []( long double x ) { return std::cbrt( x ); } );
+
+   checkAccuracy( logUniform( Limits::min_exponent-Limits::digits, Limits::max_exponent-1, false )
+                , op, ref, 1.0, 1.0 );
+   checkAccuracy( logUniform( Limits::min_exponent-Limits::digits, Limits::max_exponent-1, true )
+                , op, ref, 1.0, 1.0 );
+   checkAccuracy( uniform( T(-10), T(10) ), op, ref, 1.0, 1.0 );
+   checkAccuracy( concat( subnormals(), Array{ Limits::max(), -Limits::max() } ), op, ref, 1.0, 1.0 );
+
+   checkSpecial( specials(), op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the cubic root operation.
+//
+// \return void
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testCbrt( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the inverse square root operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testInvSqrt( blaze::TrueType )
+{
+   test_ = "Inverse square root operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::invsqrt( a ); } );
+   const auto ref( []( long double x ) { return 1.0L / std::sqrt( x ); } );
+
+   checkAccuracy( logUniform( Limits::min_exponent-Limits::digits, Limits::max_exponent-1, false )
+                , op, ref, 1.5, 1.5 );
+   checkAccuracy( uniform( T(0.5), T(4) ), op, ref, 1.5, 1.5 );
+   checkAccuracy( concat( subnormals(), Array{ Limits::max() } ), op, ref, 1.5, 1.5 );
+
+   checkSpecial( concat( specials(), Array{ T(-1) } ), op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the inverse square root operation.
+//
+// \return void
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::testInvSqrt( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the accuracy of a unary SIMD operation.
+//
+// \param x The arguments of the operation.
+// \param op The SIMD operation.
+// \param ref The long double reference operation.
+// \param fmax The maximum error in ULP for single precision values.
+// \param dmax The maximum error in ULP for double precision values.
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+template< typename OP     // Type of the SIMD operation
+        , typename REF >  // Type of the reference operation
+void TranscendentalTest<T>::checkAccuracy( Array x, OP op, REF ref, double fmax, double dmax )
+{
+   Array y( x.size(), T(1) );
+
+   checkAccuracy( x, y, [op]( const SIMDType& a, const SIMDType& ) { return op( a ); }
+                , [ref]( long double a, long double ) { return ref( a ); }, fmax, dmax );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the accuracy of a binary SIMD operation.
+//
+// \param x The first arguments of the operation.
+// \param y The second arguments of the operation.
+// \param op The SIMD operation.
+// \param ref The long double reference operation.
+// \param fmax The maximum error in ULP for single precision values.
+// \param dmax The maximum error in ULP for double precision values.
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+//
+// This function evaluates the given SIMD operation for all given arguments and compares the
+// results to the results of the long double reference operation. In case the error of any
+// result exceeds the maximum error, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the SIMD test
+template< typename OP     // Type of the SIMD operation
+        , typename REF >  // Type of the reference operation
+void TranscendentalTest<T>::checkAccuracy( Array x, Array y, OP op, REF ref, double fmax, double dmax )
+{
+   using blaze::loada;
+   using blaze::storea;
+
+   const long double maxError( blaze::IsFloat<T>::value ? fmax : dmax );
+
+   const size_t n( x.size() );
+
+   pad( x );
+   pad( y );
+
+   Array z( x.size() );
+
+   for( size_t i=0UL; i<x.size(); i+=SIMDSIZE ) {
+      storea( &z[i], op( loada( &x[i] ), loada( &y[i] ) ) );
+   }
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const long double expected( ref( x[i], y[i] ) );
+      const long double error( ulpError( z[i], expected ) );
+
+      if( !( error <= maxError ) ) {
+         std::ostringstream oss;
+         oss.precision( std::numeric_limits<long double>::digits10 + 2 );
+         oss << " Test: " << test_ << "\n"
+             << " Error: Maximum error exceeded\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( T ).name() << "\n"
+             << "   SIMD size: " << SIMDSIZE << "\n"
+             << "   Arguments: " << x[i] << " / " << y[i] << "\n"
+             << "   Result: " << z[i] << "\n"
+             << "   Expected result: " << expected << "\n"
+             << "   Error: " << error << " ULP\n"
+             << "   Maximum error: " << maxError << " ULP\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the special values of a unary SIMD operation.
+//
+// \param x The arguments of the operation.
+// \param op The SIMD operation.
+// \param ref The long double reference operation.
+// \return void
+// \exception std::runtime_error Invalid result detected.
+*/
+template< typename T >  // Data type of the SIMD test
+template< typename OP     // Type of the SIMD operation
+        , typename REF >  // Type of the reference operation
+void TranscendentalTest<T>::checkSpecial( Array x, OP op, REF ref )
+{
+   Array y( x.size(), T(1) );
+
+   checkSpecial( x, y, [op]( const SIMDType& a, const SIMDType& ) { return op( a ); }
+               , [ref]( long double a, long double ) { return ref( a ); } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the special values of a binary SIMD operation.
+//
+// \param x The first arguments of the operation.
+// \param y The second arguments of the operation.
+// \param op The SIMD operation.
+// \param ref The long double reference operation.
+// \return void
+// \exception std::runtime_error Invalid result detected.
+//
+// This function checks that the given SIMD operation results in exactly the same values as
+// the long double reference operation (including the sign of zeros and infinities) for the
+// given arguments. In case any result differs, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the SIMD test
+template< typename OP     // Type of the SIMD operation
+        , typename REF >  // Type of the reference operation
+void TranscendentalTest<T>::checkSpecial( Array x, Array y, OP op, REF ref )
+{
+   using blaze::loada;
+   using blaze::storea;
+
+   const size_t n( x.size() );
+
+   pad( x );
+   pad( y );
+
+   Array z( x.size() );
+
+   for( size_t i=0UL; i<x.size(); i+=SIMDSIZE ) {
+      storea( &z[i], op( loada( &x[i] ), loada( &y[i] ) ) );
+   }
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const T expected( static_cast<T>( ref( x[i], y[i] ) ) );
+
+      if( !isSame( z[i], expected ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid result for special argument\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( T ).name() << "\n"
+             << "   SIMD size: " << SIMDSIZE << "\n"
+             << "   Arguments: " << x[i] << " / " << y[i] << "\n"
+             << "   Result: " << z[i] << "\n"
+             << "   Expected result: " << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates uniformly distributed random arguments in the range \f$ [min,max] \f$.
+//
+// \param min The smallest possible argument.
+// \param max The largest possible argument.
+// \return The random arguments.
+*/
+template< typename T >  // Data type of the SIMD test
+typename TranscendentalTest<T>::Array TranscendentalTest<T>::uniform( T min, T max )
+{
+   Array x( N );
+
+   for( T& value : x ) {
+      value = blaze::rand<T>( min, max );
+   }
+
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates random arguments with uniformly distributed binary exponents.
+//
+// \param minExp The smallest possible binary exponent.
+// \param maxExp The largest possible binary exponent.
+// \param negative \a true for negative arguments, \a false for positive arguments.
+// \return The random arguments.
+//
+// This function creates arguments of the form \f$ m \cdot 2^e \f$ with \f$ m \in [1,2) \f$ and
+// \f$ e \in [minExp,maxExp] \f$. Exponents below the smallest normalized exponent result in
+// subnormal arguments.
+*/
+template< typename T >  // Data type of the SIMD test
+typename TranscendentalTest<T>::Array
+   TranscendentalTest<T>::logUniform( int minExp, int maxExp, bool negative )
+{
+   Array x( N );
+
+   for( T& value : x ) {
+      value = std::ldexp( blaze::rand<T>( T(1), T(2) ), blaze::rand<int>( minExp, maxExp ) );
+      if( negative ) value = -value;
+   }
+
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates arguments close to multiples of \f$ \pi/2 \f$ and to the vectorization limit.
+//
+// \param max The largest argument reduced by the vectorized trigonometric functions.
+// \return The arguments.
+*/
+template< typename T >  // Data type of the SIMD test
+typename TranscendentalTest<T>::Array TranscendentalTest<T>::trigEdges( T max )
+{
+   const long double pio2( 1.5707963267948966192313216916397514L );
+
+   Array x( concat( neighbors( max ), neighbors( -max ) ) );
+
+   for( long double k : { 1.0L, 2.0L, 3.0L, 4.0L, 5.0L, 10.0L, 100.0L, 1000.0L } ) {
+      if( k*pio2 < max ) {
+         x = concat( x, neighbors(  k*pio2 ) );
+         x = concat( x, neighbors( -k*pio2 ) );
+      }
+   }
+
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the special arguments signed zero, infinity, and NaN.
+//
+// \return The special arguments.
+*/
+template< typename T >  // Data type of the SIMD test
+typename TranscendentalTest<T>::Array TranscendentalTest<T>::specials()
+{
+   return Array{ T(0), -T(0), Limits::infinity(), -Limits::infinity(), Limits::quiet_NaN() };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the 33 representable values closest to the given value.
+//
+// \param value The given value.
+// \return The representable values around the given value.
+*/
+template< typename T >  // Data type of the SIMD test
+typename TranscendentalTest<T>::Array TranscendentalTest<T>::neighbors( long double value )
+{
+   Array x;
+
+   T lower( static_cast<T>( value ) );
+   T upper( lower );
+
+   x.push_back( lower );
+
+   for( size_t i=0UL; i<16UL; ++i ) {
+      lower = std::nextafter( lower, -Limits::infinity() );
+      upper = std::nextafter( upper,  Limits::infinity() );
+      x.push_back( lower );
+      x.push_back( upper );
+   }
+
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns positive and negative subnormal arguments and the smallest normalized values.
+//
+// \return The subnormal arguments.
+*/
+template< typename T >  // Data type of the SIMD test
+typename TranscendentalTest<T>::Array TranscendentalTest<T>::subnormals()
+{
+   const T dmin( Limits::denorm_min() );
+   const T nmin( Limits::min() );
+
+   Array x{ dmin, T(2)*dmin, T(3)*dmin, nmin/T(3), nmin/T(2), nmin-dmin, nmin };
+
+   for( size_t i=0UL, n=x.size(); i<n; ++i ) {
+      if( std::signbit( x[i] ) == false ) x.push_back( -x[i] );
+   }
+
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Concatenation of two arrays of arguments.
+//
+// \param a The first array.
+// \param b The second array.
+// \return The concatenation of the two arrays.
+*/
+template< typename T >  // Data type of the SIMD test
+typename TranscendentalTest<T>::Array TranscendentalTest<T>::concat( Array a, const Array& b )
+{
+   a.insert( a.end(), b.begin(), b.end() );
+   return a;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the error of a result in units in the last place (ULP).
+//
+// \param result The computed result.
+// \param ref The long double reference result.
+// \return The error in ULP.
+//
+// The ULP of the reference result is the distance between two consecutive values of type \a T
+// in the binade of the reference result (or the distance between two consecutive subnormal
+// values). Infinite results are treated as the value \f$ 2^{max\_exponent} \f$, i.e. rounding
+// a reference result close to the overflow threshold to infinity is accepted within the error
+// bound. Reference results beyond \f$ 2^{max\_exponent} \f$ require an infinite result.
+*/
+template< typename T >  // Data type of the SIMD test
+long double TranscendentalTest<T>::ulpError( T result, long double ref )
+{
+   const long double inf( std::numeric_limits<long double>::infinity() );
+   const long double limit( std::ldexp( 1.0L, Limits::max_exponent ) );
+
+   if( std::isnan( ref ) || std::isnan( result ) )
+      return ( std::isnan( ref ) && std::isnan( result ) ) ? 0.0L : inf;
+
+   if( std::fabs( ref ) >= limit )
+      return ( std::isinf( result ) && std::signbit( result ) == std::signbit( ref ) ) ? 0.0L : inf;
+
+   const long double res( std::isinf( result ) ? std::copysign( limit, static_cast<long double>( result ) )
+                                                : static_cast<long double>( result ) );
+   const long double a( std::fabs( ref ) );
+
+   int exponent( Limits::min_exponent );
+   if( a >= Limits::min() ) {
+      std::frexp( a, &exponent );
+   }
+
+   const long double ulp( std::ldexp( 1.0L, std::max( exponent, Limits::min_exponent ) - Limits::digits ) );
+
+   return std::fabs( res - ref ) / ulp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks if the given result is identical to the expected result.
+//
+// \param result The computed result.
+// \param ref The expected result.
+// \return \a true if both values are NaN or are equal and have the same sign, \a false if not.
+*/
+template< typename T >  // Data type of the SIMD test
+bool TranscendentalTest<T>::isSame( T result, T ref )
+{
+   if( std::isnan( result ) || std::isnan( ref ) )
+      return std::isnan( result ) && std::isnan( ref );
+
+   return result == ref && std::signbit( result ) == std::signbit( ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pads the given array of arguments to a multiple of the SIMD size.
+//
+// \param x The array of arguments.
+// \return void
+*/
+template< typename T >  // Data type of the SIMD test
+void TranscendentalTest<T>::pad( Array& x )
+{
+   while( x.size() % SIMDSIZE != 0UL ) {
+      x.push_back( T(1) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the SIMD transcendental functions of a specific data type.
+//
+// \return void
+*/
+template< typename T >  // Data type of the SIMD test
+void runTranscendentalTest()
+{
+   TranscendentalTest<T>();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of an accuracy test of the SIMD transcendental functions.
+*/
+#define RUN_SIMD_TRANSCENDENTAL_TEST( T ) \
+   blazetest::mathtest::simd::runTranscendentalTest<T>()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace simd
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
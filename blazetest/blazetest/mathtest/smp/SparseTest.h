@@ -0,0 +1,578 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/SparseTest.h
+//  \brief Header file for the SMP sparse matrix assignment test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_SPARSETEST_H_
+#define _BLAZETEST_MATHTEST_SMP_SPARSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <blaze/math/CompactMatrix.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/StaticAssert.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the tests of the SMP assignment to sparse matrices.
+//
+// This class represents a test suite for the shared memory parallel assignment to sparse matrices.
+// It is compiled once per SMP backend (C++11 threads and OpenMP). All operands are chosen large
+// enough to exceed the SMP thresholds, i.e. all assignments are performed by the SMP backend.
+// The results are compared to the according serial computations.
+*/
+class SparseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testSparseProduct();
+   void testDenseAssign  ();
+   void testEmptyResult  ();
+   void testCompactMatrix();
+   void testCompactVector();
+   void testPartition    ();
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::CompressedMatrix<int,blaze::rowMajor>     MT;   //!< Row-major operand type.
+   typedef blaze::CompressedMatrix<int,blaze::columnMajor>  OMT;  //!< Column-major operand type.
+   typedef blaze::DynamicMatrix<int,blaze::rowMajor>        DMT;  //!< Row-major dense operand type.
+   typedef blaze::DynamicMatrix<int,blaze::columnMajor>     ODMT; //!< Column-major dense operand type.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SMP sparse matrix assignment test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+inline SparseTest::SparseTest()
+{
+   blaze::setNumThreads( 4UL );
+
+   testSparseProduct();
+   testDenseAssign();
+   testEmptyResult();
+   testCompactMatrix();
+   testCompactVector();
+   testPartition();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment of a sparse matrix multiplication to a CompressedMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the SMP assignment of sparse matrix/sparse matrix multiplications with
+// row-major and column-major operands to row-major and column-major compressed matrices. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void SparseTest::testSparseProduct()
+{
+   const MT  A ( blaze::rand<MT>( 200UL, 150UL, 3000UL, -5, 5 ) );
+   const MT  B ( blaze::rand<MT>( 150UL, 250UL, 3000UL, -5, 5 ) );
+   const OMT tA( A );
+   const OMT tB( B );
+   const MT  ref( blaze::serial( A * B ) );
+
+   {
+      test_ = "Row-major sparse matrix multiplication (row-major target)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( A * B );
+
+      checkResult( mat, ref );
+
+      mat = A * B;
+
+      checkResult( mat, ref );
+   }
+
+   {
+      test_ = "Row-major sparse matrix multiplication (column-major target)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( A * B );
+
+      checkResult( mat, ref );
+
+      mat = A * B;
+
+      checkResult( mat, ref );
+   }
+
+   {
+      test_ = "Column-major sparse matrix multiplication (row-major target)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( tA * tB );
+
+      checkResult( mat, ref );
+   }
+
+   {
+      test_ = "Column-major sparse matrix multiplication (column-major target)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( tA * tB );
+
+      checkResult( mat, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment of a dense matrix to a sparse matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the SMP assignment of row-major and column-major dense matrices to
+// row-major and column-major compressed and compact matrices. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+inline void SparseTest::testDenseAssign()
+{
+   const MT   ref( blaze::rand<MT>( 250UL, 300UL, 7500UL, 1, 5 ) );
+   const DMT  A  ( ref );
+   const ODMT tA ( ref );
+
+   {
+      test_ = "Row-major dense matrix assignment (row-major CompressedMatrix)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( A );
+
+      checkResult( mat, ref );
+
+      mat = tA;
+
+      checkResult( mat, ref );
+   }
+
+   {
+      test_ = "Row-major dense matrix assignment (column-major CompressedMatrix)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( A );
+
+      checkResult( mat, ref );
+
+      mat = tA;
+
+      checkResult( mat, ref );
+   }
+
+   {
+      test_ = "Row-major dense matrix assignment (row-major CompactMatrix)";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat;
+      mat = A;
+
+      checkResult( mat, ref );
+   }
+
+   {
+      test_ = "Column-major dense matrix assignment (column-major CompactMatrix)";
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat;
+      mat = tA;
+
+      checkResult( mat, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of SMP assignments resulting in a sparse matrix without non-zero elements.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests SMP assignments whose result does not contain any non-zero elements.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void SparseTest::testEmptyResult()
+{
+   const MT  A( 200UL, 150UL );
+   const MT  B( blaze::rand<MT>( 150UL, 250UL, 3000UL, -5, 5 ) );
+   const MT  ref( 200UL, 250UL );
+   const DMT D( 250UL, 300UL, 0 );
+
+   {
+      test_ = "Empty sparse matrix multiplication (row-major CompressedMatrix)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( A * B );
+
+      checkResult( mat, ref );
+   }
+
+   {
+      test_ = "Empty sparse matrix multiplication (column-major CompressedMatrix)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( A * B );
+
+      checkResult( mat, ref );
+   }
+
+   {
+      test_ = "Empty sparse matrix multiplication (row-major CompactMatrix)";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( A * B );
+
+      checkResult( mat, ref );
+   }
+
+   {
+      test_ = "Zero dense matrix assignment (row-major CompressedMatrix)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( D );
+
+      checkResult( mat, MT( 250UL, 300UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment of a sparse matrix multiplication to a CompactMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the SMP assignment of a sparse matrix/sparse matrix multiplication to a
+// CompactMatrix via the conversion constructor and via the assignment operator. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void SparseTest::testCompactMatrix()
+{
+   const MT A( blaze::rand<MT>( 200UL, 150UL, 3000UL, -5, 5 ) );
+   const MT B( blaze::rand<MT>( 150UL, 250UL, 3000UL, -5, 5 ) );
+   const MT ref( blaze::serial( A * B ) );
+
+   {
+      test_ = "Row-major CompactMatrix construction from a sparse matrix multiplication";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( A * B );
+
+      checkResult( mat, ref );
+   }
+
+   {
+      test_ = "Column-major CompactMatrix construction from a sparse matrix multiplication";
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat( A * B );
+
+      checkResult( mat, ref );
+   }
+
+   {
+      test_ = "Row-major CompactMatrix assignment of a sparse matrix multiplication";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat;
+      mat = A * B;
+
+      checkResult( mat, ref );
+
+      mat = A * B;
+
+      checkResult( mat, ref );
+   }
+
+   {
+      test_ = "Column-major CompactMatrix assignment of a sparse matrix multiplication";
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat( 200UL, 250UL, 10UL );
+      mat = A * B;
+
+      checkResult( mat, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP compact matrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the SMP assignment, addition assignment, and subtraction assignment of
+// row-major compact matrix/dense vector multiplications, which are evaluated by means of the
+// gather-based kernel. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void SparseTest::testCompactVector()
+{
+   typedef blaze::CompactMatrix<double,blaze::rowMajor,unsigned int>  CMT;
+   typedef blaze::DynamicVector<double,blaze::columnVector>          DVT;
+
+   const CMT A( blaze::rand< blaze::CompressedMatrix<double,blaze::rowMajor> >( 2000UL, 1000UL, 30000UL ) );
+   const DVT x( blaze::rand<DVT>( 1000UL ) );
+   const DVT ref( blaze::serial( A * x ) );
+
+   {
+      test_ = "Row-major CompactMatrix/dense vector multiplication (assignment)";
+
+      DVT y( A * x );
+
+      checkResult( y, ref );
+   }
+
+   {
+      test_ = "Row-major CompactMatrix/dense vector multiplication (addition assignment)";
+
+      DVT y( ref );
+      y += A * x;
+
+      checkResult( y, DVT( 2.0 * ref ) );
+   }
+
+   {
+      test_ = "Row-major CompactMatrix/dense vector multiplication (subtraction assignment)";
+
+      DVT y( 2.0 * ref );
+      y -= A * x;
+
+      checkResult( y, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of concurrent requests for the non-zero balanced partition of a sparse matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the concurrent computation of the cached non-zero balanced partitions of
+// a compressed matrix via several threads that request partitions with different numbers of
+// parts. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void SparseTest::testPartition()
+{
+   test_ = "Concurrent non-zero balanced partitioning";
+
+   const MT A( blaze::rand<MT>( 500UL, 300UL, 10000UL, -5, 5 ) );
+
+   std::vector<int> errors( 8UL, 0 );
+   std::vector<std::thread> threads;
+
+   for( size_t t=0UL; t<errors.size(); ++t ) {
+      threads.emplace_back( [&A,&errors,t]() {
+         for( size_t r=0UL; r<100UL; ++r )
+         {
+            const size_t parts( 1UL + ( t + r ) % 5UL );
+            const blaze::NonZeroPartition& partition( A.partition( parts ) );
+
+            blaze::NonZeroPartition expected;
+            expected.compute( A, parts );
+
+            if( partition.parts() != parts ) {
+               ++errors[t];
+               continue;
+            }
+
+            for( size_t p=0UL; p<parts; ++p ) {
+               if( partition.begin( p ) != expected.begin( p ) || partition.end( p ) != expected.end( p ) )
+                  ++errors[t];
+            }
+         }
+      } );
+   }
+
+   for( std::thread& thread : threads )
+      thread.join();
+
+   for( size_t t=0UL; t<errors.size(); ++t ) {
+      if( errors[t] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid partition detected\n"
+             << " Details:\n"
+             << "   Thread             : " << t << "\n"
+             << "   Number of failures : " << errors[t] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of an SMP assignment.
+//
+// \param result The result of the SMP assignment.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of an SMP assignment to the according serial result. In
+// case the two matrices differ, a \a std::runtime_error exception is thrown.
+*/
+template< typename T1    // Type of the result matrix
+        , typename T2 >  // Type of the expected matrix
+void SparseTest::checkResult( const T1& result, const T2& expected ) const
+{
+   if( result != expected || result.nonZeros() != expected.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect SMP assignment detected\n"
+          << " Details:\n"
+          << "   Number of non-zero elements         : " << result.nonZeros() << "\n"
+          << "   Expected number of non-zero elements: " << expected.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the SMP assignment to sparse matrices.
+//
+// \return void
+*/
+inline void runTest()
+{
+   SparseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SMP sparse matrix assignment test.
+*/
+#define RUN_SMP_SPARSE_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,538 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/ClassTest.h
+//  \brief Header file for the iterative solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Solvers.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/math/typetraits/IsMatrix.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Matrix-free convection-diffusion operator for the iterative solver tests.
+//
+// This class represents the five-point finite difference discretization of a two-dimensional
+// convection-diffusion operator on an \a N by \a N grid. In case the convection is zero, the
+// operator is symmetric positive definite.
+*/
+template< typename Type >  // Data type of the vector elements
+struct ConvectionDiffusion
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the ConvectionDiffusion class template.
+   //
+   // \param N The number of grid points per dimension.
+   // \param convection The convection coefficient.
+   */
+   explicit ConvectionDiffusion( size_t N, double convection )
+      : N_( N )                    // The number of grid points per dimension
+      , c_( convection )           // The convection coefficient
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Applies the operator to the given vector.
+   //
+   // \param x The vector the operator is applied to.
+   // \param y The target vector for the result.
+   // \return void
+   */
+   void operator()( const blaze::DynamicVector<Type>& x, blaze::DynamicVector<Type>& y ) const
+   {
+      y.resize( N_*N_, false );
+
+      for( size_t i=0UL; i<N_; ++i ) {
+         for( size_t j=0UL; j<N_; ++j )
+         {
+            const size_t k( i*N_ + j );
+
+            Type tmp( Type( 4.5 ) * x[k] );
+            if( i > 0UL    ) tmp -= Type( 1.0 + c_ ) * x[k-N_];
+            if( j > 0UL    ) tmp -= Type( 1.0 + c_ ) * x[k-1UL];
+            if( j+1UL < N_ ) tmp -= Type( 1.0 - c_ ) * x[k+1UL];
+            if( i+1UL < N_ ) tmp -= Type( 1.0 - c_ ) * x[k+N_];
+            y[k] = tmp;
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   size_t N_;  //!< The number of grid points per dimension.
+   double c_;  //!< The convection coefficient.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief User-defined preconditioner for the iterative solver tests.
+//
+// This class represents a preconditioner that scales the given vector by the inverse of a
+// constant diagonal. It is used to test the support for user-defined preconditioners.
+*/
+template< typename Type >  // Data type of the vector elements
+struct ScalingPreconditioner
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the ScalingPreconditioner class template.
+   //
+   // \param diagonal The constant diagonal element.
+   */
+   explicit ScalingPreconditioner( double diagonal )
+      : scale_( Type( 1.0 / diagonal ) )  // The scaling factor
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Applies the preconditioner to the given vector.
+   //
+   // \param r The vector the preconditioner is applied to.
+   // \param z The target vector for the result.
+   // \return void
+   */
+   void operator()( const blaze::DynamicVector<Type>& r, blaze::DynamicVector<Type>& z ) const
+   {
+      z = scale_ * r;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Type scale_;  //!< The scaling factor.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the iterative solvers.
+//
+// This class represents a test suite for the iterative solvers cg(), bicgstab() and gmres().
+// Every solver is applied to dense, sparse and adaptor system matrices as well as to a
+// matrix-free operator, with and without preconditioner, and the residual of each computed
+// solution is recomputed explicitly.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Enumerations********************************************************************************
+   //! The tested iterative solvers.
+   enum Solver { cgSolver, bicgstabSolver, gmresSolver };
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testCG          ();
+   void testBiCGSTAB    ();
+   void testGMRES       ();
+   void testDualMult    ();
+   void testSpecialCases();
+   void testFailures    ();
+
+   template< typename Type >
+   void runSystemTests( Solver solver, size_t N, double convection, double tolerance );
+
+   template< typename Type, typename OP, typename PT >
+   void runSolverTest( Solver solver, const OP& A, const PT& M, size_t n, double tolerance );
+
+   template< typename OP, typename VT1, typename VT2, typename PT >
+   blaze::SolverResult solve( Solver solver, const OP& A, VT1& x, const VT2& b,
+                              const PT& M, const blaze::SolverControl& control );
+
+   template< typename Type >
+   blaze::CompressedMatrix<Type> system( size_t N, double convection );
+
+   template< typename MT, bool SO, typename Type >
+   double residual( const blaze::Matrix<MT,SO>& A, const blaze::DynamicVector<Type>& x,
+                    const blaze::DynamicVector<Type>& b );
+
+   template< typename OP, typename Type >
+   blaze::DisableIf_< blaze::IsMatrix<OP>, double >
+      residual( const OP& A, const blaze::DynamicVector<Type>& x, const blaze::DynamicVector<Type>& b );
+
+   template< typename Type, typename MT >
+   void runDualMultTest( const MT& A );
+
+   const char* name( Solver solver ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the given solver with all tested system matrix types and preconditioners.
+//
+// \param solver The tested solver.
+// \param N The number of grid points per dimension of the test system.
+// \param convection The convection coefficient of the test system.
+// \param tolerance The relative tolerance of the solver.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >  // Data type of the vector elements
+void ClassTest::runSystemTests( Solver solver, size_t N, double convection, double tolerance )
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const size_t n( N*N );
+   const blaze::CompressedMatrix<Type,rowMajor> A( system<Type>( N, convection ) );
+   const blaze::IdentityPreconditioner I;
+
+   runSolverTest<Type>( solver, A, I, n, tolerance );
+   runSolverTest<Type>( solver, A, blaze::JacobiPreconditioner<Type>( A ), n, tolerance );
+   runSolverTest<Type>( solver, A, ScalingPreconditioner<Type>( 4.5 ), n, tolerance );
+
+   const blaze::CompressedMatrix<Type,columnMajor> B( A );
+   runSolverTest<Type>( solver, B, I, n, tolerance );
+   runSolverTest<Type>( solver, B, blaze::JacobiPreconditioner<Type>( B ), n, tolerance );
+
+   const blaze::DynamicMatrix<Type,rowMajor> C( A );
+   runSolverTest<Type>( solver, C, I, n, tolerance );
+   runSolverTest<Type>( solver, C, blaze::JacobiPreconditioner<Type>( C ), n, tolerance );
+
+   const blaze::DynamicMatrix<Type,columnMajor> D( A );
+   runSolverTest<Type>( solver, D, I, n, tolerance );
+
+   const ConvectionDiffusion<Type> op( N, convection );
+   runSolverTest<Type>( solver, op, I, n, tolerance );
+   runSolverTest<Type>( solver, op, blaze::JacobiPreconditioner<Type>(
+      blaze::DynamicVector<Type>( n, Type( 4.5 ) ) ), n, tolerance );
+
+   if( convection == 0.0 ) {
+      const blaze::SymmetricMatrix< blaze::CompressedMatrix<Type,rowMajor> > S( A );
+      runSolverTest<Type>( solver, S, I, n, tolerance );
+      runSolverTest<Type>( solver, S, blaze::JacobiPreconditioner<Type>( S ), n, tolerance );
+
+      const blaze::SymmetricMatrix< blaze::DynamicMatrix<Type,columnMajor> > T( A );
+      runSolverTest<Type>( solver, T, I, n, tolerance );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the given solver with the given system matrix and preconditioner.
+//
+// \param solver The tested solver.
+// \param A The system matrix or matrix-free operator.
+// \param M The preconditioner.
+// \param n The size of the system.
+// \param tolerance The relative tolerance of the solver.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves the given system for a random right-hand side and compares the
+// explicitly recomputed relative residual with the given tolerance. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the vector elements
+        , typename OP    // Type of the system matrix or matrix-free operator
+        , typename PT >  // Type of the preconditioner
+void ClassTest::runSolverTest( Solver solver, const OP& A, const PT& M, size_t n, double tolerance )
+{
+   const blaze::DynamicVector<Type> b( blaze::rand< blaze::DynamicVector<Type> >( n ) );
+   blaze::DynamicVector<Type> x( n, Type() );
+
+   const blaze::SolverResult result( solve( solver, A, x, b, M, blaze::SolverControl( tolerance, 10UL*n ) ) );
+   const double res( residual( A, x, b ) );
+
+   if( !result.converged || result.iterations == 0UL || res > 10.0*tolerance ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solver did not converge\n"
+          << " Details:\n"
+          << "   Solver: " << name( solver ) << "\n"
+          << "   System type:\n"
+          << "     " << typeid( OP ).name() << "\n"
+          << "   Preconditioner type:\n"
+          << "     " << typeid( PT ).name() << "\n"
+          << "   Converged          : " << result.converged << "\n"
+          << "   Iterations         : " << result.iterations << "\n"
+          << "   Estimated residual : " << result.residual << "\n"
+          << "   Recomputed residual: " << res << "\n"
+          << "   Tolerance          : " << tolerance << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dual multiplication with the given matrix.
+//
+// \param A The matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of the multiplyBoth() function with the results of the two
+// separate products \f$ A \cdot x \f$ and \f$ A^T \cdot w \f$. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the vector elements
+        , typename MT >  // Type of the matrix
+void ClassTest::runDualMultTest( const MT& A )
+{
+   const blaze::DynamicVector<Type> x( blaze::rand< blaze::DynamicVector<Type> >( A.columns() ) );
+   const blaze::DynamicVector<Type> w( blaze::rand< blaze::DynamicVector<Type> >( A.rows() ) );
+   const blaze::DynamicVector<Type> yref( A * x );
+   const blaze::DynamicVector<Type> zref( trans( A ) * w );
+
+   blaze::DynamicVector<Type> y, z;
+   blaze::multiplyBoth( A, x, w, y, z );
+
+   if( y.size() != A.rows() || z.size() != A.columns() ||
+       norm( y - yref ) > 1E-10 * ( 1.0 + norm( yref ) ) ||
+       norm( z - zref ) > 1E-10 * ( 1.0 + norm( zref ) ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Dual multiplication failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT ).name() << "\n"
+          << "   Result of A*x:\n" << y << "\n"
+          << "   Expected result:\n" << yref << "\n"
+          << "   Result of trans(A)*w:\n" << z << "\n"
+          << "   Expected result:\n" << zref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given system with the given solver.
+//
+// \param solver The solver to be used.
+// \param A The system matrix or matrix-free operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \param M The preconditioner.
+// \param control The stopping criteria.
+// \return The result of the solver.
+*/
+template< typename OP    // Type of the system matrix or matrix-free operator
+        , typename VT1   // Type of the solution vector
+        , typename VT2   // Type of the right-hand side vector
+        , typename PT >  // Type of the preconditioner
+blaze::SolverResult ClassTest::solve( Solver solver, const OP& A, VT1& x, const VT2& b,
+                                      const PT& M, const blaze::SolverControl& control )
+{
+   switch( solver ) {
+      case cgSolver      : return blaze::cg      ( A, x, b, M, control );
+      case bicgstabSolver: return blaze::bicgstab( A, x, b, M, control );
+      default            : return blaze::gmres   ( A, x, b, M, control );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of the system matrix of a two-dimensional convection-diffusion problem.
+//
+// \param N The number of grid points per dimension.
+// \param convection The convection coefficient.
+// \return The row-major sparse system matrix.
+//
+// The resulting matrix corresponds to the ConvectionDiffusion operator.
+*/
+template< typename Type >  // Data type of the matrix elements
+blaze::CompressedMatrix<Type> ClassTest::system( size_t N, double convection )
+{
+   const size_t n( N*N );
+
+   blaze::CompressedMatrix<Type> A( n, n );
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j )
+      {
+         const size_t k( i*N + j );
+
+         if( i > 0UL   ) A.append( k, k-N  , Type( -1.0 - convection ) );
+         if( j > 0UL   ) A.append( k, k-1UL, Type( -1.0 - convection ) );
+         A.append( k, k, Type( 4.5 ) );
+         if( j+1UL < N ) A.append( k, k+1UL, Type( -1.0 + convection ) );
+         if( i+1UL < N ) A.append( k, k+N  , Type( -1.0 + convection ) );
+         A.finalize( k );
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the relative residual of the given solution.
+//
+// \param A The system matrix.
+// \param x The solution vector.
+// \param b The right-hand side vector.
+// \return The relative residual \f$ \|b - A \cdot x\| / \|b\| \f$.
+*/
+template< typename MT      // Type of the system matrix
+        , bool SO          // Storage order of the system matrix
+        , typename Type >  // Data type of the vector elements
+double ClassTest::residual( const blaze::Matrix<MT,SO>& A, const blaze::DynamicVector<Type>& x,
+                            const blaze::DynamicVector<Type>& b )
+{
+   const blaze::DynamicVector<Type> r( b - (~A) * x );
+   return double( blaze::norm( r ) / blaze::norm( b ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the relative residual of the given solution.
+//
+// \param A The matrix-free operator.
+// \param x The solution vector.
+// \param b The right-hand side vector.
+// \return The relative residual \f$ \|b - A \cdot x\| / \|b\| \f$.
+*/
+template< typename OP      // Type of the matrix-free operator
+        , typename Type >  // Data type of the vector elements
+blaze::DisableIf_< blaze::IsMatrix<OP>, double >
+   ClassTest::residual( const OP& A, const blaze::DynamicVector<Type>& x, const blaze::DynamicVector<Type>& b )
+{
+   blaze::DynamicVector<Type> r( b.size() );
+   A( x, r );
+   r = b - r;
+   return double( blaze::norm( r ) / blaze::norm( b ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the iterative solvers.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the iterative solver test.
+*/
+#define RUN_SOLVERS_CLASS_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,387 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/staticmatrixbatch/ClassTest.h
+//  \brief Header file for the StaticMatrixBatch class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_STATICMATRIXBATCH_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_STATICMATRIXBATCH_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticMatrixBatch.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace staticmatrixbatch {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the StaticMatrixBatch class template.
+//
+// This class represents a test suite for the StaticMatrixBatch and StaticVectorBatch class
+// templates and the according batched kernels. Every batched result is compared to the result
+// of the according operation on the individual matrices.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testAccess       ();
+   void testMultiplication();
+   void testDeterminant  ();
+   void testInversion    ();
+   void testLLH          ();
+   void testFailures     ();
+
+   template< typename Type, size_t M, size_t K, size_t N >
+   void runMultTest( size_t n );
+
+   template< typename Type, size_t N >
+   void runDetTest( size_t n );
+
+   template< typename Type, size_t N >
+   void runInvTest( size_t n );
+
+   template< typename Type, size_t N >
+   void runLLHTest( size_t n );
+
+   template< typename Type, size_t N >
+   void randomize( blaze::StaticMatrixBatch<Type,N,N>& A );
+
+   template< typename Type, typename MT1, typename MT2 >
+   void checkMatrix( size_t k, const MT1& result, const MT2& expected );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Batched multiplication test with random matrices and vectors.
+//
+// \param n The number of matrices of the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched matrix/matrix and matrix/vector multiplications with \a n
+// random matrices and vectors. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N >     // Number of columns of the right-hand side matrices
+void ClassTest::runMultTest( size_t n )
+{
+   blaze::StaticMatrixBatch<Type,M,K> A( n );
+   blaze::StaticMatrixBatch<Type,K,N> B( n );
+   blaze::StaticVectorBatch<Type,K> x( n );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      A.set( k, blaze::rand< blaze::StaticMatrix<Type,M,K> >( Type(-1), Type(1) ) );
+      B.set( k, blaze::rand< blaze::StaticMatrix<Type,K,N> >( Type(-1), Type(1) ) );
+      x.set( k, blaze::rand< blaze::StaticVector<Type,K> >( Type(-1), Type(1) ) );
+   }
+
+   const blaze::StaticMatrixBatch<Type,M,N> C( A * B );
+   const blaze::StaticVectorBatch<Type,M> y( A * x );
+
+   if( C.size() != n || y.size() != n ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid batch size detected\n"
+          << " Details:\n"
+          << "   Expected size: " << n << "\n"
+          << "   Result sizes : " << C.size() << " and " << y.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t k=0UL; k<n; ++k ) {
+      checkMatrix<Type>( k, C.get(k), A.get(k) * B.get(k) );
+      checkMatrix<Type>( k, y.get(k), A.get(k) * x.get(k) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched determinant test with random matrices.
+//
+// \param n The number of matrices of the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of rows and columns of the matrices
+void ClassTest::runDetTest( size_t n )
+{
+   blaze::StaticMatrixBatch<Type,N,N> A( n );
+   randomize( A );
+
+   const blaze::DynamicVector<Type> d( det( A ) );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      const blaze::StaticMatrix<double,N,N> Ak( A.get(k) );
+      checkMatrix<Type>( k, blaze::StaticVector<double,1UL>( d[k] ),
+                            blaze::StaticVector<double,1UL>( det( Ak ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched inversion test with random matrices.
+//
+// \param n The number of matrices of the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of rows and columns of the matrices
+void ClassTest::runInvTest( size_t n )
+{
+   blaze::StaticMatrixBatch<Type,N,N> A( n );
+   randomize( A );
+
+   blaze::StaticMatrixBatch<Type,N,N> B( A );
+   invert( B );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      const blaze::StaticMatrix<double,N,N> Ak( A.get(k) );
+      const blaze::StaticMatrix<double,N,N> Bk( B.get(k) );
+      checkMatrix<Type>( k, Bk, inv( Ak ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched Cholesky decomposition test with random positive definite matrices.
+//
+// \param n The number of matrices of the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of rows and columns of the matrices
+void ClassTest::runLLHTest( size_t n )
+{
+   blaze::StaticMatrixBatch<Type,N,N> A( n ), L;
+   randomize( A );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      const blaze::StaticMatrix<Type,N,N> Ak( A.get(k) );
+      A.set( k, Ak * trans( Ak ) );
+   }
+
+   llh( A, L );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      const blaze::StaticMatrix<double,N,N> Ak( A.get(k) );
+      const blaze::StaticMatrix<double,N,N> Lk( L.get(k) );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         for( size_t j=i+1UL; j<N; ++j ) {
+            if( Lk(i,j) != 0.0 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Non-lower triangular Cholesky factor detected\n"
+                   << " Details:\n"
+                   << "   Element type:\n"
+                   << "     " << typeid( Type ).name() << "\n"
+                   << "   Matrix index: " << k << "\n"
+                   << "   Result:\n" << Lk << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      checkMatrix<Type>( k, Lk * trans( Lk ), Ak );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a batch with random, well-conditioned matrices.
+//
+// \param A The batch to be initialized.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of rows and columns of the matrices
+void ClassTest::randomize( blaze::StaticMatrixBatch<Type,N,N>& A )
+{
+   for( size_t k=0UL; k<A.size(); ++k ) {
+      blaze::StaticMatrix<Type,N,N> Ak( blaze::rand< blaze::StaticMatrix<Type,N,N> >( Type(-1), Type(1) ) );
+      for( size_t i=0UL; i<N; ++i ) {
+         Ak(i,i) += Type(N);
+      }
+      A.set( k, Ak );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a batched result with the expected result.
+//
+// \param k The index of the compared matrix within the batch.
+// \param result The batched result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the two given matrices (or vectors) with a tolerance based on the
+// precision of the given data type. In case the results differ, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type   // Data type of the batch elements
+        , typename MT1    // Type of the batched result
+        , typename MT2 >  // Type of the expected result
+void ClassTest::checkMatrix( size_t k, const MT1& result, const MT2& expected )
+{
+   const double tolerance( 1E3 * std::max<double>( std::numeric_limits<Type>::epsilon(),
+                                                   std::numeric_limits<double>::epsilon() ) );
+
+   if( max( abs( result - expected ) ) > tolerance * ( 1.0 + max( abs( expected ) ) ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Batched result differs from the expected result\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Matrix index: " << k << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the StaticMatrixBatch class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the StaticMatrixBatch class test.
+*/
+#define RUN_STATICMATRIXBATCH_CLASS_TEST \
+   blazetest::mathtest::staticmatrixbatch::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace staticmatrixbatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
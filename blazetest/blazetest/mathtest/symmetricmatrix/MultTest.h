@@ -0,0 +1,373 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/symmetricmatrix/MultTest.h
+//  \brief Header file for the SymmetricMatrix multiplication test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SYMMETRICMATRIX_MULTTEST_H_
+#define _BLAZETEST_MATHTEST_SYMMETRICMATRIX_MULTTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace symmetricmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the multiplication tests of the SymmetricMatrix class template.
+//
+// This class represents a test suite for the multiplication of symmetric matrices with dense
+// vectors and dense matrices. The matrix sizes are chosen such that both the default kernels
+// and the symmetric kernels, which read only one triangle of the symmetric matrix, are used.
+// All results are compared to the results of the same operations on a general matrix.
+*/
+class MultTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit MultTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testDenseMultiplication ();
+   void testSparseMultiplication();
+
+   template< typename ST, typename MT >
+   void runDenseTests( size_t n );
+
+   template< typename ST, typename MT >
+   void runSparseTests( size_t n, size_t nonzeros );
+
+   template< typename MT1, typename MT2 >
+   void checkMatrix( const MT1& result, const MT2& ref );
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& result, const VT2& ref );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of all products of the given dense symmetric matrix type.
+//
+// \param n The number of rows and columns of the tested matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function initializes a random symmetric matrix of type \a ST and compares the results of
+// matrix/vector, vector/matrix and matrix/matrix products (including the addition and subtraction
+// assignment and the scaled products) with the results computed by means of the general matrix
+// type \a MT. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename ST    // Type of the symmetric matrix
+        , typename MT >  // Type of the general reference matrix
+void MultTest::runDenseTests( size_t n )
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::columnVector;
+   using blaze::rowVector;
+
+   typedef blaze::ElementType_<ST>  Type;
+
+   ST S( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<=i; ++j ) {
+         S(i,j) = blaze::rand<Type>( -1, 1 );
+      }
+   }
+
+   const MT ref( S );
+
+   // Matrix/vector products
+   {
+      const blaze::DynamicVector<Type,columnVector> x( blaze::rand< blaze::DynamicVector<Type,columnVector> >( n ) );
+      blaze::DynamicVector<Type,columnVector> y( n ), z( n );
+
+      y = S * x;  z = ref * x;
+      checkVector( y, z );
+
+      y += S * x;  z += ref * x;
+      checkVector( y, z );
+
+      y -= Type(3) * ( S * x );  z -= Type(3) * ( ref * x );
+      checkVector( y, z );
+
+      y = ( S * x ) * Type(2);  z = ( ref * x ) * Type(2);
+      checkVector( y, z );
+   }
+
+   // Vector/matrix products
+   {
+      const blaze::DynamicVector<Type,rowVector> x( blaze::rand< blaze::DynamicVector<Type,rowVector> >( n ) );
+      blaze::DynamicVector<Type,rowVector> y( n ), z( n );
+
+      y = x * S;  z = x * ref;
+      checkVector( y, z );
+
+      y += Type(2) * ( x * S );  z += Type(2) * ( x * ref );
+      checkVector( y, z );
+
+      y -= x * S;  z -= x * ref;
+      checkVector( y, z );
+   }
+
+   // Matrix/matrix products
+   {
+      const blaze::DynamicMatrix<Type,rowMajor> B( blaze::rand< blaze::DynamicMatrix<Type,rowMajor> >( n, 5UL ) );
+      const blaze::DynamicMatrix<Type,columnMajor> C( blaze::rand< blaze::DynamicMatrix<Type,columnMajor> >( n, 3UL ) );
+      blaze::DynamicMatrix<Type,rowMajor> D, E;
+      blaze::DynamicMatrix<Type,columnMajor> F, G;
+
+      D = S * B;  E = ref * B;
+      checkMatrix( D, E );
+
+      D += Type(2) * ( S * B );  E += Type(2) * ( ref * B );
+      checkMatrix( D, E );
+
+      D -= S * B;  E -= ref * B;
+      checkMatrix( D, E );
+
+      F = S * C;  G = ref * C;
+      checkMatrix( F, G );
+
+      F -= ( S * C ) * Type(3);  G -= ( ref * C ) * Type(3);
+      checkMatrix( F, G );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the matrix/vector products of the given sparse symmetric matrix type.
+//
+// \param n The number of rows and columns of the tested matrix.
+// \param nonzeros The number of random off-diagonal non-zero elements per row.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function initializes a random sparse symmetric matrix of type \a ST and compares the
+// results of matrix/vector products with the results computed by means of the general matrix
+// type \a MT. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename ST    // Type of the symmetric matrix
+        , typename MT >  // Type of the general reference matrix
+void MultTest::runSparseTests( size_t n, size_t nonzeros )
+{
+   using blaze::columnVector;
+
+   typedef blaze::ElementType_<ST>  Type;
+
+   ST S( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t k=0UL; k<nonzeros; ++k ) {
+         S(i,blaze::rand<size_t>( 0UL, n-1UL )) = blaze::rand<Type>( -1, 1 );
+      }
+   }
+
+   const MT ref( S );
+
+   const blaze::DynamicVector<Type,columnVector> x( blaze::rand< blaze::DynamicVector<Type,columnVector> >( n ) );
+   blaze::DynamicVector<Type,columnVector> y( n ), z( n );
+
+   y = S * x;  z = ref * x;
+   checkVector( y, z );
+
+   y += S * x;  z += ref * x;
+   checkVector( y, z );
+
+   y -= S * x;  z -= ref * x;
+   checkVector( y, z );
+
+   y = S * y;  z = ref * z;
+   checkVector( y, z );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a computed matrix with the reference result.
+//
+// \param result The computed matrix.
+// \param ref The reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the computed matrix
+        , typename MT2 >  // Type of the reference result
+void MultTest::checkMatrix( const MT1& result, const MT2& ref )
+{
+   const double tolerance( 1E4 * std::numeric_limits< blaze::ElementType_<MT1> >::epsilon() );
+   const double scale( 1.0 + blaze::max( blaze::abs( ref ) ) );
+
+   if( result.rows() != ref.rows() || result.columns() != ref.columns() ||
+       blaze::max( blaze::abs( result - ref ) ) > tolerance * scale ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect matrix result\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a computed vector with the reference result.
+//
+// \param result The computed vector.
+// \param ref The reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename VT1    // Type of the computed vector
+        , typename VT2 >  // Type of the reference result
+void MultTest::checkVector( const VT1& result, const VT2& ref )
+{
+   const double tolerance( 1E4 * std::numeric_limits< blaze::ElementType_<VT1> >::epsilon() );
+   const double scale( 1.0 + blaze::max( blaze::abs( ref ) ) );
+
+   if( result.size() != ref.size() ||
+       blaze::max( blaze::abs( result - ref ) ) > tolerance * scale ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect vector result\n"
+          << " Details:\n"
+          << "   Vector type:\n"
+          << "     " << typeid( VT1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the multiplication of symmetric matrices.
+//
+// \return void
+*/
+void runTest()
+{
+   MultTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SymmetricMatrix multiplication test.
+*/
+#define RUN_SYMMETRICMATRIX_MULT_TEST \
+   blazetest::mathtest::symmetricmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace symmetricmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
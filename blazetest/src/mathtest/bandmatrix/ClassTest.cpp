@@ -0,0 +1,454 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/bandmatrix/ClassTest.cpp
+//  \brief Source file for the BandMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/bandmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace bandmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BandMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testStorage();
+   testElementAccess();
+   testBandView();
+   testMultiplication();
+   testAddition();
+   testSolvers();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the memory footprint of the BandMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that a BandMatrix only stores the elements of its diagonals. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testStorage()
+{
+   test_ = "BandMatrix storage";
+
+   const blaze::BandMatrix<double,blaze::rowMajor> T( 100UL, 100UL, 1UL, 1UL );
+   const blaze::BandMatrix<float,blaze::columnMajor> P( 50UL, 50UL, 2UL, 2UL );
+
+   if( T.rows() != 100UL || T.columns() != 100UL || T.capacity() < 298UL || T.capacity() > 300UL ||
+       P.rows() != 50UL || P.columns() != 50UL || P.capacity() < 244UL || P.capacity() > 250UL ||
+       T.lowerBandwidth() != 1UL || T.upperBandwidth() != 1UL ||
+       P.lowerBandwidth() != 2UL || P.upperBandwidth() != 2UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid band storage\n"
+          << " Details:\n"
+          << "   Capacity of 100x100 tridiagonal matrix: " << T.capacity() << " (expected 298 to 300)\n"
+          << "   Capacity of 50x50 pentadiagonal matrix: " << P.capacity() << " (expected 244 to 250)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element access to band matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the elements within the band can be freely accessed, that the
+// elements outside of the band are zero and that writing a non-zero value outside of the band
+// fails. Additionally, it checks that the bandwidths are deduced from an assigned dense matrix.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testElementAccess()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "BandMatrix element access";
+
+   {
+      blaze::BandMatrix<int,rowMajor> A( 4UL, 5UL, 1UL, 2UL );
+      A(0,0) = 1;
+      A(0,2) = 2;
+      A(1,0) = 3;
+      A(3,4) = 4;
+      A(2,1) += 5;
+      A(3,0) = 0;
+
+      if( A(0,0) != 1 || A(0,2) != 2 || A(1,0) != 3 || A(3,4) != 4 || A(2,1) != 5 ||
+          A(3,0) != 0 || A(0,3) != 0 || A.nonZeros() != 5UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access to row-major band matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::BandMatrix<double,columnMajor> A( 5UL, 5UL, 2UL, 0UL );
+      A(4,2) = 1.0;
+
+      try {
+         A(0,1) = 1.0;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to element outside of the band succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( A(4,2) != 1.0 || A(0,1) != 0.0 || A(4,1) != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access to column-major band matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      const blaze::DynamicMatrix<double,rowMajor> B{ { 1.0, 2.0, 0.0 },
+                                                     { 4.0, 5.0, 6.0 },
+                                                     { 7.0, 8.0, 9.0 } };
+
+      blaze::BandMatrix<double,rowMajor> A( 3UL, 3UL, 0UL, 0UL );
+      A = B;
+      checkMatrix( A, B, 0.0 );
+
+      if( A.lowerBandwidth() != 2UL || A.upperBandwidth() != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid bandwidth after assignment of dense matrix\n"
+             << " Details:\n"
+             << "   Lower bandwidth: " << A.lowerBandwidth() << " (expected 2)\n"
+             << "   Upper bandwidth: " << A.upperBandwidth() << " (expected 1)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Band view on dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the read and write access to the diagonals of a row-major and a
+// column-major dense matrix via the Band view. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testBandView()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::columnVector;
+
+   test_ = "Band view";
+
+   {
+      blaze::DynamicMatrix<int,rowMajor> A{ { 1, 2, 3, 4 },
+                                            { 5, 6, 7, 8 },
+                                            { 9, 10, 11, 12 } };
+
+      const blaze::DynamicVector<int,columnVector> sub{ 5, 10 };
+      const blaze::DynamicVector<int,columnVector> super{ 3, 8 };
+
+      if( blaze::band( A, -1L ) != sub || blaze::band( A, 2L ) != super ||
+          blaze::band( A, 0L ).size() != 3UL || blaze::band( A, 3L ).size() != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Read access to band of row-major matrix failed\n"
+             << " Details:\n"
+             << "   Band -1:\n" << blaze::band( A, -1L ) << "\n"
+             << "   Band 2:\n" << blaze::band( A, 2L ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::band( A, 1L ) = blaze::band( A, 0L );
+      blaze::band( A, -2L ) *= 2;
+
+      const blaze::DynamicMatrix<int,rowMajor> ref{ { 1, 1, 3, 4 },
+                                                    { 5, 6, 6, 8 },
+                                                    { 18, 10, 11, 11 } };
+      checkMatrix( A, ref, 0.0 );
+   }
+
+   {
+      blaze::DynamicMatrix<double,columnMajor> A( 4UL, 4UL, 0.0 );
+      blaze::band( A, 0L ) = 2.0;
+      blaze::band( A, -1L ) = { -1.0, -1.0, -1.0 };
+      blaze::band( A, 1L ) -= blaze::DynamicVector<double,columnVector>( 3UL, 1.0 );
+
+      const blaze::DynamicMatrix<double,columnMajor> ref{ {  2.0, -1.0,  0.0,  0.0 },
+                                                          { -1.0,  2.0, -1.0,  0.0 },
+                                                          {  0.0, -1.0,  2.0, -1.0 },
+                                                          {  0.0,  0.0, -1.0,  2.0 } };
+      checkMatrix( A, ref, 0.0 );
+
+      blaze::BandMatrix<double,rowMajor> B( A );
+      checkMatrix( B, ref, 0.0 );
+
+      if( B.lowerBandwidth() != 1UL || B.upperBandwidth() != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid bandwidth of band matrix copied from dense matrix\n"
+             << " Details:\n"
+             << "   Lower bandwidth: " << B.lowerBandwidth() << " (expected 1)\n"
+             << "   Upper bandwidth: " << B.upperBandwidth() << " (expected 1)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   try {
+      blaze::DynamicMatrix<double,rowMajor> A( 3UL, 4UL );
+      blaze::band( A, -3L );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setup of out-of-bounds band succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication with band matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the band kernels of the matrix/vector, vector/matrix, matrix/matrix and
+// band/band multiplications for both storage orders and various bandwidths. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "BandMatrix multiplication";
+
+   for( size_t n=1UL; n<=67UL; n+=11UL )
+   {
+      runMultTests<rowMajor   >( n, n, 1UL, 1UL );
+      runMultTests<columnMajor>( n, n, 1UL, 1UL );
+      runMultTests<rowMajor   >( n, n, 2UL, 2UL );
+      runMultTests<columnMajor>( n, n, 2UL, 2UL );
+      runMultTests<rowMajor   >( n, n+3UL, 0UL, 3UL );
+      runMultTests<columnMajor>( n+3UL, n, 3UL, 1UL );
+   }
+
+   runMultTests<rowMajor   >( 300UL, 300UL, 2UL, 2UL );
+   runMultTests<columnMajor>( 300UL, 300UL, 5UL, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the addition and subtraction of band matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the addition and subtraction of band matrices with the same and with
+// different bandwidths and storage orders. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddition()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "BandMatrix addition";
+
+   const blaze::BandMatrix<double,rowMajor> A( blaze::rand< blaze::BandMatrix<double,rowMajor> >( 40UL, 40UL, 1UL, 1UL, -1.0, 1.0 ) );
+   const blaze::BandMatrix<double,rowMajor> B( blaze::rand< blaze::BandMatrix<double,rowMajor> >( 40UL, 40UL, 3UL, 0UL, -1.0, 1.0 ) );
+   const blaze::BandMatrix<double,columnMajor> C( blaze::rand< blaze::BandMatrix<double,columnMajor> >( 40UL, 40UL, 0UL, 2UL, -1.0, 1.0 ) );
+
+   const blaze::DynamicMatrix<double,rowMajor> refA( A ), refB( B ), refC( C );
+
+   {
+      blaze::BandMatrix<double,rowMajor> D( A + B );
+      checkMatrix( D, refA + refB, 1E-12 );
+
+      if( D.lowerBandwidth() != 3UL || D.upperBandwidth() != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid bandwidth of band matrix sum\n"
+             << " Details:\n"
+             << "   Lower bandwidth: " << D.lowerBandwidth() << " (expected 3)\n"
+             << "   Upper bandwidth: " << D.upperBandwidth() << " (expected 1)\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      D -= A;
+      checkMatrix( D, refB, 1E-12 );
+   }
+
+   {
+      blaze::BandMatrix<double,columnMajor> D( A - C );
+      checkMatrix( D, refA - refC, 1E-12 );
+
+      D += 2.0 * C;
+      checkMatrix( D, refA + refC, 1E-12 );
+   }
+
+   {
+      blaze::DynamicMatrix<double,rowMajor> D( A + C ), E( refA + refC );
+      checkMatrix( D, E, 1E-12 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the band LU and Cholesky solvers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the gbtrf()/gbtrs() and pbtrf()/pbtrs() functions for both storage
+// orders and various bandwidths. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSolvers()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "BandMatrix solvers";
+
+   for( size_t n=1UL; n<=67UL; n+=11UL )
+   {
+      runSolverTests<rowMajor   >( n, 1UL, 1UL );
+      runSolverTests<columnMajor>( n, 1UL, 1UL );
+      runSolverTests<rowMajor   >( n, 2UL, 1UL );
+      runSolverTests<columnMajor>( n, 1UL, 3UL );
+   }
+
+   runSolverTests<rowMajor   >( 500UL, 2UL, 2UL );
+   runSolverTests<columnMajor>( 500UL, 2UL, 2UL );
+
+   try {
+      blaze::BandMatrix<double,rowMajor> A( 3UL, 3UL, 1UL, 1UL );
+      blaze::band( A, 0L ) = -1.0;
+
+      blaze::pbtrf( A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Cholesky decomposition of indefinite matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos )
+         throw;
+   }
+}
+//*************************************************************************************************
+
+} // namespace bandmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BandMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BANDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BandMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,2222 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/compactmatrix/ClassTest.cpp
+//  \brief Source file for the CompactMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/compactmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compactmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompactMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAddAssign();
+   testSubAssign();
+   testScaling();
+   testFunctionCall();
+   testIterator();
+   testInsert();
+   testAppend();
+   testErase();
+   testResize();
+   testReserve();
+   testTranspose();
+   testSwap();
+   testFind();
+   testLowerBound();
+   testUpperBound();
+   testIsDefault();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CompactMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the CompactMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Row-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompactMatrix default constructor";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major size constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompactMatrix size constructor (0x0)";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( 0UL, 0UL );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major CompactMatrix size constructor (3x4)";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 0UL );
+   }
+
+   {
+      test_ = "Row-major CompactMatrix size constructor (index type overflow)";
+
+      try {
+         blaze::CompactMatrix<int,blaze::rowMajor,unsigned char> mat( 2UL, 257UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of a matrix exceeding the index range succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      blaze::CompactMatrix<int,blaze::rowMajor,unsigned char> mat( 2UL, 256UL );
+
+      checkRows    ( mat, 2UL   );
+      checkColumns ( mat, 256UL );
+      checkNonZeros( mat, 0UL   );
+   }
+
+
+   //=====================================================================================
+   // Row-major size/capacity constructors
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompactMatrix size/capacity constructor";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( 3UL, 4UL, 5UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 5UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major CompactMatrix size/vector constructor";
+
+      std::vector<size_t> nonzeros( 3UL );
+      nonzeros[0] = 2UL;
+      nonzeros[1] = 1UL;
+      nonzeros[2] = 3UL;
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( 3UL, 4UL, nonzeros );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major copy and move constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompactMatrix copy constructor";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat1( 3UL, 4UL );
+      mat1(0,1) = 1;
+      mat1(2,0) = 2;
+      mat1(2,3) = 3;
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 0UL );
+      checkNonZeros( mat2, 2UL, 2UL );
+
+      if( mat2(0,1) != 1 || mat2(2,0) != 2 || mat2(2,3) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 0 1 0 0 )\n( 0 0 0 0 )\n( 2 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompactMatrix move constructor";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat1( 3UL, 4UL );
+      mat1(0,1) = 1;
+      mat1(2,0) = 2;
+      mat1(2,3) = 3;
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat2( std::move( mat1 ) );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 0UL );
+      checkNonZeros( mat2, 2UL, 2UL );
+
+      if( mat2(0,1) != 1 || mat2(2,0) != 2 || mat2(2,3) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 0 1 0 0 )\n( 0 0 0 0 )\n( 2 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major dense matrix constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major/row-major CompactMatrix dense matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1{ { 0, 1, 0 }, { 0, 0, 0 }, { 2, 0, 3 } };
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 0UL );
+      checkNonZeros( mat2, 2UL, 2UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major/column-major CompactMatrix dense matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat1{ { 0, 1, 0 }, { 0, 0, 0 }, { 2, 0, 3 } };
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompactMatrix lower dense matrix constructor";
+
+      blaze::LowerMatrix< blaze::DynamicMatrix<int,blaze::rowMajor> > mat1( 3UL );
+      mat1(0,0) = 1;
+      mat1(2,0) = 2;
+      mat1(2,2) = 3;
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 0UL );
+      checkNonZeros( mat2, 2UL, 2UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major sparse matrix constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major/row-major CompactMatrix sparse matrix constructor";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 3UL, 4UL );
+      mat1(0,1) = 1;
+      mat1(2,0) = 2;
+      mat1(2,3) = 3;
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 0UL );
+      checkNonZeros( mat2, 2UL, 2UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major/column-major CompactMatrix sparse matrix constructor";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat1( 3UL, 4UL );
+      mat1(0,1) = 1;
+      mat1(2,0) = 2;
+      mat1(2,3) = 3;
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 0UL );
+      checkNonZeros( mat2, 2UL, 2UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major constructors
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompactMatrix default constructor";
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Column-major CompactMatrix size constructor (3x4)";
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat( 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 0UL );
+      checkNonZeros( mat, 3UL, 0UL );
+   }
+
+   {
+      test_ = "Column-major CompactMatrix size constructor (index type overflow)";
+
+      try {
+         blaze::CompactMatrix<int,blaze::columnMajor,unsigned char> mat( 257UL, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of a matrix exceeding the index range succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Column-major/row-major CompactMatrix dense matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1{ { 0, 1, 0, 0 }, { 0, 0, 0, 0 }, { 2, 0, 0, 3 } };
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 1UL );
+      checkNonZeros( mat2, 2UL, 0UL );
+      checkNonZeros( mat2, 3UL, 1UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major/row-major CompactMatrix sparse matrix constructor";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 3UL, 4UL );
+      mat1(0,1) = 1;
+      mat1(2,0) = 2;
+      mat1(2,3) = 3;
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 1UL );
+      checkNonZeros( mat2, 2UL, 0UL );
+      checkNonZeros( mat2, 3UL, 1UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompactMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the CompactMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Row-major copy and move assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompactMatrix copy assignment";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat1( 3UL, 4UL );
+      mat1(0,1) = 1;
+      mat1(2,0) = 2;
+      mat1(2,3) = 3;
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat2( 2UL, 2UL );
+      mat2(1,1) = 4;
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 0UL );
+      checkNonZeros( mat2, 2UL, 2UL );
+
+      if( mat2(0,1) != 1 || mat2(2,0) != 2 || mat2(2,3) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 0 1 0 0 )\n( 0 0 0 0 )\n( 2 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompactMatrix copy assignment stress test";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat1;
+
+      for( size_t i=0UL; i<100UL; ++i )
+      {
+         const size_t rows    ( blaze::rand<size_t>( 0UL, 10UL ) );
+         const size_t columns ( blaze::rand<size_t>( 0UL, 10UL ) );
+         const size_t nonzeros( blaze::rand<size_t>( 0UL, rows*columns ) );
+         const blaze::CompactMatrix<int,blaze::rowMajor> mat2(
+            blaze::rand< blaze::CompressedMatrix<int,blaze::rowMajor> >( rows, columns, nonzeros ) );
+
+         mat1 = mat2;
+
+         if( mat1 != mat2 || !isIntact( mat1 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assignment failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat1 << "\n"
+                << "   Expected result:\n" << mat2 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major CompactMatrix move assignment";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat1( 3UL, 4UL );
+      mat1(0,1) = 1;
+      mat1(2,0) = 2;
+      mat1(2,3) = 3;
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat2( 2UL, 2UL );
+      mat2(1,1) = 4;
+      mat2 = std::move( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2(0,1) != 1 || mat2(2,0) != 2 || mat2(2,3) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 0 1 0 0 )\n( 0 0 0 0 )\n( 2 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major dense and sparse matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major/row-major CompactMatrix dense matrix assignment";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1{ { 0, 1, 0, 0 }, { 0, 0, 0, 0 }, { 2, 0, 0, 3 } };
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat2( 5UL, 2UL );
+      mat2(4,1) = 4;
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 0UL );
+      checkNonZeros( mat2, 2UL, 2UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major/column-major CompactMatrix sparse matrix assignment";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat1( 3UL, 4UL );
+      mat1(0,1) = 1;
+      mat1(2,0) = 2;
+      mat1(2,3) = 3;
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat2( 5UL, 2UL );
+      mat2(4,1) = 4;
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 0UL );
+      checkNonZeros( mat2, 2UL, 2UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompactMatrix self-referencing sparse matrix assignment";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( 3UL, 3UL );
+      mat(0,1) = 1;
+      mat(2,0) = 2;
+
+      mat = trans( mat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 2UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 0UL );
+
+      if( mat(1,0) != 1 || mat(0,2) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 2 )\n( 1 0 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompactMatrix copy assignment stress test";
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat1;
+
+      for( size_t i=0UL; i<100UL; ++i )
+      {
+         const size_t rows    ( blaze::rand<size_t>( 0UL, 10UL ) );
+         const size_t columns ( blaze::rand<size_t>( 0UL, 10UL ) );
+         const size_t nonzeros( blaze::rand<size_t>( 0UL, rows*columns ) );
+         const blaze::CompactMatrix<int,blaze::columnMajor> mat2(
+            blaze::rand< blaze::CompressedMatrix<int,blaze::columnMajor> >( rows, columns, nonzeros ) );
+
+         mat1 = mat2;
+
+         if( mat1 != mat2 || !isIntact( mat1 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assignment failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat1 << "\n"
+                << "   Expected result:\n" << mat2 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "Column-major/row-major CompactMatrix sparse matrix assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 3UL, 4UL );
+      mat1(0,1) = 1;
+      mat1(2,0) = 2;
+      mat1(2,3) = 3;
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat2( 5UL, 2UL );
+      mat2(4,1) = 4;
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 1UL );
+      checkNonZeros( mat2, 2UL, 0UL );
+      checkNonZeros( mat2, 3UL, 1UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompactMatrix addition assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition assignment operators of the CompactMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   {
+      test_ = "Row-major/row-major CompactMatrix sparse matrix addition assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 3UL, 4UL );
+      mat1(0,1) =  1;
+      mat1(2,0) =  1;
+      mat1(2,3) =  3;
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat2( 3UL, 4UL );
+      mat2(1,1) = 4;
+      mat2(2,0) = 2;
+
+      mat2 += mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 4UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 1UL );
+      checkNonZeros( mat2, 2UL, 2UL );
+
+      if( mat2(0,1) != 1 || mat2(1,1) != 4 || mat2(2,0) != 3 || mat2(2,3) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 0 1 0 0 )\n( 0 4 0 0 )\n( 3 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major/row-major CompactMatrix dense matrix addition assignment";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1{ { 0, 1, 0, 0 }, { 0, 0, 0, 0 }, { 1, 0, 0, 3 } };
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat2( 3UL, 4UL );
+      mat2(1,1) = 4;
+      mat2(2,0) = 2;
+
+      mat2 += mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 4UL );
+
+      if( mat2(0,1) != 1 || mat2(1,1) != 4 || mat2(2,0) != 3 || mat2(2,3) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 0 1 0 0 )\n( 0 4 0 0 )\n( 3 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompactMatrix subtraction assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subtraction assignment operators of the CompactMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubAssign()
+{
+   {
+      test_ = "Row-major/column-major CompactMatrix sparse matrix subtraction assignment";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat1( 3UL, 4UL );
+      mat1(0,1) = -1;
+      mat1(2,0) = -1;
+      mat1(2,3) = -3;
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat2( 3UL, 4UL );
+      mat2(1,1) = 4;
+      mat2(2,0) = 2;
+
+      mat2 -= mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 4UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 1UL );
+      checkNonZeros( mat2, 2UL, 2UL );
+
+      if( mat2(0,1) != 1 || mat2(1,1) != 4 || mat2(2,0) != 3 || mat2(2,3) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 0 1 0 0 )\n( 0 4 0 0 )\n( 3 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major/column-major CompactMatrix sparse matrix subtraction assignment";
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat1( 3UL, 4UL );
+      mat1(0,1) = -1;
+      mat1(2,0) = -1;
+      mat1(2,3) = -3;
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat2( 3UL, 4UL );
+      mat2(1,1) = 4;
+      mat2(2,0) = 2;
+
+      mat2 -= mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 4UL );
+
+      if( mat2(0,1) != 1 || mat2(1,1) != 4 || mat2(2,0) != 3 || mat2(2,3) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 0 1 0 0 )\n( 0 4 0 0 )\n( 3 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all CompactMatrix (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the CompactMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   {
+      test_ = "Row-major self-scaling (M*=s)";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( 3UL, 3UL );
+      mat(1,2) =  1;
+      mat(2,0) = -2;
+      mat(2,2) =  3;
+
+      mat *= 2;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(1,2) != 2 || mat(2,0) != -4 || mat(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 0 2 )\n( -4 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major self-scaling (M/=s)";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( 3UL, 3UL );
+      mat(1,2) =  2;
+      mat(2,0) = -4;
+      mat(2,2) =  6;
+
+      mat /= 2;
+
+      if( mat(1,2) != 1 || mat(2,0) != -2 || mat(2,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 0 1 )\n( -2 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactMatrix::scale() and CompactMatrix::scaleDiagonal()";
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat( 3UL, 3UL );
+      mat(0,0) =  1;
+      mat(2,0) = -2;
+      mat(2,2) =  3;
+
+      mat.scale( 2 );
+      mat.scaleDiagonal( 3 );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 6 || mat(2,0) != -4 || mat(2,2) != 18 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 6 0 0 )\n( 0 0 0 )\n( -4 0 18 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompactMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the function call operator
+// of the CompactMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   {
+      test_ = "Row-major CompactMatrix::operator()";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( 3UL, 5UL );
+
+      // Writing the element (2,1)
+      mat(2,1) = 1;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 1UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      // Writing the element (0,4) in front of an existing row
+      mat(0,4) = 2;
+
+      // Writing the element (1,3) in between two existing rows
+      mat(1,3) = 3;
+
+      // Writing the element (2,0) at the beginning of the last row
+      mat(2,0) = 4;
+
+      // Adding to the element (1,3) and removing the element (2,1)
+      mat(1,3) += 2;
+      mat(2,1) -= 1;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(0,4) != 2 || mat(1,3) != 5 || mat(2,0) != 4 || mat(2,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 0 2 )\n( 0 0 0 5 0 )\n( 4 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactMatrix::operator()";
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat( 5UL, 3UL );
+
+      mat(1,2) = 1;
+      mat(4,0) = 2;
+      mat(3,1) = 3;
+      mat(0,2) = 4;
+      mat(3,1) += 2;
+      mat(1,2) -= 1;
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(4,0) != 2 || mat(3,1) != 5 || mat(0,2) != 4 || mat(1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 4 )\n( 0 0 0 )\n( 0 0 0 )\n( 0 5 0 )\n( 2 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompactMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the CompactMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   {
+      typedef blaze::CompactMatrix<int,blaze::rowMajor>  MatrixType;
+      typedef MatrixType::Iterator                       Iterator;
+      typedef MatrixType::ConstIterator                  ConstIterator;
+
+      MatrixType mat( 3UL, 3UL );
+      mat(0,1) =  1;
+      mat(1,0) = -2;
+      mat(1,2) = -3;
+      mat(2,1) =  4;
+      mat(2,2) =  5;
+
+      // Testing the Iterator default constructor
+      {
+         test_ = "Row-major Iterator default constructor";
+
+         Iterator it = Iterator();
+
+         if( it != Iterator() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Failed iterator default constructor\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Testing conversion from Iterator to ConstIterator
+      {
+         test_ = "Row-major Iterator/ConstIterator conversion";
+
+         ConstIterator it( begin( mat, 1UL ) );
+
+         if( it == end( mat, 1UL ) || it->value() != -2 || it->index() != 0UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Failed iterator conversion detected\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Counting the number of elements in each row via Iterator and ConstIterator
+      {
+         test_ = "Row-major Iterator subtraction";
+
+         const size_t number1( end( mat, 0UL ) - begin( mat, 0UL ) );
+         const size_t number2( cend( mat, 1UL ) - cbegin( mat, 1UL ) );
+         const size_t number3( end( mat, 2UL ) - begin( mat, 2UL ) );
+
+         if( number1 != 1UL || number2 != 2UL || number3 != 2UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of elements detected\n"
+                << " Details:\n"
+                << "   Number of elements         : " << number1 << " " << number2 << " " << number3 << "\n"
+                << "   Expected number of elements: 1 2 2\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Testing read-only access via ConstIterator
+      {
+         test_ = "Row-major read-only access via ConstIterator";
+
+         ConstIterator it ( cbegin( mat, 2UL ) );
+         ConstIterator end( cend( mat, 2UL ) );
+
+         if( it == end || it->value() != 4 || it->index() != 1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid initial iterator detected\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         ++it;
+
+         if( it == end || it->value() != 5 || it->index() != 2UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator pre-increment failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         it++;
+
+         if( it != end ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator post-increment failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Testing assignment operations via Iterator
+      {
+         test_ = "Row-major assignment operations via Iterator";
+
+         int value = 0;
+
+         for( Iterator it=begin( mat, 1UL ); it!=end( mat, 1UL ); ++it ) {
+            it->value() = value++;
+         }
+
+         for( Iterator it=begin( mat, 2UL ); it!=end( mat, 2UL ); ++it ) {
+            *it += 2;
+            *it *= 3;
+         }
+
+         if( mat(0,1) != 1 || mat(1,0) != 0 || mat(1,2) != 1 || mat(2,1) != 18 || mat(2,2) != 21 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assignment via iterator failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 0 1 0 )\n( 0 0 1 )\n( 0 18 21 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      typedef blaze::CompactMatrix<int,blaze::columnMajor>  MatrixType;
+      typedef MatrixType::ConstIterator                     ConstIterator;
+
+      MatrixType mat( 3UL, 3UL );
+      mat(1,0) =  1;
+      mat(0,1) = -2;
+      mat(2,1) = -3;
+      mat(1,2) =  4;
+
+      test_ = "Column-major read-only access via ConstIterator";
+
+      ConstIterator it ( cbegin( mat, 1UL ) );
+      ConstIterator end( cend( mat, 1UL ) );
+
+      if( end - it != 2 || it->value() != -2 || ( ++it )->index() != 2UL || it->value() != -3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid iterator access detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c insert() member function of the CompactMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c insert() member function of the CompactMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInsert()
+{
+   {
+      test_ = "Row-major CompactMatrix::insert()";
+
+      typedef blaze::CompactMatrix<int,blaze::rowMajor>::Iterator  Iterator;
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( 4UL, 5UL );
+
+      // Inserting elements in arbitrary order
+      mat.insert( 2UL, 3UL, 1 );
+      mat.insert( 2UL, 4UL, 2 );
+      mat.insert( 0UL, 1UL, 3 );
+      mat.insert( 3UL, 0UL, 4 );
+      Iterator pos = mat.insert( 2UL, 0UL, 5 );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 3UL );
+      checkNonZeros( mat, 3UL, 1UL );
+
+      if( pos->value() != 5 || pos->index() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid iterator returned\n"
+             << " Details:\n"
+             << "   Value: " << pos->value() << "\n"
+             << "   Index: " << pos->index() << "\n"
+             << "   Expected value: 5\n"
+             << "   Expected index: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( mat(0,1) != 3 || mat(2,0) != 5 || mat(2,3) != 1 || mat(2,4) != 2 || mat(3,0) != 4 || !isIntact( mat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting an element failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 3 0 0 0 )\n( 0 0 0 0 0 )\n( 5 0 0 1 2 )\n( 4 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Trying to insert an already existing element
+      try {
+         mat.insert( 2UL, 3UL, 6 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting an existing element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 3 0 0 0 )\n( 0 0 0 0 0 )\n( 5 0 0 1 2 )\n( 4 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Column-major CompactMatrix::insert()";
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat( 5UL, 4UL );
+
+      mat.insert( 3UL, 2UL, 1 );
+      mat.insert( 4UL, 2UL, 2 );
+      mat.insert( 1UL, 0UL, 3 );
+      mat.insert( 0UL, 3UL, 4 );
+      mat.insert( 0UL, 2UL, 5 );
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 3UL );
+      checkNonZeros( mat, 3UL, 1UL );
+
+      if( mat(1,0) != 3 || mat(0,2) != 5 || mat(3,2) != 1 || mat(4,2) != 2 || mat(0,3) != 4 || !isIntact( mat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting an element failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 5 4 )\n( 3 0 0 0 )\n( 0 0 0 0 )\n( 0 0 1 0 )\n( 0 0 2 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c append() member function of the CompactMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c append() member function of the CompactMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAppend()
+{
+   {
+      test_ = "Row-major CompactMatrix::append()";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( 4UL, 4UL, 5UL );
+
+      mat.append( 0UL, 0UL, 1 );
+      mat.append( 0UL, 3UL, 2 );
+      mat.finalize( 0UL );
+      mat.finalize( 1UL );
+      mat.append( 2UL, 1UL, 3 );
+      mat.append( 2UL, 2UL, 0, true );
+      mat.finalize( 2UL );
+      mat.append( 3UL, 0UL, 4 );
+      mat.append( 3UL, 2UL, 5 );
+      mat.finalize( 3UL );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 5UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 1UL );
+      checkNonZeros( mat, 3UL, 2UL );
+
+      if( mat(0,0) != 1 || mat(0,3) != 2 || mat(2,1) != 3 || mat(3,0) != 4 || mat(3,2) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Append operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 2 )\n( 0 0 0 0 )\n( 0 3 0 0 )\n( 4 0 5 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactMatrix::append()";
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat( 4UL, 4UL, 5UL );
+
+      mat.append( 0UL, 0UL, 1 );
+      mat.append( 3UL, 0UL, 2 );
+      mat.finalize( 0UL );
+      mat.finalize( 1UL );
+      mat.append( 1UL, 2UL, 3 );
+      mat.finalize( 2UL );
+      mat.append( 0UL, 3UL, 4 );
+      mat.append( 2UL, 3UL, 5 );
+      mat.finalize( 3UL );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 5UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 1UL );
+      checkNonZeros( mat, 3UL, 2UL );
+
+      if( mat(0,0) != 1 || mat(3,0) != 2 || mat(1,2) != 3 || mat(0,3) != 4 || mat(2,3) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Append operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 4 )\n( 0 0 3 0 )\n( 0 0 0 5 )\n( 2 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c erase() member function of the CompactMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c erase() member function of the CompactMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testErase()
+{
+   {
+      test_ = "Row-major CompactMatrix::erase( size_t, size_t )";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( 3UL, 5UL );
+      mat(0,0) = 1;
+      mat(0,2) = 2;
+      mat(1,1) = 3;
+      mat(1,2) = 4;
+      mat(2,0) = 5;
+      mat(2,4) = 6;
+
+      // Erasing the element at (0,0), (1,2) and a non-existing element
+      mat.erase( 0UL, 0UL );
+      mat.erase( 1UL, 2UL );
+      mat.erase( 2UL, 2UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,2) != 2 || mat(1,1) != 3 || mat(2,0) != 5 || mat(2,4) != 6 || !isIntact( mat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Erasing an element failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 2 0 0 )\n( 0 3 0 0 0 )\n( 5 0 0 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompactMatrix::erase( size_t, Iterator )";
+
+      typedef blaze::CompactMatrix<int,blaze::rowMajor>::Iterator  Iterator;
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( 3UL, 5UL );
+      mat(0,0) = 1;
+      mat(0,2) = 2;
+      mat(1,1) = 3;
+      mat(1,2) = 4;
+      mat(2,0) = 5;
+      mat(2,4) = 6;
+
+      Iterator pos = mat.erase( 1UL, mat.find( 1UL, 1UL ) );
+
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 1UL, 1UL );
+
+      if( pos == mat.end( 1UL ) || pos->value() != 4 || pos->index() != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid iterator returned\n"
+             << " Details:\n"
+             << "   Expected value: 4\n"
+             << "   Expected index: 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      pos = mat.erase( 1UL, pos );
+
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 1UL, 0UL );
+
+      if( pos != mat.end( 1UL ) || mat(2,0) != 5 || mat(2,4) != 6 || !isIntact( mat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Erasing an element failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 2 0 0 )\n( 0 0 0 0 0 )\n( 5 0 0 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactMatrix::erase( size_t, Iterator, Iterator )";
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat( 5UL, 3UL );
+      mat(0,0) = 1;
+      mat(2,0) = 2;
+      mat(1,1) = 3;
+      mat(2,1) = 4;
+      mat(4,1) = 5;
+      mat(0,2) = 6;
+
+      mat.erase( 1UL, mat.begin( 1UL ), mat.end( 1UL ) );
+      mat.reset( 0UL );
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 1UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(0,2) != 6 || !isIntact( mat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Erasing a range of elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 6 )\n( 0 0 0 )\n( 0 0 0 )\n( 0 0 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the CompactMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the CompactMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   {
+      test_ = "Row-major CompactMatrix::resize()";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( 3UL, 4UL );
+      mat(0,1) = 1;
+      mat(0,3) = 2;
+      mat(1,2) = 3;
+      mat(2,0) = 4;
+
+      // Shrinking the number of columns
+      mat.resize( 3UL, 2UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 2UL );
+      checkNonZeros( mat, 2UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(0,1) != 1 || mat(2,0) != 4 || !isIntact( mat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 )\n( 0 0 )\n( 4 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Growing the matrix and inserting into the new rows
+      mat.resize( 5UL, 3UL );
+      mat(4,2) = 5;
+      mat(3,1) = 6;
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 3UL, 1UL );
+      checkNonZeros( mat, 4UL, 1UL );
+
+      if( mat(0,1) != 1 || mat(2,0) != 4 || mat(3,1) != 6 || mat(4,2) != 5 || !isIntact( mat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 )\n( 0 0 0 )\n( 4 0 0 )\n( 0 6 0 )\n( 0 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Shrinking the number of rows
+      mat.resize( 2UL, 3UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 1UL );
+
+      // Resizing without preserving the elements
+      mat.resize( 4UL, 4UL, false );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+
+      // Resizing to 0x0
+      mat.resize( 0UL, 0UL );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Column-major CompactMatrix::resize()";
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat( 4UL, 3UL );
+      mat(1,0) = 1;
+      mat(3,0) = 2;
+      mat(2,1) = 3;
+      mat(0,2) = 4;
+
+      mat.resize( 2UL, 4UL );
+      mat(1,3) = 5;
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 1UL );
+      checkNonZeros( mat, 3UL, 1UL );
+
+      if( mat(1,0) != 1 || mat(0,2) != 4 || mat(1,3) != 5 || !isIntact( mat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 4 0 )\n( 1 0 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         blaze::CompactMatrix<int,blaze::columnMajor,unsigned char> mat2( 4UL, 3UL );
+         mat2.resize( 300UL, 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing beyond the index range succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reserve() member functions of the CompactMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reserve() member functions of the CompactMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReserve()
+{
+   {
+      test_ = "Row-major CompactMatrix::reserve()";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( 3UL, 4UL );
+      mat(1,1) = 1;
+
+      mat.reserve( 10UL );
+
+      checkRows    ( mat, 3UL  );
+      checkColumns ( mat, 4UL  );
+      checkCapacity( mat, 10UL );
+      checkNonZeros( mat, 1UL  );
+
+      mat.reserve( 1UL, 4UL );
+      mat.reserve( 2UL, 20UL );
+
+      checkCapacity( mat, 20UL );
+      checkCapacity( mat, 1UL, 4UL  );
+      checkCapacity( mat, 2UL, 20UL );
+
+      if( mat(1,1) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reserving capacity failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 0 )\n( 0 1 0 0 )\n( 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactMatrix::reserve()";
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat( 3UL, 4UL );
+
+      mat.reserve( 10UL );
+
+      checkRows    ( mat, 3UL  );
+      checkColumns ( mat, 4UL  );
+      checkCapacity( mat, 10UL );
+      checkNonZeros( mat, 0UL  );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c transpose() member function of the CompactMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c transpose() member function of the CompactMatrix
+// class template. Additionally, it performs a test of self-transpose via the \c trans()
+// function. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTranspose()
+{
+   {
+      test_ = "Row-major CompactMatrix::transpose()";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( 3UL, 5UL );
+      mat(0,0) = 1;
+      mat(0,2) = 2;
+      mat(0,4) = 3;
+      mat(1,1) = 4;
+      mat(1,3) = 5;
+      mat(2,0) = 6;
+
+      transpose( mat );
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 6UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+      checkNonZeros( mat, 3UL, 1UL );
+      checkNonZeros( mat, 4UL, 1UL );
+
+      if( mat(0,0) != 1 || mat(0,2) != 6 || mat(1,1) != 4 || mat(2,0) != 2 || mat(3,1) != 5 || mat(4,0) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 6 )\n( 0 4 0 )\n( 2 0 0 )\n( 0 5 0 )\n( 3 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactMatrix::transpose()";
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat( 3UL, 5UL );
+      mat(0,0) = 1;
+      mat(0,2) = 2;
+      mat(0,4) = 3;
+      mat(1,1) = 4;
+      mat(1,3) = 5;
+      mat(2,0) = 6;
+
+      transpose( mat );
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 6UL );
+      checkNonZeros( mat, 0UL, 3UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(0,0) != 1 || mat(0,2) != 6 || mat(1,1) != 4 || mat(2,0) != 2 || mat(3,1) != 5 || mat(4,0) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 6 )\n( 0 4 0 )\n( 2 0 0 )\n( 0 5 0 )\n( 3 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the CompactMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the CompactMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   {
+      test_ = "Row-major CompactMatrix swap";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat1( 2UL, 2UL );
+      mat1(0,0) = 1;
+      mat1(1,1) = 2;
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat2( 3UL, 1UL );
+      mat2(2,0) = 3;
+
+      swap( mat1, mat2 );
+
+      checkRows    ( mat1, 3UL );
+      checkColumns ( mat1, 1UL );
+      checkNonZeros( mat1, 1UL );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 2UL );
+      checkNonZeros( mat2, 2UL );
+
+      if( mat1(2,0) != 3 || mat2(0,0) != 1 || mat2(1,1) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Swapping the first matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the CompactMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the CompactMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   {
+      test_ = "Row-major CompactMatrix::find()";
+
+      typedef blaze::CompactMatrix<int,blaze::rowMajor>::ConstIterator  ConstIterator;
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( 8UL, 6UL );
+      mat(1,2) = 1;
+      mat(2,3) = 2;
+      mat(6,5) = 3;
+
+      const blaze::CompactMatrix<int,blaze::rowMajor>& cmat( mat );
+
+      ConstIterator pos = cmat.find( 2UL, 3UL );
+
+      if( pos == cmat.end( 2UL ) || pos->index() != 3UL || pos->value() != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element could not be found\n"
+             << " Details:\n"
+             << "   Required position = (2,3)\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( mat.find( 6UL, 5UL )->value() != 3 || mat.find( 6UL, 4UL ) != mat.end( 6UL ) ||
+          mat.find( 7UL, 5UL ) != mat.end( 7UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid search result\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactMatrix::find()";
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat( 6UL, 8UL );
+      mat(2,1) = 1;
+      mat(3,2) = 2;
+      mat(5,6) = 3;
+
+      if( mat.find( 3UL, 2UL )->value() != 2 || mat.find( 5UL, 6UL )->index() != 5UL ||
+          mat.find( 4UL, 6UL ) != mat.end( 6UL ) || mat.find( 5UL, 7UL ) != mat.end( 7UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid search result\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the CompactMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the CompactMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   {
+      test_ = "Row-major CompactMatrix::lowerBound()";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( 2UL, 6UL );
+      mat(1,2) = 1;
+      mat(1,4) = 2;
+
+      if( mat.lowerBound( 1UL, 0UL )->index() != 2UL || mat.lowerBound( 1UL, 2UL )->index() != 2UL ||
+          mat.lowerBound( 1UL, 3UL )->index() != 4UL || mat.lowerBound( 1UL, 5UL ) != mat.end( 1UL ) ||
+          mat.lowerBound( 0UL, 0UL ) != mat.end( 0UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid lower bound detected\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactMatrix::lowerBound()";
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat( 6UL, 2UL );
+      mat(2,0) = 1;
+      mat(4,0) = 2;
+
+      if( mat.lowerBound( 0UL, 0UL )->index() != 2UL || mat.lowerBound( 3UL, 0UL )->index() != 4UL ||
+          mat.lowerBound( 5UL, 0UL ) != mat.end( 0UL ) || mat.lowerBound( 0UL, 1UL ) != mat.end( 1UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid lower bound detected\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c upperBound() member function of the CompactMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c upperBound() member function of the CompactMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testUpperBound()
+{
+   {
+      test_ = "Row-major CompactMatrix::upperBound()";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat( 2UL, 6UL );
+      mat(1,2) = 1;
+      mat(1,4) = 2;
+
+      if( mat.upperBound( 1UL, 0UL )->index() != 2UL || mat.upperBound( 1UL, 2UL )->index() != 4UL ||
+          mat.upperBound( 1UL, 4UL ) != mat.end( 1UL ) || mat.upperBound( 0UL, 0UL ) != mat.end( 0UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid upper bound detected\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactMatrix::upperBound()";
+
+      blaze::CompactMatrix<int,blaze::columnMajor> mat( 6UL, 2UL );
+      mat(2,0) = 1;
+      mat(4,0) = 2;
+
+      const blaze::CompactMatrix<int,blaze::columnMajor>& cmat( mat );
+
+      if( cmat.upperBound( 2UL, 0UL )->index() != 4UL || cmat.upperBound( 4UL, 0UL ) != cmat.end( 0UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid upper bound detected\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the CompactMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the CompactMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   {
+      test_ = "Row-major isDefault() function";
+
+      blaze::CompactMatrix<int,blaze::rowMajor> mat;
+
+      if( isDefault( mat ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      mat.resize( 2UL, 3UL );
+      mat(0,1) = 1;
+
+      if( isDefault( mat ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      clear( mat );
+
+      if( isDefault( mat ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompactMatrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of a CompactMatrix with a dense vector,
+// which uses a gather-based kernel for row-major matrices of single and double precision
+// elements with 32-bit indices. The results are compared to the results of the according
+// CompressedMatrix multiplications. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   {
+      test_ = "Row-major CompactMatrix/dense vector multiplication (double)";
+
+      for( size_t rows=0UL; rows<30UL; rows+=7UL ) {
+         for( size_t columns=1UL; columns<100UL; columns+=13UL )
+         {
+            const blaze::CompressedMatrix<double,blaze::rowMajor> ref(
+               blaze::rand< blaze::CompressedMatrix<double,blaze::rowMajor> >( rows, columns, rows*columns/3UL ) );
+            const blaze::CompactMatrix<double,blaze::rowMajor> mat( ref );
+            const blaze::DynamicVector<double,blaze::columnVector> vec(
+               blaze::rand< blaze::DynamicVector<double,blaze::columnVector> >( columns ) );
+
+            const blaze::DynamicVector<double,blaze::columnVector> res( mat * vec );
+            const blaze::DynamicVector<double,blaze::columnVector> exp( ref * vec );
+
+            blaze::DynamicVector<double,blaze::columnVector> res2( res );
+            res2 += mat * ( vec + vec );
+            res2 -= ref * vec;
+
+            if( res != exp || res2 != 2.0*exp ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << res << "\n"
+                   << "   Expected result:\n" << exp << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major CompactMatrix/dense vector multiplication (float)";
+
+      for( size_t rows=0UL; rows<30UL; rows+=7UL ) {
+         for( size_t columns=1UL; columns<100UL; columns+=13UL )
+         {
+            const blaze::CompressedMatrix<float,blaze::rowMajor> ref(
+               blaze::rand< blaze::CompressedMatrix<float,blaze::rowMajor> >( rows, columns, rows*columns/3UL ) );
+            const blaze::CompactMatrix<float,blaze::rowMajor> mat( ref );
+            const blaze::DynamicVector<float,blaze::columnVector> vec(
+               blaze::rand< blaze::DynamicVector<float,blaze::columnVector> >( columns ) );
+
+            const blaze::DynamicVector<float,blaze::columnVector> res( mat * vec );
+            const blaze::DynamicVector<float,blaze::columnVector> exp( ref * vec );
+
+            if( res != exp ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << res << "\n"
+                   << "   Expected result:\n" << exp << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Column-major CompactMatrix/dense vector multiplication (int)";
+
+      const blaze::CompressedMatrix<int,blaze::columnMajor> ref(
+         blaze::rand< blaze::CompressedMatrix<int,blaze::columnMajor> >( 25UL, 17UL, 100UL ) );
+      const blaze::CompactMatrix<int,blaze::columnMajor> mat( ref );
+      const blaze::DynamicVector<int,blaze::columnVector> vec(
+         blaze::rand< blaze::DynamicVector<int,blaze::columnVector> >( 17UL ) );
+
+      const blaze::DynamicVector<int,blaze::columnVector> res( mat * vec );
+      const blaze::DynamicVector<int,blaze::columnVector> exp( ref * vec );
+
+      if( res != exp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << exp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace compactmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompactMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_COMPACTMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompactMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
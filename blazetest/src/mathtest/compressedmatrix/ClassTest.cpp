@@ -96,6 +96,8 @@ ClassTest::ClassTest()
    testLowerBound();
    testUpperBound();
    testIsDefault();
+   testPartition();
+   testMultiplication();
 }
 //*************************************************************************************************
 
@@ -11059,6 +11061,263 @@ void ClassTest::testIsDefault()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c partition() member function of the CompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c partition() member function of the CompressedMatrix
+// class template, which returns a non-zero balanced partition of the rows/columns of the matrix.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testPartition()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedMatrix::partition()";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 6UL, 6UL );
+      for( size_t i=0UL; i<6UL; ++i ) {
+         mat(0,i) = 1;
+         mat(i,i) = 2;
+      }
+
+      {
+         const blaze::NonZeroPartition& partition( mat.partition( 3UL ) );
+
+         if( partition.parts() != 3UL ||
+             partition.begin(0UL) != 0UL || partition.end(0UL) != 1UL ||
+             partition.begin(1UL) != 1UL || partition.end(1UL) != 4UL ||
+             partition.begin(2UL) != 4UL || partition.end(2UL) != 6UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid partition\n"
+                << " Details:\n"
+                << "   Number of parts: " << partition.parts() << "\n"
+                << "   Expected parts: [0..1) [1..4) [4..6)\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      for( size_t i=0UL; i<5UL; ++i ) {
+         mat(5,i) = 3;
+      }
+
+      {
+         const blaze::NonZeroPartition& partition( mat.partition( 3UL ) );
+
+         if( partition.parts() != 3UL ||
+             partition.begin(0UL) != 0UL || partition.end(0UL) != 2UL ||
+             partition.begin(1UL) != 2UL || partition.end(1UL) != 5UL ||
+             partition.begin(2UL) != 5UL || partition.end(2UL) != 6UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid partition after modification\n"
+                << " Details:\n"
+                << "   Number of parts: " << partition.parts() << "\n"
+                << "   Expected parts: [0..2) [2..5) [5..6)\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         const blaze::NonZeroPartition& partition( mat.partition( 2UL ) );
+
+         if( partition.parts() != 2UL ||
+             partition.begin(0UL) != 0UL || partition.end(0UL) != 3UL ||
+             partition.begin(1UL) != 3UL || partition.end(1UL) != 6UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid partition for a different number of parts\n"
+                << " Details:\n"
+                << "   Number of parts: " << partition.parts() << "\n"
+                << "   Expected parts: [0..3) [3..6)\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedMatrix::partition()";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 6UL, 6UL );
+      for( size_t i=0UL; i<6UL; ++i ) {
+         mat(i,0) = 1;
+         mat(i,i) = 2;
+      }
+
+      {
+         const blaze::NonZeroPartition& partition( mat.partition( 3UL ) );
+
+         if( partition.parts() != 3UL ||
+             partition.begin(0UL) != 0UL || partition.end(0UL) != 1UL ||
+             partition.begin(1UL) != 1UL || partition.end(1UL) != 4UL ||
+             partition.begin(2UL) != 4UL || partition.end(2UL) != 6UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid partition\n"
+                << " Details:\n"
+                << "   Number of parts: " << partition.parts() << "\n"
+                << "   Expected parts: [0..1) [1..4) [4..6)\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      for( size_t i=0UL; i<5UL; ++i ) {
+         mat(i,5) = 3;
+      }
+
+      {
+         const blaze::NonZeroPartition& partition( mat.partition( 3UL ) );
+
+         if( partition.parts() != 3UL ||
+             partition.begin(0UL) != 0UL || partition.end(0UL) != 2UL ||
+             partition.begin(1UL) != 2UL || partition.end(1UL) != 5UL ||
+             partition.begin(2UL) != 5UL || partition.end(2UL) != 6UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid partition after modification\n"
+                << " Details:\n"
+                << "   Number of parts: " << partition.parts() << "\n"
+                << "   Expected parts: [0..2) [2..5) [5..6)\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         const blaze::NonZeroPartition& partition( mat.partition( 2UL ) );
+
+         if( partition.parts() != 2UL ||
+             partition.begin(0UL) != 0UL || partition.end(0UL) != 3UL ||
+             partition.begin(1UL) != 3UL || partition.end(1UL) != 6UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid partition for a different number of parts\n"
+                << " Details:\n"
+                << "   Number of parts: " << partition.parts() << "\n"
+                << "   Expected parts: [0..3) [3..6)\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of two row-major CompressedMatrix instances.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of two row-major CompressedMatrix
+// instances. The test covers both accumulators of the row-wise multiplication (the dense array
+// for rows with many flops or a narrow column window and the hash table for wide matrices with
+// scattered column indices) and the numeric cancellation of elements. The results are compared
+// to the according dense matrix multiplication. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   {
+      test_ = "Row-major CompressedMatrix multiplication (scattered columns)";
+
+      for( size_t columns=1UL; columns<=20000UL; columns*=10UL )
+      {
+         const blaze::CompressedMatrix<int,blaze::rowMajor> A(
+            blaze::rand< blaze::CompressedMatrix<int,blaze::rowMajor> >( 20UL, 15UL, 60UL ) );
+         const blaze::CompressedMatrix<int,blaze::rowMajor> B(
+            blaze::rand< blaze::CompressedMatrix<int,blaze::rowMajor> >( 15UL, columns, 4UL*columns/3UL ) );
+
+         const blaze::CompressedMatrix<int,blaze::rowMajor> C( A * B );
+         const blaze::DynamicMatrix<int,blaze::rowMajor> ref(
+            blaze::DynamicMatrix<int,blaze::rowMajor>( A ) * blaze::DynamicMatrix<int,blaze::rowMajor>( B ) );
+
+         if( C != ref || C.nonZeros() != nonZeros( ref ) || !isIntact( C ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Number of columns: " << columns << "\n"
+                << "   Result:\n" << C << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major CompressedMatrix multiplication (banded matrices)";
+
+      const size_t n( 50000UL );
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> A( n, n, 3UL*n );
+      for( size_t i=0UL; i<n; ++i ) {
+         if( i > 0UL   ) A.append( i, i-1UL, -1 );
+         A.append( i, i, 2 );
+         if( i+1UL < n ) A.append( i, i+1UL, -1 );
+         A.finalize( i );
+      }
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> C( A * A );
+
+      checkNonZeros( C, 5UL*n - 6UL );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         const int diag( ( i == 0UL || i+1UL == n )?( 5 ):( 6 ) );
+         if( C(i,i) != diag || ( i > 0UL && C(i,i-1UL) != -4 ) || ( i > 1UL && C(i,i-2UL) != 1 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Invalid element in row " << i << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major CompressedMatrix multiplication (numeric cancellation)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> A( 2UL, 2UL );
+      A(0,0) = 1;
+      A(0,1) = 1;
+      A(1,1) = 2;
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> B( 2UL, 10000UL );
+      B(0,1)    =  1;
+      B(1,1)    = -1;
+      B(1,9999) =  3;
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> C( A * B );
+
+      checkRows    ( C, 2UL     );
+      checkColumns ( C, 10000UL );
+      checkNonZeros( C, 3UL     );
+      checkNonZeros( C, 0UL, 1UL );
+      checkNonZeros( C, 1UL, 2UL );
+
+      if( C(0,9999) != 3 || C(1,1) != -2 || C(1,9999) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace compressedmatrix
 
 } // namespace mathtest
@@ -969,7 +969,7 @@ void AlignedPaddedTest::testAssignment()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,aligned,padded,rowMajor>  AlignedPadded;
-      AlignedPadded mat1( blaze::allocate<short>( 32UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedPadded mat1( blaze::allocate<short>( 64UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1(0,0) = 1U;
       mat1(0,1) = 2U;
       mat1(0,2) = 3U;
@@ -1155,7 +1155,7 @@ void AlignedPaddedTest::testAssignment()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,aligned,padded,columnMajor>  AlignedPadded;
-      AlignedPadded mat1( blaze::allocate<short>( 48UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedPadded mat1( blaze::allocate<short>( 96UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1(0,0) = 1;
       mat1(0,1) = 2;
       mat1(0,2) = 3;
@@ -1938,7 +1938,7 @@ void AlignedPaddedTest::testAssignment()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,aligned,padded,rowMajor>  AlignedPadded;
-      AlignedPadded mat1( blaze::allocate<short>( 32UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedPadded mat1( blaze::allocate<short>( 64UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1(0,0) = 1;
       mat1(0,1) = 2;
       mat1(0,2) = 3;
@@ -2128,7 +2128,7 @@ void AlignedPaddedTest::testAssignment()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,aligned,padded,columnMajor>  AlignedPadded;
-      AlignedPadded mat1( blaze::allocate<short>( 48UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedPadded mat1( blaze::allocate<short>( 96UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1(0,0) = 1U;
       mat1(0,1) = 2U;
       mat1(0,2) = 3U;
@@ -2728,7 +2728,7 @@ void AlignedPaddedTest::testAddAssign()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,aligned,padded,rowMajor>  AlignedPadded;
-      AlignedPadded mat1( blaze::allocate<short>( 32UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedPadded mat1( blaze::allocate<short>( 64UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) =  1;
       mat1(0,1) =  2;
@@ -2855,7 +2855,7 @@ void AlignedPaddedTest::testAddAssign()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,aligned,padded,columnMajor>  AlignedPadded;
-      AlignedPadded mat1( blaze::allocate<short>( 48UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedPadded mat1( blaze::allocate<short>( 96UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) =  1;
       mat1(0,1) =  2;
@@ -3328,7 +3328,7 @@ void AlignedPaddedTest::testAddAssign()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,aligned,padded,rowMajor>  AlignedPadded;
-      AlignedPadded mat1( blaze::allocate<short>( 32UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedPadded mat1( blaze::allocate<short>( 64UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) =  1;
       mat1(0,1) =  2;
@@ -3458,7 +3458,7 @@ void AlignedPaddedTest::testAddAssign()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,aligned,padded,columnMajor>  AlignedPadded;
-      AlignedPadded mat1( blaze::allocate<short>( 48UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedPadded mat1( blaze::allocate<short>( 96UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) =  1;
       mat1(0,1) =  2;
@@ -3949,7 +3949,7 @@ void AlignedPaddedTest::testSubAssign()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,aligned,padded,rowMajor>  AlignedPadded;
-      AlignedPadded mat1( blaze::allocate<short>( 32UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedPadded mat1( blaze::allocate<short>( 64UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) = -1;
       mat1(0,1) = -2;
@@ -4076,7 +4076,7 @@ void AlignedPaddedTest::testSubAssign()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,aligned,padded,columnMajor>  AlignedPadded;
-      AlignedPadded mat1( blaze::allocate<short>( 48UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedPadded mat1( blaze::allocate<short>( 96UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) = -1;
       mat1(0,1) = -2;
@@ -4549,7 +4549,7 @@ void AlignedPaddedTest::testSubAssign()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,aligned,padded,rowMajor>  AlignedPadded;
-      AlignedPadded mat1( blaze::allocate<short>( 32UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedPadded mat1( blaze::allocate<short>( 64UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) = -1;
       mat1(0,1) = -2;
@@ -4679,7 +4679,7 @@ void AlignedPaddedTest::testSubAssign()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,aligned,padded,columnMajor>  AlignedPadded;
-      AlignedPadded mat1( blaze::allocate<short>( 48UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedPadded mat1( blaze::allocate<short>( 96UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) = -1;
       mat1(0,1) = -2;
@@ -5170,7 +5170,7 @@ void AlignedPaddedTest::testMultAssign()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,aligned,padded,rowMajor>  AlignedPadded;
-      AlignedPadded mat1( blaze::allocate<short>( 48UL ), 3UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedPadded mat1( blaze::allocate<short>( 96UL ), 3UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,1) = 2;
       mat1(1,0) = 1;
@@ -5309,7 +5309,7 @@ void AlignedPaddedTest::testMultAssign()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,aligned,padded,columnMajor>  AlignedPadded;
-      AlignedPadded mat1( blaze::allocate<short>( 48UL ), 3UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedPadded mat1( blaze::allocate<short>( 96UL ), 3UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,1) = 2;
       mat1(1,0) = 1;
@@ -5538,7 +5538,7 @@ void AlignedPaddedTest::testMultAssign()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,aligned,padded,rowMajor>  AlignedPadded;
-      AlignedPadded mat1( blaze::allocate<short>( 48UL ), 3UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedPadded mat1( blaze::allocate<short>( 96UL ), 3UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,1) = 2;
       mat1(1,0) = 1;
@@ -5677,7 +5677,7 @@ void AlignedPaddedTest::testMultAssign()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,aligned,padded,columnMajor>  AlignedPadded;
-      AlignedPadded mat1( blaze::allocate<short>( 48UL ), 3UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedPadded mat1( blaze::allocate<short>( 96UL ), 3UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,1) = 2;
       mat1(1,0) = 1;
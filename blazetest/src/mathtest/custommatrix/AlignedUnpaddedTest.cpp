@@ -1162,7 +1162,7 @@ void AlignedUnpaddedTest::testAssignment()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,aligned,unpadded,rowMajor>  AlignedUnpadded;
-      AlignedUnpadded mat1( blaze::allocate<short>( 32UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedUnpadded mat1( blaze::allocate<short>( 64UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1(0,0) = 1;
       mat1(0,1) = 2;
       mat1(0,2) = 3;
@@ -1348,7 +1348,7 @@ void AlignedUnpaddedTest::testAssignment()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,aligned,unpadded,columnMajor>  AlignedUnpadded;
-      AlignedUnpadded mat1( blaze::allocate<short>( 48UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedUnpadded mat1( blaze::allocate<short>( 96UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1(0,0) = 1;
       mat1(0,1) = 2;
       mat1(0,2) = 3;
@@ -2131,7 +2131,7 @@ void AlignedUnpaddedTest::testAssignment()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,aligned,unpadded,rowMajor>  AlignedUnpadded;
-      AlignedUnpadded mat1( blaze::allocate<short>( 32UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedUnpadded mat1( blaze::allocate<short>( 64UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1(0,0) = 1;
       mat1(0,1) = 2;
       mat1(0,2) = 3;
@@ -2321,7 +2321,7 @@ void AlignedUnpaddedTest::testAssignment()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,aligned,unpadded,columnMajor>  AlignedUnpadded;
-      AlignedUnpadded mat1( blaze::allocate<short>( 48UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedUnpadded mat1( blaze::allocate<short>( 96UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1(0,0) = 1;
       mat1(0,1) = 2;
       mat1(0,2) = 3;
@@ -2921,7 +2921,7 @@ void AlignedUnpaddedTest::testAddAssign()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,aligned,unpadded,rowMajor>  AlignedUnpadded;
-      AlignedUnpadded mat1( blaze::allocate<short>( 32UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedUnpadded mat1( blaze::allocate<short>( 64UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) =  1;
       mat1(0,1) =  2;
@@ -3048,7 +3048,7 @@ void AlignedUnpaddedTest::testAddAssign()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,aligned,unpadded,columnMajor>  AlignedUnpadded;
-      AlignedUnpadded mat1( blaze::allocate<short>( 48UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedUnpadded mat1( blaze::allocate<short>( 96UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) =  1;
       mat1(0,1) =  2;
@@ -3521,7 +3521,7 @@ void AlignedUnpaddedTest::testAddAssign()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,aligned,unpadded,rowMajor>  AlignedUnpadded;
-      AlignedUnpadded mat1( blaze::allocate<short>( 32UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedUnpadded mat1( blaze::allocate<short>( 64UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) =  1;
       mat1(0,1) =  2;
@@ -3651,7 +3651,7 @@ void AlignedUnpaddedTest::testAddAssign()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,aligned,unpadded,columnMajor>  AlignedUnpadded;
-      AlignedUnpadded mat1( blaze::allocate<short>( 48UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedUnpadded mat1( blaze::allocate<short>( 96UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) =  1;
       mat1(0,1) =  2;
@@ -4142,7 +4142,7 @@ void AlignedUnpaddedTest::testSubAssign()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,aligned,unpadded,rowMajor>  AlignedUnpadded;
-      AlignedUnpadded mat1( blaze::allocate<short>( 32UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedUnpadded mat1( blaze::allocate<short>( 64UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) = -1;
       mat1(0,1) = -2;
@@ -4269,7 +4269,7 @@ void AlignedUnpaddedTest::testSubAssign()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,aligned,unpadded,columnMajor>  AlignedUnpadded;
-      AlignedUnpadded mat1( blaze::allocate<short>( 48UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedUnpadded mat1( blaze::allocate<short>( 96UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) = -1;
       mat1(0,1) = -2;
@@ -4742,7 +4742,7 @@ void AlignedUnpaddedTest::testSubAssign()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,aligned,unpadded,rowMajor>  AlignedUnpadded;
-      AlignedUnpadded mat1( blaze::allocate<short>( 32UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedUnpadded mat1( blaze::allocate<short>( 64UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) = -1;
       mat1(0,1) = -2;
@@ -4872,7 +4872,7 @@ void AlignedUnpaddedTest::testSubAssign()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,aligned,unpadded,columnMajor>  AlignedUnpadded;
-      AlignedUnpadded mat1( blaze::allocate<short>( 48UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedUnpadded mat1( blaze::allocate<short>( 96UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) = -1;
       mat1(0,1) = -2;
@@ -5363,7 +5363,7 @@ void AlignedUnpaddedTest::testMultAssign()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,aligned,unpadded,rowMajor>  AlignedUnpadded;
-      AlignedUnpadded mat1( blaze::allocate<short>( 48UL ), 3UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedUnpadded mat1( blaze::allocate<short>( 96UL ), 3UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,1) = 2;
       mat1(1,0) = 1;
@@ -5502,7 +5502,7 @@ void AlignedUnpaddedTest::testMultAssign()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,aligned,unpadded,columnMajor>  AlignedUnpadded;
-      AlignedUnpadded mat1( blaze::allocate<short>( 48UL ), 3UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedUnpadded mat1( blaze::allocate<short>( 96UL ), 3UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,1) = 2;
       mat1(1,0) = 1;
@@ -5731,7 +5731,7 @@ void AlignedUnpaddedTest::testMultAssign()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,aligned,unpadded,rowMajor>  AlignedUnpadded;
-      AlignedUnpadded mat1( blaze::allocate<short>( 48UL ), 3UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedUnpadded mat1( blaze::allocate<short>( 96UL ), 3UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,1) = 2;
       mat1(1,0) = 1;
@@ -5870,7 +5870,7 @@ void AlignedUnpaddedTest::testMultAssign()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,aligned,unpadded,columnMajor>  AlignedUnpadded;
-      AlignedUnpadded mat1( blaze::allocate<short>( 48UL ), 3UL, 3UL, 16UL, blaze::Deallocate() );
+      AlignedUnpadded mat1( blaze::allocate<short>( 96UL ), 3UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,1) = 2;
       mat1(1,0) = 1;
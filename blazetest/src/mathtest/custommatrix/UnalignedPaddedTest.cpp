@@ -833,7 +833,7 @@ void UnalignedPaddedTest::testAssignment()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,unaligned,padded,rowMajor>  UnalignedPadded;
-      UnalignedPadded mat1( blaze::allocate<short>( 32UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded mat1( blaze::allocate<short>( 64UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1(0,0) = 1;
       mat1(0,1) = 2;
       mat1(0,2) = 3;
@@ -1019,7 +1019,7 @@ void UnalignedPaddedTest::testAssignment()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,unaligned,padded,columnMajor>  UnalignedPadded;
-      UnalignedPadded mat1( blaze::allocate<short>( 48UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded mat1( blaze::allocate<short>( 96UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1(0,0) = 1;
       mat1(0,1) = 2;
       mat1(0,2) = 3;
@@ -1802,7 +1802,7 @@ void UnalignedPaddedTest::testAssignment()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,unaligned,padded,rowMajor>  UnalignedPadded;
-      UnalignedPadded mat1( blaze::allocate<short>( 32UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded mat1( blaze::allocate<short>( 64UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1(0,0) = 1;
       mat1(0,1) = 2;
       mat1(0,2) = 3;
@@ -1992,7 +1992,7 @@ void UnalignedPaddedTest::testAssignment()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,unaligned,padded,columnMajor>  UnalignedPadded;
-      UnalignedPadded mat1( blaze::allocate<short>( 48UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded mat1( blaze::allocate<short>( 96UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1(0,0) = 1;
       mat1(0,1) = 2;
       mat1(0,2) = 3;
@@ -2592,7 +2592,7 @@ void UnalignedPaddedTest::testAddAssign()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,unaligned,padded,rowMajor>  UnalignedPadded;
-      UnalignedPadded mat1( blaze::allocate<short>( 32UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded mat1( blaze::allocate<short>( 64UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) =  1;
       mat1(0,1) =  2;
@@ -2719,7 +2719,7 @@ void UnalignedPaddedTest::testAddAssign()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,unaligned,padded,columnMajor>  UnalignedPadded;
-      UnalignedPadded mat1( blaze::allocate<short>( 48UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded mat1( blaze::allocate<short>( 96UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) =  1;
       mat1(0,1) =  2;
@@ -3192,7 +3192,7 @@ void UnalignedPaddedTest::testAddAssign()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,unaligned,padded,rowMajor>  UnalignedPadded;
-      UnalignedPadded mat1( blaze::allocate<short>( 32UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded mat1( blaze::allocate<short>( 64UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) =  1;
       mat1(0,1) =  2;
@@ -3322,7 +3322,7 @@ void UnalignedPaddedTest::testAddAssign()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,unaligned,padded,columnMajor>  UnalignedPadded;
-      UnalignedPadded mat1( blaze::allocate<short>( 48UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded mat1( blaze::allocate<short>( 96UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) =  1;
       mat1(0,1) =  2;
@@ -3813,7 +3813,7 @@ void UnalignedPaddedTest::testSubAssign()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,unaligned,padded,rowMajor>  UnalignedPadded;
-      UnalignedPadded mat1( blaze::allocate<short>( 32UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded mat1( blaze::allocate<short>( 64UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) = -1;
       mat1(0,1) = -2;
@@ -3940,7 +3940,7 @@ void UnalignedPaddedTest::testSubAssign()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,unaligned,padded,columnMajor>  UnalignedPadded;
-      UnalignedPadded mat1( blaze::allocate<short>( 48UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded mat1( blaze::allocate<short>( 96UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) = -1;
       mat1(0,1) = -2;
@@ -4413,7 +4413,7 @@ void UnalignedPaddedTest::testSubAssign()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,unaligned,padded,rowMajor>  UnalignedPadded;
-      UnalignedPadded mat1( blaze::allocate<short>( 32UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded mat1( blaze::allocate<short>( 64UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) = -1;
       mat1(0,1) = -2;
@@ -4543,7 +4543,7 @@ void UnalignedPaddedTest::testSubAssign()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,unaligned,padded,columnMajor>  UnalignedPadded;
-      UnalignedPadded mat1( blaze::allocate<short>( 48UL ), 2UL, 3UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded mat1( blaze::allocate<short>( 96UL ), 2UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,0) = -1;
       mat1(0,1) = -2;
@@ -5034,7 +5034,7 @@ void UnalignedPaddedTest::testMultAssign()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,unaligned,padded,rowMajor>  UnalignedPadded;
-      UnalignedPadded mat1( blaze::allocate<short>( 48UL ), 3UL, 3UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded mat1( blaze::allocate<short>( 96UL ), 3UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,1) = 2;
       mat1(1,0) = 1;
@@ -5173,7 +5173,7 @@ void UnalignedPaddedTest::testMultAssign()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,unaligned,padded,columnMajor>  UnalignedPadded;
-      UnalignedPadded mat1( blaze::allocate<short>( 48UL ), 3UL, 3UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded mat1( blaze::allocate<short>( 96UL ), 3UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,1) = 2;
       mat1(1,0) = 1;
@@ -5402,7 +5402,7 @@ void UnalignedPaddedTest::testMultAssign()
       using blaze::rowMajor;
 
       typedef blaze::CustomMatrix<short,unaligned,padded,rowMajor>  UnalignedPadded;
-      UnalignedPadded mat1( blaze::allocate<short>( 48UL ), 3UL, 3UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded mat1( blaze::allocate<short>( 96UL ), 3UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,1) = 2;
       mat1(1,0) = 1;
@@ -5541,7 +5541,7 @@ void UnalignedPaddedTest::testMultAssign()
       using blaze::columnMajor;
 
       typedef blaze::CustomMatrix<short,unaligned,padded,columnMajor>  UnalignedPadded;
-      UnalignedPadded mat1( blaze::allocate<short>( 48UL ), 3UL, 3UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded mat1( blaze::allocate<short>( 96UL ), 3UL, 3UL, 32UL, blaze::Deallocate() );
       mat1 = 0;
       mat1(0,1) = 2;
       mat1(1,0) = 1;
@@ -487,7 +487,7 @@ void UnalignedPaddedTest::testAssignment()
       using blaze::rowVector;
 
       typedef blaze::CustomVector<short,unaligned,padded,rowVector>  UnalignedPadded;
-      UnalignedPadded vec1( blaze::allocate<short>( 16UL ), 5UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded vec1( blaze::allocate<short>( 32UL ), 5UL, 32UL, blaze::Deallocate() );
       vec1[0] = 1;
       vec1[1] = 2;
       vec1[2] = 3;
@@ -635,7 +635,7 @@ void UnalignedPaddedTest::testAddAssign()
       using blaze::rowVector;
 
       typedef blaze::CustomVector<short,unaligned,padded,rowVector>  UnalignedPadded;
-      UnalignedPadded vec1( blaze::allocate<short>( 16UL ), 5UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded vec1( blaze::allocate<short>( 32UL ), 5UL, 32UL, blaze::Deallocate() );
       vec1[0] =  1;
       vec1[1] =  0;
       vec1[2] = -2;
@@ -807,7 +807,7 @@ void UnalignedPaddedTest::testSubAssign()
       using blaze::rowVector;
 
       typedef blaze::CustomVector<short,unaligned,padded,rowVector>  UnalignedPadded;
-      UnalignedPadded vec1( blaze::allocate<short>( 16UL ), 5UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded vec1( blaze::allocate<short>( 32UL ), 5UL, 32UL, blaze::Deallocate() );
       vec1[0] = -1;
       vec1[1] =  0;
       vec1[2] =  2;
@@ -979,7 +979,7 @@ void UnalignedPaddedTest::testMultAssign()
       using blaze::rowVector;
 
       typedef blaze::CustomVector<short,unaligned,padded,rowVector>  UnalignedPadded;
-      UnalignedPadded vec1( blaze::allocate<short>( 16UL ), 5UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded vec1( blaze::allocate<short>( 32UL ), 5UL, 32UL, blaze::Deallocate() );
       vec1[0] =  1;
       vec1[1] =  0;
       vec1[2] = -2;
@@ -1151,7 +1151,7 @@ void UnalignedPaddedTest::testDivAssign()
       using blaze::rowVector;
 
       typedef blaze::CustomVector<short,unaligned,padded,rowVector>  UnalignedPadded;
-      UnalignedPadded vec1( blaze::allocate<short>( 16UL ), 5UL, 16UL, blaze::Deallocate() );
+      UnalignedPadded vec1( blaze::allocate<short>( 32UL ), 5UL, 32UL, blaze::Deallocate() );
       vec1[0] =  1;
       vec1[1] =  2;
       vec1[2] = -3;
@@ -0,0 +1,296 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/decomposition/DenseBlockedTest.cpp
+//  \brief Source file for the native blocked dense matrix decomposition test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blazetest/mathtest/decomposition/DenseBlockedTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace decomposition {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DenseBlockedTest test.
+//
+// \exception std::runtime_error Error during decomposition detected.
+*/
+DenseBlockedTest::DenseBlockedTest()
+{
+   testLU();
+   testLLH();
+   testQR();
+   testInversion();
+   testDeterminant();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the blocked LU decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void DenseBlockedTest::testLU()
+{
+   test_ = "Blocked LU decomposition";
+
+   testLU< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 131UL, 131UL );
+   testLU< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 131UL,  70UL );
+   testLU< blaze::DynamicMatrix<double,blaze::rowMajor   > >(  70UL, 131UL );
+   testLU< blaze::DynamicMatrix<double,blaze::columnMajor> >( 131UL, 131UL );
+   testLU< blaze::DynamicMatrix<double,blaze::columnMajor> >( 131UL,  70UL );
+   testLU< blaze::DynamicMatrix<double,blaze::columnMajor> >(  70UL, 131UL );
+
+   testLU< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >( 97UL, 97UL );
+   testLU< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >( 97UL, 97UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the blocked Cholesky decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void DenseBlockedTest::testLLH()
+{
+   test_ = "Blocked Cholesky decomposition";
+
+   testLLH< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 131UL );
+   testLLH< blaze::DynamicMatrix<double,blaze::columnMajor> >( 131UL );
+
+   testLLH< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >( 97UL );
+   testLLH< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >( 97UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the blocked QR decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void DenseBlockedTest::testQR()
+{
+   test_ = "Blocked QR decomposition";
+
+   testQR< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 131UL, 131UL );
+   testQR< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 131UL,  70UL );
+   testQR< blaze::DynamicMatrix<double,blaze::rowMajor   > >(  70UL, 131UL );
+   testQR< blaze::DynamicMatrix<double,blaze::columnMajor> >( 131UL, 131UL );
+   testQR< blaze::DynamicMatrix<double,blaze::columnMajor> >( 131UL,  70UL );
+   testQR< blaze::DynamicMatrix<double,blaze::columnMajor> >(  70UL, 131UL );
+
+   testQR< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >( 97UL, 83UL );
+   testQR< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >( 83UL, 97UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the blocked matrix inversion.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void DenseBlockedTest::testInversion()
+{
+   test_ = "Blocked matrix inversion";
+
+   testInversion< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 131UL );
+   testInversion< blaze::DynamicMatrix<double,blaze::columnMajor> >( 131UL );
+
+   testInversion< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >( 97UL );
+   testInversion< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >( 97UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the blocked determinant computation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void DenseBlockedTest::testDeterminant()
+{
+   test_ = "Blocked determinant computation";
+
+   testDeterminant< blaze::DynamicMatrix<double,blaze::rowMajor   > >( 131UL );
+   testDeterminant< blaze::DynamicMatrix<double,blaze::columnMajor> >( 131UL );
+
+   testDeterminant< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >( 97UL );
+   testDeterminant< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >( 97UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the blocked decompositions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the inversion of singular matrices and the Cholesky decomposition
+// of a non-positive-definite matrix fail with an exception.
+*/
+void DenseBlockedTest::testErrors()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_BLAS_MODE
+
+   test_ = "Blocked decomposition error handling";
+
+   const size_t n( 100UL );
+
+   blaze::DynamicMatrix<double,blaze::columnMajor> A( n, n );
+   randomize( A );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      A(i,77UL) = 0.0;
+   }
+
+   try {
+      invert( A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inversion of singular matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "singular" ) == std::string::npos )
+         throw;
+   }
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> L( n, n, 0.0 );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      L(i,i) = ( i == 81UL )?( 0.0 ):( 1.0 );
+   }
+
+   try {
+      blaze::invert<blaze::asLower>( L );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inversion of singular lower matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "singular" ) == std::string::npos )
+         throw;
+   }
+
+   blaze::DynamicMatrix<double,blaze::columnMajor> B( identity< blaze::DynamicMatrix<double,blaze::columnMajor> >( n ) );
+   blaze::DynamicMatrix<double,blaze::columnMajor> C;
+
+   B(90UL,90UL) = -1.0;
+
+   try {
+      blaze::llh( B, C );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Cholesky decomposition of non-positive-definite matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "non-positive-definite" ) == std::string::npos )
+         throw;
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+} // namespace decomposition
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running native blocked dense matrix decomposition test..." << std::endl;
+
+   try
+   {
+      RUN_DENSE_BLOCKED_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during native blocked dense matrix decomposition test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -41,6 +41,7 @@
 #include <iostream>
 #include <blaze/math/dense/DenseMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
 #include <blazetest/mathtest/densematrix/GeneralTest.h>
 
 
@@ -78,6 +79,9 @@ GeneralTest::GeneralTest()
    testIsIdentity();
    testMinimum();
    testMaximum();
+   testSum();
+   testNorms();
+   testPartialReduce();
 }
 //*************************************************************************************************
 
@@ -4553,6 +4557,430 @@ void GeneralTest::testMaximum()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c sum() function for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c sum() function for dense matrices. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testSum()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major sum()";
+
+      // Sum of a 0x0 matrix
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat;
+
+         const int sum = blaze::sum( mat );
+
+         if( sum != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << sum << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Sum of a 3x2 matrix
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat{ { 1, -2 }, { 3, -4 }, { 5, 6 } };
+
+         const int sum = blaze::sum( mat );
+
+         if( sum != 9 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result: " << sum << "\n"
+                << "   Expected result: 9\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Sum of a large matrix (with vectorized and remainder elements)
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> mat( 37UL, 29UL );
+         for( size_t i=0UL; i<mat.rows(); ++i )
+            for( size_t j=0UL; j<mat.columns(); ++j )
+               mat(i,j) = double( i + j );
+
+         const double sum = blaze::sum( mat );
+
+         if( sum != 34336.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Third computation failed\n"
+                << " Details:\n"
+                << "   Result: " << sum << "\n"
+                << "   Expected result: 34336\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major sum()";
+
+      // Sum of a 0x0 matrix
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat;
+
+         const int sum = blaze::sum( mat );
+
+         if( sum != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << sum << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Sum of a 3x2 matrix
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat{ { 1, -2 }, { 3, -4 }, { 5, 6 } };
+
+         const int sum = blaze::sum( mat );
+
+         if( sum != 9 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result: " << sum << "\n"
+                << "   Expected result: 9\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Sum of a large matrix (with vectorized and remainder elements)
+      {
+         blaze::DynamicMatrix<double,blaze::columnMajor> mat( 37UL, 29UL );
+         for( size_t i=0UL; i<mat.rows(); ++i )
+            for( size_t j=0UL; j<mat.columns(); ++j )
+               mat(i,j) = double( i + j );
+
+         const double sum = blaze::sum( mat );
+
+         if( sum != 34336.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Third computation failed\n"
+                << " Details:\n"
+                << "   Result: " << sum << "\n"
+                << "   Expected result: 34336\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c norm(), \c sqrNorm(), \c l1Norm(), and \c maxNorm() functions for dense
+//        matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c norm(), \c sqrNorm(), \c l1Norm(), and \c maxNorm()
+// functions for dense matrices. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void GeneralTest::testNorms()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major norm functions";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> mat{ { 1.0, -2.0, 0.0 }, { 2.0, 0.0, 4.0 } };
+
+      const double norm    = blaze::norm   ( mat );
+      const double sqrNorm = blaze::sqrNorm( mat );
+      const double l1Norm  = blaze::l1Norm ( mat );
+      const double maxNorm = blaze::maxNorm( mat );
+
+      if( !blaze::equal( norm, 5.0 ) || !blaze::equal( sqrNorm, 25.0 ) ||
+          !blaze::equal( l1Norm, 9.0 ) || !blaze::equal( maxNorm, 4.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << norm << " " << sqrNorm << " " << l1Norm << " " << maxNorm << "\n"
+             << "   Expected result: 5 25 9 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major norm functions";
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> mat{ { 1.0, -2.0, 0.0 }, { 2.0, 0.0, 4.0 } };
+
+      const double norm    = blaze::norm   ( mat );
+      const double sqrNorm = blaze::sqrNorm( mat );
+      const double l1Norm  = blaze::l1Norm ( mat );
+      const double maxNorm = blaze::maxNorm( mat );
+
+      if( !blaze::equal( norm, 5.0 ) || !blaze::equal( sqrNorm, 25.0 ) ||
+          !blaze::equal( l1Norm, 9.0 ) || !blaze::equal( maxNorm, 4.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << norm << " " << sqrNorm << " " << l1Norm << " " << maxNorm << "\n"
+             << "   Expected result: 5 25 9 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the row-wise and column-wise reduction functions for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the row-wise and column-wise \c reduce(), \c sum(),
+// \c min(), and \c max() functions for dense matrices. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testPartialReduce()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major partial reduction";
+
+      // Row-wise and column-wise sums of a 3x2 matrix
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat{ { 1, -2 }, { 3, -4 }, { 5, 6 } };
+
+         blaze::DynamicVector<int,blaze::columnVector> rowsum( blaze::sum<blaze::rowwise>( mat ) );
+         blaze::DynamicVector<int,blaze::rowVector> colsum( blaze::sum<blaze::columnwise>( mat ) );
+
+         if( rowsum.size() != 3UL || rowsum[0] != -1 || rowsum[1] != -1 || rowsum[2] != 11 ||
+             colsum.size() != 2UL || colsum[0] !=  9 || colsum[1] !=  0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Sum computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rowsum << colsum << "\n"
+                << "   Expected result:\n( -1 -1 11 )\n( 9 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Row-wise and column-wise minimum and maximum of a 3x2 matrix
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat{ { 1, -2 }, { 3, -4 }, { 5, 6 } };
+
+         blaze::DynamicVector<int,blaze::columnVector> rowmin( blaze::min<blaze::rowwise>( mat ) );
+         blaze::DynamicVector<int,blaze::rowVector> colmax( blaze::max<blaze::columnwise>( mat ) );
+
+         if( rowmin[0] != -2 || rowmin[1] != -4 || rowmin[2] != 5 ||
+             colmax[0] !=  5 || colmax[1] !=  6 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Minimum/maximum computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rowmin << colmax << "\n"
+                << "   Expected result:\n( -2 -4 5 )\n( 5 6 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Custom reduction of a 3x2 matrix
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat{ { 1, -2 }, { 3, -4 }, { 5, 6 } };
+
+         blaze::DynamicVector<int,blaze::rowVector> colsum(
+            blaze::reduce<blaze::columnwise>( mat, []( int a, int b ){ return a + b; } ) );
+
+         if( colsum[0] != 9 || colsum[1] != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Custom reduction failed\n"
+                << " Details:\n"
+                << "   Result:\n" << colsum << "\n"
+                << "   Expected result:\n( 9 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Row-wise and column-wise sums of a large matrix (with vectorized and remainder elements)
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> mat( 37UL, 1100UL );
+         for( size_t i=0UL; i<mat.rows(); ++i )
+            for( size_t j=0UL; j<mat.columns(); ++j )
+               mat(i,j) = double( i + j );
+         blaze::DynamicVector<double,blaze::columnVector> rowsum( blaze::sum<blaze::rowwise>( mat ) );
+         blaze::DynamicVector<double,blaze::rowVector> colsum( blaze::sum<blaze::columnwise>( mat ) );
+
+         for( size_t i=0UL; i<mat.rows(); ++i ) {
+            if( rowsum[i] != blaze::sum( row( mat, i ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Row-wise sum computation failed\n"
+                   << " Details:\n"
+                   << "   Row: " << i << "\n"
+                   << "   Result: " << rowsum[i] << "\n"
+                   << "   Expected result: " << blaze::sum( row( mat, i ) ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            if( colsum[j] != blaze::sum( column( mat, j ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Column-wise sum computation failed\n"
+                   << " Details:\n"
+                   << "   Column: " << j << "\n"
+                   << "   Result: " << colsum[j] << "\n"
+                   << "   Expected result: " << blaze::sum( column( mat, j ) ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major partial reduction";
+
+      // Row-wise and column-wise sums of a 3x2 matrix
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat{ { 1, -2 }, { 3, -4 }, { 5, 6 } };
+
+         blaze::DynamicVector<int,blaze::columnVector> rowsum( blaze::sum<blaze::rowwise>( mat ) );
+         blaze::DynamicVector<int,blaze::rowVector> colsum( blaze::sum<blaze::columnwise>( mat ) );
+
+         if( rowsum.size() != 3UL || rowsum[0] != -1 || rowsum[1] != -1 || rowsum[2] != 11 ||
+             colsum.size() != 2UL || colsum[0] !=  9 || colsum[1] !=  0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Sum computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rowsum << colsum << "\n"
+                << "   Expected result:\n( -1 -1 11 )\n( 9 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Row-wise and column-wise minimum and maximum of a 3x2 matrix
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat{ { 1, -2 }, { 3, -4 }, { 5, 6 } };
+
+         blaze::DynamicVector<int,blaze::columnVector> rowmin( blaze::min<blaze::rowwise>( mat ) );
+         blaze::DynamicVector<int,blaze::rowVector> colmax( blaze::max<blaze::columnwise>( mat ) );
+
+         if( rowmin[0] != -2 || rowmin[1] != -4 || rowmin[2] != 5 ||
+             colmax[0] !=  5 || colmax[1] !=  6 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Minimum/maximum computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rowmin << colmax << "\n"
+                << "   Expected result:\n( -2 -4 5 )\n( 5 6 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Custom reduction of a 3x2 matrix
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat{ { 1, -2 }, { 3, -4 }, { 5, 6 } };
+
+         blaze::DynamicVector<int,blaze::rowVector> colsum(
+            blaze::reduce<blaze::columnwise>( mat, []( int a, int b ){ return a + b; } ) );
+
+         if( colsum[0] != 9 || colsum[1] != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Custom reduction failed\n"
+                << " Details:\n"
+                << "   Result:\n" << colsum << "\n"
+                << "   Expected result:\n( 9 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Row-wise and column-wise sums of a large matrix (with vectorized and remainder elements)
+      {
+         blaze::DynamicMatrix<double,blaze::columnMajor> mat( 37UL, 1100UL );
+         for( size_t i=0UL; i<mat.rows(); ++i )
+            for( size_t j=0UL; j<mat.columns(); ++j )
+               mat(i,j) = double( i + j );
+         blaze::DynamicVector<double,blaze::columnVector> rowsum( blaze::sum<blaze::rowwise>( mat ) );
+         blaze::DynamicVector<double,blaze::rowVector> colsum( blaze::sum<blaze::columnwise>( mat ) );
+
+         for( size_t i=0UL; i<mat.rows(); ++i ) {
+            if( rowsum[i] != blaze::sum( row( mat, i ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Row-wise sum computation failed\n"
+                   << " Details:\n"
+                   << "   Row: " << i << "\n"
+                   << "   Result: " << rowsum[i] << "\n"
+                   << "   Expected result: " << blaze::sum( row( mat, i ) ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            if( colsum[j] != blaze::sum( column( mat, j ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Column-wise sum computation failed\n"
+                   << " Details:\n"
+                   << "   Column: " << j << "\n"
+                   << "   Result: " << colsum[j] << "\n"
+                   << "   Expected result: " << blaze::sum( column( mat, j ) ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace densematrix
 
 } // namespace mathtest
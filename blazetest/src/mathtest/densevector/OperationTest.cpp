@@ -69,6 +69,10 @@ OperationTest::OperationTest()
    testNormalize();
    testMinimum();
    testMaximum();
+   testSum();
+   testProduct();
+   testReduce();
+   testNorms();
 }
 //*************************************************************************************************
 
@@ -564,6 +568,274 @@ void OperationTest::testMaximum()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c sum() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c sum() function for dense vectors. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSum()
+{
+   test_ = "sum() function";
+
+   // Sum of a 0-dimensional vector
+   {
+      blaze::DynamicVector<int,blaze::rowVector> vec;
+
+      const int sum = blaze::sum( vec );
+
+      if( sum != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << sum << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Sum of a 9-dimensional vector
+   {
+      blaze::DynamicVector<int,blaze::rowVector> vec{ 1, -2, 3, -4, 5, -6, 7, -8, 9 };
+
+      const int sum = blaze::sum( vec );
+
+      if( sum != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << sum << "\n"
+             << "   Expected result: 5\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Sum of a large vector (with vectorized and remainder elements)
+   {
+      blaze::DynamicVector<double,blaze::columnVector> vec( 1033UL );
+      for( size_t i=0UL; i<vec.size(); ++i )
+         vec[i] = double( i );
+
+      const double sum = blaze::sum( vec );
+
+      if( sum != 533028.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Third computation failed\n"
+             << " Details:\n"
+             << "   Result: " << sum << "\n"
+             << "   Expected result: 533028\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Sum of a vector expression
+   {
+      blaze::DynamicVector<int,blaze::rowVector> a{ 1, 2, 3, 4, 5 };
+      blaze::DynamicVector<int,blaze::rowVector> b{ 5, 4, 3, 2, 1 };
+
+      const int sum = blaze::sum( a + b );
+
+      if( sum != 30 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fourth computation failed\n"
+             << " Details:\n"
+             << "   Result: " << sum << "\n"
+             << "   Expected result: 30\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c prod() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c prod() function for dense vectors. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testProduct()
+{
+   test_ = "prod() function";
+
+   // Product of a 0-dimensional vector
+   {
+      blaze::DynamicVector<int,blaze::rowVector> vec;
+
+      const int prod = blaze::prod( vec );
+
+      if( prod != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << prod << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Product of a 9-dimensional vector
+   {
+      blaze::DynamicVector<int,blaze::rowVector> vec{ 1, -2, 3, -1, 2, 1, -1, 2, 3 };
+
+      const int prod = blaze::prod( vec );
+
+      if( prod != -72 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << prod << "\n"
+             << "   Expected result: -72\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reduce() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reduce() function for dense vectors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testReduce()
+{
+   test_ = "reduce() function";
+
+   // Reduction by means of a predefined reduction operation
+   {
+      blaze::DynamicVector<double,blaze::rowVector> vec{ 2.0, -7.0, 3.0, 5.0, -1.0, 4.0, 0.0 };
+
+      const double maximum = blaze::reduce( vec, blaze::Maximum() );
+
+      if( maximum != 5.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << maximum << "\n"
+             << "   Expected result: 5\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Reduction by means of a lambda
+   {
+      blaze::DynamicVector<int,blaze::rowVector> vec{ 6, 12, -18, 30, 24 };
+
+      const int gcd = blaze::reduce( vec, []( int a, int b ) {
+         a = std::abs( a );
+         b = std::abs( b );
+         while( b != 0 ) { const int r( a % b ); a = b; b = r; }
+         return a;
+      } );
+
+      if( gcd != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << gcd << "\n"
+             << "   Expected result: 6\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c norm(), \c sqrNorm(), \c l1Norm(), and \c maxNorm() functions for dense
+//        vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c norm(), \c sqrNorm(), \c l1Norm(), and \c maxNorm()
+// functions for dense vectors. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OperationTest::testNorms()
+{
+   test_ = "norm functions";
+
+   // Norms of a 0-dimensional vector
+   {
+      blaze::DynamicVector<double,blaze::rowVector> vec;
+
+      if( !blaze::isDefault( blaze::norm( vec ) ) || !blaze::isDefault( blaze::sqrNorm( vec ) ) ||
+          !blaze::isDefault( blaze::l1Norm( vec ) ) || !blaze::isDefault( blaze::maxNorm( vec ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << blaze::norm( vec ) << " " << blaze::sqrNorm( vec ) << " "
+             << blaze::l1Norm( vec ) << " " << blaze::maxNorm( vec ) << "\n"
+             << "   Expected result: 0 0 0 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Norms of a 5-dimensional vector
+   {
+      blaze::DynamicVector<double,blaze::rowVector> vec{ 0.0, 2.0, -4.0, 1.0, -2.0 };
+
+      const double norm    = blaze::norm   ( vec );
+      const double sqrNorm = blaze::sqrNorm( vec );
+      const double l1Norm  = blaze::l1Norm ( vec );
+      const double maxNorm = blaze::maxNorm( vec );
+
+      if( !blaze::equal( norm, 5.0 ) || !blaze::equal( sqrNorm, 25.0 ) ||
+          !blaze::equal( l1Norm, 9.0 ) || !blaze::equal( maxNorm, 4.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << norm << " " << sqrNorm << " " << l1Norm << " " << maxNorm << "\n"
+             << "   Expected result: 5 25 9 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Norms of a complex vector
+   {
+      typedef blaze::complex<double>  cplx;
+
+      blaze::DynamicVector<cplx,blaze::rowVector> vec{ cplx( 3.0, 4.0 ), cplx( 0.0, -12.0 ) };
+
+      const double norm    = blaze::norm   ( vec );
+      const double sqrNorm = blaze::sqrNorm( vec );
+
+      if( !blaze::equal( norm, 13.0 ) || !blaze::equal( sqrNorm, 169.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Third computation failed\n"
+             << " Details:\n"
+             << "   Result: " << norm << " " << sqrNorm << "\n"
+             << "   Expected result: 13 169\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace densevector
 
 } // namespace mathtest
@@ -39,6 +39,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <blaze/math/dense/MMM.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blazetest/mathtest/Creator.h>
 #include <blazetest/mathtest/dmatdmatmult/OperationTest.h>
@@ -86,6 +87,23 @@ int main()
       RUN_DMATDMATMULT_OPERATION_TEST( CMDb( 32UL, 32UL ), CMDb(  32UL, 32UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CMDb( 64UL, 32UL ), CMDb(  32UL, 16UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CMDb( 64UL, 32UL ), CMDb(  32UL, 64UL ) );
+
+      // Running tests with matrices around the cache blocking boundaries of the packed kernel
+      {
+         typedef blaze::MMMBlocking<TypeB>  Blocking;
+
+         const size_t MR( Blocking::MR );
+         const size_t NR( Blocking::NR );
+         const size_t MC( Blocking::mc() );
+         const size_t KC( Blocking::kc() );
+         const size_t NC( Blocking::nc() );
+
+         RUN_DMATDMATMULT_OPERATION_TEST( CMDb(      1UL, KC+1UL ), CMDb( KC+1UL, 10000UL ) );
+         RUN_DMATDMATMULT_OPERATION_TEST( CMDb( MC-1UL, KC+1UL ), CMDb( KC+1UL, NR+1UL  ) );
+         RUN_DMATDMATMULT_OPERATION_TEST( CMDb( MC    , KC     ), CMDb( KC    , NR-1UL  ) );
+         RUN_DMATDMATMULT_OPERATION_TEST( CMDb( MC+1UL, KC+1UL ), CMDb( KC+1UL, NR+1UL  ) );
+         RUN_DMATDMATMULT_OPERATION_TEST( CMDb( MR+1UL,    1UL ), CMDb(    1UL, NC+1UL  ) );
+      }
    }
    catch( std::exception& ex ) {
       std::cerr << "\n\n ERROR DETECTED during dense matrix/dense matrix multiplication:\n"
@@ -0,0 +1,346 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrixchain/ClassTest.cpp
+//  \brief Source file for the matrix multiplication chain test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/matrixchain/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrixchain {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the matrix multiplication chain test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testDenseChains();
+   testSparseChains();
+   testMixedChains();
+   testVectorChains();
+   testOrder();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of products of three dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests products of three dense matrices of all storage order combinations and
+// of dimensions that favor both possible evaluation orders. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDenseChains()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Dense matrix multiplication chain";
+
+   for( size_t m=0UL; m<=6UL; m+=3UL ) {
+      for( size_t k=0UL; k<=4UL; k+=2UL ) {
+         runDenseTests<rowMajor,rowMajor,rowMajor>( m, k, 5UL, m+1UL );
+         runDenseTests<columnMajor,columnMajor,columnMajor>( m+1UL, 3UL, k, m );
+      }
+   }
+
+   runDenseTests<rowMajor,rowMajor,rowMajor>( 10UL, 67UL, 5UL, 83UL );
+   runDenseTests<rowMajor,rowMajor,columnMajor>( 83UL, 5UL, 67UL, 10UL );
+   runDenseTests<rowMajor,columnMajor,rowMajor>( 10UL, 67UL, 5UL, 83UL );
+   runDenseTests<rowMajor,columnMajor,columnMajor>( 83UL, 5UL, 67UL, 10UL );
+   runDenseTests<columnMajor,rowMajor,rowMajor>( 10UL, 67UL, 5UL, 83UL );
+   runDenseTests<columnMajor,rowMajor,columnMajor>( 83UL, 5UL, 67UL, 10UL );
+   runDenseTests<columnMajor,columnMajor,rowMajor>( 10UL, 67UL, 5UL, 83UL );
+   runDenseTests<columnMajor,columnMajor,columnMajor>( 83UL, 5UL, 67UL, 10UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of products of three sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests products of three sparse matrices of all storage order combinations.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSparseChains()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Sparse matrix multiplication chain";
+
+   for( size_t m=0UL; m<=6UL; m+=3UL ) {
+      for( size_t k=0UL; k<=4UL; k+=2UL ) {
+         runSparseTests<rowMajor,rowMajor,rowMajor>( m, k, 5UL, m+1UL );
+         runSparseTests<columnMajor,columnMajor,columnMajor>( m+1UL, 3UL, k, m );
+      }
+   }
+
+   runSparseTests<rowMajor,rowMajor,rowMajor>( 10UL, 67UL, 5UL, 83UL );
+   runSparseTests<rowMajor,rowMajor,columnMajor>( 83UL, 5UL, 67UL, 10UL );
+   runSparseTests<rowMajor,columnMajor,rowMajor>( 10UL, 67UL, 5UL, 83UL );
+   runSparseTests<rowMajor,columnMajor,columnMajor>( 83UL, 5UL, 67UL, 10UL );
+   runSparseTests<columnMajor,rowMajor,rowMajor>( 10UL, 67UL, 5UL, 83UL );
+   runSparseTests<columnMajor,rowMajor,columnMajor>( 83UL, 5UL, 67UL, 10UL );
+   runSparseTests<columnMajor,columnMajor,rowMajor>( 10UL, 67UL, 5UL, 83UL );
+   runSparseTests<columnMajor,columnMajor,columnMajor>( 83UL, 5UL, 67UL, 10UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of products of dense and sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests products of three and four dense and sparse matrices, scaled and
+// transposed chains, element access and views on chains as well as chains that are aliased
+// with their target. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMixedChains()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Mixed matrix multiplication chain";
+
+   const blaze::DynamicMatrix<double,rowMajor> A( blaze::rand< blaze::DynamicMatrix<double,rowMajor> >( 10UL, 67UL ) );
+   const blaze::CompressedMatrix<double,rowMajor> S( blaze::rand< blaze::CompressedMatrix<double,rowMajor> >( 67UL, 5UL, 70UL ) );
+   const blaze::DynamicMatrix<double,columnMajor> B( blaze::rand< blaze::DynamicMatrix<double,columnMajor> >( 5UL, 83UL ) );
+   const blaze::CompressedMatrix<double,columnMajor> T( blaze::rand< blaze::CompressedMatrix<double,columnMajor> >( 83UL, 7UL, 100UL ) );
+
+   runTests( A, S, B );
+   runTests( S, B, T );
+   runTests( A, S, blaze::DynamicMatrix<double>( B * T ) );
+
+   {
+      const blaze::DynamicMatrix<double> ref( reference( A, S, B ) * T );
+
+      checkMatrix( blaze::DynamicMatrix<double>( A * S * B * T ), ref );
+      checkMatrix( blaze::DynamicMatrix<double,columnMajor>( ( A * S ) * ( B * T ) ), ref );
+      checkMatrix( blaze::DynamicMatrix<double>( 2.0 * A * S * B * T ), 2.0 * ref );
+      checkMatrix( blaze::DynamicMatrix<double>( trans( A * S * B * T ) ), trans( ref ) );
+      checkMatrix( blaze::DynamicMatrix<double>( A * S * B * T + ref ), 2.0 * ref );
+   }
+
+   {
+      const blaze::DynamicMatrix<double> ref( reference( A, S, B ) );
+
+      checkMatrix( blaze::DynamicMatrix<double>( submatrix( A * S * B, 2UL, 3UL, 7UL, 50UL ) ),
+                   submatrix( ref, 2UL, 3UL, 7UL, 50UL ) );
+
+      blaze::DynamicMatrix<double> C( 10UL, 83UL );
+      row( C, 4UL ) = row( A * S * B, 4UL );
+      checkMatrix( submatrix( C, 4UL, 0UL, 1UL, 83UL ), submatrix( ref, 4UL, 0UL, 1UL, 83UL ) );
+
+      const double value( ( A * S * B )(3UL,7UL) );
+      if( blaze::abs( value - ref(3UL,7UL) ) > 1E-12 * ( 1.0 + blaze::abs( ref(3UL,7UL) ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Incorrect element access\n"
+             << " Details:\n"
+             << "   Result: " << value << "\n"
+             << "   Expected result: " << ref(3UL,7UL) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicMatrix<double> Q( blaze::rand< blaze::DynamicMatrix<double> >( 33UL, 33UL ) );
+      const blaze::DynamicMatrix<double> ref( reference( Q, Q, Q ) );
+
+      Q = Q * Q * Q;
+      checkMatrix( Q, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of products of matrix multiplication chains with vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of matrix multiplication chains with dense column
+// vectors and of dense row vectors with matrix multiplication chains. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testVectorChains()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::columnVector;
+   using blaze::rowVector;
+
+   test_ = "Matrix multiplication chain/vector multiplication";
+
+   const blaze::DynamicMatrix<double,rowMajor> A( blaze::rand< blaze::DynamicMatrix<double,rowMajor> >( 10UL, 67UL ) );
+   const blaze::DynamicMatrix<double,columnMajor> B( blaze::rand< blaze::DynamicMatrix<double,columnMajor> >( 67UL, 5UL ) );
+   const blaze::CompressedMatrix<double,rowMajor> S( blaze::rand< blaze::CompressedMatrix<double,rowMajor> >( 5UL, 83UL, 90UL ) );
+   const blaze::CompressedMatrix<double,columnMajor> T( blaze::rand< blaze::CompressedMatrix<double,columnMajor> >( 67UL, 5UL, 60UL ) );
+
+   const blaze::DynamicVector<double,columnVector> x( blaze::rand< blaze::DynamicVector<double,columnVector> >( 83UL ) );
+   const blaze::DynamicVector<double,rowVector> y( blaze::rand< blaze::DynamicVector<double,rowVector> >( 10UL ) );
+
+   {
+      const blaze::DynamicMatrix<double> ref( reference( A, B, S ) );
+
+      checkVector( blaze::DynamicVector<double,columnVector>( A * B * S * x ), ref * x );
+      checkVector( blaze::DynamicVector<double,rowVector>( y * A * B * S ), y * ref );
+   }
+
+   {
+      const blaze::DynamicMatrix<double> ref( reference( A, T, S ) );
+
+      checkVector( blaze::DynamicVector<double,columnVector>( A * T * S * x ), ref * x );
+      checkVector( blaze::DynamicVector<double,rowVector>( y * A * T * S ), y * ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the evaluation order of matrix multiplication chains.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the cheapest evaluation order is selected for matrix multiplication
+// chains. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testOrder()
+{
+   test_ = "Evaluation order of matrix multiplication chains";
+
+   {
+      const blaze::DynamicMatrix<double> A( 10UL, 200UL ), B( 200UL, 5UL ), C( 5UL, 300UL );
+
+      // (A*B)*C: 10*200*5 + 10*5*300 = 25000, A*(B*C): 200*5*300 + 10*200*300 = 900000
+      checkSplit( A * B * C, 1UL );
+      checkSplit( A * ( B * C ), 1UL );
+   }
+
+   {
+      const blaze::DynamicMatrix<double> A( 300UL, 5UL ), B( 5UL, 300UL ), C( 300UL, 2UL );
+
+      // (A*B)*C: 300*5*300 + 300*300*2 = 630000, A*(B*C): 5*300*2 + 300*5*2 = 6000
+      checkSplit( A * B * C, 0UL );
+   }
+
+   {
+      const blaze::DynamicMatrix<double> A( 2UL, 200UL ), C( 200UL, 200UL );
+      blaze::CompressedMatrix<double> S( 200UL, 200UL );
+      for( size_t i=0UL; i<200UL; ++i ) {
+         S(i,i) = 1.0;
+      }
+
+      // (A*S)*C: 2*200 + 2*200*200 = 80400, A*(S*C): 200*200 + 2*200*200 = 120000
+      checkSplit( A * S * C, 1UL );
+   }
+
+   {
+      const blaze::DynamicMatrix<double> A( 50UL, 40UL ), B( 40UL, 2UL ), C( 2UL, 60UL ), D( 60UL, 3UL );
+
+      // (A*B)*(C*D): 50*40*2 + 2*60*3 + 50*2*3 = 4660, A*(B*(C*D)): 2*60*3 + 40*2*3 + 50*40*3 = 6600
+      checkSplit( A * B * C * D, 1UL );
+   }
+}
+//*************************************************************************************************
+
+} // namespace matrixchain
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running matrix multiplication chain test..." << std::endl;
+
+   try
+   {
+      RUN_MATRIXCHAIN_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during matrix multiplication chain test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,450 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrixmapping/ClassTest.cpp
+//  \brief Source file for the memory-mapped matrix test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/matrixmapping/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrixmapping {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the memory-mapped matrix test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()                     // Label of the currently performed test
+   , file_( "matrixmapping.bmap" )  // Name of the temporary matrix file
+{
+   testDenseMatrices();
+   testSparseMatrices();
+   testOwnership();
+   testFailures();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor for the memory-mapped matrix test.
+//
+// The destructor removes the temporary matrix file.
+*/
+ClassTest::~ClassTest()
+{
+   std::remove( file_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Memory mapping test with dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs memory mapping tests with row-major and column-major dense matrices
+// of various sizes and element types. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testDenseMatrices()
+{
+   test_ = "Dense matrices";
+
+   runDenseTest<int,blaze::rowMajor>   (  0UL,  0UL );
+   runDenseTest<int,blaze::columnMajor>(  0UL,  3UL );
+
+   for( size_t m=1UL; m<10UL; m+=3UL ) {
+      for( size_t n=1UL; n<20UL; n+=5UL ) {
+         runDenseTest<int,blaze::rowMajor>                     ( m, n );
+         runDenseTest<int,blaze::columnMajor>                  ( m, n );
+         runDenseTest<double,blaze::rowMajor>                  ( m, n );
+         runDenseTest<double,blaze::columnMajor>               ( m, n );
+         runDenseTest<blaze::complex<float>,blaze::rowMajor>   ( m, n );
+         runDenseTest<blaze::complex<float>,blaze::columnMajor>( m, n );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Memory mapping test with sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs memory mapping tests with row-major and column-major sparse matrices
+// of various sizes and element types. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSparseMatrices()
+{
+   test_ = "Sparse matrices";
+
+   runSparseTest<int,blaze::rowMajor>( 0UL, 0UL, 0UL );
+   runSparseTest<int,blaze::rowMajor>( 5UL, 7UL, 0UL );
+
+   for( size_t m=1UL; m<20UL; m+=6UL ) {
+      for( size_t n=1UL; n<20UL; n+=6UL ) {
+         const size_t nonzeros( blaze::rand<size_t>( 0UL, m*n ) );
+         runSparseTest<int,blaze::rowMajor>                     ( m, n, nonzeros );
+         runSparseTest<int,blaze::columnMajor>                  ( m, n, nonzeros );
+         runSparseTest<double,blaze::rowMajor>                  ( m, n, nonzeros );
+         runSparseTest<double,blaze::columnMajor>               ( m, n, nonzeros );
+         runSparseTest<blaze::complex<float>,blaze::rowMajor>   ( m, n, nonzeros );
+         runSparseTest<blaze::complex<float>,blaze::columnMajor>( m, n, nonzeros );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the lifetime and copy-on-write semantics of mapped matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that mapped matrices stay valid after the file has been overwritten or
+// removed and that modifications of a mapped dense matrix are not written back to the file.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testOwnership()
+{
+   test_ = "Ownership of mapped matrices";
+
+   {
+      blaze::DynamicMatrix<double> src( 5UL, 7UL );
+      randomize( src );
+
+      blaze::saveMappedMatrix( file_, src );
+
+      std::unique_ptr< blaze::CustomMatrix<double,blaze::aligned,blaze::padded> > dst;
+
+      {
+         const blaze::CustomMatrix<double,blaze::aligned,blaze::padded> tmp(
+            blaze::mmapMatrix<double>( file_ ) );
+         dst.reset( new blaze::CustomMatrix<double,blaze::aligned,blaze::padded>( tmp ) );
+      }
+
+      (*dst)(2,3) = 42.0;
+      src(2,3) = 42.0;
+
+      std::remove( file_.c_str() );
+
+      compareMatrices( src, *dst );
+   }
+
+   {
+      blaze::DynamicMatrix<int> src( 3UL, 3UL );
+      randomize( src, 1, 10 );
+
+      blaze::saveMappedMatrix( file_, src );
+
+      {
+         blaze::CustomMatrix<int,blaze::aligned,blaze::padded> dst( blaze::mmapMatrix<int>( file_ ) );
+         dst(1,1) = 0;
+      }
+
+      const blaze::CustomMatrix<int,blaze::aligned,blaze::padded> dst( blaze::mmapMatrix<int>( file_ ) );
+
+      compareMatrices( src, dst );
+   }
+
+   {
+      blaze::CompressedMatrix<double> src( 6UL, 4UL );
+      randomize( src, 10UL );
+
+      blaze::saveMappedMatrix( file_, src );
+
+      blaze::MappedCSRMatrix<double> dst;
+
+      {
+         const blaze::MappedCSRMatrix<double> tmp( blaze::mmapCSRMatrix<double>( file_ ) );
+         dst = tmp;
+      }
+
+      std::remove( file_.c_str() );
+
+      compareMatrices( src, dst );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the detection of invalid matrix files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that invalid or mismatching matrix files are rejected. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFailures()
+{
+   test_ = "Memory mapping failures";
+
+   std::remove( file_.c_str() );
+
+   try {
+      blaze::mmapMatrix<int>( file_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping of a non-existing file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   {
+      std::ofstream ofs( file_.c_str(), std::ofstream::binary );
+      ofs << "This is not a Blaze matrix file. This is not a Blaze matrix file.";
+   }
+
+   try {
+      blaze::mmapMatrix<int>( file_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping of an invalid file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   {
+      blaze::DynamicMatrix<int> src( 4UL, 4UL );
+      randomize( src );
+      blaze::saveMappedMatrix( file_, src );
+   }
+
+   try {
+      blaze::mmapMatrix<double>( file_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Element type difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::mmapMatrix<int,blaze::columnMajor>( file_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Storage order difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::mmapCSRMatrix<int>( file_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Dense/sparse difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   {
+      blaze::CompressedMatrix<int> src( 100UL, 100UL );
+      randomize( src, 1000UL );
+      blaze::saveMappedMatrix( file_, src );
+
+      std::ifstream ifs( file_.c_str(), std::ifstream::binary );
+      std::string content( ( std::istreambuf_iterator<char>( ifs ) ), std::istreambuf_iterator<char>() );
+      ifs.close();
+
+      std::ofstream ofs( file_.c_str(), std::ofstream::binary | std::ofstream::trunc );
+      ofs.write( content.data(), static_cast<std::streamsize>( content.size() / 2UL ) );
+   }
+
+   try {
+      blaze::mmapCSRMatrix<int>( file_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping of a truncated file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   // Rewrites a single row offset or column index of a 4x4 sparse matrix with the row offsets
+   // ( 0 1 3 4 5 ) and the column indices ( 1 0 2 3 3 )
+   const auto saveCorruptedMatrix = [this]( size_t position, uint64_t value )
+   {
+      blaze::CompressedMatrix<int> src( 4UL, 4UL );
+      src(0,1) = 1;
+      src(1,0) = 2;
+      src(1,2) = 3;
+      src(2,3) = 4;
+      src(3,3) = 5;
+      blaze::saveMappedMatrix( file_, src );
+
+      std::fstream fs( file_.c_str(), std::fstream::in | std::fstream::out | std::fstream::binary );
+      fs.seekp( static_cast<std::streamoff>( blaze::mappedMatrixAlignment + position*sizeof(uint64_t) ) );
+      fs.write( reinterpret_cast<const char*>( &value ), sizeof(uint64_t) );
+   };
+
+   saveCorruptedMatrix( 2UL, 0UL );
+
+   try {
+      blaze::mmapCSRMatrix<int>( file_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping of decreasing row offsets succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& )
+   {}
+
+   saveCorruptedMatrix( 5UL, 4UL );
+
+   try {
+      blaze::mmapCSRMatrix<int>( file_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping of an out-of-bounds column index succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& )
+   {}
+
+   try {
+      const blaze::MappedCSRMatrix<int> dst( blaze::mmapCSRMatrix<int>( file_, false ) );
+
+      if( dst.rows() != 4UL || dst.columns() != 4UL || dst.nonZeros() != 5UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Unchecked mapping failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+   catch( std::invalid_argument& )
+   {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Unchecked mapping validated the column indices\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   saveCorruptedMatrix( 6UL, 2UL );
+
+   try {
+      blaze::mmapCSRMatrix<int>( file_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping of unsorted column indices succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& )
+   {}
+
+   std::remove( file_.c_str() );
+}
+//*************************************************************************************************
+
+} // namespace matrixmapping
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running memory-mapped matrix test..." << std::endl;
+
+   try
+   {
+      RUN_MATRIXMAPPING_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during memory-mapped matrix test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,376 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/packedmatrix/ClassTest.cpp
+//  \brief Source file for the PackedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <complex>
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/packedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace packedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the PackedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testStorage();
+   testElementAccess();
+   testAssignment();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the memory footprint of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that a PackedMatrix only stores the elements of a single triangle. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testStorage()
+{
+   test_ = "PackedMatrix storage";
+
+   const blaze::SymmetricMatrix< blaze::PackedMatrix<double,blaze::rowMajor,blaze::packedSymmetric> > S( 100UL );
+   const blaze::LowerMatrix< blaze::PackedMatrix<float,blaze::columnMajor,blaze::packedLower> > L( 37UL );
+
+   if( S.rows() != 100UL || S.columns() != 100UL || S.capacity() != 5050UL ||
+       L.rows() != 37UL || L.columns() != 37UL || L.capacity() != 703UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid packed storage\n"
+          << " Details:\n"
+          << "   Capacity of 100x100 symmetric matrix: " << S.capacity() << " (expected 5050)\n"
+          << "   Capacity of 37x37 lower matrix      : " << L.capacity() << " (expected 703)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element access to packed matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that accessing an element of the non-stored triangle of a symmetric or
+// Hermitian packed matrix refers to the mirrored stored element and that writing to the zero
+// triangle of a lower or upper packed matrix fails. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testElementAccess()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   typedef std::complex<double>  cplx;
+
+   test_ = "PackedMatrix element access";
+
+   {
+      blaze::SymmetricMatrix< blaze::PackedMatrix<int,rowMajor,blaze::packedSymmetric> > S( 3UL );
+      S(0,2) = 4;
+      S(2,0) += 2;
+      S(1,1) = 3;
+      S(1,0) = 1;
+      S(0,1) *= 5;
+
+      if( S(0,2) != 6 || S(2,0) != 6 || S(0,1) != 5 || S(1,0) != 5 || S(1,1) != 3 ||
+          S(0,0) != 0 || S.nonZeros() != 5UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access to symmetric packed matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << S << "\n"
+             << "   Expected result:\n( 0 5 6 )\n( 5 3 0 )\n( 6 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::HermitianMatrix< blaze::PackedMatrix<cplx,columnMajor,blaze::packedHermitian> > H( 3UL );
+      H(0,1) = cplx( 1.0, 2.0 );
+      H(2,1) = cplx( 3.0, -1.0 );
+      H(1,1) = 2.0;
+
+      if( H(1,0) != cplx( 1.0, -2.0 ) || H(1,2) != cplx( 3.0, 1.0 ) || H(1,1) != cplx( 2.0, 0.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access to Hermitian packed matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << H << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         H(0,0) = cplx( 1.0, 1.0 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of complex diagonal element succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      blaze::LowerMatrix< blaze::PackedMatrix<double,columnMajor,blaze::packedLower> > L( 3UL );
+      L(2,0) = 1.0;
+
+      try {
+         L(0,2) = 1.0;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to upper element of lower packed matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( L(2,0) != 1.0 || L(0,2) != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access to lower packed matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << L << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::UpperMatrix< blaze::PackedMatrix<double,rowMajor,blaze::packedUpper> > U( 3UL );
+      U(0,2) = 1.0;
+
+      try {
+         U(2,0) = 1.0;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to lower element of upper packed matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the assignment to packed matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the assignment of dense matrices and expressions to packed matrices,
+// including the rejection of matrices with a non-matching structure. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "PackedMatrix assignment";
+
+   const blaze::DynamicMatrix<double,rowMajor> A{ { 1.0, 2.0, 3.0 },
+                                                  { 2.0, 4.0, 5.0 },
+                                                  { 3.0, 5.0, 6.0 } };
+
+   {
+      blaze::SymmetricMatrix< blaze::PackedMatrix<double,columnMajor,blaze::packedSymmetric> > S( A );
+      checkMatrix( S, A, 0.0 );
+
+      S += A;
+      checkMatrix( S, 2.0*A, 0.0 );
+
+      S = A * A;
+      checkMatrix( S, A*A, 1E-12 );
+   }
+
+   {
+      const blaze::DynamicMatrix<double,columnMajor> B{ { 1.0, 0.0, 0.0 },
+                                                        { 2.0, 4.0, 0.0 },
+                                                        { 3.0, 5.0, 6.0 } };
+
+      blaze::LowerMatrix< blaze::PackedMatrix<double,rowMajor,blaze::packedLower> > L( 3UL );
+      L = B;
+      checkMatrix( L, B, 0.0 );
+
+      L = B * B;
+      checkMatrix( L, B*B, 1E-12 );
+
+      L -= L;
+      checkMatrix( L, blaze::DynamicMatrix<double,rowMajor>( 3UL, 3UL, 0.0 ), 0.0 );
+   }
+
+   try {
+      blaze::DynamicMatrix<double,rowMajor> B( A );
+      B(0,1) = 7.0;
+
+      blaze::SymmetricMatrix< blaze::PackedMatrix<double,rowMajor,blaze::packedSymmetric> > S( 3UL );
+      S = B;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assignment of non-symmetric matrix succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << S << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::UpperMatrix< blaze::PackedMatrix<double,columnMajor,blaze::packedUpper> > U( A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Construction of upper matrix from full matrix succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << U << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication with packed matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the packed storage kernels of the matrix/vector, vector/matrix and
+// matrix/matrix multiplications for all packed structures and storage orders. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::SymmetricMatrix;
+   using blaze::HermitianMatrix;
+   using blaze::LowerMatrix;
+   using blaze::UpperMatrix;
+   using blaze::PackedMatrix;
+   using blaze::packedSymmetric;
+   using blaze::packedHermitian;
+   using blaze::packedLower;
+   using blaze::packedUpper;
+
+   typedef std::complex<double>  cplx;
+
+   test_ = "PackedMatrix multiplication";
+
+   for( size_t n=1UL; n<=67UL; n+=11UL )
+   {
+      runMultTests< SymmetricMatrix< PackedMatrix<double,rowMajor   ,packedSymmetric> >, double >( n );
+      runMultTests< SymmetricMatrix< PackedMatrix<double,columnMajor,packedSymmetric> >, double >( n );
+      runMultTests< SymmetricMatrix< PackedMatrix<cplx  ,rowMajor   ,packedSymmetric> >, cplx   >( n );
+      runMultTests< HermitianMatrix< PackedMatrix<cplx  ,rowMajor   ,packedHermitian> >, cplx   >( n );
+      runMultTests< HermitianMatrix< PackedMatrix<cplx  ,columnMajor,packedHermitian> >, cplx   >( n );
+      runMultTests< LowerMatrix    < PackedMatrix<double,rowMajor   ,packedLower    > >, double >( n );
+      runMultTests< LowerMatrix    < PackedMatrix<double,columnMajor,packedLower    > >, double >( n );
+      runMultTests< UpperMatrix    < PackedMatrix<double,rowMajor   ,packedUpper    > >, double >( n );
+      runMultTests< UpperMatrix    < PackedMatrix<double,columnMajor,packedUpper    > >, double >( n );
+   }
+
+   runMultTests< SymmetricMatrix< PackedMatrix<double,rowMajor,packedSymmetric> >, double >( 300UL );
+   runMultTests< LowerMatrix< PackedMatrix<double,columnMajor,packedLower> >, double >( 300UL );
+}
+//*************************************************************************************************
+
+} // namespace packedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running PackedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_PACKEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during PackedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
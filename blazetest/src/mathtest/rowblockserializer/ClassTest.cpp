@@ -0,0 +1,314 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/rowblockserializer/ClassTest.cpp
+//  \brief Source file for the row block serialization test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/serialization/MatrixSerializer.h>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/rowblockserializer/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace rowblockserializer {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the row block serialization test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testBlocks();
+   testWriter();
+   testFailures();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Row block serialization test with random sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs row block serialization tests with row-major and column-major sparse
+// matrices of various sizes, element types, and block sizes. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testBlocks()
+{
+   test_ = "Row block serialization";
+
+   runBlockTest<int,blaze::rowMajor>( 0UL, 0UL, 0UL, 1UL );
+   runBlockTest<int,blaze::rowMajor>( 0UL, 5UL, 0UL, 3UL );
+   runBlockTest<int,blaze::rowMajor>( 7UL, 5UL, 0UL, 3UL );
+
+   for( size_t m=1UL; m<30UL; m+=7UL ) {
+      for( size_t n=1UL; n<30UL; n+=9UL ) {
+         for( size_t blockSize=1UL; blockSize<=m+1UL; blockSize+=4UL ) {
+            const size_t nonzeros( blaze::rand<size_t>( 0UL, m*n ) );
+            runBlockTest<int,blaze::rowMajor>                     ( m, n, nonzeros, blockSize );
+            runBlockTest<int,blaze::columnMajor>                  ( m, n, nonzeros, blockSize );
+            runBlockTest<double,blaze::rowMajor>                  ( m, n, nonzeros, blockSize );
+            runBlockTest<double,blaze::columnMajor>               ( m, n, nonzeros, blockSize );
+            runBlockTest<blaze::complex<float>,blaze::rowMajor>   ( m, n, nonzeros, blockSize );
+            runBlockTest<blaze::complex<float>,blaze::columnMajor>( m, n, nonzeros, blockSize );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the incremental writing of row blocks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes a sparse matrix in row blocks of different size, storage order, and
+// kind via a RowBlockWriter and reads it back. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testWriter()
+{
+   test_ = "RowBlockWriter";
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> src( 20UL, 15UL );
+   randomize( src, 80UL, 0.0, 10.0 );
+
+   ArchiveType archive;
+
+   {
+      blaze::RowBlockWriter<ArchiveType,double> writer( archive, 20UL, 15UL );
+
+      const blaze::CompressedMatrix<double,blaze::columnMajor> block2( submatrix( src, 3UL, 0UL, 7UL, 15UL ) );
+      const blaze::CompressedMatrix<double,blaze::rowMajor> block3( submatrix( src, 10UL, 0UL, 10UL, 15UL ) );
+
+      writer.write( submatrix( src, 0UL, 0UL, 3UL, 15UL ) );
+      writer.write( blaze::CompressedMatrix<double>( 0UL, 15UL ) );
+      writer.write( block2 );
+      writer.write( 2.0 * block3 * 0.5 );
+
+      if( writer.position() != 20UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid writer position\n"
+             << " Details:\n"
+             << "   Position: " << writer.position() << "\n"
+             << "   Expected position: 20\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   blaze::RowBlockReader<ArchiveType,double> reader( archive );
+
+   blaze::CompressedMatrix<double,blaze::columnMajor> dst;
+   deserializeRows( reader, 0UL, 20UL, dst );
+
+   compareMatrices( src, dst );
+
+   if( reader.next() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Additional row block detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the detection of invalid row block streams and operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that invalid operations and corrupt or mismatching row block streams
+// are rejected. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFailures()
+{
+   test_ = "Row block serialization failures";
+
+   blaze::CompressedMatrix<int> src( 10UL, 8UL );
+   randomize( src, 30UL );
+
+   try {
+      ArchiveType archive;
+      blaze::RowBlockWriter<ArchiveType,int> writer( archive, 10UL, 8UL );
+      writer.write( blaze::CompressedMatrix<int>( 2UL, 7UL ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Writing of a block with invalid number of columns succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& )
+   {}
+
+   try {
+      ArchiveType archive;
+      blaze::RowBlockWriter<ArchiveType,int> writer( archive, 10UL, 8UL );
+      writer.write( src );
+      writer.write( blaze::CompressedMatrix<int>( 1UL, 8UL ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Writing of additional rows succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& )
+   {}
+
+   try {
+      ArchiveType archive;
+      serializeRowBlocks( archive, src, 4UL );
+
+      blaze::RowBlockReader<ArchiveType,double> reader( archive );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Element type difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      ArchiveType archive;
+      serializeRowBlocks( archive, src, 4UL );
+
+      blaze::CompressedMatrix<int> dst;
+      archive >> dst;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Deserialization of a row block stream via the MatrixSerializer succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      ArchiveType archive;
+      serializeRowBlocks( archive, src, 4UL );
+
+      blaze::RowBlockReader<ArchiveType,int> reader( archive );
+      blaze::CompressedMatrix<int> dst;
+      deserializeRows( reader, 5UL, 3UL, dst );
+      deserializeRows( reader, 2UL, 3UL, dst );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Backward deserialization of rows succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& )
+   {}
+
+   try {
+      ArchiveType archive;
+      blaze::RowBlockWriter<ArchiveType,int> writer( archive, 10UL, 8UL );
+      writer.write( submatrix( src, 0UL, 0UL, 6UL, 8UL ) );
+
+      blaze::RowBlockReader<ArchiveType,int> reader( archive );
+      blaze::CompressedMatrix<int> dst;
+      deserializeRows( reader, 0UL, 10UL, dst );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Deserialization of a truncated stream succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+}
+//*************************************************************************************************
+
+} // namespace rowblockserializer
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running row block serialization test..." << std::endl;
+
+   try
+   {
+      RUN_ROWBLOCKSERIALIZER_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during row block serialization test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
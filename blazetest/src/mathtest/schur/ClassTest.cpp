@@ -0,0 +1,315 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/schur/ClassTest.cpp
+//  \brief Source file for the Schur product test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/schur/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace schur {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the Schur product test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testDenseDense();
+   testDenseSparse();
+   testSparseSparse();
+   testViews();
+   testSizeMismatch();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the Schur product between two dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the Schur product between two dense matrices of all storage order
+// combinations. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDenseDense()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Dense matrix/dense matrix Schur product";
+
+   for( size_t m=0UL; m<=9UL; m+=3UL ) {
+      for( size_t n=0UL; n<=10UL; n+=5UL ) {
+         runDenseDenseTests<rowMajor,rowMajor>( m, n );
+         runDenseDenseTests<rowMajor,columnMajor>( m, n );
+         runDenseDenseTests<columnMajor,rowMajor>( m, n );
+         runDenseDenseTests<columnMajor,columnMajor>( m, n );
+      }
+   }
+
+   runDenseDenseTests<rowMajor,rowMajor>( 67UL, 127UL );
+   runDenseDenseTests<rowMajor,columnMajor>( 67UL, 127UL );
+   runDenseDenseTests<columnMajor,rowMajor>( 127UL, 67UL );
+   runDenseDenseTests<columnMajor,columnMajor>( 127UL, 67UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Schur product between a dense and a sparse matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the Schur product between a dense and a sparse matrix (and vice versa)
+// of all storage order combinations. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testDenseSparse()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Dense matrix/sparse matrix Schur product";
+
+   for( size_t m=0UL; m<=9UL; m+=3UL ) {
+      for( size_t n=0UL; n<=10UL; n+=5UL ) {
+         runDenseSparseTests<rowMajor,rowMajor>( m, n );
+         runDenseSparseTests<rowMajor,columnMajor>( m, n );
+         runDenseSparseTests<columnMajor,rowMajor>( m, n );
+         runDenseSparseTests<columnMajor,columnMajor>( m, n );
+      }
+   }
+
+   runDenseSparseTests<rowMajor,rowMajor>( 67UL, 127UL );
+   runDenseSparseTests<rowMajor,columnMajor>( 67UL, 127UL );
+   runDenseSparseTests<columnMajor,rowMajor>( 127UL, 67UL );
+   runDenseSparseTests<columnMajor,columnMajor>( 127UL, 67UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Schur product between two sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the Schur product between two sparse matrices of all storage order
+// combinations. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSparseSparse()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Sparse matrix/sparse matrix Schur product";
+
+   for( size_t m=0UL; m<=9UL; m+=3UL ) {
+      for( size_t n=0UL; n<=10UL; n+=5UL ) {
+         runSparseSparseTests<rowMajor,rowMajor>( m, n );
+         runSparseSparseTests<rowMajor,columnMajor>( m, n );
+         runSparseSparseTests<columnMajor,rowMajor>( m, n );
+         runSparseSparseTests<columnMajor,columnMajor>( m, n );
+      }
+   }
+
+   runSparseSparseTests<rowMajor,rowMajor>( 67UL, 127UL );
+   runSparseSparseTests<rowMajor,columnMajor>( 67UL, 127UL );
+   runSparseSparseTests<columnMajor,rowMajor>( 127UL, 67UL );
+   runSparseSparseTests<columnMajor,columnMajor>( 127UL, 67UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of views on and nested expressions with Schur products.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the row, column and submatrix views on Schur product expressions as well
+// as Schur products within larger expressions. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testViews()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   test_ = "Views on Schur products";
+
+   const blaze::DynamicMatrix<double,rowMajor> A( blaze::rand< blaze::DynamicMatrix<double,rowMajor> >( 13UL, 17UL ) );
+   const blaze::DynamicMatrix<double,columnMajor> B( blaze::rand< blaze::DynamicMatrix<double,columnMajor> >( 13UL, 17UL ) );
+   const blaze::CompressedMatrix<double,rowMajor> S( blaze::rand< blaze::CompressedMatrix<double,rowMajor> >( 13UL, 17UL, 80UL ) );
+   const blaze::CompressedMatrix<double,columnMajor> T( blaze::rand< blaze::CompressedMatrix<double,columnMajor> >( 13UL, 17UL, 80UL ) );
+
+   const double tol( 1E-12 );
+
+   {
+      const blaze::DynamicMatrix<double> ref( reference( A, B ) );
+
+      checkMatrix( blaze::DynamicMatrix<double>( submatrix( A % B, 2UL, 3UL, 7UL, 5UL ) ),
+                   submatrix( ref, 2UL, 3UL, 7UL, 5UL ), tol );
+      checkMatrix( blaze::DynamicMatrix<double,columnMajor>( ( A % B ) * trans( A ) ),
+                   ref * trans( A ), 1E-10 );
+
+      blaze::DynamicMatrix<double> C( 13UL, 17UL );
+      row( C, 4UL ) = row( A % B, 4UL );
+      column( C, 5UL ) = column( B % A, 5UL );
+      checkMatrix( submatrix( C, 4UL, 0UL, 1UL, 17UL ), submatrix( ref, 4UL, 0UL, 1UL, 17UL ), tol );
+      checkMatrix( submatrix( C, 0UL, 5UL, 13UL, 1UL ), submatrix( ref, 0UL, 5UL, 13UL, 1UL ), tol );
+   }
+
+   {
+      const blaze::DynamicMatrix<double> ref( reference( S, T ) );
+
+      checkMatrix( blaze::DynamicMatrix<double>( submatrix( S % T, 1UL, 2UL, 9UL, 11UL ) ),
+                   submatrix( ref, 1UL, 2UL, 9UL, 11UL ), tol );
+      checkMatrix( blaze::DynamicMatrix<double>( ( 2.0 * S ) % ( T + S ) ),
+                   reference( 2.0 * S, T + S ), tol );
+   }
+
+   {
+      const blaze::DynamicMatrix<double> ref( reference( A, T ) );
+
+      blaze::CompressedMatrix<double> C( 13UL, 17UL );
+      C = A % T;
+      checkMatrix( C, ref, tol );
+      checkMatrix( blaze::DynamicMatrix<double>( submatrix( T % A, 0UL, 4UL, 13UL, 6UL ) ),
+                   submatrix( ref, 0UL, 4UL, 13UL, 6UL ), tol );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Schur product between matrices of different sizes.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the Schur product between two matrices of different sizes throws
+// a \a std::invalid_argument exception. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSizeMismatch()
+{
+   test_ = "Schur product size mismatch";
+
+   const blaze::DynamicMatrix<double> A( 3UL, 4UL, 1.0 );
+   const blaze::DynamicMatrix<double> B( 4UL, 3UL, 1.0 );
+   const blaze::CompressedMatrix<double> S( 3UL, 3UL );
+
+   try {
+      blaze::DynamicMatrix<double> C( A % B );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Dense matrix Schur product with mismatching sizes succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::CompressedMatrix<double> C( S % A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Sparse matrix Schur product with mismatching sizes succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+} // namespace schur
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running Schur product test..." << std::endl;
+
+   try
+   {
+      RUN_SCHUR_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during Schur product test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,503 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/ClassTest.cpp
+//  \brief Source file for the iterative solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <complex>
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/solvers/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the iterative solver test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testCG();
+   testBiCGSTAB();
+   testGMRES();
+   testDualMult();
+   testSpecialCases();
+   testFailures();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the conjugate gradient solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the cg() function for symmetric positive definite systems.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCG()
+{
+   test_ = "cg()";
+
+   runSystemTests<double>( cgSolver, 24UL, 0.0, 1E-10 );
+   runSystemTests<float>( cgSolver, 12UL, 0.0, 1E-4 );
+   runSystemTests< std::complex<double> >( cgSolver, 16UL, 0.0, 1E-10 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BiCGSTAB solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the bicgstab() function for symmetric and non-symmetric
+// systems. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testBiCGSTAB()
+{
+   test_ = "bicgstab()";
+
+   runSystemTests<double>( bicgstabSolver, 24UL, 0.0, 1E-10 );
+   runSystemTests<double>( bicgstabSolver, 24UL, 0.3, 1E-10 );
+   runSystemTests<float>( bicgstabSolver, 12UL, 0.3, 1E-4 );
+   runSystemTests< std::complex<double> >( bicgstabSolver, 16UL, 0.3, 1E-10 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the restarted GMRES solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the gmres() function for symmetric and non-symmetric
+// systems. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testGMRES()
+{
+   test_ = "gmres()";
+
+   runSystemTests<double>( gmresSolver, 24UL, 0.0, 1E-10 );
+   runSystemTests<double>( gmresSolver, 24UL, 0.3, 1E-10 );
+   runSystemTests<float>( gmresSolver, 12UL, 0.3, 1E-4 );
+   runSystemTests< std::complex<double> >( gmresSolver, 16UL, 0.3, 1E-10 );
+
+   // Solving with a short restart length
+   {
+      const blaze::CompressedMatrix<double> A( system<double>( 16UL, 0.3 ) );
+      const blaze::DynamicVector<double> b( blaze::rand< blaze::DynamicVector<double> >( 256UL ) );
+      blaze::DynamicVector<double> x( 256UL, 0.0 );
+
+      const blaze::SolverResult result( blaze::gmres( A, x, b, blaze::SolverControl( 1E-8, 10000UL, 5UL ) ) );
+      const double res( residual( A, x, b ) );
+
+      if( !result.converged || res > 1E-7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Restarted solver did not converge\n"
+             << " Details:\n"
+             << "   Converged          : " << result.converged << "\n"
+             << "   Iterations         : " << result.iterations << "\n"
+             << "   Recomputed residual: " << res << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dual matrix/vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplyBoth() function for dense and sparse matrices of
+// both storage orders. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDualMult()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "multiplyBoth()";
+
+   const size_t sizes[] = { 1UL, 2UL, 7UL, 16UL, 33UL, 150UL };
+
+   for( size_t m : sizes ) {
+      for( size_t n : sizes )
+      {
+         const blaze::DynamicMatrix<double,rowMajor> A( blaze::rand< blaze::DynamicMatrix<double> >( m, n ) );
+         runDualMultTest<double>( A );
+
+         const blaze::DynamicMatrix<double,columnMajor> B( A );
+         runDualMultTest<double>( B );
+
+         blaze::CompressedMatrix<double,rowMajor> C( m, n );
+         for( size_t i=0UL; i<m; ++i ) {
+            for( size_t j=i%3UL; j<n; j+=3UL ) {
+               C(i,j) = A(i,j);
+            }
+         }
+         runDualMultTest<double>( C );
+
+         const blaze::CompressedMatrix<double,columnMajor> D( C );
+         runDualMultTest<double>( D );
+
+         const blaze::DynamicMatrix< std::complex<double> > E(
+            blaze::rand< blaze::DynamicMatrix< std::complex<double> > >( m, n ) );
+         runDualMultTest< std::complex<double> >( E );
+      }
+   }
+
+   // Dual multiplication with an adaptor
+   {
+      const blaze::SymmetricMatrix< blaze::DynamicMatrix<double> > S( system<double>( 8UL, 0.0 ) );
+      runDualMultTest<double>( S );
+   }
+
+   // Dual multiplication with target vectors identical to the operands
+   {
+      const blaze::CompressedMatrix<double> A( system<double>( 8UL, 0.3 ) );
+      blaze::DynamicVector<double> x( blaze::rand< blaze::DynamicVector<double> >( 64UL ) );
+      blaze::DynamicVector<double> w( blaze::rand< blaze::DynamicVector<double> >( 64UL ) );
+      const blaze::DynamicVector<double> yref( A * x );
+      const blaze::DynamicVector<double> zref( trans( A ) * w );
+
+      blaze::multiplyBoth( A, x, w, w, x );
+
+      if( norm( w - yref ) > 1E-10 || norm( x - zref ) > 1E-10 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Dual multiplication with aliased vectors failed\n"
+             << " Details:\n"
+             << "   Result of A*x:\n" << w << "\n"
+             << "   Expected result:\n" << yref << "\n"
+             << "   Result of trans(A)*w:\n" << x << "\n"
+             << "   Expected result:\n" << zref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Dual multiplication with vectors of invalid size
+   try {
+      const blaze::DynamicMatrix<double> A( 4UL, 5UL, 1.0 );
+      const blaze::DynamicVector<double> x( 4UL, 1.0 ), w( 4UL, 1.0 );
+      blaze::DynamicVector<double> y, z;
+
+      blaze::multiplyBoth( A, x, w, y, z );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Dual multiplication with vectors of invalid size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the special cases of all iterative solvers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the behavior of all solvers for a zero right-hand side, for an initial
+// guess that already solves the system and for an exhausted iteration limit. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSpecialCases()
+{
+   test_ = "Special cases";
+
+   const blaze::CompressedMatrix<double> A( system<double>( 16UL, 0.0 ) );
+   const blaze::IdentityPreconditioner I;
+   const Solver solvers[] = { cgSolver, bicgstabSolver, gmresSolver };
+
+   for( Solver solver : solvers )
+   {
+      // Solving with a zero right-hand side
+      {
+         const blaze::DynamicVector<double> b( 256UL, 0.0 );
+         blaze::DynamicVector<double> x( blaze::rand< blaze::DynamicVector<double> >( 256UL ) );
+
+         const blaze::SolverResult result( solve( solver, A, x, b, I, blaze::SolverControl() ) );
+
+         if( !result.converged || result.iterations != 0UL || x != b ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Solving with zero right-hand side failed\n"
+                << " Details:\n"
+                << "   Solver: " << name( solver ) << "\n"
+                << "   Converged : " << result.converged << "\n"
+                << "   Iterations: " << result.iterations << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Solving with an initial guess that already solves the system
+      {
+         const blaze::DynamicVector<double> b( blaze::rand< blaze::DynamicVector<double> >( 256UL ) );
+         blaze::DynamicVector<double> x( 256UL, 0.0 );
+
+         solve( solver, A, x, b, I, blaze::SolverControl( 1E-12 ) );
+         const blaze::SolverResult result( solve( solver, A, x, b, I, blaze::SolverControl( 1E-8 ) ) );
+
+         if( !result.converged || result.iterations != 0UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Solving with exact initial guess failed\n"
+                << " Details:\n"
+                << "   Solver: " << name( solver ) << "\n"
+                << "   Converged : " << result.converged << "\n"
+                << "   Iterations: " << result.iterations << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Solving with an exhausted iteration limit
+      {
+         const blaze::DynamicVector<double> b( blaze::rand< blaze::DynamicVector<double> >( 256UL ) );
+         blaze::DynamicVector<double> x( 256UL, 0.0 );
+
+         const blaze::SolverResult result( solve( solver, A, x, b, I, blaze::SolverControl( 1E-12, 3UL ) ) );
+
+         if( result.converged || result.iterations != 3UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iteration limit not respected\n"
+                << " Details:\n"
+                << "   Solver: " << name( solver ) << "\n"
+                << "   Converged : " << result.converged << "\n"
+                << "   Iterations: " << result.iterations << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the failure cases of all iterative solvers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that all solvers and preconditioners reject invalid arguments. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFailures()
+{
+   test_ = "Failures";
+
+   const blaze::IdentityPreconditioner I;
+   const Solver solvers[] = { cgSolver, bicgstabSolver, gmresSolver };
+
+   for( Solver solver : solvers )
+   {
+      // Solving with a non-square system matrix
+      try {
+         const blaze::DynamicMatrix<double> A( 4UL, 5UL, 1.0 );
+         const blaze::DynamicVector<double> b( 4UL, 1.0 );
+         blaze::DynamicVector<double> x( 5UL, 0.0 );
+
+         solve( solver, A, x, b, I, blaze::SolverControl() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving with non-square system matrix succeeded\n"
+             << " Details:\n"
+             << "   Solver: " << name( solver ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      // Solving with a right-hand side of invalid size
+      try {
+         const blaze::CompressedMatrix<double> A( system<double>( 4UL, 0.0 ) );
+         const blaze::DynamicVector<double> b( 15UL, 1.0 );
+         blaze::DynamicVector<double> x( 16UL, 0.0 );
+
+         solve( solver, A, x, b, I, blaze::SolverControl() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving with right-hand side of invalid size succeeded\n"
+             << " Details:\n"
+             << "   Solver: " << name( solver ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      // Solving with a matrix-free operator of invalid size
+      try {
+         const ConvectionDiffusion<double> op( 4UL, 0.0 );
+         const blaze::DynamicVector<double> b( 25UL, 1.0 );
+         blaze::DynamicVector<double> x( 25UL, 0.0 );
+
+         solve( solver, op, x, b, I, blaze::SolverControl() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving with matrix-free operator of invalid size succeeded\n"
+             << " Details:\n"
+             << "   Solver: " << name( solver ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      // Solving with a preconditioner of invalid size
+      try {
+         const blaze::CompressedMatrix<double> A( system<double>( 4UL, 0.0 ) );
+         const blaze::DynamicVector<double> b( 16UL, 1.0 );
+         blaze::DynamicVector<double> x( 16UL, 0.0 );
+
+         solve( solver, A, x, b, blaze::JacobiPreconditioner<double>(
+            blaze::DynamicVector<double>( 15UL, 1.0 ) ), blaze::SolverControl() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving with preconditioner of invalid size succeeded\n"
+             << " Details:\n"
+             << "   Solver: " << name( solver ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   // Construction of a Jacobi preconditioner for a non-square matrix
+   try {
+      const blaze::DynamicMatrix<double> A( 4UL, 5UL, 1.0 );
+      const blaze::JacobiPreconditioner<double> M( A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Construction of Jacobi preconditioner for non-square matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Construction of a Jacobi preconditioner for a matrix with zero diagonal element
+   try {
+      blaze::CompressedMatrix<double> A( system<double>( 4UL, 0.0 ) );
+      A.erase( 2UL, 2UL );
+      const blaze::JacobiPreconditioner<double> M( A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Construction of Jacobi preconditioner with zero diagonal element succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the given solver.
+//
+// \param solver The solver.
+// \return The name of the solver.
+*/
+const char* ClassTest::name( Solver solver ) const
+{
+   switch( solver ) {
+      case cgSolver      : return "cg()";
+      case bicgstabSolver: return "bicgstab()";
+      default            : return "gmres()";
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running iterative solver test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during iterative solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
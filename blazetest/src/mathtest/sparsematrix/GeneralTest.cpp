@@ -41,6 +41,7 @@
 #include <iostream>
 #include <blaze/math/sparse/SparseMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
 #include <blazetest/mathtest/sparsematrix/GeneralTest.h>
 
 
@@ -4621,6 +4622,246 @@ void GeneralTest::testMaximum()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the row-wise and column-wise reduction functions for sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the row-wise and column-wise \c reduce(), \c sum(),
+// \c min(), and \c max() functions for sparse matrices. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testPartialReduce()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major partial reduction";
+
+      // Row-wise and column-wise sums of a 3x2 matrix
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 2UL );
+         mat(0,0) =  1;
+         mat(0,1) = -2;
+         mat(1,1) = -4;
+         mat(2,0) =  5;
+
+         blaze::DynamicVector<int,blaze::columnVector> rowsum( blaze::sum<blaze::rowwise>( mat ) );
+         blaze::DynamicVector<int,blaze::rowVector> colsum( blaze::sum<blaze::columnwise>( mat ) );
+
+         if( rowsum.size() != 3UL || rowsum[0] != -1 || rowsum[1] != -4 || rowsum[2] != 5 ||
+             colsum.size() != 2UL || colsum[0] !=  6 || colsum[1] != -6 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Sum computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rowsum << colsum << "\n"
+                << "   Expected result:\n( -1 -4 5 )\n( 6 -6 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Row-wise and column-wise minimum and maximum of a 3x2 matrix
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 2UL );
+         mat(0,0) =  1;
+         mat(0,1) = -2;
+         mat(1,1) = -4;
+         mat(2,0) =  5;
+
+         blaze::DynamicVector<int,blaze::columnVector> rowmin( blaze::min<blaze::rowwise>( mat ) );
+         blaze::DynamicVector<int,blaze::rowVector> colmax( blaze::max<blaze::columnwise>( mat ) );
+
+         if( rowmin[0] != -2 || rowmin[1] != -4 || rowmin[2] != 0 ||
+             colmax[0] !=  5 || colmax[1] !=  0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Minimum/maximum computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rowmin << colmax << "\n"
+                << "   Expected result:\n( -2 -4 0 )\n( 5 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Custom reduction of a 3x2 matrix
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 2UL );
+         mat(0,0) =  1;
+         mat(0,1) = -2;
+         mat(1,1) = -4;
+         mat(2,0) =  5;
+
+         blaze::DynamicVector<int,blaze::rowVector> colsum(
+            blaze::reduce<blaze::columnwise>( mat, []( int a, int b ){ return a + b; } ) );
+
+         if( colsum[0] != 6 || colsum[1] != -6 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Custom reduction failed\n"
+                << " Details:\n"
+                << "   Result:\n" << colsum << "\n"
+                << "   Expected result:\n( 6 -6 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Row-wise and column-wise sums of a large matrix (with vectorized and remainder elements)
+      {
+         blaze::CompressedMatrix<double,blaze::rowMajor> mat( 37UL, 1100UL );
+         for( size_t i=0UL; i<mat.rows(); ++i )
+            for( size_t j=0UL; j<mat.columns(); ++j )
+               if( ( i + j ) % 3UL == 0UL ) mat(i,j) = double( i + j );
+         blaze::DynamicVector<double,blaze::columnVector> rowsum( blaze::sum<blaze::rowwise>( mat ) );
+         blaze::DynamicVector<double,blaze::rowVector> colsum( blaze::sum<blaze::columnwise>( mat ) );
+
+         for( size_t i=0UL; i<mat.rows(); ++i ) {
+            if( rowsum[i] != blaze::sum( row( mat, i ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Row-wise sum computation failed\n"
+                   << " Details:\n"
+                   << "   Row: " << i << "\n"
+                   << "   Result: " << rowsum[i] << "\n"
+                   << "   Expected result: " << blaze::sum( row( mat, i ) ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            if( colsum[j] != blaze::sum( column( mat, j ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Column-wise sum computation failed\n"
+                   << " Details:\n"
+                   << "   Column: " << j << "\n"
+                   << "   Result: " << colsum[j] << "\n"
+                   << "   Expected result: " << blaze::sum( column( mat, j ) ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major partial reduction";
+
+      // Row-wise and column-wise sums of a 3x2 matrix
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3UL, 2UL );
+         mat(0,0) =  1;
+         mat(0,1) = -2;
+         mat(1,1) = -4;
+         mat(2,0) =  5;
+
+         blaze::DynamicVector<int,blaze::columnVector> rowsum( blaze::sum<blaze::rowwise>( mat ) );
+         blaze::DynamicVector<int,blaze::rowVector> colsum( blaze::sum<blaze::columnwise>( mat ) );
+
+         if( rowsum.size() != 3UL || rowsum[0] != -1 || rowsum[1] != -4 || rowsum[2] != 5 ||
+             colsum.size() != 2UL || colsum[0] !=  6 || colsum[1] != -6 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Sum computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rowsum << colsum << "\n"
+                << "   Expected result:\n( -1 -4 5 )\n( 6 -6 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Row-wise and column-wise minimum and maximum of a 3x2 matrix
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3UL, 2UL );
+         mat(0,0) =  1;
+         mat(0,1) = -2;
+         mat(1,1) = -4;
+         mat(2,0) =  5;
+
+         blaze::DynamicVector<int,blaze::columnVector> rowmin( blaze::min<blaze::rowwise>( mat ) );
+         blaze::DynamicVector<int,blaze::rowVector> colmax( blaze::max<blaze::columnwise>( mat ) );
+
+         if( rowmin[0] != -2 || rowmin[1] != -4 || rowmin[2] != 0 ||
+             colmax[0] !=  5 || colmax[1] !=  0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Minimum/maximum computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rowmin << colmax << "\n"
+                << "   Expected result:\n( -2 -4 0 )\n( 5 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Custom reduction of a 3x2 matrix
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3UL, 2UL );
+         mat(0,0) =  1;
+         mat(0,1) = -2;
+         mat(1,1) = -4;
+         mat(2,0) =  5;
+
+         blaze::DynamicVector<int,blaze::rowVector> colsum(
+            blaze::reduce<blaze::columnwise>( mat, []( int a, int b ){ return a + b; } ) );
+
+         if( colsum[0] != 6 || colsum[1] != -6 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Custom reduction failed\n"
+                << " Details:\n"
+                << "   Result:\n" << colsum << "\n"
+                << "   Expected result:\n( 6 -6 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Row-wise and column-wise sums of a large matrix (with vectorized and remainder elements)
+      {
+         blaze::CompressedMatrix<double,blaze::columnMajor> mat( 37UL, 1100UL );
+         for( size_t i=0UL; i<mat.rows(); ++i )
+            for( size_t j=0UL; j<mat.columns(); ++j )
+               if( ( i + j ) % 3UL == 0UL ) mat(i,j) = double( i + j );
+         blaze::DynamicVector<double,blaze::columnVector> rowsum( blaze::sum<blaze::rowwise>( mat ) );
+         blaze::DynamicVector<double,blaze::rowVector> colsum( blaze::sum<blaze::columnwise>( mat ) );
+
+         for( size_t i=0UL; i<mat.rows(); ++i ) {
+            if( rowsum[i] != blaze::sum( row( mat, i ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Row-wise sum computation failed\n"
+                   << " Details:\n"
+                   << "   Row: " << i << "\n"
+                   << "   Result: " << rowsum[i] << "\n"
+                   << "   Expected result: " << blaze::sum( row( mat, i ) ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            if( colsum[j] != blaze::sum( column( mat, j ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Column-wise sum computation failed\n"
+                   << " Details:\n"
+                   << "   Column: " << j << "\n"
+                   << "   Result: " << colsum[j] << "\n"
+                   << "   Expected result: " << blaze::sum( column( mat, j ) ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace sparsematrix
 
 } // namespace mathtest
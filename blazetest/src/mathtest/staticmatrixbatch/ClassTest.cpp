@@ -0,0 +1,365 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/staticmatrixbatch/ClassTest.cpp
+//  \brief Source file for the StaticMatrixBatch class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/staticmatrixbatch/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace staticmatrixbatch {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the StaticMatrixBatch class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testAccess();
+   testMultiplication();
+   testDeterminant();
+   testInversion();
+   testLLH();
+   testFailures();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the element access and the utility functions of StaticMatrixBatch.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the element access functions as well as the resize(), copy and move
+// operations of the StaticMatrixBatch class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAccess()
+{
+   test_ = "StaticMatrixBatch element access";
+
+   typedef blaze::StaticMatrix<double,2UL,3UL>  MT;
+
+   blaze::StaticMatrixBatch<double,2UL,3UL> A( 7UL );
+   std::vector< MT, blaze::AlignedAllocator<MT> > ref( 7UL );
+
+   for( size_t k=0UL; k<A.size(); ++k ) {
+      ref[k] = blaze::rand<MT>();
+      A.set( k, ref[k] );
+   }
+
+   A(3UL,1UL,2UL) = 5.0;
+   ref[3UL](1UL,2UL) = 5.0;
+
+   A.resize( 20UL );
+
+   blaze::StaticMatrixBatch<double,2UL,3UL> B( A );
+   blaze::StaticMatrixBatch<double,2UL,3UL> C( std::move( B ) );
+
+   if( A.size() != 20UL || C.size() != 20UL || B.size() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid batch size detected\n"
+          << " Details:\n"
+          << "   Sizes: " << A.size() << ", " << B.size() << ", " << C.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t k=0UL; k<ref.size(); ++k ) {
+      if( C.get(k) != ref[k] || C.at(k,1UL,2UL) != ref[k](1UL,2UL) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element access failed\n"
+             << " Details:\n"
+             << "   Matrix index: " << k << "\n"
+             << "   Result:\n" << C.get(k) << "\n"
+             << "   Expected result:\n" << ref[k] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   try {
+      C.at( 20UL, 0UL, 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bounds access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched matrix/matrix and matrix/vector multiplications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testMultiplication()
+{
+   test_ = "Batched multiplication";
+
+   for( size_t n=0UL; n<20UL; n+=3UL ) {
+      runMultTest<float,3UL,3UL,3UL>( n );
+      runMultTest<double,3UL,3UL,3UL>( n );
+      runMultTest<float,6UL,6UL,6UL>( n );
+      runMultTest<double,6UL,6UL,6UL>( n );
+      runMultTest<double,2UL,5UL,3UL>( n );
+   }
+
+   runMultTest<double,3UL,3UL,3UL>( 5003UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched determinant computation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testDeterminant()
+{
+   test_ = "Batched determinant";
+
+   for( size_t n=1UL; n<20UL; n+=3UL ) {
+      runDetTest<float,2UL>( n );
+      runDetTest<double,3UL>( n );
+      runDetTest<float,4UL>( n );
+      runDetTest<double,5UL>( n );
+      runDetTest<float,6UL>( n );
+      runDetTest<double,6UL>( n );
+   }
+
+   runDetTest<double,6UL>( 5003UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched matrix inversion.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testInversion()
+{
+   test_ = "Batched inversion";
+
+   for( size_t n=1UL; n<20UL; n+=3UL ) {
+      runInvTest<double,2UL>( n );
+      runInvTest<float,3UL>( n );
+      runInvTest<double,3UL>( n );
+      runInvTest<double,4UL>( n );
+      runInvTest<float,5UL>( n );
+      runInvTest<float,6UL>( n );
+      runInvTest<double,6UL>( n );
+   }
+
+   runInvTest<double,6UL>( 5003UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched Cholesky decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testLLH()
+{
+   test_ = "Batched Cholesky decomposition";
+
+   for( size_t n=1UL; n<20UL; n+=3UL ) {
+      runLLHTest<float,3UL>( n );
+      runLLHTest<double,3UL>( n );
+      runLLHTest<float,6UL>( n );
+      runLLHTest<double,6UL>( n );
+      runLLHTest<double,9UL>( n );
+   }
+
+   runLLHTest<double,6UL>( 5003UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the batched kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that singular and non-positive-definite matrices as well as mismatching
+// batch sizes are detected. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testFailures()
+{
+   test_ = "Batched kernel failures";
+
+   // Inversion of a batch containing a singular matrix
+   {
+      blaze::StaticMatrixBatch<double,3UL,3UL> A( 11UL );
+      randomize( A );
+      A.set( 10UL, blaze::StaticMatrix<double,3UL,3UL>( 1.0 ) );
+
+      const blaze::StaticMatrixBatch<double,3UL,3UL> B( A );
+
+      try {
+         invert( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Inversion of singular matrix failed" )
+            throw;
+      }
+
+      for( size_t k=0UL; k<A.size(); ++k ) {
+         if( A.get(k) != B.get(k) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Failed inversion modified the batch\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   // Decomposition of a batch containing a non-positive-definite matrix
+   {
+      blaze::StaticMatrixBatch<float,4UL,4UL> A( 5UL ), L;
+      for( size_t k=0UL; k<A.size(); ++k ) {
+         A.set( k, blaze::StaticMatrix<float,4UL,4UL>{ { 4.0F, 0.0F, 0.0F, 0.0F },
+                                                       { 0.0F, 4.0F, 0.0F, 0.0F },
+                                                       { 0.0F, 0.0F, 4.0F, 0.0F },
+                                                       { 0.0F, 0.0F, 0.0F, 4.0F } } );
+      }
+      A(2UL,3UL,3UL) = -1.0F;
+
+      try {
+         llh( A, L );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition of non-positive-definite matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Decomposition of non-positive-definite matrix failed" )
+            throw;
+      }
+   }
+
+   // Multiplication of batches with different sizes
+   {
+      blaze::StaticMatrixBatch<double,3UL,3UL> A( 4UL ), B( 5UL ), C;
+
+      try {
+         C = A * B;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication of batches with different sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace staticmatrixbatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running StaticMatrixBatch class test..." << std::endl;
+
+   try
+   {
+      RUN_STATICMATRIXBATCH_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during StaticMatrixBatch class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
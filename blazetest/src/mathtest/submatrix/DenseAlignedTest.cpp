@@ -166,7 +166,7 @@ void DenseAlignedTest::testConstructors()
       }
 
       try {
-         ASMT sm = submatrix<aligned>( mat1_, 0UL, 8UL, 64UL, 64UL );
+         ASMT sm = submatrix<aligned>( mat1_, 0UL, 16UL, 64UL, 64UL );
 
          std::ostringstream oss;
          oss << " Test: " << test_ << "\n"
@@ -284,7 +284,7 @@ void DenseAlignedTest::testConstructors()
       catch( std::invalid_argument& ) {}
 
       try {
-         AOSMT sm = submatrix<aligned>( tmat1_, 8UL, 0UL, 64UL, 64UL );
+         AOSMT sm = submatrix<aligned>( tmat1_, 16UL, 0UL, 64UL, 64UL );
 
          std::ostringstream oss;
          oss << " Test: " << test_ << "\n"
@@ -390,8 +390,8 @@ void DenseAlignedTest::testAssignment()
 
       // Assigning to a 16x8 submatrix
       {
-         ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 8UL, 16UL, 8UL );
-         USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 8UL, 16UL, 8UL );
+         ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 16UL, 16UL, 8UL );
+         USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 16UL, 16UL, 8UL );
          sm1 = 15;
          sm2 = 15;
 
@@ -534,8 +534,8 @@ void DenseAlignedTest::testAssignment()
 
       ASMT sm1 = submatrix<aligned>  ( mat1_, 8UL, 16UL, 8UL, 16UL );
       USMT sm2 = submatrix<unaligned>( mat2_, 8UL, 16UL, 8UL, 16UL );
-      sm1 = submatrix<aligned>  ( mat1_, 24UL, 24UL, 8UL, 16UL );
-      sm2 = submatrix<unaligned>( mat2_, 24UL, 24UL, 8UL, 16UL );
+      sm1 = submatrix<aligned>  ( mat1_, 24UL, 48UL, 8UL, 16UL );
+      sm2 = submatrix<unaligned>( mat2_, 24UL, 48UL, 8UL, 16UL );
 
       checkRows   ( sm1,  8UL );
       checkColumns( sm1, 16UL );
@@ -821,8 +821,8 @@ void DenseAlignedTest::testAssignment()
 
       // Assigning to a 8x16 submatrix
       {
-         AOSMT sm1 = submatrix<aligned>  ( tmat1_, 8UL, 16UL, 8UL, 16UL );
-         UOSMT sm2 = submatrix<unaligned>( tmat2_, 8UL, 16UL, 8UL, 16UL );
+         AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 16UL, 8UL, 16UL );
+         UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 16UL, 8UL, 16UL );
          sm1 = 12;
          sm2 = 12;
 
@@ -1004,8 +1004,8 @@ void DenseAlignedTest::testAssignment()
 
       AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 8UL, 16UL, 8UL );
       UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 8UL, 16UL, 8UL );
-      sm1 = submatrix<aligned>  ( tmat1_, 24UL, 24UL, 16UL, 8UL );
-      sm2 = submatrix<unaligned>( tmat2_, 24UL, 24UL, 16UL, 8UL );
+      sm1 = submatrix<aligned>  ( tmat1_, 48UL, 24UL, 16UL, 8UL );
+      sm2 = submatrix<unaligned>( tmat2_, 48UL, 24UL, 16UL, 8UL );
 
       checkRows   ( sm1, 16UL );
       checkColumns( sm1,  8UL );
@@ -1344,8 +1344,8 @@ void DenseAlignedTest::testAddAssign()
 
       ASMT sm1 = submatrix<aligned>  ( mat1_, 8UL, 16UL, 8UL, 16UL );
       USMT sm2 = submatrix<unaligned>( mat2_, 8UL, 16UL, 8UL, 16UL );
-      sm1 += submatrix<aligned>  ( mat1_, 24UL, 24UL, 8UL, 16UL );
-      sm2 += submatrix<unaligned>( mat2_, 24UL, 24UL, 8UL, 16UL );
+      sm1 += submatrix<aligned>  ( mat1_, 24UL, 48UL, 8UL, 16UL );
+      sm2 += submatrix<unaligned>( mat2_, 24UL, 48UL, 8UL, 16UL );
 
       checkRows   ( sm1,  8UL );
       checkColumns( sm1, 16UL );
@@ -1662,8 +1662,8 @@ void DenseAlignedTest::testAddAssign()
 
       AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 8UL, 16UL, 8UL );
       UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 8UL, 16UL, 8UL );
-      sm1 += submatrix<aligned>  ( tmat1_, 24UL, 24UL, 16UL, 8UL );
-      sm2 += submatrix<unaligned>( tmat2_, 24UL, 24UL, 16UL, 8UL );
+      sm1 += submatrix<aligned>  ( tmat1_, 48UL, 24UL, 16UL, 8UL );
+      sm2 += submatrix<unaligned>( tmat2_, 48UL, 24UL, 16UL, 8UL );
 
       checkRows   ( sm1, 16UL );
       checkColumns( sm1,  8UL );
@@ -2002,8 +2002,8 @@ void DenseAlignedTest::testSubAssign()
 
       ASMT sm1 = submatrix<aligned>  ( mat1_, 8UL, 16UL, 8UL, 16UL );
       USMT sm2 = submatrix<unaligned>( mat2_, 8UL, 16UL, 8UL, 16UL );
-      sm1 -= submatrix<aligned>  ( mat1_, 24UL, 24UL, 8UL, 16UL );
-      sm2 -= submatrix<unaligned>( mat2_, 24UL, 24UL, 8UL, 16UL );
+      sm1 -= submatrix<aligned>  ( mat1_, 24UL, 48UL, 8UL, 16UL );
+      sm2 -= submatrix<unaligned>( mat2_, 24UL, 48UL, 8UL, 16UL );
 
       checkRows   ( sm1,  8UL );
       checkColumns( sm1, 16UL );
@@ -2320,8 +2320,8 @@ void DenseAlignedTest::testSubAssign()
 
       AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 8UL, 16UL, 8UL );
       UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 8UL, 16UL, 8UL );
-      sm1 -= submatrix<aligned>  ( tmat1_, 24UL, 24UL, 16UL, 8UL );
-      sm2 -= submatrix<unaligned>( tmat2_, 24UL, 24UL, 16UL, 8UL );
+      sm1 -= submatrix<aligned>  ( tmat1_, 48UL, 24UL, 16UL, 8UL );
+      sm2 -= submatrix<unaligned>( tmat2_, 48UL, 24UL, 16UL, 8UL );
 
       checkRows   ( sm1, 16UL );
       checkColumns( sm1,  8UL );
@@ -2660,8 +2660,8 @@ void DenseAlignedTest::testMultAssign()
 
       ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 16UL, 8UL, 8UL );
       USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 16UL, 8UL, 8UL );
-      sm1 *= submatrix<aligned>  ( mat1_, 24UL, 24UL, 8UL, 8UL );
-      sm2 *= submatrix<unaligned>( mat2_, 24UL, 24UL, 8UL, 8UL );
+      sm1 *= submatrix<aligned>  ( mat1_, 24UL, 48UL, 8UL, 8UL );
+      sm2 *= submatrix<unaligned>( mat2_, 24UL, 48UL, 8UL, 8UL );
 
       checkRows   ( sm1, 8UL );
       checkColumns( sm1, 8UL );
@@ -2978,8 +2978,8 @@ void DenseAlignedTest::testMultAssign()
 
       AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 16UL, 8UL, 8UL );
       UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 16UL, 8UL, 8UL );
-      sm1 *= submatrix<aligned>  ( tmat1_, 24UL, 24UL, 8UL, 8UL );
-      sm2 *= submatrix<unaligned>( tmat2_, 24UL, 24UL, 8UL, 8UL );
+      sm1 *= submatrix<aligned>  ( tmat1_, 48UL, 24UL, 8UL, 8UL );
+      sm2 *= submatrix<unaligned>( tmat2_, 48UL, 24UL, 8UL, 8UL );
 
       checkRows   ( sm1, 8UL );
       checkColumns( sm1, 8UL );
@@ -3308,8 +3308,8 @@ void DenseAlignedTest::testScaling()
 
       initialize();
 
-      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 8UL, 16UL, 8UL );
-      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 8UL, 16UL, 8UL );
+      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 16UL, 16UL, 8UL );
+      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 16UL, 16UL, 8UL );
 
       sm1 *= 3;
       sm2 *= 3;
@@ -3367,8 +3367,8 @@ void DenseAlignedTest::testScaling()
 
       initialize();
 
-      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 8UL, 16UL, 8UL );
-      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 8UL, 16UL, 8UL );
+      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 16UL, 16UL, 8UL );
+      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 16UL, 16UL, 8UL );
 
       sm1 = sm1 * 3;
       sm2 = sm2 * 3;
@@ -3426,8 +3426,8 @@ void DenseAlignedTest::testScaling()
 
       initialize();
 
-      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 8UL, 16UL, 8UL );
-      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 8UL, 16UL, 8UL );
+      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 16UL, 16UL, 8UL );
+      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 16UL, 16UL, 8UL );
 
       sm1 = 3 * sm1;
       sm2 = 3 * sm2;
@@ -3485,8 +3485,8 @@ void DenseAlignedTest::testScaling()
 
       initialize();
 
-      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 8UL, 16UL, 8UL );
-      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 8UL, 16UL, 8UL );
+      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 16UL, 16UL, 8UL );
+      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 16UL, 16UL, 8UL );
 
       sm1 /= 0.5;
       sm2 /= 0.5;
@@ -3544,8 +3544,8 @@ void DenseAlignedTest::testScaling()
 
       initialize();
 
-      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 8UL, 16UL, 8UL );
-      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 8UL, 16UL, 8UL );
+      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 16UL, 16UL, 8UL );
+      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 16UL, 16UL, 8UL );
 
       sm1 = sm1 / 0.5;
       sm2 = sm2 / 0.5;
@@ -3634,8 +3634,8 @@ void DenseAlignedTest::testScaling()
 
       initialize();
 
-      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 8UL, 16UL, 8UL, 16UL );
-      UOSMT sm2 = submatrix<unaligned>( tmat2_, 8UL, 16UL, 8UL, 16UL );
+      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 16UL, 8UL, 16UL );
+      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 16UL, 8UL, 16UL );
 
       sm1 *= 3;
       sm2 *= 3;
@@ -3693,8 +3693,8 @@ void DenseAlignedTest::testScaling()
 
       initialize();
 
-      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 8UL, 16UL, 8UL, 16UL );
-      UOSMT sm2 = submatrix<unaligned>( tmat2_, 8UL, 16UL, 8UL, 16UL );
+      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 16UL, 8UL, 16UL );
+      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 16UL, 8UL, 16UL );
 
       sm1 = sm1 * 3;
       sm2 = sm2 * 3;
@@ -3752,8 +3752,8 @@ void DenseAlignedTest::testScaling()
 
       initialize();
 
-      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 8UL, 16UL, 8UL, 16UL );
-      UOSMT sm2 = submatrix<unaligned>( tmat2_, 8UL, 16UL, 8UL, 16UL );
+      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 16UL, 8UL, 16UL );
+      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 16UL, 8UL, 16UL );
 
       sm1 = 3 * sm1;
       sm2 = 3 * sm2;
@@ -3811,8 +3811,8 @@ void DenseAlignedTest::testScaling()
 
       initialize();
 
-      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 8UL, 16UL, 8UL, 16UL );
-      UOSMT sm2 = submatrix<unaligned>( tmat2_, 8UL, 16UL, 8UL, 16UL );
+      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 16UL, 8UL, 16UL );
+      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 16UL, 8UL, 16UL );
 
       sm1 /= 0.5;
       sm2 /= 0.5;
@@ -3870,8 +3870,8 @@ void DenseAlignedTest::testScaling()
 
       initialize();
 
-      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 8UL, 16UL, 8UL, 16UL );
-      UOSMT sm2 = submatrix<unaligned>( tmat2_, 8UL, 16UL, 8UL, 16UL );
+      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 16UL, 8UL, 16UL );
+      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 16UL, 8UL, 16UL );
 
       sm1 = sm1 / 0.5;
       sm2 = sm2 / 0.5;
@@ -4409,7 +4409,7 @@ void DenseAlignedTest::testIterator()
       {
          test_ = "Row-major ConstIterator subtraction";
 
-         ASMT sm = submatrix<aligned>( mat1_, 16UL, 8UL, 16UL, 8UL );
+         ASMT sm = submatrix<aligned>( mat1_, 16UL, 16UL, 16UL, 8UL );
          const size_t number( cend( sm, 15UL ) - cbegin( sm, 15UL ) );
 
          if( number != 8UL ) {
@@ -4699,7 +4699,7 @@ void DenseAlignedTest::testIterator()
       {
          test_ = "Column-major Iterator/ConstIterator conversion";
 
-         AOSMT sm = submatrix<aligned>( tmat1_, 8UL, 16UL, 8UL, 16UL );
+         AOSMT sm = submatrix<aligned>( tmat1_, 16UL, 16UL, 8UL, 16UL );
          AOSMT::ConstIterator it( begin( sm, 2UL ) );
 
          if( it == end( sm, 2UL ) || *it != sm(0,2) ) {
@@ -4732,7 +4732,7 @@ void DenseAlignedTest::testIterator()
       {
          test_ = "Column-major ConstIterator subtraction";
 
-         AOSMT sm = submatrix<aligned>( tmat1_, 8UL, 16UL, 8UL, 16UL );
+         AOSMT sm = submatrix<aligned>( tmat1_, 16UL, 16UL, 8UL, 16UL );
          const size_t number( cend( sm, 15UL ) - cbegin( sm, 15UL ) );
 
          if( number != 8UL ) {
@@ -6246,10 +6246,10 @@ void DenseAlignedTest::testSubmatrix()
       initialize();
 
       {
-         ASMT sm1 = submatrix<aligned>  ( mat1_, 8UL, 8UL, 16UL, 32UL );
-         ASMT sm2 = submatrix<aligned>  ( sm1  , 8UL, 8UL,  8UL, 16UL );
-         USMT sm3 = submatrix<unaligned>( mat2_, 8UL, 8UL, 16UL, 32UL );
-         USMT sm4 = submatrix<unaligned>( sm3  , 8UL, 8UL,  8UL, 16UL );
+         ASMT sm1 = submatrix<aligned>  ( mat1_, 8UL, 16UL, 16UL, 32UL );
+         ASMT sm2 = submatrix<aligned>  ( sm1  , 8UL, 16UL,  8UL, 16UL );
+         USMT sm3 = submatrix<unaligned>( mat2_, 8UL, 16UL, 16UL, 32UL );
+         USMT sm4 = submatrix<unaligned>( sm3  , 8UL, 16UL,  8UL, 16UL );
 
          if( sm2 != sm4 || mat1_ != mat2_ ) {
             std::ostringstream oss;
@@ -6283,8 +6283,8 @@ void DenseAlignedTest::testSubmatrix()
       }
 
       try {
-         ASMT sm1 = submatrix<aligned>( mat1_,  8UL, 8UL, 16UL, 32UL );
-         ASMT sm2 = submatrix<aligned>( sm1  , 16UL, 8UL,  8UL,  8UL );
+         ASMT sm1 = submatrix<aligned>( mat1_,  8UL, 16UL, 16UL, 32UL );
+         ASMT sm2 = submatrix<aligned>( sm1  , 16UL, 16UL,  8UL,  8UL );
 
          std::ostringstream oss;
          oss << " Test: " << test_ << "\n"
@@ -6296,7 +6296,7 @@ void DenseAlignedTest::testSubmatrix()
       catch( std::invalid_argument& ) {}
 
       try {
-         ASMT sm1 = submatrix<aligned>( mat1_, 8UL,  8UL, 16UL, 32UL );
+         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, 16UL, 16UL, 32UL );
          ASMT sm2 = submatrix<aligned>( sm1  , 8UL, 32UL,  8UL,  8UL );
 
          std::ostringstream oss;
@@ -6309,8 +6309,8 @@ void DenseAlignedTest::testSubmatrix()
       catch( std::invalid_argument& ) {}
 
       try {
-         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, 8UL, 16UL, 32UL );
-         ASMT sm2 = submatrix<aligned>( sm1  , 8UL, 8UL, 16UL, 24UL );
+         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, 16UL, 16UL, 32UL );
+         ASMT sm2 = submatrix<aligned>( sm1  , 8UL, 16UL, 16UL, 16UL );
 
          std::ostringstream oss;
          oss << " Test: " << test_ << "\n"
@@ -6322,8 +6322,8 @@ void DenseAlignedTest::testSubmatrix()
       catch( std::invalid_argument& ) {}
 
       try {
-         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, 8UL, 16UL, 32UL );
-         ASMT sm2 = submatrix<aligned>( sm1  , 8UL, 8UL,  8UL, 32UL );
+         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, 16UL, 16UL, 32UL );
+         ASMT sm2 = submatrix<aligned>( sm1  , 8UL, 16UL,  8UL, 32UL );
 
          std::ostringstream oss;
          oss << " Test: " << test_ << "\n"
@@ -6346,10 +6346,10 @@ void DenseAlignedTest::testSubmatrix()
       initialize();
 
       {
-         AOSMT sm1 = submatrix<aligned>  ( tmat1_, 8UL, 8UL, 32UL, 16UL );
-         AOSMT sm2 = submatrix<aligned>  ( sm1   , 8UL, 8UL, 16UL,  8UL );
-         UOSMT sm3 = submatrix<unaligned>( tmat2_, 8UL, 8UL, 32UL, 16UL );
-         UOSMT sm4 = submatrix<unaligned>( sm3   , 8UL, 8UL, 16UL,  8UL );
+         AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 8UL, 32UL, 16UL );
+         AOSMT sm2 = submatrix<aligned>  ( sm1   , 16UL, 8UL, 16UL,  8UL );
+         UOSMT sm3 = submatrix<unaligned>( tmat2_, 16UL, 8UL, 32UL, 16UL );
+         UOSMT sm4 = submatrix<unaligned>( sm3   , 16UL, 8UL, 16UL,  8UL );
 
          if( sm2 != sm4 || mat1_ != mat2_ ) {
             std::ostringstream oss;
@@ -6383,8 +6383,8 @@ void DenseAlignedTest::testSubmatrix()
       }
 
       try {
-         ASMT sm1 = submatrix<aligned>( mat1_,  8UL, 8UL, 32UL, 16UL );
-         ASMT sm2 = submatrix<aligned>( sm1  , 32UL, 8UL,  8UL,  8UL );
+         ASMT sm1 = submatrix<aligned>( mat1_,  8UL, 16UL, 32UL, 16UL );
+         ASMT sm2 = submatrix<aligned>( sm1  , 32UL, 0UL,  8UL,  8UL );
 
          std::ostringstream oss;
          oss << " Test: " << test_ << "\n"
@@ -6396,7 +6396,7 @@ void DenseAlignedTest::testSubmatrix()
       catch( std::invalid_argument& ) {}
 
       try {
-         ASMT sm1 = submatrix<aligned>( mat1_, 8UL,  8UL, 32UL, 16UL );
+         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, 16UL, 32UL, 16UL );
          ASMT sm2 = submatrix<aligned>( sm1  , 8UL, 16UL,  8UL,  8UL );
 
          std::ostringstream oss;
@@ -6409,8 +6409,8 @@ void DenseAlignedTest::testSubmatrix()
       catch( std::invalid_argument& ) {}
 
       try {
-         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, 8UL, 32UL, 16UL );
-         ASMT sm2 = submatrix<aligned>( sm1  , 8UL, 8UL, 32UL,  8UL );
+         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, 16UL, 32UL, 16UL );
+         ASMT sm2 = submatrix<aligned>( sm1  , 8UL, 0UL, 32UL,  8UL );
 
          std::ostringstream oss;
          oss << " Test: " << test_ << "\n"
@@ -6422,8 +6422,8 @@ void DenseAlignedTest::testSubmatrix()
       catch( std::invalid_argument& ) {}
 
       try {
-         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, 8UL, 32UL, 16UL );
-         ASMT sm2 = submatrix<aligned>( sm1  , 8UL, 8UL, 24UL, 16UL );
+         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, 16UL, 32UL, 16UL );
+         ASMT sm2 = submatrix<aligned>( sm1  , 8UL, 16UL, 24UL, 16UL );
 
          std::ostringstream oss;
          oss << " Test: " << test_ << "\n"
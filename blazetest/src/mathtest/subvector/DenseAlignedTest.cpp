@@ -145,7 +145,7 @@ void DenseAlignedTest::testConstructors()
    }
 
    try {
-      ASVT sv = subvector<aligned>( vec1_, 8UL, 64UL );
+      ASVT sv = subvector<aligned>( vec1_, 16UL, 64UL );
 
       std::ostringstream oss;
       oss << " Test: " << test_ << "\n"
@@ -211,8 +211,8 @@ void DenseAlignedTest::testAssignment()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
       sv1 = 12;
       sv2 = 12;
 
@@ -240,8 +240,8 @@ void DenseAlignedTest::testAssignment()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       sv1 = { 1, 2, 3, 4, 5, 6, 7, 8 };
       sv2 = { 1, 2, 3, 4, 5, 6, 7, 8 };
@@ -262,8 +262,8 @@ void DenseAlignedTest::testAssignment()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       sv1 = { 1, 2, 3 };
       sv2 = { 1, 2, 3 };
@@ -294,10 +294,10 @@ void DenseAlignedTest::testAssignment()
       randomize( vec1, int(randmin), int(randmax) );
       vec2 = vec1;
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
-      sv1 = subvector<aligned>  ( vec1, 8UL, 16UL );
-      sv2 = subvector<unaligned>( vec2, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
+      sv1 = subvector<aligned>  ( vec1, 16UL, 16UL );
+      sv2 = subvector<unaligned>( vec2, 16UL, 16UL );
 
       checkSize( sv1, 16UL );
       checkSize( sv2, 16UL );
@@ -318,10 +318,10 @@ void DenseAlignedTest::testAssignment()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
-      sv1 = blaze::subvector( vec1_, 24UL, 16UL );
-      sv2 = blaze::subvector( vec2_, 24UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
+      sv1 = blaze::subvector( vec1_, 48UL, 16UL );
+      sv2 = blaze::subvector( vec2_, 48UL, 16UL );
 
       checkSize( sv1, 16UL );
       checkSize( sv2, 16UL );
@@ -347,8 +347,8 @@ void DenseAlignedTest::testAssignment()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       blaze::DynamicVector<short,rowVector> vec( 16UL );
       randomize( vec, short(randmin), short(randmax) );
@@ -375,8 +375,8 @@ void DenseAlignedTest::testAssignment()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       typedef blaze::CustomVector<int,aligned,padded,rowVector>  AlignedPadded;
       AlignedPadded vec( blaze::allocate<int>( 16UL ), 16UL, 16UL, blaze::Deallocate() );
@@ -404,8 +404,8 @@ void DenseAlignedTest::testAssignment()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       typedef blaze::CustomVector<int,unaligned,unpadded,rowVector>  UnalignedUnpadded;
       std::unique_ptr<int[]> array( new int[17] );
@@ -439,8 +439,8 @@ void DenseAlignedTest::testAssignment()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       blaze::CompressedVector<int,rowVector> vec( 16UL );
       randomize( vec, 6UL, int(randmin), int(randmax) );
@@ -498,10 +498,10 @@ void DenseAlignedTest::testAddAssign()
       randomize( vec1, int(randmin), int(randmax) );
       vec2 = vec1;
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
-      sv1 += subvector<aligned>  ( vec1, 8UL, 16UL );
-      sv2 += subvector<unaligned>( vec2, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
+      sv1 += subvector<aligned>  ( vec1, 16UL, 16UL );
+      sv2 += subvector<unaligned>( vec2, 16UL, 16UL );
 
       checkSize( sv1, 16UL );
       checkSize( sv2, 16UL );
@@ -522,10 +522,10 @@ void DenseAlignedTest::testAddAssign()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
-      sv1 += subvector<aligned>  ( vec1_, 24UL, 16UL );
-      sv2 += subvector<unaligned>( vec2_, 24UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
+      sv1 += subvector<aligned>  ( vec1_, 48UL, 16UL );
+      sv2 += subvector<unaligned>( vec2_, 48UL, 16UL );
 
       checkSize( sv1, 16UL );
       checkSize( sv2, 16UL );
@@ -551,8 +551,8 @@ void DenseAlignedTest::testAddAssign()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       blaze::DynamicVector<short,rowVector> vec( 16UL );
       randomize( vec, short(randmin), short(randmax) );
@@ -579,8 +579,8 @@ void DenseAlignedTest::testAddAssign()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       typedef blaze::CustomVector<int,aligned,padded,rowVector>  AlignedPadded;
       AlignedPadded vec( blaze::allocate<int>( 16UL ), 16UL, 16UL, blaze::Deallocate() );
@@ -608,8 +608,8 @@ void DenseAlignedTest::testAddAssign()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       typedef blaze::CustomVector<int,unaligned,unpadded,rowVector>  UnalignedUnpadded;
       std::unique_ptr<int[]> array( new int[17] );
@@ -643,8 +643,8 @@ void DenseAlignedTest::testAddAssign()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       blaze::CompressedVector<int,rowVector> vec( 16UL );
       randomize( vec, 6UL, int(randmin), int(randmax) );
@@ -702,10 +702,10 @@ void DenseAlignedTest::testSubAssign()
       randomize( vec1, int(randmin), int(randmax) );
       vec2 = vec1;
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
-      sv1 -= subvector<aligned>  ( vec1, 24UL, 16UL );
-      sv2 -= subvector<unaligned>( vec2, 24UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
+      sv1 -= subvector<aligned>  ( vec1, 48UL, 16UL );
+      sv2 -= subvector<unaligned>( vec2, 48UL, 16UL );
 
       checkSize( sv1, 16UL );
       checkSize( sv2, 16UL );
@@ -726,10 +726,10 @@ void DenseAlignedTest::testSubAssign()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
-      sv1 -= subvector<aligned>  ( vec1_, 24UL, 16UL );
-      sv2 -= subvector<unaligned>( vec2_, 24UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
+      sv1 -= subvector<aligned>  ( vec1_, 48UL, 16UL );
+      sv2 -= subvector<unaligned>( vec2_, 48UL, 16UL );
 
       checkSize( sv1, 16UL );
       checkSize( sv2, 16UL );
@@ -755,8 +755,8 @@ void DenseAlignedTest::testSubAssign()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       blaze::DynamicVector<short,rowVector> vec( 16UL );
       randomize( vec, short(randmin), short(randmax) );
@@ -783,8 +783,8 @@ void DenseAlignedTest::testSubAssign()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       typedef blaze::CustomVector<int,aligned,padded,rowVector>  AlignedPadded;
       AlignedPadded vec( blaze::allocate<int>( 16UL ), 16UL, 16UL, blaze::Deallocate() );
@@ -812,8 +812,8 @@ void DenseAlignedTest::testSubAssign()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       typedef blaze::CustomVector<int,unaligned,unpadded,rowVector>  UnalignedUnpadded;
       std::unique_ptr<int[]> array( new int[17] );
@@ -847,8 +847,8 @@ void DenseAlignedTest::testSubAssign()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       blaze::CompressedVector<int,rowVector> vec( 16UL );
       randomize( vec, 6UL, int(randmin), int(randmax) );
@@ -906,10 +906,10 @@ void DenseAlignedTest::testMultAssign()
       randomize( vec1, int(randmin), int(randmax) );
       vec2 = vec1;
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
-      sv1 *= subvector<aligned>  ( vec1, 24UL, 16UL );
-      sv2 *= subvector<unaligned>( vec2, 24UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
+      sv1 *= subvector<aligned>  ( vec1, 48UL, 16UL );
+      sv2 *= subvector<unaligned>( vec2, 48UL, 16UL );
 
       checkSize( sv1, 16UL );
       checkSize( sv2, 16UL );
@@ -930,10 +930,10 @@ void DenseAlignedTest::testMultAssign()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
-      sv1 *= subvector<aligned>  ( vec1_, 24UL, 16UL );
-      sv2 *= subvector<unaligned>( vec2_, 24UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
+      sv1 *= subvector<aligned>  ( vec1_, 48UL, 16UL );
+      sv2 *= subvector<unaligned>( vec2_, 48UL, 16UL );
 
       checkSize( sv1, 16UL );
       checkSize( sv2, 16UL );
@@ -959,8 +959,8 @@ void DenseAlignedTest::testMultAssign()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       blaze::DynamicVector<short,rowVector> vec( 16UL );
       randomize( vec, short(randmin), short(randmax) );
@@ -987,8 +987,8 @@ void DenseAlignedTest::testMultAssign()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       typedef blaze::CustomVector<int,aligned,padded,rowVector>  AlignedPadded;
       AlignedPadded vec( blaze::allocate<int>( 16UL ), 16UL, 16UL, blaze::Deallocate() );
@@ -1016,8 +1016,8 @@ void DenseAlignedTest::testMultAssign()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       typedef blaze::CustomVector<int,unaligned,unpadded,rowVector>  UnalignedUnpadded;
       std::unique_ptr<int[]> array( new int[17] );
@@ -1051,8 +1051,8 @@ void DenseAlignedTest::testMultAssign()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       blaze::CompressedVector<int,rowVector> vec( 16UL );
       randomize( vec, 6UL, int(randmin), int(randmax) );
@@ -1110,10 +1110,10 @@ void DenseAlignedTest::testDivAssign()
       randomize( vec1, 1, int(randmax) );
       vec2 = vec1;
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
-      sv1 /= subvector<aligned>  ( vec1, 24UL, 16UL );
-      sv2 /= subvector<unaligned>( vec2, 24UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
+      sv1 /= subvector<aligned>  ( vec1, 48UL, 16UL );
+      sv2 /= subvector<unaligned>( vec2, 48UL, 16UL );
 
       checkSize( sv1, 16UL );
       checkSize( sv2, 16UL );
@@ -1135,10 +1135,10 @@ void DenseAlignedTest::testDivAssign()
       randomize( vec1_, 1, int(randmax) );
       vec2_ = vec1_;
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
-      sv1 /= subvector<aligned>  ( vec1_, 24UL, 16UL );
-      sv2 /= subvector<unaligned>( vec2_, 24UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
+      sv1 /= subvector<aligned>  ( vec1_, 48UL, 16UL );
+      sv2 /= subvector<unaligned>( vec2_, 48UL, 16UL );
 
       checkSize( sv1, 16UL );
       checkSize( sv2, 16UL );
@@ -1164,8 +1164,8 @@ void DenseAlignedTest::testDivAssign()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       blaze::DynamicVector<short,rowVector> vec( 16UL );
       randomize( vec, short(1), short(randmax) );
@@ -1192,8 +1192,8 @@ void DenseAlignedTest::testDivAssign()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       typedef blaze::CustomVector<int,aligned,padded,rowVector>  AlignedPadded;
       AlignedPadded vec( blaze::allocate<int>( 16UL ), 16UL, 16UL, blaze::Deallocate() );
@@ -1221,8 +1221,8 @@ void DenseAlignedTest::testDivAssign()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       typedef blaze::CustomVector<int,unaligned,unpadded,rowVector>  UnalignedUnpadded;
       std::unique_ptr<int[]> array( new int[17] );
@@ -1274,8 +1274,8 @@ void DenseAlignedTest::testScaling()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       sv1 *= 3;
       sv2 *= 3;
@@ -1304,8 +1304,8 @@ void DenseAlignedTest::testScaling()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       sv1 = sv1 * 3;
       sv2 = sv2 * 3;
@@ -1334,8 +1334,8 @@ void DenseAlignedTest::testScaling()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       sv1 = 3 * sv1;
       sv2 = 3 * sv2;
@@ -1364,8 +1364,8 @@ void DenseAlignedTest::testScaling()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       sv1 /= 0.5;
       sv2 /= 0.5;
@@ -1394,8 +1394,8 @@ void DenseAlignedTest::testScaling()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       sv1 = sv1 / 0.5;
       sv2 = sv2 / 0.5;
@@ -1424,10 +1424,10 @@ void DenseAlignedTest::testScaling()
 
       initialize();
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
-      // Integral scaling of the subvector in the range [8,23]
+      // Integral scaling of the subvector in the range [16,31]
       sv1.scale( 3 );
       sv2.scale( 3 );
 
@@ -1437,14 +1437,14 @@ void DenseAlignedTest::testScaling()
       if( sv1 != sv2 || vec1_ != vec2_ ) {
          std::ostringstream oss;
          oss << " Test: " << test_ << "\n"
-             << " Error: Integral scale operation of range [8,23] failed\n"
+             << " Error: Integral scale operation of range [16,31] failed\n"
              << " Details:\n"
              << "   Result:\n" << sv1 << "\n"
              << "   Expected result:\n" << sv2 << "\n";
          throw std::runtime_error( oss.str() );
       }
 
-      // Floating point scaling of the subvector in the range [8,23]
+      // Floating point scaling of the subvector in the range [16,31]
       sv1.scale( 0.5 );
       sv2.scale( 0.5 );
 
@@ -1454,7 +1454,7 @@ void DenseAlignedTest::testScaling()
       if( sv1 != sv2 || vec1_ != vec2_ ) {
          std::ostringstream oss;
          oss << " Test: " << test_ << "\n"
-             << " Error: Floating point scale operation of range [8,23] failed\n"
+             << " Error: Floating point scale operation of range [16,31] failed\n"
              << " Details:\n"
              << "   Result:\n" << sv1 << "\n"
              << "   Expected result:\n" << sv2 << "\n";
@@ -1486,8 +1486,8 @@ void DenseAlignedTest::testSubscript()
 
    initialize();
 
-   ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-   USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+   ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+   USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
    // Assignment to the element at index 1
    sv1[1] = 9;
@@ -1712,7 +1712,7 @@ void DenseAlignedTest::testIterator()
    {
       test_ = "Read-only access via ConstIterator";
 
-      ASVT sv = subvector<aligned>( vec1_, 8UL, 8UL );
+      ASVT sv = subvector<aligned>( vec1_, 16UL, 8UL );
       ASVT::ConstIterator it ( cbegin( sv ) );
       ASVT::ConstIterator end( cend( sv ) );
 
@@ -1809,8 +1809,8 @@ void DenseAlignedTest::testIterator()
    {
       test_ = "Assignment via Iterator";
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
       int value = 6;
 
       ASVT::Iterator it1( begin( sv1 ) );
@@ -1837,8 +1837,8 @@ void DenseAlignedTest::testIterator()
    {
       test_ = "Addition assignment via Iterator";
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
       int value = 6;
 
       ASVT::Iterator it1( begin( sv1 ) );
@@ -1865,8 +1865,8 @@ void DenseAlignedTest::testIterator()
    {
       test_ = "Subtraction assignment via Iterator";
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
       int value = 6;
 
       ASVT::Iterator it1( begin( sv1 ) );
@@ -1893,8 +1893,8 @@ void DenseAlignedTest::testIterator()
    {
       test_ = "Multiplication assignment via Iterator";
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
       int value = 1;
 
       ASVT::Iterator it1( begin( sv1 ) );
@@ -1921,8 +1921,8 @@ void DenseAlignedTest::testIterator()
    {
       test_ = "Division assignment via Iterator";
 
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-      USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+      USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
       ASVT::Iterator it1( begin( sv1 ) );
       USVT::Iterator it2( begin( sv2 ) );
@@ -1967,8 +1967,8 @@ void DenseAlignedTest::testNonZeros()
    initialize();
 
    // Initialization check
-   ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 16UL );
-   USVT sv2 = subvector<unaligned>( vec2_, 8UL, 16UL );
+   ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 16UL );
+   USVT sv2 = subvector<unaligned>( vec2_, 16UL, 16UL );
 
    checkSize( sv1, 16UL );
    checkSize( sv2, 16UL );
@@ -2001,8 +2001,8 @@ void DenseAlignedTest::testNonZeros()
    }
 
    // Changing the number of non-zeros via the dense vector
-   vec1_[9UL] = 5;
-   vec2_[9UL] = 5;
+   vec1_[17UL] = 5;
+   vec2_[17UL] = 5;
 
    checkSize( sv1, 16UL );
    checkSize( sv2, 16UL );
@@ -2175,7 +2175,7 @@ void DenseAlignedTest::testIsDefault()
    // isDefault with default vector
    {
       VT vec( 64UL, 0 );
-      ASVT sv = subvector<aligned>( vec, 8UL, 16UL );
+      ASVT sv = subvector<aligned>( vec, 16UL, 16UL );
 
       if( isDefault( sv[1] ) != true ) {
          std::ostringstream oss;
@@ -2198,7 +2198,7 @@ void DenseAlignedTest::testIsDefault()
 
    // isDefault with non-default vector
    {
-      ASVT sv = subvector<aligned>( vec1_, 8UL, 16UL );
+      ASVT sv = subvector<aligned>( vec1_, 16UL, 16UL );
 
       if( isDefault( sv ) != false ) {
          std::ostringstream oss;
@@ -2377,10 +2377,10 @@ void DenseAlignedTest::testSubvector()
    initialize();
 
    {
-      ASVT sv1 = subvector<aligned>  ( vec1_, 8UL, 32UL );
-      ASVT sv2 = subvector<aligned>  ( sv1  , 8UL, 16UL );
-      USVT sv3 = subvector<unaligned>( vec2_, 8UL, 32UL );
-      USVT sv4 = subvector<unaligned>( sv3  , 8UL, 16UL );
+      ASVT sv1 = subvector<aligned>  ( vec1_, 16UL, 32UL );
+      ASVT sv2 = subvector<aligned>  ( sv1  , 16UL, 16UL );
+      USVT sv3 = subvector<unaligned>( vec2_, 16UL, 32UL );
+      USVT sv4 = subvector<unaligned>( sv3  , 16UL, 16UL );
 
       if( sv2 != sv4 || vec1_ != vec2_ ) {
          std::ostringstream oss;
@@ -2414,7 +2414,7 @@ void DenseAlignedTest::testSubvector()
    }
 
    try {
-      ASVT sv1 = subvector<aligned>( vec1_,  8UL, 32UL );
+      ASVT sv1 = subvector<aligned>( vec1_, 16UL, 32UL );
       ASVT sv2 = subvector<aligned>( sv1  , 32UL,  8UL );
 
       std::ostringstream oss;
@@ -2427,8 +2427,8 @@ void DenseAlignedTest::testSubvector()
    catch( std::invalid_argument& ) {}
 
    try {
-      ASVT sv1 = subvector<aligned>( vec1_, 8UL, 32UL );
-      ASVT sv2 = subvector<aligned>( sv1  , 8UL, 32UL );
+      ASVT sv1 = subvector<aligned>( vec1_, 16UL, 32UL );
+      ASVT sv2 = subvector<aligned>( sv1  , 16UL, 32UL );
 
       std::ostringstream oss;
       oss << " Test: " << test_ << "\n"
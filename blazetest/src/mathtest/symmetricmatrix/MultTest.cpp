@@ -0,0 +1,166 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/symmetricmatrix/MultTest.cpp
+//  \brief Source file for the SymmetricMatrix multiplication test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/symmetricmatrix/MultTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace symmetricmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SymmetricMatrix multiplication test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+MultTest::MultTest()
+{
+   testDenseMultiplication();
+   testSparseMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of dense symmetric matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of dense symmetric matrices of both storage orders
+// with dense vectors and dense matrices. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void MultTest::testDenseMultiplication()
+{
+   using blaze::SymmetricMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Dense symmetric matrix multiplication";
+
+   const size_t sizes[] = { 1UL, 7UL, 16UL, 33UL, 128UL, 1600UL };
+
+   for( size_t n : sizes ) {
+      runDenseTests< SymmetricMatrix< DynamicMatrix<double,rowMajor> >, DynamicMatrix<double,rowMajor> >( n );
+      runDenseTests< SymmetricMatrix< DynamicMatrix<double,columnMajor> >, DynamicMatrix<double,columnMajor> >( n );
+      runDenseTests< SymmetricMatrix< DynamicMatrix<float,rowMajor> >, DynamicMatrix<float,rowMajor> >( n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of sparse symmetric matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of sparse symmetric matrices with dense vectors. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void MultTest::testSparseMultiplication()
+{
+   using blaze::SymmetricMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::rowMajor;
+
+   test_ = "Sparse symmetric matrix multiplication";
+
+   const size_t sizes[] = { 1UL, 7UL, 16UL, 33UL, 128UL, 2000UL };
+
+   for( size_t n : sizes ) {
+      runSparseTests< SymmetricMatrix< CompressedMatrix<double,rowMajor> >, CompressedMatrix<double,rowMajor> >( n, 3UL );
+      runSparseTests< SymmetricMatrix< CompressedMatrix<float,rowMajor> >, CompressedMatrix<float,rowMajor> >( n, 5UL );
+   }
+}
+//*************************************************************************************************
+
+} // namespace symmetricmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SymmetricMatrix multiplication test..." << std::endl;
+
+   try
+   {
+      RUN_SYMMETRICMATRIX_MULT_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SymmetricMatrix multiplication test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,262 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/cachehierarchy/ClassTest.cpp
+//  \brief Source file for the CacheHierarchy class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/dense/MMM.h>
+#include <blazetest/utiltest/cachehierarchy/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace cachehierarchy {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CacheHierarchy class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testHierarchy();
+   testBlocking();
+   testStreaming();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the detected cache hierarchy.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the detected cache hierarchy is consistent and that the default
+// cache hierarchy is used in case the cache hierarchy could not be determined. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testHierarchy()
+{
+   test_ = "Cache hierarchy";
+
+   const blaze::CacheHierarchy& caches( blaze::cacheHierarchy() );
+
+   check( caches.l1Size >= 4096UL, "Invalid L1 cache size", caches.l1Size );
+   check( caches.l2Size >= caches.l1Size, "Invalid L2 cache size", caches.l2Size );
+   check( caches.l3Size >= caches.l2Size, "Invalid L3 cache size", caches.l3Size );
+   check( caches.lineSize >= 16UL && ( caches.lineSize & ( caches.lineSize-1UL ) ) == 0UL,
+          "Invalid cache line size", caches.lineSize );
+
+   if( !caches.detected || !BLAZE_USE_CACHE_DETECTION ) {
+      check( !caches.detected, "Cache hierarchy detected despite disabled detection", 0UL );
+      check( caches.l3Size == blaze::cacheSize, "Invalid default L3 cache size", caches.l3Size );
+   }
+
+   check( &caches == &blaze::cacheHierarchy(), "Cache hierarchy is not cached", 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the block sizes derived from the cache hierarchy.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the block sizes derived from the cache hierarchy satisfy the same
+// constraints as the compile time block sizes. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testBlocking()
+{
+   using blaze::MMMBlocking;
+
+   test_ = "Block sizes";
+
+   const size_t block( blaze::BLOCK_SIZE );
+   check( block >= 4UL, "Invalid block size", block );
+
+   const size_t ib( blaze::DMATDMATMULT_IBLOCK_SIZE );
+   const size_t jb( blaze::DMATDMATMULT_JBLOCK_SIZE );
+   const size_t kb( blaze::DMATDMATMULT_KBLOCK_SIZE );
+   check( ib >= 4UL, "Invalid row block size", ib );
+   check( jb >= 64UL && jb % 32UL == 0UL, "Invalid column block size", jb );
+   check( kb >= 4UL, "Invalid inner block size", kb );
+
+   const size_t tib( blaze::TDMATTDMATMULT_IBLOCK_SIZE );
+   const size_t tjb( blaze::TDMATTDMATMULT_JBLOCK_SIZE );
+   const size_t tkb( blaze::TDMATTDMATMULT_KBLOCK_SIZE );
+   check( tib >= 64UL && tib % 32UL == 0UL, "Invalid row block size", tib );
+   check( tjb >= 4UL, "Invalid column block size", tjb );
+   check( tkb >= 4UL, "Invalid inner block size", tkb );
+
+   check( MMMBlocking<double>::kc() > 0UL, "Invalid packed inner block size", MMMBlocking<double>::kc() );
+   check( MMMBlocking<double>::mc() % MMMBlocking<double>::MR == 0UL,
+          "Invalid packed row block size", MMMBlocking<double>::mc() );
+   check( MMMBlocking<double>::nc() % MMMBlocking<double>::NR == 0UL,
+          "Invalid packed column block size", MMMBlocking<double>::nc() );
+   check( MMMBlocking<float>::mc() % MMMBlocking<float>::MR == 0UL,
+          "Invalid packed row block size", MMMBlocking<float>::mc() );
+   check( MMMBlocking<float>::nc() % MMMBlocking<float>::NR == 0UL,
+          "Invalid packed column block size", MMMBlocking<float>::nc() );
+
+   if( !blaze::cacheHierarchy().detected && !BLAZE_DEBUG_MODE ) {
+      check( block == blaze::DEFAULT_BLOCK_SIZE, "Invalid default block size", block );
+      check( jb == blaze::DMATDMATMULT_DEFAULT_JBLOCK_SIZE, "Invalid default column block size", jb );
+      check( MMMBlocking<double>::mc() == MMMBlocking<double>::MC,
+             "Invalid default packed row block size", MMMBlocking<double>::mc() );
+      check( MMMBlocking<double>::kc() == MMMBlocking<double>::KC,
+             "Invalid default packed inner block size", MMMBlocking<double>::kc() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the size limit for the use of non-temporal stores.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the size limit for assignments via regular stores is derived from
+// the size of the last level cache. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testStreaming()
+{
+   test_ = "Streaming threshold";
+
+   const size_t llc( blaze::cacheHierarchy().l3Size );
+
+   check( blaze::streamingThreshold( sizeof(double) ) == llc / ( 3UL*sizeof(double) ),
+          "Invalid streaming threshold", blaze::streamingThreshold( sizeof(double) ) );
+   check( blaze::streamingThreshold( sizeof(float) ) >= blaze::streamingThreshold( sizeof(double) ),
+          "Invalid streaming threshold", blaze::streamingThreshold( sizeof(float) ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the given condition.
+//
+// \param condition The condition to be checked.
+// \param error The error message in case the condition is violated.
+// \param value The value that has been checked.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::check( bool condition, const std::string& error, size_t value ) const
+{
+   if( !condition ) {
+      const blaze::CacheHierarchy& caches( blaze::cacheHierarchy() );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Value             : " << value << "\n"
+          << "   L1 cache size     : " << caches.l1Size << "\n"
+          << "   L2 cache size     : " << caches.l2Size << "\n"
+          << "   L3 cache size     : " << caches.l3Size << "\n"
+          << "   Cache line size   : " << caches.lineSize << "\n"
+          << "   Detected hierarchy: " << caches.detected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace cachehierarchy
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CacheHierarchy class test..." << std::endl;
+
+   try
+   {
+      RUN_CACHEHIERARCHY_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CacheHierarchy class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
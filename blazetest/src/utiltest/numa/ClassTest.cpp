@@ -0,0 +1,337 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/numa/ClassTest.cpp
+//  \brief Source file for the NUMA class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blazetest/utiltest/numa/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace numa {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the NUMA class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   const blaze::NumaPolicy policy( blaze::numaPolicy() );
+
+   testCPUList();
+   testAffinity();
+   testPolicy();
+   testFirstTouch();
+   testInterleave();
+
+   blaze::setNumaPolicy( policy );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parsing of CPU lists.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parsing of CPU lists as used by the \c BLAZE_THREAD_AFFINITY
+// environment variable. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testCPUList()
+{
+   test_ = "CPU list";
+
+   {
+      const std::vector<size_t> cpus( blaze::parseCPUList( "0,2,4-7" ) );
+      const std::vector<size_t> expected{ 0UL, 2UL, 4UL, 5UL, 6UL, 7UL };
+      check( cpus == expected, "Invalid parsing of \"0,2,4-7\"" );
+   }
+
+   {
+      const std::vector<size_t> cpus( blaze::parseCPUList( "3,1\n" ) );
+      const std::vector<size_t> expected{ 3UL, 1UL };
+      check( cpus == expected, "Invalid parsing of \"3,1\"" );
+   }
+
+   const char* invalid[] = { "", "a", "1,", "3-1", "1-", "-1", "1,,2", "1-2-3" };
+
+   for( const char* list : invalid )
+   {
+      bool thrown( false );
+
+      try {
+         blaze::parseCPUList( list );
+      }
+      catch( std::invalid_argument& ) {
+         thrown = true;
+      }
+
+      check( thrown, std::string( "No exception for invalid CPU list \"" ) + list + "\"" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the thread affinity settings.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the list of CPUs for the threads of the shared memory
+// parallelization does not contain any duplicates. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAffinity()
+{
+   test_ = "Thread affinity";
+
+   std::vector<size_t> cpus( blaze::threadCPUs() );
+   std::sort( cpus.begin(), cpus.end() );
+
+   check( std::adjacent_find( cpus.begin(), cpus.end() ) == cpus.end(),
+          "Duplicate CPUs in the thread affinity list" );
+   check( &blaze::threadCPUs() == &blaze::threadCPUs(), "Thread affinity list is not cached" );
+   check( blaze::numaNodes() >= 1UL, "Invalid number of NUMA nodes" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the selection of the NUMA policy.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the runtime selection of the NUMA policy. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testPolicy()
+{
+   test_ = "NUMA policy";
+
+   blaze::setNumaPolicy( blaze::NumaPolicy::firstTouch );
+   check( blaze::numaPolicy() == blaze::NumaPolicy::firstTouch, "Invalid first-touch policy" );
+
+   blaze::setNumaPolicy( blaze::NumaPolicy::interleave );
+   check( blaze::numaPolicy() == blaze::NumaPolicy::interleave, "Invalid interleave policy" );
+
+   blaze::setNumaPolicy( blaze::NumaPolicy::none );
+   check( blaze::numaPolicy() == blaze::NumaPolicy::none, "Invalid default policy" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the first-touch initialization of dense vectors and matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that dense vectors and matrices that are initialized according to the
+// first-touch policy contain the correct values, including the padding elements. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFirstTouch()
+{
+   test_ = "First-touch initialization";
+
+   blaze::setNumaPolicy( blaze::NumaPolicy::firstTouch );
+
+   {
+      const blaze::DynamicVector<double> a( 100003UL, 2.0 );
+      check( std::count( a.begin(), a.end(), 2.0 ) == 100003, "Invalid vector initialization" );
+      check( a.data()[a.capacity()-1UL] == 0.0, "Invalid vector padding" );
+
+      const blaze::DynamicVector<int> b( 100003UL );
+      check( std::count( b.begin(), b.end(), 0 ) == 100003, "Invalid default vector initialization" );
+
+      const blaze::DynamicVector<float> c( 7UL, 1.0F );
+      check( std::count( c.begin(), c.end(), 1.0F ) == 7, "Invalid small vector initialization" );
+   }
+
+   {
+      const blaze::DynamicMatrix<double,blaze::rowMajor> A( 313UL, 331UL, 3.0 );
+      const blaze::DynamicMatrix<double,blaze::rowMajor> B( 313UL, 331UL );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         check( std::count( A.begin(i), A.end(i), 3.0 ) == 331, "Invalid row-major matrix initialization" );
+         check( std::count( B.begin(i), B.end(i), 0.0 ) == 331, "Invalid row-major default initialization" );
+         check( A.data(i)[A.spacing()-1UL] == 0.0, "Invalid row-major matrix padding" );
+      }
+   }
+
+   {
+      const blaze::DynamicMatrix<float,blaze::columnMajor> A( 313UL, 331UL, 4.0F );
+      const blaze::DynamicMatrix<float,blaze::columnMajor> B( 313UL, 331UL );
+
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         check( std::count( A.begin(j), A.end(j), 4.0F ) == 313, "Invalid column-major matrix initialization" );
+         check( std::count( B.begin(j), B.end(j), 0.0F ) == 313, "Invalid column-major default initialization" );
+         check( A.data(j)[A.spacing()-1UL] == 0.0F, "Invalid column-major matrix padding" );
+      }
+   }
+
+   {
+      const blaze::DynamicVector< blaze::DynamicVector<int> > a( 1000UL, blaze::DynamicVector<int>( 3UL, 5 ) );
+      check( a[999UL].size() == 3UL && a[999UL][2UL] == 5, "Invalid initialization of nested vectors" );
+   }
+
+   blaze::setNumaPolicy( blaze::NumaPolicy::none );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the interleaved allocation of dense vectors and matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that large dense vectors and matrices can be allocated and used with
+// the interleave policy. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testInterleave()
+{
+   test_ = "Interleaved allocation";
+
+   blaze::setNumaPolicy( blaze::NumaPolicy::interleave );
+
+   {
+      const blaze::DynamicVector<double> a( 1000000UL, 1.0 );
+      check( std::count( a.begin(), a.end(), 1.0 ) == 1000000, "Invalid vector initialization" );
+
+      const blaze::DynamicMatrix<double> A( 600UL, 600UL, 2.0 );
+      check( A(599UL,599UL) == 2.0 && A(0UL,0UL) == 2.0, "Invalid matrix initialization" );
+   }
+
+   blaze::setNumaPolicy( blaze::NumaPolicy::none );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the given condition.
+//
+// \param condition The condition to be checked.
+// \param error The error message in case the condition is violated.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::check( bool condition, const std::string& error ) const
+{
+   if( !condition ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   NUMA nodes   : " << blaze::numaNodes() << "\n"
+          << "   Pinned CPUs  : " << blaze::threadCPUs().size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace numa
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running NUMA class test..." << std::endl;
+
+   try
+   {
+      RUN_NUMA_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during NUMA class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,369 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/thresholdprofile/ClassTest.cpp
+//  \brief Source file for the ThresholdProfile class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blazetest/utiltest/thresholdprofile/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace thresholdprofile {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThresholdProfile class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testEnvironment();
+   testDefault();
+   testName();
+   testSet();
+   testLoad();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the configuration of thresholds via environment variables.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the configuration of thresholds via the \c BLAZE_THRESHOLD_* environment
+// variables. Since the environment is only evaluated during the first use of a threshold, this
+// test has to be performed first. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testEnvironment()
+{
+#if !defined(_WIN32)
+   test_ = "Configuration via environment variables";
+
+   setenv( "BLAZE_THRESHOLD_SMP_DVECDVECADD", "1234", 1 );
+   setenv( "BLAZE_THRESHOLD_SMP_DVECDVECSUB", "invalid", 1 );
+
+   checkValue( blaze::SMP_DVECDVECADD_THRESHOLD, 1234UL );
+   checkValue( blaze::SMP_DVECDVECSUB_THRESHOLD, blaze::SMP_DVECDVECSUB_THRESHOLD.defaultValue() );
+
+   blaze::resetThreshold( blaze::ThresholdID::SMP_DVECDVECADD );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the default values of the thresholds.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that all thresholds that have not been configured at runtime evaluate
+// to their compile time values. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testDefault()
+{
+   test_ = "Default threshold values";
+
+   checkValue( blaze::SMP_DVECASSIGN_THRESHOLD, ( BLAZE_DEBUG_MODE )
+                                                ?( blaze::SMP_DVECASSIGN_DEBUG_THRESHOLD )
+                                                :( blaze::SMP_DVECASSIGN_USER_THRESHOLD ) );
+   checkValue( blaze::DMATDMATMULT_THRESHOLD, ( BLAZE_DEBUG_MODE )
+                                              ?( blaze::DMATDMATMULT_DEBUG_THRESHOLD )
+                                              :( blaze::DMATDMATMULT_USER_THRESHOLD ) );
+   checkValue( blaze::SMP_DMATREDUCE_THRESHOLD, blaze::SMP_DMATREDUCE_THRESHOLD.defaultValue() );
+   checkValue( blaze::SMP_BATCH_THRESHOLD, blaze::SMP_BATCH_THRESHOLD.defaultValue() );
+   checkValue( blaze::SMP_DMATDMATSCHUR_THRESHOLD, blaze::SMP_DMATDMATSCHUR_THRESHOLD.defaultValue() );
+   checkValue( blaze::SMP_SMATSMATSCHUR_THRESHOLD, blaze::SMP_SMATSMATSCHUR_THRESHOLD.defaultValue() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the names of the thresholds.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the conversion between threshold names and threshold identifiers. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testName()
+{
+   test_ = "Threshold names";
+
+   for( size_t i=0UL; i<blaze::thresholdCount; ++i )
+   {
+      const blaze::ThresholdID id( static_cast<blaze::ThresholdID>( i ) );
+      blaze::ThresholdID found( blaze::ThresholdID::DMATDVECMULT );
+
+      if( !blaze::findThreshold( blaze::name( id ), found ) || found != id ||
+          !blaze::findThreshold( std::string( blaze::name( id ) ) + "_THRESHOLD", found ) || found != id ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Threshold could not be found\n"
+             << " Details:\n"
+             << "   Name: " << blaze::name( id ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   blaze::ThresholdID found( blaze::ThresholdID::DMATDVECMULT );
+
+   if( blaze::findThreshold( "SMP_DVEC", found ) || blaze::findThreshold( "_THRESHOLD", found ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid threshold name accepted\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the setThreshold() and resetThreshold() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the setThreshold() and resetThreshold() functions. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSet()
+{
+   test_ = "setThreshold() and resetThreshold()";
+
+   blaze::setThreshold( blaze::ThresholdID::SMP_DVECASSIGN, 0UL );
+   checkValue( blaze::SMP_DVECASSIGN_THRESHOLD, 0UL );
+
+   blaze::setThreshold( blaze::ThresholdID::SMP_DVECASSIGN, 100000UL );
+   checkValue( blaze::SMP_DVECASSIGN_THRESHOLD, 100000UL );
+
+   if( !( 200000UL > blaze::SMP_DVECASSIGN_THRESHOLD ) || 50000UL >= blaze::SMP_DVECASSIGN_THRESHOLD ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid threshold comparison\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::resetThreshold( blaze::ThresholdID::SMP_DVECASSIGN );
+   checkValue( blaze::SMP_DVECASSIGN_THRESHOLD, blaze::SMP_DVECASSIGN_THRESHOLD.defaultValue() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the loadThresholdProfile() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the loadThresholdProfile() function. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLoad()
+{
+   const std::string file( "thresholdprofile.tmp" );
+
+   {
+      test_ = "loadThresholdProfile() with valid profile";
+
+      {
+         std::ofstream out( file.c_str() );
+         out << "# Threshold profile\n"
+             << "\n"
+             << "SMP_DVECASSIGN = 12345\n"
+             << "  SMP_DMATDVECMULT_THRESHOLD=77  # Comment\n"
+             << "DMATDMATMULT 4096\n";
+      }
+
+      blaze::loadThresholdProfile( file );
+
+      checkValue( blaze::SMP_DVECASSIGN_THRESHOLD  , 12345UL );
+      checkValue( blaze::SMP_DMATDVECMULT_THRESHOLD, 77UL    );
+      checkValue( blaze::DMATDMATMULT_THRESHOLD    , 4096UL  );
+      checkValue( blaze::SMP_DVECDVECMULT_THRESHOLD, blaze::SMP_DVECDVECMULT_THRESHOLD.defaultValue() );
+   }
+
+   {
+      test_ = "loadThresholdProfile() with invalid profile";
+
+      {
+         std::ofstream out( file.c_str() );
+         out << "SMP_DVECASSIGN = 1\n"
+             << "SMP_DVECASIGN  = 2\n";
+      }
+
+      try {
+         blaze::loadThresholdProfile( file );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading an invalid threshold profile succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkValue( blaze::SMP_DVECASSIGN_THRESHOLD, 12345UL );
+
+      {
+         std::ofstream out( file.c_str() );
+         out << "SMP_DVECASSIGN = -1\n";
+      }
+
+      try {
+         blaze::loadThresholdProfile( file );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading a negative threshold succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   std::remove( file.c_str() );
+
+   {
+      test_ = "loadThresholdProfile() with missing profile";
+
+      try {
+         blaze::loadThresholdProfile( file );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading a missing threshold profile succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ) {}
+   }
+
+   blaze::resetThreshold( blaze::ThresholdID::SMP_DVECASSIGN   );
+   blaze::resetThreshold( blaze::ThresholdID::SMP_DMATDVECMULT );
+   blaze::resetThreshold( blaze::ThresholdID::DMATDMATMULT     );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the given threshold value.
+//
+// \param value The threshold value to be checked.
+// \param expected The expected threshold value.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkValue( size_t value, size_t expected ) const
+{
+   if( value != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid threshold value detected\n"
+          << " Details:\n"
+          << "   Value         : " << value << "\n"
+          << "   Expected value: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace thresholdprofile
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ThresholdProfile class test..." << std::endl;
+
+   try
+   {
+      RUN_THRESHOLDPROFILE_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ThresholdProfile class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
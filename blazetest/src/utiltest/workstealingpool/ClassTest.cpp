@@ -0,0 +1,397 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/workstealingpool/ClassTest.cpp
+//  \brief Source file for the WorkStealingPool class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blazetest/utiltest/workstealingpool/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace workstealingpool {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the WorkStealingPool class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructor();
+   testResize();
+
+   for( size_t threads=1UL; threads<=4UL; ++threads ) {
+      testSchedule    ( threads );
+      testForkJoin    ( threads );
+      testNested      ( threads );
+      testOverflow    ( threads );
+      testLargeFunctor( threads );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the WorkStealingPool constructor.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the constructor of the WorkStealingPool class template. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructor()
+{
+   {
+      test_ = "WorkStealingPool constructor (3 threads)";
+
+      Pool pool( 3UL );
+
+      checkCount( pool.size(), 3UL );
+
+      if( !pool.isEmpty() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-empty thread pool detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "WorkStealingPool constructor (0 threads)";
+
+      try {
+         Pool pool( 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with 0 threads succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of independent tasks.
+//
+// \param threads The number of threads of the pool.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules a number of independent tasks and checks that all tasks have been
+// executed after the call to wait(). In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSchedule( size_t threads )
+{
+   test_ = "WorkStealingPool::schedule()";
+
+   Pool pool( threads );
+   Counter counter( 0UL );
+
+   for( size_t i=0UL; i<100UL; ++i ) {
+      pool.schedule( [&counter]( size_t value ) { counter += value; }, i );
+   }
+   pool.wait();
+
+   checkCount( counter, 4950UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of repeated fork/join cycles.
+//
+// \param threads The number of threads of the pool.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a large number of short fork/join cycles, which corresponds to the
+// usage pattern of the shared memory parallelization. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testForkJoin( size_t threads )
+{
+   test_ = "WorkStealingPool fork/join";
+
+   Pool pool( threads );
+
+   for( size_t cycle=0UL; cycle<1000UL; ++cycle )
+   {
+      Counter counter( 0UL );
+
+      for( size_t i=0UL; i<threads; ++i ) {
+         pool.schedule( [&counter]() { ++counter; } );
+      }
+      pool.wait();
+
+      checkCount( counter, threads );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of tasks from within tasks.
+//
+// \param threads The number of threads of the pool.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules tasks that recursively schedule further tasks and checks that the
+// call to wait() only returns after all tasks have been completed. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNested( size_t threads )
+{
+   test_ = "WorkStealingPool nested scheduling";
+
+   Pool pool( threads );
+   Counter counter( 0UL );
+
+   for( size_t i=0UL; i<10UL; ++i ) {
+      pool.schedule( [&pool,&counter]() {
+         for( size_t j=0UL; j<10UL; ++j ) {
+            pool.schedule( [&pool,&counter]() {
+               for( size_t k=0UL; k<10UL; ++k ) {
+                  pool.schedule( [&counter]() { ++counter; } );
+               }
+            } );
+         }
+      } );
+   }
+   pool.wait();
+
+   checkCount( counter, 1000UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of more tasks than fit into the task deques.
+//
+// \param threads The number of threads of the pool.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules more tasks than a single task deque can hold and checks that all
+// tasks are executed. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testOverflow( size_t threads )
+{
+   test_ = "WorkStealingPool deque overflow";
+
+   Pool pool( threads );
+   Counter counter( 0UL );
+
+   for( size_t i=0UL; i<10000UL; ++i ) {
+      pool.schedule( [&counter]() { ++counter; } );
+   }
+   pool.wait();
+
+   checkCount( counter, 10000UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of functors that exceed the size of a task slot.
+//
+// \param threads The number of threads of the pool.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules functors that are too large to be stored in place and checks that
+// they are correctly executed and destroyed. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLargeFunctor( size_t threads )
+{
+   test_ = "WorkStealingPool large functors";
+
+   struct Large {
+      void operator()() const { *counter_ += data_[0] + data_[63]; }
+      Counter* counter_;
+      size_t data_[64];
+   };
+
+   Pool pool( threads );
+   Counter counter( 0UL );
+
+   Large large;
+   large.counter_ = &counter;
+   for( size_t i=0UL; i<64UL; ++i ) {
+      large.data_[i] = i;
+   }
+
+   for( size_t i=0UL; i<100UL; ++i ) {
+      pool.schedule( large );
+   }
+   pool.wait();
+
+   checkCount( counter, 6300UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() member function of the WorkStealingPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize() member function of the WorkStealingPool class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "WorkStealingPool::resize()";
+
+   Pool pool( 1UL );
+   Counter counter( 0UL );
+
+   for( size_t threads=2UL; threads<=5UL; ++threads )
+   {
+      for( size_t i=0UL; i<100UL; ++i ) {
+         pool.schedule( [&counter]() { ++counter; } );
+      }
+
+      pool.resize( threads );
+
+      checkCount( pool.size(), threads );
+      checkCount( counter, 100UL*( threads-1UL ) );
+   }
+
+   try {
+      pool.resize( 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing to 0 threads succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the given count.
+//
+// \param count The count to be checked.
+// \param expected The expected count.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkCount( size_t count, size_t expected ) const
+{
+   if( count != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid count detected\n"
+          << " Details:\n"
+          << "   Count         : " << count << "\n"
+          << "   Expected count: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace workstealingpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running WorkStealingPool class test..." << std::endl;
+
+   try
+   {
+      RUN_WORKSTEALINGPOOL_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during WorkStealingPool class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************